@@ -258,6 +258,20 @@ typedef int (*arg_cmdfn)(int argc, char* argv[], arg_dstr_t res, void* ctx);
  */
 typedef int(arg_comparefn)(const void* k1, const void* k2);
 
+/**
+ * Function pointer types for custom memory allocation functions.
+ *
+ * The `arg_mallocfn`, `arg_reallocfn` and `arg_freefn` types define the
+ * signatures of the functions Argtable3 uses for all of its internal
+ * allocations, including the temporary buffers allocated by `arg_parse`. They
+ * follow the semantics of the standard `malloc`, `realloc` and `free`.
+ *
+ * @see arg_set_allocators
+ */
+typedef void*(arg_mallocfn)(size_t size);
+typedef void*(arg_reallocfn)(void* ptr, size_t size);
+typedef void(arg_freefn)(void* ptr);
+
 /**
  * Defines common properties shared by all `arg_<type>` structs.
  *
@@ -2393,6 +2407,27 @@ ARG_EXTERN int arg_cmd_itr_search(arg_cmd_itr_t itr, void* k);
  */
 ARG_EXTERN void arg_mgsort(void* data, int size, int esize, int i, int k, arg_comparefn* comparefn);
 
+/**
+ * Replaces the memory allocation functions used by Argtable3.
+ *
+ * By default, Argtable3 allocates its argument structures and the temporary
+ * buffers of `arg_parse` with the standard `malloc`, `realloc` and `free`.
+ * The `arg_set_allocators` function lets the application provide its own
+ * functions, for example to take the temporary buffers of `arg_parse` from a
+ * scratch arena instead of the heap.
+ *
+ * The functions must be set before any argument table is created, and the
+ * `free_fn` function must accept any pointer returned by `malloc_fn` and
+ * `realloc_fn`. Passing `NULL` for a function restores the standard one.
+ *
+ * @param malloc_fn  Function allocating a memory block, or `NULL`.
+ * @param realloc_fn Function resizing a memory block, or `NULL`.
+ * @param free_fn    Function releasing a memory block, or `NULL`.
+ *
+ * @see arg_mallocfn, arg_reallocfn, arg_freefn
+ */
+ARG_EXTERN void arg_set_allocators(arg_mallocfn* malloc_fn, arg_reallocfn* realloc_fn, arg_freefn* free_fn);
+
 /**
  * Generates and retrieves the default help message for the application.
  *
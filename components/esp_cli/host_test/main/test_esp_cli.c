@@ -7,16 +7,22 @@
 #include <string.h>
 #include <stdio.h>
 #include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
 #include <sys/time.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "unity.h"
 #include "esp_cli.h"
+#include "esp_cli_server.h"
 #include "esp_linenoise.h"
 #include "esp_cli_commands.h"
+#include "argtable3/argtable3.h"
 
 #include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
 
 inline __attribute__((always_inline))
 uint32_t get_millis(void)
@@ -330,3 +336,300 @@ TEST_CASE("create and destroy several instances of esp_cli", "[esp_cli]")
     esp_cli_teardown(&start_sem_a, &done_sem_a, socket_fd_a, &linenoise_hdl_a, &cli_hdl_a);
     esp_cli_teardown(&start_sem_b, &done_sem_b, socket_fd_b, &linenoise_hdl_b, &cli_hdl_b);
 }
+
+/* count the allocations made by the task executing the commands, the linker
+ * redirects malloc, calloc and realloc to the __wrap_ functions */
+static __thread bool s_count_allocs = false;
+static size_t s_nb_of_allocs = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    if (s_count_allocs) {
+        s_nb_of_allocs++;
+    }
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    if (s_count_allocs) {
+        s_nb_of_allocs++;
+    }
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    if (s_count_allocs) {
+        s_nb_of_allocs++;
+    }
+    return __real_realloc(ptr, size);
+}
+
+static struct {
+    struct arg_lit *verbose;
+    struct arg_int *count;
+    struct arg_str *name;
+    struct arg_end *end;
+} s_parse_args;
+
+static int test_parse_cmd(void *context, esp_cli_commands_exec_arg_t *cmd_args, int argc, char **argv)
+{
+    if (arg_parse(argc, argv, (void **)&s_parse_args) != 0) {
+        return -1;
+    }
+
+    /* scratch memory of the command */
+    char *name = esp_cli_commands_arena_alloc(cmd_args->arena, 32);
+    if (!name) {
+        return -2;
+    }
+    strncpy(name, s_parse_args.name->sval[0], 31);
+    name[31] = '\0';
+
+    return s_parse_args.count->ival[0] +
+           (s_parse_args.verbose->count ? 100 : 0) +
+           (strcmp(name, "some name") == 0 ? 1000 : 0);
+}
+
+TEST_CASE("commands executed in a scratch arena don't allocate", "[esp_cli]")
+{
+    const char *cmd_line = "parse -v --count 3 \"some name\"";
+    const int expected_cmd_ret = 1103;
+
+    /* the argument table itself is allocated from the heap, outside of a command */
+    arg_set_allocators(esp_cli_commands_arena_malloc, esp_cli_commands_arena_realloc, esp_cli_commands_arena_free);
+    s_parse_args.verbose = arg_lit0("v", "verbose", "verbose output");
+    s_parse_args.count = arg_int1("c", "count", "<n>", "count");
+    s_parse_args.name = arg_str1(NULL, NULL, "<name>", "name");
+    s_parse_args.end = arg_end(4);
+
+    esp_cli_command_t cmd = {
+        .name = "parse",
+        .group = "parse_group",
+        .help = "parse the arguments with argtable3",
+        .func = test_parse_cmd,
+        .func_ctx = NULL,
+        .hint_cb = NULL,
+        .glossary_cb = NULL
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_register_cmd(&cmd));
+
+    static uint8_t arena_buf[1024];
+    esp_cli_commands_arena_t arena;
+    esp_cli_commands_arena_init(&arena, arena_buf, sizeof(arena_buf));
+    esp_cli_commands_exec_arg_t cmd_args = {
+        .out_fd = STDOUT_FILENO,
+        .write_func = write,
+        .dynamic_ctx = NULL,
+        .arena = &arena
+    };
+
+    int cmd_ret = 0;
+    s_nb_of_allocs = 0;
+    s_count_allocs = true;
+    for (size_t i = 0; i < 10000; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_execute(cmd_line, &cmd_ret, NULL, &cmd_args));
+        TEST_ASSERT_EQUAL(expected_cmd_ret, cmd_ret);
+    }
+    s_count_allocs = false;
+    TEST_ASSERT_EQUAL(0, s_nb_of_allocs);
+    TEST_ASSERT_EQUAL(0, arena.used);
+
+    /* with the default allocators, arg_parse allocates its temporary buffers */
+    arg_set_allocators(NULL, NULL, NULL);
+    s_count_allocs = true;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_execute(cmd_line, &cmd_ret, NULL, &cmd_args));
+    s_count_allocs = false;
+    TEST_ASSERT_EQUAL(expected_cmd_ret, cmd_ret);
+    TEST_ASSERT_NOT_EQUAL(0, s_nb_of_allocs);
+
+    /* the command line doesn't fit in the arena */
+    uint8_t small_arena_buf[16];
+    esp_cli_commands_arena_t small_arena;
+    esp_cli_commands_arena_init(&small_arena, small_arena_buf, sizeof(small_arena_buf));
+    cmd_args.arena = &small_arena;
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, esp_cli_commands_execute(cmd_line, &cmd_ret, NULL, &cmd_args));
+    TEST_ASSERT_EQUAL(0, small_arena.used);
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_unregister_cmd("parse"));
+    arg_freetable((void **)&s_parse_args, sizeof(s_parse_args) / sizeof(void *));
+}
+
+#define TEST_SERVER_NB_OF_CMDS 5
+
+static size_t s_running_cmds = 0;
+static size_t s_max_running_cmds = 0;
+static char s_cmd_order[2 * TEST_SERVER_NB_OF_CMDS];
+static size_t s_cmd_order_len = 0;
+
+static int test_slow_cmd(void *context, esp_cli_commands_exec_arg_t *cmd_args, int argc, char **argv)
+{
+    s_running_cmds++;
+    if (s_running_cmds > s_max_running_cmds) {
+        s_max_running_cmds = s_running_cmds;
+    }
+
+    /* argv[1] is "<client>_<index>" */
+    if (argc > 1 && s_cmd_order_len < sizeof(s_cmd_order)) {
+        s_cmd_order[s_cmd_order_len++] = argv[1][0];
+    }
+    wait_ms(20);
+
+    char reply[32];
+    const int len = snprintf(reply, sizeof(reply), "done %s\n", argc > 1 ? argv[1] : "");
+    cmd_args->write_func(cmd_args->out_fd, reply, len);
+
+    s_running_cmds--;
+    return 0;
+}
+
+static int test_client_connect(uint16_t port)
+{
+    const int sock = socket(AF_INET, SOCK_STREAM, 0);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, sock);
+
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    TEST_ASSERT_EQUAL(0, connect(sock, (struct sockaddr *)&addr, sizeof(addr)));
+    return sock;
+}
+
+/* read what the server sent until the expected string is received */
+static bool test_client_read_until(int sock, const char *expected)
+{
+    char buf[1024];
+    size_t len = 0;
+    const uint32_t start_ms = get_millis();
+
+    while ((get_millis() - start_ms) < 3000) {
+        const int nread = recv(sock, buf + len, sizeof(buf) - 1 - len, MSG_DONTWAIT);
+        if (nread > 0) {
+            /* the terminal probe contains a null character */
+            for (int i = 0; i < nread; i++) {
+                if (buf[len + i] == '\0') {
+                    buf[len + i] = ' ';
+                }
+            }
+            len += nread;
+            buf[len] = '\0';
+            if (strstr(buf, expected)) {
+                return true;
+            }
+            if (len == sizeof(buf) - 1) {
+                /* keep the end of the output, the expected string can be split */
+                memmove(buf, buf + len / 2, len - len / 2 + 1);
+                len -= len / 2;
+            }
+        } else if (nread == 0) {
+            return false;
+        } else {
+            wait_ms(10);
+        }
+    }
+    return false;
+}
+
+static bool test_server_wait_session_count(esp_cli_server_handle_t server, size_t expected)
+{
+    for (size_t i = 0; i < 200; i++) {
+        if (esp_cli_server_get_session_count(server) == expected) {
+            return true;
+        }
+        wait_ms(10);
+    }
+    return false;
+}
+
+TEST_CASE("esp_cli server runs concurrent TCP sessions", "[esp_cli]")
+{
+    /* writing to a socket closed by the client must not kill the test */
+    signal(SIGPIPE, SIG_IGN);
+
+    esp_cli_command_t cmd = {
+        .name = "slow",
+        .group = "server_group",
+        .help = "command taking some time to execute",
+        .func = test_slow_cmd,
+        .func_ctx = NULL,
+        .hint_cb = NULL,
+        .glossary_cb = NULL
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_register_cmd(&cmd));
+    s_running_cmds = 0;
+    s_max_running_cmds = 0;
+    s_cmd_order_len = 0;
+
+    esp_cli_server_config_t config;
+    esp_cli_server_get_config_default(&config);
+    config.port = 0;
+    config.max_sessions = 2;
+    config.max_concurrent_commands = 1;
+
+    esp_cli_server_handle_t server = NULL;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_server_start(&config, &server));
+    uint16_t port = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_server_get_port(server, &port));
+    TEST_ASSERT_NOT_EQUAL(0, port);
+
+    /* the clients don't answer the terminal probe, the sessions run in dumb mode */
+    int client[2];
+    for (size_t i = 0; i < 2; i++) {
+        client[i] = test_client_connect(port);
+        TEST_ASSERT_TRUE(test_client_read_until(client[i], config.prompt));
+    }
+    TEST_ASSERT_EQUAL(2, esp_cli_server_get_session_count(server));
+
+    /* the connections above max_sessions are rejected */
+    const int rejected_client = test_client_connect(port);
+    TEST_ASSERT_TRUE(test_client_read_until(rejected_client, "too many sessions"));
+    close(rejected_client);
+
+    /* both clients send their commands at once */
+    for (size_t i = 0; i < 2; i++) {
+        char cmds[128] = { 0 };
+        size_t len = 0;
+        for (size_t k = 0; k < TEST_SERVER_NB_OF_CMDS; k++) {
+            len += snprintf(cmds + len, sizeof(cmds) - len, "slow %u_%u\n", (unsigned)i, (unsigned)k);
+        }
+        TEST_ASSERT_EQUAL(len, write(client[i], cmds, len));
+    }
+    for (size_t i = 0; i < 2; i++) {
+        char expected[16];
+        snprintf(expected, sizeof(expected), "done %u_%u", (unsigned)i, (unsigned)(TEST_SERVER_NB_OF_CMDS - 1));
+        TEST_ASSERT_TRUE(test_client_read_until(client[i], expected));
+    }
+
+    /* the commands were executed one at a time, the sessions taking turns */
+    TEST_ASSERT_EQUAL(1, s_max_running_cmds);
+    TEST_ASSERT_EQUAL(2 * TEST_SERVER_NB_OF_CMDS, s_cmd_order_len);
+    for (size_t i = 1; i < s_cmd_order_len; i++) {
+        TEST_ASSERT_NOT_EQUAL(s_cmd_order[i - 1], s_cmd_order[i]);
+    }
+
+    /* a session ends with the quit command or when the client disconnects */
+    TEST_ASSERT_EQUAL(5, write(client[0], "quit\n", 5));
+    TEST_ASSERT_TRUE(test_server_wait_session_count(server, 1));
+    close(client[0]);
+    close(client[1]);
+    TEST_ASSERT_TRUE(test_server_wait_session_count(server, 0));
+
+    /* stopping the server closes the remaining sessions */
+    client[0] = test_client_connect(port);
+    TEST_ASSERT_TRUE(test_client_read_until(client[0], config.prompt));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_server_stop(server));
+    TEST_ASSERT_FALSE(test_client_read_until(client[0], "unexpected"));
+    close(client[0]);
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_unregister_cmd("slow"));
+
+    /* let the deleted tasks be cleaned up */
+    wait_ms(100);
+}
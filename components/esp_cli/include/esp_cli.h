@@ -116,6 +116,8 @@ typedef struct esp_cli_config {
     esp_linenoise_handle_t linenoise_handle;    /**!< Handle to the esp_linenoise instance */
     esp_cli_command_set_handle_t command_set_handle;   /**!< Handle to a set of commands */
     size_t max_cmd_line_size;                   /**!< Maximum allowed command line size */
+    size_t scratch_arena_size;                  /**!< Size of the scratch arena used to execute the commands, 0 for
+                                                     ESP_CLI_COMMANDS_ARENA_MIN_SIZE(max_cmd_line_size) + CONFIG_ESP_CLI_SCRATCH_ARENA_EXTRA_SIZE */
     const char *history_save_path;              /**!< Path to file to save the history */
     esp_cli_on_enter_t on_enter;               /**!< Enter callback and context */
     esp_cli_pre_executor_t pre_executor;       /**!< Pre-executor callback and context */
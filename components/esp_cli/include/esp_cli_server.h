@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_cli_commands.h"
+
+/**
+ * @brief Default values used by esp_cli_server_get_config_default().
+ */
+#define ESP_CLI_SERVER_DEFAULT_PORT 2323
+#define ESP_CLI_SERVER_DEFAULT_MAX_SESSIONS 4
+#define ESP_CLI_SERVER_DEFAULT_MAX_CONCURRENT_COMMANDS 1
+#define ESP_CLI_SERVER_DEFAULT_MAX_CMD_LINE_SIZE 256
+#define ESP_CLI_SERVER_DEFAULT_HISTORY_MAX_LENGTH 16
+#define ESP_CLI_SERVER_DEFAULT_SEND_TIMEOUT_MS 2000
+#define ESP_CLI_SERVER_DEFAULT_TASK_STACK_SIZE 4096
+#define ESP_CLI_SERVER_DEFAULT_TASK_PRIORITY 5
+
+/**
+ * @brief Handle to a esp_cli server.
+ */
+typedef struct esp_cli_server *esp_cli_server_handle_t;
+
+/**
+ * @brief Configuration structure to start a esp_cli server.
+ *
+ * Every session accepted by the server runs its own esp_linenoise and esp_cli
+ * instances in a dedicated task. The memory used by a session is bounded by
+ * max_cmd_line_size, history_max_length and scratch_arena_size.
+ *
+ * @note Each session uses one socket and one eventfd. max_sessions must stay below
+ * CONFIG_ESP_LINENOISE_MAX_INSTANCE_NB (minus the other esp_linenoise instances
+ * of the application, e.g. the one of the USB console) and the number of sockets
+ * available in lwIP.
+ */
+typedef struct esp_cli_server_config {
+    uint16_t port;                                      /**!< TCP port to listen on, 0 to let the stack pick one
+                                                             (see esp_cli_server_get_port()) */
+    size_t max_sessions;                                /**!< Maximum number of sessions, the connections above it are
+                                                             rejected */
+    size_t max_concurrent_commands;                     /**!< Number of sessions allowed to execute a command at the
+                                                             same time, the others wait for their turn in FIFO order */
+    esp_cli_command_set_handle_t command_set_handle;    /**!< Set of commands shared by the sessions, NULL for all */
+    const char *prompt;                                 /**!< Prompt of the sessions */
+    size_t max_cmd_line_size;                           /**!< Maximum command line size of a session */
+    int history_max_length;                             /**!< Maximum number of history entries of a session */
+    size_t scratch_arena_size;                          /**!< Scratch arena of a session, see esp_cli_config_t */
+    uint32_t send_timeout_ms;                           /**!< Time after which a write to a client which doesn't
+                                                             read its socket fails, 0 to block */
+    uint32_t task_stack_size;                           /**!< Stack size of the server and session tasks */
+    uint32_t task_priority;                             /**!< Priority of the server and session tasks */
+} esp_cli_server_config_t;
+
+/**
+ * @brief Returns the default parameters for starting a esp_cli server.
+ *
+ * @param config Pointer to the configuration structure to fill.
+ */
+void esp_cli_server_get_config_default(esp_cli_server_config_t *config);
+
+/**
+ * @brief Start a esp_cli server.
+ *
+ * Creates the listening socket and the task accepting the connections.
+ * Each accepted connection gets its own session, running esp_cli() until the
+ * client closes the connection (or the "quit" command is executed, if enabled).
+ *
+ * @param config Pointer to the configuration structure.
+ * @param out_handle Pointer to store the handle of the server.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the configuration is invalid,
+ * ESP_ERR_NO_MEM if out of memory, ESP_FAIL if the socket could not be created.
+ */
+esp_err_t esp_cli_server_start(const esp_cli_server_config_t *config, esp_cli_server_handle_t *out_handle);
+
+/**
+ * @brief Stop a esp_cli server.
+ *
+ * Stops accepting connections, closes the connection of every session and waits
+ * for the sessions to return. A command being executed is run to completion.
+ *
+ * @note Must not be called from a command executed by one of the sessions.
+ *
+ * @param handle Handle of the server.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if the handle is NULL.
+ */
+esp_err_t esp_cli_server_stop(esp_cli_server_handle_t handle);
+
+/**
+ * @brief Get the TCP port the server listens on.
+ *
+ * @param handle Handle of the server.
+ * @param[out] out_port Port the server listens on.
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if an argument is NULL.
+ */
+esp_err_t esp_cli_server_get_port(esp_cli_server_handle_t handle, uint16_t *out_port);
+
+/**
+ * @brief Get the number of sessions currently open.
+ *
+ * @param handle Handle of the server.
+ *
+ * @return Number of sessions, 0 if the handle is NULL.
+ */
+size_t esp_cli_server_get_session_count(esp_cli_server_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
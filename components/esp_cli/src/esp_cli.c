@@ -27,6 +27,7 @@ typedef struct esp_cli_state {
 typedef struct esp_cli_instance {
     esp_cli_config_t config;
     esp_cli_state_t state;
+    esp_cli_commands_arena_t arena; /* scratch memory of the commands, allocated after the instance */
 } esp_cli_instance_t;
 
 #if CONFIG_ESP_CLI_HAS_QUIT_CMD
@@ -71,12 +72,16 @@ esp_err_t esp_cli_create(const esp_cli_config_t *config, esp_cli_handle_t *out_h
         return ESP_ERR_INVALID_ARG;
     }
 
-    esp_cli_instance_t *instance = malloc(sizeof(esp_cli_instance_t));
+    /* allocate the scratch arena together with the instance */
+    const size_t arena_size = config->scratch_arena_size ? config->scratch_arena_size :
+                              ESP_CLI_COMMANDS_ARENA_MIN_SIZE(config->max_cmd_line_size) + CONFIG_ESP_CLI_SCRATCH_ARENA_EXTRA_SIZE;
+    esp_cli_instance_t *instance = malloc(sizeof(esp_cli_instance_t) + arena_size);
     if (!instance) {
         return ESP_ERR_NO_MEM;
     }
 
     instance->config = *config;
+    esp_cli_commands_arena_init(&instance->arena, instance + 1, arena_size);
     instance->state.state = ESP_CLI_STATE_STOPPED;
     instance->state.mux = xSemaphoreCreateMutex();
     if (!instance->state.mux) {
@@ -227,12 +232,15 @@ void esp_cli(esp_cli_handle_t handle)
 
         /* forward the raw command line to the pre executor callback (e.g., save in history).
         * this callback is not necessary for the user to register, continue if it isn't */
+        esp_err_t pre_exec_ret = ESP_OK;
         if (config->pre_executor.func != NULL) {
-            config->pre_executor.func(config->pre_executor.ctx, cmd_line, read_ret);
+            pre_exec_ret = config->pre_executor.func(config->pre_executor.ctx, cmd_line, read_ret);
         }
 
-        /* at this point, if the command is NULL, skip the executing part */
-        if (read_ret != ESP_OK) {
+        /* at this point, if the command is NULL or the pre executor aborted
+         * the execution, skip the executing part */
+        if ((read_ret != ESP_OK) || (pre_exec_ret != ESP_OK)) {
+            memset(cmd_line, 0x00, cmd_line_size);
             continue;
         }
 
@@ -254,7 +262,10 @@ void esp_cli(esp_cli_handle_t handle)
 
         /* try to run the command */
         int cmd_func_ret;
-        esp_cli_commands_exec_arg_t cmd_args;
+        esp_cli_commands_exec_arg_t cmd_args = {
+            .dynamic_ctx = NULL,
+            .arena = &handle->arena
+        };
         esp_err_t get_ret = esp_linenoise_get_out_fd(handle->config.linenoise_handle, &(cmd_args.out_fd));
         if (get_ret != ESP_OK) {
             cmd_args.out_fd = STDOUT_FILENO;
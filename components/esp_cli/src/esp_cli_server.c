@@ -0,0 +1,479 @@
+/*
+* SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/queue.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_linenoise.h"
+#include "esp_cli.h"
+#include "esp_cli_server.h"
+
+/* period at which the server task checks if it has to stop */
+#define ESP_CLI_SERVER_POLL_PERIOD_MS 100
+
+/* number of pending connections in the listening socket */
+#define ESP_CLI_SERVER_LISTEN_BACKLOG 2
+
+#define ESP_CLI_SERVER_REJECT_MSG "esp_cli: too many sessions, try again later\r\n"
+
+typedef struct esp_cli_server esp_cli_server_t;
+
+typedef struct esp_cli_session {
+    esp_cli_server_t *server;
+    int sock;
+    esp_linenoise_handle_t linenoise_hdl;
+    esp_cli_handle_t cli_hdl;
+    SemaphoreHandle_t exec_sem;     /* given when the execution slot is handed to the session */
+    bool holds_exec_slot;           /* only accessed by the task of the session */
+    SLIST_ENTRY(esp_cli_session) next_session;
+    STAILQ_ENTRY(esp_cli_session) next_waiting;
+} esp_cli_session_t;
+
+struct esp_cli_server {
+    esp_cli_server_config_t config;
+    int listen_sock;
+    uint16_t port;
+    volatile bool stop_requested;
+    SemaphoreHandle_t done_sem;             /* given when the server task returns */
+    SemaphoreHandle_t session_exit_sem;     /* given when a session is deleted */
+    SemaphoreHandle_t mux;                  /* protects the fields below */
+    size_t session_count;
+    size_t free_exec_slots;
+    SLIST_HEAD(esp_cli_session_ll, esp_cli_session) sessions;
+    STAILQ_HEAD(esp_cli_session_fifo, esp_cli_session) waiting_sessions;
+};
+
+void esp_cli_server_get_config_default(esp_cli_server_config_t *config)
+{
+    if (!config) {
+        return;
+    }
+
+    *config = (esp_cli_server_config_t) {
+        .port = ESP_CLI_SERVER_DEFAULT_PORT,
+        .max_sessions = ESP_CLI_SERVER_DEFAULT_MAX_SESSIONS,
+        .max_concurrent_commands = ESP_CLI_SERVER_DEFAULT_MAX_CONCURRENT_COMMANDS,
+        .command_set_handle = NULL,
+        .prompt = "esp_cli> ",
+        .max_cmd_line_size = ESP_CLI_SERVER_DEFAULT_MAX_CMD_LINE_SIZE,
+        .history_max_length = ESP_CLI_SERVER_DEFAULT_HISTORY_MAX_LENGTH,
+        .scratch_arena_size = 0,
+        .send_timeout_ms = ESP_CLI_SERVER_DEFAULT_SEND_TIMEOUT_MS,
+        .task_stack_size = ESP_CLI_SERVER_DEFAULT_TASK_STACK_SIZE,
+        .task_priority = ESP_CLI_SERVER_DEFAULT_TASK_PRIORITY,
+    };
+}
+
+/**
+ * @brief wait for one of the execution slots of the server.
+ *
+ * The sessions get the slots in the order they asked for them: a session
+ * returning its slot while others are waiting hands it to the oldest waiting
+ * session, so a client sending commands back to back can't starve the others.
+ */
+static void esp_cli_session_take_exec_slot(esp_cli_session_t *session)
+{
+    esp_cli_server_t *server = session->server;
+
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    if ((server->free_exec_slots > 0) && STAILQ_EMPTY(&server->waiting_sessions)) {
+        server->free_exec_slots--;
+        xSemaphoreGive(server->mux);
+    } else {
+        STAILQ_INSERT_TAIL(&server->waiting_sessions, session, next_waiting);
+        xSemaphoreGive(server->mux);
+
+        /* the slot is handed over by esp_cli_session_give_exec_slot */
+        xSemaphoreTake(session->exec_sem, portMAX_DELAY);
+    }
+
+    session->holds_exec_slot = true;
+}
+
+static void esp_cli_session_give_exec_slot(esp_cli_session_t *session)
+{
+    esp_cli_server_t *server = session->server;
+
+    if (!session->holds_exec_slot) {
+        return;
+    }
+    session->holds_exec_slot = false;
+
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    esp_cli_session_t *next_session = STAILQ_FIRST(&server->waiting_sessions);
+    if (next_session) {
+        STAILQ_REMOVE_HEAD(&server->waiting_sessions, next_waiting);
+        xSemaphoreGive(next_session->exec_sem);
+    } else {
+        server->free_exec_slots++;
+    }
+    xSemaphoreGive(server->mux);
+}
+
+/**
+ * @brief check if the client closed the connection, without consuming data
+ */
+static bool esp_cli_session_is_closed(esp_cli_session_t *session)
+{
+    char c;
+    const int ret = recv(session->sock, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (ret == 0) {
+        /* end of stream */
+        return true;
+    }
+    return (ret < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR);
+}
+
+static esp_err_t esp_cli_session_pre_executor(void *ctx, const char *buf, esp_err_t reader_ret_val)
+{
+    esp_cli_session_t *session = (esp_cli_session_t *)ctx;
+
+    /* at the end of the stream, esp_linenoise returns either an error or
+     * an empty line. Stop the session if the connection is closed */
+    if (((reader_ret_val != ESP_OK) || (buf[0] == '\0')) && esp_cli_session_is_closed(session)) {
+        esp_cli_stop(session->cli_hdl);
+        return ESP_FAIL;
+    }
+
+    if (reader_ret_val != ESP_OK) {
+        return reader_ret_val;
+    }
+
+    esp_cli_session_take_exec_slot(session);
+    return ESP_OK;
+}
+
+static esp_err_t esp_cli_session_post_executor(void *ctx, const char *buf, esp_err_t executor_ret_val, int cmd_ret_val)
+{
+    esp_cli_session_give_exec_slot((esp_cli_session_t *)ctx);
+    return ESP_OK;
+}
+
+static void esp_cli_session_on_exit(void *ctx, esp_cli_handle_t handle)
+{
+    /* the quit command returns from esp_cli() without calling the post executor */
+    esp_cli_session_give_exec_slot((esp_cli_session_t *)ctx);
+}
+
+static esp_err_t esp_cli_session_create_instances(esp_cli_session_t *session)
+{
+    const esp_cli_server_config_t *config = &session->server->config;
+
+    esp_linenoise_config_t linenoise_config;
+    esp_linenoise_get_instance_config_default(&linenoise_config);
+    linenoise_config.prompt = config->prompt;
+    linenoise_config.max_cmd_line_length = config->max_cmd_line_size;
+    linenoise_config.history_max_length = config->history_max_length;
+    linenoise_config.in_fd = session->sock;
+    linenoise_config.out_fd = session->sock;
+    esp_err_t ret_val = esp_linenoise_create_instance(&linenoise_config, &session->linenoise_hdl);
+    if (ret_val != ESP_OK) {
+        return ret_val;
+    }
+
+    esp_cli_config_t cli_config = {
+        .linenoise_handle = session->linenoise_hdl,
+        .command_set_handle = config->command_set_handle,
+        .max_cmd_line_size = config->max_cmd_line_size,
+        .scratch_arena_size = config->scratch_arena_size,
+        .history_save_path = NULL,
+        .pre_executor = { .func = esp_cli_session_pre_executor, .ctx = session },
+        .post_executor = { .func = esp_cli_session_post_executor, .ctx = session },
+        .on_exit = { .func = esp_cli_session_on_exit, .ctx = session },
+    };
+    ret_val = esp_cli_create(&cli_config, &session->cli_hdl);
+    if (ret_val != ESP_OK) {
+        esp_linenoise_delete_instance(session->linenoise_hdl);
+        session->linenoise_hdl = NULL;
+    }
+
+    return ret_val;
+}
+
+static void esp_cli_session_delete(esp_cli_session_t *session)
+{
+    esp_cli_server_t *server = session->server;
+
+    /* remove the session from the list before closing the socket, so the
+     * server doesn't shut down a socket number reused in the meantime */
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    SLIST_REMOVE(&server->sessions, session, esp_cli_session, next_session);
+    xSemaphoreGive(server->mux);
+
+    if (session->cli_hdl) {
+        /* no-op if the session was stopped, which is the case unless esp_cli()
+         * returned early */
+        (void)esp_cli_stop(session->cli_hdl);
+        esp_cli_destroy(session->cli_hdl);
+    }
+
+    /* the eventfd of esp_linenoise is bound to the socket,
+     * delete the instance before closing the socket */
+    if (session->linenoise_hdl) {
+        esp_linenoise_delete_instance(session->linenoise_hdl);
+    }
+    close(session->sock);
+    vSemaphoreDelete(session->exec_sem);
+
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    server->session_count--;
+    xSemaphoreGive(server->session_exit_sem);
+    xSemaphoreGive(server->mux);
+
+    /* the server must not be accessed from here, it can be freed
+     * as soon as the last session is removed */
+    free(session);
+}
+
+static void esp_cli_session_task(void *args)
+{
+    esp_cli_session_t *session = (esp_cli_session_t *)args;
+
+    /* the instances are created by the session, esp_linenoise_create_instance
+     * probes the terminal of the client and would otherwise delay the
+     * other connections */
+    if (esp_cli_session_create_instances(session) == ESP_OK) {
+        esp_cli_start(session->cli_hdl);
+
+        /* returns when the client closes the connection */
+        esp_cli(session->cli_hdl);
+    }
+
+    esp_cli_session_delete(session);
+
+    vTaskDelete(NULL);
+}
+
+static void esp_cli_server_open_session(esp_cli_server_t *server, int sock)
+{
+    const esp_cli_server_config_t *config = &server->config;
+
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    const bool is_full = server->session_count >= config->max_sessions;
+    xSemaphoreGive(server->mux);
+    if (is_full) {
+        (void)send(sock, ESP_CLI_SERVER_REJECT_MSG, strlen(ESP_CLI_SERVER_REJECT_MSG), MSG_DONTWAIT);
+        close(sock);
+        return;
+    }
+
+    /* a client that doesn't read its socket must not block the command
+     * being executed (and the execution slot) forever */
+    if (config->send_timeout_ms) {
+        const struct timeval send_timeout = {
+            .tv_sec = config->send_timeout_ms / 1000,
+            .tv_usec = (config->send_timeout_ms % 1000) * 1000
+        };
+        (void)setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &send_timeout, sizeof(send_timeout));
+    }
+
+    esp_cli_session_t *session = calloc(1, sizeof(esp_cli_session_t));
+    if (!session) {
+        close(sock);
+        return;
+    }
+    session->server = server;
+    session->sock = sock;
+    session->exec_sem = xSemaphoreCreateBinary();
+    if (!session->exec_sem) {
+        free(session);
+        close(sock);
+        return;
+    }
+
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    SLIST_INSERT_HEAD(&server->sessions, session, next_session);
+    server->session_count++;
+    xSemaphoreGive(server->mux);
+
+    if (xTaskCreate(esp_cli_session_task, "esp_cli_session", config->task_stack_size,
+                    session, config->task_priority, NULL) != pdPASS) {
+        esp_cli_session_delete(session);
+    }
+}
+
+static void esp_cli_server_task(void *args)
+{
+    esp_cli_server_t *server = (esp_cli_server_t *)args;
+    const int listen_sock = server->listen_sock;
+
+    while (!server->stop_requested) {
+        fd_set read_fds;
+        FD_ZERO(&read_fds);
+        FD_SET(listen_sock, &read_fds);
+
+        struct timeval timeout = {
+            .tv_sec = 0,
+            .tv_usec = ESP_CLI_SERVER_POLL_PERIOD_MS * 1000
+        };
+        if (select(listen_sock + 1, &read_fds, NULL, NULL, &timeout) <= 0) {
+            continue;
+        }
+
+        const int sock = accept(listen_sock, NULL, NULL);
+        if (sock >= 0) {
+            esp_cli_server_open_session(server, sock);
+        }
+    }
+
+    close(listen_sock);
+
+    /* close the connections, the sessions read the end of the stream,
+     * return from esp_cli() and delete themselves */
+    xSemaphoreTake(server->mux, portMAX_DELAY);
+    esp_cli_session_t *session = NULL;
+    SLIST_FOREACH(session, &server->sessions, next_session) {
+        shutdown(session->sock, SHUT_RDWR);
+    }
+    size_t session_count = server->session_count;
+    xSemaphoreGive(server->mux);
+
+    while (session_count > 0) {
+        xSemaphoreTake(server->session_exit_sem, portMAX_DELAY);
+        xSemaphoreTake(server->mux, portMAX_DELAY);
+        session_count = server->session_count;
+        xSemaphoreGive(server->mux);
+    }
+
+    xSemaphoreGive(server->done_sem);
+
+    vTaskDelete(NULL);
+}
+
+static int esp_cli_server_create_listen_socket(uint16_t port, uint16_t *out_port)
+{
+    const int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock < 0) {
+        return -1;
+    }
+
+    const int reuse_addr = 1;
+    (void)setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse_addr, sizeof(reuse_addr));
+
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    socklen_t addr_len = sizeof(addr);
+    if ((bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) ||
+            (listen(sock, ESP_CLI_SERVER_LISTEN_BACKLOG) != 0) ||
+            (getsockname(sock, (struct sockaddr *)&addr, &addr_len) != 0)) {
+        close(sock);
+        return -1;
+    }
+
+    *out_port = ntohs(addr.sin_port);
+    return sock;
+}
+
+static void esp_cli_server_free(esp_cli_server_t *server)
+{
+    if (server->mux) {
+        vSemaphoreDelete(server->mux);
+    }
+    if (server->session_exit_sem) {
+        vSemaphoreDelete(server->session_exit_sem);
+    }
+    if (server->done_sem) {
+        vSemaphoreDelete(server->done_sem);
+    }
+    free(server);
+}
+
+esp_err_t esp_cli_server_start(const esp_cli_server_config_t *config, esp_cli_server_handle_t *out_handle)
+{
+    if (!config || !out_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if ((config->max_sessions == 0) ||
+            (config->max_concurrent_commands == 0) ||
+            (config->max_cmd_line_size == 0) ||
+            (config->prompt == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_cli_server_t *server = calloc(1, sizeof(esp_cli_server_t));
+    if (!server) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    server->config = *config;
+    server->free_exec_slots = config->max_concurrent_commands;
+    SLIST_INIT(&server->sessions);
+    STAILQ_INIT(&server->waiting_sessions);
+    server->mux = xSemaphoreCreateMutex();
+    server->session_exit_sem = xSemaphoreCreateBinary();
+    server->done_sem = xSemaphoreCreateBinary();
+    if (!server->mux || !server->session_exit_sem || !server->done_sem) {
+        esp_cli_server_free(server);
+        return ESP_ERR_NO_MEM;
+    }
+
+    server->listen_sock = esp_cli_server_create_listen_socket(config->port, &server->port);
+    if (server->listen_sock < 0) {
+        esp_cli_server_free(server);
+        return ESP_FAIL;
+    }
+
+    if (xTaskCreate(esp_cli_server_task, "esp_cli_server", config->task_stack_size,
+                    server, config->task_priority, NULL) != pdPASS) {
+        close(server->listen_sock);
+        esp_cli_server_free(server);
+        return ESP_ERR_NO_MEM;
+    }
+
+    *out_handle = server;
+    return ESP_OK;
+}
+
+esp_err_t esp_cli_server_stop(esp_cli_server_handle_t handle)
+{
+    if (!handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* the server task closes the sessions and returns */
+    handle->stop_requested = true;
+    xSemaphoreTake(handle->done_sem, portMAX_DELAY);
+
+    esp_cli_server_free(handle);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_cli_server_get_port(esp_cli_server_handle_t handle, uint16_t *out_port)
+{
+    if (!handle || !out_port) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *out_port = handle->port;
+    return ESP_OK;
+}
+
+size_t esp_cli_server_get_session_count(esp_cli_server_handle_t handle)
+{
+    if (!handle) {
+        return 0;
+    }
+
+    xSemaphoreTake(handle->mux, portMAX_DELAY);
+    const size_t session_count = handle->session_count;
+    xSemaphoreGive(handle->mux);
+
+    return session_count;
+}
@@ -63,6 +63,12 @@ esp_err_t esp_cli_commands_unregister_cmd(const char *cmd_name);
 /**
  * @brief Execute a command line
  *
+ * @note If cmd_arg provides an arena, the command line is copied and split in place in the
+ * arena, argv pointing into the copy, and the arena is given back when the command returns.
+ * The arena size is then the only limit on the command line length and number of arguments.
+ * Otherwise the command line is copied and split on the stack of the caller within the limits
+ * set by esp_cli_commands_update_config().
+ *
  * @param cmd_line Command line string to execute
  * @param cmd_ret Return value from the command function. If -1, standard output will be used.
  * @param cmd_set Set of commands allowed to execute. If NULL, all registered commands are allowed
@@ -71,7 +77,7 @@ esp_err_t esp_cli_commands_unregister_cmd(const char *cmd_name);
  * @return ESP_OK on success
  *         ESP_ERR_INVALID_ARG if the command line is empty or only whitespace
  *         ESP_ERR_NOT_FOUND if command is not found in cmd_set
- *         ESP_ERR_NO_MEM if internal memory allocation fails
+ *         ESP_ERR_NO_MEM if internal memory allocation fails or the arena is too small
  */
 esp_err_t esp_cli_commands_execute(const char *cmdline, int *cmd_ret, esp_cli_command_set_handle_t cmd_set, esp_cli_commands_exec_arg_t *cmd_args);
 
@@ -169,6 +175,78 @@ void esp_cli_commands_destroy_cmd_set(esp_cli_command_set_handle_t *cmd_set);
  */
 size_t esp_cli_commands_split_argv(char *line, char **argv, size_t argv_size);
 
+/**
+ * @brief Alignment of the blocks allocated from an arena
+ */
+#define ESP_CLI_COMMANDS_ARENA_ALIGN 8
+
+/**
+ * @brief Minimal size of an arena used to execute command lines of up to
+ * max_cmdline_length characters: the copy of the line and the argv array
+ */
+#define ESP_CLI_COMMANDS_ARENA_MIN_SIZE(max_cmdline_length) \
+    ((max_cmdline_length) + 1 + (((max_cmdline_length) + 1) / 2 + 2) * sizeof(char *) + 2 * ESP_CLI_COMMANDS_ARENA_ALIGN)
+
+/**
+ * @brief Initialize an arena on a memory buffer
+ *
+ * @param arena the arena to initialize
+ * @param buf memory of the arena, it must stay valid as long as the arena is used
+ * @param size size of buf, in bytes
+ */
+void esp_cli_commands_arena_init(esp_cli_commands_arena_t *arena, void *buf, size_t size);
+
+/**
+ * @brief Allocate a block from an arena
+ *
+ * @note The block is given back with all the other blocks allocated during the
+ * command when the command returns, or by esp_cli_commands_arena_reset()
+ *
+ * @param arena the arena to allocate from
+ * @param size size of the block, in bytes
+ * @return pointer to a block aligned on ESP_CLI_COMMANDS_ARENA_ALIGN bytes,
+ * NULL if there is not enough memory left in the arena
+ */
+void *esp_cli_commands_arena_alloc(esp_cli_commands_arena_t *arena, size_t size);
+
+/**
+ * @brief Give back all the blocks allocated from an arena
+ *
+ * @param arena the arena to reset
+ */
+void esp_cli_commands_arena_reset(esp_cli_commands_arena_t *arena);
+
+/**
+ * @brief malloc like function allocating from the arena of the command being
+ * executed by the calling task, and from the heap outside of a command or when
+ * this arena is full
+ *
+ * @note Together with esp_cli_commands_arena_realloc() and esp_cli_commands_arena_free(),
+ * this can be given to arg_set_allocators() so the temporary buffers of arg_parse() are
+ * taken from the arena. The blocks allocated from the arena must not be used after the
+ * command returns: create the argument tables when registering the commands.
+ *
+ * @param size size of the block, in bytes
+ * @return pointer to the block, NULL if the allocation failed
+ */
+void *esp_cli_commands_arena_malloc(size_t size);
+
+/**
+ * @brief realloc like function, see esp_cli_commands_arena_malloc()
+ *
+ * @param ptr block to resize, NULL to allocate a new block
+ * @param size new size of the block, in bytes
+ * @return pointer to the resized block, NULL if the allocation failed
+ */
+void *esp_cli_commands_arena_realloc(void *ptr, size_t size);
+
+/**
+ * @brief free like function, see esp_cli_commands_arena_malloc()
+ *
+ * @param ptr block to free, NULL is ignored
+ */
+void esp_cli_commands_arena_free(void *ptr);
+
 #ifdef __cplusplus
 }
 #endif
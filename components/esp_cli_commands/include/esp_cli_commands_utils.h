@@ -10,6 +10,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define _ESP_REPL_STRINGIFY(x) #x
@@ -25,6 +26,19 @@ extern "C" {
  */
 typedef ssize_t (*esp_cli_commands_write_t)(int fd, const void *buf, size_t count);
 
+/**
+ * @brief Scratch memory of a command line interpreter instance.
+ *
+ * esp_cli_commands_execute() copies and splits the command line in this memory
+ * and gives it back when the command returns, so nothing allocated from it
+ * outlives the command. See esp_cli_commands_arena_init().
+ */
+typedef struct esp_cli_commands_arena {
+    uint8_t *buf; /*!< memory of the arena */
+    size_t size; /*!< size of buf, in bytes */
+    size_t used; /*!< number of bytes of buf currently allocated */
+} esp_cli_commands_arena_t;
+
 /**
  * @brief Structure containing dynamic argument necessary for the
  * command callback to execute properly.
@@ -38,6 +52,7 @@ typedef struct esp_cli_commands_exec_arg {
     int out_fd; /*!< file descriptor that the command function has to use to print data in the environment it was called from */
     esp_cli_commands_write_t write_func; /*!< write function the command function has to use to print data in the environment it was called from */
     void *dynamic_ctx; /*!< dynamic context passed to the command function */
+    esp_cli_commands_arena_t *arena; /*!< scratch memory used to execute the command, NULL to use the stack */
 } esp_cli_commands_exec_arg_t;
 
 /**
@@ -10,6 +10,9 @@ extern "C" {
 #endif
 
 #include "esp_heap_caps.h"
+#include "esp_cli_commands_utils.h"
+
+struct esp_cli_command_set;
 
 /**
  * @brief Component specific implementation of malloc
@@ -23,6 +26,34 @@ extern "C" {
  */
 void *esp_cli_commands_malloc(const size_t malloc_size);
 
+/**
+ * @brief Find the first command of a set whose name is not
+ * lower than the given name, compared on len characters
+ *
+ * @note Pass strlen(name) + 1 as len to search for the exact name
+ * and strlen(prefix) to search for the commands starting with prefix.
+ * Implemented in esp_cli_commands.c
+ *
+ * @param cmd_set set of commands sorted by name. If NULL, the commands
+ * of the .esp_cli_commands section are searched
+ * @param name the name to search
+ * @param len number of characters to compare
+ * @return size_t index of the command, or the size of the set if
+ * all the names are lower
+ */
+size_t esp_cli_commands_lower_bound(const struct esp_cli_command_set *cmd_set, const char *name, size_t len);
+
+/**
+ * @brief Set the arena of the command executed by the calling task, used by
+ * esp_cli_commands_arena_malloc() and co.
+ *
+ * @note Implemented in esp_cli_commands_arena.c
+ *
+ * @param arena the arena of the command, NULL when no command is executed
+ * @return the previous arena of the calling task, to restore when the command returns
+ */
+esp_cli_commands_arena_t *esp_cli_commands_arena_set_current(esp_cli_commands_arena_t *arena);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,7 +11,6 @@ extern "C" {
 
 #include <stdio.h>
 #include <string.h>
-#include "sys/queue.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 #include "esp_cli_commands.h"
@@ -20,28 +19,13 @@ extern "C" {
  * @brief Structure representing a fixed set of commands.
  *
  * This is typically used for static or predefined command lists.
+ * The commands are sorted by name, see esp_cli_commands_lower_bound().
  */
 typedef struct esp_cli_command_set {
     esp_cli_command_t **cmd_ptr_set; /*!< Array of pointers to commands. */
     size_t cmd_set_size; /*!< Number of commands in the set. */
 } esp_cli_command_set_t;
 
-/**
- * @brief Internal structure for a dynamically registered command.
- *
- * Each dynamic command is stored as an `esp_cli_command_t` plus
- * linked list metadata for insertion/removal.
- */
-typedef struct esp_cli_command_internal {
-    esp_cli_command_t cmd; /*!< Command instance. */
-    SLIST_ENTRY(esp_cli_command_internal) next_item; /*!< Linked list entry metadata. */
-} esp_cli_command_internal_t;
-
-/**
- * @brief Linked list head type for dynamic command storage.
- */
-typedef SLIST_HEAD(esp_cli_command_internal_ll, esp_cli_command_internal) esp_cli_command_internal_ll_t;
-
 /**
  * @brief Iterate over a set of commands, either from a static set or dynamic list.
  *
@@ -52,21 +36,14 @@ typedef SLIST_HEAD(esp_cli_command_internal_ll, esp_cli_command_internal) esp_cl
  * @param cmd_set Pointer to a command set (`esp_cli_command_set_t`) or `NULL` for dynamic commands.
  * @param item_cmd Iterator variable of type `esp_cli_command_t *` that will point to each command.
  *
- * @note Internally, the macro uses `_node` and `_i` as hidden variables.
+ * @note Internally, the macro uses `_set` and `_i` as hidden variables.
  */
 #define FOR_EACH_DYNAMIC_COMMAND(cmd_set, item_cmd)                             \
-    __attribute__((unused)) esp_cli_command_internal_t *_node =                     \
-            ((cmd_set) == NULL ? SLIST_FIRST(esp_cli_dynamic_commands_get_list())  \
-                                : NULL);                                        \
-    __attribute__((unused)) size_t _i = 0;                                      \
-    for (;                                                                      \
-         ((cmd_set) == NULL                                                     \
-              ? ((_node != NULL) && ((item_cmd) = &_node->cmd))                 \
-              : (_i < (cmd_set)->cmd_set_size &&                                \
-                 ((item_cmd) = (cmd_set)->cmd_ptr_set[_i])));                   \
-         ((cmd_set) == NULL                                                     \
-              ? (_node = SLIST_NEXT(_node, next_item))                          \
-              : (void)++_i))
+    const esp_cli_command_set_t *_set =                                         \
+            ((cmd_set) == NULL ? esp_cli_dynamic_commands_get_set() : (cmd_set)); \
+    for (size_t _i = 0;                                                         \
+         _i < _set->cmd_set_size && ((item_cmd) = _set->cmd_ptr_set[_i]);       \
+         ++_i)
 
 /**
  * @brief Acquire the dynamic commands lock.
@@ -84,14 +61,15 @@ void esp_cli_dynamic_commands_lock(void);
 void esp_cli_dynamic_commands_unlock(void);
 
 /**
- * @brief Get the internal linked list of dynamic commands.
+ * @brief Get the dynamic commands, sorted by name.
  *
- * @return Pointer to the dynamic command linked list head.
+ * @return Pointer to the set of dynamic commands.
  *
- * @warning The returned list is internal; do not modify it directly.
+ * @warning The returned set is internal; do not modify it directly.
  *          Use provided API functions to modify dynamic commands.
+ *          Hold the lock while accessing it.
  */
-const esp_cli_command_internal_ll_t *esp_cli_dynamic_commands_get_list(void);
+const esp_cli_command_set_t *esp_cli_dynamic_commands_get_set(void);
 
 /**
  * @brief Add a new command to the dynamic command list.
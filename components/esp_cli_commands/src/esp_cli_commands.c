@@ -5,6 +5,8 @@
  */
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
@@ -40,6 +42,13 @@ static esp_cli_commands_config_t s_config = {
     .max_cmdline_length = 256
 };
 
+/* Commands of the .esp_cli_commands section sorted by name. The linker sorts the
+ * section by name (see linker.lf), in which case the section is searched directly
+ * and no pointer is allocated. s_static_index_checked is set once the section is known
+ * to be sorted or the index is allocated */
+static esp_cli_command_set_t s_static_index = { .cmd_ptr_set = NULL, .cmd_set_size = 0 };
+static volatile bool s_static_index_checked = false;
+
 /**
  * @brief go through all commands registered in the
  * memory section starting at _esp_cli_commands_start
@@ -144,6 +153,139 @@ void go_through_commands(esp_cli_command_sets_t *cmd_sets, void *cmd_walker_ctx,
     esp_cli_dynamic_commands_unlock();
 }
 
+static int compare_cmd_ptr_names(const void *a, const void *b)
+{
+    const esp_cli_command_t *cmd_a = *(const esp_cli_command_t * const *)a;
+    const esp_cli_command_t *cmd_b = *(const esp_cli_command_t * const *)b;
+    return strcmp(cmd_a->name, cmd_b->name);
+}
+
+/**
+ * @brief Check that the .esp_cli_commands section is sorted by name
+ * and sort a list of pointers to its commands if it's not
+ *
+ * @return false if the section is not sorted and the index could not be allocated,
+ * the section must then be walked linearly. The allocation is tried again on the next call.
+ */
+static bool static_index_init(void)
+{
+    if (s_static_index_checked) {
+        return true;
+    }
+
+    esp_cli_commands_lock();
+    if (!s_static_index_checked) {
+        const esp_cli_command_t *cmds = &_esp_cli_commands_start;
+        bool sorted = true;
+        for (size_t i = 1; i < ESP_CLI_COMMANDS_COUNT; i++) {
+            if (strcmp(cmds[i - 1].name, cmds[i].name) > 0) {
+                sorted = false;
+                break;
+            }
+        }
+
+        if (!sorted) {
+            esp_cli_command_t **ptrs = heap_caps_malloc(ESP_CLI_COMMANDS_COUNT * sizeof(esp_cli_command_t *), s_config.heap_caps_used);
+            if (ptrs) {
+                for (size_t i = 0; i < ESP_CLI_COMMANDS_COUNT; i++) {
+                    ptrs[i] = &_esp_cli_commands_start + i;
+                }
+                qsort(ptrs, ESP_CLI_COMMANDS_COUNT, sizeof(esp_cli_command_t *), compare_cmd_ptr_names);
+                s_static_index.cmd_ptr_set = ptrs;
+                s_static_index.cmd_set_size = ESP_CLI_COMMANDS_COUNT;
+            }
+        }
+        s_static_index_checked = sorted || s_static_index.cmd_ptr_set;
+    }
+    const bool searchable = s_static_index_checked;
+    esp_cli_commands_unlock();
+    return searchable;
+}
+
+static inline __attribute__((always_inline))
+esp_cli_command_t *static_command_get(size_t index)
+{
+    return s_static_index.cmd_ptr_set ? s_static_index.cmd_ptr_set[index] : &_esp_cli_commands_start + index;
+}
+
+size_t esp_cli_commands_lower_bound(const esp_cli_command_set_t *cmd_set, const char *name, size_t len)
+{
+    size_t low = 0;
+    size_t high = cmd_set ? cmd_set->cmd_set_size : ESP_CLI_COMMANDS_COUNT;
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        const esp_cli_command_t *cmd = cmd_set ? cmd_set->cmd_ptr_set[mid] : static_command_get(mid);
+        if (strncmp(cmd->name, name, len) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief go through the commands of a sorted set whose name starts
+ * with the len first characters of prefix
+ *
+ * @return false if the walker stopped the walk
+ */
+static bool go_through_sorted_set(const esp_cli_command_set_t *cmd_set, const char *prefix, size_t len, void *cmd_walker_ctx, walker_t cmd_walker)
+{
+    const size_t cmd_count = cmd_set ? cmd_set->cmd_set_size : ESP_CLI_COMMANDS_COUNT;
+    for (size_t i = esp_cli_commands_lower_bound(cmd_set, prefix, len); i < cmd_count; i++) {
+        esp_cli_command_t *cmd = cmd_set ? cmd_set->cmd_ptr_set[i] : static_command_get(i);
+        if (strncmp(cmd->name, prefix, len) != 0) {
+            break;
+        }
+        if (!cmd_walker(cmd_walker_ctx, cmd)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief same as go_through_commands but only go through the commands
+ * whose name starts with the len first characters of prefix, using binary search.
+ * Pass strlen(name) + 1 as len to walk the commands with the exact name.
+ */
+static void go_through_commands_with_prefix(esp_cli_command_sets_t *cmd_sets, const char *prefix, size_t len, void *cmd_walker_ctx, walker_t cmd_walker)
+{
+    const bool static_searchable = static_index_init();
+
+    /* cmd_sets is composed of 2 sets (static and dynamic), both sorted by name.
+     * - If cmd_sets is NULL, search the statically AND dynamically registered commands.
+     *   Without a sorted section or index (out of memory), the section is walked linearly.
+     * - If the static or the dynamic set of cmd_sets is empty, no command of this set is walked.
+     */
+    if (!cmd_sets && !static_searchable) {
+        esp_cli_command_set_t *section = NULL;
+        esp_cli_command_t *cmd = NULL;
+        FOR_EACH_STATIC_COMMAND(section, cmd) {
+            if (strncmp(cmd->name, prefix, len) == 0 && !cmd_walker(cmd_walker_ctx, cmd)) {
+                return;
+            }
+        }
+    } else if (!cmd_sets) {
+        if (!go_through_sorted_set(NULL, prefix, len, cmd_walker_ctx, cmd_walker)) {
+            return;
+        }
+    } else if (cmd_sets->static_set.cmd_ptr_set) {
+        if (!go_through_sorted_set(&cmd_sets->static_set, prefix, len, cmd_walker_ctx, cmd_walker)) {
+            return;
+        }
+    }
+
+    if (cmd_sets && !cmd_sets->dynamic_set.cmd_ptr_set) {
+        return;
+    }
+    esp_cli_dynamic_commands_lock();
+    go_through_sorted_set(cmd_sets ? &cmd_sets->dynamic_set : esp_cli_dynamic_commands_get_set(),
+                          prefix, len, cmd_walker_ctx, cmd_walker);
+    esp_cli_dynamic_commands_unlock();
+}
+
 typedef struct find_cmd_ctx {
     const char *name; /*!< the name to check commands against */
     esp_cli_command_t *cmd; /*!< the command matching the name */
@@ -207,10 +349,8 @@ esp_err_t esp_cli_commands_register_cmd(esp_cli_command_t *cmd)
         return ESP_ERR_INVALID_ARG;
     }
 
-    /* try to find the command in the static and dynamic lists.
-     * if the dynamic list is empty, the mutex locking will fail
-     * in esp_cli_commands_find_command and the function will return after
-     * checking the static list only. */
+    /* try to find the command in the static and dynamic sets, both
+     * sorted by name so the lookup is a binary search in each of them. */
     esp_cli_command_t *list_item_cmd = esp_cli_commands_find_command((esp_cli_command_sets_t *)NULL, cmd->name);
     esp_err_t ret_val = ESP_FAIL;
     if (!list_item_cmd) {
@@ -223,7 +363,7 @@ esp_err_t esp_cli_commands_register_cmd(esp_cli_command_t *cmd)
          * replaced with the new command */
         ret_val = ESP_FAIL;
     } else {
-        /* an item with matching name was found in the list of dynamically
+        /* an item with matching name was found in the set of dynamically
          * registered commands. Replace the command on spot with the new esp_cli_command_t. */
         ret_val = esp_cli_dynamic_commands_replace(cmd);
     }
@@ -246,25 +386,11 @@ esp_err_t esp_cli_commands_unregister_cmd(const char *cmd_name)
     }
 }
 
-esp_err_t esp_cli_commands_execute(const char *cmdline, int *cmd_ret, esp_cli_command_set_handle_t cmd_set, esp_cli_commands_exec_arg_t *cmd_args)
+/**
+ * @brief find and call the command of a command line split in argc / argv
+ */
+static esp_err_t execute_argv(size_t argc, char **argv, int *cmd_ret, esp_cli_command_set_handle_t cmd_set, esp_cli_commands_exec_arg_t *cmd_args)
 {
-    esp_cli_commands_lock();
-    const size_t copy_max_cmdline_args = s_config.max_cmdline_args;
-    const size_t opy_max_cmdline_length = s_config.max_cmdline_length;
-    esp_cli_commands_unlock();
-
-    /* the life time of those variables is not exceeding the scope of this function. Use the stack. */
-    char *argv[copy_max_cmdline_args];
-    memset(argv, 0x00, sizeof(argv));
-    char tmp_line_buf[opy_max_cmdline_length];
-    memset(tmp_line_buf, 0x00, sizeof(tmp_line_buf));
-
-    /* copy the raw command line into the temp buffer */
-    strlcpy(tmp_line_buf, cmdline, opy_max_cmdline_length);
-
-    /* parse and split the raw command line */
-    size_t argc = esp_cli_commands_split_argv(tmp_line_buf, argv, copy_max_cmdline_args);
-
     if (argc == 0) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -297,6 +423,7 @@ esp_err_t esp_cli_commands_execute(const char *cmdline, int *cmd_ret, esp_cli_co
              * default values in case the parameters provided are not set */
             help_args.out_fd = (cmd_args && cmd_args->out_fd != -1) ? cmd_args->out_fd : STDOUT_FILENO;
             help_args.write_func = (cmd_args && cmd_args->write_func) ? cmd_args->write_func : write;
+            help_args.arena = cmd_args ? cmd_args->arena : NULL;
 
             /* the help command needs the cmd_set to be able to only print the help for commands
              * in the user set of commands */
@@ -313,16 +440,76 @@ esp_err_t esp_cli_commands_execute(const char *cmdline, int *cmd_ret, esp_cli_co
     return ESP_OK;
 }
 
+/**
+ * @brief copy and split the command line in the arena and execute it. The
+ * memory allocated from the arena during the command is given back when it returns
+ */
+static esp_err_t execute_in_arena(const char *cmdline, int *cmd_ret, esp_cli_command_set_handle_t cmd_set, esp_cli_commands_exec_arg_t *cmd_args)
+{
+    esp_cli_commands_arena_t *arena = cmd_args->arena;
+
+    /* a command executing another command line uses the arena after its own blocks */
+    const size_t arena_mark = arena->used;
+
+    /* every argument but the last one is followed by at least one character (space or quote),
+     * plus one entry for the NULL terminating argv */
+    const size_t line_len = strlen(cmdline);
+    const size_t argv_size = (line_len + 1) / 2 + 2;
+    char *line = esp_cli_commands_arena_alloc(arena, line_len + 1);
+    char **argv = esp_cli_commands_arena_alloc(arena, argv_size * sizeof(char *));
+    if (!line || !argv) {
+        arena->used = arena_mark;
+        return ESP_ERR_NO_MEM;
+    }
+
+    /* split the copy of the line in place, argv points into it */
+    memcpy(line, cmdline, line_len + 1);
+    const size_t argc = esp_cli_commands_split_argv(line, argv, argv_size);
+
+    esp_cli_commands_arena_t *prev_arena = esp_cli_commands_arena_set_current(arena);
+    const esp_err_t ret_val = execute_argv(argc, argv, cmd_ret, cmd_set, cmd_args);
+    esp_cli_commands_arena_set_current(prev_arena);
+
+    arena->used = arena_mark;
+    return ret_val;
+}
+
+esp_err_t esp_cli_commands_execute(const char *cmdline, int *cmd_ret, esp_cli_command_set_handle_t cmd_set, esp_cli_commands_exec_arg_t *cmd_args)
+{
+    if (cmd_args && cmd_args->arena) {
+        return execute_in_arena(cmdline, cmd_ret, cmd_set, cmd_args);
+    }
+
+    esp_cli_commands_lock();
+    const size_t copy_max_cmdline_args = s_config.max_cmdline_args;
+    const size_t opy_max_cmdline_length = s_config.max_cmdline_length;
+    esp_cli_commands_unlock();
+
+    /* the life time of those variables is not exceeding the scope of this function. Use the stack. */
+    char *argv[copy_max_cmdline_args];
+    memset(argv, 0x00, sizeof(argv));
+    char tmp_line_buf[opy_max_cmdline_length];
+    memset(tmp_line_buf, 0x00, sizeof(tmp_line_buf));
+
+    /* copy the raw command line into the temp buffer */
+    strlcpy(tmp_line_buf, cmdline, opy_max_cmdline_length);
+
+    /* parse and split the raw command line */
+    size_t argc = esp_cli_commands_split_argv(tmp_line_buf, argv, copy_max_cmdline_args);
+
+    return execute_argv(argc, argv, cmd_ret, cmd_set, cmd_args);
+}
+
 esp_cli_command_t *esp_cli_commands_find_command(esp_cli_command_set_handle_t cmd_set, const char *name)
 {
-    /* no need to check that cmd_set is NULL, if it is, then FOR_EACH_XX_COMMAND
-     * will go through all registered commands */
+    /* no need to check that cmd_set is NULL, if it is, then all registered
+     * commands are searched */
     if (!name) {
         return NULL;
     }
 
     find_cmd_ctx_t ctx = { .cmd = NULL, .name = name };
-    go_through_commands(cmd_set, &ctx, compare_command_name);
+    go_through_commands_with_prefix(cmd_set, name, strlen(name) + 1, &ctx, compare_command_name);
 
     /* if command was found during the walk, cmd field will be populated with
      * the command matching the name given in parameter, otherwise it will still
@@ -373,8 +560,10 @@ esp_err_t update_cmd_set_with_temp_info(esp_cli_command_set_t *cmd_set, size_t c
         if (!cmd_set->cmd_ptr_set) {
             return ESP_ERR_NO_MEM;
         } else {
-            /* copy the temp set of pointer in to the final destination */
+            /* copy the temp set of pointer in to the final destination and sort
+             * it by name so it can be searched by go_through_commands_with_prefix */
             memcpy(cmd_set->cmd_ptr_set, cmd_ptrs, alloc_cmd_ptrs_size);
+            qsort(cmd_set->cmd_ptr_set, cmd_count, sizeof(esp_cli_command_t *), compare_cmd_ptr_names);
             cmd_set->cmd_set_size = cmd_count;
         }
     }
@@ -483,6 +672,12 @@ esp_cli_command_set_handle_t esp_cli_commands_concat_cmd_set(esp_cli_command_set
            cmd_set_b->dynamic_set.cmd_ptr_set,
            sizeof(esp_cli_command_t *) * cmd_set_b->dynamic_set.cmd_set_size);
 
+    /* both input sets are sorted, keep the new one sorted as well */
+    qsort(concat_cmd_sets->static_set.cmd_ptr_set, new_static_set_size,
+          sizeof(esp_cli_command_t *), compare_cmd_ptr_names);
+    qsort(concat_cmd_sets->dynamic_set.cmd_ptr_set, new_dynamic_set_size,
+          sizeof(esp_cli_command_t *), compare_cmd_ptr_names);
+
     esp_cli_commands_destroy_cmd_set(&cmd_set_a);
     esp_cli_commands_destroy_cmd_set(&cmd_set_b);
 
@@ -518,10 +713,8 @@ static bool call_completion_cb(void *caller_ctx, esp_cli_command_t *cmd)
 {
     call_completion_cb_ctx_t *ctx = (call_completion_cb_ctx_t *)caller_ctx;
 
-    /* Check if command starts with buf */
-    if (strncmp(ctx->buf, cmd->name, ctx->buf_len) == 0) {
-        ctx->completion_cb(ctx->cb_ctx, cmd->name);
-    }
+    /* only called with the commands starting with buf */
+    ctx->completion_cb(ctx->cb_ctx, cmd->name);
     return true;
 }
 
@@ -538,7 +731,7 @@ void esp_cli_commands_get_completion(esp_cli_command_set_handle_t cmd_set, const
         .cb_ctx = cb_ctx,
         .completion_cb = completion_cb
     };
-    go_through_commands(cmd_set, &ctx, call_completion_cb);
+    go_through_commands_with_prefix(cmd_set, buf, len, &ctx, call_completion_cb);
 }
 
 const char *esp_cli_commands_get_hint(esp_cli_command_set_handle_t cmd_set, const char *buf, int *color, bool *bold)
@@ -736,7 +929,11 @@ static int help_command(void *context, esp_cli_commands_exec_arg_t *cmd_args, in
         .command_name = command_name,
         .command_found = false
     };
-    go_through_commands(cmd_sets, &ctx, call_command_funcs);
+    if (command_name) {
+        go_through_commands_with_prefix(cmd_sets, command_name, strlen(command_name) + 1, &ctx, call_command_funcs);
+    } else {
+        go_through_commands(cmd_sets, &ctx, call_command_funcs);
+    }
 
     if (command_name && !ctx.command_found) {
         ESP_CLI_COMMANDS_FD_PRINT(cmd_args->out_fd, cmd_args->write_func, "help: invalid command name %s\n", command_name);
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_cli_commands.h"
+#include "esp_cli_commands_internal.h"
+
+#define ARENA_ALIGN_UP(size) \
+    (((size) + ESP_CLI_COMMANDS_ARENA_ALIGN - 1) & ~((size_t)ESP_CLI_COMMANDS_ARENA_ALIGN - 1))
+
+/* blocks allocated by esp_cli_commands_arena_malloc start with their size,
+ * needed by esp_cli_commands_arena_realloc */
+typedef struct arena_block_header {
+    size_t size;
+} __attribute__((aligned(ESP_CLI_COMMANDS_ARENA_ALIGN))) arena_block_header_t;
+
+/* arena of the command executed by the task, set by esp_cli_commands_execute */
+static __thread esp_cli_commands_arena_t *s_current_arena = NULL;
+
+esp_cli_commands_arena_t *esp_cli_commands_arena_set_current(esp_cli_commands_arena_t *arena)
+{
+    esp_cli_commands_arena_t *prev_arena = s_current_arena;
+    s_current_arena = arena;
+    return prev_arena;
+}
+
+void esp_cli_commands_arena_init(esp_cli_commands_arena_t *arena, void *buf, size_t size)
+{
+    if (!arena) {
+        return;
+    }
+
+    /* align the start of the memory so every block is aligned */
+    const uintptr_t start = ARENA_ALIGN_UP((uintptr_t)buf);
+    const size_t offset = start - (uintptr_t)buf;
+    arena->buf = (uint8_t *)start;
+    arena->size = (buf && size > offset) ? (size - offset) & ~((size_t)ESP_CLI_COMMANDS_ARENA_ALIGN - 1) : 0;
+    arena->used = 0;
+}
+
+void *esp_cli_commands_arena_alloc(esp_cli_commands_arena_t *arena, size_t size)
+{
+    if (!arena) {
+        return NULL;
+    }
+
+    const size_t aligned_size = ARENA_ALIGN_UP(size);
+    if (aligned_size < size || aligned_size > arena->size - arena->used) {
+        return NULL;
+    }
+
+    void *block = arena->buf + arena->used;
+    arena->used += aligned_size;
+    return block;
+}
+
+void esp_cli_commands_arena_reset(esp_cli_commands_arena_t *arena)
+{
+    if (arena) {
+        arena->used = 0;
+    }
+}
+
+static inline __attribute__((always_inline))
+bool arena_owns(const esp_cli_commands_arena_t *arena, const void *ptr)
+{
+    return arena && (const uint8_t *)ptr >= arena->buf && (const uint8_t *)ptr < arena->buf + arena->size;
+}
+
+static inline __attribute__((always_inline))
+bool arena_is_last_block(const esp_cli_commands_arena_t *arena, const arena_block_header_t *header)
+{
+    return (const uint8_t *)(header + 1) + ARENA_ALIGN_UP(header->size) == arena->buf + arena->used;
+}
+
+void *esp_cli_commands_arena_malloc(size_t size)
+{
+    arena_block_header_t *header = NULL;
+    if (size <= SIZE_MAX - sizeof(arena_block_header_t)) {
+        header = esp_cli_commands_arena_alloc(s_current_arena, sizeof(arena_block_header_t) + size);
+    }
+    if (!header) {
+        /* outside of a command or arena full */
+        return malloc(size);
+    }
+
+    header->size = size;
+    return header + 1;
+}
+
+void *esp_cli_commands_arena_realloc(void *ptr, size_t size)
+{
+    if (!ptr) {
+        return esp_cli_commands_arena_malloc(size);
+    }
+
+    esp_cli_commands_arena_t *arena = s_current_arena;
+    if (!arena_owns(arena, ptr)) {
+        return realloc(ptr, size);
+    }
+
+    /* the last block of the arena is resized in place if it fits */
+    arena_block_header_t *header = (arena_block_header_t *)ptr - 1;
+    if (arena_is_last_block(arena, header)) {
+        const size_t start = (uint8_t *)ptr - arena->buf;
+        const size_t aligned_size = ARENA_ALIGN_UP(size);
+        if (aligned_size >= size && aligned_size <= arena->size - start) {
+            arena->used = start + aligned_size;
+            header->size = size;
+            return ptr;
+        }
+    }
+
+    void *new_ptr = esp_cli_commands_arena_malloc(size);
+    if (new_ptr) {
+        memcpy(new_ptr, ptr, header->size < size ? header->size : size);
+    }
+    return new_ptr;
+}
+
+void esp_cli_commands_arena_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+
+    esp_cli_commands_arena_t *arena = s_current_arena;
+    if (!arena_owns(arena, ptr)) {
+        free(ptr);
+        return;
+    }
+
+    /* the last block is given back right away, the others when the command returns */
+    arena_block_header_t *header = (arena_block_header_t *)ptr - 1;
+    if (arena_is_last_block(arena, header)) {
+        arena->used = (uint8_t *)header - arena->buf;
+    }
+}
@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <ctype.h>
 #include <string.h>
 #include <stddef.h>
@@ -14,11 +15,12 @@
 #include "esp_cli_dynamic_commands.h"
 #include "esp_cli_commands.h"
 
-#define CONTAINER_OF(ptr, type, member) \
-    ((type *)((char *)(ptr) - offsetof(type, member)))
+/* initial number of command pointers allocated in the dynamic set */
+#define DYNAMIC_SET_MIN_CAPACITY 8
 
-static esp_cli_command_internal_ll_t s_dynamic_cmd_list = SLIST_HEAD_INITIALIZER(esp_cli_command_internal);
-static size_t s_number_of_registered_commands = 0;
+/* dynamic commands sorted by name, searched with esp_cli_commands_lower_bound */
+static esp_cli_command_set_t s_dynamic_set = { .cmd_ptr_set = NULL, .cmd_set_size = 0 };
+static size_t s_dynamic_set_capacity = 0;
 static SemaphoreHandle_t s_esp_cli_commands_dyn_mutex = NULL;
 static StaticSemaphore_t s_esp_cli_commands_dyn_mutex_buf;
 
@@ -42,9 +44,35 @@ void esp_cli_dynamic_commands_unlock(void)
     xSemaphoreGive(s_esp_cli_commands_dyn_mutex);
 }
 
-const esp_cli_command_internal_ll_t *esp_cli_dynamic_commands_get_list(void)
+const esp_cli_command_set_t *esp_cli_dynamic_commands_get_set(void)
 {
-    return &s_dynamic_cmd_list;
+    return &s_dynamic_set;
+}
+
+/**
+ * @brief make room for one more command pointer in the dynamic set.
+ * Called with the lock taken.
+ */
+static esp_err_t dynamic_set_reserve(void)
+{
+    if (s_dynamic_set.cmd_set_size < s_dynamic_set_capacity) {
+        return ESP_OK;
+    }
+
+    const size_t new_capacity = s_dynamic_set_capacity ? s_dynamic_set_capacity * 2 : DYNAMIC_SET_MIN_CAPACITY;
+    esp_cli_command_t **new_ptr_set = esp_cli_commands_malloc(new_capacity * sizeof(esp_cli_command_t *));
+    if (!new_ptr_set) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (s_dynamic_set.cmd_ptr_set) {
+        memcpy(new_ptr_set, s_dynamic_set.cmd_ptr_set, s_dynamic_set.cmd_set_size * sizeof(esp_cli_command_t *));
+        free(s_dynamic_set.cmd_ptr_set);
+    }
+    s_dynamic_set.cmd_ptr_set = new_ptr_set;
+    s_dynamic_set_capacity = new_capacity;
+
+    return ESP_OK;
 }
 
 esp_err_t esp_cli_dynamic_commands_add(esp_cli_command_t *cmd)
@@ -53,34 +81,29 @@ esp_err_t esp_cli_dynamic_commands_add(esp_cli_command_t *cmd)
         return ESP_ERR_INVALID_ARG;
     }
 
-    esp_cli_command_internal_t *list_item = esp_cli_commands_malloc(sizeof(esp_cli_command_internal_t));
-    if (!list_item) {
+    esp_cli_command_t *new_cmd = esp_cli_commands_malloc(sizeof(esp_cli_command_t));
+    if (!new_cmd) {
         return ESP_ERR_NO_MEM;
     }
 
-    memcpy(&list_item->cmd, cmd, sizeof(esp_cli_command_t));
-
-    esp_cli_command_internal_t *last = NULL;
-    esp_cli_command_internal_t *it =  NULL;
+    memcpy(new_cmd, cmd, sizeof(esp_cli_command_t));
 
     /* this could be called on an empty list, make sure the
      * mutex is initialized */
     esp_cli_dynamic_commands_lock();
 
-    SLIST_FOREACH(it, &s_dynamic_cmd_list, next_item) {
-        if (strcmp(it->cmd.name, list_item->cmd.name) > 0) {
-            break;
-        }
-        last = it;
-    }
-
-    if (last == NULL) {
-        SLIST_INSERT_HEAD(&s_dynamic_cmd_list, list_item, next_item);
-    } else {
-        SLIST_INSERT_AFTER(last, list_item, next_item);
+    if (dynamic_set_reserve() != ESP_OK) {
+        esp_cli_dynamic_commands_unlock();
+        free(new_cmd);
+        return ESP_ERR_NO_MEM;
     }
 
-    s_number_of_registered_commands++;
+    /* insert the command before the first one with a greater name */
+    const size_t index = esp_cli_commands_lower_bound(&s_dynamic_set, new_cmd->name, strlen(new_cmd->name) + 1);
+    memmove(&s_dynamic_set.cmd_ptr_set[index + 1], &s_dynamic_set.cmd_ptr_set[index],
+            (s_dynamic_set.cmd_set_size - index) * sizeof(esp_cli_command_t *));
+    s_dynamic_set.cmd_ptr_set[index] = new_cmd;
+    s_dynamic_set.cmd_set_size++;
 
     esp_cli_dynamic_commands_unlock();
 
@@ -91,8 +114,13 @@ esp_err_t esp_cli_dynamic_commands_replace(esp_cli_command_t *item_cmd)
 {
     esp_cli_dynamic_commands_lock();
 
-    esp_cli_command_internal_t *list_item = CONTAINER_OF(item_cmd, esp_cli_command_internal_t, cmd);
-    memcpy(&list_item->cmd, item_cmd, sizeof(esp_cli_command_t));
+    /* the name is the same, the position in the set doesn't change */
+    const size_t index = esp_cli_commands_lower_bound(&s_dynamic_set, item_cmd->name, strlen(item_cmd->name) + 1);
+    if (index == s_dynamic_set.cmd_set_size || strcmp(s_dynamic_set.cmd_ptr_set[index]->name, item_cmd->name) != 0) {
+        esp_cli_dynamic_commands_unlock();
+        return ESP_ERR_NOT_FOUND;
+    }
+    memcpy(s_dynamic_set.cmd_ptr_set[index], item_cmd, sizeof(esp_cli_command_t));
 
     esp_cli_dynamic_commands_unlock();
 
@@ -103,14 +131,26 @@ esp_err_t esp_cli_dynamic_commands_remove(esp_cli_command_t *item_cmd)
 {
     esp_cli_dynamic_commands_lock();
 
-    esp_cli_command_internal_t *list_item = CONTAINER_OF(item_cmd, esp_cli_command_internal_t, cmd);
-    SLIST_REMOVE(&s_dynamic_cmd_list, list_item, esp_cli_command_internal, next_item);
+    const size_t index = esp_cli_commands_lower_bound(&s_dynamic_set, item_cmd->name, strlen(item_cmd->name) + 1);
+    if (index == s_dynamic_set.cmd_set_size || s_dynamic_set.cmd_ptr_set[index] != item_cmd) {
+        esp_cli_dynamic_commands_unlock();
+        return ESP_ERR_NOT_FOUND;
+    }
 
-    s_number_of_registered_commands--;
+    s_dynamic_set.cmd_set_size--;
+    memmove(&s_dynamic_set.cmd_ptr_set[index], &s_dynamic_set.cmd_ptr_set[index + 1],
+            (s_dynamic_set.cmd_set_size - index) * sizeof(esp_cli_command_t *));
+
+    /* give the memory back once the last command is removed */
+    if (s_dynamic_set.cmd_set_size == 0) {
+        free(s_dynamic_set.cmd_ptr_set);
+        s_dynamic_set.cmd_ptr_set = NULL;
+        s_dynamic_set_capacity = 0;
+    }
 
     esp_cli_dynamic_commands_unlock();
 
-    free(list_item);
+    free(item_cmd);
 
     return ESP_OK;
 }
@@ -118,7 +158,7 @@ esp_err_t esp_cli_dynamic_commands_remove(esp_cli_command_t *item_cmd)
 size_t esp_cli_dynamic_commands_get_number_of_cmd(void)
 {
     esp_cli_dynamic_commands_lock();
-    size_t nb_of_registered_cmd = s_number_of_registered_commands;
+    size_t nb_of_registered_cmd = s_dynamic_set.cmd_set_size;
     esp_cli_dynamic_commands_unlock();
     return nb_of_registered_cmd;
 }
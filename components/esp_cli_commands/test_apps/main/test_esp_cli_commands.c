@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <time.h>
 #include "unity.h"
 #include "esp_heap_caps.h"
 #include "esp_cli_commands.h"
@@ -460,3 +461,66 @@ TEST_CASE("test hint and glossary callbacks", "[esp_cli_commands]")
 
     esp_cli_commands_destroy_cmd_set(&handle_set);
 }
+
+#define BENCH_NB_CMDS 500
+
+static char bench_cmd_names[BENCH_NB_CMDS][16];
+
+static int64_t bench_get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+TEST_CASE("test lookup and completion with many commands", "[esp_cli_commands]")
+{
+    test_setup();
+
+    /* register in reverse order so every command is inserted at the front of the set */
+    for (int i = BENCH_NB_CMDS - 1; i >= 0; i--) {
+        snprintf(bench_cmd_names[i], sizeof(bench_cmd_names[i]), "bench_%03d", i);
+        esp_cli_command_t cmd = {
+            .name = bench_cmd_names[i],
+            .group = "bench_group",
+            .help = "dummy help",
+            .func = dummy_cmd_func,
+            .func_ctx = NULL,
+            .hint_cb = NULL,
+            .glossary_cb = NULL
+        };
+        TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_register_cmd(&cmd));
+    }
+
+    int64_t start = bench_get_time_us();
+    for (size_t i = 0; i < BENCH_NB_CMDS; i++) {
+        esp_cli_command_t *cmd = esp_cli_commands_find_command(NULL, bench_cmd_names[i]);
+        TEST_ASSERT_NOT_NULL(cmd);
+        TEST_ASSERT_EQUAL_STRING(bench_cmd_names[i], cmd->name);
+    }
+    int64_t find_time = bench_get_time_us() - start;
+    TEST_ASSERT_NULL(esp_cli_commands_find_command(NULL, "bench_"));
+    TEST_ASSERT_NULL(esp_cli_commands_find_command(NULL, "bench_0000"));
+    TEST_ASSERT_NOT_NULL(esp_cli_commands_find_command(NULL, "cmd_a"));
+
+    completion_nb_of_calls = 0;
+    start = bench_get_time_us();
+    esp_cli_commands_get_completion(NULL, "bench_1", NULL, test_completion_cb);
+    TEST_ASSERT_EQUAL(100, completion_nb_of_calls);
+    completion_nb_of_calls = 0;
+    esp_cli_commands_get_completion(NULL, "bench_12", NULL, test_completion_cb);
+    TEST_ASSERT_EQUAL(10, completion_nb_of_calls);
+    completion_nb_of_calls = 0;
+    esp_cli_commands_get_completion(NULL, "bench_499", NULL, test_completion_cb);
+    TEST_ASSERT_EQUAL(1, completion_nb_of_calls);
+    int64_t completion_time = bench_get_time_us() - start;
+    completion_nb_of_calls = 0;
+
+    printf("%d commands: find %d us per lookup, completion of 3 prefixes %d us\n",
+           BENCH_NB_CMDS, (int)(find_time / BENCH_NB_CMDS), (int)completion_time);
+
+    for (size_t i = 0; i < BENCH_NB_CMDS; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_cli_commands_unregister_cmd(bench_cmd_names[i]));
+    }
+    TEST_ASSERT_NULL(esp_cli_commands_find_command(NULL, bench_cmd_names[0]));
+}
@@ -108,6 +108,9 @@ typedef struct esp_linenoise_config {
     const char *prompt; /*!< Prompt string displayed to the user */
     size_t max_cmd_line_length; /*!< Maximum length (in bytes) of the input command line */
     int history_max_length; /*!< Maximum number of entries to store in command history */
+    size_t history_buffer_size; /*!< Size in bytes of the buffer holding the text of the history entries, the oldest
+                                     entries are evicted when it is full. 0 for history_max_length * 32 bytes, or
+                                     max_cmd_line_length if bigger */
     int in_fd; /*!< File descriptor to read input from (e.g., STDIN_FILENO) */
     int out_fd; /*!< File descriptor to write output to (e.g., STDOUT_FILENO) */
     bool allow_multi_line; /*!< Whether to allow multi-line input (true to enable) */
@@ -118,7 +121,7 @@ typedef struct esp_linenoise_config {
     esp_linenoise_free_hints_t free_hints_cb; /*!< Callback function to free hints returned by `hints_cb` */
     esp_linenoise_read_bytes_t read_bytes_cb; /*!< Function used to read bytes from the input stream */
     esp_linenoise_write_bytes_t write_bytes_cb; /*!< Function used to write bytes to the output stream */
-    char **history; /*!< Pointer to the history buffer (used internally; typically initialized to NULL) */
+    char **history; /*!< Unused, kept for compatibility, must be NULL (the history is stored in the instance) */
 } esp_linenoise_config_t;
 
 /**
@@ -195,8 +198,13 @@ esp_err_t esp_linenoise_abort(esp_linenoise_handle_t handle);
  * @brief Adds a line to the instance's history.
  *
  * @param handle Handle to the linenoise instance.
+ * @note The history is stored in a single buffer allocated on the first call,
+ * see history_buffer_size in esp_linenoise_config_t. Adding an entry evicts
+ * the oldest entries when the history is full.
+ *
  * @param line The line to add to history.
- * @return ESP_OK on success, or error code on failure.
+ * @return ESP_OK on success, ESP_ERR_INVALID_SIZE if the line is bigger than
+ * the history buffer, or error code on failure.
  */
 esp_err_t esp_linenoise_history_add(esp_linenoise_handle_t handle, const char *line);
 
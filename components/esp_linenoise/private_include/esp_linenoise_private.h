@@ -10,6 +10,8 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
@@ -22,6 +24,9 @@ extern "C" {
 #define ESP_LINENOISE_MINIMAL_MAX_LINE 64
 #define ESP_LINENOISE_COMMAND_MAX_LEN 32
 #define ESP_LINENOISE_PASTE_KEY_DELAY 30 /* Delay, in milliseconds, between two characters being pasted from clipboard */
+#define ESP_LINENOISE_RENDER_BUFFER_SIZE 128 /* Size of the buffer collecting the output of a line refresh */
+#define ESP_LINENOISE_HISTORY_ENTRY_AVG_SIZE 32 /* Bytes per entry used to size the history buffer when not configured */
+#define ESP_LINENOISE_SEARCH_MAX_LEN 32 /* Maximum length of the reverse incremental search string */
 
 enum KEY_ACTION {
     KEY_NULL = 0,       /* NULL */
@@ -31,6 +36,7 @@ enum KEY_ACTION {
     CTRL_D = 4,         /* Ctrl-d */
     CTRL_E = 5,         /* Ctrl-e */
     CTRL_F = 6,         /* Ctrl-f */
+    CTRL_G = 7,         /* Ctrl-g */
     CTRL_H = 8,         /* Ctrl-h */
     TAB = 9,            /* Tab */
     CTRL_K = 11,        /* Ctrl+k */
@@ -38,6 +44,7 @@ enum KEY_ACTION {
     ENTER = 10,         /* Enter */
     CTRL_N = 14,        /* Ctrl-n */
     CTRL_P = 16,        /* Ctrl-p */
+    CTRL_R = 18,        /* Ctrl-r */
     CTRL_T = 20,        /* Ctrl-t */
     CTRL_U = 21,        /* Ctrl+u */
     CTRL_W = 23,        /* Ctrl+w */
@@ -55,15 +62,58 @@ typedef struct esp_linenoise_state {
     size_t len; /* Current edited line length. */
     size_t columns; /* Number of columns in terminal. */
     size_t max_rows_used; /* Maximum num of rows used so far (multiline mode) */
-    int history_index; /* The history index we are currently editing. */
-    int history_length; /* The current length of the history*/
+    size_t history_index; /* The history index we are currently editing, 0 for the new line. */
     SemaphoreHandle_t mux;
     int abort_read_fd;
 } esp_linenoise_state_t;
 
+/* What the terminal shows, used to only write the changed part of the line
+ * (single line mode). */
+typedef struct esp_linenoise_render {
+    char out_buffer[ESP_LINENOISE_RENDER_BUFFER_SIZE]; /* Output of the refresh, written in one call when it fits. */
+    size_t out_length; /* Number of bytes in out_buffer. */
+    char *line; /* Visible part of the line as last written to the terminal. */
+    size_t line_size; /* Size of the line buffer. */
+    size_t line_length; /* Number of characters visible after the prompt. */
+    size_t cursor; /* Cursor column, relative to the end of the prompt. */
+    bool valid; /* False when the terminal content is unknown (hints shown, screen cleared...) */
+} esp_linenoise_render_t;
+
+/* Entry of the history, the text is stored in the ring buffer of the history. */
+typedef struct esp_linenoise_history_entry {
+    uint32_t offset; /* Offset of the text in the ring buffer. */
+    uint32_t length; /* Length of the text, without the terminating '\n'. */
+    uint64_t ngrams; /* Set of the character pairs of the text, hashed on 64 bits. */
+} esp_linenoise_history_entry_t;
+
+/* Entry modified by the user while editing a line, until the line is returned. */
+typedef struct esp_linenoise_history_edit {
+    struct esp_linenoise_history_edit *next;
+    size_t index; /* History index of the modified entry, 0 for the new line. */
+    size_t length; /* Length of the modified text. */
+    char line[]; /* Modified text, nul terminated. */
+} esp_linenoise_history_edit_t;
+
+/* The history is stored in a single allocation: a ring of entries followed by
+ * a ring buffer holding the text of the entries, each one ending with '\n'.
+ * An entry is never split at the end of the buffer, adding one only evicts
+ * the oldest entries until it fits. */
+typedef struct esp_linenoise_history {
+    esp_linenoise_history_entry_t *entries; /* Ring of entries, NULL until the first entry is added. */
+    size_t max_entries; /* Number of slots of the ring of entries. */
+    size_t first; /* Slot of the oldest entry. */
+    size_t count; /* Number of entries. */
+    char *buffer; /* Ring buffer holding the text of the entries. */
+    size_t buffer_size; /* Size of the ring buffer. */
+    size_t tail; /* Offset where the text of the next entry is written. */
+    esp_linenoise_history_edit_t *edits; /* Entries modified during the current edit. */
+} esp_linenoise_history_t;
+
 typedef struct esp_linenoise_instance {
     esp_linenoise_config_t config;
     esp_linenoise_state_t state;
+    esp_linenoise_render_t render;
+    esp_linenoise_history_t history;
 } esp_linenoise_instance_t;
 
 /**
@@ -85,6 +135,8 @@ esp_linenoise_instance_t *esp_linenoise_create_instance_static(void)
 
     /* set the state part of the esp_linenoise_instance_t to 0 to init all values to 0 (or NULL) */
     memset(&instance->state, 0x00, sizeof(esp_linenoise_state_t));
+    memset(&instance->render, 0x00, sizeof(esp_linenoise_render_t));
+    memset(&instance->history, 0x00, sizeof(esp_linenoise_history_t));
 
     return instance;
 }
@@ -137,6 +189,109 @@ __attribute__((weak)) esp_err_t esp_linenoise_set_event_fd(esp_linenoise_instanc
  */
 __attribute__((weak)) esp_err_t esp_linenoise_remove_event_fd(esp_linenoise_instance_t *instance);
 
+/**
+ * @brief Allocates the storage of the history.
+ *
+ * @param history history to initialize
+ * @param max_entries maximum number of entries
+ * @param buffer_size size of the buffer holding the text of the entries
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if a size is 0,
+ * ESP_ERR_NO_MEM if the allocation failed
+ */
+esp_err_t esp_linenoise_history_init(esp_linenoise_history_t *history, size_t max_entries, size_t buffer_size);
+
+/**
+ * @brief Frees the storage of the history and the modified entries.
+ *
+ * @param history history to free
+ */
+void esp_linenoise_history_deinit(esp_linenoise_history_t *history);
+
+/**
+ * @brief Changes the size of the history, keeping the newest entries that fit.
+ *
+ * @param history initialized history
+ * @param max_entries new maximum number of entries
+ * @param buffer_size new size of the buffer holding the text of the entries
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if a size is 0,
+ * ESP_ERR_NO_MEM if the allocation failed (the history is left unchanged)
+ */
+esp_err_t esp_linenoise_history_resize(esp_linenoise_history_t *history, size_t max_entries, size_t buffer_size);
+
+/**
+ * @brief Adds an entry to the history, evicting the oldest entries if needed.
+ *
+ * @note The entry is not added if it is the same as the newest entry.
+ *
+ * @param history initialized history
+ * @param line text of the entry
+ * @param length length of the text
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_SIZE if the text is
+ * bigger than the buffer of the history
+ */
+esp_err_t esp_linenoise_history_push(esp_linenoise_history_t *history, const char *line, size_t length);
+
+/**
+ * @brief Returns the text of an entry of the history.
+ *
+ * @note The text is not nul terminated.
+ *
+ * @param history history
+ * @param index index of the entry, 0 for the newest entry
+ * @param[out] out_length length of the text
+ * @return const char* text of the entry, NULL if index is out of range
+ */
+const char *esp_linenoise_history_get(const esp_linenoise_history_t *history, size_t index, size_t *out_length);
+
+/**
+ * @brief Finds the newest entry containing a string, starting from a given entry.
+ *
+ * @param history history
+ * @param str string to look for
+ * @param length length of the string
+ * @param from index of the first entry to check, 0 for the newest entry
+ * @return int index of the entry found, -1 if none
+ */
+int esp_linenoise_history_find(const esp_linenoise_history_t *history, const char *str, size_t length, size_t from);
+
+/**
+ * @brief Writes the entries of the history to a file, oldest first, one per line.
+ *
+ * @param history history
+ * @param fp file to write to
+ * @return esp_err_t ESP_OK on success, ESP_FAIL if the write failed
+ */
+esp_err_t esp_linenoise_history_write(const esp_linenoise_history_t *history, FILE *fp);
+
+/**
+ * @brief Keeps the text of an entry modified by the user until
+ * esp_linenoise_history_clear_edits() is called.
+ *
+ * @param history history
+ * @param index history index of the entry, 0 for the new line
+ * @param line modified text
+ * @param length length of the modified text
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if the allocation failed
+ */
+esp_err_t esp_linenoise_history_set_edit(esp_linenoise_history_t *history, size_t index, const char *line, size_t length);
+
+/**
+ * @brief Returns the modified text of an entry.
+ *
+ * @param history history
+ * @param index history index of the entry, 0 for the new line
+ * @return const esp_linenoise_history_edit_t* modified entry, NULL if the
+ * entry was not modified
+ */
+const esp_linenoise_history_edit_t *esp_linenoise_history_get_edit(const esp_linenoise_history_t *history, size_t index);
+
+/**
+ * @brief Discards the modified entries, called when the edited line is returned.
+ *
+ * @param history history
+ */
+void esp_linenoise_history_clear_edits(esp_linenoise_history_t *history);
+
 #ifdef __cplusplus
 }
 #endif
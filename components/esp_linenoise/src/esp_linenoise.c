@@ -62,54 +62,121 @@ FILE *lndebug_fp = NULL;
 #define lndebug(fmt, ...)
 #endif
 
-/* We define a very simple "append buffer" structure, that is an heap
- * allocated string where we can append to. This is useful in order to
- * write all the escape sequences in a buffer and flush them to the standard
- * output in a single call, to avoid flickering effects. */
-typedef struct append_buffer {
-    char *b;
-    int len;
-} append_buffer_t;
+/* The output of a line refresh is collected in a fixed buffer of the instance
+ * and written in a single call when it fits, to avoid flickering effects. When
+ * the buffer is full, its content is written and the buffer is reused. */
+static void esp_linenoise_render_flush(esp_linenoise_instance_t *instance)
+{
+    esp_linenoise_render_t *render = &instance->render;
+
+    if (render->out_length > 0) {
+        if (instance->config.write_bytes_cb(instance->config.out_fd, render->out_buffer, render->out_length) == -1) {} /* Can't recover from write error. */
+        render->out_length = 0;
+    }
+}
 
-static void esp_linenoise_append_buffer_init(append_buffer_t *ab)
+static void esp_linenoise_render_append(esp_linenoise_instance_t *instance, const char *s, size_t len)
 {
-    ab->b = NULL;
-    ab->len = 0;
+    esp_linenoise_render_t *render = &instance->render;
+
+    while (len > 0) {
+        if (render->out_length == sizeof(render->out_buffer)) {
+            esp_linenoise_render_flush(instance);
+        }
+        size_t chunk = sizeof(render->out_buffer) - render->out_length;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(render->out_buffer + render->out_length, s, chunk);
+        render->out_length += chunk;
+        s += chunk;
+        len -= chunk;
+    }
 }
 
-static void esp_linenoise_append_buffer_append(append_buffer_t *ab, const char *s, int len)
+/* Append an escape sequence taking one numeric parameter, e.g. ESC [ n D */
+static void esp_linenoise_render_append_seq(esp_linenoise_instance_t *instance, int n, char cmd)
 {
-    char *new = realloc(ab->b, ab->len + len);
+    char seq[16];
+    const int len = snprintf(seq, sizeof(seq), "\x1b[%d%c", n, cmd);
+    esp_linenoise_render_append(instance, seq, len);
+}
 
-    if (new == NULL) {
-        return;
+/* The terminal content doesn't match the last refresh anymore, the next
+ * refresh rewrites the whole line. */
+static void esp_linenoise_render_invalidate(esp_linenoise_instance_t *instance)
+{
+    instance->render.valid = false;
+}
+
+/* Called when the prompt was just written: the line is empty, the cursor is
+ * right after the prompt. */
+static void esp_linenoise_render_reset(esp_linenoise_instance_t *instance)
+{
+    esp_linenoise_render_t *render = &instance->render;
+
+    render->line_length = 0;
+    render->cursor = 0;
+    render->valid = (render->line != NULL);
+}
+
+/* Keep the rendered line in sync with a character written right after
+ * the line by the caller, without refresh. */
+static void esp_linenoise_render_append_char(esp_linenoise_instance_t *instance, char c)
+{
+    esp_linenoise_render_t *render = &instance->render;
+    const esp_linenoise_state_t *state = &instance->state;
+
+    if (render->valid &&
+            render->cursor == render->line_length &&
+            render->line_length < render->line_size &&
+            state->prompt_length + render->line_length + 1 < state->columns) {
+        render->line[render->line_length++] = c;
+        render->cursor++;
+    } else {
+        esp_linenoise_render_invalidate(instance);
     }
-    memcpy(new + ab->len, s, len);
-    ab->b = new;
-    ab->len += len;
 }
 
-static void esp_linenoise_append_buffer_free(append_buffer_t *ab)
+/* Move the cursor from the column 'from' to the column 'to' of the rendered
+ * line, with the shortest sequence: backspaces or ESC [ n D to the left,
+ * rewriting the characters or ESC [ n C to the right. */
+static void esp_linenoise_render_move_cursor(esp_linenoise_instance_t *instance, size_t from, size_t to)
 {
-    free(ab->b);
+    esp_linenoise_render_t *render = &instance->render;
+
+    if (to < from) {
+        const size_t n = from - to;
+        if (n <= 4) {
+            esp_linenoise_render_append(instance, "\b\b\b\b", n);
+        } else {
+            esp_linenoise_render_append_seq(instance, (int)n, 'D');
+        }
+    } else if (to > from) {
+        const size_t n = to - from;
+        if (n <= 4) {
+            esp_linenoise_render_append(instance, render->line + from, n);
+        } else {
+            esp_linenoise_render_append_seq(instance, (int)n, 'C');
+        }
+    }
 }
 
 /* Helper of esp_linenoise_refresh_single_line() and esp_linenoise_refresh_multi_line() to show hints
- * to the right of the prompt. */
-static void esp_linenoise_refresh_show_hints(append_buffer_t *ab, esp_linenoise_instance_t *instance)
+ * to the right of the prompt. Returns true if a hint was written. */
+static bool esp_linenoise_refresh_show_hints(esp_linenoise_instance_t *instance)
 {
-
-    esp_linenoise_state_t state = instance->state;
-    esp_linenoise_config_t config = instance->config;
+    const esp_linenoise_state_t *state = &instance->state;
+    const esp_linenoise_config_t *config = &instance->config;
     char seq[64];
 
-    if (config.hints_cb && state.prompt_length + state.len < state.columns) {
+    if (config->hints_cb && state->prompt_length + state->len < state->columns) {
 
         int color = -1, bold = 0;
-        char *hint = config.hints_cb(state.buffer, &color, &bold);
+        char *hint = config->hints_cb(state->buffer, &color, &bold);
         if (hint) {
             int hintlen = strlen(hint);
-            int hintmaxlen = state.columns - (state.prompt_length + state.len);
+            int hintmaxlen = state->columns - (state->prompt_length + state->len);
 
             if (hintlen > hintmaxlen) {
                 hintlen = hintmaxlen;
@@ -121,39 +188,45 @@ static void esp_linenoise_refresh_show_hints(append_buffer_t *ab, esp_linenoise_
 
             if (color != -1 || bold != 0) {
                 snprintf(seq, 64, "\033[%d;%d;49m", bold, color);
-                esp_linenoise_append_buffer_append(ab, seq, strlen(seq));
+                esp_linenoise_render_append(instance, seq, strlen(seq));
             }
 
-            esp_linenoise_append_buffer_append(ab, hint, hintlen);
+            esp_linenoise_render_append(instance, hint, hintlen);
 
             if (color != -1 || bold != 0) {
-                esp_linenoise_append_buffer_append(ab, "\033[0m", 4);
+                esp_linenoise_render_append(instance, "\033[0m", 4);
             }
 
             /* Call the function to free the hint returned. */
-            if (config.free_hints_cb) {
-                config.free_hints_cb(hint);
+            if (config->free_hints_cb) {
+                config->free_hints_cb(hint);
             }
+            return hintlen > 0;
         }
     }
+    return false;
 }
 
 /* Single line low level line refresh.
  *
  * Rewrite the currently edited line accordingly to the buffer content,
- * cursor position, and number of columns of the terminal. */
+ * cursor position, and number of columns of the terminal.
+ *
+ * When the terminal content is known (see esp_linenoise_render_t), only the
+ * part of the visible line that changed is written: characters inserted or
+ * deleted in the middle of the line use the insert / delete character
+ * sequences, other changes are overwritten from the first changed column. */
 static void esp_linenoise_refresh_single_line(esp_linenoise_instance_t *instance)
 {
     esp_linenoise_config_t *config = &instance->config;
     esp_linenoise_state_t *state = &instance->state;
+    esp_linenoise_render_t *render = &instance->render;
 
     char seq[64];
     size_t prompt_length = state->prompt_length;
-    int fd = instance->config.out_fd;
     char *buf = state->buffer;
     size_t len = state->len;
     size_t cur_cursor_position = state->cur_cursor_position;
-    append_buffer_t ab;
 
     while ((prompt_length + cur_cursor_position) >= state->columns) {
         buf++;
@@ -164,23 +237,97 @@ static void esp_linenoise_refresh_single_line(esp_linenoise_instance_t *instance
         len--;
     }
 
-    esp_linenoise_append_buffer_init(&ab);
-    /* Cursor to left edge */
-    snprintf(seq, 64, "\r");
-    esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
-    /* Write the prompt and the current buffer content */
-    esp_linenoise_append_buffer_append(&ab, config->prompt, strlen(config->prompt));
-    esp_linenoise_append_buffer_append(&ab, buf, len);
-    /* Show hits if any. */
-    esp_linenoise_refresh_show_hints(&ab, instance);
-    /* Erase to right */
-    snprintf(seq, 64, "\x1b[0K");
-    esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
-    /* Move cursor to original position. */
-    snprintf(seq, 64, "\r\x1b[%dC", (int)(cur_cursor_position + prompt_length));
-    esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
-    if (config->write_bytes_cb(fd, ab.b, ab.len) == -1) {} /* Can't recover from write error. */
-    esp_linenoise_append_buffer_free(&ab);
+    if (!render->valid || config->hints_cb || len > render->line_size) {
+        /* Cursor to left edge */
+        snprintf(seq, 64, "\r");
+        esp_linenoise_render_append(instance, seq, strlen(seq));
+        /* Write the prompt and the current buffer content */
+        esp_linenoise_render_append(instance, config->prompt, strlen(config->prompt));
+        esp_linenoise_render_append(instance, buf, len);
+        /* Show hits if any. */
+        const bool hint_shown = esp_linenoise_refresh_show_hints(instance);
+        /* Erase to right. Not needed when the line reaches the right margin,
+         * where it would erase the last character written. */
+        if (prompt_length + len < state->columns) {
+            snprintf(seq, 64, "\x1b[0K");
+            esp_linenoise_render_append(instance, seq, strlen(seq));
+        }
+        /* Move cursor to original position. */
+        snprintf(seq, 64, "\r\x1b[%dC", (int)(cur_cursor_position + prompt_length));
+        esp_linenoise_render_append(instance, seq, strlen(seq));
+        esp_linenoise_render_flush(instance);
+
+        /* the hint is not part of the rendered line, it will be
+         * erased by the next full refresh */
+        if (render->line && len <= render->line_size && !hint_shown) {
+            memcpy(render->line, buf, len);
+            render->line_length = len;
+            render->cursor = cur_cursor_position;
+            render->valid = true;
+        } else {
+            render->valid = false;
+        }
+        return;
+    }
+
+    /* Length of the unchanged beginning and end of the visible line */
+    const size_t old_len = render->line_length;
+    const size_t min_len = (len < old_len) ? len : old_len;
+    size_t prefix = 0;
+    while (prefix < min_len && render->line[prefix] == buf[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < min_len - prefix && render->line[old_len - 1 - suffix] == buf[len - 1 - suffix]) {
+        suffix++;
+    }
+
+    size_t cursor = render->cursor;
+    if (prefix == len && prefix == old_len) {
+        /* only the cursor moved */
+    } else if (suffix > 0 && old_len - prefix - suffix == 0) {
+        /* characters inserted at 'prefix': insert blanks, write them */
+        const size_t inserted = len - old_len;
+        esp_linenoise_render_move_cursor(instance, cursor, prefix);
+        if (inserted == 1) {
+            esp_linenoise_render_append(instance, "\x1b[@", 3);
+        } else {
+            esp_linenoise_render_append_seq(instance, (int)inserted, '@');
+        }
+        esp_linenoise_render_append(instance, buf + prefix, inserted);
+        cursor = prefix + inserted;
+    } else if (suffix > 0 && len - prefix - suffix == 0) {
+        /* characters deleted at 'prefix' */
+        const size_t deleted = old_len - len;
+        esp_linenoise_render_move_cursor(instance, cursor, prefix);
+        if (deleted == 1) {
+            esp_linenoise_render_append(instance, "\x1b[P", 3);
+        } else {
+            esp_linenoise_render_append_seq(instance, (int)deleted, 'P');
+        }
+        cursor = prefix;
+    } else {
+        /* overwrite from the first changed column, erase what is left */
+        esp_linenoise_render_move_cursor(instance, cursor, prefix);
+        esp_linenoise_render_append(instance, buf + prefix, len - prefix);
+        if (len < old_len) {
+            esp_linenoise_render_append(instance, "\x1b[0K", 4);
+        }
+        cursor = len;
+    }
+
+    memcpy(render->line + prefix, buf + prefix, len - prefix);
+    render->line_length = len;
+    if (prompt_length + cursor >= state->columns) {
+        /* the cursor is at the right margin, position it from the left edge */
+        snprintf(seq, 64, "\r\x1b[%dC", (int)(cur_cursor_position + prompt_length));
+        esp_linenoise_render_append(instance, seq, strlen(seq));
+    } else {
+        esp_linenoise_render_move_cursor(instance, cursor, cur_cursor_position);
+    }
+    render->cursor = cur_cursor_position;
+
+    esp_linenoise_render_flush(instance);
 }
 
 /* Multi line low level line refresh.
@@ -200,8 +347,9 @@ static void esp_linenoise_refresh_multi_line(esp_linenoise_instance_t *instance)
     int col; /* column position, zero-based. */
     int old_rows = state->max_rows_used;
     int j;
-    int fd = instance->config.out_fd;
-    append_buffer_t ab;
+
+    /* the rendered line is only tracked in single line mode */
+    esp_linenoise_render_invalidate(instance);
 
     /* Update max_rows_used if needed. */
     if (rows > (int)state->max_rows_used) {
@@ -210,31 +358,30 @@ static void esp_linenoise_refresh_multi_line(esp_linenoise_instance_t *instance)
 
     /* First step: clear all the lines used before. To do so start by
      * going to the last row. */
-    esp_linenoise_append_buffer_init(&ab);
     if (old_rows - rpos > 0) {
         lndebug("go down %d", old_rows - rpos);
         snprintf(seq, 64, "\x1b[%dB", old_rows - rpos);
-        esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
+        esp_linenoise_render_append(instance, seq, strlen(seq));
     }
 
     /* Now for every row clear it, go up. */
     for (j = 0; j < old_rows - 1; j++) {
         lndebug("clear+up");
         snprintf(seq, 64, "\r\x1b[0K\x1b[1A");
-        esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
+        esp_linenoise_render_append(instance, seq, strlen(seq));
     }
 
     /* Clean the top line. */
     lndebug("clear");
     snprintf(seq, 64, "\r\x1b[0K");
-    esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
+    esp_linenoise_render_append(instance, seq, strlen(seq));
 
     /* Write the prompt and the current buffer content */
-    esp_linenoise_append_buffer_append(&ab, config->prompt, strlen(config->prompt));
-    esp_linenoise_append_buffer_append(&ab, state->buffer, state->len);
+    esp_linenoise_render_append(instance, config->prompt, strlen(config->prompt));
+    esp_linenoise_render_append(instance, state->buffer, state->len);
 
     /* Show hits if any. */
-    esp_linenoise_refresh_show_hints(&ab, instance);
+    esp_linenoise_refresh_show_hints(instance);
 
     /* If we are at the very end of the screen with our prompt, we need to
      * emit a newline and move the prompt to the first column. */
@@ -242,9 +389,9 @@ static void esp_linenoise_refresh_multi_line(esp_linenoise_instance_t *instance)
             state->cur_cursor_position == state->len &&
             (state->cur_cursor_position + prompt_length) % state->columns == 0) {
         lndebug("<newline>");
-        esp_linenoise_append_buffer_append(&ab, "\n", 1);
+        esp_linenoise_render_append(instance, "\n", 1);
         snprintf(seq, 64, "\r");
-        esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
+        esp_linenoise_render_append(instance, seq, strlen(seq));
         rows++;
         if (rows > (int)state->max_rows_used) {
             state->max_rows_used = rows;
@@ -259,7 +406,7 @@ static void esp_linenoise_refresh_multi_line(esp_linenoise_instance_t *instance)
     if (rows - rpos2 > 0) {
         lndebug("go-up %d", rows - rpos2);
         snprintf(seq, 64, "\x1b[%dA", rows - rpos2);
-        esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
+        esp_linenoise_render_append(instance, seq, strlen(seq));
     }
 
     /* Set column. */
@@ -270,13 +417,12 @@ static void esp_linenoise_refresh_multi_line(esp_linenoise_instance_t *instance)
     } else {
         snprintf(seq, 64, "\r");
     }
-    esp_linenoise_append_buffer_append(&ab, seq, strlen(seq));
+    esp_linenoise_render_append(instance, seq, strlen(seq));
 
     lndebug("\n");
     state->old_cursor_position = state->cur_cursor_position;
 
-    if (config->write_bytes_cb(fd, ab.b, ab.len) == -1) {} /* Can't recover from write error. */
-    esp_linenoise_append_buffer_free(&ab);
+    esp_linenoise_render_flush(instance);
 }
 
 /* Calls the two low level functions esp_linenoise_refresh_single_line() or
@@ -526,6 +672,7 @@ static int esp_linenoise_edit_insert(esp_linenoise_instance_t *instance, char c)
                 if (config->write_bytes_cb(fd, &c, 1) == -1) {
                     return -1;
                 }
+                esp_linenoise_render_append_char(instance, c);
             } else {
                 esp_linenoise_refresh_line(instance);
             }
@@ -555,6 +702,7 @@ static int esp_linenoise_insert_pasted_char(esp_linenoise_instance_t *instance,
         if (config->write_bytes_cb(fd, &c, 1) == -1) {
             return -1;
         }
+        esp_linenoise_render_append_char(instance, c);
     }
     return 0;
 }
@@ -599,37 +747,205 @@ static void esp_linenoise_edit_move_end(esp_linenoise_instance_t *instance)
     }
 }
 
+/* Returns the line shown for the history index 'index': the text modified
+ * by the user if any, the history entry otherwise. */
+static const char *esp_linenoise_history_line(const esp_linenoise_instance_t *instance, size_t index, size_t *out_length)
+{
+    const esp_linenoise_history_edit_t *edit = esp_linenoise_history_get_edit(&instance->history, index);
+    if (edit != NULL) {
+        *out_length = edit->length;
+        return edit->line;
+    }
+    if (index == 0) {
+        *out_length = 0;
+        return "";
+    }
+    return esp_linenoise_history_get(&instance->history, index - 1, out_length);
+}
+
+/* Keep the changes made to the current line, to show them again when
+ * coming back to this history index. */
+static esp_err_t esp_linenoise_history_keep_line(esp_linenoise_instance_t *instance)
+{
+    esp_linenoise_state_t *state = &instance->state;
+
+    size_t length = 0;
+    const char *line = esp_linenoise_history_line(instance, state->history_index, &length);
+    if (line != NULL && length == state->len && memcmp(line, state->buffer, length) == 0) {
+        return ESP_OK;
+    }
+    return esp_linenoise_history_set_edit(&instance->history, state->history_index, state->buffer, state->len);
+}
+
+/* Replace the edited line with the line of the history index 'index'. */
+static void esp_linenoise_history_show(esp_linenoise_instance_t *instance, size_t index)
+{
+    esp_linenoise_state_t *state = &instance->state;
+
+    size_t length = 0;
+    const char *line = esp_linenoise_history_line(instance, index, &length);
+    if (length > state->buffer_length) {
+        length = state->buffer_length;
+    }
+    memcpy(state->buffer, line, length);
+    state->buffer[length] = '\0';
+    state->len = state->cur_cursor_position = length;
+    state->history_index = index;
+    esp_linenoise_refresh_line(instance);
+}
+
 /* Substitute the currently edited line with the next or previous history
- * entry as specified by 'dir'. */
+ * entry as specified by 'dir'. With 'prefix_search', the entries not starting
+ * with the line typed before moving in the history are skipped. */
 #define esp_LINENOISE_HISTORY_NEXT 0
 #define esp_LINENOISE_HISTORY_PREV 1
-static void esp_linenoise_edit_history_next(esp_linenoise_instance_t *instance, int dir)
+static void esp_linenoise_edit_history_next(esp_linenoise_instance_t *instance, int dir, bool prefix_search)
 {
-    esp_linenoise_config_t *config = &instance->config;
     esp_linenoise_state_t *state = &instance->state;
+    const size_t history_length = instance->history.count;
+
+    if (history_length == 0) {
+        return;
+    }
+
+    /* Update the current history entry before to
+     * overwrite it with the next one. */
+    if (esp_linenoise_history_keep_line(instance) != ESP_OK) {
+        return;
+    }
+
+    size_t prefix_length = 0;
+    const char *prefix = "";
+    if (prefix_search) {
+        prefix = esp_linenoise_history_line(instance, 0, &prefix_length);
+    }
 
-    if (state->history_length - state->history_index >= 1) {
-        /* Update the current history entry before to
-         * overwrite it with the next one. */
-        char *buffer_copy = strdup(state->buffer);
-        if (!buffer_copy) {
-            return;
+    size_t index = state->history_index;
+    size_t length = 0;
+    const char *line = NULL;
+    do {
+        if (dir == esp_LINENOISE_HISTORY_PREV) {
+            if (index == history_length) {
+                return;
+            }
+            index++;
+        } else {
+            if (index == 0) {
+                return;
+            }
+            index--;
         }
-        free(config->history[state->history_index]);
-        config->history[state->history_index] = buffer_copy;
-        /* Show the new entry */
-        state->history_index += (dir == esp_LINENOISE_HISTORY_PREV) ? 1 : -1;
-        if (state->history_index < 0) {
-            state->history_index = 0;
-            return;
-        } else if (state->history_index >= state->history_length) {
-            state->history_index = state->history_length - 1;
-            return;
+        line = esp_linenoise_history_line(instance, index, &length);
+    } while (length < prefix_length || memcmp(line, prefix, prefix_length) != 0);
+
+    esp_linenoise_history_show(instance, index);
+}
+
+/* Show the reverse incremental search prompt and the entry found, on a
+ * single row. */
+static void esp_linenoise_refresh_search(esp_linenoise_instance_t *instance, const char *search, size_t search_length,
+                                         int found, bool failed)
+{
+    esp_linenoise_state_t *state = &instance->state;
+
+    char prompt[sizeof("(failed reverse-i-search)`': ") + ESP_LINENOISE_SEARCH_MAX_LEN];
+    size_t prompt_length = snprintf(prompt, sizeof(prompt), "(%sreverse-i-search)`%.*s': ",
+                                    failed ? "failed " : "", (int)search_length, search);
+
+    size_t length = 0;
+    const char *line = "";
+    if (found >= 0) {
+        line = esp_linenoise_history_get(&instance->history, found, &length);
+    }
+
+    /* Cut what doesn't fit in the row, the cursor stays on it */
+    size_t columns = state->columns > 0 ? state->columns - 1 : 0;
+    if (prompt_length > columns) {
+        prompt_length = columns;
+    }
+    columns -= prompt_length;
+    if (length > columns) {
+        length = columns;
+    }
+
+    esp_linenoise_render_append(instance, "\r", 1);
+    esp_linenoise_render_append(instance, prompt, prompt_length);
+    esp_linenoise_render_append(instance, line, length);
+    esp_linenoise_render_append(instance, "\x1b[0K", 4);
+    esp_linenoise_render_flush(instance);
+    esp_linenoise_render_invalidate(instance);
+}
+
+/* Reverse incremental search in the history (ctrl-r). The characters typed
+ * are searched in the history from the newest entry, ctrl-r moves to the next
+ * older entry containing them. ctrl-g and ctrl-c cancel the search, any other
+ * key replaces the edited line with the entry found.
+ *
+ * The function returns the key that ended the search so the caller can handle
+ * it, 0 when the search was cancelled or -1 on read error. */
+static int esp_linenoise_search_history(esp_linenoise_instance_t *instance)
+{
+    esp_linenoise_config_t *config = &instance->config;
+    const esp_linenoise_history_t *history = &instance->history;
+
+    char search[ESP_LINENOISE_SEARCH_MAX_LEN];
+    size_t search_length = 0;
+    int found = -1;
+    bool failed = false;
+
+    while (1) {
+        esp_linenoise_refresh_search(instance, search, search_length, found, failed);
+
+        char c;
+        int nread = config->read_bytes_cb(config->in_fd, &c, 1);
+        if (nread <= 0) {
+            return -1;
+        }
+
+        switch (c) {
+        case CTRL_R: /* next older entry */
+            if (search_length > 0 && found >= 0) {
+                const int older = esp_linenoise_history_find(history, search, search_length, found + 1);
+                failed = (older < 0);
+                if (!failed) {
+                    found = older;
+                }
+            }
+            break;
+        case BACKSPACE:
+        case CTRL_H:
+            if (search_length > 0) {
+                search_length--;
+            }
+            found = search_length > 0 ? esp_linenoise_history_find(history, search, search_length, 0) : -1;
+            failed = (search_length > 0 && found < 0);
+            break;
+        case CTRL_G:
+        case CTRL_C:
+            esp_linenoise_refresh_line(instance);
+            return 0;
+        default:
+            if ((unsigned char)c >= ' ') {
+                /* the entry found so far is the newest one that can
+                 * contain the longer search string */
+                if (search_length < sizeof(search)) {
+                    search[search_length++] = c;
+                    const int match = esp_linenoise_history_find(history, search, search_length, found >= 0 ? found : 0);
+                    failed = (match < 0);
+                    if (!failed) {
+                        found = match;
+                    }
+                }
+                break;
+            }
+
+            if (found >= 0 && esp_linenoise_history_keep_line(instance) == ESP_OK) {
+                esp_linenoise_history_show(instance, found + 1);
+            } else {
+                esp_linenoise_refresh_line(instance);
+            }
+            return c;
         }
-        strncpy(state->buffer, config->history[state->history_index], state->buffer_length);
-        state->buffer[state->buffer_length - 1] = '\0';
-        state->len = state->cur_cursor_position = strlen(state->buffer);
-        esp_linenoise_refresh_line(instance);
     }
 }
 
@@ -739,16 +1055,18 @@ static int esp_linenoise_edit(esp_linenoise_instance_t *instance, char *buffer,
     state->buffer[0] = '\0';
     state->buffer_length--; /* Make sure there is always space for the nulterm */
 
-    /* The latest history entry is always our current buffer, that
-     * initially is just an empty string. */
-    const esp_err_t ret_val = esp_linenoise_history_add(instance, "");
-    if (ret_val != ESP_OK) {
+    if (config->write_bytes_cb(out_fd, config->prompt, state->prompt_length) == -1) {
         return -1;
     }
 
-    if (config->write_bytes_cb(out_fd, config->prompt, state->prompt_length) == -1) {
-        return -1;
+    /* the rendered line is allocated once, for the longest line edited so far */
+    esp_linenoise_render_t *render = &instance->render;
+    if (render->line_size < buffer_length) {
+        free(render->line);
+        render->line = malloc(buffer_length);
+        render->line_size = render->line ? buffer_length : 0;
     }
+    esp_linenoise_render_reset(instance);
 
     /* If the prompt has been registered with ANSI escape sequences
      * for terminal colors then we remove them from the prompt length
@@ -799,10 +1117,21 @@ static int esp_linenoise_edit(esp_linenoise_instance_t *instance, char *buffer,
             c = c2;
         }
 
+        /* Reverse incremental search, it returns the character that
+         * ended the search to handle it next, like the completion. */
+        if (c == CTRL_R) {
+            int c2 = esp_linenoise_search_history(instance);
+            if (c2 < 0) {
+                return state->len;
+            }
+            if (c2 == 0) {
+                continue;
+            }
+            c = c2;
+        }
+
         switch (c) {
         case ENTER:    /* enter */
-            state->history_length--;
-            free(config->history[state->history_length]);
             if (config->allow_multi_line) {
                 esp_linenoise_edit_move_end(instance);
             }
@@ -827,8 +1156,6 @@ static int esp_linenoise_edit(esp_linenoise_instance_t *instance, char *buffer,
             if (state->len > 0) {
                 esp_linenoise_edit_delete(instance);
             } else {
-                state->history_length--;
-                free(config->history[state->history_length]);
                 return -1;
             }
             break;
@@ -850,10 +1177,10 @@ static int esp_linenoise_edit(esp_linenoise_instance_t *instance, char *buffer,
             esp_linenoise_edit_move_right(instance);
             break;
         case CTRL_P:    /* ctrl-p */
-            esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_PREV);
+            esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_PREV, false);
             break;
         case CTRL_N:    /* ctrl-n */
-            esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_NEXT);
+            esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_NEXT, false);
             break;
         case CTRL_U: /* Ctrl+u, delete the whole line. */
             state->buffer[0] = '\0';
@@ -905,11 +1232,11 @@ static int esp_linenoise_edit(esp_linenoise_instance_t *instance, char *buffer,
                     }
                 } else {
                     switch (seq[1]) {
-                    case 'A': /* Up */
-                        esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_PREV);
+                    case 'A': /* Up, previous entry starting with the typed line */
+                        esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_PREV, true);
                         break;
-                    case 'B': /* Down */
-                        esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_NEXT);
+                    case 'B': /* Down, next entry starting with the typed line */
+                        esp_linenoise_edit_history_next(instance, esp_LINENOISE_HISTORY_NEXT, true);
                         break;
                     case 'C': /* Right */
                         esp_linenoise_edit_move_right(instance);
@@ -967,6 +1294,9 @@ static int esp_linenoise_raw(esp_linenoise_instance_t *instance, char *buffer, s
 
     count = esp_linenoise_edit(instance, buffer, buffer_length);
     config->write_bytes_cb(config->out_fd, "\n", 1);
+
+    /* the changes made to the history entries only last while editing */
+    esp_linenoise_history_clear_edits(&instance->history);
     return count;
 }
 
@@ -985,9 +1315,11 @@ static int esp_linenoise_dumb(esp_linenoise_instance_t *instance, char *buffer,
     bool exit_loop = false;
     while (!exit_loop) {
         int nread = config->read_bytes_cb(in_fd, &c, 1);
-        if (nread < 0) {
+        if (nread <= 0) {
+            /* error or end of stream (e.g., the peer of a socket closed
+             * the connection), same as in esp_linenoise_edit() */
             exit_loop = true;
-            count = nread;
+            count = -1;
             continue;
         }
         if (c == '\n') {
@@ -1112,6 +1444,7 @@ void esp_linenoise_get_instance_config_default(esp_linenoise_config_t *config)
         .free_hints_cb = NULL,
         .write_bytes_cb = esp_linenoise_default_write_bytes,
         .read_bytes_cb = esp_linenoise_default_read_bytes,
+        .history_buffer_size = 0,
         .history = NULL,
     };
 }
@@ -1122,7 +1455,7 @@ esp_err_t esp_linenoise_create_instance(const esp_linenoise_config_t *config, es
         return ESP_ERR_INVALID_ARG;
     }
 
-    /* make sure the history is NULL since the linenoise library will allocate it */
+    /* the history is stored in the instance, this field is not used */
     if (config->history != NULL) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -1137,6 +1470,8 @@ esp_err_t esp_linenoise_create_instance(const esp_linenoise_config_t *config, es
     /* set the state part of the esp_linenoise_instance_t to 0 to
      * init all values to 0 (or NULL) */
     memset(&instance->state, 0x00, sizeof(esp_linenoise_state_t));
+    memset(&instance->render, 0x00, sizeof(esp_linenoise_render_t));
+    memset(&instance->history, 0x00, sizeof(esp_linenoise_history_t));
 
     if (instance->config.in_fd == -1) {
         instance->config.in_fd = STDIN_FILENO;
@@ -1221,6 +1556,8 @@ esp_err_t esp_linenoise_delete_instance(esp_linenoise_handle_t handle)
             return ret_val;
         }
     }
+    free(instance->render.line);
+
     // reset the memory
     memset(instance, 0x00, sizeof(esp_linenoise_instance_t));
 
@@ -1301,6 +1638,21 @@ void esp_linenoise_add_completion(void *ctx, const char *str)
     lc->cvec[lc->len++] = copy;
 }
 
+/* Size of the buffer holding the text of the history entries */
+static size_t esp_linenoise_history_buffer_size(const esp_linenoise_config_t *config, size_t max_entries)
+{
+    if (config->history_buffer_size != 0) {
+        return config->history_buffer_size;
+    }
+
+    /* make sure any line that can be edited fits in the history */
+    size_t buffer_size = max_entries * ESP_LINENOISE_HISTORY_ENTRY_AVG_SIZE;
+    if (buffer_size < config->max_cmd_line_length) {
+        buffer_size = config->max_cmd_line_length;
+    }
+    return buffer_size;
+}
+
 esp_err_t esp_linenoise_history_add(esp_linenoise_handle_t handle, const char *line)
 {
     ESP_LINENOISE_CHECK_INSTANCE(handle);
@@ -1310,43 +1662,22 @@ esp_err_t esp_linenoise_history_add(esp_linenoise_handle_t handle, const char *l
     }
 
     esp_linenoise_config_t *config = &((esp_linenoise_instance_t *)handle)->config;
-    esp_linenoise_state_t *state = &((esp_linenoise_instance_t *)handle)->state;
+    esp_linenoise_history_t *history = &((esp_linenoise_instance_t *)handle)->history;
 
     if (config->history_max_length == 0) {
         return ESP_ERR_NO_MEM;
     }
 
-    /* Initialization on first calstate. */
-    if (config->history == NULL) {
-        config->history = malloc(sizeof(char *) * config->history_max_length);
-        if (config->history == NULL) {
-            return ESP_ERR_NO_MEM;
-        }
-        memset(config->history, 0, (sizeof(char *) * config->history_max_length));
-
-        state->history_length = 0;
-    }
-
-    /* Don't add duplicated lines. */
-    if ((state->history_length == 0) ||
-            (strcmp(config->history[state->history_length - 1], line) != 0)) {
-
-        /* Add an heap allocated copy of the line in the history.
-        * If we reached the max length, remove the older line. */
-        char *line_copy = strdup(line);
-        if (!line_copy) {
-            return ESP_ERR_NO_MEM;
-        }
-        if (state->history_length == config->history_max_length) {
-            free(config->history[0]);
-            memmove(config->history, config->history + 1, sizeof(char *) * (config->history_max_length - 1));
-            state->history_length--;
+    /* Initialization on first call. */
+    if (history->entries == NULL) {
+        const esp_err_t ret_val = esp_linenoise_history_init(history, config->history_max_length,
+                                  esp_linenoise_history_buffer_size(config, config->history_max_length));
+        if (ret_val != ESP_OK) {
+            return ret_val;
         }
-        config->history[state->history_length] = line_copy;
-        state->history_length++;
     }
 
-    return ESP_OK;
+    return esp_linenoise_history_push(history, line, strlen(line));
 }
 
 esp_err_t esp_linenoise_history_save(esp_linenoise_handle_t handle, const char *filename)
@@ -1358,20 +1689,19 @@ esp_err_t esp_linenoise_history_save(esp_linenoise_handle_t handle, const char *
     }
 
     esp_linenoise_instance_t *instance = (esp_linenoise_instance_t *)handle;
-    FILE *fp;
-    int j;
 
-    fp = fopen(filename, "w");
+    FILE *fp = fopen(filename, "w");
     if (fp == NULL) {
         return ESP_FAIL;
     }
 
-    for (j = 0; j < instance->state.history_length; j++) {
-        fprintf(fp, "%s\n", instance->config.history[j]);
-    }
+    /* the entries are stored as lines in the history, written as is */
+    esp_err_t ret_val = esp_linenoise_history_write(&instance->history, fp);
 
-    fclose(fp);
-    return ESP_OK;
+    if (fclose(fp) != 0) {
+        ret_val = ESP_FAIL;
+    }
+    return ret_val;
 }
 
 esp_err_t esp_linenoise_history_load(esp_linenoise_handle_t handle, const char *filename)
@@ -1405,8 +1735,9 @@ esp_err_t esp_linenoise_history_load(esp_linenoise_handle_t handle, const char *
         if (p) {
             *p = '\0';
         }
+        /* a line which doesn't fit in the history buffer is skipped */
         const esp_err_t ret_val = esp_linenoise_history_add(handle, buf);
-        if (ret_val != ESP_OK) {
+        if (ret_val != ESP_OK && ret_val != ESP_ERR_INVALID_SIZE) {
             free(buf);
             fclose(fp);
             return ret_val;
@@ -1424,7 +1755,7 @@ esp_err_t esp_linenoise_history_set_max_len(esp_linenoise_handle_t handle, int n
     ESP_LINENOISE_CHECK_INSTANCE(handle);
 
     esp_linenoise_config_t *config = &((esp_linenoise_instance_t *)handle)->config;
-    esp_linenoise_state_t *state = &((esp_linenoise_instance_t *)handle)->state;
+    esp_linenoise_history_t *history = &((esp_linenoise_instance_t *)handle)->history;
 
     if (new_length == config->history_max_length) {
         /* the requested history size is the same as the current
@@ -1435,35 +1766,17 @@ esp_err_t esp_linenoise_history_set_max_len(esp_linenoise_handle_t handle, int n
         return ESP_ERR_INVALID_ARG;
     }
 
-    char **new_history;
-    if (config->history) {
-        int to_copy = state->history_length;
-
-        new_history = malloc(sizeof(char *) * new_length);
-        if (new_history == NULL) {
-            return ESP_ERR_NO_MEM;
-        }
-
-        /* If we can't copy everything, free the elements we'll not use. */
-        if (new_length < to_copy) {
-            int j;
-
-            for (j = 0; j < to_copy - new_length; j++) {
-                free(config->history[j]);
-            }
-            to_copy = new_length;
+    /* If we can't keep everything, the oldest entries are dropped. */
+    if (history->entries != NULL) {
+        const esp_err_t ret_val = esp_linenoise_history_resize(history, new_length,
+                                  esp_linenoise_history_buffer_size(config, new_length));
+        if (ret_val != ESP_OK) {
+            return ret_val;
         }
-        memset(new_history, 0, sizeof(char *) * new_length);
-        memcpy(new_history, config->history + (state->history_length - to_copy), sizeof(char *)*to_copy);
-        free(config->history);
-        config->history = new_history;
     }
 
     config->history_max_length = new_length;
 
-    if (state->history_length > config->history_max_length) {
-        state->history_length = config->history_max_length;
-    }
     return ESP_OK;
 }
 
@@ -1472,14 +1785,7 @@ esp_err_t esp_linenoise_history_free(esp_linenoise_handle_t handle)
     ESP_LINENOISE_CHECK_INSTANCE(handle);
     esp_linenoise_instance_t *instance = (esp_linenoise_instance_t *)handle;
 
-    if (instance->config.history) {
-        for (int j = 0; j < instance->state.history_length; j++) {
-            free(instance->config.history[j]);
-        }
-        free(instance->config.history);
-    }
-    instance->config.history = NULL;
-    instance->state.history_length = 0;
+    esp_linenoise_history_deinit(&instance->history);
 
     return ESP_OK;
 }
@@ -1493,6 +1799,7 @@ esp_err_t esp_linenoise_clear_screen(esp_linenoise_handle_t handle)
     char erase_screen_str[] = "\x1b[H\x1b[2J";
     size_t msg_size = sizeof(erase_screen_str);
     ssize_t nb_bytes = config->write_bytes_cb(config->out_fd, erase_screen_str, msg_size);
+    esp_linenoise_render_invalidate(instance);
     if (nb_bytes < 0 || nb_bytes != msg_size) {
         return ESP_FAIL;
     }
@@ -0,0 +1,292 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_linenoise.h"
+#include "esp_linenoise_private.h"
+
+/* Set of the pairs of consecutive characters of a string, each pair hashed to
+ * one of 64 bits. A string can only contain another one if it has all the
+ * pairs of the other one, which allows skipping most entries during a search
+ * without looking at their text. */
+static uint64_t esp_linenoise_history_ngrams(const char *str, size_t length)
+{
+    uint64_t ngrams = 0;
+    for (size_t i = 1; i < length; i++) {
+        const uint32_t pair = ((uint32_t)(unsigned char)str[i - 1] << 8) | (unsigned char)str[i];
+        ngrams |= (uint64_t)1 << ((pair * 0x9E3779B1u) >> 26);
+    }
+    return ngrams;
+}
+
+static inline __attribute__((always_inline))
+esp_linenoise_history_entry_t *esp_linenoise_history_entry(const esp_linenoise_history_t *history, size_t index)
+{
+    /* index 0 is the newest entry */
+    return &history->entries[(history->first + history->count - 1 - index) % history->max_entries];
+}
+
+static void esp_linenoise_history_evict_oldest(esp_linenoise_history_t *history)
+{
+    history->first = (history->first + 1) % history->max_entries;
+    history->count--;
+    if (history->count == 0) {
+        history->tail = 0;
+    }
+}
+
+/* Find where 'size' bytes can be written in the ring buffer without
+ * overwriting an entry. */
+static bool esp_linenoise_history_reserve(esp_linenoise_history_t *history, size_t size, size_t *out_offset)
+{
+    if (history->count == 0) {
+        *out_offset = 0;
+        return true;
+    }
+
+    const size_t head = history->entries[history->first].offset;
+    if (history->tail > head) {
+        /* the entries are in [head, tail), the free space is after
+         * them, then at the start of the buffer */
+        if (history->buffer_size - history->tail >= size) {
+            *out_offset = history->tail;
+            return true;
+        }
+        if (head >= size) {
+            *out_offset = 0;
+            return true;
+        }
+        return false;
+    }
+
+    /* the entries wrapped around the end of the buffer, the free
+     * space is in [tail, head) */
+    if (head - history->tail >= size) {
+        *out_offset = history->tail;
+        return true;
+    }
+    return false;
+}
+
+esp_err_t esp_linenoise_history_init(esp_linenoise_history_t *history, size_t max_entries, size_t buffer_size)
+{
+    if (max_entries == 0 || buffer_size == 0 || buffer_size > UINT32_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    /* one allocation for the entries and their text */
+    const size_t entries_size = max_entries * sizeof(esp_linenoise_history_entry_t);
+    esp_linenoise_history_entry_t *entries = malloc(entries_size + buffer_size);
+    if (entries == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    history->entries = entries;
+    history->max_entries = max_entries;
+    history->first = 0;
+    history->count = 0;
+    history->buffer = (char *)entries + entries_size;
+    history->buffer_size = buffer_size;
+    history->tail = 0;
+
+    return ESP_OK;
+}
+
+void esp_linenoise_history_deinit(esp_linenoise_history_t *history)
+{
+    esp_linenoise_history_clear_edits(history);
+    free(history->entries);
+    memset(history, 0x00, sizeof(esp_linenoise_history_t));
+}
+
+esp_err_t esp_linenoise_history_resize(esp_linenoise_history_t *history, size_t max_entries, size_t buffer_size)
+{
+    esp_linenoise_history_t resized = { 0 };
+    esp_err_t ret_val = esp_linenoise_history_init(&resized, max_entries, buffer_size);
+    if (ret_val != ESP_OK) {
+        return ret_val;
+    }
+
+    /* keep the newest entries, up to the first one too big for the new buffer */
+    size_t kept = 0;
+    while (kept < history->count && kept < max_entries) {
+        size_t length = 0;
+        (void)esp_linenoise_history_get(history, kept, &length);
+        if (length + 1 > buffer_size) {
+            break;
+        }
+        kept++;
+    }
+
+    /* add them from the oldest, the oldest ones are evicted
+     * if they don't all fit */
+    for (size_t i = kept; i > 0; i--) {
+        size_t length = 0;
+        const char *line = esp_linenoise_history_get(history, i - 1, &length);
+        (void)esp_linenoise_history_push(&resized, line, length);
+    }
+
+    resized.edits = history->edits;
+    free(history->entries);
+    *history = resized;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_linenoise_history_push(esp_linenoise_history_t *history, const char *line, size_t length)
+{
+    const size_t size = length + 1; /* the text ends with '\n' */
+    if (size > history->buffer_size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    /* Don't add duplicated lines. */
+    if (history->count > 0) {
+        const esp_linenoise_history_entry_t *newest = esp_linenoise_history_entry(history, 0);
+        if (newest->length == length && memcmp(history->buffer + newest->offset, line, length) == 0) {
+            return ESP_OK;
+        }
+    }
+
+    if (history->count == history->max_entries) {
+        esp_linenoise_history_evict_oldest(history);
+    }
+    size_t offset = 0;
+    while (!esp_linenoise_history_reserve(history, size, &offset)) {
+        esp_linenoise_history_evict_oldest(history);
+    }
+
+    char *text = history->buffer + offset;
+    memcpy(text, line, length);
+    text[length] = '\n';
+    history->tail = offset + size;
+
+    history->count++;
+    esp_linenoise_history_entry_t *entry = esp_linenoise_history_entry(history, 0);
+    entry->offset = offset;
+    entry->length = length;
+    entry->ngrams = esp_linenoise_history_ngrams(line, length);
+
+    return ESP_OK;
+}
+
+const char *esp_linenoise_history_get(const esp_linenoise_history_t *history, size_t index, size_t *out_length)
+{
+    if (index >= history->count) {
+        return NULL;
+    }
+
+    const esp_linenoise_history_entry_t *entry = esp_linenoise_history_entry(history, index);
+    *out_length = entry->length;
+    return history->buffer + entry->offset;
+}
+
+int esp_linenoise_history_find(const esp_linenoise_history_t *history, const char *str, size_t length, size_t from)
+{
+    if (length == 0) {
+        return from < history->count ? (int)from : -1;
+    }
+
+    const uint64_t ngrams = esp_linenoise_history_ngrams(str, length);
+
+    for (size_t index = from; index < history->count; index++) {
+        const esp_linenoise_history_entry_t *entry = esp_linenoise_history_entry(history, index);
+        if (entry->length < length || (entry->ngrams & ngrams) != ngrams) {
+            continue;
+        }
+
+        const char *text = history->buffer + entry->offset;
+        const char *end = text + entry->length - length;
+        for (const char *p = text; p <= end; p++) {
+            p = memchr(p, str[0], end - p + 1);
+            if (p == NULL) {
+                break;
+            }
+            if (memcmp(p, str, length) == 0) {
+                return (int)index;
+            }
+        }
+    }
+
+    return -1;
+}
+
+esp_err_t esp_linenoise_history_write(const esp_linenoise_history_t *history, FILE *fp)
+{
+    /* the entries are contiguous in the buffer, except where they wrap
+     * around its end: the whole history is written in one or two calls */
+    size_t run_start = 0;
+    size_t run_end = 0;
+    for (size_t i = history->count; i > 0; i--) {
+        const esp_linenoise_history_entry_t *entry = esp_linenoise_history_entry(history, i - 1);
+        if (entry->offset != run_end) {
+            if (fwrite(history->buffer + run_start, 1, run_end - run_start, fp) != run_end - run_start) {
+                return ESP_FAIL;
+            }
+            run_start = entry->offset;
+        }
+        run_end = entry->offset + entry->length + 1;
+    }
+
+    if (fwrite(history->buffer + run_start, 1, run_end - run_start, fp) != run_end - run_start) {
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t esp_linenoise_history_set_edit(esp_linenoise_history_t *history, size_t index, const char *line, size_t length)
+{
+    esp_linenoise_history_edit_t *edit = malloc(sizeof(esp_linenoise_history_edit_t) + length + 1);
+    if (edit == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    edit->index = index;
+    edit->length = length;
+    memcpy(edit->line, line, length);
+    edit->line[length] = '\0';
+
+    /* replace the previous modification of the entry */
+    esp_linenoise_history_edit_t **prev = &history->edits;
+    while (*prev != NULL) {
+        if ((*prev)->index == index) {
+            esp_linenoise_history_edit_t *old = *prev;
+            *prev = old->next;
+            free(old);
+            break;
+        }
+        prev = &(*prev)->next;
+    }
+
+    edit->next = history->edits;
+    history->edits = edit;
+
+    return ESP_OK;
+}
+
+const esp_linenoise_history_edit_t *esp_linenoise_history_get_edit(const esp_linenoise_history_t *history, size_t index)
+{
+    for (const esp_linenoise_history_edit_t *edit = history->edits; edit != NULL; edit = edit->next) {
+        if (edit->index == index) {
+            return edit;
+        }
+    }
+    return NULL;
+}
+
+void esp_linenoise_history_clear_edits(esp_linenoise_history_t *history)
+{
+    while (history->edits != NULL) {
+        esp_linenoise_history_edit_t *edit = history->edits;
+        history->edits = edit->next;
+        free(edit);
+    }
+}
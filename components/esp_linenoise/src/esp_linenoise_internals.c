@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <assert.h>
 #include <fcntl.h>
 #include <sys/param.h>
 #include "sys/queue.h"
@@ -27,17 +28,48 @@ typedef struct eventfd_pair {
 static const uint64_t s_abort_signal = 1;
 static SLIST_HEAD(eventfd_pair_ll, eventfd_pair) s_eventfd_pairs = SLIST_HEAD_INITIALIZER(eventfd_pair);
 
+/* instances can be created, used and deleted from different tasks
+ * (e.g., one instance per network session), protect the list of pairs */
+static SemaphoreHandle_t s_eventfd_pairs_mux = NULL;
+static StaticSemaphore_t s_eventfd_pairs_mux_buf;
+
+static void esp_linenoise_eventfd_pairs_lock(void)
+{
+    if (s_eventfd_pairs_mux == NULL) {
+        /* the first instances may be created from several tasks at once */
+        static portMUX_TYPE s_eventfd_pairs_mux_init_lock = portMUX_INITIALIZER_UNLOCKED;
+        portENTER_CRITICAL(&s_eventfd_pairs_mux_init_lock);
+        if (s_eventfd_pairs_mux == NULL) {
+            s_eventfd_pairs_mux = xSemaphoreCreateMutexStatic(&s_eventfd_pairs_mux_buf);
+            assert(s_eventfd_pairs_mux != NULL);
+        }
+        portEXIT_CRITICAL(&s_eventfd_pairs_mux_init_lock);
+    }
+
+    xSemaphoreTake(s_eventfd_pairs_mux, portMAX_DELAY);
+}
+
+static void esp_linenoise_eventfd_pairs_unlock(void)
+{
+    xSemaphoreGive(s_eventfd_pairs_mux);
+}
+
 static int esp_linenoise_get_eventfd_from_fd(const int fd)
 {
+    int eventfd = -1;
+
     /* find the eventfd to use to abort for the given fd */
+    esp_linenoise_eventfd_pairs_lock();
     eventfd_pair_t *eventfd_pair = NULL;
     SLIST_FOREACH(eventfd_pair, &s_eventfd_pairs, next_pair) {
         if (eventfd_pair->in_fd == fd) {
-            return eventfd_pair->eventfd;
+            eventfd = eventfd_pair->eventfd;
+            break;
         }
     }
+    esp_linenoise_eventfd_pairs_unlock();
 
-    return -1;
+    return eventfd;
 }
 
 ssize_t esp_linenoise_default_read_bytes(int fd, void *buf, size_t count)
@@ -95,24 +127,28 @@ esp_err_t esp_linenoise_set_event_fd(esp_linenoise_instance_t *instance)
     esp_vfs_eventfd_config_t eventfd_config = {
         .max_fds = CONFIG_ESP_LINENOISE_MAX_INSTANCE_NB
     };
+    esp_linenoise_eventfd_pairs_lock();
     esp_err_t ret = esp_vfs_eventfd_register(&eventfd_config);
     int new_eventfd = -1;
     if (ret != ESP_ERR_INVALID_ARG) {
         new_eventfd = eventfd(0, 0);
     } else {
         /* issue with arg, this should not happen */
+        esp_linenoise_eventfd_pairs_unlock();
         return ESP_FAIL;
     }
 
     /* make sure the FD returned is not -1, which would indicate that eventfd
      * has reached the maximum number of FDs it can create */
     if (new_eventfd == -1) {
+        esp_linenoise_eventfd_pairs_unlock();
         return ESP_FAIL;
     }
 
     state->mux = xSemaphoreCreateMutex();
     if (state->mux == NULL) {
         close(new_eventfd);
+        esp_linenoise_eventfd_pairs_unlock();
         return ESP_ERR_NO_MEM;
     }
 
@@ -123,11 +159,13 @@ esp_err_t esp_linenoise_set_event_fd(esp_linenoise_instance_t *instance)
     if (new_pair == NULL) {
         close(new_eventfd);
         vSemaphoreDelete(state->mux);
+        esp_linenoise_eventfd_pairs_unlock();
         return ESP_ERR_NO_MEM;
     }
     new_pair->eventfd = new_eventfd;
     new_pair->in_fd = config->in_fd;
     SLIST_INSERT_HEAD(&s_eventfd_pairs, new_pair, next_pair);
+    esp_linenoise_eventfd_pairs_unlock();
 
     xSemaphoreGive(state->mux);
     return ESP_OK;
@@ -142,6 +180,7 @@ esp_err_t esp_linenoise_remove_event_fd(esp_linenoise_instance_t *instance)
      * if found, remove the item from the list, close the eventfd */
     eventfd_pair_t *cur = NULL;
     eventfd_pair_t *prev = NULL;
+    esp_linenoise_eventfd_pairs_lock();
     SLIST_FOREACH(cur, &s_eventfd_pairs, next_pair) {
         if (cur->in_fd == config->in_fd) {
             /* close the eventfd */
@@ -163,6 +202,7 @@ esp_err_t esp_linenoise_remove_event_fd(esp_linenoise_instance_t *instance)
     }
 
     if (cur == NULL) {
+        esp_linenoise_eventfd_pairs_unlock();
         return ESP_ERR_NOT_FOUND;
     }
 
@@ -175,11 +215,13 @@ esp_err_t esp_linenoise_remove_event_fd(esp_linenoise_instance_t *instance)
     /* if the list is empty, it means the last instance of esp_linenoise
      * running is being deleted. Unregister eventfd to free the heap memory
      * allocated when calling esp_vfs_eventfd_register */
+    esp_err_t ret_val = ESP_OK;
     if (SLIST_EMPTY(&s_eventfd_pairs)) {
-        return esp_vfs_eventfd_unregister();
+        ret_val = esp_vfs_eventfd_unregister();
     }
+    esp_linenoise_eventfd_pairs_unlock();
 
-    return ESP_OK;
+    return ret_val;
 }
 
 esp_err_t esp_linenoise_abort(esp_linenoise_handle_t handle)
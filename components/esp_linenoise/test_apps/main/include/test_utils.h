@@ -23,6 +23,7 @@ enum KEY_ACTION {
     CTRL_D = 4,         /* Ctrl-d */
     CTRL_E = 5,         /* Ctrl-e */
     CTRL_F = 6,         /* Ctrl-f */
+    CTRL_G = 7,         /* Ctrl-g */
     CTRL_H = 8,         /* Ctrl-h */
     TAB = 9,            /* Tab */
     CTRL_K = 11,        /* Ctrl+k */
@@ -30,6 +31,7 @@ enum KEY_ACTION {
     ENTER = 10,         /* Enter */
     CTRL_N = 14,        /* Ctrl-n */
     CTRL_P = 16,        /* Ctrl-p */
+    CTRL_R = 18,        /* Ctrl-r */
     CTRL_T = 20,        /* Ctrl-t */
     CTRL_U = 21,        /* Ctrl+u */
     CTRL_W = 23,        /* Ctrl+w */
@@ -396,6 +396,76 @@ TEST_CASE("history navigation with CTRL-P / CTRL-N works correctly", "[esp_linen
     test_instance_teardown(s_socket_fd_a, s_linenoise_hdl, &lock);
 }
 
+TEST_CASE("CTRL-R searches the history backward", "[esp_linenoise][history]")
+{
+    esp_linenoise_config_t config;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    test_instance_setup(s_socket_fd_a, &lock, &config);
+
+    get_line_args_t args = { .lock = &lock, .parent_task = xTaskGetCurrentTaskHandle(), .config = &config };
+    xTaskCreate(get_line_task, "freertos_task", 2048, &args, 5, NULL);
+    pthread_mutex_lock(&lock);
+
+    // add history
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "wifi connect home"));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "nvs list"));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "wifi scan"));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "reboot"));
+
+    test_send_characters(s_socket_fd_a[1], "ab");
+
+    // search, then cancel: the typed line is back
+    test_send_characters(s_socket_fd_a[1], COMPOUND_LITERAL(CTRL_R));
+    test_send_characters(s_socket_fd_a[1], "wifi");                     // -> wifi scan
+    test_send_characters(s_socket_fd_a[1], COMPOUND_LITERAL(CTRL_G));   // -> ab
+
+    // search again and go to the next older match
+    test_send_characters(s_socket_fd_a[1], COMPOUND_LITERAL(CTRL_R));
+    test_send_characters(s_socket_fd_a[1], "wifi");                     // -> wifi scan
+    test_send_characters(s_socket_fd_a[1], COMPOUND_LITERAL(CTRL_R));   // -> wifi connect home
+    test_send_characters(s_socket_fd_a[1], COMPOUND_LITERAL(CTRL_R));   // no older match, stays
+    test_send_characters(s_socket_fd_a[1], "\n");
+
+    // wait for the task to terminate to continue
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    TEST_ASSERT_EQUAL_STRING("wifi connect home", s_line_returned);
+
+    test_instance_teardown(s_socket_fd_a, s_linenoise_hdl, &lock);
+}
+
+TEST_CASE("up and down arrows only recall the entries starting with the typed line", "[esp_linenoise][history]")
+{
+    esp_linenoise_config_t config;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    test_instance_setup(s_socket_fd_a, &lock, &config);
+
+    get_line_args_t args = { .lock = &lock, .parent_task = xTaskGetCurrentTaskHandle(), .config = &config };
+    xTaskCreate(get_line_task, "freertos_task", 2048, &args, 5, NULL);
+    pthread_mutex_lock(&lock);
+
+    // add history
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "log show"));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "reboot"));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "log clear"));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(s_linenoise_hdl, "help"));
+
+    // navigate
+    test_send_characters(s_socket_fd_a[1], "lo");
+    test_send_characters(s_socket_fd_a[1], "\x1b[A");    // up -> log clear
+    test_send_characters(s_socket_fd_a[1], "\x1b[A");    // up -> log show
+    test_send_characters(s_socket_fd_a[1], "\x1b[A");    // up -> no older match, stays
+    test_send_characters(s_socket_fd_a[1], "\x1b[B");    // down -> log clear
+    test_send_characters(s_socket_fd_a[1], "\n");
+
+    // wait for the task to terminate to continue
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    TEST_ASSERT_EQUAL_STRING("log clear", s_line_returned);
+
+    test_instance_teardown(s_socket_fd_a, s_linenoise_hdl, &lock);
+}
+
 TEST_CASE("backspace erases the character before the cursor", "[esp_linenoise]")
 {
     esp_linenoise_config_t config;
@@ -1142,3 +1212,92 @@ TEST_CASE("tests that esp_linenoise_abort actually forces esp_linenoise_get_line
     test_instance_teardown(s_socket_fd_a, linenoise_handle_a, &lock_a);
     test_instance_teardown(s_socket_fd_b, linenoise_handle_b, &lock_b);
 }
+
+static volatile size_t s_bytes_written = 0;
+
+static ssize_t counting_write(int fd, const void *buf, size_t count)
+{
+    // the requests answered by custom_write are not part of the
+    // refresh, don't count them
+    for (size_t i = 0; i < commands_count; i++) {
+        const size_t request_len = strlen(commands[i].request);
+        if (count >= request_len && memcmp(buf, commands[i].request, request_len) == 0) {
+            return custom_write(fd, buf, count);
+        }
+    }
+
+    s_bytes_written += count;
+    return custom_write(fd, buf, count);
+}
+
+static size_t send_and_count(int socket_fd, const char *msg)
+{
+    const size_t bytes_before = s_bytes_written;
+    test_send_characters(socket_fd, msg);
+
+    // give linenoise the time to process the input and refresh the line
+    wait_ms(100);
+
+    return s_bytes_written - bytes_before;
+}
+
+TEST_CASE("incremental refresh only writes the part of the line that changed", "[esp_linenoise]")
+{
+    esp_linenoise_config_t config;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    test_instance_setup(s_socket_fd_a, &lock, &config);
+    config.write_bytes_cb = counting_write;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_create_instance(&config, &s_linenoise_hdl));
+    TEST_ASSERT_NOT_NULL(s_linenoise_hdl);
+
+    char buffer[64] = {0};
+    get_line_task_args_t args = {
+        .handle = s_linenoise_hdl,
+        .parent_task = xTaskGetCurrentTaskHandle(),
+        .lock = &lock,
+        .ret_val = ESP_OK,
+        .buf = buffer,
+        .buf_size = sizeof(buffer)
+    };
+    xTaskCreate(get_line_task_w_args, "freertos_task", 2048, &args, 5, NULL);
+
+    // wait until the linenoise instance init is done, and the get line as started
+    // before sending test content
+    pthread_mutex_lock(&lock);
+
+    // the prompt and the line fit in the 50 columns returned by the
+    // cursor position request. The line doesn't contain characters of
+    // the requests intercepted by custom_write, since the characters
+    // typed are echoed one by one
+    const char *line = "set the value of a key to this path";
+    const size_t full_refresh_len = strlen(line);
+    test_send_characters(s_socket_fd_a[1], line);
+
+    // every edit below must cost a few bytes, whatever the length
+    // of the line, where a full refresh rewrites the prompt and the line
+    const char *edits[] = {
+        COMPOUND_LITERAL(CTRL_B),       // cursor left by one
+        COMPOUND_LITERAL(CTRL_A),       // cursor to the start of the line
+        "X",                            // insert in front of the line
+        COMPOUND_LITERAL(CTRL_E),       // cursor to the end of the line
+        COMPOUND_LITERAL(BACKSPACE),    // remove the last character
+    };
+    for (size_t i = 0; i < sizeof(edits) / sizeof(edits[0]); i++) {
+        const size_t bytes = send_and_count(s_socket_fd_a[1], edits[i]);
+        TEST_ASSERT_GREATER_THAN(0, bytes);
+        TEST_ASSERT_LESS_OR_EQUAL(8, bytes);
+        TEST_ASSERT_LESS_THAN(full_refresh_len, bytes);
+    }
+
+    test_send_characters(s_socket_fd_a[1], "\n");
+
+    // wait for the task to terminate to continue
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    TEST_ASSERT_EQUAL(ESP_OK, args.ret_val);
+    TEST_ASSERT_EQUAL_STRING("Xset the value of a key to this pat", buffer);
+
+    test_instance_teardown(s_socket_fd_a, s_linenoise_hdl, &lock);
+}
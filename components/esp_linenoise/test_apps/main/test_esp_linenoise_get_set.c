@@ -136,6 +136,76 @@ TEST_CASE("save and load history to file", "[esp_linenoise]")
     TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_delete_instance(h));
 }
 
+static int check_history_file(const char *filename, int newest)
+{
+    // the entries are saved oldest first and end with the newest one
+    FILE *fp = fopen(filename, "r");
+    TEST_ASSERT_NOT_NULL(fp);
+
+    char line[32];
+    int first = -1;
+    int count = 0;
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        int entry = -1;
+        TEST_ASSERT_EQUAL(1, sscanf(line, "entry %d", &entry));
+        if (first < 0) {
+            first = entry;
+        }
+        TEST_ASSERT_EQUAL(first + count, entry);
+        count++;
+    }
+    fclose(fp);
+
+    TEST_ASSERT_EQUAL(newest, first + count - 1);
+    return count;
+}
+
+TEST_CASE("history keeps the newest entries when full", "[esp_linenoise]")
+{
+    const char *filename = "/tmp/test_esp_linenoise_history_full.txt";
+    const int entries_added = 5000;
+    char line[32];
+
+    // limited by the number of entries
+    esp_linenoise_handle_t h = get_linenoise_instance_default_config();
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_set_max_len(h, 1000));
+    for (int i = 0; i < entries_added; i++) {
+        snprintf(line, sizeof(line), "entry %d", i);
+        TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(h, line));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_save(h, filename));
+    TEST_ASSERT_EQUAL(1000, check_history_file(filename, entries_added - 1));
+
+    // reducing the number of entries keeps the newest ones
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_set_max_len(h, 10));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_save(h, filename));
+    TEST_ASSERT_EQUAL(10, check_history_file(filename, entries_added - 1));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_delete_instance(h));
+
+    // limited by the size of the history buffer, the entries
+    // wrap around the end of the buffer
+    esp_linenoise_config_t config;
+    esp_linenoise_get_instance_config_default(&config);
+    config.history_buffer_size = 64;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_create_instance(&config, &h));
+    for (int i = 0; i < entries_added; i++) {
+        snprintf(line, sizeof(line), "entry %d", i);
+        TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_add(h, line));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_history_save(h, filename));
+    const int count = check_history_file(filename, entries_added - 1);
+    TEST_ASSERT_GREATER_OR_EQUAL(3, count);
+    TEST_ASSERT_LESS_OR_EQUAL(64 / (int)sizeof("entry 4999"), count);
+
+    // an entry bigger than the history buffer is rejected
+    char long_line[65];
+    memset(long_line, 'a', sizeof(long_line) - 1);
+    long_line[sizeof(long_line) - 1] = '\0';
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, esp_linenoise_history_add(h, long_line));
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_linenoise_delete_instance(h));
+}
+
 TEST_CASE("get out_fd and in_fd", "[esp_linenoise]")
 {
     const int test_out_fd = 5;
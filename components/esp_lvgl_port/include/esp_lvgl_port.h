@@ -89,6 +89,8 @@ esp_err_t lvgl_port_init(const lvgl_port_cfg_t *cfg);
  *
  * @note This function deinitializes LVGL and stops the task if running.
  * Some deinitialization will be done after the task will be stopped.
+ * @note LVGL9: the task is woken and waited for (up to 5 s). Called from the LVGL task itself,
+ * it returns at once and the task stops after the current iteration.
  *
  * @return
  *      - ESP_OK                    on success
@@ -141,6 +143,15 @@ esp_err_t lvgl_port_stop(void);
  */
 esp_err_t lvgl_port_resume(void);
 
+/**
+ * @brief Number of LVGL task wakeups plus periodic tick callbacks since lvgl_port_init()
+ *
+ * @note Sample it twice while the UI is idle to get the idle wakeups per second.
+ *
+ * @return wakeup counter
+ */
+uint32_t lvgl_port_get_wakeups(void);
+
 /**
  * @brief Notify LVGL task, that display need reload
  *
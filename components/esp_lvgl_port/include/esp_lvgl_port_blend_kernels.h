@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Blend kernels used by esp_lvgl_port_lv_blend.h
+ *
+ * This header has no LVGL dependency, so the kernels can be built and tested on the host too.
+ * All kernels return 1 (LV_RESULT_OK) when the area was blended and 0 (LV_RESULT_INVALID)
+ * when LVGL shall fall back to its own implementation.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/* Field offsets are hard-coded in the assembly kernels, keep the layout */
+typedef struct {
+    uint32_t opa;
+    void *dst_buf;
+    uint32_t dst_w;
+    uint32_t dst_h;
+    uint32_t dst_stride;
+    const void *src_buf;
+    uint32_t src_stride;
+    const uint8_t *mask_buf;
+    uint32_t mask_stride;
+} asm_dsc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/* Assembly kernels (esp32 / esp32s3 only) */
+extern int lv_color_blend_to_argb8888_esp(asm_dsc_t *asm_dsc);
+extern int lv_color_blend_to_rgb565_esp(asm_dsc_t *asm_dsc);
+extern int lv_color_blend_to_rgb888_esp(asm_dsc_t *asm_dsc);
+extern int lv_rgb565_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc);
+extern int lv_rgb888_blend_normal_to_rgb888_esp(asm_dsc_t *asm_dsc);
+
+/* Plain C kernels, no SIMD (lv_blend_to_rgb565_c.c), bit-exact with LVGL's blend to RGB565 */
+
+/**
+ * @brief RGB565 image with opacity to RGB565, `opa` < LV_OPA_MAX and no mask
+ */
+extern int lv_rgb565_blend_normal_to_rgb565_with_opa_esp(asm_dsc_t *asm_dsc);
+
+/**
+ * @brief RGB565 image with mask to RGB565, `opa` is mixed into the mask when < LV_OPA_MAX
+ */
+extern int lv_rgb565_blend_normal_to_rgb565_with_mask_esp(asm_dsc_t *asm_dsc);
+
+/**
+ * @brief ARGB8888 image to RGB565, with optional opacity and mask
+ */
+extern int lv_argb8888_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc);
+
+/**
+ * @brief Byte swapped RGB565 image to RGB565, the swap is fused into the copy/blend
+ */
+extern int lv_rgb565_swapped_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
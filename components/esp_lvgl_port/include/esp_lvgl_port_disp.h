@@ -53,6 +53,7 @@ typedef struct {
     lvgl_port_rotation_cfg_t rotation;      /*!< Default values of the screen rotation (Only HW state. Not supported for default SW rotation!) */
 #if LVGL_VERSION_MAJOR >= 9
     lv_color_format_t        color_format;  /*!< The color format of the display */
+    uint32_t    flush_cost;     /*!< Cost of one flush transaction in pixels (e.g. CASET/RASET/RAMWR on SPI panels), invalidated areas are joined when redrawing the gap is cheaper (0: join only overlapping areas) */
 #endif
     struct {
         unsigned int buff_dma: 1;    /*!< Allocated LVGL buffer will be DMA capable */
@@ -14,10 +14,28 @@ extern "C" {
  *      INCLUDES
  *********************/
 
-#if !CONFIG_LV_DRAW_SW_ASM_CUSTOM
+#if !(defined(CONFIG_LV_DRAW_SW_ASM_CUSTOM) && CONFIG_LV_DRAW_SW_ASM_CUSTOM) && !(defined(LV_USE_DRAW_SW_ASM) && (LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM))
 #warning "esp_lvgl_port_lv_blend.h included, but CONFIG_LV_DRAW_SW_ASM_CUSTOM not set. Assembly rendering not used"
 #else
 
+#include "esp_lvgl_port_blend_kernels.h"
+
+/* LVGL >= 9.2 moved the blend descriptors to a private header and dropped the leading underscore */
+#if defined(__has_include)
+#if __has_include("draw/sw/blend/lv_draw_sw_blend_private.h")
+#include "draw/sw/blend/lv_draw_sw_blend_private.h"
+#define LVGL_PORT_BLEND_PRIVATE_DSC 1
+#elif __has_include("src/draw/sw/blend/lv_draw_sw_blend_private.h")
+#include "src/draw/sw/blend/lv_draw_sw_blend_private.h"
+#define LVGL_PORT_BLEND_PRIVATE_DSC 1
+#endif
+#endif
+
+#ifndef LVGL_PORT_BLEND_PRIVATE_DSC
+typedef _lv_draw_sw_blend_fill_dsc_t lv_draw_sw_blend_fill_dsc_t;
+typedef _lv_draw_sw_blend_image_dsc_t lv_draw_sw_blend_image_dsc_t;
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -47,29 +65,66 @@ extern "C" {
     _lv_rgb888_blend_normal_to_rgb888_esp(dsc, dest_px_size, src_px_size)
 #endif
 
-/**********************
- *      TYPEDEFS
- **********************/
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_blend_normal_to_rgb565_with_opa_esp)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_blend_normal_to_rgb565_with_mask_esp)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_blend_normal_to_rgb565_with_mask_esp)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_argb8888_blend_normal_to_rgb565_esp)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_argb8888_blend_normal_to_rgb565_esp)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_argb8888_blend_normal_to_rgb565_esp)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_argb8888_blend_normal_to_rgb565_esp)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_swapped_blend_normal_to_rgb565_esp)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_swapped_blend_normal_to_rgb565_esp)
+#endif
 
-typedef struct {
-    uint32_t opa;
-    void *dst_buf;
-    uint32_t dst_w;
-    uint32_t dst_h;
-    uint32_t dst_stride;
-    const void *src_buf;
-    uint32_t src_stride;
-    const lv_opa_t *mask_buf;
-    uint32_t mask_stride;
-} asm_dsc_t;
+#ifndef LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_swapped_blend_normal_to_rgb565_esp)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_SWAPPED_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_blend_image_to_rgb565_esp(dsc, lv_rgb565_swapped_blend_normal_to_rgb565_esp)
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
-extern int lv_color_blend_to_argb8888_esp(asm_dsc_t *asm_dsc);
-
-static inline lv_result_t _lv_color_blend_to_argb8888_esp(_lv_draw_sw_blend_fill_dsc_t *dsc)
+static inline lv_result_t _lv_color_blend_to_argb8888_esp(lv_draw_sw_blend_fill_dsc_t *dsc)
 {
     asm_dsc_t asm_dsc = {
         .dst_buf = dsc->dest_buf,
@@ -82,9 +137,7 @@ static inline lv_result_t _lv_color_blend_to_argb8888_esp(_lv_draw_sw_blend_fill
     return lv_color_blend_to_argb8888_esp(&asm_dsc);
 }
 
-extern int lv_color_blend_to_rgb565_esp(asm_dsc_t *asm_dsc);
-
-static inline lv_result_t _lv_color_blend_to_rgb565_esp(_lv_draw_sw_blend_fill_dsc_t *dsc)
+static inline lv_result_t _lv_color_blend_to_rgb565_esp(lv_draw_sw_blend_fill_dsc_t *dsc)
 {
     asm_dsc_t asm_dsc = {
         .dst_buf = dsc->dest_buf,
@@ -97,9 +150,7 @@ static inline lv_result_t _lv_color_blend_to_rgb565_esp(_lv_draw_sw_blend_fill_d
     return lv_color_blend_to_rgb565_esp(&asm_dsc);
 }
 
-extern int lv_color_blend_to_rgb888_esp(asm_dsc_t *asm_dsc);
-
-static inline lv_result_t _lv_color_blend_to_rgb888_esp(_lv_draw_sw_blend_fill_dsc_t *dsc, uint32_t dest_px_size)
+static inline lv_result_t _lv_color_blend_to_rgb888_esp(lv_draw_sw_blend_fill_dsc_t *dsc, uint32_t dest_px_size)
 {
     if (dest_px_size != 3) {
         return LV_RESULT_INVALID;
@@ -115,9 +166,7 @@ static inline lv_result_t _lv_color_blend_to_rgb888_esp(_lv_draw_sw_blend_fill_d
     return lv_color_blend_to_rgb888_esp(&asm_dsc);
 }
 
-extern int lv_rgb565_blend_normal_to_rgb565_esp(asm_dsc_t *asm_dsc);
-
-static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_esp(_lv_draw_sw_blend_image_dsc_t *dsc)
+static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_esp(lv_draw_sw_blend_image_dsc_t *dsc)
 {
     asm_dsc_t asm_dsc = {
         .dst_buf = dsc->dest_buf,
@@ -131,9 +180,7 @@ static inline lv_result_t _lv_rgb565_blend_normal_to_rgb565_esp(_lv_draw_sw_blen
     return lv_rgb565_blend_normal_to_rgb565_esp(&asm_dsc);
 }
 
-extern int lv_rgb888_blend_normal_to_rgb888_esp(asm_dsc_t *asm_dsc);
-
-static inline lv_result_t _lv_rgb888_blend_normal_to_rgb888_esp(_lv_draw_sw_blend_image_dsc_t *dsc, uint32_t dest_px_size, uint32_t src_px_size)
+static inline lv_result_t _lv_rgb888_blend_normal_to_rgb888_esp(lv_draw_sw_blend_image_dsc_t *dsc, uint32_t dest_px_size, uint32_t src_px_size)
 {
     if (!(dest_px_size == 3 && src_px_size == 3)) {
         return LV_RESULT_INVALID;
@@ -151,6 +198,23 @@ static inline lv_result_t _lv_rgb888_blend_normal_to_rgb888_esp(_lv_draw_sw_blen
     return lv_rgb888_blend_normal_to_rgb888_esp(&asm_dsc);
 }
 
+static inline lv_result_t _lv_blend_image_to_rgb565_esp(lv_draw_sw_blend_image_dsc_t *dsc, int (*kernel)(asm_dsc_t *))
+{
+    asm_dsc_t asm_dsc = {
+        .opa = dsc->opa,
+        .dst_buf = dsc->dest_buf,
+        .dst_w = dsc->dest_w,
+        .dst_h = dsc->dest_h,
+        .dst_stride = dsc->dest_stride,
+        .src_buf = dsc->src_buf,
+        .src_stride = dsc->src_stride,
+        .mask_buf = dsc->mask_buf,
+        .mask_stride = dsc->mask_stride
+    };
+
+    return kernel(&asm_dsc);
+}
+
 #endif // CONFIG_LV_DRAW_SW_ASM_CUSTOM
 
 #ifdef __cplusplus
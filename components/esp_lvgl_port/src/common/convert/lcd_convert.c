@@ -0,0 +1,267 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Flush conversion: software rotation and RGB565 byte swap fused into one pass over the flushed area.
+// Plain C on every target (no PIE / SIMD instructions).
+// 90/270 rotation walks the area in CONVERT_TILE x CONVERT_TILE tiles, so the strided reads stay in cache
+// and the writes are sequential. RGB565 moves two pixels per 32-bit store (the byte swap and the
+// 180 rotation of a pixel pair are a single rotate / byte reverse of the 32-bit word).
+
+#include <string.h>
+#include "lcd_convert.h"
+
+/* Tile edge for 90/270 rotation: 16 source rows of one tile touch 16 cache lines */
+#define CONVERT_TILE            16
+
+#define SWAP16(c)               ((uint16_t)(((c) >> 8) | ((c) << 8)))
+#define SWAP16X2(w)             ((((w) & 0xff00ff00) >> 8) | (((w) & 0x00ff00ff) << 8))
+#define ROR16X2(w)              (((w) >> 16) | ((w) << 16))
+
+/* Two RGB565 pixels accessed as one word, may_alias keeps the uint16_t buffers strict aliasing safe */
+typedef uint32_t __attribute__((__may_alias__)) px16x2_t;
+
+/*******************************************************************************
+* RGB565
+*******************************************************************************/
+
+static inline uint16_t px16(uint16_t c, bool swap)
+{
+    return swap ? SWAP16(c) : c;
+}
+
+static inline const uint8_t *row_ptr(const void *buf, uint32_t stride, int32_t y)
+{
+    return (const uint8_t *)buf + (uint32_t)y * stride;
+}
+
+static void convert_rgb565_0(const lvgl_port_convert_cfg_t *cfg)
+{
+    for (int32_t y = 0; y < cfg->h; y++) {
+        const uint16_t *s = (const uint16_t *)row_ptr(cfg->src, cfg->src_stride, y);
+        uint16_t *d = (uint16_t *)row_ptr(cfg->dst, cfg->dst_stride, y);
+        int32_t w = cfg->w;
+        int32_t x = 0;
+
+        if (!cfg->swap_bytes) {
+            if (d != s) {
+                memcpy(d, s, (size_t)w * 2);
+            }
+            continue;
+        }
+
+        if ((((uintptr_t)d ^ (uintptr_t)s) & 0x2) == 0) {
+            if (((uintptr_t)d & 0x2) && w > 0) {
+                d[0] = SWAP16(s[0]);
+                x = 1;
+            }
+            px16x2_t *d32 = (px16x2_t *)&d[x];
+            const px16x2_t *s32 = (const px16x2_t *)&s[x];
+            int32_t pairs = (w - x) / 2;
+            int32_t i = 0;
+            for (; i + 4 <= pairs; i += 4) {
+                d32[i + 0] = SWAP16X2(s32[i + 0]);
+                d32[i + 1] = SWAP16X2(s32[i + 1]);
+                d32[i + 2] = SWAP16X2(s32[i + 2]);
+                d32[i + 3] = SWAP16X2(s32[i + 3]);
+            }
+            for (; i < pairs; i++) {
+                d32[i] = SWAP16X2(s32[i]);
+            }
+            x += pairs * 2;
+        }
+
+        for (; x < w; x++) {
+            d[x] = SWAP16(s[x]);
+        }
+    }
+}
+
+static void convert_rgb565_180(const lvgl_port_convert_cfg_t *cfg)
+{
+    const bool swap = cfg->swap_bytes;
+    const int32_t w = cfg->w;
+
+    for (int32_t y = 0; y < cfg->h; y++) {
+        const uint16_t *s = (const uint16_t *)row_ptr(cfg->src, cfg->src_stride, y);
+        uint16_t *d = (uint16_t *)row_ptr(cfg->dst, cfg->dst_stride, cfg->h - 1 - y);
+        int32_t x = 0;
+
+        if (((uintptr_t)s & 0x2) && w > 0) {
+            d[w - 1] = px16(s[0], swap);
+            x = 1;
+        }
+        /* Pixel pair (x, x + 1) lands on (w - 2 - x, w - 1 - x) */
+        int32_t pairs = (w - x) / 2;
+        if (pairs > 0 && (((uintptr_t)&d[w - 2 - x]) & 0x2) == 0) {
+            const px16x2_t *s32 = (const px16x2_t *)&s[x];
+            px16x2_t *d32 = (px16x2_t *)&d[w - 2 - x];
+            for (int32_t i = 0; i < pairs; i++) {
+                uint32_t v = s32[i];
+                *(d32 - i) = swap ? __builtin_bswap32(v) : ROR16X2(v);
+            }
+            x += pairs * 2;
+        }
+
+        for (; x < w; x++) {
+            d[w - 1 - x] = px16(s[x], swap);
+        }
+    }
+}
+
+/**
+ * Write `n` pixels of source column `x` into one destination row, starting at source row `y0` and
+ * moving by `step` (+1 for 90, -1 for 270) rows
+ */
+static inline void rgb565_column_to_row(uint16_t *d, const uint8_t *s, int32_t s_step, int32_t n, bool swap)
+{
+    int32_t j = 0;
+
+    if (((uintptr_t)d & 0x2) && n > 0) {
+        d[0] = px16(*(const uint16_t *)s, swap);
+        s += s_step;
+        j = 1;
+    }
+    for (; j + 2 <= n; j += 2) {
+        uint32_t lo = *(const uint16_t *)s;
+        uint32_t hi = *(const uint16_t *)(s + s_step);
+        uint32_t v = lo | (hi << 16);
+        *(px16x2_t *)&d[j] = swap ? SWAP16X2(v) : v;
+        s += 2 * s_step;
+    }
+    if (j < n) {
+        d[j] = px16(*(const uint16_t *)s, swap);
+    }
+}
+
+static void convert_rgb565_90_270(const lvgl_port_convert_cfg_t *cfg)
+{
+    const bool rot90 = (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_90);
+    const int32_t w = cfg->w;
+    const int32_t h = cfg->h;
+    const int32_t s_stride = (int32_t)cfg->src_stride;
+
+    for (int32_t ty = 0; ty < h; ty += CONVERT_TILE) {
+        int32_t th = (h - ty < CONVERT_TILE) ? (h - ty) : CONVERT_TILE;
+        for (int32_t tx = 0; tx < w; tx += CONVERT_TILE) {
+            int32_t tw = (w - tx < CONVERT_TILE) ? (w - tx) : CONVERT_TILE;
+            for (int32_t x = tx; x < tx + tw; x++) {
+                uint16_t *d;
+                const uint8_t *s;
+                int32_t s_step;
+                if (rot90) {
+                    /* (x, y) -> row (w - 1 - x), column y: walk the source rows downwards */
+                    d = (uint16_t *)row_ptr(cfg->dst, cfg->dst_stride, w - 1 - x) + ty;
+                    s = row_ptr(cfg->src, cfg->src_stride, ty) + x * 2;
+                    s_step = s_stride;
+                } else {
+                    /* (x, y) -> row x, column (h - 1 - y): walk the source rows upwards */
+                    d = (uint16_t *)row_ptr(cfg->dst, cfg->dst_stride, x) + (h - ty - th);
+                    s = row_ptr(cfg->src, cfg->src_stride, ty + th - 1) + x * 2;
+                    s_step = -s_stride;
+                }
+                rgb565_column_to_row(d, s, s_step, th, cfg->swap_bytes);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* L8 / RGB888 / XRGB8888 / ARGB8888
+*******************************************************************************/
+
+static inline void copy_px(uint8_t *d, const uint8_t *s, uint8_t px_size)
+{
+    if (px_size == 4) {
+        memcpy(d, s, 4);
+    } else if (px_size == 1) {
+        d[0] = s[0];
+    } else {
+        d[0] = s[0];
+        d[1] = s[1];
+        d[2] = s[2];
+    }
+}
+
+static void convert_px(const lvgl_port_convert_cfg_t *cfg)
+{
+    const uint8_t px = cfg->px_size;
+    const int32_t w = cfg->w;
+    const int32_t h = cfg->h;
+
+    if (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_0) {
+        if (cfg->dst != cfg->src) {
+            for (int32_t y = 0; y < h; y++) {
+                memcpy((uint8_t *)row_ptr(cfg->dst, cfg->dst_stride, y), row_ptr(cfg->src, cfg->src_stride, y), (size_t)w * px);
+            }
+        }
+        return;
+    }
+
+    if (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_180) {
+        for (int32_t y = 0; y < h; y++) {
+            const uint8_t *s = row_ptr(cfg->src, cfg->src_stride, y);
+            uint8_t *d = (uint8_t *)row_ptr(cfg->dst, cfg->dst_stride, h - 1 - y) + (size_t)(w - 1) * px;
+            for (int32_t x = 0; x < w; x++, s += px, d -= px) {
+                copy_px(d, s, px);
+            }
+        }
+        return;
+    }
+
+    const bool rot90 = (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_90);
+    for (int32_t ty = 0; ty < h; ty += CONVERT_TILE) {
+        int32_t th = (h - ty < CONVERT_TILE) ? (h - ty) : CONVERT_TILE;
+        for (int32_t tx = 0; tx < w; tx += CONVERT_TILE) {
+            int32_t tw = (w - tx < CONVERT_TILE) ? (w - tx) : CONVERT_TILE;
+            for (int32_t x = tx; x < tx + tw; x++) {
+                uint8_t *d;
+                const uint8_t *s;
+                int32_t s_step;
+                if (rot90) {
+                    d = (uint8_t *)row_ptr(cfg->dst, cfg->dst_stride, w - 1 - x) + (size_t)ty * px;
+                    s = row_ptr(cfg->src, cfg->src_stride, ty) + (size_t)x * px;
+                    s_step = (int32_t)cfg->src_stride;
+                } else {
+                    d = (uint8_t *)row_ptr(cfg->dst, cfg->dst_stride, x) + (size_t)(h - ty - th) * px;
+                    s = row_ptr(cfg->src, cfg->src_stride, ty + th - 1) + (size_t)x * px;
+                    s_step = -(int32_t)cfg->src_stride;
+                }
+                for (int32_t j = 0; j < th; j++, d += px, s += s_step) {
+                    copy_px(d, s, px);
+                }
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+void lvgl_port_convert(const lvgl_port_convert_cfg_t *cfg)
+{
+    if (cfg->w <= 0 || cfg->h <= 0 || cfg->px_size < 1 || cfg->px_size > 4) {
+        return;
+    }
+
+    if (cfg->px_size != 2) {
+        convert_px(cfg);
+        return;
+    }
+
+    switch (cfg->rotation) {
+    case LVGL_PORT_CONVERT_ROTATION_0:
+        convert_rgb565_0(cfg);
+        break;
+    case LVGL_PORT_CONVERT_ROTATION_180:
+        convert_rgb565_180(cfg);
+        break;
+    case LVGL_PORT_CONVERT_ROTATION_90:
+    case LVGL_PORT_CONVERT_ROTATION_270:
+        convert_rgb565_90_270(cfg);
+        break;
+    }
+}
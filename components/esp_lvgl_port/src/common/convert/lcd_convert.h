@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief LCD flush conversion (rotation + byte swap in one pass)
+ *
+ * This header has no LVGL and no ESP-IDF dependency, so the conversion can be built and tested on the host too.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Rotation, same values as lv_display_rotation_t
+ */
+typedef enum {
+    LVGL_PORT_CONVERT_ROTATION_0 = 0,
+    LVGL_PORT_CONVERT_ROTATION_90,
+    LVGL_PORT_CONVERT_ROTATION_180,
+    LVGL_PORT_CONVERT_ROTATION_270,
+} lvgl_port_convert_rotation_t;
+
+/**
+ * @brief Conversion configuration
+ *
+ * Rotation maps source pixel (x, y) to the destination the same way as lv_draw_sw_rotate():
+ *  - 90:  row (w - 1 - x), column y
+ *  - 180: row (h - 1 - y), column (w - 1 - x)
+ *  - 270: row x, column (h - 1 - y)
+ * The destination is h pixels wide and w pixels high for 90 and 270.
+ */
+typedef struct {
+    const void  *src;           /*!< Source buffer */
+    void        *dst;           /*!< Destination buffer, may be equal to `src` only for LVGL_PORT_CONVERT_ROTATION_0 */
+    int32_t     w;              /*!< Source width in pixels */
+    int32_t     h;              /*!< Source height in pixels */
+    uint32_t    src_stride;     /*!< Source stride in bytes */
+    uint32_t    dst_stride;     /*!< Destination stride in bytes */
+    uint8_t     px_size;        /*!< Pixel size in bytes: 1, 2, 3 or 4, other sizes are ignored. 1 is one byte per pixel (L8), not packed formats */
+    lvgl_port_convert_rotation_t rotation;  /*!< Rotation */
+    bool        swap_bytes;     /*!< Swap bytes of RGB565 pixels, only for `px_size` 2 */
+} lvgl_port_convert_cfg_t;
+
+/**
+ * @brief Rotate and byte swap an area in a single cache-blocked pass
+ *
+ * @param cfg   Conversion configuration
+ */
+void lvgl_port_convert(const lvgl_port_convert_cfg_t *cfg);
+
+#ifdef __cplusplus
+}
+#endif
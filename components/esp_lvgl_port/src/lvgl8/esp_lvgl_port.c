@@ -31,6 +31,8 @@ typedef struct lvgl_port_ctx_s {
     bool                running;
     int                 task_max_sleep_ms;
     int                 timer_period_ms;
+    uint32_t            task_wakeups;   /* LVGL task loop iterations */
+    uint32_t            tick_wakeups;   /* periodic tick callbacks */
 } lvgl_port_ctx_t;
 
 /*******************************************************************************
@@ -112,6 +114,11 @@ esp_err_t lvgl_port_stop(void)
     return ret;
 }
 
+uint32_t lvgl_port_get_wakeups(void)
+{
+    return lvgl_port_ctx.task_wakeups + lvgl_port_ctx.tick_wakeups;
+}
+
 esp_err_t lvgl_port_deinit(void)
 {
     /* Stop running task */
@@ -167,6 +174,7 @@ static void lvgl_port_task(void *arg)
     ESP_LOGI(TAG, "Starting LVGL task");
     lvgl_port_ctx.running = true;
     while (lvgl_port_ctx.running) {
+        lvgl_port_ctx.task_wakeups++;
         if (lvgl_port_lock(0)) {
             task_delay_ms = lv_timer_handler();
             lvgl_port_unlock();
@@ -208,6 +216,7 @@ static void lvgl_port_task_deinit(void)
 
 static void lvgl_port_tick_increment(void *arg)
 {
+    lvgl_port_ctx.tick_wakeups++;
     /* Tell LVGL how many milliseconds have elapsed */
     lv_tick_inc(lvgl_port_ctx.timer_period_ms);
 }
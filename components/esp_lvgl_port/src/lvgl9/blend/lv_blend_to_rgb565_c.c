@@ -0,0 +1,250 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// This is LVGL image blend to RGB565 for the paths not covered by the assembly kernels:
+// opa / mask blended RGB565, ARGB8888 and byte swapped RGB565 sources.
+// Plain C, no SIMD instructions: the results are bit-exact with lv_draw_sw_blend_to_rgb565.c,
+// the speedup comes from inlined mixing, per-area opacity hoisting, skipping transparent /
+// copying opaque pixels and moving two pixels per 32-bit load/store where the alignment allows.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_lvgl_port_blend_kernels.h"
+
+/* Same values as in LVGL's lv_color.h */
+#define BLEND_OPA_MAX           253
+#define BLEND_OPA_MIX2(a1, a2)  ((uint8_t)(((int32_t)(a1) * (a2)) >> 8))
+#define BLEND_OPA_MIX3(a1, a2, a3) ((uint8_t)(((int32_t)(a1) * (a2) * (a3)) >> 16))
+
+/* lv_color_16_16_mix() uses 5 bit mixing, these mix values map to 0 and 32 */
+#define MIX16_KEEP_DST(mix)     ((mix) < 4)
+#define MIX16_TAKE_SRC(mix)     ((mix) >= 252)
+
+#define SWAP16(c)               ((uint16_t)(((c) >> 8) | ((c) << 8)))
+#define SWAP16X2(w)             ((((w) & 0xff00ff00) >> 8) | (((w) & 0x00ff00ff) << 8))
+
+/* Two RGB565 pixels accessed as one word, may_alias keeps the uint16_t buffers strict aliasing safe */
+typedef uint32_t __attribute__((__may_alias__)) px16x2_t;
+
+static inline void *next_row(const void *buf, uint32_t stride)
+{
+    return (uint8_t *)buf + stride;
+}
+
+/**
+ * Same math as lv_color_16_16_mix(), with the 5 bit mix value already computed
+ */
+static inline uint16_t mix16_m5(uint16_t c1, uint16_t c2, uint32_t m5)
+{
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * m5) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)((result >> 16) | result);
+}
+
+/**
+ * Same math as lv_color_24_16_mix() in lv_draw_sw_blend_to_rgb565.c
+ */
+static inline uint16_t mix24_16(const uint8_t *c1, uint16_t c2, uint8_t mix)
+{
+    if (mix == 0) {
+        return c2;
+    } else if (mix == 255) {
+        return ((c1[2] & 0xF8) << 8) + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    } else {
+        uint8_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+/**
+ * Blend one row with a constant 5 bit mix value, two pixels per 32-bit access when
+ * `dst` and `src` have the same 4-byte phase.
+ */
+static inline void rgb565_row_mix_const(uint16_t *dst, const uint16_t *src, int32_t w, uint32_t m5, int swap)
+{
+    int32_t x = 0;
+
+    if ((((uintptr_t)dst ^ (uintptr_t)src) & 0x2) == 0) {
+        if (((uintptr_t)dst & 0x2) && w > 0) {
+            uint16_t s = swap ? SWAP16(src[0]) : src[0];
+            dst[0] = mix16_m5(s, dst[0], m5);
+            x = 1;
+        }
+        px16x2_t *dst32 = (px16x2_t *)&dst[x];
+        const px16x2_t *src32 = (const px16x2_t *)&src[x];
+        int32_t pairs = (w - x) / 2;
+        for (int32_t i = 0; i < pairs; i++) {
+            uint32_t s = swap ? SWAP16X2(src32[i]) : src32[i];
+            uint32_t d = dst32[i];
+            uint32_t lo = mix16_m5((uint16_t)s, (uint16_t)d, m5);
+            uint32_t hi = mix16_m5((uint16_t)(s >> 16), (uint16_t)(d >> 16), m5);
+            dst32[i] = lo | (hi << 16);
+        }
+        x += pairs * 2;
+    }
+
+    for (; x < w; x++) {
+        uint16_t s = swap ? SWAP16(src[x]) : src[x];
+        dst[x] = mix16_m5(s, dst[x], m5);
+    }
+}
+
+static inline void rgb565_row_copy_swap(uint16_t *dst, const uint16_t *src, int32_t w)
+{
+    int32_t x = 0;
+
+    if ((((uintptr_t)dst ^ (uintptr_t)src) & 0x2) == 0) {
+        if (((uintptr_t)dst & 0x2) && w > 0) {
+            dst[0] = SWAP16(src[0]);
+            x = 1;
+        }
+        px16x2_t *dst32 = (px16x2_t *)&dst[x];
+        const px16x2_t *src32 = (const px16x2_t *)&src[x];
+        int32_t pairs = (w - x) / 2;
+        int32_t i = 0;
+        for (; i + 4 <= pairs; i += 4) {
+            dst32[i + 0] = SWAP16X2(src32[i + 0]);
+            dst32[i + 1] = SWAP16X2(src32[i + 1]);
+            dst32[i + 2] = SWAP16X2(src32[i + 2]);
+            dst32[i + 3] = SWAP16X2(src32[i + 3]);
+        }
+        for (; i < pairs; i++) {
+            dst32[i] = SWAP16X2(src32[i]);
+        }
+        x += pairs * 2;
+    }
+
+    for (; x < w; x++) {
+        dst[x] = SWAP16(src[x]);
+    }
+}
+
+/**
+ * Blend with a constant opacity, shared by the normal and the swapped source
+ */
+static int rgb565_blend_opa(asm_dsc_t *dsc, int swap)
+{
+    uint16_t *dst = dsc->dst_buf;
+    const uint16_t *src = dsc->src_buf;
+    int32_t w = dsc->dst_w;
+    int32_t h = dsc->dst_h;
+    uint8_t opa = dsc->opa;
+
+    if (MIX16_KEEP_DST(opa)) {
+        return 1;
+    }
+
+    for (int32_t y = 0; y < h; y++) {
+        if (MIX16_TAKE_SRC(opa)) {
+            if (swap) {
+                rgb565_row_copy_swap(dst, src, w);
+            } else {
+                for (int32_t x = 0; x < w; x++) {
+                    dst[x] = src[x];
+                }
+            }
+        } else {
+            rgb565_row_mix_const(dst, src, w, ((uint32_t)opa + 4) >> 3, swap);
+        }
+        dst = next_row(dst, dsc->dst_stride);
+        src = next_row(src, dsc->src_stride);
+    }
+
+    return 1;
+}
+
+/**
+ * Blend with a per pixel mask (mixed with `opa` if it's not full), shared by the normal and the swapped source
+ */
+static int rgb565_blend_mask(asm_dsc_t *dsc, int swap)
+{
+    uint16_t *dst = dsc->dst_buf;
+    const uint16_t *src = dsc->src_buf;
+    const uint8_t *mask = dsc->mask_buf;
+    int32_t w = dsc->dst_w;
+    int32_t h = dsc->dst_h;
+    uint8_t opa = dsc->opa;
+
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            uint8_t mix = opa >= BLEND_OPA_MAX ? mask[x] : BLEND_OPA_MIX2(mask[x], opa);
+            if (MIX16_KEEP_DST(mix)) {
+                continue;
+            }
+            uint16_t s = swap ? SWAP16(src[x]) : src[x];
+            dst[x] = MIX16_TAKE_SRC(mix) ? s : mix16_m5(s, dst[x], ((uint32_t)mix + 4) >> 3);
+        }
+        dst = next_row(dst, dsc->dst_stride);
+        src = next_row(src, dsc->src_stride);
+        mask += dsc->mask_stride;
+    }
+
+    return 1;
+}
+
+int lv_rgb565_blend_normal_to_rgb565_with_opa_esp(asm_dsc_t *dsc)
+{
+    return rgb565_blend_opa(dsc, 0);
+}
+
+int lv_rgb565_blend_normal_to_rgb565_with_mask_esp(asm_dsc_t *dsc)
+{
+    if (dsc->mask_buf == NULL) {
+        return 0;
+    }
+    return rgb565_blend_mask(dsc, 0);
+}
+
+int lv_rgb565_swapped_blend_normal_to_rgb565_esp(asm_dsc_t *dsc)
+{
+    if (dsc->mask_buf) {
+        return rgb565_blend_mask(dsc, 1);
+    }
+    return rgb565_blend_opa(dsc, 1);
+}
+
+int lv_argb8888_blend_normal_to_rgb565_esp(asm_dsc_t *dsc)
+{
+    uint16_t *dst = dsc->dst_buf;
+    const uint8_t *src = dsc->src_buf;
+    const uint8_t *mask = dsc->mask_buf;
+    int32_t w = dsc->dst_w;
+    int32_t h = dsc->dst_h;
+    uint8_t opa = dsc->opa;
+    int full_opa = opa >= BLEND_OPA_MAX;
+
+    for (int32_t y = 0; y < h; y++) {
+        const uint8_t *s = src;
+        if (mask == NULL && full_opa) {
+            for (int32_t x = 0; x < w; x++, s += 4) {
+                dst[x] = mix24_16(s, dst[x], s[3]);
+            }
+        } else if (mask == NULL) {
+            for (int32_t x = 0; x < w; x++, s += 4) {
+                dst[x] = mix24_16(s, dst[x], BLEND_OPA_MIX2(s[3], opa));
+            }
+        } else if (full_opa) {
+            for (int32_t x = 0; x < w; x++, s += 4) {
+                dst[x] = mix24_16(s, dst[x], BLEND_OPA_MIX2(s[3], mask[x]));
+            }
+        } else {
+            for (int32_t x = 0; x < w; x++, s += 4) {
+                dst[x] = mix24_16(s, dst[x], BLEND_OPA_MIX3(s[3], mask[x], opa));
+            }
+        }
+        dst = next_row(dst, dsc->dst_stride);
+        src += dsc->src_stride;
+        if (mask) {
+            mask += dsc->mask_stride;
+        }
+    }
+
+    return 1;
+}
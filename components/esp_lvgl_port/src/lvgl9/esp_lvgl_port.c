@@ -10,6 +10,7 @@
 #include "esp_err.h"
 #include "esp_check.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/portmacro.h"
 #include "freertos/task.h"
@@ -22,6 +23,8 @@
 
 static const char *TAG = "LVGL";
 
+#define LVGL_PORT_EVENT_DRIVEN  (CONFIG_LVGL_PORT_EVENT_DRIVEN)
+
 /*******************************************************************************
 * Types definitions
 *******************************************************************************/
@@ -31,10 +34,18 @@ typedef struct lvgl_port_ctx_s {
     SemaphoreHandle_t   lvgl_mux;
     SemaphoreHandle_t   timer_mux;
     EventGroupHandle_t  lvgl_events;
+#if !LVGL_PORT_EVENT_DRIVEN
     esp_timer_handle_t  tick_timer;
+#endif
     bool                running;
+    bool                paused;         /* lvgl_port_stop() was called */
+    TaskHandle_t        stop_waiter;    /* lvgl_port_deinit() caller, notified when the task is gone */
     int                 task_max_sleep_ms;
     int                 timer_period_ms;
+    uint32_t            task_wakeups;   /* LVGL task loop iterations */
+#if !LVGL_PORT_EVENT_DRIVEN
+    uint32_t            tick_wakeups;   /* periodic tick callbacks */
+#endif
 } lvgl_port_ctx_t;
 
 /*******************************************************************************
@@ -48,6 +59,14 @@ static lvgl_port_ctx_t lvgl_port_ctx;
 static void lvgl_port_task(void *arg);
 static esp_err_t lvgl_port_tick_init(void);
 static void lvgl_port_task_deinit(void);
+#if LVGL_PORT_EVENT_DRIVEN
+static uint32_t lvgl_port_tick_get(void);
+static void lvgl_port_timer_resume(void *data);
+#endif
+#if CONFIG_LVGL_PORT_GLYPH_CACHE_PSRAM
+static void *lvgl_port_glyph_buf_malloc(size_t size, lv_color_format_t color_format);
+static void lvgl_port_glyph_buf_free(void *buf);
+#endif
 
 /*******************************************************************************
 * Public API functions
@@ -104,10 +123,18 @@ esp_err_t lvgl_port_resume(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
 
+#if LVGL_PORT_EVENT_DRIVEN
+    if (lvgl_port_ctx.running) {
+        lv_timer_enable(true);
+        lvgl_port_ctx.paused = false;
+        ret = lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
+    }
+#else
     if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(true);
         ret = esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_ctx.timer_period_ms * 1000);
     }
+#endif
 
     return ret;
 }
@@ -116,19 +143,50 @@ esp_err_t lvgl_port_stop(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
 
+#if LVGL_PORT_EVENT_DRIVEN
+    if (lvgl_port_ctx.running) {
+        lv_timer_enable(false);
+        lvgl_port_ctx.paused = true;
+        ret = ESP_OK;
+    }
+#else
     if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(false);
         ret = esp_timer_stop(lvgl_port_ctx.tick_timer);
     }
+#endif
 
     return ret;
 }
 
+uint32_t lvgl_port_get_wakeups(void)
+{
+#if LVGL_PORT_EVENT_DRIVEN
+    return lvgl_port_ctx.task_wakeups;
+#else
+    return lvgl_port_ctx.task_wakeups + lvgl_port_ctx.tick_wakeups;
+#endif
+}
+
 esp_err_t lvgl_port_deinit(void)
 {
     /* Stop running task */
     if (lvgl_port_ctx.running) {
+        if (xTaskGetCurrentTaskHandle() == lvgl_port_ctx.lvgl_task) {
+            /* Called from LVGL: the task ends after this iteration and cleans up itself */
+            lvgl_port_ctx.running = false;
+            return ESP_OK;
+        }
+        lvgl_port_ctx.stop_waiter = xTaskGetCurrentTaskHandle();
         lvgl_port_ctx.running = false;
+        /* The task may sleep without timeout (event driven, or stopped), wake it to see the flag */
+        lvgl_port_task_wake(LVGL_PORT_EVENT_USER, NULL);
+
+        /* The task leaves the cleanup to us once it is out of LVGL, so the event group is still valid above */
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5000)) == 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+        lvgl_port_task_deinit();
     }
 
     return ESP_OK;
@@ -206,6 +264,12 @@ static void lvgl_port_task(void *arg)
 
     /* LVGL init */
     lv_init();
+#if CONFIG_LVGL_PORT_GLYPH_CACHE_PSRAM
+    /* Cached glyph bitmaps in PSRAM, no glyph is drawn before this */
+    lv_draw_buf_handlers_t *glyph_handlers = lv_draw_buf_get_glyph_cache_handlers();
+    glyph_handlers->buf_malloc_cb = lvgl_port_glyph_buf_malloc;
+    glyph_handlers->buf_free_cb = lvgl_port_glyph_buf_free;
+#endif
     /* LVGL is initialized, notify lvgl_port_init() function about it */
     xTaskNotifyGive(task_to_notify);
     /* Tick init */
@@ -215,8 +279,19 @@ static void lvgl_port_task(void *arg)
     lvgl_port_ctx.running = true;
     while (lvgl_port_ctx.running) {
         /* Wait for queue or timeout (sleep task) */
+#if LVGL_PORT_EVENT_DRIVEN
+        /* Sleep until the next lv_timer deadline, rounded up so the timer is surely due when we wake */
+        TickType_t wait = (task_delay_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        if (task_delay_ms == LV_NO_TIMER_READY || lvgl_port_ctx.paused) {
+            wait = portMAX_DELAY;
+        } else if (wait < 1) {
+            wait = 1;
+        }
+#else
         TickType_t wait = (pdMS_TO_TICKS(task_delay_ms) >= 1 ? pdMS_TO_TICKS(task_delay_ms) : 1);
+#endif
         events = xEventGroupWaitBits(lvgl_port_ctx.lvgl_events, 0xFF, pdTRUE, pdFALSE, wait);
+        lvgl_port_ctx.task_wakeups++;
 
         if (lv_display_get_default() && lvgl_port_lock(0)) {
 
@@ -238,18 +313,25 @@ static void lvgl_port_task(void *arg)
             task_delay_ms = 1; /*Keep trying*/
         }
 
+#if !LVGL_PORT_EVENT_DRIVEN
         if (task_delay_ms == LV_NO_TIMER_READY) {
             task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
         }
 
         /* Minimal dealy for the task. When there is too much events, it takes time for other tasks and interrupts. */
         vTaskDelay(1);
+#endif
     }
 
     ESP_LOGI(TAG, "Stopped LVGL task");
 
-    /* Deinit LVGL */
-    lvgl_port_task_deinit();
+    if (lvgl_port_ctx.stop_waiter) {
+        /* lvgl_port_deinit() is waiting, it deinits LVGL */
+        xTaskNotifyGive(lvgl_port_ctx.stop_waiter);
+    } else {
+        /* Deinit LVGL */
+        lvgl_port_task_deinit();
+    }
 
     /* Close task */
     vTaskDelete( NULL );
@@ -257,12 +339,14 @@ static void lvgl_port_task(void *arg)
 
 static void lvgl_port_task_deinit(void)
 {
+#if !LVGL_PORT_EVENT_DRIVEN
     /* Stop and delete timer */
     if (lvgl_port_ctx.tick_timer != NULL) {
         esp_timer_stop(lvgl_port_ctx.tick_timer);
         esp_timer_delete(lvgl_port_ctx.tick_timer);
         lvgl_port_ctx.tick_timer = NULL;
     }
+#endif
 
     if (lvgl_port_ctx.timer_mux) {
         vSemaphoreDelete(lvgl_port_ctx.timer_mux);
@@ -280,16 +364,54 @@ static void lvgl_port_task_deinit(void)
 #endif
 }
 
+#if LVGL_PORT_EVENT_DRIVEN
+static uint32_t lvgl_port_tick_get(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void lvgl_port_timer_resume(void *data)
+{
+    /* The LVGL task recomputes its deadline after lv_timer_handler(), only wake it from other contexts */
+    if (xTaskGetCurrentTaskHandle() != lvgl_port_ctx.lvgl_task) {
+        lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
+    }
+}
+#endif
+
+#if CONFIG_LVGL_PORT_GLYPH_CACHE_PSRAM
+static void *lvgl_port_glyph_buf_malloc(size_t size, lv_color_format_t color_format)
+{
+    (void)color_format;
+    /* Same as LVGL's default: larger to be sure it can be aligned */
+    return heap_caps_malloc(size + LV_DRAW_BUF_ALIGN - 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+static void lvgl_port_glyph_buf_free(void *buf)
+{
+    heap_caps_free(buf);
+}
+#endif
+
+#if !LVGL_PORT_EVENT_DRIVEN
 static void lvgl_port_tick_increment(void *arg)
 {
+    lvgl_port_ctx.tick_wakeups++;
     xSemaphoreTake(lvgl_port_ctx.timer_mux, portMAX_DELAY);
     /* Tell LVGL how many milliseconds have elapsed */
     lv_tick_inc(lvgl_port_ctx.timer_period_ms);
     xSemaphoreGive(lvgl_port_ctx.timer_mux);
 }
+#endif
 
 static esp_err_t lvgl_port_tick_init(void)
 {
+#if LVGL_PORT_EVENT_DRIVEN
+    /* No periodic interrupt, LVGL asks for the time when it needs it */
+    lv_tick_set_cb(lvgl_port_tick_get);
+    lv_timer_handler_set_resume_cb(lvgl_port_timer_resume, NULL);
+    return ESP_OK;
+#else
     // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
     const esp_timer_create_args_t lvgl_tick_timer_args = {
         .callback = &lvgl_port_tick_increment,
@@ -297,4 +419,5 @@ static esp_err_t lvgl_port_tick_init(void)
     };
     ESP_RETURN_ON_ERROR(esp_timer_create(&lvgl_tick_timer_args, &lvgl_port_ctx.tick_timer), TAG, "Creating LVGL timer filed!");
     return esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_ctx.timer_period_ms * 1000);
+#endif
 }
@@ -18,6 +18,7 @@
 #include "esp_lcd_panel_ops.h"
 #include "esp_lvgl_port.h"
 #include "esp_lvgl_port_priv.h"
+#include "../common/convert/lcd_convert.h"
 
 #define LVGL_PORT_PPA   (CONFIG_LVGL_PORT_ENABLE_PPA)
 
@@ -55,11 +56,14 @@ typedef struct {
     esp_lcd_panel_handle_t    panel_handle;   /* LCD panel handle */
     esp_lcd_panel_handle_t    control_handle; /* LCD panel control handle */
     lvgl_port_rotation_cfg_t  rotation;       /* Default values of the screen rotation */
-    lv_color_t                *draw_buffs[3]; /* Display draw buffers */
+    lv_color_t                *draw_buffs[4]; /* Display draw buffers, [2] and [3] are SW rotation buffers */
     uint8_t                   *oled_buffer;
     lv_display_t              *disp_drv;      /* LVGL display driver */
     lv_display_rotation_t     current_rotation;
     SemaphoreHandle_t         trans_sem;      /* Idle transfer mutex */
+    SemaphoreHandle_t         conv_sem;       /* Free SW rotation buffers, LVGL continues while they are transferred */
+    uint8_t                   conv_idx;       /* SW rotation buffer for the next flush */
+    volatile uint8_t          conv_direct;    /* Transfer in progress is from LVGL buffer, not from a rotation buffer */
 #if LVGL_PORT_PPA
     lvgl_port_ppa_handle_t    ppa_handle;
 #endif //LVGL_PORT_PPA
@@ -221,10 +225,23 @@ esp_err_t lvgl_port_remove_disp(lv_display_t *disp)
         free(disp_ctx->draw_buffs[1]);
     }
 
+    if (disp_ctx->conv_sem) {
+        /* Wait for the transfers from the SW rotation buffers */
+        xSemaphoreTake(disp_ctx->conv_sem, pdMS_TO_TICKS(1000));
+        if (disp_ctx->draw_buffs[3]) {
+            xSemaphoreTake(disp_ctx->conv_sem, pdMS_TO_TICKS(1000));
+        }
+        vSemaphoreDelete(disp_ctx->conv_sem);
+    }
+
     if (disp_ctx->draw_buffs[2]) {
         free(disp_ctx->draw_buffs[2]);
     }
 
+    if (disp_ctx->draw_buffs[3]) {
+        free(disp_ctx->draw_buffs[3]);
+    }
+
     if (disp_ctx->oled_buffer) {
         free(disp_ctx->oled_buffer);
     }
@@ -384,6 +401,7 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
         lv_display_set_buffers(disp, buf1, buf2, buffer_size * color_bytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
     }
 
+    lv_display_set_flush_cost(disp, disp_cfg->flush_cost);
     lv_display_set_flush_cb(disp, lvgl_port_flush_callback);
     lv_display_add_event_cb(disp, lvgl_port_disp_size_update_callback, LV_EVENT_RESOLUTION_CHANGED, disp_ctx);
     lv_display_add_event_cb(disp, lvgl_port_display_invalidate_callback, LV_EVENT_INVALIDATE_AREA, disp_ctx);
@@ -417,6 +435,20 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
         disp_ctx->draw_buffs[2] = heap_caps_malloc(buffer_size * color_bytes, buff_caps);
         ESP_GOTO_ON_FALSE(disp_ctx->draw_buffs[2], ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (rotation buffer) allocation!");
 
+#if LVGL_PORT_HANDLE_FLUSH_READY
+        /* Panel IO displays: the transfer runs from the rotation buffer, so LVGL buffer is released right after the conversion.
+         * With double buffering, the second rotation buffer lets the next area convert while the previous one is in transfer. */
+        if (priv_cfg == NULL && !disp_cfg->monochrome) {
+            uint8_t conv_buffs = 1;
+            if (disp_cfg->double_buffer) {
+                disp_ctx->draw_buffs[3] = heap_caps_malloc(buffer_size * color_bytes, buff_caps);
+                ESP_GOTO_ON_FALSE(disp_ctx->draw_buffs[3], ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (rotation buffer) allocation!");
+                conv_buffs = 2;
+            }
+            disp_ctx->conv_sem = xSemaphoreCreateCounting(conv_buffs, conv_buffs);
+            ESP_GOTO_ON_FALSE(disp_ctx->conv_sem, ESP_ERR_NO_MEM, err, TAG, "Failed to create rotation buffers counting Semaphore");
+        }
+#endif
 #endif //LVGL_PORT_PPA
     }
 
@@ -432,6 +464,12 @@ err:
         if (disp_ctx->draw_buffs[2]) {
             free(disp_ctx->draw_buffs[2]);
         }
+        if (disp_ctx->draw_buffs[3]) {
+            free(disp_ctx->draw_buffs[3]);
+        }
+        if (disp_ctx->conv_sem) {
+            vSemaphoreDelete(disp_ctx->conv_sem);
+        }
         if (disp_ctx->oled_buffer) {
             free(disp_ctx->oled_buffer);
         }
@@ -451,6 +489,18 @@ static bool lvgl_port_flush_io_ready_callback(esp_lcd_panel_io_handle_t panel_io
 {
     lv_display_t *disp_drv = (lv_display_t *)user_ctx;
     assert(disp_drv != NULL);
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(disp_drv);
+
+    /* LVGL buffer was already released by the flush, only the rotation buffer is free now */
+    if (disp_ctx && disp_ctx->conv_sem && !disp_ctx->conv_direct) {
+        BaseType_t need_yield = pdFALSE;
+        xSemaphoreGiveFromISR(disp_ctx->conv_sem, &need_yield);
+        return (need_yield == pdTRUE);
+    }
+
+    if (disp_ctx) {
+        disp_ctx->conv_direct = 0;
+    }
     lv_disp_flush_ready(disp_drv);
     return false;
 }
@@ -505,7 +555,7 @@ static void _lvgl_port_transform_monochrome(lv_display_t *display, const lv_area
     assert(color_map);
     assert(*color_map);
     uint8_t *src = *color_map;
-    lv_color16_t *color = (lv_color16_t *)*color_map;
+    const uint16_t *color = (const uint16_t *)*color_map;
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(display);
     uint16_t hor_res = lv_display_get_physical_horizontal_resolution(display);
     uint16_t ver_res = lv_display_get_physical_vertical_resolution(display);
@@ -533,7 +583,12 @@ static void _lvgl_port_transform_monochrome(lv_display_t *display, const lv_area
             if (color_format == LV_COLOR_FORMAT_I1) {
                 chroma_color = (src[(hor_res >> 3) * y  + (x >> 3)] & 1 << (7 - x % 8));
             } else {
-                chroma_color = (color[hor_res * y + x].blue > 16);
+                /* Blue channel, the RGB565 byte swap is applied here instead of a separate pass over the buffer */
+                uint16_t c = color[hor_res * y + x];
+                if (disp_ctx->flags.swap_bytes) {
+                    c = (c >> 8) | (c << 8);
+                }
+                chroma_color = ((c & 0x1F) > 16);
             }
 
             if (swap_xy) {
@@ -610,6 +665,8 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
     int offsety2 = area->y2;
+    bool swapped = false;
+    bool released = false;
 
     /* SW rotation enabled */
     if (disp_ctx->flags.sw_rotate && (disp_ctx->current_rotation > LV_DISPLAY_ROTATION_0)) {
@@ -646,39 +703,89 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
             }
         }
 #else
-        /* SW rotation */
+        /* SW rotation, fused with the byte swap */
+        lv_color_format_t cf = lv_display_get_color_format(drv);
+        uint8_t px_size = lv_color_format_get_size(cf);
         if (disp_ctx->draw_buffs[2]) {
             int32_t ww = lv_area_get_width(area);
             int32_t hh = lv_area_get_height(area);
-            lv_color_format_t cf = lv_display_get_color_format(drv);
-            uint32_t w_stride = lv_draw_buf_width_to_stride(ww, cf);
-            uint32_t h_stride = lv_draw_buf_width_to_stride(hh, cf);
-            if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_180) {
-                lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], hh, ww, h_stride, h_stride, LV_DISPLAY_ROTATION_180, cf);
-            } else if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_90) {
-                lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], ww, hh, w_stride, h_stride, LV_DISPLAY_ROTATION_90, cf);
-            } else if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_270) {
-                lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], ww, hh, w_stride, h_stride, LV_DISPLAY_ROTATION_270, cf);
+            bool swap_xy = (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_90 || disp_ctx->current_rotation == LV_DISPLAY_ROTATION_270);
+            uint8_t *conv_buff = (uint8_t *)disp_ctx->draw_buffs[2];
+
+            if (disp_ctx->conv_sem) {
+                /* Wait until the rotation buffer is not transferred anymore */
+                xSemaphoreTake(disp_ctx->conv_sem, portMAX_DELAY);
+                if (disp_ctx->draw_buffs[3]) {
+                    conv_buff = (uint8_t *)disp_ctx->draw_buffs[2 + disp_ctx->conv_idx];
+                    disp_ctx->conv_idx ^= 1;
+                }
+            }
+
+            const lvgl_port_convert_cfg_t conv_cfg = {
+                .src = color_map,
+                .dst = conv_buff,
+                .w = ww,
+                .h = hh,
+                .src_stride = lv_draw_buf_width_to_stride(ww, cf),
+                .dst_stride = lv_draw_buf_width_to_stride(swap_xy ? hh : ww, cf),
+                .px_size = px_size,
+                .rotation = (lvgl_port_convert_rotation_t)disp_ctx->current_rotation,
+                .swap_bytes = (disp_ctx->flags.swap_bytes && !disp_ctx->flags.monochrome),
+            };
+            if (lv_color_format_get_bpp(cf) >= 8) {
+                lvgl_port_convert(&conv_cfg);
+                swapped = conv_cfg.swap_bytes;
+            } else {
+                /* Packed pixels (I1, ...) are not handled by the converter, LVGL rotates the ones it supports */
+                lv_draw_sw_rotate(color_map, conv_buff, ww, hh, conv_cfg.src_stride, conv_cfg.dst_stride,
+                                  disp_ctx->current_rotation, cf);
             }
-            color_map = (uint8_t *)disp_ctx->draw_buffs[2];
+
+            color_map = conv_buff;
             lvgl_port_rotate_area(drv, (lv_area_t *)area);
             offsetx1 = area->x1;
             offsetx2 = area->x2;
             offsety1 = area->y1;
             offsety2 = area->y2;
+
+            /* LVGL can render into its buffer again, the transfer runs from the rotation buffer */
+            released = (disp_ctx->conv_sem != NULL);
         }
 #endif //LVGL_PORT_PPA
     }
 
-    if (disp_ctx->flags.swap_bytes) {
-        size_t len = lv_area_get_size(area);
-        lv_draw_sw_rgb565_swap(color_map, len);
+    /* Byte swap in place, monochrome displays swap while converting to 1 bit */
+    if (disp_ctx->flags.swap_bytes && !swapped && !disp_ctx->flags.monochrome) {
+        int32_t len = lv_area_get_size(area);
+        const lvgl_port_convert_cfg_t conv_cfg = {
+            .src = color_map,
+            .dst = color_map,
+            .w = len,
+            .h = 1,
+            .src_stride = len * 2,
+            .dst_stride = len * 2,
+            .px_size = 2,
+            .rotation = LVGL_PORT_CONVERT_ROTATION_0,
+            .swap_bytes = true,
+        };
+        lvgl_port_convert(&conv_cfg);
     }
     /* Transfer data in buffer for monochromatic screen */
     if (disp_ctx->flags.monochrome) {
         _lvgl_port_transform_monochrome(drv, area, &color_map);
     }
 
+    if (disp_ctx->conv_sem && !released) {
+        /* Not rotated: wait for the transfers from the rotation buffers, this transfer releases LVGL buffer when done */
+        xSemaphoreTake(disp_ctx->conv_sem, portMAX_DELAY);
+        if (disp_ctx->draw_buffs[3]) {
+            xSemaphoreTake(disp_ctx->conv_sem, portMAX_DELAY);
+            xSemaphoreGive(disp_ctx->conv_sem);
+        }
+        xSemaphoreGive(disp_ctx->conv_sem);
+        disp_ctx->conv_direct = 1;
+    }
+
     if ((disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI) && (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh)) {
         if (lv_disp_flush_is_last(drv)) {
             /* If the interface is I80 or SPI, this step cannot be used for drawing. */
@@ -691,7 +798,7 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
         esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
     }
 
-    if (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI && (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh))) {
+    if (released || disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI && (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh))) {
         lv_disp_flush_ready(drv);
     }
 }
@@ -0,0 +1,332 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Functionality and benchmark tests of the fused flush conversion (src/common/convert/lcd_convert.c)
+// The reference is the previous flush path: LVGL's per pixel rotation into a second buffer, followed
+// by a separate byte swap pass over the whole area.
+// The file is built by this test app and by the host test app (../../simd_host).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "unity.h"
+#include "lcd_convert.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#define BENCH_UNIT          "pixels per ns"
+#else
+#include "freertos/FreeRTOS.h"  // for xthal_get_ccount()
+#define BENCH_UNIT          "pixels per cycle"
+#endif
+
+// ------------------------------------------------- Defines -----------------------------------------------------------
+
+#define FUNC_MAX_W          37
+#define FUNC_MAX_H          37
+#define FUNC_STEP           3       // Width / height step of the functionality sweep
+#define FUNC_STRIDE_PAD     6       // Extra bytes at the end of the rows, must stay untouched
+
+#define BENCH_CYCLES        20
+#define BENCH_MAX_PX        (320 * 48)
+
+// ------------------------------------------------ Static variables ---------------------------------------------------
+
+static const char *rotation_name[] = {"0", "90", "180", "270"};
+static uint32_t rand_state = 7;
+
+// ------------------------------------------------ Reference (LVGL 9.4 lv_draw_sw_rotate + lv_draw_sw_rgb565_swap) ------
+
+static inline void ref_copy_px(uint8_t *dst, const uint8_t *src, uint8_t px_size)
+{
+    if (px_size == 2) {
+        *(uint16_t *)dst = *(const uint16_t *)src;
+        return;
+    }
+    for (uint8_t i = 0; i < px_size; i++) {
+        dst[i] = src[i];
+    }
+}
+
+static inline void ref_rotate_px(const lvgl_port_convert_cfg_t *cfg, int32_t x, int32_t y)
+{
+    const uint8_t px = cfg->px_size;
+    int32_t dx = x;
+    int32_t dy = y;
+
+    switch (cfg->rotation) {
+    case LVGL_PORT_CONVERT_ROTATION_0:
+        break;
+    case LVGL_PORT_CONVERT_ROTATION_90:
+        dx = y;
+        dy = cfg->w - 1 - x;
+        break;
+    case LVGL_PORT_CONVERT_ROTATION_180:
+        dx = cfg->w - 1 - x;
+        dy = cfg->h - 1 - y;
+        break;
+    case LVGL_PORT_CONVERT_ROTATION_270:
+        dx = cfg->h - 1 - y;
+        dy = x;
+        break;
+    }
+    ref_copy_px((uint8_t *)cfg->dst + dy * cfg->dst_stride + dx * px, (const uint8_t *)cfg->src + y * cfg->src_stride + x * px, px);
+}
+
+static void ref_rotate(const lvgl_port_convert_cfg_t *cfg)
+{
+    if (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_90 || cfg->rotation == LVGL_PORT_CONVERT_ROTATION_270) {
+        // Same loop order as LVGL: one source column after another
+        for (int32_t x = 0; x < cfg->w; x++) {
+            for (int32_t y = 0; y < cfg->h; y++) {
+                ref_rotate_px(cfg, x, y);
+            }
+        }
+    } else {
+        for (int32_t y = 0; y < cfg->h; y++) {
+            for (int32_t x = 0; x < cfg->w; x++) {
+                ref_rotate_px(cfg, x, y);
+            }
+        }
+    }
+}
+
+static void ref_swap(const lvgl_port_convert_cfg_t *cfg)
+{
+    const int32_t rows = (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_90 || cfg->rotation == LVGL_PORT_CONVERT_ROTATION_270) ? cfg->w : cfg->h;
+    const int32_t cols = (cfg->rotation == LVGL_PORT_CONVERT_ROTATION_90 || cfg->rotation == LVGL_PORT_CONVERT_ROTATION_270) ? cfg->h : cfg->w;
+
+    for (int32_t y = 0; y < rows; y++) {
+        uint16_t *d = (uint16_t *)((uint8_t *)cfg->dst + y * cfg->dst_stride);
+        for (int32_t x = 0; x < cols; x++) {
+            d[x] = (uint16_t)((d[x] >> 8) | (d[x] << 8));
+        }
+    }
+}
+
+static void ref_convert(const lvgl_port_convert_cfg_t *cfg)
+{
+    ref_rotate(cfg);
+    if (cfg->swap_bytes) {
+        ref_swap(cfg);
+    }
+}
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+static void functionality_test(uint8_t px_size);
+static void benchmark_test(lvgl_port_convert_rotation_t rotation);
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+TEST_CASE("LV Flush convert functionality RGB565", "[flush][functionality][RGB565]")
+{
+    functionality_test(2);
+}
+
+TEST_CASE("LV Flush convert functionality L8", "[flush][functionality][L8]")
+{
+    functionality_test(1);
+}
+
+TEST_CASE("LV Flush convert functionality RGB888 and ARGB8888", "[flush][functionality][RGB888]")
+{
+    functionality_test(3);
+    functionality_test(4);
+}
+
+TEST_CASE("LV Flush convert benchmark RGB565 rotation 90", "[flush][benchmark][RGB565]")
+{
+    benchmark_test(LVGL_PORT_CONVERT_ROTATION_90);
+}
+
+TEST_CASE("LV Flush convert benchmark RGB565 rotation 180", "[flush][benchmark][RGB565]")
+{
+    benchmark_test(LVGL_PORT_CONVERT_ROTATION_180);
+}
+
+TEST_CASE("LV Flush convert benchmark RGB565 rotation 270", "[flush][benchmark][RGB565]")
+{
+    benchmark_test(LVGL_PORT_CONVERT_ROTATION_270);
+}
+
+// ------------------------------------------------ Static test functions ----------------------------------------------
+
+static uint32_t test_rand(void)
+{
+    rand_state = rand_state * 1103515245 + 12345;
+    return rand_state >> 8;
+}
+
+static void fill_random(uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)test_rand();
+    }
+}
+
+static void functionality_test(uint8_t px_size)
+{
+    const size_t max_dim = (FUNC_MAX_W > FUNC_MAX_H) ? FUNC_MAX_W : FUNC_MAX_H;
+    const size_t buf_len = (max_dim * px_size + FUNC_STRIDE_PAD) * max_dim + 4;
+    uint8_t *src_buf = malloc(buf_len);
+    uint8_t *ref_buf = malloc(buf_len);
+    uint8_t *dut_buf = malloc(buf_len);
+    TEST_ASSERT_NOT_NULL(src_buf);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+    TEST_ASSERT_NOT_NULL(dut_buf);
+
+    uint32_t combinations = 0;
+    fill_random(src_buf, buf_len);
+
+    for (int rot = LVGL_PORT_CONVERT_ROTATION_0; rot <= LVGL_PORT_CONVERT_ROTATION_270; rot++) {
+        for (int swap = 0; swap <= (px_size == 2 ? 1 : 0); swap++) {
+            for (int32_t w = 1; w <= FUNC_MAX_W; w += FUNC_STEP) {
+                for (int32_t h = 1; h <= FUNC_MAX_H; h += FUNC_STEP) {
+                    for (uint32_t src_off = 0; src_off <= 2; src_off += 2) {
+                        for (uint32_t dst_off = 0; dst_off <= 2; dst_off += 2) {
+                            const bool swap_xy = (rot == LVGL_PORT_CONVERT_ROTATION_90 || rot == LVGL_PORT_CONVERT_ROTATION_270);
+                            const uint32_t dst_w = swap_xy ? h : w;
+                            const uint32_t dst_h = swap_xy ? w : h;
+                            const uint32_t dst_stride = dst_w * px_size + FUNC_STRIDE_PAD;
+                            const size_t dst_len = dst_stride * dst_h + dst_off;
+
+                            lvgl_port_convert_cfg_t cfg = {
+                                .src = src_buf + src_off,
+                                .w = w,
+                                .h = h,
+                                .src_stride = w * px_size + FUNC_STRIDE_PAD,
+                                .dst_stride = dst_stride,
+                                .px_size = px_size,
+                                .rotation = rot,
+                                .swap_bytes = swap,
+                            };
+
+                            memset(ref_buf, 0xA5, dst_len);
+                            memset(dut_buf, 0xA5, dst_len);
+
+                            cfg.dst = ref_buf + dst_off;
+                            ref_convert(&cfg);
+                            cfg.dst = dut_buf + dst_off;
+                            lvgl_port_convert(&cfg);
+
+                            TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(ref_buf, dut_buf, dst_len, rotation_name[rot]);
+                            combinations++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Rotation 0 with byte swap runs in place, in LVGL's draw buffer
+    for (int32_t w = 1; w <= FUNC_MAX_W && px_size == 2; w += FUNC_STEP) {
+        for (uint32_t off = 0; off <= 2; off += 2) {
+            lvgl_port_convert_cfg_t cfg = {
+                .src = src_buf + off,
+                .dst = ref_buf + off,
+                .w = w,
+                .h = 3,
+                .src_stride = w * 2 + FUNC_STRIDE_PAD,
+                .dst_stride = w * 2 + FUNC_STRIDE_PAD,
+                .px_size = 2,
+                .rotation = LVGL_PORT_CONVERT_ROTATION_0,
+                .swap_bytes = true,
+            };
+            const size_t len = cfg.dst_stride * cfg.h + off;
+            memcpy(ref_buf, src_buf, len);
+            ref_convert(&cfg);
+            memcpy(dut_buf, src_buf, len);
+            cfg.src = dut_buf + off;
+            cfg.dst = dut_buf + off;
+            lvgl_port_convert(&cfg);
+
+            TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(ref_buf, dut_buf, len, "in place");
+            combinations++;
+        }
+    }
+
+    printf("Flush convert, %d byte pixels, test combinations: %" PRIu32 "\n", px_size, combinations);
+
+    free(src_buf);
+    free(ref_buf);
+    free(dut_buf);
+}
+
+static uint32_t get_cycles(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    // No cycle counter on the host, nanoseconds are used instead
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#else
+    return xthal_get_ccount();
+#endif
+}
+
+static float bench_run(void (*func)(const lvgl_port_convert_cfg_t *), const lvgl_port_convert_cfg_t *cfg)
+{
+    uint32_t total = 0;
+    for (int i = 0; i < BENCH_CYCLES; i++) {
+        uint32_t start = get_cycles();
+        func(cfg);
+        total += get_cycles() - start;
+    }
+    return (float)(cfg->w * cfg->h) * BENCH_CYCLES / (float)total;
+}
+
+static void benchmark_test(lvgl_port_convert_rotation_t rotation)
+{
+    // Typical flushed areas: small widgets, partial buffer bands of 240x320 and 320x480 panels
+    static const struct {
+        int32_t w;
+        int32_t h;
+    } areas[] = {
+        {32, 32},
+        {64, 64},
+        {128, 40},
+        {240, 32},
+        {320, 48},
+    };
+
+    uint8_t *src_buf = malloc(BENCH_MAX_PX * 2);
+    uint8_t *dst_buf = malloc(BENCH_MAX_PX * 2);
+    TEST_ASSERT_NOT_NULL(src_buf);
+    TEST_ASSERT_NOT_NULL(dst_buf);
+    fill_random(src_buf, BENCH_MAX_PX * 2);
+
+    printf("\nRGB565 flush conversion, rotation %s, %s\n", rotation_name[rotation], BENCH_UNIT);
+    printf("| Area     | Swap | Rotate + swap pass | Fused    | Speedup |\n");
+    printf("| :------- | :--- | :----------------- | :------- | :------ |\n");
+
+    for (size_t a = 0; a < sizeof(areas) / sizeof(areas[0]); a++) {
+        for (int swap = 0; swap <= 1; swap++) {
+            const bool swap_xy = (rotation == LVGL_PORT_CONVERT_ROTATION_90 || rotation == LVGL_PORT_CONVERT_ROTATION_270);
+            const lvgl_port_convert_cfg_t cfg = {
+                .src = src_buf,
+                .dst = dst_buf,
+                .w = areas[a].w,
+                .h = areas[a].h,
+                .src_stride = areas[a].w * 2,
+                .dst_stride = (swap_xy ? areas[a].h : areas[a].w) * 2,
+                .px_size = 2,
+                .rotation = rotation,
+                .swap_bytes = swap,
+            };
+            float ref_px = bench_run(ref_convert, &cfg);
+            float dut_px = bench_run(lvgl_port_convert, &cfg);
+            char area_str[16];
+            snprintf(area_str, sizeof(area_str), "%" PRIi32 "x%" PRIi32, areas[a].w, areas[a].h);
+            printf("| %-8s | %-4s | %-18.3f | %-8.3f | %-7.2f |\n", area_str, swap ? "yes" : "no", ref_px, dut_px, dut_px / ref_px);
+        }
+    }
+
+    free(src_buf);
+    free(dst_buf);
+}
@@ -0,0 +1,425 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Functionality and benchmark tests of the C blend to RGB565 kernels (lv_blend_to_rgb565_c.c)
+// The file is built by this test app and by the host test app (../../simd_host), so it only
+// depends on the kernels header and carries its own copy of the LVGL reference code.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "sdkconfig.h"
+#include "unity.h"
+#include "esp_lvgl_port_blend_kernels.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <time.h>
+#define BENCH_UNIT          "pixels per ns"
+#else
+#include "freertos/FreeRTOS.h"  // for xthal_get_ccount()
+#define BENCH_UNIT          "pixels per cycle"
+#endif
+
+// ------------------------------------------------- Defines -----------------------------------------------------------
+
+#define OPA_MAX             253
+#define OPA_MIX2(a1, a2)    ((uint8_t)(((int32_t)(a1) * (a2)) >> 8))
+#define OPA_MIX3(a1, a2, a3) ((uint8_t)(((int32_t)(a1) * (a2) * (a3)) >> 16))
+
+#define FUNC_MAX_W          33
+#define FUNC_MAX_H          3
+#define FUNC_STRIDE_PAD     6       // Extra bytes at the end of the rows, must stay untouched
+#define FUNC_UNALIGN_MAX    4       // Bytes of source and destination unalignment
+
+#define BENCH_DIM           128
+#define BENCH_CYCLES        20
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+typedef enum {
+    KERNEL_RGB565,
+    KERNEL_RGB565_SWAPPED,
+    KERNEL_ARGB8888,
+} kernel_src_t;
+
+typedef void (*ref_func_t)(asm_dsc_t *dsc);
+typedef int (*kernel_func_t)(asm_dsc_t *dsc);
+
+// ------------------------------------------------ Static variables ---------------------------------------------------
+
+static const uint8_t test_opa[] = {0, 1, 3, 4, 5, 64, 127, 128, 200, 251, 252, 253, 254, 255};
+static uint32_t rand_state = 1;
+
+// ------------------------------------------------ Reference (LVGL 9.4 lv_draw_sw_blend_to_rgb565.c) -------------------
+
+static uint16_t ref_color_16_16_mix(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    if (mix == 255) {
+        return c1;
+    }
+    if (mix == 0) {
+        return c2;
+    }
+    if (c1 == c2) {
+        return c1;
+    }
+
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)(result >> 16) | result;
+}
+
+static uint16_t ref_color_24_16_mix(const uint8_t *c1, uint16_t c2, uint8_t mix)
+{
+    if (mix == 0) {
+        return c2;
+    } else if (mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    } else {
+        uint8_t mix_inv = 255 - mix;
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+static inline uint16_t ref_swap_16(uint16_t c)
+{
+    return (c >> 8) | (c << 8);
+}
+
+static void ref_rgb565_blend(asm_dsc_t *dsc, int swap)
+{
+    uint16_t *dst = dsc->dst_buf;
+    const uint16_t *src = dsc->src_buf;
+    const uint8_t *mask = dsc->mask_buf;
+    uint8_t opa = dsc->opa;
+
+    for (uint32_t y = 0; y < dsc->dst_h; y++) {
+        for (uint32_t x = 0; x < dsc->dst_w; x++) {
+            uint16_t s = swap ? ref_swap_16(src[x]) : src[x];
+            if (mask == NULL && opa >= OPA_MAX) {
+                dst[x] = s;
+            } else if (mask == NULL) {
+                dst[x] = ref_color_16_16_mix(s, dst[x], opa);
+            } else if (opa >= OPA_MAX) {
+                dst[x] = ref_color_16_16_mix(s, dst[x], mask[x]);
+            } else {
+                dst[x] = ref_color_16_16_mix(s, dst[x], OPA_MIX2(mask[x], opa));
+            }
+        }
+        dst = (uint16_t *)((uint8_t *)dst + dsc->dst_stride);
+        src = (const uint16_t *)((const uint8_t *)src + dsc->src_stride);
+        if (mask) {
+            mask += dsc->mask_stride;
+        }
+    }
+}
+
+static void ref_rgb565(asm_dsc_t *dsc)
+{
+    ref_rgb565_blend(dsc, 0);
+}
+
+static void ref_rgb565_swapped(asm_dsc_t *dsc)
+{
+    ref_rgb565_blend(dsc, 1);
+}
+
+static void ref_argb8888(asm_dsc_t *dsc)
+{
+    uint16_t *dst = dsc->dst_buf;
+    const uint8_t *src = dsc->src_buf;
+    const uint8_t *mask = dsc->mask_buf;
+    uint8_t opa = dsc->opa;
+
+    for (uint32_t y = 0; y < dsc->dst_h; y++) {
+        for (uint32_t x = 0; x < dsc->dst_w; x++) {
+            const uint8_t *s = &src[x * 4];
+            if (mask == NULL && opa >= OPA_MAX) {
+                dst[x] = ref_color_24_16_mix(s, dst[x], s[3]);
+            } else if (mask == NULL) {
+                dst[x] = ref_color_24_16_mix(s, dst[x], OPA_MIX2(s[3], opa));
+            } else if (opa >= OPA_MAX) {
+                dst[x] = ref_color_24_16_mix(s, dst[x], OPA_MIX2(s[3], mask[x]));
+            } else {
+                dst[x] = ref_color_24_16_mix(s, dst[x], OPA_MIX3(s[3], mask[x], opa));
+            }
+        }
+        dst = (uint16_t *)((uint8_t *)dst + dsc->dst_stride);
+        src += dsc->src_stride;
+        if (mask) {
+            mask += dsc->mask_stride;
+        }
+    }
+}
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+/**
+ * @brief Kernel under test for the source format and the mask / opa combination, like esp_lvgl_port_lv_blend.h maps it
+ */
+static kernel_func_t get_kernel(kernel_src_t src, int masked, uint8_t opa);
+
+/**
+ * @brief Compare the kernel with the reference for all sizes, unalignments, opacities and with / without mask
+ */
+static void functionality_test(kernel_src_t src);
+
+/**
+ * @brief Print the pixels per cycle of the reference and of the kernel on a 128x128 area
+ */
+static void benchmark_test(kernel_src_t src, const char *name);
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+TEST_CASE("LV Image functionality RGB565 opa and mask blend to RGB565", "[image][functionality][RGB565]")
+{
+    functionality_test(KERNEL_RGB565);
+}
+
+TEST_CASE("LV Image functionality RGB565 swapped blend to RGB565", "[image][functionality][RGB565]")
+{
+    functionality_test(KERNEL_RGB565_SWAPPED);
+}
+
+TEST_CASE("LV Image functionality ARGB8888 blend to RGB565", "[image][functionality][ARGB8888]")
+{
+    functionality_test(KERNEL_ARGB8888);
+}
+
+TEST_CASE("LV Image benchmark RGB565 opa and mask blend to RGB565", "[image][benchmark][RGB565]")
+{
+    benchmark_test(KERNEL_RGB565, "RGB565 -> RGB565");
+}
+
+TEST_CASE("LV Image benchmark RGB565 swapped blend to RGB565", "[image][benchmark][RGB565]")
+{
+    benchmark_test(KERNEL_RGB565_SWAPPED, "RGB565 swapped -> RGB565");
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 blend to RGB565", "[image][benchmark][ARGB8888]")
+{
+    benchmark_test(KERNEL_ARGB8888, "ARGB8888 -> RGB565");
+}
+
+// ------------------------------------------------ Static functions ---------------------------------------------------
+
+static uint32_t test_rand(void)
+{
+    rand_state = rand_state * 1103515245 + 12345;
+    return rand_state >> 8;
+}
+
+static void fill_random(uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)test_rand();
+    }
+}
+
+static void fill_mask(uint8_t *mask, size_t len)
+{
+    // Mostly fully transparent and fully opaque runs like anti-aliased shapes, with some edges
+    for (size_t i = 0; i < len; i++) {
+        uint32_t r = test_rand() % 8;
+        mask[i] = r < 3 ? 0x00 : r < 6 ? 0xFF : (uint8_t)test_rand();
+    }
+}
+
+static size_t src_px_size(kernel_src_t src)
+{
+    return src == KERNEL_ARGB8888 ? 4 : 2;
+}
+
+static ref_func_t get_ref(kernel_src_t src)
+{
+    switch (src) {
+    case KERNEL_RGB565:
+        return ref_rgb565;
+    case KERNEL_RGB565_SWAPPED:
+        return ref_rgb565_swapped;
+    default:
+        return ref_argb8888;
+    }
+}
+
+static kernel_func_t get_kernel(kernel_src_t src, int masked, uint8_t opa)
+{
+    switch (src) {
+    case KERNEL_RGB565:
+        if (masked) {
+            return lv_rgb565_blend_normal_to_rgb565_with_mask_esp;
+        }
+        // The full opacity copy is done by the lv_rgb565_blend_normal_to_rgb565_esp assembly kernel
+        return opa < OPA_MAX ? lv_rgb565_blend_normal_to_rgb565_with_opa_esp : NULL;
+    case KERNEL_RGB565_SWAPPED:
+        return lv_rgb565_swapped_blend_normal_to_rgb565_esp;
+    default:
+        return lv_argb8888_blend_normal_to_rgb565_esp;
+    }
+}
+
+static void functionality_test(kernel_src_t src)
+{
+    const size_t px_size = src_px_size(src);
+    const size_t dst_len = FUNC_MAX_H * (FUNC_MAX_W * 2 + FUNC_STRIDE_PAD) + FUNC_UNALIGN_MAX;
+    const size_t src_len = FUNC_MAX_H * (FUNC_MAX_W * px_size + FUNC_STRIDE_PAD) + FUNC_UNALIGN_MAX;
+    const size_t mask_len = FUNC_MAX_H * (FUNC_MAX_W + FUNC_STRIDE_PAD);
+
+    uint8_t *dst_ref = malloc(dst_len);
+    uint8_t *dst_dut = malloc(dst_len);
+    uint8_t *src_buf = malloc(src_len);
+    uint8_t *mask_buf = malloc(mask_len);
+    TEST_ASSERT_NOT_NULL(dst_ref);
+    TEST_ASSERT_NOT_NULL(dst_dut);
+    TEST_ASSERT_NOT_NULL(src_buf);
+    TEST_ASSERT_NOT_NULL(mask_buf);
+
+    const ref_func_t ref = get_ref(src);
+    uint32_t combinations = 0;
+    char msg[120];
+
+    for (uint32_t w = 1; w <= FUNC_MAX_W; w++) {
+        for (uint32_t h = 1; h <= FUNC_MAX_H; h++) {
+            // RGB565 stays 2-byte aligned, ARGB8888 source is read byte by byte
+            for (uint32_t dst_off = 0; dst_off < FUNC_UNALIGN_MAX; dst_off += 2) {
+                for (uint32_t src_off = 0; src_off < FUNC_UNALIGN_MAX; src_off += (px_size == 4 ? 1 : 2)) {
+                    for (int masked = 0; masked <= 1; masked++) {
+                        for (size_t o = 0; o < sizeof(test_opa); o++) {
+                            const kernel_func_t kernel = get_kernel(src, masked, test_opa[o]);
+                            if (kernel == NULL) {
+                                continue;
+                            }
+
+                            fill_random(dst_ref, dst_len);
+                            memcpy(dst_dut, dst_ref, dst_len);
+                            fill_random(src_buf, src_len);
+                            fill_mask(mask_buf, mask_len);
+
+                            asm_dsc_t dsc = {
+                                .opa = test_opa[o],
+                                .dst_buf = dst_ref + dst_off,
+                                .dst_w = w,
+                                .dst_h = h,
+                                .dst_stride = w * 2 + FUNC_STRIDE_PAD,
+                                .src_buf = src_buf + src_off,
+                                .src_stride = w * px_size + FUNC_STRIDE_PAD,
+                                .mask_buf = masked ? mask_buf : NULL,
+                                .mask_stride = w + FUNC_STRIDE_PAD,
+                            };
+                            ref(&dsc);
+                            dsc.dst_buf = dst_dut + dst_off;
+                            TEST_ASSERT_EQUAL(1, kernel(&dsc));
+
+                            snprintf(msg, sizeof(msg), "w %"PRIu32" h %"PRIu32" dst_off %"PRIu32" src_off %"PRIu32" mask %d opa %u",
+                                     w, h, dst_off, src_off, masked, test_opa[o]);
+                            TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(dst_ref, dst_dut, dst_len, msg);
+                            combinations++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    printf("Test combinations: %"PRIu32"\n", combinations);
+
+    free(dst_ref);
+    free(dst_dut);
+    free(src_buf);
+    free(mask_buf);
+}
+
+static uint32_t get_cycles(void)
+{
+#if CONFIG_IDF_TARGET_LINUX
+    // No cycle counter on the host, nanoseconds are used instead
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#else
+    return xthal_get_ccount();
+#endif
+}
+
+static float bench_run(void (*func)(asm_dsc_t *), kernel_func_t kernel, asm_dsc_t *dsc, uint8_t *dst, const uint8_t *dst_init, size_t dst_len)
+{
+    uint32_t total = 0;
+    for (int i = 0; i < BENCH_CYCLES; i++) {
+        memcpy(dst, dst_init, dst_len);
+        uint32_t start = get_cycles();
+        if (func) {
+            func(dsc);
+        } else {
+            kernel(dsc);
+        }
+        total += get_cycles() - start;
+    }
+    return (float)(BENCH_DIM * BENCH_DIM) * BENCH_CYCLES / (float)total;
+}
+
+static void benchmark_test(kernel_src_t src, const char *name)
+{
+    static const struct {
+        const char *name;
+        int masked;
+        uint8_t opa;
+    } modes[] = {
+        {"opa 255", 0, 255},
+        {"opa 128", 0, 128},
+        {"mask", 1, 255},
+        {"mask + opa 128", 1, 128},
+    };
+
+    const size_t px_size = src_px_size(src);
+    const size_t dst_len = BENCH_DIM * BENCH_DIM * 2;
+    uint8_t *dst = malloc(dst_len);
+    uint8_t *dst_init = malloc(dst_len);
+    uint8_t *src_buf = malloc(BENCH_DIM * BENCH_DIM * px_size);
+    uint8_t *mask_buf = malloc(BENCH_DIM * BENCH_DIM);
+    TEST_ASSERT_NOT_NULL(dst);
+    TEST_ASSERT_NOT_NULL(dst_init);
+    TEST_ASSERT_NOT_NULL(src_buf);
+    TEST_ASSERT_NOT_NULL(mask_buf);
+
+    fill_random(dst_init, dst_len);
+    fill_random(src_buf, BENCH_DIM * BENCH_DIM * px_size);
+    fill_mask(mask_buf, BENCH_DIM * BENCH_DIM);
+
+    printf("\n%s, %dx%d, %s\n", name, BENCH_DIM, BENCH_DIM, BENCH_UNIT);
+    printf("| Mode             | C reference | Kernel   | Speedup |\n");
+    printf("| :--------------- | :---------- | :------- | :------ |\n");
+
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        const kernel_func_t kernel = get_kernel(src, modes[m].masked, modes[m].opa);
+        if (kernel == NULL) {
+            continue;
+        }
+        asm_dsc_t dsc = {
+            .opa = modes[m].opa,
+            .dst_buf = dst,
+            .dst_w = BENCH_DIM,
+            .dst_h = BENCH_DIM,
+            .dst_stride = BENCH_DIM * 2,
+            .src_buf = src_buf,
+            .src_stride = BENCH_DIM * px_size,
+            .mask_buf = modes[m].masked ? mask_buf : NULL,
+            .mask_stride = BENCH_DIM,
+        };
+        float ref_px = bench_run(get_ref(src), NULL, &dsc, dst, dst_init, dst_len);
+        float dut_px = bench_run(NULL, kernel, &dsc, dst, dst_init, dst_len);
+        printf("| %-16s | %-11.3f | %-8.3f | %-7.2f |\n", modes[m].name, ref_px, dut_px, dut_px / ref_px);
+    }
+
+    free(dst);
+    free(dst_init);
+    free(src_buf);
+    free(mask_buf);
+}
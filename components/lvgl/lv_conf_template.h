@@ -81,8 +81,31 @@
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
+
+    /** Size of a second pool only for the allocations of at least `LV_MEM_LARGE_THRESHOLD` bytes
+     *  (draw buffers, decoded images, caches) in bytes. Freed large buffers are not split by
+     *  small objects this way, so the pools fragment much less. The pools are each other's reserve.
+     *  0: one pool for all allocations. */
+    #define LV_MEM_LARGE_SIZE 0
+    #if LV_MEM_LARGE_SIZE
+        #define LV_MEM_LARGE_THRESHOLD 2048     /**< [bytes] */
+        /* A memory allocator to get the large pool, e.g. from external RAM. Else it's an array with `LV_ATTRIBUTE_LARGE_RAM_ARRAY` */
+        #undef LV_MEM_LARGE_POOL_ALLOC
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** Allocate the widgets, their local styles and special attributes, the event descriptors,
+ *  timers and animations from pools of same-size blocks (slabs) instead of one by one with `lv_malloc()`.
+ *  Creating and deleting screens gets faster and the small objects don't fragment the heap.
+ *  The unused chunks can be given back with `lv_slab_trim_all()`. */
+#define LV_USE_SLAB 0
+#if LV_USE_SLAB
+    /** Number of blocks allocated at once by a slab */
+    #define LV_SLAB_BLOCK_CNT 16
+    /** Number of different widget instance sizes with their own slab. The others use `lv_malloc()` */
+    #define LV_SLAB_OBJ_SIZE_CNT 16
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -194,6 +217,23 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** Pin the SW draw threads to CPU cores (if the OS layer supports it).
+     *  Thread `i` runs on core `(LV_DRAW_SW_THREAD_FIRST_CORE + i) % core count`. */
+    #define LV_DRAW_SW_THREAD_PIN           0
+    #define LV_DRAW_SW_THREAD_FIRST_CORE    0
+
+    /** Priority of the SW draw threads. */
+    #define LV_DRAW_SW_THREAD_PRIO      LV_DRAW_THREAD_PRIO
+
+    /** When a draw thread is free, look at up to this many available tasks and take the
+     *  one closest to the area the thread rendered last (keeps its cache warm).
+     *  0: take the first available task. */
+    #define LV_DRAW_SW_LOCALITY_LOOKAHEAD   0
+
+    /** Collect per draw thread task, pixel, busy and idle statistics.
+     *  See `lv_draw_sw_get_thread_stats()`. */
+    #define LV_DRAW_SW_STATS            0
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -503,6 +543,12 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Default glyph cache size in bytes. The glyphs of the built-in and BIN fonts are decoded to A8
+ *  on every draw. The glyph cache keeps the decoded bitmaps of the recently drawn glyphs.
+ *  Each glyph needs its A8 bitmap (box width rounded up to the stride x box height) + ~40 bytes.
+ *  0: disable the glyph cache. */
+#define LV_GLYPH_CACHE_DEF_SIZE 0
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -518,6 +564,10 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Number of entries (power of 2) in a global cache of resolved style values returned by
+ *  `lv_obj_get_style_prop()`. Each entry takes 16 bytes on 32-bit targets. 0: disable */
+#define LV_OBJ_STYLE_VALUE_CACHE 0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -849,6 +899,11 @@
 /** A layout similar to Grid in CSS. */
 #define LV_USE_GRID 1
 
+/** Flex and grid containers with at least this many children keep the sizes and tracks of their last update.
+ *  When only some children change, only those and the items after them in the same track are placed again.
+ *  Costs about 32 bytes per child for flex and 8 bytes per track for grid. 0: disable. */
+#define LV_LAYOUT_CACHE_MIN_CHILDREN 0
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -21,6 +21,7 @@ extern "C" {
 #include "src/misc/cache/lv_cache.h"
 #include "src/misc/cache/lv_cache_entry_private.h"
 #include "src/misc/cache/lv_cache_private.h"
+#include "src/misc/cache/instance/lv_glyph_cache_private.h"
 #include "src/layouts/lv_layout_private.h"
 #include "src/stdlib/lv_mem_private.h"
 #include "src/others/file_explorer/lv_file_explorer_private.h"
@@ -67,6 +68,7 @@ extern "C" {
 #include "src/misc/lv_style_private.h"
 #include "src/misc/lv_color_op_private.h"
 #include "src/misc/lv_anim_private.h"
+#include "src/misc/lv_slab_private.h"
 #include "src/widgets/msgbox/lv_msgbox_private.h"
 #include "src/widgets/buttonmatrix/lv_buttonmatrix_private.h"
 #include "src/widgets/slider/lv_slider_private.h"
@@ -42,6 +42,7 @@ extern "C" {
 
 #include "../misc/lv_timer_private.h"
 #include "../misc/lv_anim_private.h"
+#include "../misc/lv_slab_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
 #include "../draw/lv_draw_private.h"
@@ -51,6 +52,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon_private.h"
 #include "../others/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
+#include "../core/lv_obj_style_private.h"
 
 /*********************
  *      DEFINES
@@ -98,6 +100,9 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_VALUE_CACHE
+    lv_obj_style_value_cache_t style_value_cache;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -116,6 +121,13 @@ typedef struct _lv_global_t {
     lv_event_t * event_header;
     uint32_t event_last_register_id;
 
+#if LV_USE_SLAB
+    lv_slab_t obj_slabs[LV_SLAB_OBJ_SIZE_CNT];  /**< Widgets by instance size, unused if `block_size == 0`*/
+    lv_slab_t spec_attr_slab;
+    lv_slab_t style_slab;                       /**< Local and transition styles*/
+    lv_slab_t event_dsc_slab;
+#endif
+
     lv_timer_state_t timer_state;
     lv_anim_state_t anim_state;
     lv_tick_state_t tick_state;
@@ -124,6 +136,7 @@ typedef struct _lv_global_t {
     lv_draw_buf_handlers_t font_draw_buf_handlers;
     lv_draw_buf_handlers_t image_cache_draw_buf_handlers;  /**< Ensure that all assigned draw buffers
                                                             * can be managed by image cache. */
+    lv_draw_buf_handlers_t glyph_cache_draw_buf_handlers;  /**< Draw buffers of the glyph cache */
 
     lv_ll_t img_decoder_ll;
 #if LV_USE_OS != LV_OS_NONE
@@ -133,6 +146,9 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_cache_t * glyph_cache;
+    uint32_t glyph_cache_lookup_cnt;
+    uint32_t glyph_cache_miss_cnt;
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
@@ -27,6 +27,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
@@ -278,7 +279,7 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
     }
 
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+        lv_obj_mark_layout_child_as_dirty(lv_obj_get_parent(obj), obj);
         lv_obj_mark_layout_as_dirty(obj);
     }
 
@@ -308,12 +309,12 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+        lv_obj_mark_layout_child_as_dirty(lv_obj_get_parent(obj), obj);
         lv_obj_mark_layout_as_dirty(obj);
     }
 
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
-        lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+        lv_obj_mark_layout_child_as_dirty(lv_obj_get_parent(obj), obj);
     }
 
 }
@@ -405,7 +406,11 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
+#if LV_USE_SLAB
+        obj->spec_attr = lv_slab_alloc_zeroed(&LV_GLOBAL_DEFAULT()->spec_attr_slab);
+#else
         obj->spec_attr = lv_malloc_zeroed(sizeof(lv_obj_spec_attr_t));
+#endif
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -626,7 +631,16 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 #endif
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+        lv_free(obj->spec_attr->layout_cache);
+        obj->spec_attr->layout_cache = NULL;
+#endif
+
+#if LV_USE_SLAB
+        lv_slab_free(&LV_GLOBAL_DEFAULT()->spec_attr_slab, obj->spec_attr);
+#else
         lv_free(obj->spec_attr);
+#endif
         obj->spec_attr = NULL;
     }
 
@@ -950,7 +964,9 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         int32_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
         uint16_t layout = lv_obj_get_style_layout(obj, LV_PART_MAIN);
         if(layout || align || w == LV_SIZE_CONTENT || h == LV_SIZE_CONTENT) {
-            lv_obj_mark_layout_as_dirty(obj);
+            lv_obj_t * child = lv_event_get_param(e);
+            if(child) lv_obj_mark_layout_child_as_dirty(obj, child);
+            else lv_obj_mark_layout_as_dirty(obj);
         }
     }
     else if(code == LV_EVENT_CHILD_DELETED) {
@@ -990,6 +1006,9 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
 
     lv_state_t prev_state = obj->state;
 
+    /*The children might inherit values from the new state*/
+    lv_obj_style_value_cache_invalidate();
+
     lv_style_state_cmp_t cmp_res = lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == LV_STYLE_STATE_CMP_SAME) {
@@ -8,10 +8,12 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_style_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../stdlib/lv_string.h"
+#include "../core/lv_global.h"
 
 /*********************
  *      DEFINES
@@ -31,6 +33,10 @@
  **********************/
 static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+static void * obj_alloc(uint32_t size);
+#if LV_USE_SLAB
+    static lv_slab_t * get_obj_slab(uint32_t size, bool add);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -48,18 +54,21 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
-    lv_obj_t * obj = lv_malloc_zeroed(s);
+    lv_obj_t * obj = obj_alloc(s);
     if(obj == NULL) return NULL;
     obj->class_p = class_p;
     obj->parent = parent;
 
+    /*A deleted object's entries could be found with the same address*/
+    lv_obj_style_value_cache_invalidate();
+
     /*Create a screen*/
     if(parent == NULL) {
         LV_TRACE_OBJ_CREATE("creating a screen");
         lv_display_t * disp = lv_display_get_default();
         if(!disp) {
             LV_LOG_WARN("No display created yet. No place to assign the new screen");
-            lv_free(obj);
+            lv_obj_class_free_obj(class_p, obj);
             return NULL;
         }
 
@@ -70,7 +79,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_obj_t ** screens = lv_realloc(disp->screens, sizeof(lv_obj_t *) * (disp->screen_cnt + 1));
         LV_ASSERT_MALLOC(screens);
         if(screens == NULL) {
-            lv_free(obj);
+            lv_obj_class_free_obj(class_p, obj);
             return NULL;
         }
 
@@ -101,6 +110,20 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
     return obj;
 }
 
+void lv_obj_class_free_obj(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+#if LV_USE_SLAB
+    lv_slab_t * slab = get_obj_slab(get_instance_size(class_p), false);
+    if(slab) {
+        lv_slab_free(slab, obj);
+        return;
+    }
+#else
+    LV_UNUSED(class_p);
+#endif
+    lv_free(obj);
+}
+
 void lv_obj_class_init_obj(lv_obj_t * obj)
 {
     if(obj == NULL) return;
@@ -202,3 +225,37 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 
     return base->instance_size;
 }
+
+static void * obj_alloc(uint32_t size)
+{
+#if LV_USE_SLAB
+    lv_slab_t * slab = get_obj_slab(size, true);
+    if(slab) return lv_slab_alloc_zeroed(slab);
+#endif
+    return lv_malloc_zeroed(size);
+}
+
+#if LV_USE_SLAB
+/**
+ * Get the slab of the objects of a given size. The widgets of the same size share a slab.
+ * @param size      instance size of the object
+ * @param add       true: take an unused slab if there is none for this size yet
+ * @return          pointer to the slab or NULL if all the `LV_SLAB_OBJ_SIZE_CNT` slabs are taken
+ */
+static lv_slab_t * get_obj_slab(uint32_t size, bool add)
+{
+    lv_slab_t * slabs = LV_GLOBAL_DEFAULT()->obj_slabs;
+    size = LV_ALIGN_UP(size, sizeof(void *));   /*As the block size of the slabs*/
+    uint32_t i;
+    for(i = 0; i < LV_SLAB_OBJ_SIZE_CNT; i++) {
+        if(slabs[i].block_size == size) return &slabs[i];
+        if(slabs[i].block_size == 0) {
+            if(!add) return NULL;
+            lv_slab_init(&slabs[i], size);
+            return &slabs[i];
+        }
+    }
+
+    return NULL;
+}
+#endif
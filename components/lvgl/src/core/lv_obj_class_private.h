@@ -67,6 +67,13 @@ struct _lv_obj_class_t {
 
 void lv_obj_destruct(lv_obj_t * obj);
 
+/**
+ * Free the memory of an object created by `lv_obj_class_create_obj()`.
+ * @param class_p   the class the object was created with (`obj->class_p` is changed by `lv_obj_destruct()`)
+ * @param obj       pointer to an object, already removed from the object tree
+ */
+void lv_obj_class_free_obj(const lv_obj_class_t * class_p, lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
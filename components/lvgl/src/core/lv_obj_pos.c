@@ -33,6 +33,8 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_layout_dirty(lv_obj_t * obj);
+static void mark_parents_child_layout_dirty(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
 
@@ -210,6 +212,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_parents_child_layout_dirty(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -293,15 +296,30 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
-    obj->layout_inv = 1;
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    if(obj->spec_attr && obj->spec_attr->layout_cache) obj->spec_attr->layout_cache->update_all = 1;
+#endif
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
-    scr->scr_layout_inv = 1;
+    mark_layout_dirty(obj);
+}
 
-    /*Make the display refreshing*/
-    lv_display_t * disp = lv_obj_get_display(scr);
-    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+void lv_obj_mark_layout_child_as_dirty(lv_obj_t * obj, lv_obj_t * child)
+{
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    lv_layout_cache_t * cache = obj->spec_attr ? obj->spec_attr->layout_cache : NULL;
+    if(cache && child && lv_obj_get_parent(child) == obj) {
+        int32_t id = lv_obj_get_index(child);
+        if(cache->dirty_first < 0 || id < cache->dirty_first) cache->dirty_first = id;
+        if(id > cache->dirty_last) cache->dirty_last = id;
+
+        mark_layout_dirty(obj);
+        return;
+    }
+#else
+    LV_UNUSED(child);
+#endif
+
+    lv_obj_mark_layout_as_dirty(obj);
 }
 
 void lv_obj_update_layout(const lv_obj_t * obj)
@@ -1235,11 +1253,17 @@ static int32_t calc_content_height(lv_obj_t * obj)
 
 static void layout_update_core(lv_obj_t * obj)
 {
+    /*Clear it first to see if a descendant is marked again during the update*/
+    obj->child_layout_inv = 0;
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+        /*Skip the subtrees where nothing was marked*/
+        if(child->layout_inv || child->child_layout_inv || child->readjust_scroll_after_layout) {
+            layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv) {
@@ -1258,6 +1282,33 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+static void mark_layout_dirty(lv_obj_t * obj)
+{
+    obj->layout_inv = 1;
+    mark_parents_child_layout_dirty(obj);
+
+    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    scr->scr_layout_inv = 1;
+
+    /*Make the display refreshing*/
+    lv_display_t * disp = lv_obj_get_display(scr);
+    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+
+/**
+ * Mark the path to an object, so `layout_update_core` will visit it.
+ * The parents of a marked object are marked too, so it can stop at the first marked one.
+ */
+static void mark_parents_child_layout_dirty(lv_obj_t * obj)
+{
+    lv_obj_t * parent = obj->parent;
+    while(parent && !parent->child_layout_inv) {
+        parent->child_layout_inv = 1;
+        parent = parent->parent;
+    }
+}
+
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
 {
 #if LV_DRAW_TRANSFORM_USE_MATRIX
@@ -153,6 +153,14 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj);
  */
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj);
 
+/**
+ * Mark the object for layout update because only one of its children changed.
+ * With `LV_LAYOUT_CACHE_MIN_CHILDREN` the layout can update only that child and the ones depending on it.
+ * @param obj      pointer to an object whose children need to be updated
+ * @param child    pointer to the changed child of `obj`
+ */
+void lv_obj_mark_layout_child_as_dirty(lv_obj_t * obj, lv_obj_t * child);
+
 /**
  * Update the layout of an object.
  * @param obj      pointer to an object whose position and size needs to be updated
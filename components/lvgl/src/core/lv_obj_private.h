@@ -35,6 +35,9 @@ struct _lv_obj_spec_attr_t {
     lv_matrix_t * matrix;           /**< The transform matrix*/
 #endif
     lv_event_list_t event_list;
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    lv_layout_cache_t * layout_cache;   /**< Result of the last layout update to update only the changed children*/
+#endif
 #if LV_USE_OBJ_NAME
     const char * name;              /**< Pointer to the name */
 #endif
@@ -69,6 +72,7 @@ struct _lv_obj_t {
     lv_obj_flag_t flags;
     uint16_t state;
     uint16_t layout_inv : 1;
+    uint16_t child_layout_inv : 1;  /**< A descendant needs layout update*/
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
@@ -23,6 +23,11 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define value_cache LV_GLOBAL_DEFAULT()->style_value_cache
+
+#if LV_OBJ_STYLE_VALUE_CACHE & (LV_OBJ_STYLE_VALUE_CACHE - 1)
+    #error "LV_OBJ_STYLE_VALUE_CACHE must be a power of 2"
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -60,6 +65,11 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+#if LV_OBJ_STYLE_VALUE_CACHE
+    static inline uint32_t value_cache_index(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop);
+#endif
+static lv_style_t * style_alloc(void);
+static void style_free(lv_style_t * style);
 
 /**********************
  *  STATIC VARIABLES
@@ -76,11 +86,21 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 void lv_obj_style_init(void)
 {
     lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+
+#if LV_OBJ_STYLE_VALUE_CACHE
+    value_cache.entries = lv_malloc_zeroed(LV_OBJ_STYLE_VALUE_CACHE * sizeof(lv_obj_style_value_cache_entry_t));
+    LV_ASSERT_MALLOC(value_cache.entries);
+    value_cache.gen = 1;
+#endif
 }
 
 void lv_obj_style_deinit(void)
 {
     lv_ll_clear(style_trans_ll_p);
+#if LV_OBJ_STYLE_VALUE_CACHE
+    lv_free(value_cache.entries);
+    value_cache.entries = NULL;
+#endif
     if(_style_custom_prop_flag_lookup_table != NULL) {
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
@@ -126,6 +146,7 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     lv_memzero(&obj->styles[i], sizeof(lv_obj_style_t));
     obj->styles[i].style = style;
     obj->styles[i].selector = selector;
+    lv_obj_style_value_cache_invalidate();
 
 #if LV_OBJ_STYLE_CACHE
     uint32_t * prop_is_set = part == LV_PART_MAIN ? &obj->style_main_prop_is_set : &obj->style_other_prop_is_set;
@@ -186,6 +207,7 @@ bool lv_obj_replace_style(lv_obj_t * obj, const lv_style_t * old_style, const lv
         /*Don't break and continue replacing other occurrences*/
     }
     if(replaced) {
+        lv_obj_style_value_cache_invalidate();
         full_cache_refresh(obj, part);
         lv_obj_refresh_style(obj, part, LV_STYLE_PROP_ANY);
     }
@@ -221,7 +243,7 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
 
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
             if(obj->styles[i].style) lv_style_reset((lv_style_t *)obj->styles[i].style);
-            lv_free((lv_style_t *)obj->styles[i].style);
+            style_free((lv_style_t *)obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
 
@@ -239,6 +261,8 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
          *Therefore it doesn't needs to be incremented*/
     }
 
+    if(deleted) lv_obj_style_value_cache_invalidate();
+
     if(deleted && prop != LV_STYLE_PROP_INV) {
         full_cache_refresh(obj, part);
         lv_obj_refresh_style(obj, part, prop);
@@ -252,6 +276,8 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    lv_obj_style_value_cache_invalidate();
+
     if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
@@ -268,6 +294,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    lv_obj_style_value_cache_invalidate();
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -290,7 +318,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
     }
     if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
         lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
+        if(parent) lv_obj_mark_layout_child_as_dirty(parent, obj);
     }
 
     /*Cache the layer type*/
@@ -321,6 +349,7 @@ void lv_obj_style_set_disabled(lv_obj_t * obj, const lv_style_t * style, lv_styl
                 return; /*Already in the right state*/
             }
             obj->styles[i].is_disabled = dis;
+            lv_obj_style_value_cache_invalidate();
             full_cache_refresh(obj, lv_obj_style_get_selector_part(selector));
             lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
             return;
@@ -348,6 +377,36 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+#if LV_OBJ_STYLE_VALUE_CACHE
+void lv_obj_style_value_cache_invalidate(void)
+{
+    value_cache.gen++;
+    if(value_cache.gen == 0) {
+        /*Wrapped around, the entries of the first round would look valid again*/
+        if(value_cache.entries) {
+            lv_memzero(value_cache.entries, LV_OBJ_STYLE_VALUE_CACHE * sizeof(lv_obj_style_value_cache_entry_t));
+        }
+        value_cache.gen = 1;
+    }
+}
+#endif
+
+void lv_obj_style_value_cache_get_stats(uint32_t * lookup_cnt, uint32_t * hit_cnt, bool reset)
+{
+#if LV_OBJ_STYLE_VALUE_CACHE
+    if(lookup_cnt) *lookup_cnt = value_cache.lookup_cnt;
+    if(hit_cnt) *hit_cnt = value_cache.hit_cnt;
+    if(reset) {
+        value_cache.lookup_cnt = 0;
+        value_cache.hit_cnt = 0;
+    }
+#else
+    LV_UNUSED(reset);
+    if(lookup_cnt) *lookup_cnt = 0;
+    if(hit_cnt) *hit_cnt = 0;
+#endif
+}
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
@@ -356,10 +415,36 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
+#if LV_OBJ_STYLE_VALUE_CACHE
+    /*The state and the transitions are changed only temporarily while `skip_trans` is set,
+     *so don't use the cache then*/
+    lv_obj_style_value_cache_entry_t * entry = NULL;
+    value_cache.lookup_cnt++;
+    if(!obj->skip_trans && value_cache.entries) {
+        entry = &value_cache.entries[value_cache_index(obj, selector, prop)];
+        if(entry->gen == value_cache.gen && entry->obj == obj && entry->selector == selector && entry->prop == prop) {
+            value_cache.hit_cnt++;
+            return entry->value;
+        }
+    }
+#endif
+
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) return lv_style_prop_get_default(prop);
+
+#if LV_OBJ_STYLE_VALUE_CACHE
+    /*Store only the values found in the styles. Most properties are not set at all and
+     *getting their default is cheap, so let them not evict the others*/
+    if(entry) {
+        entry->obj = obj;
+        entry->value = value_act;
+        entry->selector = selector;
+        entry->prop = prop;
+        entry->gen = value_cache.gen;
+    }
+#endif
 
-    return lv_style_prop_get_default(prop);
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -460,6 +545,7 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
     obj->state = prev_state;
     v1 = lv_obj_get_style_prop(obj, part, tr_dsc->prop);
     obj->state = new_state;
+    lv_obj_style_value_cache_invalidate();
 
     lv_obj_style_t * style_trans = get_trans_style(obj, part);
     lv_style_set_prop((lv_style_t *)style_trans->style, tr_dsc->prop, v1);  /*Be sure `trans_style` has a valid value*/
@@ -736,7 +822,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
     }
 
     lv_memzero(&obj->styles[i], sizeof(lv_obj_style_t));
-    obj->styles[i].style = lv_malloc_zeroed(sizeof(lv_style_t));
+    obj->styles[i].style = style_alloc();
     lv_style_init((lv_style_t *)obj->styles[i].style);
 
     obj->styles[i].is_local = 1;
@@ -770,7 +856,7 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
     }
 
     lv_memzero(&obj->styles[0], sizeof(lv_obj_style_t));
-    obj->styles[0].style = lv_malloc(sizeof(lv_style_t));
+    obj->styles[0].style = style_alloc();
     lv_style_init((lv_style_t *)obj->styles[0].style);
 
     obj->styles[0].is_trans = 1;
@@ -1217,3 +1303,33 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 
     return LV_STYLE_RES_NOT_FOUND;
 }
+
+#if LV_OBJ_STYLE_VALUE_CACHE
+static inline uint32_t value_cache_index(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)obj >> 3);
+    h = h * 31 + selector;
+    h = h * 31 + prop;
+    /*Fibonacci hashing: the upper bits of the product depend on all bits of the key*/
+    h *= 0x9E3779B1;
+    return (h >> 16) & (LV_OBJ_STYLE_VALUE_CACHE - 1);
+}
+#endif
+
+static lv_style_t * style_alloc(void)
+{
+#if LV_USE_SLAB
+    return lv_slab_alloc_zeroed(&LV_GLOBAL_DEFAULT()->style_slab);
+#else
+    return lv_malloc_zeroed(sizeof(lv_style_t));
+#endif
+}
+
+static void style_free(lv_style_t * style)
+{
+#if LV_USE_SLAB
+    lv_slab_free(&LV_GLOBAL_DEFAULT()->style_slab, style);
+#else
+    lv_free(style);
+#endif
+}
@@ -32,6 +32,24 @@ struct _lv_obj_style_t {
     uint32_t is_disabled : 1;
 };
 
+#if LV_OBJ_STYLE_VALUE_CACHE
+/** A resolved style value, the result of `lv_obj_get_style_prop()`*/
+typedef struct {
+    const lv_obj_t * obj;
+    lv_style_value_t value;
+    uint32_t selector;          /**< Part and state of the lookup*/
+    uint16_t prop;
+    uint16_t gen;               /**< Valid only if equal to the generation of the cache*/
+} lv_obj_style_value_cache_entry_t;
+
+typedef struct {
+    lv_obj_style_value_cache_entry_t * entries;  /**< `LV_OBJ_STYLE_VALUE_CACHE` entries*/
+    uint16_t gen;               /**< Incremented on every style, state or tree change*/
+    uint32_t lookup_cnt;
+    uint32_t hit_cnt;
+} lv_obj_style_value_cache_t;
+#endif
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -78,6 +96,30 @@ void lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t p
  */
 lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+/**
+ * Drop the resolved style values cached by `lv_obj_get_style_prop()`.
+ * Called on every change which can change the result of a style lookup:
+ * style properties, styles of objects, states and the object tree.
+ * An empty inline function if `LV_OBJ_STYLE_VALUE_CACHE` is 0, so the hot
+ * `lv_style_set_prop()` path doesn't pay for a call.
+ */
+#if LV_OBJ_STYLE_VALUE_CACHE
+void lv_obj_style_value_cache_invalidate(void);
+#else
+static inline void lv_obj_style_value_cache_invalidate(void)
+{
+}
+#endif
+
+/**
+ * Get the number of `lv_obj_get_style_prop()` calls and how many of them were served
+ * from the resolved style value cache since the last reset.
+ * @param lookup_cnt    store the number of lookups here (can be NULL)
+ * @param hit_cnt       store the number of cache hits here (can be NULL)
+ * @param reset         true: reset the counters
+ */
+void lv_obj_style_value_cache_get_stats(uint32_t * lookup_cnt, uint32_t * hit_cnt, bool reset);
+
 /**
  * Update the layer type of a widget bayed on its current styles.
  * The result will be stored in `obj->spec_attr->layer_type`
@@ -15,6 +15,7 @@
 #include "../misc/lv_anim_private.h"
 #include "../misc/lv_async.h"
 #include "../core/lv_global.h"
+#include "lv_obj_style_private.h"
 
 /*********************
  *      DEFINES
@@ -190,6 +191,7 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children[lv_obj_get_child_count(parent) - 1] = obj;
 
     obj->parent = parent;
+    lv_obj_style_value_cache_invalidate();
 
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
@@ -283,6 +285,9 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
 
     if(parent != parent2) {
         lv_obj_invalidate(parent2);
+        /*Mark the new paths to the pending layout updates in the moved subtrees*/
+        lv_obj_mark_layout_as_dirty(obj1);
+        lv_obj_mark_layout_as_dirty(obj2);
     }
     lv_group_swap_obj(obj1, obj2);
 }
@@ -719,7 +724,9 @@ static void obj_delete_core(lv_obj_t * obj)
         async_cancel_res = lv_async_call_cancel(lv_obj_delete_async_cb, obj);
     }
 
-    /*All children deleted. Now clean up the object specific data*/
+    /*All children deleted. Now clean up the object specific data.
+     *The destructors change `class_p` to the base classes, so save it to free the object*/
+    const lv_obj_class_t * class_p = obj->class_p;
     lv_obj_destruct(obj);
 
     /*Remove the screen for the screen list*/
@@ -751,7 +758,7 @@ static void obj_delete_core(lv_obj_t * obj)
     }
 
     /*Free the object itself*/
-    lv_free(obj);
+    lv_obj_class_free_obj(class_p, obj);
 }
 
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
@@ -40,6 +40,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static uint64_t get_area_cost(lv_display_t * disp, const lv_area_t * area);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
@@ -603,7 +604,10 @@ void lv_obj_refr(lv_layer_t * layer, lv_obj_t * obj)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the areas which has got common parts, or which are cheaper to redraw together
+ * than to flush one by one according to the flush cost of the display.
+ * With a flush cost a joined area might be worth joining with an area checked before, so
+ * repeat until no more areas are joined. Without it a single pass is done, as before.
  */
 static void lv_refr_join_area(void)
 {
@@ -611,36 +615,70 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+    bool joined;
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+            uint64_t in_cost = get_area_cost(disp_refr, &disp_refr->inv_areas[join_in]);
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
+
+                /*Without flush cost only the areas on each other can get cheaper*/
+                if(disp_refr->flush_cost == 0 &&
+                   lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+                    continue;
+                }
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                /*Join two area only if the joined area is cheaper*/
+                uint64_t joined_cost = get_area_cost(disp_refr, &joined_area);
+                if(joined_cost < in_cost + get_area_cost(disp_refr, &disp_refr->inv_areas[join_from])) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                    in_cost = joined_cost;
+                    joined = true;
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                }
             }
         }
-    }
+    } while(joined && disp_refr->flush_cost != 0);
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Estimate the cost of redrawing an area: its pixels plus the flush cost of the display
+ * for every flush it needs.
+ * @param disp      pointer to a display
+ * @param area      pointer to an invalidated area
+ * @return          the cost in pixels
+ */
+static uint64_t get_area_cost(lv_display_t * disp, const lv_area_t * area)
+{
+    uint64_t size = lv_area_get_size(area);
+    if(disp->flush_cost == 0) return size;
+
+    uint32_t flush_cnt = 1;
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL && disp->buf_act) {
+        /*The area is flushed in bands of as many rows as the draw buffer can hold.
+         *Like get_max_row() but without the rounder which would send events*/
+        uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), disp->color_format);
+        uint32_t rows = stride ? disp->buf_act->data_size / stride : 0;
+        if(rows == 0) rows = 1;
+        flush_cnt = ((uint32_t)lv_area_get_height(area) + rows - 1) / rows;
+    }
+
+    return size + (uint64_t)disp->flush_cost * flush_cnt;
+}
+
 /**
  * Refresh the sync areas
  */
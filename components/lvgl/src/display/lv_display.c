@@ -591,6 +591,22 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_flush_cost(lv_display_t * disp, uint32_t cost_px)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->flush_cost = cost_px;
+}
+
+uint32_t lv_display_get_flush_cost(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->flush_cost;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     LV_LOG_WARN("Disabling anti-aliasing is not supported since v9. This function will be removed.");
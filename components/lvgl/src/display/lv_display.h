@@ -357,6 +357,25 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Set the fixed cost of one flush transaction in pixels, that is how many pixels could be
+ * sent in the time a flush costs on top of its pixels (e.g. the CASET/RASET/RAMWR commands
+ * and the DMA setup on an SPI panel).
+ * Invalidated areas are joined when redrawing the extra pixels of the joined area
+ * is cheaper than flushing the areas one by one.
+ * @param disp              pointer to a display
+ * @param cost_px           cost of a flush in pixels.
+ *                          0 (default): join the areas only if the joined area is smaller
+ */
+void lv_display_set_flush_cost(lv_display_t * disp, uint32_t cost_px);
+
+/**
+ * Get the cost of one flush transaction set by `lv_display_set_flush_cost()`
+ * @param disp              pointer to a display
+ * @return                  cost of a flush in pixels
+ */
+uint32_t lv_display_get_flush_cost(lv_display_t * disp);
+
 /**
  * Disabling anti-aliasing is not supported since v9. This function will be removed.
  * Enable anti-aliasing for the render engine
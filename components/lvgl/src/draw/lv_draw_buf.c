@@ -20,6 +20,7 @@
 #define default_handlers LV_GLOBAL_DEFAULT()->draw_buf_handlers
 #define font_draw_buf_handlers LV_GLOBAL_DEFAULT()->font_draw_buf_handlers
 #define image_cache_draw_buf_handlers LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers
+#define glyph_cache_draw_buf_handlers LV_GLOBAL_DEFAULT()->glyph_cache_draw_buf_handlers
 
 /**********************
  *      TYPEDEFS
@@ -57,6 +58,7 @@ void lv_draw_buf_init_handlers(void)
     lv_draw_buf_init_with_default_handlers(&default_handlers);
     lv_draw_buf_init_with_default_handlers(&font_draw_buf_handlers);
     lv_draw_buf_init_with_default_handlers(&image_cache_draw_buf_handlers);
+    lv_draw_buf_init_with_default_handlers(&glyph_cache_draw_buf_handlers);
 }
 
 void lv_draw_buf_init_with_default_handlers(lv_draw_buf_handlers_t * handlers)
@@ -98,6 +100,11 @@ lv_draw_buf_handlers_t * lv_draw_buf_get_image_handlers(void)
     return &image_cache_draw_buf_handlers;
 }
 
+lv_draw_buf_handlers_t * lv_draw_buf_get_glyph_cache_handlers(void)
+{
+    return &glyph_cache_draw_buf_handlers;
+}
+
 uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t color_format)
 {
     return lv_draw_buf_width_to_stride_ex(&default_handlers, w, color_format);
@@ -136,6 +136,7 @@ void lv_draw_buf_handlers_init(lv_draw_buf_handlers_t * handlers,
 lv_draw_buf_handlers_t * lv_draw_buf_get_handlers(void);
 lv_draw_buf_handlers_t * lv_draw_buf_get_font_handlers(void);
 lv_draw_buf_handlers_t * lv_draw_buf_get_image_handlers(void);
+lv_draw_buf_handlers_t * lv_draw_buf_get_glyph_cache_handlers(void);
 
 
 /**
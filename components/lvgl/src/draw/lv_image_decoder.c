@@ -249,6 +249,19 @@ void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decode
     decoder->close_cb = close_cb;
 }
 
+void lv_image_decoder_set_drop_cb(lv_image_decoder_t * decoder, lv_image_decoder_drop_f_t drop_cb)
+{
+    decoder->drop_cb = drop_cb;
+}
+
+void lv_image_decoder_drop(const void * src)
+{
+    lv_image_decoder_t * decoder;
+    LV_LL_READ(img_decoder_ll_p, decoder) {
+        if(decoder->drop_cb) decoder->drop_cb(decoder, src);
+    }
+}
+
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data)
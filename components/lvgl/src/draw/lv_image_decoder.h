@@ -75,6 +75,14 @@ typedef lv_result_t (*lv_image_decoder_get_area_cb_t)(lv_image_decoder_t * decod
  */
 typedef void (*lv_image_decoder_close_f_t)(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 
+/**
+ * Forget everything the decoder keeps about an image between decoding sessions,
+ * because its content has changed. Called by `lv_image_cache_drop()`.
+ * @param decoder pointer to the decoder the function associated with
+ * @param src     the image source, NULL: all images
+ */
+typedef void (*lv_image_decoder_drop_f_t)(lv_image_decoder_t * decoder, const void * src);
+
 /**
  * Custom drawing functions for special image formats.
  * @param layer pointer to a layer
@@ -179,6 +187,21 @@ void lv_image_decoder_set_get_area_cb(lv_image_decoder_t * decoder, lv_image_dec
  */
 void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decoder_close_f_t close_cb);
 
+/**
+ * Set a callback to drop the data the decoder keeps about an image between decoding sessions.
+ * Required only if the decoder keeps such data outside of the image cache.
+ * @param decoder pointer to an image decoder
+ * @param drop_cb a function to drop the data of an image
+ */
+void lv_image_decoder_set_drop_cb(lv_image_decoder_t * decoder, lv_image_decoder_drop_f_t drop_cb);
+
+/**
+ * Tell all decoders that the content of an image has changed.
+ * Called by `lv_image_cache_drop()`.
+ * @param src     the image source, NULL: all images
+ */
+void lv_image_decoder_drop(const void * src);
+
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data);
@@ -46,6 +46,7 @@ struct _lv_image_decoder_t {
     lv_image_decoder_open_f_t open_cb;
     lv_image_decoder_get_area_cb_t get_area_cb;
     lv_image_decoder_close_f_t close_cb;
+    lv_image_decoder_drop_f_t drop_cb;
 
     lv_image_decoder_custom_draw_t custom_draw_cb;
 
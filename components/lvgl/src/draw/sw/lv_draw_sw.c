@@ -15,6 +15,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
 #include "../../misc/lv_area_private.h"
+#include "../../tick/lv_tick.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
     #if LV_USE_THORVG_EXTERNAL
@@ -51,6 +52,13 @@
 #endif
 
 static void execute_drawing(lv_draw_task_t * t);
+#if LV_DRAW_SW_STATS
+    static void execute_drawing_with_stats(lv_draw_task_t * t, lv_draw_sw_thread_stats_t * stats, lv_mutex_t * mutex);
+    static lv_draw_sw_unit_t * get_sw_unit(void);
+#endif
+#if LV_USE_OS && LV_DRAW_SW_LOCALITY_LOOKAHEAD > 0
+    static lv_draw_task_t * get_nearest_task(lv_layer_t * layer, const lv_area_t * last_area);
+#endif
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -89,14 +97,31 @@ void lv_draw_sw_init(void)
     draw_sw_unit->base_unit.name = "SW";
 #endif
 
+#if LV_DRAW_SW_STATS
+    draw_sw_unit->stats_reset_tick = lv_tick_get();
+#endif
+
 #if LV_USE_OS
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
         thread_dsc->idx = i;
         thread_dsc->draw_unit = (void *) draw_sw_unit;
-        lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_THREAD_PRIO, render_thread_cb,
+#if LV_DRAW_SW_STATS
+        lv_mutex_init(&thread_dsc->stats_mutex);
+#endif
+#if LV_DRAW_SW_THREAD_PIN
+        lv_result_t res = lv_thread_init_pinned(&thread_dsc->thread, "swdraw", LV_DRAW_SW_THREAD_PRIO, render_thread_cb,
+                                                LV_DRAW_THREAD_STACK_SIZE, thread_dsc, LV_DRAW_SW_THREAD_FIRST_CORE + i);
+        if(res != LV_RESULT_OK) {
+            LV_LOG_WARN("couldn't pin software rendering thread %" LV_PRIu32 ", starting it unpinned", i);
+            lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_SW_THREAD_PRIO, render_thread_cb,
+                           LV_DRAW_THREAD_STACK_SIZE, thread_dsc);
+        }
+#else
+        lv_thread_init(&thread_dsc->thread, "swdraw", LV_DRAW_SW_THREAD_PRIO, render_thread_cb,
                        LV_DRAW_THREAD_STACK_SIZE, thread_dsc);
+#endif
     }
 #endif
 
@@ -139,6 +164,9 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
             lv_thread_sync_signal(&thread_dsc->sync);
         }
         lv_thread_delete(&thread_dsc->thread);
+#if LV_DRAW_SW_STATS
+        lv_mutex_delete(&thread_dsc->stats_mutex);
+#endif
     }
 
     return 0;
@@ -201,6 +229,50 @@ lv_draw_sw_blend_handler_t lv_draw_sw_get_blend_handler(lv_color_format_t dest_c
     return NULL;
 }
 
+#if LV_DRAW_SW_STATS
+lv_result_t lv_draw_sw_get_thread_stats(uint32_t idx, lv_draw_sw_thread_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    lv_draw_sw_unit_t * draw_sw_unit = get_sw_unit();
+    if(draw_sw_unit == NULL) return LV_RESULT_INVALID;
+
+#if LV_USE_OS
+    if(idx >= LV_DRAW_SW_DRAW_UNIT_CNT) return LV_RESULT_INVALID;
+    lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[idx];
+    lv_mutex_lock(&thread_dsc->stats_mutex);
+    *stats = thread_dsc->stats;
+    lv_mutex_unlock(&thread_dsc->stats_mutex);
+#else
+    if(idx != 0) return LV_RESULT_INVALID;
+    *stats = draw_sw_unit->stats;
+#endif
+
+    uint32_t elaps = lv_tick_elaps(draw_sw_unit->stats_reset_tick);
+    stats->idle_time = elaps > stats->busy_time ? elaps - stats->busy_time : 0;
+    return LV_RESULT_OK;
+}
+
+void lv_draw_sw_reset_thread_stats(void)
+{
+    lv_draw_sw_unit_t * draw_sw_unit = get_sw_unit();
+    if(draw_sw_unit == NULL) return;
+
+#if LV_USE_OS
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
+        lv_mutex_lock(&thread_dsc->stats_mutex);
+        lv_memzero(&thread_dsc->stats, sizeof(lv_draw_sw_thread_stats_t));
+        lv_mutex_unlock(&thread_dsc->stats_mutex);
+    }
+#else
+    lv_memzero(&draw_sw_unit->stats, sizeof(lv_draw_sw_thread_stats_t));
+#endif
+    draw_sw_unit->stats_reset_tick = lv_tick_get();
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -276,12 +348,31 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         /*Do nothing if busy*/
         if(thread_dsc->task_act) continue;
 
+#if LV_DRAW_SW_LOCALITY_LOOKAHEAD > 0
+        /*Prefer the task closest to the one this thread rendered last.
+         *Taken tasks are IN_PROGRESS so they are skipped when searching from the head again.*/
+        t = get_nearest_task(layer, &thread_dsc->last_area);
+#else
         /*Find an available task. Start from the previously taken task.*/
         t = lv_draw_get_next_available_task(layer, t, DRAW_UNIT_ID_SW);
+#endif
 
         /*If there is not available task don't try other threads as there won't be available
          *tasks for then either*/
         if(t == NULL) {
+#if LV_DRAW_SW_STATS
+            /*This and the remaining free threads have nothing to do while others are busy*/
+            if(!all_idle) {
+                for(; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+                    lv_draw_sw_thread_dsc_t * free_dsc = &draw_sw_unit->thread_dscs[i];
+                    if(free_dsc->task_act == NULL) {
+                        lv_mutex_lock(&free_dsc->stats_mutex);
+                        free_dsc->stats.starved_cnt++;
+                        lv_mutex_unlock(&free_dsc->stats_mutex);
+                    }
+                }
+            }
+#endif
             LV_PROFILER_DRAW_END;
             if(all_idle) return LV_DRAW_UNIT_IDLE;  /*Couldn't start rendering*/
             else return taken_cnt;
@@ -328,7 +419,11 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->task_act = t;
 
+#if LV_DRAW_SW_STATS
+    execute_drawing_with_stats(t, &draw_sw_unit->stats, NULL);
+#else
     execute_drawing(t);
+#endif
     draw_sw_unit->task_act->state = LV_DRAW_TASK_STATE_FINISHED;
     draw_sw_unit->task_act = NULL;
 
@@ -362,7 +457,12 @@ static void render_thread_cb(void * ptr)
             break;
         }
 
+#if LV_DRAW_SW_STATS
+        execute_drawing_with_stats(thread_dsc->task_act, &thread_dsc->stats, &thread_dsc->stats_mutex);
+#else
         execute_drawing(thread_dsc->task_act);
+#endif
+        thread_dsc->last_area = thread_dsc->task_act->area;
 #if LV_USE_PARALLEL_DRAW_DEBUG
         parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
 #endif
@@ -380,6 +480,62 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
+#if LV_USE_OS && LV_DRAW_SW_LOCALITY_LOOKAHEAD > 0
+static lv_draw_task_t * get_nearest_task(lv_layer_t * layer, const lv_area_t * last_area)
+{
+    lv_draw_task_t * best = NULL;
+    int32_t best_dist = INT32_MAX;
+    lv_draw_task_t * t = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_LOCALITY_LOOKAHEAD; i++) {
+        t = lv_draw_get_next_available_task(layer, t, DRAW_UNIT_ID_SW);
+        if(t == NULL) break;
+
+        /*Rows are contiguous in the buffer so the vertical distance matters most*/
+        int32_t dist;
+        if(t->area.y2 < last_area->y1) dist = last_area->y1 - t->area.y2;
+        else if(t->area.y1 > last_area->y2) dist = t->area.y1 - last_area->y2;
+        else dist = 0;
+
+        if(dist < best_dist) {
+            best = t;
+            best_dist = dist;
+            if(dist == 0) break;
+        }
+    }
+
+    return best;
+}
+#endif
+
+#if LV_DRAW_SW_STATS
+static void execute_drawing_with_stats(lv_draw_task_t * t, lv_draw_sw_thread_stats_t * stats, lv_mutex_t * mutex)
+{
+    /*With millisecond ticks a short task is counted as 0 or 1 ms
+     *with a probability proportional to its length, so the sum is still accurate.*/
+    uint32_t start = lv_tick_get();
+    execute_drawing(t);
+    uint32_t elaps = lv_tick_elaps(start);
+
+    /*`mutex` is NULL when rendering happens in the caller's context (no OS)*/
+    if(mutex) lv_mutex_lock(mutex);
+    stats->busy_time += elaps;
+    stats->task_cnt++;
+    stats->pixel_cnt += lv_area_get_size(&t->area);
+    if(mutex) lv_mutex_unlock(mutex);
+}
+
+static lv_draw_sw_unit_t * get_sw_unit(void)
+{
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u) {
+        if(u->dispatch_cb == dispatch) return (lv_draw_sw_unit_t *)u;
+        u = u->next;
+    }
+    return NULL;
+}
+#endif
+
 static void execute_drawing(lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
@@ -33,6 +33,21 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_DRAW_SW_STATS
+/** Statistics of one SW draw thread since the last reset*/
+typedef struct {
+    uint32_t task_cnt;          /**< Number of draw tasks rendered*/
+    uint64_t pixel_cnt;         /**< Sum of the areas of the rendered draw tasks*/
+    uint32_t busy_time;         /**< Time spent rendering [ms]*/
+    uint32_t idle_time;         /**< Time since the last reset minus `busy_time` [ms]*/
+    uint32_t starved_cnt;       /**< Dispatches when the thread was free but no independent task was available*/
+} lv_draw_sw_thread_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -48,6 +63,23 @@ void lv_draw_sw_init(void);
  */
 void lv_draw_sw_deinit(void);
 
+#if LV_DRAW_SW_STATS
+/**
+ * Get the statistics of a SW draw thread.
+ * `busy_time` is summed from millisecond ticks, so it's only meaningful over many frames.
+ * The counters are copied under the thread's own mutex, so it can be called while rendering.
+ * @param idx       index of the thread (0 .. LV_DRAW_SW_DRAW_UNIT_CNT - 1)
+ * @param stats     store the statistics here
+ * @return          LV_RESULT_OK: success; LV_RESULT_INVALID: invalid index or no SW draw unit
+ */
+lv_result_t lv_draw_sw_get_thread_stats(uint32_t idx, lv_draw_sw_thread_stats_t * stats);
+
+/**
+ * Clear the statistics of all SW draw threads.
+ */
+void lv_draw_sw_reset_thread_stats(void);
+#endif
+
 /**
  * Fill an area using SW render. Handle gradient and radius.
  * @param t             pointer to a draw task
@@ -37,6 +37,11 @@ typedef struct {
     lv_thread_sync_t sync;
     lv_draw_unit_t * draw_unit;
     uint32_t idx;
+    lv_area_t last_area;        /**< Area of the last task rendered by this thread*/
+#if LV_DRAW_SW_STATS
+    lv_draw_sw_thread_stats_t stats;
+    lv_mutex_t stats_mutex;     /**< Guards `stats` between the render thread, the dispatcher and the getters*/
+#endif
     volatile bool inited;
     volatile bool exit_status;
 } lv_draw_sw_thread_dsc_t;
@@ -47,6 +52,12 @@ struct _lv_draw_sw_unit_t {
     lv_draw_sw_thread_dsc_t thread_dscs[LV_DRAW_SW_DRAW_UNIT_CNT];
 #else
     lv_draw_task_t * task_act;
+#if LV_DRAW_SW_STATS
+    lv_draw_sw_thread_stats_t stats;
+#endif
+#endif
+#if LV_DRAW_SW_STATS
+    uint32_t stats_reset_tick;  /**< Tick of the last statistics reset*/
 #endif
 };
 
@@ -11,6 +11,7 @@
 #include "../misc/lv_fs_private.h"
 #include "../misc/lv_types.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/instance/lv_glyph_cache.h"
 #include "lv_binfont_loader.h"
 
 /**********************
@@ -137,6 +138,8 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    lv_glyph_cache_drop(font);
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
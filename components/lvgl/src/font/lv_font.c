@@ -13,6 +13,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_assert.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/instance/lv_glyph_cache_private.h"
 
 /*********************
  *      DEFINES
@@ -51,6 +52,10 @@ const void * lv_font_get_glyph_bitmap(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t
     const lv_font_t * font_p = g_dsc->resolved_font;
     LV_ASSERT_NULL(font_p);
 
+    /*Decode the glyph only once if it's in the glyph cache*/
+    lv_draw_buf_t * cached = lv_glyph_cache_get_bitmap(g_dsc);
+    if(cached) return cached;
+
     const uint8_t save_req = g_dsc->req_raw_bitmap;
     g_dsc->req_raw_bitmap = 0;
     const void * bitmap = font_p->get_glyph_bitmap(g_dsc, draw_buf);
@@ -89,6 +94,10 @@ void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc)
     if(font != NULL && font->release_glyph) {
         font->release_glyph(font, g_dsc);
     }
+    else {
+        /*Only the glyph cache sets the entry of the glyphs of fonts without `release_glyph`*/
+        lv_glyph_cache_release(g_dsc);
+    }
 }
 
 bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
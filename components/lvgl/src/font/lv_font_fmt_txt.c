@@ -14,6 +14,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../stdlib/lv_mem.h"
+#include "../misc/cache/instance/lv_glyph_cache.h"
 
 /*********************
  *      DEFINES
@@ -645,8 +646,7 @@ static lv_font_t * builtin_font_create_cb(const lv_font_info_t * info, const voi
 
 static void builtin_font_delete_cb(lv_font_t * font)
 {
-    /*Nothing to delete*/
-    LV_UNUSED(font);
+    lv_glyph_cache_drop(font);
 }
 
 static void * builtin_font_dup_src_cb(const void * src)
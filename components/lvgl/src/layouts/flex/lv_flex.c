@@ -7,12 +7,13 @@
  *      INCLUDES
  *********************/
 #include "lv_flex.h"
-#include "../lv_layout.h"
+#include "../lv_layout_private.h"
 #include "../../core/lv_obj_private.h"
 
 #if LV_USE_FLEX
 
 #include "../../core/lv_global.h"
+#include "../../stdlib/lv_string.h"
 /*********************
  *      DEFINES
  *********************/
@@ -39,6 +40,42 @@ typedef struct {
     uint32_t clamped : 1;
 } grow_dsc_t;
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+/*The parameters the cache of a container was made with*/
+typedef struct {
+    int32_t max_main_size;
+    int32_t item_gap;
+    int32_t track_gap;
+    uint32_t item_cnt;
+    lv_flex_align_t cross_place;
+    uint8_t row;
+    uint8_t wrap;
+} flex_cache_key_t;
+
+typedef struct {
+    int32_t main_pos;       /*Start of the margin box from the start of the track*/
+    int32_t main_size;      /*With margins*/
+    int32_t cross_size;     /*With margins*/
+    uint8_t skip : 1;       /*Hidden, floating or ignores the layout*/
+    uint8_t grow : 1;
+    uint8_t new_track : 1;
+} flex_cache_item_t;
+
+typedef struct {
+    int32_t first_item;
+    int32_t cross_pos;      /*From the start of the content area*/
+    int32_t cross_size;
+    uint32_t grow : 1;      /*Has grow items*/
+} flex_cache_track_t;
+
+typedef struct {
+    lv_layout_cache_t header;
+    flex_cache_key_t key;
+    uint32_t track_cnt;
+    /*Followed by `flex_cache_item_t[key.item_cnt]` and `flex_cache_track_t[key.item_cnt]`*/
+} flex_cache_t;
+#endif
+
 typedef struct {
     int32_t track_cross_size;
     int32_t track_main_size;         /*For all items*/
@@ -47,8 +84,13 @@ typedef struct {
     grow_dsc_t * grow_dsc;
     uint32_t grow_item_cnt;
     uint32_t grow_dsc_calc : 1;
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    flex_cache_item_t * cache_items; /*Save the items' place and size here if not NULL*/
+#endif
 } track_t;
 
+typedef int32_t (*margin_func_t)(const lv_obj_t *, lv_part_t);
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -61,11 +103,30 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
                               int32_t item_gap, track_t * t);
 static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, int32_t item_last_id, int32_t abs_x,
                            int32_t abs_y, int32_t max_main_size, int32_t item_gap, track_t * t);
+static void item_place(lv_obj_t * item, const flex_t * f, int32_t abs_x, int32_t abs_y, int32_t main_pos,
+                       int32_t track_cross_size);
+static void item_move(lv_obj_t * item, int32_t diff_x, int32_t diff_y);
+static void update_end(lv_obj_t * cont);
 static void place_content(lv_flex_align_t place, int32_t max_size, int32_t content_size, int32_t item_cnt,
                           int32_t * start_pos, int32_t * gap);
 static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id);
 static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj);
 static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj);
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    static bool cache_key_init(flex_cache_key_t * key, lv_obj_t * cont, const flex_t * f, bool rtl,
+                               lv_flex_align_t track_cross_place, int32_t max_main_size, int32_t item_gap, int32_t track_gap);
+    static flex_cache_t * cache_alloc(lv_obj_t * cont, const flex_cache_key_t * key);
+    static void cache_update(lv_obj_t * cont, flex_t * f, flex_cache_t * cache, int32_t dirty_first, int32_t dirty_last,
+                             int32_t abs_x, int32_t abs_y);
+    static void cache_reflow(lv_obj_t * cont, flex_t * f, flex_cache_t * cache, uint32_t track_id, int32_t dirty_last,
+                             int32_t abs_x, int32_t abs_y);
+    static void cache_item_set(flex_cache_item_t * ci, lv_obj_t * item, const flex_t * f, int32_t main_pos);
+    static void cache_track_set(flex_cache_track_t * ct, int32_t first_item, int32_t cross_pos, const track_t * t);
+    static uint32_t cache_find_track(const flex_cache_t * cache, int32_t item_id);
+    static int32_t cache_get_track_cross_size(const flex_cache_t * cache, uint32_t track_id);
+    static flex_cache_item_t * cache_get_items(flex_cache_t * cache);
+    static flex_cache_track_t * cache_get_tracks(flex_cache_t * cache);
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -116,7 +177,7 @@ void lv_obj_set_flex_align(lv_obj_t * obj, lv_flex_align_t main_place, lv_flex_a
 void lv_obj_set_flex_grow(lv_obj_t * obj, uint8_t grow)
 {
     lv_obj_set_style_flex_grow(obj, grow, 0);
-    lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
+    lv_obj_mark_layout_child_as_dirty(lv_obj_get_parent(obj), obj);
 }
 
 /**********************
@@ -154,6 +215,11 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
     int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
 
+    /*Can't wrap if the size is auto (i.e. the size depends on the children)*/
+    if(f.wrap && ((f.row && w_set == LV_SIZE_CONTENT) || (!f.row && h_set == LV_SIZE_CONTENT))) {
+        f.wrap = false;
+    }
+
     /*Content sized objects should squeeze the gap between the children, therefore any alignment will look like `START`*/
     if((f.row && h_set == LV_SIZE_CONTENT && cont->h_layout == 0) ||
        (!f.row && w_set == LV_SIZE_CONTENT && cont->w_layout == 0)) {
@@ -165,6 +231,26 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         else if(track_cross_place == LV_FLEX_ALIGN_END) track_cross_place = LV_FLEX_ALIGN_START;
     }
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    flex_cache_t * cache = NULL;
+    flex_cache_key_t key;
+    if(cache_key_init(&key, cont, &f, rtl, track_cross_place, max_main_size, item_gap, track_gap)) {
+        int32_t dirty_first;
+        int32_t dirty_last;
+        cache = (flex_cache_t *)lv_layout_cache_get_dirty(cont, LV_LAYOUT_FLEX, &dirty_first, &dirty_last);
+        if(cache && lv_memcmp(&cache->key, &key, sizeof(key)) == 0 && dirty_last < (int32_t)key.item_cnt) {
+            cache_update(cont, &f, cache, dirty_first, dirty_last, abs_x, abs_y);
+            update_end(cont);
+            return;
+        }
+
+        cache = cache_alloc(cont, &key);
+    }
+    else {
+        lv_layout_cache_free(cont);
+    }
+#endif
+
     int32_t total_track_cross_size = 0;
     int32_t gap = 0;
     uint32_t track_cnt = 0;
@@ -196,6 +282,11 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         *cross_pos += total_track_cross_size;
     }
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    int32_t cross_start = *cross_pos;
+    uint32_t track_id = 0;
+#endif
+
     while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
         track_t t;
         t.grow_dsc_calc = 1;
@@ -205,7 +296,16 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         if(rtl && !f.row) {
             *cross_pos -= t.track_cross_size;
         }
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+        t.cache_items = cache ? cache_get_items(cache) : NULL;
+#endif
         children_repos(cont, &f, track_first_item, next_track_first_item, abs_x, abs_y, max_main_size, item_gap, &t);
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+        if(cache) {
+            cache_track_set(&cache_get_tracks(cache)[track_id], track_first_item, *cross_pos - cross_start, &t);
+            track_id++;
+        }
+#endif
         track_first_item = next_track_first_item;
         lv_free(t.grow_dsc);
         t.grow_dsc = NULL;
@@ -218,13 +318,14 @@ static void flex_update(lv_obj_t * cont, void * user_data)
     }
     LV_ASSERT_MEM_INTEGRITY();
 
-    if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
-        lv_obj_refr_size(cont);
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    if(cache) {
+        cache->track_cnt = track_id;
+        cache->header.layout = LV_LAYOUT_FLEX;
     }
+#endif
 
-    lv_obj_send_event(cont, LV_EVENT_LAYOUT_CHANGED, NULL);
-
-    LV_TRACE_LAYOUT("finished");
+    update_end(cont);
 }
 
 /**
@@ -233,13 +334,6 @@ static void flex_update(lv_obj_t * cont, void * user_data)
 static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id, int32_t max_main_size,
                               int32_t item_gap, track_t * t)
 {
-    int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
-    int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
-
-    /*Can't wrap if the size is auto (i.e. the size depends on the children)*/
-    if(f->wrap && ((f->row && w_set == LV_SIZE_CONTENT) || (!f->row && h_set == LV_SIZE_CONTENT))) {
-        f->wrap = false;
-    }
     int32_t(*get_main_size)(const lv_obj_t *) = (f->row ? lv_obj_get_width_with_margin : lv_obj_get_height_with_margin);
     int32_t(*get_cross_size)(const lv_obj_t *) = (!f->row ? lv_obj_get_width_with_margin :
                                                   lv_obj_get_height_with_margin);
@@ -337,13 +431,9 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
 {
     void (*area_set_main_size)(lv_area_t *, int32_t) = (f->row ? lv_area_set_width : lv_area_set_height);
     int32_t (*area_get_main_size)(const lv_area_t *) = (f->row ? lv_area_get_width : lv_area_get_height);
-    int32_t (*area_get_cross_size)(const lv_area_t *) = (!f->row ? lv_area_get_width : lv_area_get_height);
 
-    typedef int32_t (*margin_func_t)(const lv_obj_t *, lv_part_t);
     margin_func_t get_margin_main_start = (f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
     margin_func_t get_margin_main_end = (f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
-    margin_func_t get_margin_cross_start = (!f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
-    margin_func_t get_margin_cross_end = (!f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
 
     /*Calculate the size of grow items first*/
     uint32_t i;
@@ -392,6 +482,9 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
     /*Reposition the children*/
     while(item && item_first_id != item_last_id) {
         if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) {
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+            if(t->cache_items) cache_item_set(&t->cache_items[item_first_id], item, f, main_pos);
+#endif
             item = get_next_item(cont, f->rev, &item_first_id);
             continue;
         }
@@ -438,47 +531,12 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             lv_obj_mark_layout_as_dirty(item);
         }
 
-        int32_t cross_pos = 0;
-        switch(f->cross_place) {
-            case LV_FLEX_ALIGN_CENTER:
-                /*Round up the cross size to avoid rounding error when dividing by 2
-                 *The issue comes up e,g, with column direction with center cross direction if an element's width changes*/
-                cross_pos = (((t->track_cross_size + 1) & (~1)) - area_get_cross_size(&item->coords)) / 2;
-                cross_pos += (get_margin_cross_start(item, LV_PART_MAIN) - get_margin_cross_end(item, LV_PART_MAIN)) / 2;
-                break;
-            case LV_FLEX_ALIGN_END:
-                cross_pos = t->track_cross_size - area_get_cross_size(&item->coords);
-                cross_pos -= get_margin_cross_end(item, LV_PART_MAIN);
-                break;
-            default:
-                cross_pos += get_margin_cross_start(item, LV_PART_MAIN);
-                break;
-        }
-
         if(f->row && rtl) main_pos -= area_get_main_size(&item->coords);
 
-        /*Handle percentage value of translate*/
-        int32_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
-        int32_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
-        int32_t w = lv_obj_get_width(item);
-        int32_t h = lv_obj_get_height(item);
-        if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
-        if(LV_COORD_IS_PCT(tr_y)) tr_y = (h * LV_COORD_GET_PCT(tr_y)) / 100;
-
-        int32_t diff_x = abs_x - item->coords.x1 + tr_x;
-        int32_t diff_y = abs_y - item->coords.y1 + tr_y;
-        diff_x += f->row ? main_pos + get_margin_main_start(item, LV_PART_MAIN) : cross_pos;
-        diff_y += f->row ? cross_pos : main_pos + get_margin_main_start(item, LV_PART_MAIN);
-
-        if(diff_x || diff_y) {
-            lv_obj_invalidate(item);
-            item->coords.x1 += diff_x;
-            item->coords.x2 += diff_x;
-            item->coords.y1 += diff_y;
-            item->coords.y2 += diff_y;
-            lv_obj_invalidate(item);
-            lv_obj_move_children_by(item, diff_x, diff_y, false);
-        }
+        item_place(item, f, abs_x, abs_y, main_pos, t->track_cross_size);
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+        if(t->cache_items) cache_item_set(&t->cache_items[item_first_id], item, f, main_pos);
+#endif
 
         if(!(f->row && rtl)) main_pos += area_get_main_size(&item->coords) + item_gap + place_gap
                                              + get_margin_main_start(item, LV_PART_MAIN)
@@ -489,6 +547,83 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
     }
 }
 
+/**
+ * Move an item to its place in a track
+ * @param item              pointer to an item
+ * @param f                 the flex parameters of the container
+ * @param abs_x             absolute x coordinate of the track's start
+ * @param abs_y             absolute y coordinate of the track's start
+ * @param main_pos          start of the item's margin box from the start of the track
+ * @param track_cross_size  cross size of the track
+ */
+static void item_place(lv_obj_t * item, const flex_t * f, int32_t abs_x, int32_t abs_y, int32_t main_pos,
+                       int32_t track_cross_size)
+{
+    int32_t (*area_get_cross_size)(const lv_area_t *) = (!f->row ? lv_area_get_width : lv_area_get_height);
+
+    margin_func_t get_margin_main_start = (f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
+    margin_func_t get_margin_cross_start = (!f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
+    margin_func_t get_margin_cross_end = (!f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
+
+    int32_t cross_pos = 0;
+    switch(f->cross_place) {
+        case LV_FLEX_ALIGN_CENTER:
+            /*Round up the cross size to avoid rounding error when dividing by 2
+             *The issue comes up e,g, with column direction with center cross direction if an element's width changes*/
+            cross_pos = (((track_cross_size + 1) & (~1)) - area_get_cross_size(&item->coords)) / 2;
+            cross_pos += (get_margin_cross_start(item, LV_PART_MAIN) - get_margin_cross_end(item, LV_PART_MAIN)) / 2;
+            break;
+        case LV_FLEX_ALIGN_END:
+            cross_pos = track_cross_size - area_get_cross_size(&item->coords);
+            cross_pos -= get_margin_cross_end(item, LV_PART_MAIN);
+            break;
+        default:
+            cross_pos += get_margin_cross_start(item, LV_PART_MAIN);
+            break;
+    }
+
+    /*Handle percentage value of translate*/
+    int32_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
+    int32_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+    int32_t w = lv_obj_get_width(item);
+    int32_t h = lv_obj_get_height(item);
+    if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
+    if(LV_COORD_IS_PCT(tr_y)) tr_y = (h * LV_COORD_GET_PCT(tr_y)) / 100;
+
+    int32_t diff_x = abs_x - item->coords.x1 + tr_x;
+    int32_t diff_y = abs_y - item->coords.y1 + tr_y;
+    diff_x += f->row ? main_pos + get_margin_main_start(item, LV_PART_MAIN) : cross_pos;
+    diff_y += f->row ? cross_pos : main_pos + get_margin_main_start(item, LV_PART_MAIN);
+
+    item_move(item, diff_x, diff_y);
+}
+
+static void item_move(lv_obj_t * item, int32_t diff_x, int32_t diff_y)
+{
+    if(diff_x == 0 && diff_y == 0) return;
+
+    lv_obj_invalidate(item);
+    item->coords.x1 += diff_x;
+    item->coords.x2 += diff_x;
+    item->coords.y1 += diff_y;
+    item->coords.y2 += diff_y;
+    lv_obj_invalidate(item);
+    lv_obj_move_children_by(item, diff_x, diff_y, false);
+}
+
+static void update_end(lv_obj_t * cont)
+{
+    int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
+    int32_t h_set = lv_obj_get_style_height(cont, LV_PART_MAIN);
+    if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
+        lv_obj_refr_size(cont);
+    }
+
+    lv_obj_send_event(cont, LV_EVENT_LAYOUT_CHANGED, NULL);
+
+    LV_TRACE_LAYOUT("finished");
+}
+
 /**
  * Tell a start coordinate and gap for a placement type.
  */
@@ -559,4 +694,237 @@ static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj)
            + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
 }
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+
+/**
+ * Collect the parameters the cache depends on. Only the most common case is cached:
+ * items and tracks placed from the start, no reverse order and left-to-right base direction.
+ * @return  false if the layout can't be cached with these parameters
+ */
+static bool cache_key_init(flex_cache_key_t * key, lv_obj_t * cont, const flex_t * f, bool rtl,
+                           lv_flex_align_t track_cross_place, int32_t max_main_size, int32_t item_gap, int32_t track_gap)
+{
+    if(f->rev || rtl || f->main_place != LV_FLEX_ALIGN_START || track_cross_place != LV_FLEX_ALIGN_START) return false;
+
+    uint32_t item_cnt = lv_obj_get_child_count(cont);
+    if(item_cnt < LV_LAYOUT_CACHE_MIN_CHILDREN) return false;
+
+    /*It's compared with `lv_memcmp`, so clear the padding too*/
+    lv_memzero(key, sizeof(flex_cache_key_t));
+    key->max_main_size = max_main_size;
+    key->item_gap = item_gap;
+    key->track_gap = track_gap;
+    key->item_cnt = item_cnt;
+    key->cross_place = f->cross_place;
+    key->row = f->row;
+    key->wrap = f->wrap;
+    return true;
+}
+
+static flex_cache_t * cache_alloc(lv_obj_t * cont, const flex_cache_key_t * key)
+{
+    /*Every track has at least one item*/
+    uint32_t size = sizeof(flex_cache_t) + key->item_cnt * (sizeof(flex_cache_item_t) + sizeof(flex_cache_track_t));
+    flex_cache_t * cache = (flex_cache_t *)lv_layout_cache_alloc(cont, size);
+    if(cache == NULL) return NULL;
+
+    cache->key = *key;
+    cache->track_cnt = 0;
+    return cache;
+}
+
+/**
+ * Place the changed items using the cached sizes of the others.
+ * Items after a changed one are only moved if its size changed, and only in the same track.
+ * If the tracks can change, they are placed again from the first changed one.
+ */
+static void cache_update(lv_obj_t * cont, flex_t * f, flex_cache_t * cache, int32_t dirty_first, int32_t dirty_last,
+                         int32_t abs_x, int32_t abs_y)
+{
+    if(dirty_first < 0) return;
+
+    flex_cache_item_t * items = cache_get_items(cache);
+    flex_cache_track_t * tracks = cache_get_tracks(cache);
+    uint32_t track_first = cache_find_track(cache, dirty_first);
+    uint32_t track_last = cache_find_track(cache, dirty_last);
+
+    /*Measure the changed items again*/
+    bool reflow = false;
+    int32_t i;
+    for(i = dirty_first; i <= dirty_last; i++) {
+        flex_cache_item_t old = items[i];
+        cache_item_set(&items[i], cont->spec_attr->children[i], f, old.main_pos);
+
+        /*The grow items share the free space and the others can wrap differently*/
+        if(items[i].skip != old.skip || items[i].new_track != old.new_track || items[i].grow || old.grow) reflow = true;
+        else if(f->wrap && items[i].main_size != old.main_size) reflow = true;
+    }
+
+    uint32_t t;
+    for(t = track_first; t <= track_last && !reflow; t++) {
+        if(tracks[t].grow) {
+            reflow = true;
+            break;
+        }
+
+        int32_t cross_size = cache_get_track_cross_size(cache, t);
+        if(cross_size == tracks[t].cross_size) continue;
+
+        /*The items are aligned in the track or the next tracks move*/
+        if(f->cross_place != LV_FLEX_ALIGN_START || t != cache->track_cnt - 1) reflow = true;
+        else tracks[t].cross_size = cross_size;
+    }
+
+    if(reflow) {
+        /*The first item of a track might join the previous track now*/
+        if(track_first > 0 && dirty_first == tracks[track_first].first_item) track_first--;
+        cache_reflow(cont, f, cache, track_first, dirty_last, abs_x, abs_y);
+        return;
+    }
+
+    int32_t item_gap = cache->key.item_gap;
+    int32_t main_pos = items[dirty_first].main_pos;
+    t = track_first;
+    for(i = dirty_first; i < (int32_t)cache->key.item_cnt; i++) {
+        if(t + 1 < cache->track_cnt && i == tracks[t + 1].first_item) {
+            /*The size of the tracks after the changed items didn't change*/
+            if(i > dirty_last) break;
+            t++;
+            main_pos = 0;
+        }
+
+        flex_cache_item_t * ci = &items[i];
+        lv_obj_t * item = cont->spec_attr->children[i];
+        if(i > dirty_last) {
+            /*Only moved because of the size change of an earlier item*/
+            int32_t diff = main_pos - ci->main_pos;
+            if(diff == 0) break;
+            if(!ci->skip) item_move(item, f->row ? diff : 0, f->row ? 0 : diff);
+        }
+        else if(!ci->skip) {
+            int32_t track_x = f->row ? abs_x : abs_x + tracks[t].cross_pos;
+            int32_t track_y = f->row ? abs_y + tracks[t].cross_pos : abs_y;
+            item_place(item, f, track_x, track_y, main_pos, tracks[t].cross_size);
+        }
+
+        ci->main_pos = main_pos;
+        if(!ci->skip) main_pos += ci->main_size + item_gap;
+    }
+}
+
+/**
+ * Place the tracks again from a given track. Stop at the first track after the changed items
+ * which starts at the same place with the same items as before.
+ */
+static void cache_reflow(lv_obj_t * cont, flex_t * f, flex_cache_t * cache, uint32_t track_id, int32_t dirty_last,
+                         int32_t abs_x, int32_t abs_y)
+{
+    flex_cache_item_t * items = cache_get_items(cache);
+    flex_cache_track_t * tracks = cache_get_tracks(cache);
+    int32_t item_cnt = cache->key.item_cnt;
+    uint32_t track_cnt_old = cache->track_cnt;
+
+    int32_t * cross_pos = (f->row ? &abs_y : &abs_x);
+    int32_t cross_start = *cross_pos;
+    *cross_pos += tracks[track_id].cross_pos;
+
+    int32_t track_first_item = tracks[track_id].first_item;
+    while(track_first_item < item_cnt) {
+        track_t t;
+        t.grow_dsc_calc = 1;
+        t.cache_items = NULL;
+        int32_t next_track_first_item = find_track_end(cont, f, track_first_item, cache->key.max_main_size,
+                                                       cache->key.item_gap, &t);
+
+        if(track_first_item > dirty_last && track_id < track_cnt_old) {
+            flex_cache_track_t * ct = &tracks[track_id];
+            int32_t next_old = track_id + 1 < track_cnt_old ? tracks[track_id + 1].first_item : item_cnt;
+            if(ct->first_item == track_first_item && next_old == next_track_first_item &&
+               ct->cross_pos == *cross_pos - cross_start && ct->cross_size == t.track_cross_size) {
+                lv_free(t.grow_dsc);
+                return;
+            }
+        }
+
+        t.cache_items = items;
+        children_repos(cont, f, track_first_item, next_track_first_item, abs_x, abs_y, cache->key.max_main_size,
+                       cache->key.item_gap, &t);
+        cache_track_set(&tracks[track_id], track_first_item, *cross_pos - cross_start, &t);
+        track_id++;
+        lv_free(t.grow_dsc);
+
+        *cross_pos += t.track_cross_size + cache->key.track_gap;
+        track_first_item = next_track_first_item;
+    }
+
+    cache->track_cnt = track_id;
+}
+
+static void cache_item_set(flex_cache_item_t * ci, lv_obj_t * item, const flex_t * f, int32_t main_pos)
+{
+    ci->main_pos = main_pos;
+    ci->skip = lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING);
+    ci->new_track = lv_obj_has_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK);
+    if(ci->skip) {
+        ci->grow = 0;
+        ci->main_size = 0;
+        ci->cross_size = 0;
+        return;
+    }
+
+    ci->grow = lv_obj_get_style_flex_grow(item, LV_PART_MAIN) ? 1 : 0;
+    ci->main_size = f->row ? lv_obj_get_width_with_margin(item) : lv_obj_get_height_with_margin(item);
+    ci->cross_size = f->row ? lv_obj_get_height_with_margin(item) : lv_obj_get_width_with_margin(item);
+}
+
+static void cache_track_set(flex_cache_track_t * ct, int32_t first_item, int32_t cross_pos, const track_t * t)
+{
+    ct->first_item = first_item;
+    ct->cross_pos = cross_pos;
+    ct->cross_size = t->track_cross_size;
+    ct->grow = t->grow_item_cnt ? 1 : 0;
+}
+
+/**
+ * Find the track of an item with binary search
+ */
+static uint32_t cache_find_track(const flex_cache_t * cache, int32_t item_id)
+{
+    const flex_cache_track_t * tracks = cache_get_tracks((flex_cache_t *)cache);
+    uint32_t min = 0;
+    uint32_t max = cache->track_cnt;
+    while(max - min > 1) {
+        uint32_t mid = (min + max) / 2;
+        if(tracks[mid].first_item <= item_id) min = mid;
+        else max = mid;
+    }
+    return min;
+}
+
+static int32_t cache_get_track_cross_size(const flex_cache_t * cache, uint32_t track_id)
+{
+    const flex_cache_item_t * items = cache_get_items((flex_cache_t *)cache);
+    const flex_cache_track_t * tracks = cache_get_tracks((flex_cache_t *)cache);
+    int32_t end = track_id + 1 < cache->track_cnt ? tracks[track_id + 1].first_item : (int32_t)cache->key.item_cnt;
+
+    int32_t cross_size = 0;
+    int32_t i;
+    for(i = tracks[track_id].first_item; i < end; i++) {
+        if(!items[i].skip) cross_size = LV_MAX(cross_size, items[i].cross_size);
+    }
+    return cross_size;
+}
+
+static flex_cache_item_t * cache_get_items(flex_cache_t * cache)
+{
+    return (flex_cache_item_t *)(cache + 1);
+}
+
+static flex_cache_track_t * cache_get_tracks(flex_cache_t * cache)
+{
+    return (flex_cache_track_t *)(cache_get_items(cache) + cache->key.item_cnt);
+}
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILDREN*/
+
 #endif /*LV_USE_FLEX*/
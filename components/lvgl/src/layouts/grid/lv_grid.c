@@ -11,7 +11,7 @@
 #if LV_USE_GRID
 
 #include "../../stdlib/lv_string.h"
-#include "../lv_layout.h"
+#include "../lv_layout_private.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_global.h"
 /*********************
@@ -46,6 +46,17 @@ typedef struct {
     int32_t grid_h;
 } lv_grid_calc_t;
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+typedef struct {
+    lv_layout_cache_t header;
+    uint32_t col_num;
+    uint32_t row_num;
+    int32_t grid_w;
+    int32_t grid_h;
+    /*Followed by x[col_num], w[col_num], y[row_num] and h[row_num]*/
+} grid_cache_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -63,6 +74,10 @@ static int32_t grid_align(int32_t cont_size, bool auto_size, lv_grid_align_t ali
                           uint32_t track_num,
                           int32_t * size_array, int32_t * pos_array, bool reverse);
 static uint32_t count_tracks(const int32_t * templ);
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    static bool cache_is_same(const grid_cache_t * cache, const lv_grid_calc_t * c);
+    static void cache_save(lv_obj_t * cont, const lv_grid_calc_t * c);
+#endif
 
 static inline const int32_t * get_col_dsc(lv_obj_t * obj)
 {
@@ -203,8 +218,28 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
     hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
 
+    uint32_t i_start = 0;
+    uint32_t i_end = cont->spec_attr->child_cnt;
+
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    int32_t dirty_first;
+    int32_t dirty_last;
+    grid_cache_t * cache = (grid_cache_t *)lv_layout_cache_get_dirty(cont, LV_LAYOUT_GRID, &dirty_first, &dirty_last);
+    if(cache && cache_is_same(cache, &c)) {
+        /*The tracks are the same, so only the changed children need to be placed*/
+        if(dirty_first < 0) i_end = 0;
+        else {
+            i_start = dirty_first;
+            i_end = LV_MIN((uint32_t)dirty_last + 1, i_end);
+        }
+    }
+    else {
+        cache_save(cont, &c);
+    }
+#endif
+
     uint32_t i;
-    for(i = 0; i < cont->spec_attr->child_cnt; i++) {
+    for(i = i_start; i < i_end; i++) {
         lv_obj_t * item = cont->spec_attr->children[i];
         item_repos(item, &c, &hint);
     }
@@ -668,4 +703,42 @@ static uint32_t count_tracks(const int32_t * templ)
     return i;
 }
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+
+static bool cache_is_same(const grid_cache_t * cache, const lv_grid_calc_t * c)
+{
+    if(cache->col_num != c->col_num || cache->row_num != c->row_num) return false;
+    if(cache->grid_w != c->grid_w || cache->grid_h != c->grid_h) return false;
+
+    const int32_t * a = (const int32_t *)(cache + 1);
+    size_t col_size = sizeof(int32_t) * c->col_num;
+    size_t row_size = sizeof(int32_t) * c->row_num;
+    if(lv_memcmp(a, c->x, col_size) != 0) return false;
+    if(lv_memcmp(a + c->col_num, c->w, col_size) != 0) return false;
+    if(lv_memcmp(a + 2 * c->col_num, c->y, row_size) != 0) return false;
+    if(lv_memcmp(a + 2 * c->col_num + c->row_num, c->h, row_size) != 0) return false;
+    return true;
+}
+
+static void cache_save(lv_obj_t * cont, const lv_grid_calc_t * c)
+{
+    uint32_t size = sizeof(grid_cache_t) + sizeof(int32_t) * 2 * (c->col_num + c->row_num);
+    grid_cache_t * cache = (grid_cache_t *)lv_layout_cache_alloc(cont, size);
+    if(cache == NULL) return;
+
+    cache->col_num = c->col_num;
+    cache->row_num = c->row_num;
+    cache->grid_w = c->grid_w;
+    cache->grid_h = c->grid_h;
+
+    int32_t * a = (int32_t *)(cache + 1);
+    lv_memcpy(a, c->x, sizeof(int32_t) * c->col_num);
+    lv_memcpy(a + c->col_num, c->w, sizeof(int32_t) * c->col_num);
+    lv_memcpy(a + 2 * c->col_num, c->y, sizeof(int32_t) * c->row_num);
+    lv_memcpy(a + 2 * c->col_num + c->row_num, c->h, sizeof(int32_t) * c->row_num);
+    cache->header.layout = LV_LAYOUT_GRID;
+}
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILDREN*/
+
 #endif /*LV_USE_GRID*/
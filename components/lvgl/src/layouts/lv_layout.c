@@ -9,6 +9,7 @@
 #include "lv_layout_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj.h"
+#include "../core/lv_obj_private.h"
 
 /*********************
  *      DEFINES
@@ -74,6 +75,67 @@ void lv_layout_apply(lv_obj_t * obj)
     }
 }
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+
+lv_layout_cache_t * lv_layout_cache_get_dirty(lv_obj_t * cont, uint32_t layout, int32_t * first, int32_t * last)
+{
+    *first = -1;
+    *last = -1;
+
+    lv_layout_cache_t * cache = cont->spec_attr ? cont->spec_attr->layout_cache : NULL;
+    if(cache == NULL) return NULL;
+
+    bool usable = cache->layout == layout && !cache->update_all;
+    *first = cache->dirty_first;
+    *last = cache->dirty_last;
+
+    cache->dirty_first = -1;
+    cache->dirty_last = -1;
+    cache->update_all = 0;
+
+    return usable ? cache : NULL;
+}
+
+lv_layout_cache_t * lv_layout_cache_alloc(lv_obj_t * cont, uint32_t size)
+{
+    if(lv_obj_get_child_count(cont) < LV_LAYOUT_CACHE_MIN_CHILDREN) {
+        lv_layout_cache_free(cont);
+        return NULL;
+    }
+
+    lv_layout_cache_t * cache = cont->spec_attr->layout_cache;
+    if(cache == NULL || cache->size != size) {
+        lv_layout_cache_t * new_cache = lv_realloc(cache, size);
+        if(new_cache == NULL) {
+            lv_layout_cache_free(cont);
+            return NULL;
+        }
+
+        if(cache == NULL) {
+            new_cache->dirty_first = -1;
+            new_cache->dirty_last = -1;
+            /*The children changed so far during this update were not recorded*/
+            new_cache->update_all = cont->layout_inv;
+        }
+        new_cache->size = size;
+        cache = new_cache;
+        cont->spec_attr->layout_cache = cache;
+    }
+
+    cache->layout = 0;
+    return cache;
+}
+
+void lv_layout_cache_free(lv_obj_t * cont)
+{
+    if(cont->spec_attr == NULL) return;
+
+    lv_free(cont->spec_attr->layout_cache);
+    cont->spec_attr->layout_cache = NULL;
+}
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILDREN*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
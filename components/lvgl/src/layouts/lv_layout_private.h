@@ -29,6 +29,22 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+
+/**
+ * Header of the data a layout keeps about a container to update only the changed children next time.
+ * The layout specific data follows the header in the same allocation.
+ */
+struct _lv_layout_cache_t {
+    uint32_t size;              /**< Size of the allocation including this header*/
+    uint32_t layout;            /**< The layout which filled the data, 0: not filled*/
+    int32_t dirty_first;        /**< Index of the first child changed since the last update, -1: none*/
+    int32_t dirty_last;         /**< Index of the last changed child*/
+    uint8_t update_all : 1;     /**< The container itself changed, the data can't be used*/
+};
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILDREN*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -47,6 +63,36 @@ void lv_layout_deinit(void);
  */
 void lv_layout_apply(lv_obj_t * obj);
 
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+
+/**
+ * Get the cache of a container if it was filled by `layout` and only some children changed since then.
+ * The changes are cleared, so the children changed during the update are kept for the next update.
+ * @param cont      pointer to a container
+ * @param layout    the layout being updated
+ * @param first     store the index of the first changed child here, -1 if none
+ * @param last      store the index of the last changed child here
+ * @return          pointer to the cache or NULL if all the children need to be updated
+ */
+lv_layout_cache_t * lv_layout_cache_get_dirty(lv_obj_t * cont, uint32_t layout, int32_t * first, int32_t * last);
+
+/**
+ * Get a cache for a container to save the result of a complete update into.
+ * @param cont      pointer to a container
+ * @param size      size of the cache including the `lv_layout_cache_t` header
+ * @return          pointer to the cache with `layout` = 0, or NULL if the container has
+ *                  less than `LV_LAYOUT_CACHE_MIN_CHILDREN` children or out of memory
+ */
+lv_layout_cache_t * lv_layout_cache_alloc(lv_obj_t * cont, uint32_t size);
+
+/**
+ * Free the cache of a container
+ * @param cont      pointer to a container
+ */
+void lv_layout_cache_free(lv_obj_t * cont);
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILDREN*/
+
 /**********************
  *      MACROS
  **********************/
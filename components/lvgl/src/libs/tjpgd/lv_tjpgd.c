@@ -14,6 +14,7 @@
 #include "tjpgd.h"
 #include "lv_tjpgd.h"
 #include "../../misc/lv_fs_private.h"
+#include "../../osal/lv_os_private.h"
 #include <string.h>
 
 /*********************
@@ -24,10 +25,50 @@
 
 #define TJPGD_WORKBUFF_SIZE             4096    //Recommended by TJPGD library
 
+/*Number of images whose MCU row checkpoints are kept*/
+#define TJPGD_ROW_CACHE_CNT             4
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * The decoder state at the start of an MCU row.
+ * Decoding can be continued from here without decoding the rows above.
+ */
+typedef struct {
+    uint32_t pos;           /**< Offset of the next unread byte in the stream, 0: unknown*/
+    uint32_t wreg;
+    int16_t dcv[3];
+    uint16_t rst;
+    uint16_t rsc;
+    uint8_t dbit;
+    uint8_t marker;
+} tjpgd_checkpoint_t;
+
+typedef struct {
+    lv_image_src_t src_type;
+    const void * src;       /**< The image descriptor or a copy of the path*/
+    uint16_t width;
+    uint16_t height;
+    uint32_t last_used;
+    uint32_t row_cnt;
+    tjpgd_checkpoint_t * rows;
+} tjpgd_image_rows_t;
+
+/**
+ * MCU row checkpoints of the recently decoded images.
+ * The images are drawn in bands (and tiles) which all open a new decoding session,
+ * so it's kept by the decoder, not by the session.
+ * Like the image header cache, it's identified by the source and cleared by `lv_image_cache_drop()`
+ * when the content of the source changes.
+ */
+typedef struct {
+    tjpgd_image_rows_t images[TJPGD_ROW_CACHE_CNT];
+    uint32_t use_cnt;
+    lv_mutex_t lock;
+} tjpgd_row_cache_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -39,6 +80,13 @@ static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 static void decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static size_t input_func(JDEC * jd, uint8_t * buff, size_t ndata);
 static int is_jpg(const uint8_t * raw_data, size_t len);
+#if JD_FASTDECODE >= 1
+    static void checkpoint_save(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, uint32_t row);
+    static uint32_t checkpoint_restore(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, uint32_t row);
+    static tjpgd_image_rows_t * row_cache_get(tjpgd_row_cache_t * cache, lv_image_decoder_dsc_t * dsc, bool create);
+    static void row_cache_image_free(tjpgd_image_rows_t * image);
+    static void decoder_drop(lv_image_decoder_t * decoder, const void * src);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -61,6 +109,14 @@ void lv_tjpgd_init(void)
     lv_image_decoder_set_close_cb(dec, decoder_close);
 
     dec->name = DECODER_NAME;
+
+#if JD_FASTDECODE >= 1
+    tjpgd_row_cache_t * cache = lv_malloc_zeroed(sizeof(tjpgd_row_cache_t));
+    LV_ASSERT_MALLOC(cache);
+    if(cache) lv_mutex_init(&cache->lock);
+    dec->user_data = cache;
+    lv_image_decoder_set_drop_cb(dec, decoder_drop);
+#endif
 }
 
 void lv_tjpgd_deinit(void)
@@ -68,6 +124,15 @@ void lv_tjpgd_deinit(void)
     lv_image_decoder_t * dec = NULL;
     while((dec = lv_image_decoder_get_next(dec)) != NULL) {
         if(dec->info_cb == decoder_info) {
+#if JD_FASTDECODE >= 1
+            tjpgd_row_cache_t * cache = dec->user_data;
+            if(cache) {
+                uint32_t i;
+                for(i = 0; i < TJPGD_ROW_CACHE_CNT; i++) row_cache_image_free(&cache->images[i]);
+                lv_mutex_delete(&cache->lock);
+                lv_free(cache);
+            }
+#endif
             lv_image_decoder_delete(dec);
             break;
         }
@@ -216,18 +281,16 @@ static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
                                     const lv_area_t * full_area, lv_area_t * decoded_area)
 {
     LV_UNUSED(decoder);
-    LV_UNUSED(full_area);
-
     JDEC * jd = dsc->user_data;
     lv_draw_buf_t * decoded = (void *)dsc->decoded;
 
-    uint32_t  mx, my;
+    int32_t mx, my;
     mx = jd->msx * 8;
     my = jd->msy * 8;         /* Size of the MCU (pixel) */
     if(decoded_area->y1 == LV_COORD_MIN) {
         decoded_area->y1 = 0;
         decoded_area->y2 = my - 1;
-        decoded_area->x1 = -((int32_t)mx);
+        decoded_area->x1 = -mx;
         decoded_area->x2 = -1;
         jd->scale = 0;
         jd->dcv[2] = jd->dcv[1] = jd->dcv[0] = 0;   /* Initialize DC values */
@@ -235,6 +298,7 @@ static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         jd->rsc = 0;
         if(decoded == NULL) {
             decoded = lv_malloc_zeroed(sizeof(lv_draw_buf_t));
+            if(decoded == NULL) return LV_RESULT_INVALID;
             dsc->decoded = decoded;
         }
         else {
@@ -244,40 +308,69 @@ static lv_result_t decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         }
         decoded->data = jd->workbuf;
         decoded->header = dsc->header;
+
+#if JD_FASTDECODE >= 1
+        /*Continue from the closest known MCU row above the area instead of the first row*/
+        if(full_area->y1 >= my) {
+            uint32_t row = checkpoint_restore(decoder, dsc, full_area->y1 / my);
+            decoded_area->y1 = row * my;
+            decoded_area->y2 = decoded_area->y1 + my - 1;
+        }
+#endif
     }
 
-    decoded_area->x1 += mx;
-    decoded_area->x2 += mx;
+    /*The MCUs are stored in the stream row by row, all of them has to be parsed,
+     *but only those in `full_area` are converted to RGB and returned*/
+    while(1) {
+        decoded_area->x1 += mx;
+        decoded_area->x2 = decoded_area->x1 + mx - 1;
+
+        if(decoded_area->x1 >= jd->width) {
+            decoded_area->x1 = 0;
+            decoded_area->x2 = mx - 1;
+            decoded_area->y1 += my;
+            decoded_area->y2 = decoded_area->y1 + my - 1;
+        }
 
-    if(decoded_area->x1 >= jd->width) {
-        decoded_area->x1 = 0;
-        decoded_area->x2 = mx - 1;
-        decoded_area->y1 += my;
-        decoded_area->y2 += my;
-    }
+        if(decoded_area->y1 >= jd->height) return LV_RESULT_INVALID;
 
-    if(decoded_area->x2 >= jd->width) decoded_area->x2 = jd->width - 1;
-    if(decoded_area->y2 >= jd->height) decoded_area->y2 = jd->height - 1;
+#if JD_FASTDECODE >= 1
+        if(decoded_area->x1 == 0 && decoded_area->y1 > 0) checkpoint_save(decoder, dsc, decoded_area->y1 / my);
+#endif
 
-    decoded->header.w = lv_area_get_width(decoded_area);
-    decoded->header.h = lv_area_get_height(decoded_area);
-    decoded->header.stride = decoded->header.w * 3;
-    decoded->data_size = decoded->header.stride * decoded->header.h;
+        /*The rest of the image is not needed*/
+        if(decoded_area->y1 > full_area->y2) return LV_RESULT_INVALID;
+
+        if(decoded_area->x2 >= jd->width) decoded_area->x2 = jd->width - 1;
+        if(decoded_area->y2 >= jd->height) decoded_area->y2 = jd->height - 1;
+
+        /* Process restart interval if enabled */
+        JRESULT rc;
+        if(jd->nrst && jd->rst++ == jd->nrst) {
+            rc = jd_restart(jd, jd->rsc++);
+            if(rc != JDR_OK) return LV_RESULT_INVALID;
+            jd->rst = 1;
+        }
 
-    /* Process restart interval if enabled */
-    JRESULT rc;
-    if(jd->nrst && jd->rst++ == jd->nrst) {
-        rc = jd_restart(jd, jd->rsc++);
+        bool visible = decoded_area->y2 >= full_area->y1 &&
+                       decoded_area->x2 >= full_area->x1 && decoded_area->x1 <= full_area->x2;
+
+        /* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
+        jd->skip_idct = !visible;
+        rc = jd_mcu_load(jd);
+        jd->skip_idct = 0;
         if(rc != JDR_OK) return LV_RESULT_INVALID;
-        jd->rst = 1;
+
+        if(visible) break;
     }
 
-    /* Load an MCU (decompress huffman coded stream, dequantize and apply IDCT) */
-    rc = jd_mcu_load(jd);
-    if(rc != JDR_OK) return LV_RESULT_INVALID;
+    decoded->header.w = lv_area_get_width(decoded_area);
+    decoded->header.h = lv_area_get_height(decoded_area);
+    decoded->header.stride = decoded->header.w * 3;
+    decoded->data_size = decoded->header.stride * decoded->header.h;
 
     /* Output the MCU (YCbCr to RGB, scaling and output) */
-    rc = jd_mcu_output(jd, NULL, decoded_area->x1, decoded_area->y1);
+    JRESULT rc = jd_mcu_output(jd, NULL, decoded_area->x1, decoded_area->y1);
     if(rc != JDR_OK) return LV_RESULT_INVALID;
 
     return LV_RESULT_OK;
@@ -306,4 +399,161 @@ static int is_jpg(const uint8_t * raw_data, size_t len)
     return memcmp(jpg_signature, raw_data, sizeof(jpg_signature)) == 0;
 }
 
+#if JD_FASTDECODE >= 1
+
+/**
+ * Remember the state of the decoder at the start of an MCU row
+ * @param decoder   pointer to the decoder
+ * @param dsc       pointer to the decoder descriptor, the decoder is just before the first MCU of `row`
+ * @param row       index of the MCU row
+ */
+static void checkpoint_save(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, uint32_t row)
+{
+    tjpgd_row_cache_t * cache = decoder->user_data;
+    if(cache == NULL) return;
+
+    JDEC * jd = dsc->user_data;
+
+    lv_mutex_lock(&cache->lock);
+    tjpgd_image_rows_t * image = row_cache_get(cache, dsc, true);
+    if(image && row < image->row_cnt && image->rows[row].pos == 0) {
+        uint32_t pos = 0;
+        lv_fs_tell(jd->device, &pos);
+
+        tjpgd_checkpoint_t * cp = &image->rows[row];
+        cp->pos = pos - (uint32_t)jd->dctr;    /*The unread bytes of the input buffer*/
+        cp->wreg = jd->wreg;
+        cp->dbit = jd->dbit;
+        cp->marker = jd->marker;
+        cp->rst = jd->rst;
+        cp->rsc = jd->rsc;
+        lv_memcpy(cp->dcv, jd->dcv, sizeof(cp->dcv));
+    }
+    lv_mutex_unlock(&cache->lock);
+}
+
+/**
+ * Set the decoder to the start of the closest known MCU row above a row
+ * @param decoder   pointer to the decoder
+ * @param dsc       pointer to the decoder descriptor, the decoder is before the first MCU
+ * @param row       index of the MCU row to continue from
+ * @return          index of the row the decoder continues from (0 if none of the rows above is known)
+ */
+static uint32_t checkpoint_restore(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, uint32_t row)
+{
+    tjpgd_row_cache_t * cache = decoder->user_data;
+    if(cache == NULL) return 0;
+
+    JDEC * jd = dsc->user_data;
+
+    lv_mutex_lock(&cache->lock);
+    tjpgd_image_rows_t * image = row_cache_get(cache, dsc, false);
+    if(image == NULL) {
+        lv_mutex_unlock(&cache->lock);
+        return 0;
+    }
+
+    if(row >= image->row_cnt) row = image->row_cnt - 1;
+    while(row > 0 && image->rows[row].pos == 0) row--;
+
+    if(row > 0) {
+        tjpgd_checkpoint_t * cp = &image->rows[row];
+        lv_fs_seek(jd->device, cp->pos, LV_FS_SEEK_SET);
+        jd->dptr = jd->inbuf;
+        jd->dctr = 0;
+        jd->wreg = cp->wreg;
+        jd->dbit = cp->dbit;
+        jd->marker = cp->marker;
+        jd->rst = cp->rst;
+        jd->rsc = cp->rsc;
+        lv_memcpy(jd->dcv, cp->dcv, sizeof(jd->dcv));
+    }
+    lv_mutex_unlock(&cache->lock);
+
+    return row;
+}
+
+/**
+ * Find the row checkpoints of the image of a decoding session
+ * @param cache     pointer to the row cache
+ * @param dsc       pointer to the decoder descriptor
+ * @param create    true: replace the least recently used image if not found
+ * @return          pointer to the row checkpoints or NULL if not found or out of memory
+ */
+static tjpgd_image_rows_t * row_cache_get(tjpgd_row_cache_t * cache, lv_image_decoder_dsc_t * dsc, bool create)
+{
+    JDEC * jd = dsc->user_data;
+
+    tjpgd_image_rows_t * lru = &cache->images[0];
+    uint32_t i;
+    for(i = 0; i < TJPGD_ROW_CACHE_CNT; i++) {
+        tjpgd_image_rows_t * image = &cache->images[i];
+        if(image->rows && image->src_type == dsc->src_type &&
+           image->width == jd->width && image->height == jd->height) {
+            bool same = dsc->src_type == LV_IMAGE_SRC_FILE ? lv_strcmp(image->src, dsc->src) == 0 : image->src == dsc->src;
+            if(same) {
+                image->last_used = ++cache->use_cnt;
+                return image;
+            }
+        }
+
+        if(image->last_used < lru->last_used) lru = image;
+    }
+
+    if(!create) return NULL;
+
+    row_cache_image_free(lru);
+
+    uint32_t row_cnt = (jd->height + jd->msy * 8 - 1) / (jd->msy * 8);
+    lru->rows = lv_malloc_zeroed(row_cnt * sizeof(tjpgd_checkpoint_t));
+    lru->src = dsc->src_type == LV_IMAGE_SRC_FILE ? lv_strdup(dsc->src) : dsc->src;
+    if(lru->rows == NULL || lru->src == NULL) {
+        row_cache_image_free(lru);
+        return NULL;
+    }
+
+    lru->src_type = dsc->src_type;
+    lru->width = jd->width;
+    lru->height = jd->height;
+    lru->row_cnt = row_cnt;
+    lru->last_used = ++cache->use_cnt;
+    return lru;
+}
+
+static void row_cache_image_free(tjpgd_image_rows_t * image)
+{
+    if(image->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)image->src);
+    lv_free(image->rows);
+    lv_memzero(image, sizeof(tjpgd_image_rows_t));
+}
+
+/**
+ * Forget the row checkpoints of an image whose content has changed
+ * @param decoder   pointer to the decoder
+ * @param src       the image source, NULL: all images
+ */
+static void decoder_drop(lv_image_decoder_t * decoder, const void * src)
+{
+    tjpgd_row_cache_t * cache = decoder->user_data;
+    if(cache == NULL) return;
+
+    lv_image_src_t src_type = src ? lv_image_src_get_type(src) : LV_IMAGE_SRC_UNKNOWN;
+
+    lv_mutex_lock(&cache->lock);
+    uint32_t i;
+    for(i = 0; i < TJPGD_ROW_CACHE_CNT; i++) {
+        tjpgd_image_rows_t * image = &cache->images[i];
+        if(image->rows == NULL) continue;
+        if(src != NULL) {
+            if(image->src_type != src_type) continue;
+            bool same = src_type == LV_IMAGE_SRC_FILE ? lv_strcmp(image->src, src) == 0 : image->src == src;
+            if(!same) continue;
+        }
+        row_cache_image_free(image);
+    }
+    lv_mutex_unlock(&cache->lock);
+}
+
+#endif /*JD_FASTDECODE >= 1*/
+
 #endif /*LV_USE_TJPGD*/
@@ -793,7 +793,7 @@ JRESULT jd_mcu_load(
                 }
             } while(++z < 64);      /* Next AC element */
 
-            if(JD_FORMAT != 2 || !cmp) {    /* C components may not be processed if in grayscale output */
+            if(!jd->skip_idct && (JD_FORMAT != 2 || !cmp)) {    /* C components may not be processed if in grayscale output */
                 if(z == 1 || (JD_USE_SCALE &&
                               jd->scale ==
                               3)) {    /* If no AC element or scale ratio is 1/8, IDCT can be omitted and the block is filled with DC value */
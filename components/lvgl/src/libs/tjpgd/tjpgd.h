@@ -63,6 +63,7 @@ struct JDEC {
     uint16_t nrst;              /* Restart interval */
     uint16_t rst;              /* Restart count*/
     uint16_t rsc;               /* Expected restart sequence ID*/
+    uint8_t skip_idct;          /* Only parse the MCU to advance the stream, it won't be output */
     uint16_t width, height;     /* Size of the input image (pixel) */
     uint8_t * huffbits[2][2];   /* Huffman bit distribution tables [id][dcac] */
     uint16_t * huffcode[2][2];  /* Huffman code word tables [id][dcac] */
@@ -228,8 +228,67 @@
             #endif
         #endif
     #endif
+
+    /** Size of a second pool only for the allocations of at least `LV_MEM_LARGE_THRESHOLD` bytes
+     *  (draw buffers, decoded images, caches) in bytes. Freed large buffers are not split by
+     *  small objects this way, so the pools fragment much less. The pools are each other's reserve.
+     *  0: one pool for all allocations. */
+    #ifndef LV_MEM_LARGE_SIZE
+        #ifdef CONFIG_LV_MEM_LARGE_SIZE
+            #define LV_MEM_LARGE_SIZE CONFIG_LV_MEM_LARGE_SIZE
+        #else
+            #define LV_MEM_LARGE_SIZE 0
+        #endif
+    #endif
+    #if LV_MEM_LARGE_SIZE
+        #ifndef LV_MEM_LARGE_THRESHOLD
+            #ifdef CONFIG_LV_MEM_LARGE_THRESHOLD
+                #define LV_MEM_LARGE_THRESHOLD CONFIG_LV_MEM_LARGE_THRESHOLD
+            #else
+                #define LV_MEM_LARGE_THRESHOLD 2048     /**< [bytes] */
+            #endif
+        #endif
+        /* A memory allocator to get the large pool, e.g. from external RAM. Else it's an array with `LV_ATTRIBUTE_LARGE_RAM_ARRAY` */
+        #ifndef LV_MEM_LARGE_POOL_ALLOC
+            #ifdef CONFIG_LV_MEM_LARGE_POOL_ALLOC
+                #define LV_MEM_LARGE_POOL_ALLOC CONFIG_LV_MEM_LARGE_POOL_ALLOC
+            #else
+                #undef LV_MEM_LARGE_POOL_ALLOC
+            #endif
+        #endif
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** Allocate the widgets, their local styles and special attributes, the event descriptors,
+ *  timers and animations from pools of same-size blocks (slabs) instead of one by one with `lv_malloc()`.
+ *  Creating and deleting screens gets faster and the small objects don't fragment the heap.
+ *  The unused chunks can be given back with `lv_slab_trim_all()`. */
+#ifndef LV_USE_SLAB
+    #ifdef CONFIG_LV_USE_SLAB
+        #define LV_USE_SLAB CONFIG_LV_USE_SLAB
+    #else
+        #define LV_USE_SLAB 0
+    #endif
+#endif
+#if LV_USE_SLAB
+    /** Number of blocks allocated at once by a slab */
+    #ifndef LV_SLAB_BLOCK_CNT
+        #ifdef CONFIG_LV_SLAB_BLOCK_CNT
+            #define LV_SLAB_BLOCK_CNT CONFIG_LV_SLAB_BLOCK_CNT
+        #else
+            #define LV_SLAB_BLOCK_CNT 16
+        #endif
+    #endif
+    /** Number of different widget instance sizes with their own slab. The others use `lv_malloc()` */
+    #ifndef LV_SLAB_OBJ_SIZE_CNT
+        #ifdef CONFIG_LV_SLAB_OBJ_SIZE_CNT
+            #define LV_SLAB_OBJ_SIZE_CNT CONFIG_LV_SLAB_OBJ_SIZE_CNT
+        #else
+            #define LV_SLAB_OBJ_SIZE_CNT 16
+        #endif
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -557,6 +616,53 @@
         #endif
     #endif
 
+    /** Pin the SW draw threads to CPU cores (if the OS layer supports it).
+     *  Thread `i` runs on core `(LV_DRAW_SW_THREAD_FIRST_CORE + i) % core count`. */
+    #ifndef LV_DRAW_SW_THREAD_PIN
+        #ifdef CONFIG_LV_DRAW_SW_THREAD_PIN
+            #define LV_DRAW_SW_THREAD_PIN CONFIG_LV_DRAW_SW_THREAD_PIN
+        #else
+            #define LV_DRAW_SW_THREAD_PIN           0
+        #endif
+    #endif
+    #ifndef LV_DRAW_SW_THREAD_FIRST_CORE
+        #ifdef CONFIG_LV_DRAW_SW_THREAD_FIRST_CORE
+            #define LV_DRAW_SW_THREAD_FIRST_CORE CONFIG_LV_DRAW_SW_THREAD_FIRST_CORE
+        #else
+            #define LV_DRAW_SW_THREAD_FIRST_CORE    0
+        #endif
+    #endif
+
+    /** Priority of the SW draw threads. */
+    #ifndef LV_DRAW_SW_THREAD_PRIO
+        #ifdef CONFIG_LV_DRAW_SW_THREAD_PRIO
+            #define LV_DRAW_SW_THREAD_PRIO CONFIG_LV_DRAW_SW_THREAD_PRIO
+        #else
+            #define LV_DRAW_SW_THREAD_PRIO      LV_DRAW_THREAD_PRIO
+        #endif
+    #endif
+
+    /** When a draw thread is free, look at up to this many available tasks and take the
+     *  one closest to the area the thread rendered last (keeps its cache warm).
+     *  0: take the first available task. */
+    #ifndef LV_DRAW_SW_LOCALITY_LOOKAHEAD
+        #ifdef CONFIG_LV_DRAW_SW_LOCALITY_LOOKAHEAD
+            #define LV_DRAW_SW_LOCALITY_LOOKAHEAD CONFIG_LV_DRAW_SW_LOCALITY_LOOKAHEAD
+        #else
+            #define LV_DRAW_SW_LOCALITY_LOOKAHEAD   0
+        #endif
+    #endif
+
+    /** Collect per draw thread task, pixel, busy and idle statistics.
+     *  See `lv_draw_sw_get_thread_stats()`. */
+    #ifndef LV_DRAW_SW_STATS
+        #ifdef CONFIG_LV_DRAW_SW_STATS
+            #define LV_DRAW_SW_STATS CONFIG_LV_DRAW_SW_STATS
+        #else
+            #define LV_DRAW_SW_STATS            0
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -1456,6 +1562,18 @@
     #endif
 #endif
 
+/** Default glyph cache size in bytes. The glyphs of the built-in and BIN fonts are decoded to A8
+ *  on every draw. The glyph cache keeps the decoded bitmaps of the recently drawn glyphs.
+ *  Each glyph needs its A8 bitmap (box width rounded up to the stride x box height) + ~40 bytes.
+ *  0: disable the glyph cache. */
+#ifndef LV_GLYPH_CACHE_DEF_SIZE
+    #ifdef CONFIG_LV_GLYPH_CACHE_DEF_SIZE
+        #define LV_GLYPH_CACHE_DEF_SIZE CONFIG_LV_GLYPH_CACHE_DEF_SIZE
+    #else
+        #define LV_GLYPH_CACHE_DEF_SIZE 0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1489,6 +1607,16 @@
     #endif
 #endif
 
+/** Number of entries (power of 2) in a global cache of resolved style values returned by
+ *  `lv_obj_get_style_prop()`. Each entry takes 16 bytes on 32-bit targets. 0: disable */
+#ifndef LV_OBJ_STYLE_VALUE_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_VALUE_CACHE
+        #define LV_OBJ_STYLE_VALUE_CACHE CONFIG_LV_OBJ_STYLE_VALUE_CACHE
+    #else
+        #define LV_OBJ_STYLE_VALUE_CACHE 0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -2714,6 +2842,17 @@
     #endif
 #endif
 
+/** Flex and grid containers with at least this many children keep the sizes and tracks of their last update.
+ *  When only some children change, only those and the items after them in the same track are placed again.
+ *  Costs about 32 bytes per child for flex and 8 bytes per track for grid. 0: disable. */
+#ifndef LV_LAYOUT_CACHE_MIN_CHILDREN
+    #ifdef CONFIG_LV_LAYOUT_CACHE_MIN_CHILDREN
+        #define LV_LAYOUT_CACHE_MIN_CHILDREN CONFIG_LV_LAYOUT_CACHE_MIN_CHILDREN
+    #else
+        #define LV_LAYOUT_CACHE_MIN_CHILDREN 0
+    #endif
+#endif
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -9,6 +9,8 @@
 #include "misc/lv_timer_private.h"
 #include "misc/lv_profiler_builtin_private.h"
 #include "misc/lv_anim_private.h"
+#include "misc/lv_event_private.h"
+#include "misc/lv_slab_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
@@ -17,6 +19,7 @@
 #include "lv_init.h"
 #include "core/lv_global.h"
 #include "core/lv_obj.h"
+#include "core/lv_obj_private.h"
 #include "display/lv_display_private.h"
 #include "indev/lv_indev_private.h"
 #include "layouts/lv_layout_private.h"
@@ -136,6 +139,12 @@ static inline void lv_global_init(lv_global_t * global)
     lv_ll_init(&(global->disp_ll), sizeof(lv_display_t));
     lv_ll_init(&(global->indev_ll), sizeof(lv_indev_t));
 
+#if LV_USE_SLAB
+    lv_slab_init(&global->spec_attr_slab, sizeof(lv_obj_spec_attr_t));
+    lv_slab_init(&global->style_slab, sizeof(lv_style_t));
+    lv_slab_init(&global->event_dsc_slab, sizeof(lv_event_dsc_t));
+#endif
+
     global->memory_zero = ZERO_MEM_SENTINEL;
     global->style_refresh = true;
     global->layout_count = LV_LAYOUT_LAST;
@@ -294,6 +303,7 @@ void lv_init(void)
 #endif
 
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
+    lv_glyph_cache_init(LV_GLYPH_CACHE_DEF_SIZE);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
 #if LV_USE_DRAW_VG_LITE
@@ -463,7 +473,12 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_TJPGD
+    lv_tjpgd_deinit();
+#endif
+
     lv_image_decoder_deinit();
+    lv_glyph_cache_deinit();
 
     lv_refr_deinit();
 
@@ -511,6 +526,14 @@ void lv_deinit(void)
 
     lv_timer_core_deinit();
 
+#if LV_USE_SLAB
+    uint32_t i;
+    for(i = 0; i < LV_SLAB_OBJ_SIZE_CNT; i++) lv_slab_deinit(&LV_GLOBAL_DEFAULT()->obj_slabs[i]);
+    lv_slab_deinit(&LV_GLOBAL_DEFAULT()->spec_attr_slab);
+    lv_slab_deinit(&LV_GLOBAL_DEFAULT()->style_slab);
+    lv_slab_deinit(&LV_GLOBAL_DEFAULT()->event_dsc_slab);
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
     lv_profiler_builtin_uninit();
 #endif
@@ -12,5 +12,6 @@
 
 #include "lv_image_header_cache.h"
 #include "lv_image_cache.h"
+#include "lv_glyph_cache.h"
 
 #endif //LV_CACHE_INSTANCE_H
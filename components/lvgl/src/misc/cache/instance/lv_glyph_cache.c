@@ -0,0 +1,296 @@
+/**
+* @file lv_glyph_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_cache_private.h"
+#include "../../lv_assert.h"
+#include "../../../core/lv_global.h"
+#include "../../../misc/lv_iter.h"
+#include "../../../font/lv_font_fmt_txt.h"
+
+#include "lv_glyph_cache_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "GLYPH"
+
+#define glyph_cache_p (LV_GLOBAL_DEFAULT()->glyph_cache)
+#define glyph_lookup_cnt (LV_GLOBAL_DEFAULT()->glyph_cache_lookup_cnt)
+#define glyph_miss_cnt (LV_GLOBAL_DEFAULT()->glyph_cache_miss_cnt)
+#define glyph_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->glyph_cache_draw_buf_handlers)
+
+/*Glyphs are looked up from every SW draw thread, outside of the cache lock*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define cnt_inc(cnt)        __atomic_fetch_add(&(cnt), 1, __ATOMIC_RELAXED)
+    #define cnt_take(cnt, reset) ((reset) ? __atomic_exchange_n(&(cnt), 0, __ATOMIC_RELAXED) : \
+                                  __atomic_load_n(&(cnt), __ATOMIC_RELAXED))
+#else
+    #define cnt_inc(cnt)        cnt_locked_take(&(cnt), false, 1)
+    #define cnt_take(cnt, reset) cnt_locked_take(&(cnt), reset, 0)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_slot_size_t slot;  /**< Must be the first field: the size of the entry for the cache*/
+    const lv_font_t * font;
+    uint32_t gid;
+    uint16_t box_w;
+    uint16_t box_h;
+    lv_draw_buf_t * draw_buf;   /**< The A8 bitmap of the glyph*/
+} lv_glyph_cache_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool glyph_cache_create_cb(lv_glyph_cache_data_t * data, void * user_data);
+static void glyph_cache_free_cb(lv_glyph_cache_data_t * data, void * user_data);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const lv_glyph_cache_data_t * lhs,
+                                                     const lv_glyph_cache_data_t * rhs);
+static void iter_inspect_cb(void * elem);
+#if !defined(__GNUC__) && !defined(__clang__)
+    static uint32_t cnt_locked_take(uint32_t * cnt, bool reset, uint32_t add);
+#endif
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_glyph_cache_init(uint32_t size)
+{
+    if(glyph_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_glyph_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb,
+    });
+
+    lv_cache_set_name(glyph_cache_p, CACHE_NAME);
+    return glyph_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_glyph_cache_deinit(void)
+{
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_destroy(glyph_cache_p, NULL);
+    glyph_cache_p = NULL;
+}
+
+void lv_glyph_cache_resize(uint32_t new_size, bool evict_now)
+{
+    lv_cache_set_max_size(glyph_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(glyph_cache_p, new_size, NULL);
+    }
+}
+
+void lv_glyph_cache_drop(const lv_font_t * font)
+{
+    if(glyph_cache_p == NULL) return;
+
+    if(font == NULL) {
+        lv_cache_drop_all(glyph_cache_p, NULL);
+        return;
+    }
+
+    /*Dropping invalidates the iterator, so restart after every match.
+     *Fonts are rarely deleted and the cache is small.*/
+    lv_glyph_cache_data_t * data = lv_malloc(lv_cache_entry_get_size(glyph_cache_p->node_size));
+    LV_ASSERT_MALLOC(data);
+    if(data == NULL) return;
+
+    bool found;
+    do {
+        found = false;
+        lv_iter_t * iter = lv_cache_iter_create(glyph_cache_p);
+        if(iter == NULL) break;
+        while(lv_iter_next(iter, data) == LV_RESULT_OK) {
+            if(data->font == font) {
+                found = true;
+                break;
+            }
+        }
+        lv_iter_destroy(iter);
+
+        if(found) lv_cache_drop(glyph_cache_p, data, NULL);
+    } while(found);
+
+    lv_free(data);
+}
+
+bool lv_glyph_cache_is_enabled(void)
+{
+    return glyph_cache_p != NULL && lv_cache_is_enabled(glyph_cache_p);
+}
+
+void lv_glyph_cache_get_stats(lv_glyph_cache_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+
+    /*A lookup is counted before its miss, so taking the misses first keeps `hit_cnt` from underflowing*/
+    uint32_t miss_cnt = cnt_take(glyph_miss_cnt, reset);
+    stats->lookup_cnt = cnt_take(glyph_lookup_cnt, reset);
+    stats->hit_cnt = stats->lookup_cnt - miss_cnt;
+    stats->size = glyph_cache_p ? (uint32_t)lv_cache_get_size(glyph_cache_p, NULL) : 0;
+    stats->max_size = glyph_cache_p ? (uint32_t)lv_cache_get_max_size(glyph_cache_p, NULL) : 0;
+}
+
+void lv_glyph_cache_dump(void)
+{
+    if(glyph_cache_p == NULL) return;
+
+    lv_iter_t * iter = lv_cache_iter_create(glyph_cache_p);
+    if(iter == NULL) return;
+
+    LV_LOG_USER("Glyph cache dump:");
+    LV_LOG_USER("\tsize\tdata_size\trc\tgid\tfont");
+    lv_iter_inspect(iter, iter_inspect_cb);
+    lv_iter_destroy(iter);
+}
+
+lv_draw_buf_t * lv_glyph_cache_get_bitmap(lv_font_glyph_dsc_t * g_dsc)
+{
+    const lv_font_t * font = g_dsc->resolved_font;
+
+    /*Only the glyphs of the fonts which decode their bitmaps on every draw and
+     *identify them by `gid.index`. Font engines with own cache (FreeType, Tiny TTF) have `release_glyph`*/
+    if(font == NULL || font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt || font->release_glyph) return NULL;
+    /*Static bitmaps are already addressable, copying them to the cache would only waste memory*/
+    if(lv_font_has_static_bitmap(font)) return NULL;
+    if(g_dsc->format <= LV_FONT_GLYPH_FORMAT_NONE || g_dsc->format > LV_FONT_GLYPH_FORMAT_A8) return NULL;
+    if(g_dsc->box_w == 0 || g_dsc->box_h == 0) return NULL;
+    if(!lv_glyph_cache_is_enabled()) return NULL;
+
+    /*The font engine writes the bitmap with the stride of the default handlers*/
+    uint32_t stride = lv_draw_buf_width_to_stride(g_dsc->box_w, LV_COLOR_FORMAT_A8);
+    lv_glyph_cache_data_t search_key = {
+        .slot.size = sizeof(lv_draw_buf_t) + stride * g_dsc->box_h,
+        .font = font,
+        .gid = g_dsc->gid.index,
+        .box_w = g_dsc->box_w,
+        .box_h = g_dsc->box_h,
+    };
+
+    cnt_inc(glyph_lookup_cnt);
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache_p, &search_key, g_dsc);
+    if(entry == NULL) return NULL;
+
+    g_dsc->entry = entry;
+    lv_glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+void lv_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc)
+{
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool glyph_cache_create_cb(lv_glyph_cache_data_t * data, void * user_data)
+{
+    lv_font_glyph_dsc_t * g_dsc = user_data;
+    cnt_inc(glyph_miss_cnt);
+
+    uint32_t stride = lv_draw_buf_width_to_stride(data->box_w, LV_COLOR_FORMAT_A8);
+    data->draw_buf = lv_draw_buf_create_ex(glyph_cache_draw_buf_handlers, data->box_w, data->box_h,
+                                           LV_COLOR_FORMAT_A8, stride);
+    if(data->draw_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate a %dx%d glyph", data->box_w, data->box_h);
+        return false;
+    }
+
+    const uint8_t save_req = g_dsc->req_raw_bitmap;
+    g_dsc->req_raw_bitmap = 0;
+    const void * bitmap = data->font->get_glyph_bitmap(g_dsc, data->draw_buf);
+    g_dsc->req_raw_bitmap = save_req;
+
+    return bitmap != NULL;
+}
+
+static void glyph_cache_free_cb(lv_glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    if(data->draw_buf) {
+        lv_draw_buf_destroy(data->draw_buf);
+        data->draw_buf = NULL;
+    }
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const lv_glyph_cache_data_t * lhs,
+                                                     const lv_glyph_cache_data_t * rhs)
+{
+    if(lhs->font != rhs->font) {
+        return lhs->font > rhs->font ? 1 : -1;
+    }
+
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+
+    /*Never return a bitmap of a different size than the caller expects*/
+    if(lhs->box_w != rhs->box_w) {
+        return lhs->box_w > rhs->box_w ? 1 : -1;
+    }
+
+    if(lhs->box_h != rhs->box_h) {
+        return lhs->box_h > rhs->box_h ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static void iter_inspect_cb(void * elem)
+{
+    lv_glyph_cache_data_t * data = (lv_glyph_cache_data_t *)elem;
+    lv_cache_entry_t * entry = lv_cache_entry_get_entry(data, glyph_cache_p->node_size);
+
+    LV_UNUSED(entry);
+
+    /*  size    data_size   rc  gid font*/
+    LV_LOG_USER("\t%4dx%-4d\t%9"LV_PRIu32"\t%"LV_PRId32"\t%"LV_PRIu32"\t%p", data->box_w, data->box_h,
+                (uint32_t)data->slot.size, lv_cache_entry_get_ref(entry), data->gid, (void *)data->font);
+}
+
+#if !defined(__GNUC__) && !defined(__clang__)
+static uint32_t cnt_locked_take(uint32_t * cnt, bool reset, uint32_t add)
+{
+    /*The cache lock is recursive, the misses are counted while it's already held*/
+    if(glyph_cache_p) lv_mutex_lock(&glyph_cache_p->lock);
+    uint32_t v = *cnt;
+    *cnt = reset ? 0 : v + add;
+    if(glyph_cache_p) lv_mutex_unlock(&glyph_cache_p->lock);
+    return v;
+}
+#endif
@@ -0,0 +1,95 @@
+/**
+* @file lv_glyph_cache.h
+*
+ */
+
+#ifndef LV_GLYPH_CACHE_H
+#define LV_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t lookup_cnt;    /**< Glyph bitmaps requested since the last reset*/
+    uint32_t hit_cnt;       /**< Glyph bitmaps served from the cache since the last reset*/
+    uint32_t size;          /**< Bytes used by the cached glyphs*/
+    uint32_t max_size;      /**< Size of the cache in bytes*/
+} lv_glyph_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the glyph cache. The glyph cache keeps the A8 bitmaps of the glyphs of
+ * `lv_font_fmt_txt` fonts (built-in and BIN fonts) so that they are decoded only once.
+ * @param  size size of the cache in bytes. 0: the cache is disabled.
+ * @return LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_glyph_cache_init(uint32_t size);
+
+/**
+ * Deinitialize the glyph cache and free the cached glyphs.
+ */
+void lv_glyph_cache_deinit(void);
+
+/**
+ * Resize the glyph cache.
+ * If set to 0, the cache will be disabled.
+ * @param new_size  new size of the cache in bytes.
+ * @param evict_now true: evict the glyphs which should be removed by the eviction policy, false: wait for the next cache cleanup.
+ */
+void lv_glyph_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Drop the cached glyphs of a font. Needs to be called before a font is deleted.
+ * @param font  pointer to a font, NULL to drop all glyphs.
+ */
+void lv_glyph_cache_drop(const lv_font_t * font);
+
+/**
+ * Return true if the glyph cache is enabled.
+ * @return true: enabled, false: disabled.
+ */
+bool lv_glyph_cache_is_enabled(void);
+
+/**
+ * Get the usage and the hit rate of the glyph cache.
+ * @param stats     store the statistics here
+ * @param reset     true: reset the lookup and hit counters
+ */
+void lv_glyph_cache_get_stats(lv_glyph_cache_stats_t * stats, bool reset);
+
+/**
+ * Dump the content of the glyph cache in a human-readable format with cache order.
+ */
+void lv_glyph_cache_dump(void);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GLYPH_CACHE_H*/
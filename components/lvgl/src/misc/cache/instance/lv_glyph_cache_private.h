@@ -0,0 +1,56 @@
+/**
+* @file lv_glyph_cache_private.h
+*
+ */
+
+#ifndef LV_GLYPH_CACHE_PRIVATE_H
+#define LV_GLYPH_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_glyph_cache.h"
+#include "../../../font/lv_font.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the A8 bitmap of a glyph from the glyph cache, decode it on a miss.
+ * The entry is stored in `g_dsc->entry` and needs to be released with `lv_glyph_cache_release()`.
+ * Used by `lv_font_get_glyph_bitmap()`.
+ * @param g_dsc     the glyph descriptor
+ * @return          the cached draw buffer, or NULL if the glyph isn't cached (e.g. static bitmap fonts)
+ */
+lv_draw_buf_t * lv_glyph_cache_get_bitmap(lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Release the glyph acquired by `lv_glyph_cache_get_bitmap()`.
+ * Used by `lv_font_glyph_release_draw_data()`.
+ * @param g_dsc     the glyph descriptor
+ */
+void lv_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GLYPH_CACHE_PRIVATE_H*/
@@ -79,8 +79,9 @@ void lv_image_cache_resize(uint32_t new_size, bool evict_now)
 
 void lv_image_cache_drop(const void * src)
 {
-    /*If user invalidate image, the header cache should be invalidated too.*/
+    /*If user invalidate image, the header cache and what the decoders keep about it should be invalidated too.*/
     lv_image_header_cache_drop(src);
+    lv_image_decoder_drop(src);
 
     if(src == NULL) {
         lv_cache_drop_all(img_cache_p, NULL);
@@ -70,6 +70,10 @@ static void remove_anim(void * a);
 void lv_anim_core_init(void)
 {
     lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+#if LV_USE_SLAB
+    lv_slab_init(&state.slab, lv_ll_get_node_alloc_size(anim_ll_p));
+    lv_ll_set_slab(anim_ll_p, &state.slab);
+#endif
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
     state.anim_list_changed = false;
@@ -79,6 +83,9 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+#if LV_USE_SLAB
+    lv_slab_deinit(&state.slab);
+#endif
 }
 
 void lv_anim_enable_vsync_mode(bool enable)
@@ -680,7 +687,7 @@ static void anim_completed_handler(lv_anim_t * a)
         /*Call the callback function at the end*/
         if(a->completed_cb != NULL) a->completed_cb(a);
         if(a->deleted_cb != NULL) a->deleted_cb(a);
-        lv_free(a);
+        lv_ll_free_node(anim_ll_p, a);
     }
     /*If the animation is not deleted then restart it*/
     else {
@@ -797,7 +804,7 @@ static bool remove_concurrent_anims(const lv_anim_t * a_current)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
             lv_ll_remove(anim_ll_p, a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
+            lv_ll_free_node(anim_ll_p, a);
             /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
             anim_mark_list_change();
 
@@ -818,5 +825,5 @@ static void remove_anim(void * a)
     lv_anim_t * anim = a;
     lv_ll_remove(anim_ll_p, a);
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
-    lv_free(a);
+    lv_ll_free_node(anim_ll_p, a);
 }
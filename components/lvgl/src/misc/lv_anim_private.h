@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_anim.h"
+#include "lv_slab_private.h"
 
 /*********************
  *      DEFINES
@@ -30,6 +31,9 @@ typedef struct {
     bool anim_vsync_registered;
     lv_timer_t * timer;
     lv_ll_t anim_ll;
+#if LV_USE_SLAB
+    lv_slab_t slab;     /**< The nodes of `anim_ll`*/
+#endif
 } lv_anim_state_t;
 
 /**********************
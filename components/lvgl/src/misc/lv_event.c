@@ -35,6 +35,7 @@ static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc);
 static bool event_is_marked_deleting(lv_event_dsc_t * dsc);
 static uint32_t event_array_size(lv_event_list_t * list);
 static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index);
+static void event_dsc_free(lv_event_dsc_t * dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -143,7 +144,11 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event_code_t filter,
                               void * user_data)
 {
+#if LV_USE_SLAB
+    lv_event_dsc_t * dsc = lv_slab_alloc(&LV_GLOBAL_DEFAULT()->event_dsc_slab);
+#else
     lv_event_dsc_t * dsc = lv_malloc(sizeof(lv_event_dsc_t));
+#endif
     LV_ASSERT_NULL(dsc);
 
     dsc->cb = cb;
@@ -402,7 +407,7 @@ static void cleanup_event_list_core(lv_array_t * array)
     for(uint32_t i = 0; i < size; i++) {
         lv_event_dsc_t ** dsc_i = lv_array_at(array, i);
         lv_event_dsc_t ** dsc_kept = lv_array_at(array, kept_count);
-        if(event_is_marked_deleting(*dsc_i)) lv_free(*dsc_i);
+        if(event_is_marked_deleting(*dsc_i)) event_dsc_free(*dsc_i);
         else {
             *dsc_kept = *dsc_i;
             kept_count++;
@@ -440,3 +445,12 @@ static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index)
 {
     return lv_array_at(&list->array, index);
 }
+
+static void event_dsc_free(lv_event_dsc_t * dsc)
+{
+#if LV_USE_SLAB
+    lv_slab_free(&LV_GLOBAL_DEFAULT()->event_dsc_slab, dsc);
+#else
+    lv_free(dsc);
+#endif
+}
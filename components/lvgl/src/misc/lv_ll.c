@@ -8,6 +8,8 @@
  *      INCLUDES
  *********************/
 #include "lv_ll.h"
+#include "lv_slab.h"
+#include "lv_assert.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -26,6 +28,7 @@
  **********************/
 static void node_set_prev(lv_ll_t * ll_p, lv_ll_node_t * act, lv_ll_node_t * prev);
 static void node_set_next(lv_ll_t * ll_p, lv_ll_node_t * act, lv_ll_node_t * next);
+static lv_ll_node_t * node_alloc(lv_ll_t * ll_p);
 
 /**********************
  *  STATIC VARIABLES
@@ -43,6 +46,9 @@ void lv_ll_init(lv_ll_t * ll_p, uint32_t node_size)
 {
     ll_p->head = NULL;
     ll_p->tail = NULL;
+#if LV_USE_SLAB
+    ll_p->slab = NULL;
+#endif
 #ifdef LV_ARCH_64
     /*Round the size up to 8*/
     node_size = (node_size + 7) & (~0x7);
@@ -58,7 +64,7 @@ void * lv_ll_ins_head(lv_ll_t * ll_p)
 {
     lv_ll_node_t * n_new;
 
-    n_new = lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+    n_new = node_alloc(ll_p);
 
     if(n_new != NULL) {
         node_set_prev(ll_p, n_new, NULL);       /*No prev. before the new head*/
@@ -88,7 +94,7 @@ void * lv_ll_ins_prev(lv_ll_t * ll_p, void * n_act)
         if(n_new == NULL) return NULL;
     }
     else {
-        n_new = lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+        n_new = node_alloc(ll_p);
         if(n_new == NULL) return NULL;
 
         lv_ll_node_t * n_prev;
@@ -106,7 +112,7 @@ void * lv_ll_ins_tail(lv_ll_t * ll_p)
 {
     lv_ll_node_t * n_new;
 
-    n_new = lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+    n_new = node_alloc(ll_p);
 
     if(n_new != NULL) {
         node_set_next(ll_p, n_new, NULL);       /*No next after the new tail*/
@@ -157,6 +163,32 @@ void lv_ll_remove(lv_ll_t * ll_p, void * node_p)
     }
 }
 
+void lv_ll_free_node(lv_ll_t * ll_p, void * node_p)
+{
+#if LV_USE_SLAB
+    if(ll_p->slab) {
+        lv_slab_free(ll_p->slab, node_p);
+        return;
+    }
+#else
+    LV_UNUSED(ll_p);
+#endif
+    lv_free(node_p);
+}
+
+#if LV_USE_SLAB
+void lv_ll_set_slab(lv_ll_t * ll_p, lv_slab_t * slab)
+{
+    LV_ASSERT(ll_p->head == NULL);
+    ll_p->slab = slab;
+}
+#endif
+
+uint32_t lv_ll_get_node_alloc_size(const lv_ll_t * ll_p)
+{
+    return ll_p->n_size + LL_NODE_META_SIZE;
+}
+
 void lv_ll_clear_custom(lv_ll_t * ll_p, void(*cleanup)(void *))
 {
     void * i;
@@ -169,7 +201,7 @@ void lv_ll_clear_custom(lv_ll_t * ll_p, void(*cleanup)(void *))
         i_next = lv_ll_get_next(ll_p, i);
         if(cleanup == NULL) {
             lv_ll_remove(ll_p, i);
-            lv_free(i);
+            lv_ll_free_node(ll_p, i);
         }
         else {
             cleanup(i);
@@ -337,3 +369,11 @@ static void node_set_next(lv_ll_t * ll_p, lv_ll_node_t * act, lv_ll_node_t * nex
 
     *act_node_p = *next_node_p;
 }
+
+static lv_ll_node_t * node_alloc(lv_ll_t * ll_p)
+{
+#if LV_USE_SLAB
+    if(ll_p->slab) return lv_slab_alloc(ll_p->slab);
+#endif
+    return lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+}
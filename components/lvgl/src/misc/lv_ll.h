@@ -32,6 +32,9 @@ typedef struct {
     uint32_t n_size;
     lv_ll_node_t * head;
     lv_ll_node_t * tail;
+#if LV_USE_SLAB
+    lv_slab_t * slab;   /**< Allocate the nodes from here instead of `lv_malloc()`*/
+#endif
 } lv_ll_t;
 
 /**********************
@@ -75,6 +78,31 @@ void * lv_ll_ins_tail(lv_ll_t * ll_p);
  */
 void lv_ll_remove(lv_ll_t * ll_p, void * node_p);
 
+/**
+ * Free a node removed from 'll_p' by `lv_ll_remove()`.
+ * Use it instead of `lv_free()` if the nodes can come from a slab.
+ * @param ll_p pointer to the linked list which had 'node_p'
+ * @param node_p pointer to the removed node
+ */
+void lv_ll_free_node(lv_ll_t * ll_p, void * node_p);
+
+#if LV_USE_SLAB
+/**
+ * Allocate the nodes of an empty linked list from a slab.
+ * The slab's block size should be `lv_ll_get_node_alloc_size(ll_p)`.
+ * @param ll_p pointer to linked list
+ * @param slab pointer to a slab, NULL to use `lv_malloc()` again
+ */
+void lv_ll_set_slab(lv_ll_t * ll_p, lv_slab_t * slab);
+#endif
+
+/**
+ * Get the number of bytes allocated for a node, including the links to the other nodes.
+ * @param ll_p pointer to linked list
+ * @return the size of a node in bytes
+ */
+uint32_t lv_ll_get_node_alloc_size(const lv_ll_t * ll_p);
+
 void lv_ll_clear_custom(lv_ll_t * ll_p, void(*cleanup)(void *));
 
 /**
@@ -0,0 +1,245 @@
+/**
+ * @file lv_slab.c
+ * Pools of same-size blocks. The blocks are allocated in chunks of `LV_SLAB_BLOCK_CNT`
+ * and the free ones are kept in a list, so allocating and freeing a block is O(1).
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_slab_private.h"
+#if LV_USE_SLAB
+
+#include "../core/lv_global.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "lv_assert.h"
+#include "lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SLAB_ALIGN          sizeof(void *)
+#define CHUNK_HEADER_SIZE   SLAB_ALIGN      /*Pointer to the next chunk*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static size_t chunk_size(const lv_slab_t * slab);
+static uint8_t * chunk_first_block(void * chunk);
+static bool chunk_has_block(const lv_slab_t * slab, void * chunk, const void * p);
+static lv_slab_t * get_slab(uint32_t i);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+#define NEXT(p) (*(void **)(p))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_slab_init(lv_slab_t * slab, uint32_t block_size)
+{
+    LV_ASSERT_NULL(slab);
+    LV_ASSERT(block_size > 0);
+
+    lv_memzero(slab, sizeof(lv_slab_t));
+    if(block_size < sizeof(void *)) block_size = sizeof(void *);
+    slab->block_size = LV_ALIGN_UP(block_size, SLAB_ALIGN);
+}
+
+void lv_slab_deinit(lv_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+
+    void * chunk = slab->chunk_head;
+    while(chunk) {
+        void * next = NEXT(chunk);
+        lv_free(chunk);
+        chunk = next;
+    }
+
+    uint32_t block_size = slab->block_size;
+    lv_memzero(slab, sizeof(lv_slab_t));
+    slab->block_size = block_size;
+}
+
+void * lv_slab_alloc(lv_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+
+    if(slab->free_head == NULL) {
+        void * chunk = lv_malloc(chunk_size(slab));
+        if(chunk == NULL) return NULL;
+
+        NEXT(chunk) = slab->chunk_head;
+        slab->chunk_head = chunk;
+        slab->chunk_cnt++;
+
+        /*Link the blocks in address order*/
+        uint8_t * block = chunk_first_block(chunk);
+        uint32_t i;
+        for(i = 0; i < LV_SLAB_BLOCK_CNT - 1; i++) {
+            NEXT(block) = block + slab->block_size;
+            block += slab->block_size;
+        }
+        NEXT(block) = NULL;
+
+        slab->free_head = chunk_first_block(chunk);
+        slab->free_cnt += LV_SLAB_BLOCK_CNT;
+    }
+
+    void * p = slab->free_head;
+    slab->free_head = NEXT(p);
+    slab->free_cnt--;
+    slab->used_cnt++;
+    return p;
+}
+
+void * lv_slab_alloc_zeroed(lv_slab_t * slab)
+{
+    void * p = lv_slab_alloc(slab);
+    if(p) lv_memzero(p, slab->block_size);
+    return p;
+}
+
+void lv_slab_free(lv_slab_t * slab, void * p)
+{
+    LV_ASSERT_NULL(slab);
+    if(p == NULL) return;
+    LV_ASSERT(slab->used_cnt > 0);
+
+    NEXT(p) = slab->free_head;
+    slab->free_head = p;
+    slab->free_cnt++;
+    slab->used_cnt--;
+}
+
+void lv_slab_trim(lv_slab_t * slab)
+{
+    LV_ASSERT_NULL(slab);
+    if(slab->free_cnt < LV_SLAB_BLOCK_CNT) return;
+
+    void ** chunk_p = &slab->chunk_head;
+    while(*chunk_p) {
+        void * chunk = *chunk_p;
+
+        uint32_t free_cnt = 0;
+        void * p;
+        for(p = slab->free_head; p && free_cnt < LV_SLAB_BLOCK_CNT; p = NEXT(p)) {
+            if(chunk_has_block(slab, chunk, p)) free_cnt++;
+        }
+
+        if(free_cnt < LV_SLAB_BLOCK_CNT) {
+            chunk_p = (void **)chunk;
+            continue;
+        }
+
+        /*All the blocks of the chunk are free: unlink them and free the chunk*/
+        void ** free_p = &slab->free_head;
+        while(*free_p) {
+            if(chunk_has_block(slab, chunk, *free_p)) *free_p = NEXT(*free_p);
+            else free_p = (void **)*free_p;
+        }
+
+        *chunk_p = NEXT(chunk);
+        lv_free(chunk);
+        slab->chunk_cnt--;
+        slab->free_cnt -= LV_SLAB_BLOCK_CNT;
+        if(slab->free_cnt < LV_SLAB_BLOCK_CNT) break;
+    }
+}
+
+void lv_slab_get_stats(const lv_slab_t * slab, lv_slab_stats_t * stats)
+{
+    LV_ASSERT_NULL(slab);
+    LV_ASSERT_NULL(stats);
+
+    stats->block_size = slab->block_size;
+    stats->used_cnt = slab->used_cnt;
+    stats->free_cnt = slab->free_cnt;
+    stats->chunk_cnt = slab->chunk_cnt;
+    stats->size = slab->chunk_cnt * chunk_size(slab);
+}
+
+void lv_slab_trim_all(void)
+{
+    uint32_t i;
+    lv_slab_t * slab;
+    for(i = 0; (slab = get_slab(i)) != NULL; i++) {
+        lv_slab_trim(slab);
+    }
+}
+
+void lv_slab_get_stats_all(lv_slab_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    lv_memzero(stats, sizeof(lv_slab_stats_t));
+    uint32_t i;
+    lv_slab_t * slab;
+    for(i = 0; (slab = get_slab(i)) != NULL; i++) {
+        stats->size += slab->chunk_cnt * chunk_size(slab);
+        stats->used_cnt += slab->used_cnt;
+        stats->free_cnt += slab->free_cnt;
+        stats->chunk_cnt += slab->chunk_cnt;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static size_t chunk_size(const lv_slab_t * slab)
+{
+    return CHUNK_HEADER_SIZE + (size_t)slab->block_size * LV_SLAB_BLOCK_CNT;
+}
+
+static uint8_t * chunk_first_block(void * chunk)
+{
+    return (uint8_t *)chunk + CHUNK_HEADER_SIZE;
+}
+
+static bool chunk_has_block(const lv_slab_t * slab, void * chunk, const void * p)
+{
+    const uint8_t * first = chunk_first_block(chunk);
+    return (const uint8_t *)p >= first && (const uint8_t *)p < first + (size_t)slab->block_size * LV_SLAB_BLOCK_CNT;
+}
+
+/**
+ * Get the slabs of LVGL's structures one by one
+ * @param i     index of the slab
+ * @return      pointer to the slab or NULL after the last one
+ */
+static lv_slab_t * get_slab(uint32_t i)
+{
+    lv_global_t * g = LV_GLOBAL_DEFAULT();
+    if(i < LV_SLAB_OBJ_SIZE_CNT) return &g->obj_slabs[i];
+    i -= LV_SLAB_OBJ_SIZE_CNT;
+
+    switch(i) {
+        case 0:
+            return &g->spec_attr_slab;
+        case 1:
+            return &g->style_slab;
+        case 2:
+            return &g->event_dsc_slab;
+        case 3:
+            return &g->timer_state.slab;
+        case 4:
+            return &g->anim_state.slab;
+        default:
+            return NULL;
+    }
+}
+
+#endif /*LV_USE_SLAB*/
@@ -0,0 +1,113 @@
+/**
+ * @file lv_slab.h
+ * Pools of same-size blocks for the frequently created and deleted structures.
+ */
+
+#ifndef LV_SLAB_H
+#define LV_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Usage of a slab.
+ */
+typedef struct {
+    uint32_t block_size;    /**< Size of a block in bytes */
+    uint32_t used_cnt;      /**< Number of allocated blocks */
+    uint32_t free_cnt;      /**< Number of blocks waiting for reuse */
+    uint32_t chunk_cnt;     /**< Number of chunks of `LV_SLAB_BLOCK_CNT` blocks */
+    size_t size;            /**< Size of the chunks in bytes */
+} lv_slab_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_SLAB
+
+/**
+ * Initialize a slab. It doesn't allocate memory yet.
+ * @param slab          pointer to a slab
+ * @param block_size    size of the blocks in bytes, rounded up to the size of a pointer
+ */
+void lv_slab_init(lv_slab_t * slab, uint32_t block_size);
+
+/**
+ * Free all the chunks of a slab. The blocks allocated from it become invalid.
+ * @param slab          pointer to a slab
+ */
+void lv_slab_deinit(lv_slab_t * slab);
+
+/**
+ * Get a block from the slab. A new chunk is allocated with `lv_malloc()` if there is no free block.
+ * @param slab          pointer to a slab
+ * @return              pointer to the block or NULL on allocation failure
+ */
+void * lv_slab_alloc(lv_slab_t * slab);
+
+/**
+ * Get a block from the slab and zero it.
+ * @param slab          pointer to a slab
+ * @return              pointer to the block or NULL on allocation failure
+ */
+void * lv_slab_alloc_zeroed(lv_slab_t * slab);
+
+/**
+ * Give back a block to the slab for reuse.
+ * @param slab          pointer to the slab the block was allocated from
+ * @param p             pointer to the block. NULL is ignored.
+ */
+void lv_slab_free(lv_slab_t * slab, void * p);
+
+/**
+ * Free the chunks whose blocks are all free.
+ * @param slab          pointer to a slab
+ */
+void lv_slab_trim(lv_slab_t * slab);
+
+/**
+ * Get the usage of a slab.
+ * @param slab          pointer to a slab
+ * @param stats         store the result here
+ */
+void lv_slab_get_stats(const lv_slab_t * slab, lv_slab_stats_t * stats);
+
+/**
+ * Free the unused chunks of the slabs of the widgets, their attributes and local styles,
+ * the event descriptors, timers and animations, e.g. after deleting a large screen.
+ */
+void lv_slab_trim_all(void);
+
+/**
+ * Sum the usage of the slabs of LVGL's structures.
+ * @param stats         store the result here. `block_size` is 0.
+ */
+void lv_slab_get_stats_all(lv_slab_stats_t * stats);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SLAB*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SLAB_H*/
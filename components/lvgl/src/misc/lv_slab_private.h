@@ -0,0 +1,52 @@
+/**
+ * @file lv_slab_private.h
+ *
+ */
+
+#ifndef LV_SLAB_PRIVATE_H
+#define LV_SLAB_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_slab.h"
+
+#if LV_USE_SLAB
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_slab_t {
+    void * free_head;       /**< The free blocks, each one starts with a pointer to the next*/
+    void * chunk_head;      /**< The chunks, each one starts with a pointer to the next*/
+    uint32_t block_size;
+    uint32_t used_cnt;
+    uint32_t free_cnt;
+    uint32_t chunk_cnt;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SLAB*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SLAB_PRIVATE_H*/
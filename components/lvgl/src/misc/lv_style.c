@@ -8,6 +8,7 @@
  *********************/
 #include "lv_style_private.h"
 #include "../core/lv_global.h"
+#include "../core/lv_obj_style_private.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 #include "lv_assert.h"
@@ -188,6 +189,7 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    lv_obj_style_value_cache_invalidate();
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -196,6 +198,7 @@ void lv_style_reset(lv_style_t * style)
 
     if(style->prop_cnt != 255) lv_free(style->values_and_props);
     lv_memzero(style, sizeof(lv_style_t));
+    lv_obj_style_value_cache_invalidate();
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
@@ -328,6 +331,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_free(old_values);
+            lv_obj_style_value_cache_invalidate();
             LV_PROFILER_STYLE_END;
             return true;
         }
@@ -351,6 +355,8 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     lv_style_prop_t * props;
     int32_t i;
 
+    lv_obj_style_value_cache_invalidate();
+
     if(style->values_and_props) {
         props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         for(i = style->prop_cnt - 1; i >= 0; i--) {
@@ -10,6 +10,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_sprintf.h"
+#include "../stdlib/lv_string.h"
 #include "lv_assert.h"
 #include "lv_ll.h"
 #include "lv_profiler.h"
@@ -28,12 +29,40 @@
  *      TYPEDEFS
  **********************/
 
+/**
+ * Where the scheduler keeps a timer.
+ * Running timers wait in a min-heap by deadline, so the handler touches only the ready ones.
+ * The ready timers of a pass are moved to a max-heap by creation order, so they run in the
+ * same order as the list (newest first), which is the order of the original full scan.
+ */
+typedef enum {
+    LV_TIMER_SCHED_NONE = 0,    /**< Paused or being executed*/
+    LV_TIMER_SCHED_WAIT,        /**< In `state.wait`*/
+    LV_TIMER_SCHED_DUE,         /**< In `state.due`*/
+    LV_TIMER_SCHED_DEFERRED,    /**< In `state.deferred`*/
+} lv_timer_sched_in_t;
+
+typedef bool (*heap_less_cb_t)(const lv_timer_t * a, const lv_timer_t * b);
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void lv_timer_run_ready(void);
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static uint64_t tick_get64(void);
+static bool sched_reserve(uint32_t cnt);
+static void sched_wait(lv_timer_t * timer);
+static void sched_update(lv_timer_t * timer);
+static void sched_remove(lv_timer_t * timer);
+static bool deadline_less(const lv_timer_t * a, const lv_timer_t * b);
+static bool seq_newer(const lv_timer_t * a, const lv_timer_t * b);
+static void heap_push(lv_timer_heap_t * h, lv_timer_t * timer, heap_less_cb_t less);
+static lv_timer_t * heap_pop(lv_timer_heap_t * h, heap_less_cb_t less);
+static void heap_remove(lv_timer_heap_t * h, uint32_t idx, heap_less_cb_t less);
+static void heap_sift_up(lv_timer_heap_t * h, uint32_t idx, heap_less_cb_t less);
+static void heap_sift_down(lv_timer_heap_t * h, uint32_t idx, heap_less_cb_t less);
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +84,11 @@ static void lv_timer_handler_resume(void);
 void lv_timer_core_init(void)
 {
     lv_ll_init(timer_ll_p, sizeof(lv_timer_t));
+#if LV_USE_SLAB
+    lv_slab_init(&state.slab, lv_ll_get_node_alloc_size(timer_ll_p));
+    lv_ll_set_slab(timer_ll_p, &state.slab);
+#endif
+    state.tick_last = lv_tick_get();
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -90,42 +124,16 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
+    /*Run the ready timers*/
+    lv_timer_run_ready();
 
+    /*The earliest deadline is on the top of the wait heap*/
     uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
-
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    if(state_p->wait.cnt) {
+        uint64_t now = tick_get64();
+        uint64_t deadline = state_p->wait.items[0]->deadline;
+        if(deadline <= now) time_until_next = 0;
+        else if(deadline - now < LV_NO_TIMER_READY) time_until_next = (uint32_t)(deadline - now);
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -166,6 +174,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    if(!sched_reserve(state.timer_cnt + 1)) {
+        LV_ASSERT_MALLOC(NULL);
+        return NULL;
+    }
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -177,6 +190,10 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->seq = ++state.seq;
+    new_timer->sched_in = LV_TIMER_SCHED_NONE;
+    state.timer_cnt++;
+    sched_wait(new_timer);
 
     state.timer_created = true;
 
@@ -193,22 +210,29 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    sched_remove(timer);
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+    state.timer_cnt--;
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
-    lv_free(timer);
+    lv_ll_free_node(timer_ll_p, timer);
 }
 
 void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    sched_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    /*The timer being executed is rescheduled when its callback returns*/
+    if(timer->sched_in == LV_TIMER_SCHED_NONE && timer != state.timer_exec) sched_wait(timer);
     lv_timer_handler_resume();
 }
 
@@ -216,18 +240,21 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    sched_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    sched_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+    sched_update(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +273,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    sched_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -260,6 +288,18 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+#if LV_USE_SLAB
+    lv_slab_deinit(&state.slab);
+#endif
+
+    lv_free(state.wait.items);
+    lv_free(state.due.items);
+    lv_free(state.deferred.items);
+    lv_memzero(&state.wait, sizeof(state.wait));
+    lv_memzero(&state.due, sizeof(state.due));
+    lv_memzero(&state.deferred, sizeof(state.deferred));
+    state.timer_cnt = 0;
+    state.timer_exec = NULL;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -303,6 +343,74 @@ bool lv_timer_get_paused(lv_timer_t * timer)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Execute the ready timers in list order (newest first).
+ * Like the original list scan a pass starts again from the newest timer if a timer callback
+ * created or deleted a timer, and a timer which gets ready during a pass still runs in that
+ * pass if it comes later in the list.
+ */
+static void lv_timer_run_ready(void)
+{
+    lv_timer_state_t * state_p = &state;
+    bool restart;
+    do {
+        state_p->timer_deleted = false;
+        state_p->timer_created = false;
+        restart = false;
+
+        bool first = true;
+        uint32_t cursor = 0;  /*`seq` of the last visited timer*/
+        while(1) {
+            uint64_t now = tick_get64();
+            while(state_p->wait.cnt && state_p->wait.items[0]->deadline <= now) {
+                lv_timer_t * t = heap_pop(&state_p->wait, deadline_less);
+                if(first || (int32_t)(t->seq - cursor) < 0) {
+                    t->sched_in = LV_TIMER_SCHED_DUE;
+                    heap_push(&state_p->due, t, seq_newer);
+                }
+                else {
+                    /*Already passed in this pass, the list scan would run it only after a restart*/
+                    t->sched_in = LV_TIMER_SCHED_DEFERRED;
+                    t->sched_idx = state_p->deferred.cnt;
+                    state_p->deferred.items[state_p->deferred.cnt++] = t;
+                }
+            }
+            if(state_p->due.cnt == 0) break;
+
+            lv_timer_t * timer = heap_pop(&state_p->due, seq_newer);
+            timer->sched_in = LV_TIMER_SCHED_NONE;
+            first = false;
+            cursor = timer->seq;
+
+            state_p->timer_exec = timer;
+            bool exec = lv_timer_exec(timer);
+            if(state_p->timer_exec) {
+                /*Not deleted, wait for the next run unless paused*/
+                state_p->timer_exec = NULL;
+                if(!timer->paused) sched_wait(timer);
+            }
+
+            /*If a timer was created or deleted start from the newest timer again*/
+            if(exec && (state_p->timer_created || state_p->timer_deleted)) {
+                LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
+                restart = true;
+                break;
+            }
+        }
+
+        while(state_p->deferred.cnt) {
+            lv_timer_t * t = state_p->deferred.items[--state_p->deferred.cnt];
+            t->sched_in = LV_TIMER_SCHED_NONE;
+            sched_wait(t);
+        }
+        while(state_p->due.cnt) {
+            lv_timer_t * t = state_p->due.items[--state_p->due.cnt];
+            t->sched_in = LV_TIMER_SCHED_NONE;
+            sched_wait(t);
+        }
+    } while(restart);
+}
+
 /**
  * Execute timer if its remaining time is zero
  * @param timer pointer to lv_timer
@@ -386,3 +494,160 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Get the tick extended to 64 bit, so deadlines can be compared across the 32 bit wrap around
+ */
+static uint64_t tick_get64(void)
+{
+    uint32_t now = lv_tick_get();
+    if(now < state.tick_last) state.tick_wraps++;
+    state.tick_last = now;
+    return ((uint64_t)state.tick_wraps << 32) | now;
+}
+
+/**
+ * Make room for `cnt` timers in every scheduler container, so scheduling never allocates
+ * @return false if out of memory
+ */
+static bool sched_reserve(uint32_t cnt)
+{
+    lv_timer_heap_t * heaps[3] = {&state.wait, &state.due, &state.deferred};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_timer_heap_t * h = heaps[i];
+        if(h->cap >= cnt) continue;
+
+        uint32_t new_cap = h->cap ? h->cap * 2 : 8;
+        while(new_cap < cnt) new_cap *= 2;
+        lv_timer_t ** items = lv_realloc(h->items, new_cap * sizeof(lv_timer_t *));
+        if(items == NULL) return false;
+        h->items = items;
+        h->cap = new_cap;
+    }
+    return true;
+}
+
+/**
+ * Compute the deadline of a timer and add it to the wait heap
+ */
+static void sched_wait(lv_timer_t * timer)
+{
+    if(timer->repeat_count == 0) {
+        /*Visit it as soon as possible to delete or pause it, as the list scan did*/
+        timer->deadline = 0;
+    }
+    else {
+        uint64_t now = tick_get64();
+        uint32_t elp = (uint32_t)now - timer->last_run;    /*Same as lv_tick_elaps()*/
+        timer->deadline = elp >= timer->period ? now : now + (timer->period - elp);
+    }
+    timer->sched_in = LV_TIMER_SCHED_WAIT;
+    heap_push(&state.wait, timer, deadline_less);
+}
+
+/**
+ * Update the position of a waiting timer after its period, last run or repeat count changed.
+ * Timers which are ready or being executed are rescheduled after their visit anyway.
+ */
+static void sched_update(lv_timer_t * timer)
+{
+    if(timer->sched_in != LV_TIMER_SCHED_WAIT) return;
+
+    heap_remove(&state.wait, timer->sched_idx, deadline_less);
+    sched_wait(timer);
+}
+
+static void sched_remove(lv_timer_t * timer)
+{
+    switch(timer->sched_in) {
+        case LV_TIMER_SCHED_WAIT:
+            heap_remove(&state.wait, timer->sched_idx, deadline_less);
+            break;
+        case LV_TIMER_SCHED_DUE:
+            heap_remove(&state.due, timer->sched_idx, seq_newer);
+            break;
+        case LV_TIMER_SCHED_DEFERRED: {
+                lv_timer_heap_t * v = &state.deferred;
+                lv_timer_t * last = v->items[--v->cnt];
+                v->items[timer->sched_idx] = last;
+                last->sched_idx = timer->sched_idx;
+                break;
+            }
+        default:
+            break;
+    }
+    timer->sched_in = LV_TIMER_SCHED_NONE;
+}
+
+static bool deadline_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    if(a->deadline != b->deadline) return a->deadline < b->deadline;
+    return seq_newer(a, b);
+}
+
+/**
+ * `a` was created after `b`, that is `a` is closer to the head of the list
+ */
+static bool seq_newer(const lv_timer_t * a, const lv_timer_t * b)
+{
+    return (int32_t)(a->seq - b->seq) > 0;
+}
+
+static void heap_push(lv_timer_heap_t * h, lv_timer_t * timer, heap_less_cb_t less)
+{
+    LV_ASSERT(h->cnt < h->cap);
+    timer->sched_idx = h->cnt;
+    h->items[h->cnt++] = timer;
+    heap_sift_up(h, timer->sched_idx, less);
+}
+
+static lv_timer_t * heap_pop(lv_timer_heap_t * h, heap_less_cb_t less)
+{
+    lv_timer_t * top = h->items[0];
+    heap_remove(h, 0, less);
+    return top;
+}
+
+static void heap_remove(lv_timer_heap_t * h, uint32_t idx, heap_less_cb_t less)
+{
+    h->cnt--;
+    if(idx == h->cnt) return;
+
+    /*Move the last item into the hole and restore the heap order in either direction*/
+    lv_timer_t * moved = h->items[h->cnt];
+    h->items[idx] = moved;
+    moved->sched_idx = idx;
+    heap_sift_up(h, idx, less);
+    heap_sift_down(h, moved->sched_idx, less);
+}
+
+static void heap_sift_up(lv_timer_heap_t * h, uint32_t idx, heap_less_cb_t less)
+{
+    lv_timer_t * t = h->items[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!less(t, h->items[parent])) break;
+        h->items[idx] = h->items[parent];
+        h->items[idx]->sched_idx = idx;
+        idx = parent;
+    }
+    h->items[idx] = t;
+    t->sched_idx = idx;
+}
+
+static void heap_sift_down(lv_timer_heap_t * h, uint32_t idx, heap_less_cb_t less)
+{
+    lv_timer_t * t = h->items[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= h->cnt) break;
+        if(child + 1 < h->cnt && less(h->items[child + 1], h->items[child])) child++;
+        if(!less(h->items[child], t)) break;
+        h->items[idx] = h->items[child];
+        h->items[idx]->sched_idx = idx;
+        idx = child;
+    }
+    h->items[idx] = t;
+    t->sched_idx = idx;
+}
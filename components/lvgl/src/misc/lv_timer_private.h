@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_timer.h"
+#include "lv_slab_private.h"
 
 /*********************
  *      DEFINES
@@ -35,10 +36,35 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+    uint32_t sched_in : 2;     /**< Scheduler container holding the timer, see `lv_timer_sched_in_t` in lv_timer.c*/
+    uint32_t seq;              /**< Creation order, ready timers run from the newest, like the list order*/
+    uint32_t sched_idx;        /**< Index in the container given by `sched_in`*/
+    uint64_t deadline;         /**< Tick (extended to 64 bit) when the timer gets ready, key of the wait heap*/
 };
 
+/**
+ * Array of timers used as a binary heap or as a plain vector by the scheduler
+ */
+typedef struct {
+    lv_timer_t ** items;
+    uint32_t cnt;
+    uint32_t cap;
+} lv_timer_heap_t;
+
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+#if LV_USE_SLAB
+    lv_slab_t slab;            /**< The nodes of `timer_ll`*/
+#endif
+
+    lv_timer_heap_t wait;      /**< Not paused timers, min-heap by `deadline`*/
+    lv_timer_heap_t due;       /**< Ready timers of the current pass, max-heap by `seq`*/
+    lv_timer_heap_t deferred;  /**< Timers which got ready behind the current position of the pass*/
+    lv_timer_t * timer_exec;   /**< Timer being executed, NULL if it deleted itself*/
+    uint32_t timer_cnt;
+    uint32_t seq;
+    uint32_t tick_last;        /**< Last tick seen, to extend the tick to 64 bit*/
+    uint32_t tick_wraps;
 
     bool lv_timer_run;
     uint8_t idle_last;
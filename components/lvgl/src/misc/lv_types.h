@@ -357,6 +357,10 @@ typedef struct _lv_iter_t lv_iter_t;
 
 typedef struct _lv_circle_buf_t lv_circle_buf_t;
 
+typedef struct _lv_slab_t lv_slab_t;
+
+typedef struct _lv_layout_cache_t lv_layout_cache_t;
+
 typedef struct _lv_draw_buf_t lv_draw_buf_t;
 
 #if LV_USE_OBJ_PROPERTY
@@ -107,6 +107,37 @@ lv_result_t lv_thread_init(lv_thread_t * pxThread,  const char * const name,
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_thread_init_pinned(lv_thread_t * pxThread, const char * const name,
+                                  lv_thread_prio_t xSchedPriority,
+                                  void (*pvStartRoutine)(void *), size_t usStackSize,
+                                  void * xAttr, uint32_t core)
+{
+#ifdef ESP_PLATFORM
+    pxThread->pTaskArg = xAttr;
+    pxThread->pvStartRoutine = pvStartRoutine;
+
+    BaseType_t xTaskCreateStatus = xTaskCreatePinnedToCore(
+                                       prvRunThread,
+                                       name,
+                                       (configSTACK_DEPTH_TYPE)(usStackSize / sizeof(StackType_t)),
+                                       (void *)pxThread,
+                                       tskIDLE_PRIORITY + xSchedPriority,
+                                       &pxThread->xTaskHandle,
+                                       (BaseType_t)(core % portNUM_PROCESSORS));
+
+    /* Ensure that the FreeRTOS task was successfully created. */
+    if(xTaskCreateStatus != pdPASS) {
+        LV_LOG_ERROR("xTaskCreatePinnedToCore failed!");
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(core);
+    return lv_thread_init(pxThread, name, xSchedPriority, pvStartRoutine, usStackSize, xAttr);
+#endif
+}
+
 lv_result_t lv_thread_delete(lv_thread_t * pxThread)
 {
     vTaskDelete(pxThread->xTaskHandle);
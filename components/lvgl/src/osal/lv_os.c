@@ -73,6 +73,16 @@ void lv_sleep_ms(uint32_t ms)
 }
 #endif
 
+#if LV_USE_OS != LV_OS_NONE && LV_USE_OS != LV_OS_FREERTOS && LV_USE_OS != LV_OS_PTHREAD
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, const char * const name,
+                                  lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
+                                  void * user_data, uint32_t core)
+{
+    LV_UNUSED(core);
+    return lv_thread_init(thread, name, prio, callback, stack_size, user_data);
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
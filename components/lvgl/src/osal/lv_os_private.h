@@ -103,6 +103,22 @@ lv_result_t lv_thread_init(lv_thread_t * thread, const char * const name,
                            lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
                            void * user_data);
 
+/**
+ * Create a new thread pinned to a CPU core.
+ * OS layers without affinity support create a normal thread with `lv_thread_init()`.
+ * @param thread        a variable in which the thread will be stored
+ * @param name          the name of the thread
+ * @param prio          priority of the thread
+ * @param callback      function of the thread
+ * @param stack_size    stack size in bytes
+ * @param user_data     arbitrary data, will be available in the callback
+ * @param core          index of the core, wrapped around the number of cores
+ * @return              LV_RESULT_OK: success; LV_RESULT_INVALID: failure
+ */
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, const char * const name,
+                                  lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size,
+                                  void * user_data, uint32_t core);
+
 /**
  * Delete a thread
  * @param thread        the thread to delete
@@ -6,6 +6,9 @@
 /*********************
  *      INCLUDES
  *********************/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE /*For pthread_attr_setaffinity_np()*/
+#endif
 #include "lv_os_private.h"
 
 #if LV_USE_OS == LV_OS_PTHREAD
@@ -58,6 +61,42 @@ lv_result_t lv_thread_init(lv_thread_t * thread, const char * const name,
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_thread_init_pinned(lv_thread_t * thread, const char * const name,
+                                  lv_thread_prio_t prio, void (*callback)(void *),
+                                  size_t stack_size, void * user_data, uint32_t core)
+{
+#ifdef __linux__
+    LV_UNUSED(name);
+    LV_UNUSED(prio);
+    long core_cnt = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core % (core_cnt > 0 ? (uint32_t)core_cnt : 1), &cpus);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, stack_size);
+    int ret = pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+    if(ret != 0) {
+        LV_LOG_WARN("Error: %d", ret);
+        pthread_attr_destroy(&attr);
+        return LV_RESULT_INVALID;
+    }
+    thread->callback = callback;
+    thread->user_data = user_data;
+    ret = pthread_create(&thread->thread, &attr, generic_callback, thread);
+    pthread_attr_destroy(&attr);
+    if(ret != 0) {
+        LV_LOG_WARN("Error: %d", ret);
+        return LV_RESULT_INVALID;
+    }
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(core);
+    return lv_thread_init(thread, name, prio, callback, stack_size, user_data);
+#endif
+}
+
 lv_result_t lv_thread_delete(lv_thread_t * thread)
 {
     int ret = pthread_join(thread->thread, NULL);
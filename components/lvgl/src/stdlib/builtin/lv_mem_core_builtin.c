@@ -8,7 +8,7 @@
 #include "../lv_mem.h"
 #if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
 
-#include "lv_tlsf.h"
+#include "lv_tlsf_private.h"
 #include "../lv_string.h"
 #include "../../misc/lv_assert.h"
 #include "../../misc/lv_log.h"
@@ -46,6 +46,14 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+static void monitor_finish(lv_mem_monitor_t * mon_p);
+static void * tlsf_malloc_tiered(size_t size);
+static void stats_add(size_t block_size, bool large, bool is_realloc);
+static void stats_remove(size_t block_size, bool large);
+static uint32_t size_to_class(size_t size);
+#if LV_MEM_LARGE_SIZE
+    static bool is_large(const void * p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -93,6 +101,20 @@ void lv_mem_init(void)
     LV_ASSERT_MALLOC(pool_p);
     *pool_p = lv_tlsf_get_pool(state.tlsf);
 
+#if LV_MEM_LARGE_SIZE
+#ifdef LV_MEM_LARGE_POOL_ALLOC
+    state.large_mem = (uint8_t *)LV_MEM_LARGE_POOL_ALLOC(LV_MEM_LARGE_SIZE);
+#else
+    static MEM_UNIT large_mem_int[LV_MEM_LARGE_SIZE / sizeof(MEM_UNIT)] LV_ATTRIBUTE_LARGE_RAM_ARRAY;
+    state.large_mem = (uint8_t *)large_mem_int;
+#endif
+    if(state.large_mem) state.large_tlsf = lv_tlsf_create_with_pool(state.large_mem, LV_MEM_LARGE_SIZE);
+    if(state.large_tlsf == NULL) {
+        LV_LOG_WARN("couldn't create the pool of large allocations");
+        state.large_mem = NULL;
+    }
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -102,6 +124,14 @@ void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
     lv_tlsf_destroy(state.tlsf);
+#if LV_MEM_LARGE_SIZE
+    if(state.large_tlsf) lv_tlsf_destroy(state.large_tlsf);
+    state.large_tlsf = NULL;
+    state.large_mem = NULL;
+    state.large_cur_used = 0;
+    state.large_max_used = 0;
+#endif
+    lv_memzero(state.class_stats, sizeof(state.class_stats));
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
 #endif
@@ -141,11 +171,17 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
+    void * p = tlsf_malloc_tiered(size);
 
     if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
+#if LV_MEM_LARGE_SIZE
+        stats_add(lv_tlsf_block_size(p), is_large(p), false);
+#else
+        stats_add(lv_tlsf_block_size(p), false, false);
+#endif
+    }
+    else {
+        state.class_stats[size_to_class(size)].fail_cnt++;
     }
 
 #if LV_USE_OS
@@ -161,12 +197,32 @@ void * lv_realloc_core(void * p, size_t new_size)
 #endif
 
     size_t old_size = lv_tlsf_block_size(p);
+#if LV_MEM_LARGE_SIZE
+    bool old_large = is_large(p);
+    void * p_new = lv_tlsf_realloc(old_large ? state.large_tlsf : state.tlsf, p, new_size);
+    if(p_new == NULL) {
+        /*Move it to the other pool*/
+        p_new = tlsf_malloc_tiered(new_size);
+        if(p_new) {
+            lv_memcpy(p_new, p, LV_MIN(old_size, new_size));
+            lv_tlsf_free(old_large ? state.large_tlsf : state.tlsf, p);
+        }
+    }
+#else
+    bool old_large = false;
     void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
+#endif
 
     if(p_new) {
-        state.cur_used -= old_size;
-        state.cur_used += lv_tlsf_block_size(p_new);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
+        stats_remove(old_size, old_large);
+#if LV_MEM_LARGE_SIZE
+        stats_add(lv_tlsf_block_size(p_new), is_large(p_new), true);
+#else
+        stats_add(lv_tlsf_block_size(p_new), false, true);
+#endif
+    }
+    else {
+        state.class_stats[size_to_class(new_size)].fail_cnt++;
     }
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -185,9 +241,14 @@ void lv_free_core(void * p)
     lv_memset(p, 0xbb, lv_tlsf_block_size(data));
 #endif
     size_t size = lv_tlsf_block_size(p);
+#if LV_MEM_LARGE_SIZE
+    bool large = is_large(p);
+    lv_tlsf_free(large ? state.large_tlsf : state.tlsf, p);
+#else
+    bool large = false;
     lv_tlsf_free(state.tlsf, p);
-    if(state.cur_used > size) state.cur_used -= size;
-    else state.cur_used = 0;
+#endif
+    stats_remove(size, large);
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -205,20 +266,54 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
         lv_tlsf_walk_pool(*pool_p, lv_mem_walker, mon_p);
     }
 
-    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
-    if(mon_p->free_size > 0) {
-        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
-        mon_p->frag_pct = 100 - mon_p->frag_pct;
-    }
-    else {
-        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
-    }
-
+    monitor_finish(mon_p);
     mon_p->max_used = state.max_used;
 
     LV_TRACE_MEM("finished");
 }
 
+void lv_mem_monitor_large(lv_mem_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+
+#if LV_MEM_LARGE_SIZE
+    if(state.large_tlsf == NULL) return;
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_tlsf_walk_pool(lv_tlsf_get_pool(state.large_tlsf), lv_mem_walker, mon_p);
+    monitor_finish(mon_p);
+    mon_p->max_used = state.large_max_used;
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+#endif
+}
+
+void lv_mem_get_class_stats(lv_mem_class_stats_t * stats, bool reset)
+{
+    LV_ASSERT_NULL(stats);
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    lv_memcpy(stats, state.class_stats, sizeof(state.class_stats));
+
+    if(reset) {
+        uint32_t i;
+        for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+            state.class_stats[i].alloc_cnt = 0;
+            state.class_stats[i].realloc_cnt = 0;
+            state.class_stats[i].fail_cnt = 0;
+            state.class_stats[i].max_cnt = state.class_stats[i].cur_cnt;
+        }
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+}
+
 lv_result_t lv_mem_test_core(void)
 {
 #if LV_USE_OS
@@ -243,6 +338,16 @@ lv_result_t lv_mem_test_core(void)
         }
     }
 
+#if LV_MEM_LARGE_SIZE
+    if(state.large_tlsf && (lv_tlsf_check(state.large_tlsf) || lv_tlsf_check_pool(lv_tlsf_get_pool(state.large_tlsf)))) {
+        LV_LOG_WARN("large pool failed");
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return LV_RESULT_INVALID;
+    }
+#endif
+
     LV_TRACE_MEM("passed");
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -270,4 +375,102 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+static void monitor_finish(lv_mem_monitor_t * mon_p)
+{
+    mon_p->used_pct = 100 - (uint64_t)100U * mon_p->free_size / mon_p->total_size;
+    if(mon_p->free_size > 0) {
+        mon_p->frag_pct = (uint64_t)mon_p->free_biggest_size * 100U / mon_p->free_size;
+        mon_p->frag_pct = 100 - mon_p->frag_pct;
+    }
+    else {
+        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    }
+}
+
+/**
+ * Allocate from the pool of the size class, or from the other pool if it's full
+ * @param size      size in bytes
+ * @return          pointer to the allocated memory or NULL
+ */
+static void * tlsf_malloc_tiered(size_t size)
+{
+#if LV_MEM_LARGE_SIZE
+    if(state.large_tlsf == NULL) return lv_tlsf_malloc(state.tlsf, size);
+
+    void * p;
+    if(size >= LV_MEM_LARGE_THRESHOLD) {
+        p = lv_tlsf_malloc(state.large_tlsf, size);
+        if(p == NULL) p = lv_tlsf_malloc(state.tlsf, size);
+    }
+    else {
+        p = lv_tlsf_malloc(state.tlsf, size);
+        if(p == NULL) p = lv_tlsf_malloc(state.large_tlsf, size);
+    }
+    return p;
+#else
+    return lv_tlsf_malloc(state.tlsf, size);
+#endif
+}
+
+static void stats_add(size_t block_size, bool large, bool is_realloc)
+{
+#if LV_MEM_LARGE_SIZE
+    if(large) {
+        state.large_cur_used += block_size;
+        state.large_max_used = LV_MAX(state.large_cur_used, state.large_max_used);
+    }
+    else
+#else
+    LV_UNUSED(large);
+#endif
+    {
+        state.cur_used += block_size;
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+
+    lv_mem_class_stats_t * stats = &state.class_stats[size_to_class(block_size)];
+    /*A realloc replaces a block, count it apart from the new allocations*/
+    if(is_realloc) stats->realloc_cnt++;
+    else stats->alloc_cnt++;
+    stats->cur_cnt++;
+    stats->cur_size += block_size;
+    stats->max_cnt = LV_MAX(stats->cur_cnt, stats->max_cnt);
+}
+
+static void stats_remove(size_t block_size, bool large)
+{
+    size_t * cur_used = &state.cur_used;
+#if LV_MEM_LARGE_SIZE
+    if(large) cur_used = &state.large_cur_used;
+#else
+    LV_UNUSED(large);
+#endif
+    if(*cur_used > block_size) *cur_used -= block_size;
+    else *cur_used = 0;
+
+    lv_mem_class_stats_t * stats = &state.class_stats[size_to_class(block_size)];
+    if(stats->cur_cnt > 0) stats->cur_cnt--;
+    if(stats->cur_size > block_size) stats->cur_size -= block_size;
+    else stats->cur_size = 0;
+}
+
+static uint32_t size_to_class(size_t size)
+{
+    uint32_t c = 0;
+    size_t limit = 32;
+    while(size > limit && c < LV_MEM_CLASS_CNT - 1) {
+        limit <<= 1;
+        c++;
+    }
+    return c;
+}
+
+#if LV_MEM_LARGE_SIZE
+static bool is_large(const void * p)
+{
+    const uint8_t * p8 = p;
+    return state.large_mem && p8 >= state.large_mem && p8 < state.large_mem + LV_MEM_LARGE_SIZE;
+}
+#endif
 #endif /*LV_STDLIB_BUILTIN*/
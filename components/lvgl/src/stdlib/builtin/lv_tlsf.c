@@ -10,7 +10,11 @@
 #undef  printf
 #define printf LV_LOG_ERROR
 
-#define TLSF_MAX_POOL_SIZE (LV_MEM_SIZE + LV_MEM_POOL_EXPAND_SIZE)
+#if LV_MEM_LARGE_SIZE > LV_MEM_SIZE + LV_MEM_POOL_EXPAND_SIZE
+    #define TLSF_MAX_POOL_SIZE LV_MEM_LARGE_SIZE
+#else
+    #define TLSF_MAX_POOL_SIZE (LV_MEM_SIZE + LV_MEM_POOL_EXPAND_SIZE)
+#endif
 
 #if !defined(_DEBUG)
     #define _DEBUG 0
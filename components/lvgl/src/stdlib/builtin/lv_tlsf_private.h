@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os_private.h"
 
 /*********************
@@ -35,6 +36,13 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_LARGE_SIZE
+    lv_tlsf_t large_tlsf;       /**< Only for the allocations of at least `LV_MEM_LARGE_THRESHOLD` bytes*/
+    uint8_t * large_mem;
+    size_t large_cur_used;
+    size_t large_max_used;
+#endif
+    lv_mem_class_stats_t class_stats[LV_MEM_CLASS_CNT];
 } lv_tlsf_state_t;
 
 /**********************
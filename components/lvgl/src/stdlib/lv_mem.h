@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of size classes of `lv_mem_get_class_stats()`: up to 32, 64, ... 8192 bytes and larger*/
+#define LV_MEM_CLASS_CNT    10
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -43,6 +46,18 @@ typedef struct {
     uint8_t frag_pct;   /**< Amount of fragmentation */
 } lv_mem_monitor_t;
 
+/**
+ * Allocation statistics of a size class of the built-in allocator.
+ */
+typedef struct {
+    uint32_t alloc_cnt;     /**< Number of allocations since the last reset */
+    uint32_t realloc_cnt;   /**< Number of reallocations to this class since the last reset */
+    uint32_t fail_cnt;      /**< Number of failed allocations and reallocations since the last reset */
+    uint32_t cur_cnt;       /**< Number of blocks allocated now */
+    uint32_t max_cnt;       /**< Max number of blocks allocated at the same time */
+    size_t cur_size;        /**< Size of the blocks allocated now */
+} lv_mem_class_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -155,6 +170,25 @@ lv_result_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+
+/**
+ * Get the allocation statistics of the built-in allocator by block size.
+ * Class `i` counts the blocks of at most `32 << i` bytes, the last one all the larger blocks.
+ * @param stats     array of `LV_MEM_CLASS_CNT` elements to store the result
+ * @param reset     true: reset `alloc_cnt`, `realloc_cnt`, `fail_cnt` and `max_cnt` after reading them
+ */
+void lv_mem_get_class_stats(lv_mem_class_stats_t * stats, bool reset);
+
+/**
+ * Give information about the pool of the large allocations (`LV_MEM_LARGE_SIZE`).
+ * `lv_mem_monitor()` covers only the pool of the other allocations.
+ * @param mon_p     pointer to a lv_mem_monitor_t variable, all 0 if there is no such pool
+ */
+void lv_mem_monitor_large(lv_mem_monitor_t * mon_p);
+
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
+
 /**********************
  *      MACROS
  **********************/
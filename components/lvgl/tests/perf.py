@@ -138,7 +138,11 @@ def lvgl_test_src(name: str) -> str:
     return os.path.join(lvgl_test_dir, "src", name)
 
 
-LVGL_TEST_FILES = [lvgl_test_src("lv_test_init.c"), lvgl_test_src("lv_test_init.h")]
+LVGL_TEST_FILES = [
+    lvgl_test_src("lv_test_init.c"),
+    lvgl_test_src("lv_test_init.h"),
+    lvgl_test_src("test_assets/test_mem_trace_demos.c"),
+]
 
 
 def options_abbrev(options_name: str) -> str:
@@ -22,6 +22,7 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_VALUE_CACHE    64  /* Small to have many collisions */
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
 #define LV_DRAW_BUF_STRIDE_ALIGN    64  /* Use a large value to be sure any issues will cause crash */
 #endif
@@ -31,7 +32,10 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_VALUE_CACHE 0
 #define LV_BIN_DECODER_RAM_LOAD 0
+#define LV_MEM_LARGE_SIZE       (8 * 1024 * 1024)
+#define LV_USE_SLAB             1
 #endif
 
 #ifdef MICROPYTHON
@@ -3,6 +3,8 @@
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_LOCALITY_LOOKAHEAD   4
+#define LV_DRAW_SW_STATS                1
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -56,6 +58,7 @@
 
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
+#define LV_LAYOUT_CACHE_MIN_CHILDREN 4
 
 #define LV_USE_FS_STDIO     1
 #define LV_FS_STDIO_LETTER  'A'
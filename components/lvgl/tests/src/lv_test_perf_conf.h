@@ -85,6 +85,9 @@
             #endif
         #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+        /** Allocate the widgets, styles, event descriptors, timers and animations from slabs */
+        #define LV_USE_SLAB 1
+
         /*====================
         HAL SETTINGS
         *====================*/
@@ -787,6 +790,9 @@
         /** A layout similar to Grid in CSS. */
         #define LV_USE_GRID 1
 
+        /** Cache the flex and grid layout of containers with at least this many children */
+        #define LV_LAYOUT_CACHE_MIN_CHILDREN 16
+
         /*====================
         * 3RD PARTS LIBRARIES
         *====================*/
@@ -0,0 +1,2354 @@
+#if LV_BUILD_TEST
+#include <stdint.h>
+
+/*******************************************************************************
+ * Allocations of the LVGL demos on the test build (800x480, LVGL heap):
+ * widgets, music, widgets, keypad and encoder, music and an empty screen,
+ * each created on a new screen, deleting the previous one, and run for 1 s.
+ *
+ * An operation is `type << 30 | slot << 20 | size`
+ * - type: 0: lv_malloc, 1: lv_realloc, 2: lv_free
+ * - slot: the index of the block in the trace (< 1024)
+ * - size: requested size in bytes (0 for lv_free)
+ ******************************************************************************/
+
+const uint32_t test_mem_trace_demos[] = {
+    0x00000010, 0x40000020, 0x40000030, 0x40000040, 0x00100009, 0x40100012, 0x00200009, 0x40200012,
+    0x80200000, 0x00200009, 0x00300009, 0x00400009, 0x40400012, 0x4040001b, 0x40400024, 0x4040002d,
+    0x40400036, 0x4040003f, 0x40400048, 0x40400051, 0x00500009, 0x00600009, 0x40600012, 0x4060001b,
+    0x40600024, 0x4060002d, 0x40600036, 0x4060003f, 0x00700009, 0x40700012, 0x4070001b, 0x40700024,
+    0x4070002d, 0x40700036, 0x4070003f, 0x40700048, 0x40700051, 0x4070005a, 0x40700063, 0x4070006c,
+    0x40700075, 0x4070007e, 0x40700087, 0x00800009, 0x40800012, 0x4080001b, 0x40800024, 0x00900009,
+    0x40900012, 0x4090001b, 0x00a00009, 0x40a00012, 0x40a0001b, 0x40a00024, 0x40a0002d, 0x40a00036,
+    0x40a0003f, 0x40a00048, 0x40a00051, 0x40a0005a, 0x40a00063, 0x40a0006c, 0x40a00075, 0x40a0007e,
+    0x00b00009, 0x40b00012, 0x00c00009, 0x40c00012, 0x00d00009, 0x40d00012, 0x00e00009, 0x40e00012,
+    0x40e0001b, 0x40e00024, 0x40e0002d, 0x40e00036, 0x00f00009, 0x40f00012, 0x40f0001b, 0x40f00024,
+    0x40f0002d, 0x40f00036, 0x01000009, 0x41000012, 0x01100009, 0x01200009, 0x01300009, 0x41300012,
+    0x4130001b, 0x41300024, 0x4130002d, 0x41300036, 0x01400009, 0x41400012, 0x4140001b, 0x41400024,
+    0x4140002d, 0x41400036, 0x01500009, 0x41500012, 0x4150001b, 0x01600009, 0x41600012, 0x4160001b,
+    0x01700009, 0x41700012, 0x4170001b, 0x01800009, 0x41800012, 0x4180001b, 0x01900009, 0x41900012,
+    0x4190001b, 0x01a00009, 0x41a00012, 0x41a0001b, 0x01b00009, 0x01c00009, 0x01d00009, 0x01e00009,
+    0x41e00012, 0x01f00009, 0x41f00012, 0x41f0001b, 0x41f00024, 0x41f0002d, 0x41f00036, 0x41f0003f,
+    0x02000009, 0x02100009, 0x02200009, 0x42200012, 0x4220001b, 0x02300009, 0x02400009, 0x02500009,
+    0x42500012, 0x4250001b, 0x42500024, 0x4250002d, 0x42500036, 0x4250003f, 0x42500048, 0x42500051,
+    0x4250005a, 0x42500063, 0x02600009, 0x02700009, 0x42700012, 0x4270001b, 0x42700024, 0x4270002d,
+    0x02800009, 0x42800012, 0x02900009, 0x42900012, 0x4290001b, 0x02a00009, 0x42a00012, 0x42a0001b,
+    0x42a00024, 0x42a0002d, 0x02b00009, 0x42b00012, 0x42b0001b, 0x42b00024, 0x42b0002d, 0x02c00009,
+    0x42c00012, 0x42c0001b, 0x42c00024, 0x42c0002d, 0x42c00036, 0x42c0003f, 0x42c00048, 0x42c00051,
+    0x02d00009, 0x42d00012, 0x42d0001b, 0x42d00024, 0x42d0002d, 0x02e00009, 0x42e00012, 0x42e0001b,
+    0x42e00024, 0x42e0002d, 0x42e00036, 0x42e0003f, 0x42e00048, 0x42e00051, 0x42e0005a, 0x02f00009,
+    0x42f00012, 0x42f0001b, 0x42f00024, 0x42f0002d, 0x42f00036, 0x42f0003f, 0x42f00048, 0x42f00051,
+    0x42f0005a, 0x03000009, 0x43000012, 0x4300001b, 0x43000024, 0x4300002d, 0x43000036, 0x03100009,
+    0x43100012, 0x4310001b, 0x43100024, 0x4310002d, 0x43100036, 0x03200009, 0x43200012, 0x4320001b,
+    0x43200024, 0x4320002d, 0x43200036, 0x4320003f, 0x03300009, 0x43300012, 0x4330001b, 0x43300024,
+    0x03400009, 0x43400012, 0x03500009, 0x43500012, 0x4350001b, 0x03600009, 0x43600012, 0x4360001b,
+    0x03700009, 0x43700012, 0x4370001b, 0x43700024, 0x4370002d, 0x03800009, 0x03900009, 0x43900012,
+    0x4390001b, 0x43900024, 0x4390002d, 0x43900036, 0x03a00009, 0x43a00012, 0x43a0001b, 0x43a00024,
+    0x03b00009, 0x43b00012, 0x43b0001b, 0x43b00024, 0x43b0002d, 0x43b00036, 0x03c00009, 0x43c00012,
+    0x03d00009, 0x43d00012, 0x03e00009, 0x43e00012, 0x43e0001b, 0x43e00024, 0x03f00009, 0x04000009,
+    0x44000012, 0x4400001b, 0x44000024, 0x4400002d, 0x44000036, 0x4400003f, 0x04100009, 0x44100012,
+    0x4410001b, 0x44100024, 0x4410002d, 0x44100036, 0x4410003f, 0x44100048, 0x04200009, 0x04300009,
+    0x44300012, 0x4430001b, 0x44300024, 0x4430002d, 0x44300036, 0x4430003f, 0x04400009, 0x44400012,
+    0x4440001b, 0x44400024, 0x4440002d, 0x04500018, 0x4010001b, 0x04600009, 0x04700009, 0x04800009,
+    0x44800012, 0x04900009, 0x44900012, 0x04a00008, 0x04b00010, 0x44b00020, 0x44b00030, 0x04c00009,
+    0x44c00012, 0x04d00008, 0x04e00010, 0x44e00020, 0x44e00030, 0x44d00010, 0x04f00010, 0x05000009,
+    0x45000012, 0x05100018, 0x05200008, 0x05300018, 0x45200028, 0x44c0001b, 0x44c00024, 0x4500001b,
+    0x45000024, 0x44e00040, 0x05400009, 0x45400012, 0x4540001b, 0x45400024, 0x05500018, 0x05600008,
+    0x05700008, 0x05800010, 0x45800020, 0x45800030, 0x45800040, 0x45800050, 0x05900009, 0x45900012,
+    0x05a00008, 0x05b00010, 0x45b00020, 0x45b00030, 0x45b00040, 0x45b00050, 0x45b00060, 0x45b00070,
+    0x05c00009, 0x45c00012, 0x45c0001b, 0x05d00018, 0x05e00008, 0x05f00008, 0x06000005, 0x06100014,
+    0x06200014, 0x86200000, 0x86100000, 0x86000000, 0x06000008, 0x06100020, 0x06200020, 0x86200000,
+    0x86100000, 0x06100010, 0x06200009, 0x46200012, 0x4620001b, 0x06300020, 0x86300000, 0x06300020,
+    0x86300000, 0x06300020, 0x86300000, 0x06300020, 0x86300000, 0x06300020, 0x86300000, 0x45700010,
+    0x06300010, 0x46300020, 0x46300030, 0x46300040, 0x46300050, 0x06400009, 0x46400012, 0x45a00010,
+    0x06500010, 0x46500020, 0x46500030, 0x46500040, 0x46500050, 0x46500060, 0x46500070, 0x06600009,
+    0x46600012, 0x4660001b, 0x06700018, 0x06800008, 0x06900008, 0x06a00005, 0x06b00014, 0x06c00014,
+    0x86c00000, 0x86b00000, 0x86a00000, 0x06a0000a, 0x06b00028, 0x06c00028, 0x86c00000, 0x86b00000,
+    0x06b00010, 0x06c00009, 0x46c00012, 0x46c0001b, 0x45700018, 0x06d00010, 0x46d00020, 0x46d00030,
+    0x46d00040, 0x46d00050, 0x06e00009, 0x46e00012, 0x45a00018, 0x06f00010, 0x46f00020, 0x46f00030,
+    0x46f00040, 0x46f00050, 0x46f00060, 0x46f00070, 0x07000009, 0x47000012, 0x4700001b, 0x07100018,
+    0x07200008, 0x07300008, 0x07400005, 0x07500014, 0x07600014, 0x87600000, 0x87500000, 0x87400000,
+    0x07400005, 0x07500014, 0x07600014, 0x87600000, 0x87500000, 0x07500010, 0x07600009, 0x47600012,
+    0x4760001b, 0x4540002d, 0x45a00020, 0x07700010, 0x07800009, 0x47800012, 0x4780001b, 0x45a00028,
+    0x07900005, 0x07a00014, 0x07b00014, 0x87b00000, 0x87a00000, 0x07a00010, 0x87900000, 0x0790000c,
+    0x07b0000d, 0x07c00030, 0x07d00030, 0x87d00000, 0x87c00000, 0x87900000, 0x07900020, 0x47900040,
+    0x47900060, 0x87900000, 0x07900020, 0x87900000, 0x07900020, 0x47900040, 0x47900060, 0x87900000,
+    0x47a00020, 0x07900009, 0x47900012, 0x4790001b, 0x45a00030, 0x07c00005, 0x07d00014, 0x07e00014,
+    0x87e00000, 0x87d00000, 0x87c00000, 0x07c00010, 0x07d00020, 0x47d00040, 0x47d00060, 0x87d00000,
+    0x47c00020, 0x07d00009, 0x47d00012, 0x47d0001b, 0x07e00008, 0x07f00010, 0x47f00020, 0x47f00030,
+    0x47f00040, 0x08000009, 0x08100008, 0x48100010, 0x08200005, 0x08300014, 0x08400014, 0x88400000,
+    0x88300000, 0x08300010, 0x88200000, 0x48100018, 0x08200005, 0x08400014, 0x08500014, 0x88500000,
+    0x88400000, 0x08400010, 0x88200000, 0x48100020, 0x08200005, 0x08500014, 0x08600014, 0x88600000,
+    0x88500000, 0x08500010, 0x88200000, 0x48100028, 0x08200005, 0x08600014, 0x08700014, 0x88700000,
+    0x88600000, 0x88200000, 0x48100030, 0x08200005, 0x08600014, 0x08700014, 0x88700000, 0x88600000,
+    0x08600010, 0x88200000, 0x48100038, 0x08200005, 0x08700014, 0x08800014, 0x88800000, 0x88700000,
+    0x88200000, 0x48100040, 0x08200010, 0x48200020, 0x48200030, 0x48200040, 0x48200050, 0x48200060,
+    0x48200070, 0x48200080, 0x48200090, 0x482000a0, 0x08700009, 0x08800008, 0x08900005, 0x08a00014,
+    0x08b00014, 0x88b00000, 0x88a00000, 0x88900000, 0x08900010, 0x08a00009, 0x48a00012, 0x48a0001b,
+    0x48100048, 0x08b00010, 0x48b00020, 0x48b00030, 0x48b00040, 0x48b00050, 0x48b00060, 0x48b00070,
+    0x48b00080, 0x48b00090, 0x48b000a0, 0x08c00018, 0x08d00009, 0x08e00030, 0x08f00098, 0x48d00012,
+    0x09000030, 0x09100098, 0x48b000b0, 0x09200009, 0x09300008, 0x09400005, 0x09500014, 0x09600014,
+    0x89600000, 0x89500000, 0x89400000, 0x09400010, 0x09500009, 0x49500012, 0x4950001b, 0x44a00010,
+    0x09600010, 0x49600020, 0x49600030, 0x49600040, 0x49600050, 0x49600060, 0x49600070, 0x49600080,
+    0x49600090, 0x496000a0, 0x496000b0, 0x496000c0, 0x09700050, 0x09800014, 0x496000d0, 0x09900009,
+    0x49900012, 0x4990001b, 0x09a00018, 0x09b00008, 0x49900024, 0x89700000, 0x89800000, 0x09800290,
+    0x097000a4, 0x09c000a4, 0x89c00000, 0x47e00010, 0x09c00010, 0x49c00020, 0x49c00030, 0x49c00040,
+    0x09d00009, 0x09e00008, 0x09f00005, 0x0a000014, 0x0a100014, 0x8a100000, 0x8a000000, 0x0a000010,
+    0x89f00000, 0x49e00010, 0x09f00005, 0x0a100014, 0x0a200014, 0x8a200000, 0x8a100000, 0x89f00000,
+    0x09f00010, 0x49e00018, 0x0a100010, 0x4a100020, 0x4a100030, 0x4a100040, 0x4a100050, 0x4a100060,
+    0x4a100070, 0x4a100080, 0x4a100090, 0x0a200008, 0x0a300010, 0x0a400005, 0x0a500014, 0x0a600014,
+    0x8a600000, 0x8a500000, 0x4a300020, 0x0a500009, 0x8a400000, 0x0a400001, 0x0a600004, 0x0a700004,
+    0x8a700000, 0x8a600000, 0x0a600018, 0x0a700008, 0x0a800018, 0x4a700028, 0x0a900020, 0x4a900040,
+    0x4a900060, 0x8a900000, 0x4a400001, 0x0a900004, 0x0aa00004, 0x8aa00000, 0x8a900000, 0x4a400001,
+    0x0a900004, 0x0aa00004, 0x8aa00000, 0x8a900000, 0x4a400001, 0x0a900004, 0x0aa00004, 0x8aa00000,
+    0x8a900000, 0x4a400001, 0x0a900004, 0x0aa00004, 0x8aa00000, 0x8a900000, 0x4a500012, 0x4a400001,
+    0x0a900004, 0x0aa00004, 0x8aa00000, 0x8a900000, 0x4a1000a0, 0x0a900009, 0x0aa0000a, 0x0ab00018,
+    0x0ac00008, 0x49e00020, 0x0ad00005, 0x0ae00014, 0x0af00014, 0x8af00000, 0x8ae00000, 0x8ad00000,
+    0x0ad00010, 0x49e00028, 0x0ae00010, 0x4ae00020, 0x4ae00030, 0x4ae00040, 0x4ae00050, 0x4ae00060,
+    0x4ae00070, 0x4ae00080, 0x4ae00090, 0x0af00008, 0x0b000010, 0x0b100005, 0x0b200014, 0x0b300014,
+    0x8b300000, 0x8b200000, 0x4b000020, 0x0b200009, 0x8b100000, 0x0b100001, 0x0b300004, 0x0b400004,
+    0x8b400000, 0x8b300000, 0x0b300018, 0x0b400008, 0x0b500018, 0x4b400028, 0x4b100001, 0x0b600004,
+    0x0b700004, 0x8b700000, 0x8b600000, 0x4b100001, 0x0b600004, 0x0b700004, 0x8b700000, 0x8b600000,
+    0x4b100001, 0x0b600004, 0x0b700004, 0x8b700000, 0x8b600000, 0x4b100001, 0x0b600004, 0x0b700004,
+    0x8b700000, 0x8b600000, 0x4b200012, 0x4b100001, 0x0b600004, 0x0b700004, 0x8b700000, 0x8b600000,
+    0x4ae000a0, 0x0b600009, 0x0b700001, 0x0b80000e, 0x0b900018, 0x0ba00008, 0x49e00030, 0x0bb00005,
+    0x0bc00014, 0x0bd00014, 0x8bd00000, 0x8bc00000, 0x8bb00000, 0x0bb00010, 0x49e00038, 0x0bc00010,
+    0x4bc00020, 0x4bc00030, 0x4bc00040, 0x4bc00050, 0x4bc00060, 0x4bc00070, 0x4bc00080, 0x4bc00090,
+    0x44a00018, 0x0bd00010, 0x4bd00020, 0x4bd00030, 0x4bd00040, 0x4bd00050, 0x4bd00060, 0x4bd00070,
+    0x4bd00080, 0x4bd00090, 0x0be00008, 0x0bf00005, 0x0c000014, 0x0c100014, 0x8c100000, 0x8c000000,
+    0x49e00040, 0x0c000005, 0x0c100014, 0x0c200014, 0x8c200000, 0x8c100000, 0x8c000000, 0x0c000010,
+    0x49e00048, 0x0c100010, 0x4c100020, 0x4c100030, 0x4c100040, 0x4c100050, 0x4c100060, 0x4c100070,
+    0x4c100080, 0x4c100090, 0x0c200008, 0x0c300010, 0x0c400005, 0x0c500014, 0x0c600014, 0x8c600000,
+    0x8c500000, 0x4c300020, 0x0c500009, 0x8c400000, 0x0c400001, 0x0c600004, 0x0c700004, 0x8c700000,
+    0x8c600000, 0x0c600018, 0x0c700008, 0x0c800018, 0x4c700028, 0x4c400001, 0x0c900004, 0x0ca00004,
+    0x8ca00000, 0x8c900000, 0x4c400001, 0x0c900004, 0x0ca00004, 0x8ca00000, 0x8c900000, 0x4c400001,
+    0x0c900004, 0x0ca00004, 0x8ca00000, 0x8c900000, 0x4c400001, 0x0c900004, 0x0ca00004, 0x8ca00000,
+    0x8c900000, 0x4c500012, 0x4c400001, 0x0c900004, 0x0ca00004, 0x8ca00000, 0x8c900000, 0x4c1000a0,
+    0x0c900009, 0x0ca00018, 0x0cb00008, 0x47e00018, 0x0cc00010, 0x4cc00020, 0x4cc00030, 0x0cd00008,
+    0x0ce00005, 0x0cf00014, 0x0d000014, 0x8d000000, 0x8cf00000, 0x0cf00010, 0x8ce00000, 0x4cd00010,
+    0x0ce00005, 0x0d000014, 0x0d100014, 0x8d100000, 0x8d000000, 0x8ce00000, 0x0ce00010, 0x4cd00018,
+    0x0d000010, 0x4d000020, 0x4d000030, 0x4d000040, 0x4d000050, 0x4d000060, 0x4d000070, 0x4d000080,
+    0x4d000090, 0x4d0000a0, 0x4d0000b0, 0x0d100009, 0x0d200018, 0x0d300008, 0x4cd00020, 0x0d400005,
+    0x0d500014, 0x0d600014, 0x8d600000, 0x8d500000, 0x8d400000, 0x0d400010, 0x4cd00028, 0x0d500010,
+    0x4d500020, 0x4d500030, 0x4d500040, 0x4d500050, 0x4d500060, 0x4d500070, 0x4d500080, 0x4d500090,
+    0x4d5000a0, 0x4d5000b0, 0x4d5000c0, 0x4cd00030, 0x0d600005, 0x0d700014, 0x0d800014, 0x8d800000,
+    0x8d700000, 0x8d600000, 0x0d600010, 0x4cd00038, 0x0d700010, 0x4d700020, 0x4d700030, 0x4d700040,
+    0x4d700050, 0x4d700060, 0x4d700070, 0x4d700080, 0x4d700090, 0x4d7000a0, 0x4d7000b0, 0x4d7000c0,
+    0x4590001b, 0x45900024, 0x4590002d, 0x48000012, 0x4800001b, 0x48000024, 0x4800002d, 0x48000036,
+    0x4800003f, 0x48000048, 0x48000051, 0x4800005a, 0x0d800010, 0x0d900009, 0x4d900012, 0x4d90001b,
+    0x4d900024, 0x4d90002d, 0x4d900036, 0x48300020, 0x0da00009, 0x4da00012, 0x4da0001b, 0x4da00024,
+    0x4da0002d, 0x4da00036, 0x48400020, 0x0db00009, 0x4db00012, 0x4db0001b, 0x4db00024, 0x4db0002d,
+    0x4db00036, 0x48500020, 0x0dc00009, 0x4dc00012, 0x4dc0001b, 0x4dc00024, 0x4dc0002d, 0x4dc00036,
+    0x0dd00010, 0x0de00009, 0x4de00012, 0x4de0001b, 0x4de00024, 0x4de0002d, 0x4de00036, 0x48600020,
+    0x0df00009, 0x4df00012, 0x4df0001b, 0x4df00024, 0x4df0002d, 0x4df00036, 0x0e000010, 0x0e100009,
+    0x4e100012, 0x4e10001b, 0x4e100024, 0x4e10002d, 0x4e100036, 0x48700012, 0x4870001b, 0x48700024,
+    0x4870002d, 0x48700036, 0x4870003f, 0x49200012, 0x4920001b, 0x49200024, 0x4920002d, 0x49200036,
+    0x4920003f, 0x49d00012, 0x49d0001b, 0x49d00024, 0x49d0002d, 0x49d00036, 0x49d0003f, 0x49d00048,
+    0x49d00051, 0x49d0005a, 0x4a000020, 0x0e200009, 0x4e200012, 0x4e20001b, 0x4e200024, 0x4e20002d,
+    0x4e200036, 0x4a900012, 0x4a90001b, 0x4a900024, 0x4a90002d, 0x4a900036, 0x4a90003f, 0x49f00020,
+    0x0e300009, 0x4e300012, 0x4e30001b, 0x4e300024, 0x4e30002d, 0x4e300036, 0x4b600012, 0x4b60001b,
+    0x4b600024, 0x4b60002d, 0x4b600036, 0x4b60003f, 0x4ad00020, 0x0e400009, 0x4e400012, 0x4e40001b,
+    0x4e400024, 0x4e40002d, 0x4e400036, 0x4c900012, 0x4c90001b, 0x4c900024, 0x4c90002d, 0x4c900036,
+    0x4c90003f, 0x4c000020, 0x0e500009, 0x4e500012, 0x4e50001b, 0x4e500024, 0x4e50002d, 0x4e500036,
+    0x4bc000a0, 0x0e600009, 0x4e600012, 0x4e60001b, 0x4e600024, 0x4e60002d, 0x4e600036, 0x4bb00020,
+    0x0e700009, 0x4e700012, 0x4e70001b, 0x4e700024, 0x4e70002d, 0x4e700036, 0x4cc00040, 0x0e800009,
+    0x4e800012, 0x4e80001b, 0x4e800024, 0x4e80002d, 0x4e800036, 0x4e80003f, 0x4e800048, 0x4e800051,
+    0x4cf00020, 0x0e900009, 0x4e900012, 0x4e90001b, 0x4e900024, 0x4e90002d, 0x4e900036, 0x4d100012,
+    0x4d10001b, 0x4d100024, 0x4d10002d, 0x4d100036, 0x4d10003f, 0x4ce00020, 0x0ea00009, 0x4ea00012,
+    0x4ea0001b, 0x4ea00024, 0x4ea0002d, 0x4ea00036, 0x4d7000d0, 0x0eb00009, 0x4eb00012, 0x4eb0001b,
+    0x4eb00024, 0x4eb0002d, 0x4eb00036, 0x4d600020, 0x0ec00009, 0x4ec00012, 0x4ec0001b, 0x4ec00024,
+    0x4ec0002d, 0x4ec00036, 0x4d5000d0, 0x0ed00009, 0x4ed00012, 0x4ed0001b, 0x4ed00024, 0x4ed0002d,
+    0x4ed00036, 0x4d400020, 0x0ee00009, 0x4ee00012, 0x4ee0001b, 0x4ee00024, 0x4ee0002d, 0x4ee00036,
+    0x4640001b, 0x46400024, 0x0ef00008, 0x0f000010, 0x4f000020, 0x4f000030, 0x4f000040, 0x0f100009,
+    0x4f100012, 0x4f10001b, 0x4f100024, 0x4f10002d, 0x4f100036, 0x4f10003f, 0x4f100048, 0x0f200008,
+    0x0f300005, 0x0f400014, 0x0f500014, 0x8f500000, 0x8f400000, 0x0f400010, 0x8f300000, 0x4f400020,
+    0x0f300009, 0x4f300012, 0x4f30001b, 0x4f300024, 0x4f30002d, 0x4f300036, 0x4f200010, 0x0f500010,
+    0x4f500020, 0x4f500030, 0x4f500040, 0x0f600009, 0x4f600012, 0x4f60001b, 0x4f600024, 0x4f60002d,
+    0x4f600036, 0x4f200018, 0x0f700010, 0x4f700020, 0x4f700030, 0x4f700020, 0x4f700030, 0x0f800009,
+    0x4f800012, 0x4f80001b, 0x4f800024, 0x4f80002d, 0x4f800036, 0x4f80003f, 0x4f800048, 0x4f800051,
+    0x0f900008, 0x0fa00010, 0x4fa00020, 0x4fa00030, 0x4fa00040, 0x4fa00050, 0x4fa00060, 0x4fa00070,
+    0x4fa00080, 0x4fa00090, 0x0fb00009, 0x4fb00012, 0x4fb0001b, 0x4fb00024, 0x4fb0002d, 0x4fb00036,
+    0x4fb0003f, 0x0fc00018, 0x0fd00008, 0x4fb00048, 0x4fb00051, 0x4f900010, 0x0fe00010, 0x4fe00020,
+    0x4fe00030, 0x4fe00040, 0x0ff00009, 0x4ff00012, 0x4ff0001b, 0x4ff00024, 0x4ff0002d, 0x4ff00036,
+    0x4ff0003f, 0x4ff00048, 0x4ff00051, 0x4ff0005a, 0x4f60003f, 0x4f600048, 0x10000030, 0x10100030,
+    0x4ef00010, 0x10200010, 0x50200020, 0x50200030, 0x50200040, 0x10300009, 0x50300012, 0x5030001b,
+    0x50300024, 0x5030002d, 0x50300036, 0x5030003f, 0x50300048, 0x10400008, 0x10500005, 0x10600014,
+    0x10700014, 0x90700000, 0x90600000, 0x10600010, 0x90500000, 0x50600020, 0x10500009, 0x50500012,
+    0x5050001b, 0x50500024, 0x5050002d, 0x50500036, 0x50400010, 0x10700010, 0x50700020, 0x50700030,
+    0x50700040, 0x10800009, 0x50800012, 0x5080001b, 0x50800024, 0x5080002d, 0x50800036, 0x50400018,
+    0x10900010, 0x50900020, 0x50900030, 0x50900020, 0x50900030, 0x10a00009, 0x50a00012, 0x50a0001b,
+    0x50a00024, 0x50a0002d, 0x50a00036, 0x50a0003f, 0x50a00048, 0x50a00051, 0x10b00008, 0x10c00010,
+    0x50c00020, 0x50c00030, 0x50c00040, 0x50c00050, 0x50c00060, 0x50c00070, 0x50c00080, 0x50c00090,
+    0x10d00009, 0x50d00012, 0x50d0001b, 0x50d00024, 0x50d0002d, 0x50d00036, 0x50d0003f, 0x10e00018,
+    0x10f00008, 0x50d00048, 0x50d00051, 0x50b00010, 0x11000010, 0x51000020, 0x51000030, 0x51000040,
+    0x11100009, 0x51100012, 0x5110001b, 0x51100024, 0x5110002d, 0x51100036, 0x5110003f, 0x51100048,
+    0x51100051, 0x5110005a, 0x5080003f, 0x50800048, 0x11200030, 0x11300030, 0x11400030, 0x11500030,
+    0x11600014, 0x11700014, 0x11800018, 0x11900018, 0x91800000, 0x91600000, 0x91900000, 0x91700000,
+    0x1170001c, 0x1190001c, 0x11600008, 0x11800008, 0x4a1000b0, 0x11a00018, 0x11b00009, 0x11c00030,
+    0x11d00098, 0x4a400001, 0x11e00004, 0x11f00004, 0x91f00000, 0x91e00000, 0x11e00098, 0x4ae000b0,
+    0x11f00018, 0x12000009, 0x12100030, 0x12200098, 0x4b100001, 0x12300004, 0x12400004, 0x92400000,
+    0x92300000, 0x12300098, 0x4c1000b0, 0x12400018, 0x12500009, 0x12600030, 0x12700098, 0x4c400001,
+    0x12800004, 0x12900004, 0x92900000, 0x92800000, 0x12800098, 0x91600000, 0x91700000, 0x91800000,
+    0x91900000, 0x1190001c, 0x1180001c, 0x11700008, 0x11600008, 0x91700000, 0x91900000, 0x91600000,
+    0x91800000, 0x11800008, 0x11600008, 0x11900008, 0x11700008, 0x91900000, 0x91800000, 0x91700000,
+    0x91600000, 0x1160000c, 0x11700008, 0x11800008, 0x91600000, 0x11600008, 0x11900004, 0x12900004,
+    0x91600000, 0x91900000, 0x91700000, 0x92900000, 0x91800000, 0x1180000c, 0x1290000c, 0x11700008,
+    0x11900008, 0x91700000, 0x91800000, 0x91900000, 0x92900000, 0x1290000c, 0x11900008, 0x11800008,
+    0x92900000, 0x12900008, 0x11700004, 0x11600004, 0x92900000, 0x91700000, 0x91900000, 0x91600000,
+    0x91800000, 0x1180000c, 0x1160000c, 0x11900008, 0x11700008, 0x91900000, 0x91800000, 0x91700000,
+    0x91600000, 0x11600020, 0x91600000, 0x11600020, 0x91600000, 0x11600014, 0x11700014, 0x11800018,
+    0x11900018, 0x91800000, 0x91600000, 0x91900000, 0x91700000, 0x4a400001, 0x11700004, 0x11900004,
+    0x91900000, 0x91700000, 0x4b100001, 0x11700004, 0x11900004, 0x91900000, 0x91700000, 0x4c400001,
+    0x11700004, 0x11900004, 0x91900000, 0x91700000, 0x1170001c, 0x1190001c, 0x11600008, 0x11800008,
+    0x91e00000, 0x92300000, 0x92800000, 0x91600000, 0x91700000, 0x91800000, 0x91900000, 0x1190001c,
+    0x1180001c, 0x11700008, 0x11600008, 0x91700000, 0x91900000, 0x91600000, 0x91800000, 0x11800008,
+    0x11600008, 0x11900008, 0x11700008, 0x91900000, 0x91800000, 0x91700000, 0x91600000, 0x1160000c,
+    0x11700008, 0x11800008, 0x91600000, 0x11600008, 0x11900004, 0x12800004, 0x91600000, 0x91900000,
+    0x91700000, 0x92800000, 0x91800000, 0x1180000c, 0x1280000c, 0x11700008, 0x11900008, 0x91700000,
+    0x91800000, 0x91900000, 0x92800000, 0x1280000c, 0x11900008, 0x11800008, 0x92800000, 0x12800008,
+    0x11700004, 0x11600004, 0x92800000, 0x91700000, 0x91900000, 0x91600000, 0x91800000, 0x1180000c,
+    0x1160000c, 0x11900008, 0x11700008, 0x91900000, 0x91800000, 0x91700000, 0x91600000, 0x11600020,
+    0x91600000, 0x11600020, 0x91600000, 0x11600014, 0x11700014, 0x11800018, 0x11900018, 0x91800000,
+    0x91600000, 0x91900000, 0x91700000, 0x4a400001, 0x11700004, 0x11900004, 0x91900000, 0x91700000,
+    0x4b100001, 0x11700004, 0x11900004, 0x91900000, 0x91700000, 0x4c400001, 0x11700004, 0x11900004,
+    0x91900000, 0x91700000, 0x1170001c, 0x1190001c, 0x11600008, 0x11800008, 0x91600000, 0x91700000,
+    0x91800000, 0x91900000, 0x11900008, 0x11800008, 0x11700008, 0x11600008, 0x91700000, 0x91900000,
+    0x91600000, 0x91800000, 0x1180000c, 0x11600008, 0x11900008, 0x91800000, 0x11800008, 0x11700004,
+    0x12800004, 0x91800000, 0x91700000, 0x91600000, 0x92800000, 0x91900000, 0x1190000c, 0x1280000c,
+    0x11600008, 0x11700008, 0x91600000, 0x91900000, 0x91700000, 0x92800000, 0x1280000c, 0x11700008,
+    0x11900008, 0x92800000, 0x12800008, 0x11600004, 0x11800004, 0x92800000, 0x91600000, 0x91700000,
+    0x91800000, 0x91900000, 0x1190000c, 0x1180000c, 0x11700008, 0x11600008, 0x91700000, 0x91900000,
+    0x91600000, 0x91800000, 0x11800014, 0x11600014, 0x11900018, 0x11700018, 0x91900000, 0x91800000,
+    0x91700000, 0x91600000, 0x4ef00018, 0x11600010, 0x51600020, 0x51600030, 0x51600040, 0x11700009,
+    0x51700012, 0x11800008, 0x11900005, 0x12800014, 0x12300014, 0x92300000, 0x92800000, 0x12800010,
+    0x91900000, 0x51800010, 0x11900010, 0x51900020, 0x51900030, 0x51900040, 0x12300009, 0x51800018,
+    0x11e00010, 0x51e00020, 0x51e00030, 0x51e00040, 0x12900009, 0x52900012, 0x51e00030, 0x51e00040,
+    0x5290001b, 0x51800020, 0x12a00005, 0x12b00014, 0x12c00014, 0x92c00000, 0x92b00000, 0x92a00000,
+    0x51800028, 0x12a00010, 0x52a00020, 0x52a00030, 0x52a00040, 0x12b00009, 0x52b00012, 0x52a00030,
+    0x52a00040, 0x52b0001b, 0x51800030, 0x12c00005, 0x12d00014, 0x12e00014, 0x92e00000, 0x92d00000,
+    0x92c00000, 0x51800038, 0x12c00010, 0x52c00020, 0x52c00030, 0x52c00040, 0x12d00009, 0x52d00012,
+    0x52c00030, 0x52c00040, 0x52d0001b, 0x51800040, 0x12e00005, 0x12f00014, 0x13000014, 0x93000000,
+    0x92f00000, 0x92e00000, 0x5170001b, 0x51700024, 0x5170002d, 0x52800020, 0x12e00009, 0x52e00012,
+    0x52e0001b, 0x52e00024, 0x52e0002d, 0x52e00036, 0x52300012, 0x5230001b, 0x52300024, 0x5230002d,
+    0x52300036, 0x5230003f, 0x52900024, 0x5290002d, 0x52900036, 0x5290003f, 0x52900048, 0x52900051,
+    0x52b00024, 0x52b0002d, 0x52b00036, 0x52b0003f, 0x52b00048, 0x52b00051, 0x52d00024, 0x52d0002d,
+    0x52d00036, 0x52d0003f, 0x52d00048, 0x52d00051, 0x12f00010, 0x13000009, 0x53000012, 0x5300001b,
+    0x53000024, 0x5300002d, 0x53000036, 0x13100010, 0x13200009, 0x53200012, 0x5320001b, 0x53200024,
+    0x5320002d, 0x53200036, 0x13300010, 0x13400009, 0x53400012, 0x5340001b, 0x53400024, 0x5340002d,
+    0x53400036, 0x4ef00020, 0x13500010, 0x53500020, 0x53500030, 0x53500040, 0x13600009, 0x53600012,
+    0x13700008, 0x13800005, 0x13900014, 0x13a00014, 0x93a00000, 0x93900000, 0x13900010, 0x93800000,
+    0x53700010, 0x13800010, 0x53800020, 0x53800030, 0x53800040, 0x13a00009, 0x53700018, 0x13b00010,
+    0x53b00020, 0x53b00030, 0x53b00040, 0x13c00009, 0x53c00012, 0x53b00030, 0x53b00040, 0x53c0001b,
+    0x53700020, 0x13d00005, 0x13e00014, 0x13f00014, 0x93f00000, 0x93e00000, 0x93d00000, 0x53700028,
+    0x13d00010, 0x53d00020, 0x53d00030, 0x53d00040, 0x13e00009, 0x53e00012, 0x53d00030, 0x53d00040,
+    0x53e0001b, 0x53700030, 0x13f00005, 0x14000014, 0x14100014, 0x94100000, 0x94000000, 0x93f00000,
+    0x53700038, 0x13f00010, 0x53f00020, 0x53f00030, 0x53f00040, 0x14000009, 0x54000012, 0x53f00030,
+    0x53f00040, 0x5400001b, 0x53700040, 0x14100005, 0x14200014, 0x14300014, 0x94300000, 0x94200000,
+    0x94100000, 0x5360001b, 0x53600024, 0x5360002d, 0x53900020, 0x14100009, 0x54100012, 0x5410001b,
+    0x54100024, 0x5410002d, 0x54100036, 0x53a00012, 0x53a0001b, 0x53a00024, 0x53a0002d, 0x53a00036,
+    0x53a0003f, 0x53c00024, 0x53c0002d, 0x53c00036, 0x53c0003f, 0x53c00048, 0x53c00051, 0x53e00024,
+    0x53e0002d, 0x53e00036, 0x53e0003f, 0x53e00048, 0x53e00051, 0x54000024, 0x5400002d, 0x54000036,
+    0x5400003f, 0x54000048, 0x54000051, 0x14200010, 0x14300009, 0x54300012, 0x5430001b, 0x54300024,
+    0x5430002d, 0x54300036, 0x14400010, 0x14500009, 0x54500012, 0x5450001b, 0x54500024, 0x5450002d,
+    0x54500036, 0x14600010, 0x14700009, 0x54700012, 0x5470001b, 0x54700024, 0x5470002d, 0x54700036,
+    0x4ef00028, 0x14800010, 0x54800020, 0x54800030, 0x54800040, 0x14900009, 0x54900012, 0x14a00008,
+    0x14b00005, 0x14c00014, 0x14d00014, 0x94d00000, 0x94c00000, 0x14c00010, 0x94b00000, 0x54a00010,
+    0x14b00010, 0x54b00020, 0x54b00030, 0x54b00040, 0x14d00009, 0x54a00018, 0x14e00010, 0x54e00020,
+    0x54e00030, 0x54e00040, 0x14f00009, 0x54f00012, 0x54e00030, 0x54e00040, 0x54f0001b, 0x54a00020,
+    0x15000005, 0x15100014, 0x15200014, 0x95200000, 0x95100000, 0x95000000, 0x54a00028, 0x15000010,
+    0x55000020, 0x55000030, 0x55000040, 0x15100009, 0x55100012, 0x55000030, 0x55000040, 0x5510001b,
+    0x54a00030, 0x15200005, 0x15300014, 0x15400014, 0x95400000, 0x95300000, 0x95200000, 0x54a00038,
+    0x15200010, 0x55200020, 0x55200030, 0x55200040, 0x15300009, 0x55300012, 0x55200030, 0x55200040,
+    0x5530001b, 0x54a00040, 0x15400005, 0x15500014, 0x15600014, 0x95600000, 0x95500000, 0x95400000,
+    0x5490001b, 0x54900024, 0x5490002d, 0x54c00020, 0x15400009, 0x55400012, 0x5540001b, 0x55400024,
+    0x5540002d, 0x55400036, 0x54d00012, 0x54d0001b, 0x54d00024, 0x54d0002d, 0x54d00036, 0x54d0003f,
+    0x54f00024, 0x54f0002d, 0x54f00036, 0x54f0003f, 0x54f00048, 0x54f00051, 0x55100024, 0x5510002d,
+    0x55100036, 0x5510003f, 0x55100048, 0x55100051, 0x55300024, 0x5530002d, 0x55300036, 0x5530003f,
+    0x55300048, 0x55300051, 0x15500010, 0x15600009, 0x55600012, 0x5560001b, 0x55600024, 0x5560002d,
+    0x55600036, 0x15700010, 0x15800009, 0x55800012, 0x5580001b, 0x55800024, 0x5580002d, 0x55800036,
+    0x15900010, 0x15a00009, 0x55a00012, 0x55a0001b, 0x55a00024, 0x55a0002d, 0x55a00036, 0x15b0000c,
+    0x15c00008, 0x15d00008, 0x95b00000, 0x15b00008, 0x15e00004, 0x15f00004, 0x95b00000, 0x95e00000,
+    0x95c00000, 0x95f00000, 0x95d00000, 0x15d00014, 0x15f00014, 0x15c00008, 0x15e00008, 0x95c00000,
+    0x95d00000, 0x95e00000, 0x95f00000, 0x15f00014, 0x15e00014, 0x15d00008, 0x15c00008, 0x95d00000,
+    0x95f00000, 0x95c00000, 0x95e00000, 0x15e00014, 0x15c00014, 0x15f00008, 0x15d00008, 0x95f00000,
+    0x95e00000, 0x95d00000, 0x95c00000, 0x15c00020, 0x95c00000, 0x15c00020, 0x95c00000, 0x15c00020,
+    0x55c00040, 0x55c00060, 0x95c00000, 0x15c00014, 0x15d00014, 0x15e00008, 0x15f00008, 0x95e00000,
+    0x95c00000, 0x95f00000, 0x95d00000, 0x15d00014, 0x15f00014, 0x15c00008, 0x15e00008, 0x95c00000,
+    0x95d00000, 0x95e00000, 0x95f00000, 0x15f00014, 0x15e00014, 0x15d00008, 0x15c00008, 0x95d00000,
+    0x95f00000, 0x95c00000, 0x95e00000, 0x15e00020, 0x95e00000, 0x15e00020, 0x95e00000, 0x15e00020,
+    0x55e00040, 0x55e00060, 0x95e00000, 0x15e00014, 0x15c00014, 0x15f00008, 0x15d00008, 0x95f00000,
+    0x95e00000, 0x95d00000, 0x95c00000, 0x15c00014, 0x15d00014, 0x15e00008, 0x15f00008, 0x95e00000,
+    0x95c00000, 0x95f00000, 0x95d00000, 0x15d00014, 0x15f00014, 0x15c00008, 0x15e00008, 0x95c00000,
+    0x95d00000, 0x95e00000, 0x95f00000, 0x15f00020, 0x95f00000, 0x15f00020, 0x95f00000, 0x15f00020,
+    0x55f00040, 0x55f00060, 0x95f00000, 0x15f00014, 0x15e00014, 0x15d00008, 0x15c00008, 0x95d00000,
+    0x95f00000, 0x95c00000, 0x95e00000, 0x15e00014, 0x15c00014, 0x15f00008, 0x15d00008, 0x95f00000,
+    0x95e00000, 0x95d00000, 0x95c00000, 0x15c00014, 0x15d00014, 0x15e00008, 0x15f00008, 0x95e00000,
+    0x95c00000, 0x95f00000, 0x95d00000, 0x52300048, 0x53a00048, 0x54d00048, 0x52300051, 0x5230005a,
+    0x52300063, 0x5230006c, 0x15d00008, 0x15f00010, 0x55f00020, 0x55f00030, 0x55f00040, 0x55f00030,
+    0x55f00020, 0x55f00030, 0x15c00009, 0x55c00012, 0x55c0001b, 0x55f00040, 0x15e00009, 0x55e00012,
+    0x15b00098, 0x1600000e, 0x1610000f, 0x16200038, 0x16300038, 0x96300000, 0x96200000, 0x96000000,
+    0x55d00010, 0x16000010, 0x56000020, 0x56000030, 0x56000040, 0x56000030, 0x56000040, 0x16200009,
+    0x56200012, 0x5620001b, 0x56200024, 0x5620002d, 0x56200036, 0x5620003f, 0x56000050, 0x16300009,
+    0x56300012, 0x56200048, 0x56200051, 0x5620005a, 0x16400098, 0x96100000, 0x1610000e, 0x1650000f,
+    0x16600038, 0x16700038, 0x96700000, 0x96600000, 0x96100000, 0x55d00018, 0x16100010, 0x56100020,
+    0x56100030, 0x56100040, 0x56100030, 0x56100040, 0x16600009, 0x56600012, 0x5660001b, 0x56600024,
+    0x5660002d, 0x56600036, 0x5660003f, 0x56100050, 0x16700009, 0x56700012, 0x56600048, 0x56600051,
+    0x5660005a, 0x16800098, 0x96500000, 0x1650000e, 0x1690000f, 0x16a00038, 0x16b00038, 0x96b00000,
+    0x96a00000, 0x96500000, 0x53800050, 0x16500009, 0x16a00008, 0x16b00010, 0x56b00020, 0x56b00030,
+    0x56b00040, 0x56b00050, 0x16c00009, 0x56c00012, 0x56c0001b, 0x56c00024, 0x56c0002d, 0x56c00036,
+    0x56b00060, 0x16d00009, 0x56c0003f, 0x56b00070, 0x16e00009, 0x56e00012, 0x56e0001b, 0x56c00048,
+    0x56c00051, 0x56c0005a, 0x56a00010, 0x16f00010, 0x56f00020, 0x56f00030, 0x56f00040, 0x56f00050,
+    0x17000009, 0x57000012, 0x5700001b, 0x57000024, 0x5700002d, 0x57000036, 0x5700003f, 0x56f00060,
+    0x17100009, 0x56f00070, 0x17200009, 0x57200012, 0x5720001b, 0x57000048, 0x57000051, 0x5700005a,
+    0x56a00018, 0x17300010, 0x57300020, 0x57300030, 0x57300040, 0x57300050, 0x17400009, 0x57400012,
+    0x5740001b, 0x57300060, 0x17500009, 0x57300070, 0x17600009, 0x57600012, 0x5760001b, 0x57400024,
+    0x5740002d, 0x57400036, 0x17700048, 0x17800018, 0x17900008, 0x54b00050, 0x17a00009, 0x54b00060,
+    0x17b00009, 0x17c00009, 0x57c00012, 0x17d00009, 0x57d00012, 0x17e00009, 0x57e00012, 0x17f00009,
+    0x57f00012, 0x18000009, 0x58000012, 0x18100009, 0x58100012, 0x18200009, 0x58200012, 0x18300009,
+    0x58300012, 0x18400009, 0x58400012, 0x18500018, 0x18600008, 0x18700058, 0x18800058, 0x18900008,
+    0x18a00014, 0x18b00014, 0x18c00008, 0x18d00008, 0x98c00000, 0x98a00000, 0x98d00000, 0x98b00000,
+    0x18b00014, 0x18d00014, 0x18a00008, 0x18c00008, 0x98a00000, 0x98b00000, 0x98c00000, 0x98d00000,
+    0x18d00014, 0x18c00014, 0x18b00008, 0x18a00008, 0x98b00000, 0x98d00000, 0x98a00000, 0x98c00000,
+    0x18c00020, 0x98c00000, 0x18c00020, 0x98c00000, 0x18c00020, 0x58c00040, 0x58c00060, 0x98c00000,
+    0x18c00014, 0x18a00014, 0x18d00008, 0x18b00008, 0x98d00000, 0x98c00000, 0x98b00000, 0x98a00000,
+    0x18a00014, 0x18b00014, 0x18c00008, 0x18d00008, 0x98c00000, 0x98a00000, 0x98d00000, 0x98b00000,
+    0x18b00014, 0x18d00014, 0x18a00008, 0x18c00008, 0x98a00000, 0x98b00000, 0x98c00000, 0x98d00000,
+    0x18d00010, 0x18c00009, 0x58c00012, 0x58c0001b, 0x58900010, 0x18b00005, 0x18a00014, 0x18e00014,
+    0x98e00000, 0x98a00000, 0x18a00010, 0x98b00000, 0x58900018, 0x18b00005, 0x18e00014, 0x18f00014,
+    0x98f00000, 0x98e00000, 0x98b00000, 0x18b00005, 0x18e00014, 0x18f00014, 0x98f00000, 0x98e00000,
+    0x18e00098, 0x18f00003, 0x19000004, 0x1910000c, 0x1920000c, 0x99200000, 0x99100000, 0x98f00000,
+    0x58a00020, 0x18f00009, 0x58f00012, 0x58f0001b, 0x19100010, 0x19200009, 0x59200012, 0x5920001b,
+    0x19300018, 0x58600028, 0x46e0001b, 0x46e00024, 0x19400008, 0x19500010, 0x59500020, 0x59500030,
+    0x59500040, 0x19600009, 0x59600012, 0x5960001b, 0x19700008, 0x19800005, 0x19900014, 0x19a00014,
+    0x99a00000, 0x99900000, 0x19900010, 0x99800000, 0x59700010, 0x19800005, 0x19a00014, 0x19b00014,
+    0x99b00000, 0x99a00000, 0x19a00010, 0x99800000, 0x59a00020, 0x59700018, 0x19800005, 0x19b00014,
+    0x19c00014, 0x99c00000, 0x99b00000, 0x19b00010, 0x99800000, 0x59700020, 0x19800005, 0x19c00014,
+    0x19d00014, 0x99d00000, 0x99c00000, 0x99800000, 0x19800019, 0x19c0005c, 0x19d0005c, 0x99d00000,
+    0x99c00000, 0x19c00010, 0x19d00009, 0x59700028, 0x19e00010, 0x59e00020, 0x59e00030, 0x59e00040,
+    0x59e00050, 0x59e00060, 0x59e00070, 0x59e00080, 0x19f00018, 0x1a000008, 0x1a100030, 0x1a20001c,
+    0x1a300030, 0x1a40001c, 0x1a500030, 0x1a60001c, 0x59e00090, 0x1a700009, 0x5a700012, 0x5a70001b,
+    0x59600024, 0x5960002d, 0x59600036, 0x59900020, 0x1a800009, 0x5a800012, 0x5a80001b, 0x5a800024,
+    0x5a80002d, 0x5a800036, 0x59a00030, 0x1a900009, 0x5a900012, 0x5a90001b, 0x5a900024, 0x5a90002d,
+    0x5a900036, 0x59b00020, 0x1aa00009, 0x5aa00012, 0x5aa0001b, 0x5aa00024, 0x5aa0002d, 0x5aa00036,
+    0x59d00012, 0x59d0001b, 0x59d00024, 0x59d0002d, 0x59d00036, 0x59d0003f, 0x5a700024, 0x5a70002d,
+    0x5a700036, 0x5a70003f, 0x5a700048, 0x5a700051, 0x59400010, 0x1ab00010, 0x5ab00020, 0x5ab00030,
+    0x5ab00040, 0x1ac00009, 0x5ac00012, 0x5ac0001b, 0x5ac00024, 0x5ac0002d, 0x1ad00008, 0x1ae00005,
+    0x1af00014, 0x1b000014, 0x9b000000, 0x9af00000, 0x1af00010, 0x9ae00000, 0x5ad00010, 0x1ae00010,
+    0x5ae00020, 0x5ae00030, 0x5ae00020, 0x5ae00010, 0x9ae00000, 0x1ae00010, 0x1b000009, 0x5b000012,
+    0x5b00001b, 0x5b000024, 0x5b00002d, 0x1b100008, 0x1b200010, 0x1b300009, 0x5b300012, 0x5b30001b,
+    0x5b300024, 0x5b30002d, 0x5b300036, 0x5b100010, 0x1b400005, 0x1b500014, 0x1b600014, 0x9b600000,
+    0x9b500000, 0x9b400000, 0x1b400010, 0x1b500009, 0x5b500012, 0x5b50001b, 0x5b500024, 0x5b50002d,
+    0x5b500036, 0x5b100018, 0x1b600005, 0x1b700014, 0x1b800014, 0x9b800000, 0x9b700000, 0x9b600000,
+    0x1b600010, 0x5b600020, 0x1b700009, 0x5b700012, 0x5b70001b, 0x5b700024, 0x5b70002d, 0x5b700036,
+    0x5b100020, 0x1b800005, 0x1b900014, 0x1ba00014, 0x9ba00000, 0x9b900000, 0x9b800000, 0x1b800010,
+    0x1b900009, 0x5b900012, 0x5b90001b, 0x5b900024, 0x5b90002d, 0x5b900036, 0x5ad00018, 0x1ba00010,
+    0x5ba00020, 0x5ba00030, 0x5ba00020, 0x5ba00010, 0x9ba00000, 0x1ba00010, 0x1bb00009, 0x5bb00012,
+    0x5bb0001b, 0x5bb00024, 0x5bb0002d, 0x1bc00008, 0x1bd00010, 0x1be00009, 0x5be00012, 0x5be0001b,
+    0x5be00024, 0x5be0002d, 0x5be00036, 0x5bc00010, 0x1bf00005, 0x1c000014, 0x1c100014, 0x9c100000,
+    0x9c000000, 0x9bf00000, 0x1bf00010, 0x1c000009, 0x5c000012, 0x5c00001b, 0x5c000024, 0x5c00002d,
+    0x5c000036, 0x5bc00018, 0x1c100005, 0x1c200014, 0x1c300014, 0x9c300000, 0x9c200000, 0x9c100000,
+    0x1c100010, 0x5c100020, 0x1c200009, 0x5c200012, 0x5c20001b, 0x5c200024, 0x5c20002d, 0x5c200036,
+    0x5bc00020, 0x1c300005, 0x1c400014, 0x1c500014, 0x9c500000, 0x9c400000, 0x9c300000, 0x1c300010,
+    0x1c400009, 0x5c400012, 0x5c40001b, 0x5c400024, 0x5c40002d, 0x5c400036, 0x5ad00020, 0x1c500010,
+    0x5c500020, 0x5c500030, 0x5c500020, 0x5c500010, 0x9c500000, 0x1c500010, 0x1c600009, 0x5c600012,
+    0x5c60001b, 0x5c600024, 0x5c60002d, 0x1c700008, 0x1c800010, 0x1c900009, 0x5c900012, 0x5c90001b,
+    0x5c900024, 0x5c90002d, 0x5c900036, 0x5c700010, 0x1ca00005, 0x1cb00014, 0x1cc00014, 0x9cc00000,
+    0x9cb00000, 0x9ca00000, 0x1ca00010, 0x1cb00009, 0x5cb00012, 0x5cb0001b, 0x5cb00024, 0x5cb0002d,
+    0x5cb00036, 0x5c700018, 0x1cc00005, 0x1cd00014, 0x1ce00014, 0x9ce00000, 0x9cd00000, 0x9cc00000,
+    0x1cc00010, 0x5cc00020, 0x1cd00009, 0x5cd00012, 0x5cd0001b, 0x5cd00024, 0x5cd0002d, 0x5cd00036,
+    0x5c700020, 0x1ce00005, 0x1cf00014, 0x1d000014, 0x9d000000, 0x9cf00000, 0x9ce00000, 0x1ce00010,
+    0x1cf00009, 0x5cf00012, 0x5cf0001b, 0x5cf00024, 0x5cf0002d, 0x5cf00036, 0x5ad00028, 0x1d000010,
+    0x5d000020, 0x5d000030, 0x5d000020, 0x5d000010, 0x9d000000, 0x1d000010, 0x1d100009, 0x5d100012,
+    0x5d10001b, 0x5d100024, 0x5d10002d, 0x1d200008, 0x1d300010, 0x1d400009, 0x5d400012, 0x5d40001b,
+    0x5d400024, 0x5d40002d, 0x5d400036, 0x5d200010, 0x1d500005, 0x1d600014, 0x1d700014, 0x9d700000,
+    0x9d600000, 0x9d500000, 0x1d500010, 0x1d600009, 0x5d600012, 0x5d60001b, 0x5d600024, 0x5d60002d,
+    0x5d600036, 0x5d200018, 0x1d700005, 0x1d800014, 0x1d900014, 0x9d900000, 0x9d800000, 0x9d700000,
+    0x1d700010, 0x5d700020, 0x1d800009, 0x5d800012, 0x5d80001b, 0x5d800024, 0x5d80002d, 0x5d800036,
+    0x5d200020, 0x1d900005, 0x1da00014, 0x1db00014, 0x9db00000, 0x9da00000, 0x9d900000, 0x1d900010,
+    0x1da00009, 0x5da00012, 0x5da0001b, 0x5da00024, 0x5da0002d, 0x5da00036, 0x5ad00030, 0x1db00010,
+    0x5db00020, 0x5db00030, 0x5db00020, 0x5db00010, 0x9db00000, 0x1db00010, 0x1dc00009, 0x5dc00012,
+    0x5dc0001b, 0x5dc00024, 0x5dc0002d, 0x1dd00008, 0x1de00010, 0x1df00009, 0x5df00012, 0x5df0001b,
+    0x5df00024, 0x5df0002d, 0x5df00036, 0x5dd00010, 0x1e000005, 0x1e100014, 0x1e200014, 0x9e200000,
+    0x9e100000, 0x9e000000, 0x1e000010, 0x1e100009, 0x5e100012, 0x5e10001b, 0x5e100024, 0x5e10002d,
+    0x5e100036, 0x5dd00018, 0x1e200005, 0x1e300014, 0x1e400014, 0x9e400000, 0x9e300000, 0x9e200000,
+    0x1e200010, 0x5e200020, 0x1e300009, 0x5e300012, 0x5e30001b, 0x5e300024, 0x5e30002d, 0x5e300036,
+    0x5dd00020, 0x1e400005, 0x1e500014, 0x1e600014, 0x9e600000, 0x9e500000, 0x9e400000, 0x1e400010,
+    0x1e500009, 0x5e500012, 0x5e50001b, 0x5e500024, 0x5e50002d, 0x5e500036, 0x59400018, 0x1e600010,
+    0x5e600020, 0x5e600030, 0x5e600040, 0x1e700009, 0x5e700012, 0x5e70001b, 0x5e700024, 0x5e70002d,
+    0x1e800008, 0x1e900005, 0x1ea00014, 0x1eb00014, 0x9eb00000, 0x9ea00000, 0x1ea00010, 0x9e900000,
+    0x5e800010, 0x1e900010, 0x5e900020, 0x5e900030, 0x5e900040, 0x5e900050, 0x5e900060, 0x5e900070,
+    0x5e900080, 0x5e900090, 0x5e9000a0, 0x5e800018, 0x1eb00010, 0x5eb00020, 0x5eb00030, 0x5eb00040,
+    0x5eb00050, 0x5eb00060, 0x5eb00070, 0x5eb00080, 0x5eb00090, 0x5eb000a0, 0x5e800020, 0x1ec00010,
+    0x5ec00020, 0x5ec00030, 0x5ec00040, 0x5ec00050, 0x5ec00060, 0x5ec00070, 0x5ec00080, 0x5ec00090,
+    0x5ec000a0, 0x5ec000b0, 0x1ed00018, 0x1ee00009, 0x1ef00030, 0x1f000098, 0x5e800028, 0x1f100010,
+    0x5f100020, 0x5f100030, 0x5f100040, 0x5f100050, 0x5f100060, 0x5f100070, 0x5f100080, 0x5f100090,
+    0x5f1000a0, 0x5f1000b0, 0x1f200018, 0x1f300009, 0x1f400030, 0x1f500098, 0x5f300012, 0x1f600030,
+    0x1f700098, 0x5e800030, 0x1f800010, 0x5f800020, 0x5f800030, 0x5f800040, 0x5f800050, 0x5f800060,
+    0x5f800070, 0x5f800080, 0x5f800090, 0x5f8000a0, 0x5f8000b0, 0x1f900018, 0x1fa00009, 0x1fb00030,
+    0x1fc00098, 0x5fa00012, 0x1fd00030, 0x1fe00098, 0x5fa0001b, 0x1ff00030, 0x20000098, 0x5e800038,
+    0x20100010, 0x60100020, 0x60100030, 0x60100040, 0x60100050, 0x60100060, 0x60100070, 0x60100080,
+    0x60100090, 0x601000a0, 0x44d00018, 0x20200010, 0x60200020, 0x60200030, 0x60200020, 0x60200010,
+    0xa0200000, 0x20200010, 0x20300009, 0x60300012, 0x6030001b, 0x60300024, 0x6030002d, 0x60300036,
+    0x6030003f, 0x60300048, 0x60300051, 0x6030005a, 0x60300063, 0x6030006c, 0x60300075, 0x6030007e,
+    0x20400008, 0x20500010, 0x60500020, 0x60500030, 0x60500040, 0x60500050, 0x60500060, 0x60500070,
+    0x60500080, 0x60500090, 0x605000a0, 0x20600009, 0x60600012, 0x6060001b, 0x60600024, 0x6060002d,
+    0x20700018, 0x20800008, 0x60400010, 0x20900010, 0x60900020, 0x60900030, 0x60900040, 0x60900050,
+    0x60900060, 0x60900070, 0x60900080, 0x60900090, 0x609000a0, 0x20a00009, 0x60a00012, 0x60a0001b,
+    0x60a00024, 0x60a0002d, 0x20b00018, 0x20c00008, 0x60400018, 0x20d00010, 0x60d00020, 0x60d00030,
+    0x60d00040, 0x60d00050, 0x60d00060, 0x60d00070, 0x60d00080, 0x60d00090, 0x60d000a0, 0x20e00009,
+    0x60e00012, 0x60e0001b, 0x60e00024, 0x60e0002d, 0x20f00018, 0x21000008, 0x60400020, 0x21100010,
+    0x61100020, 0x61100030, 0x61100040, 0x61100050, 0x61100060, 0x61100070, 0x61100080, 0x61100090,
+    0x611000a0, 0x21200009, 0x61200012, 0x6120001b, 0x61200024, 0x6120002d, 0x21300018, 0x21400008,
+    0x60400028, 0x21500010, 0x61500020, 0x61500030, 0x61500040, 0x61500050, 0x61500060, 0x61500070,
+    0x61500080, 0x61500090, 0x615000a0, 0x21600009, 0x61600012, 0x6160001b, 0x61600024, 0x6160002d,
+    0x21700018, 0x21800008, 0x60400030, 0x21900010, 0x61900020, 0x61900030, 0x61900040, 0x61900050,
+    0x61900060, 0x61900070, 0x61900080, 0x61900090, 0x619000a0, 0x21a00009, 0x61a00012, 0x61a0001b,
+    0x61a00024, 0x61a0002d, 0x21b00018, 0x21c00008, 0x60400038, 0x21d00010, 0x61d00020, 0x61d00030,
+    0x61d00040, 0x61d00050, 0x61d00060, 0x61d00070, 0x61d00080, 0x61d00090, 0x61d000a0, 0x21e00009,
+    0x61e00012, 0x61e0001b, 0x61e00024, 0x61e0002d, 0x21f00018, 0x22000008, 0x44d00020, 0x22100010,
+    0x62100020, 0x62100030, 0x62100040, 0x62100050, 0x62100060, 0x62100070, 0x62100080, 0x62100090,
+    0x621000a0, 0x22200009, 0x621000b0, 0x22300009, 0x62300012, 0x6230001b, 0x62300024, 0x6230002d,
+    0x22400018, 0x22500008, 0x62300036, 0x6230003f, 0x62300048, 0x62300051, 0x6230005a, 0x62300063,
+    0x6230006c, 0x22600014, 0x22700014, 0x22800008, 0x22900008, 0xa2800000, 0xa2600000, 0xa2900000,
+    0xa2700000, 0x22700008, 0x22900008, 0x22600010, 0x22800010, 0xa2600000, 0xa2700000, 0xa2800000,
+    0xa2900000, 0x22900008, 0x22800008, 0x22700010, 0x22600010, 0xa2700000, 0xa2900000, 0xa2600000,
+    0xa2800000, 0x22800008, 0x22600008, 0x22900010, 0x22700010, 0xa2900000, 0xa2800000, 0xa2700000,
+    0xa2600000, 0x22600008, 0x22700008, 0x22800010, 0x22900010, 0xa2800000, 0xa2600000, 0xa2900000,
+    0xa2700000, 0x22700008, 0x22900008, 0x22600010, 0x22800010, 0xa2600000, 0xa2700000, 0xa2800000,
+    0xa2900000, 0x22900020, 0x62900040, 0xa2900000, 0x22900020, 0xa2900000, 0x22900014, 0x22800014,
+    0x22700008, 0x22600008, 0xa2700000, 0xa2900000, 0xa2600000, 0xa2800000, 0x22800008, 0x22600008,
+    0x22900010, 0x22700010, 0xa2900000, 0xa2800000, 0xa2700000, 0xa2600000, 0x22600008, 0x22700008,
+    0x22800010, 0x22900010, 0xa2800000, 0xa2600000, 0xa2900000, 0xa2700000, 0x22700008, 0x22900008,
+    0x22600010, 0x22800010, 0xa2600000, 0xa2700000, 0xa2800000, 0xa2900000, 0x22900008, 0x22800008,
+    0x22700010, 0x22600010, 0xa2700000, 0xa2900000, 0xa2600000, 0xa2800000, 0x22800008, 0x22600008,
+    0x22900010, 0x22700010, 0xa2900000, 0xa2800000, 0xa2700000, 0xa2600000, 0x22600020, 0x62600040,
+    0xa2600000, 0x22600008, 0x22700008, 0x22800010, 0x22900010, 0xa2800000, 0xa2600000, 0xa2900000,
+    0xa2700000, 0x22700008, 0x22900008, 0x22600010, 0x22800010, 0xa2600000, 0xa2700000, 0xa2800000,
+    0xa2900000, 0x22900008, 0x22800008, 0x22700010, 0x22600010, 0xa2700000, 0xa2900000, 0xa2600000,
+    0xa2800000, 0x22800008, 0x22600008, 0x22900010, 0x22700010, 0xa2900000, 0xa2800000, 0xa2700000,
+    0xa2600000, 0x22600008, 0x22700008, 0x22800010, 0x22900010, 0xa2800000, 0xa2600000, 0xa2900000,
+    0xa2700000, 0x22700008, 0x22900b53, 0xa2700000, 0xa2900000, 0x2290000a, 0x22700b53, 0xa2900000,
+    0xa2700000, 0x22700005, 0x22900b53, 0xa2700000, 0xa2900000, 0x2290000c, 0x22700b53, 0xa2900000,
+    0xa2700000, 0x2270000d, 0x22900b53, 0xa2700000, 0xa2900000, 0x22900004, 0x22700012, 0xa2900000,
+    0x229002f6, 0x22600042, 0xa2900000, 0x2290000c, 0x22800b53, 0xa2900000, 0xa2800000, 0x2280003e,
+    0x22900b53, 0xa2800000, 0xa2900000, 0x22900004, 0x22800b53, 0xa2900000, 0xa2800000, 0x22800010,
+    0x22900b53, 0xa2800000, 0xa2900000, 0x229001c2, 0x22800054, 0x22a0000f, 0xa2a00000, 0x22a0007a,
+    0xa2900000, 0xa2a00000, 0x22a00004, 0x22900b53, 0xa2a00000, 0xa2900000, 0x22900011, 0x22a00b53,
+    0xa2900000, 0xa2a00000, 0x22a00076, 0xa2a00000, 0x22a00008, 0x22900b53, 0xa2a00000, 0xa2900000,
+    0x229001c2, 0x22a0000f, 0xa2a00000, 0x22a0007a, 0xa2900000, 0xa2a00000, 0x22a00076, 0xa2a00000,
+    0x22a00007, 0x22900b53, 0xa2a00000, 0xa2900000, 0x229002f8, 0x22a00036, 0xa2900000, 0x22900170,
+    0xa2900000, 0x2290000d, 0x22b00b53, 0xa2900000, 0xa2b00000, 0x22b0000a, 0x22900b53, 0xa2b00000,
+    0xa2900000, 0x22900009, 0x22b00b53, 0xa2900000, 0xa2b00000, 0x22b0009c, 0xa2b00000, 0x22b0000a,
+    0x22900b53, 0xa2b00000, 0xa2900000, 0x2290009e, 0xa2900000, 0x2290009b, 0xa2900000, 0x2290000e,
+    0x22b00b53, 0xa2900000, 0xa2b00000, 0x22b0009d, 0xa2b00000, 0x22b00170, 0xa2b00000, 0x22b00007,
+    0x22900b53, 0xa2b00000, 0xa2900000, 0x22900009, 0x22b00b53, 0xa2900000, 0xa2b00000, 0x22b00172,
+    0xa2b00000, 0x22b0000c, 0x22900b53, 0xa2b00000, 0xa2900000, 0x2290000b, 0x22b00b53, 0xa2900000,
+    0xa2b00000, 0x22b00135, 0xa2700000, 0x2270002a, 0xa2b00000, 0x22b00017, 0xa2700000, 0x22700048,
+    0xa2b00000, 0x22b0000c, 0x22900b53, 0xa2b00000, 0xa2900000, 0x2290000d, 0x22b00b53, 0xa2900000,
+    0xa2b00000, 0x22b00172, 0xa2b00000, 0x22b00031, 0xa2700000, 0x22700096, 0xa2b00000, 0x22b00029,
+    0xa2700000, 0x2270007e, 0xa2b00000, 0x22b00004, 0x22900b53, 0xa2b00000, 0xa2900000, 0xa2700000,
+    0xa2600000, 0xa2800000, 0xa2a00000, 0x22a0009d, 0x22800042, 0xa2a00000, 0x22a0009b, 0xa2a00000,
+    0x22a0000e, 0x22600b53, 0xa2a00000, 0xa2600000, 0x2260009d, 0x22a00036, 0xa2600000, 0x2260009d,
+    0xa2600000, 0x2260009e, 0xa2600000, 0x2260009c, 0xa2600000, 0x2260000a, 0x22700b53, 0xa2600000,
+    0xa2700000, 0x2270009e, 0xa2700000, 0x2270009e, 0xa2700000, 0xa2800000, 0xa2a00000, 0x96900000,
+    0x1690000e, 0x22a0000f, 0x22800038, 0x22700038, 0xa2700000, 0xa2800000, 0x96900000, 0xa2a00000,
+    0x22a0000e, 0x1690000f, 0x22800038, 0x22700038, 0xa2700000, 0xa2800000, 0xa2a00000, 0x96900000,
+    0x1690000e, 0x22a0000f, 0x22800038, 0x22700038, 0xa2700000, 0xa2800000, 0x96900000, 0x1690009d,
+    0x22800042, 0x96900000, 0x1690009b, 0x96900000, 0x1690000e, 0x22700b53, 0x96900000, 0xa2700000,
+    0x2270009d, 0x16900036, 0xa2700000, 0x2270009d, 0xa2700000, 0x2270009e, 0xa2700000, 0x2270009c,
+    0xa2700000, 0x2270000a, 0x22600b53, 0xa2700000, 0xa2600000, 0x2260009e, 0xa2600000, 0x2260009e,
+    0xa2600000, 0xa2800000, 0x96900000, 0x99000000, 0x19000003, 0x16900004, 0x2280000c, 0x2260000c,
+    0xa2600000, 0xa2800000, 0x99000000, 0xa2a00000, 0x22a0000e, 0x1900000f, 0x22800038, 0x22600038,
+    0xa2600000, 0xa2800000, 0xa2a00000, 0x99000000, 0x1900000e, 0x22a0000f, 0x22800038, 0x22600038,
+    0xa2600000, 0xa2800000, 0x99000000, 0x92600000, 0x92500000, 0x92400000, 0x4c1000a0, 0x92700000,
+    0x92100000, 0x92000000, 0x91f00000, 0x4ae000a0, 0x92200000, 0x91c00000, 0x91b00000, 0x91a00000,
+    0x4a1000a0, 0x91d00000, 0x11d0000e, 0x11a0000f, 0x11b00038, 0x11c00038, 0x91c00000, 0x91b00000,
+    0x91d00000, 0x11d0000d, 0x11b0000e, 0x11c00034, 0x12200034, 0x92200000, 0x91c00000, 0x91d00000,
+    0x11d0000d, 0x11c0000e, 0x12200034, 0x11f00034, 0x91f00000, 0x92200000, 0x91d00000, 0x11d0009d,
+    0x12200042, 0x91d00000, 0x11d0009b, 0x91d00000, 0x11d0000e, 0x11f00b53, 0x91d00000, 0x91f00000,
+    0x11f0009d, 0x11d00036, 0x91f00000, 0x11f0009d, 0x91f00000, 0x11f0009e, 0x91f00000, 0x11f0009c,
+    0x91f00000, 0x11f0000a, 0x12000b53, 0x91f00000, 0x92000000, 0x1200009e, 0x92000000, 0x1200009e,
+    0x92000000, 0x1200007e, 0x92000000, 0x120001c2, 0x11f00054, 0x1210000f, 0x92100000, 0x1210007a,
+    0x92000000, 0x92100000, 0x12100076, 0x92100000, 0x12100007, 0x12000b53, 0x92100000, 0x92000000,
+    0x1200007e, 0x92000000, 0x92200000, 0x91d00000, 0x91f00000, 0xa2a00000, 0x22a0000e, 0x11f0000f,
+    0x11d00038, 0x12200038, 0x92200000, 0x91d00000, 0xa2a00000, 0x91f00000, 0x11f0000e, 0x22a0000f,
+    0x11d00038, 0x12200038, 0x92200000, 0x91d00000, 0x91f00000, 0xa2a00000, 0x22a0000e, 0x11f0000f,
+    0x11d00038, 0x12200038, 0x92200000, 0x91d00000, 0xa2a00000, 0x22a0007e, 0x11d00042, 0xa2a00000,
+    0x22a001c2, 0x12200054, 0x1200000f, 0x92000000, 0x1200007a, 0xa2a00000, 0x92000000, 0x12000076,
+    0x92000000, 0x12000007, 0x22a00b53, 0x92000000, 0xa2a00000, 0x22a0007e, 0x12000036, 0xa2a00000,
+    0x91d00000, 0x92200000, 0x92000000, 0x9ff00000, 0x1ff00012, 0x9fa00000, 0xa0000000, 0x9fd00000,
+    0x1fd00009, 0x9ff00000, 0x9fe00000, 0x9fb00000, 0x9fd00000, 0x9f900000, 0x5f8000a0, 0x9fc00000,
+    0x9f600000, 0x1f600009, 0x9f300000, 0x9f700000, 0x9f400000, 0x9f600000, 0x9f200000, 0x5f1000a0,
+    0x9f500000, 0x9ef00000, 0x9ee00000, 0x9ed00000, 0x5ec000a0, 0x9f000000, 0x96900000, 0x16900003,
+    0x1f000004, 0x1ed0000c, 0x1ee0000c, 0x9ee00000, 0x9ed00000, 0x96900000, 0x91f00000, 0x11f0000e,
+    0x1690000f, 0x1ed00038, 0x1ee00038, 0x9ee00000, 0x9ed00000, 0x91f00000, 0x96900000, 0x1690000e,
+    0x11f0000f, 0x1ed00038, 0x1ee00038, 0x9ee00000, 0x9ed00000, 0x96900000, 0x91f00000, 0x11f0000e,
+    0x1690000f, 0x1ed00038, 0x1ee00038, 0x9ee00000, 0x9ed00000, 0x91f00000, 0x89000000, 0x09000009,
+    0x88d00000, 0x89100000, 0x88e00000, 0x89000000, 0x88c00000, 0x48b000a0, 0x88f00000, 0x08f0007e,
+    0x08c00042, 0x88f00000, 0x08f001c2, 0x09000054, 0x08e0000f, 0x88e00000, 0x08e0007a, 0x88f00000,
+    0x88e00000, 0x08e00076, 0x88e00000, 0x08e00007, 0x08f00b53, 0x88e00000, 0x88f00000, 0x08f0007e,
+    0x08e00036, 0x88f00000, 0x88c00000, 0x89000000, 0x88e00000, 0x96900000, 0x1690000e, 0x08e0000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x96900000, 0x88e00000, 0x08e0000e, 0x1690000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x88e00000, 0x96900000, 0x1690000e, 0x08e0000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x96900000, 0x88e00000, 0x08e0000e, 0x1690000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x88e00000, 0x96900000, 0x1690000e, 0x08e0000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x96900000, 0x91a00000, 0x11a0000e, 0x1690000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x91a00000, 0x91b00000, 0x11b0000d, 0x11a0000e,
+    0x09000034, 0x08c00034, 0x88c00000, 0x89000000, 0x91b00000, 0x91c00000, 0x11c0000d, 0x11b0000e,
+    0x09000034, 0x08c00034, 0x88c00000, 0x89000000, 0x91c00000, 0x9f000000, 0x1f000003, 0x11c00004,
+    0x0900000c, 0x08c0000c, 0x88c00000, 0x89000000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f,
+    0x09000038, 0x08c00038, 0x88c00000, 0x89000000, 0x88e00000, 0x08e0001d, 0x0900001e, 0x08c00074,
+    0x08f00074, 0x88f00000, 0x88c00000, 0x88e00000, 0x08e00021, 0x08c00022, 0x08f00084, 0x09100084,
+    0x89100000, 0x88f00000, 0x88e00000, 0x91c00000, 0x11c00003, 0x08e00004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x96900000, 0x1690000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x96900000, 0x91a00000, 0x11a0000d, 0x1690000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x91a00000, 0x91b00000, 0x11b0000d, 0x11a0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x91b00000, 0x9f000000, 0x1f00000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x88e00000, 0x08e00003, 0x11b00004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b00003, 0x1f000004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x91b00000, 0x88e00000, 0x08e0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x91b00000, 0x11b0000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x88e00000, 0x08e0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x91c00000, 0x11c0000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x96900000, 0x1690000d, 0x11c0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x96900000, 0x91a00000, 0x11a0000d, 0x1690000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x91a00000, 0x91b00000, 0x11b0000e, 0x11a0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x91a00000, 0x11a0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91a00000, 0x91b00000, 0x11b0000e, 0x11a0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x91a00000, 0x11a0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91a00000, 0x91b00000, 0x11b0000e, 0x11a0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x9f000000, 0x1f000003, 0x11b00004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91a00000, 0x11a0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91a00000, 0x9f000000, 0x1f00000e, 0x11a0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91a00000, 0x11a0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91a00000, 0x9f000000, 0x1f00000e, 0x11a0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91a00000, 0x11a0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91a00000, 0x88e00000, 0x08e0000e, 0x11a0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x91c00000, 0x11c0000d, 0x08e0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x91c00000, 0x96900000, 0x1690000d, 0x11c0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x96900000, 0x89000000, 0x0900001e, 0x1690001f, 0x08f00078, 0x09100078,
+    0x89100000, 0x88f00000, 0x89000000, 0x88c00000, 0x08c00021, 0x09000022, 0x08f00084, 0x09100084,
+    0x89100000, 0x88f00000, 0x88c00000, 0x91b00000, 0x11b00003, 0x08c00004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x91b00000, 0x9f000000, 0x1f00000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x9f000000, 0x1f00000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x9f000000, 0x1f00000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x9f000000, 0x1f00000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x88c00000, 0x08c00003, 0x11b00004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x88c00000, 0x9f000000, 0x1f00000e, 0x08c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x88c00000, 0x08c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88c00000, 0x91a00000, 0x11a0000e, 0x08c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91a00000, 0x88e00000, 0x08e0000d, 0x11a0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x88e00000, 0x91c00000, 0x11c0000d, 0x08e0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91b00000, 0x11b00003, 0x1f000004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x91b00000, 0x91c00000, 0x11c0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x91b00000, 0x11b0000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x91c00000, 0x11c0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x91b00000, 0x11b0000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x91c00000, 0x11c0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x91b00000, 0x11b0000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x91c00000, 0x11c0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x91b00000, 0x11b0000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91b00000, 0x88c00000, 0x08c0000e, 0x11b0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88c00000, 0x91a00000, 0x11a0000d, 0x08c0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x91a00000, 0x88e00000, 0x08e0000d, 0x11a0000e, 0x08f00034, 0x09100034,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f000003, 0x08e00004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x9f000000, 0x1f00000e, 0x11c0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x91c00000, 0x11c0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x91c00000, 0x96900000, 0x1690001e, 0x11c0001f, 0x08f00078, 0x09100078,
+    0x89100000, 0x88f00000, 0x96900000, 0x89000000, 0x09000021, 0x16900022, 0x08f00084, 0x09100084,
+    0x89100000, 0x88f00000, 0x89000000, 0x88e00000, 0x08e00003, 0x09000004, 0x08f0000c, 0x0910000c,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x88e00000, 0x08e0000e, 0x1f00000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x88e00000, 0x9f000000, 0x1f00000e, 0x08e0000f, 0x08f00038, 0x09100038,
+    0x89100000, 0x88f00000, 0x9f000000, 0x1f000010, 0x5f000020, 0x5f000030, 0x5f000040, 0x08f00009,
+    0x48f00012, 0x84700000, 0x84600000, 0x84800000, 0x84900000, 0x85500000, 0x85600000, 0x85d00000,
+    0x85e00000, 0x86000000, 0x86200000, 0x86100000, 0x85f00000, 0x85c00000, 0x45b00060, 0x45b00050,
+    0x45b00040, 0x45b00030, 0x45b00020, 0x45b00010, 0x85b00000, 0x45a00028, 0x86700000, 0x86800000,
+    0x86a00000, 0x86c00000, 0x86b00000, 0x86900000, 0x86600000, 0x46500060, 0x46500050, 0x46500040,
+    0x46500030, 0x46500020, 0x46500010, 0x86500000, 0x45a00020, 0x87100000, 0x87200000, 0x87400000,
+    0x87600000, 0x87500000, 0x87300000, 0x87000000, 0x46f00060, 0x46f00050, 0x46f00040, 0x46f00030,
+    0x46f00020, 0x46f00010, 0x86f00000, 0x45a00018, 0x87800000, 0x87700000, 0x45a00010, 0x87b00000,
+    0x87900000, 0x47a00010, 0x87a00000, 0x45a00008, 0x87d00000, 0x47c00010, 0x87c00000, 0x85a00000,
+    0x85400000, 0x44e00030, 0x44e00020, 0x44e00010, 0x84e00000, 0x44d00018, 0x85100000, 0x85300000,
+    0x85200000, 0x8d900000, 0x8d800000, 0x48100040, 0x8da00000, 0x48300010, 0x88300000, 0x48100038,
+    0x8db00000, 0x48400010, 0x88400000, 0x48100030, 0x8dc00000, 0x48500010, 0x88500000, 0x48100028,
+    0x8de00000, 0x8dd00000, 0x48100020, 0x8df00000, 0x48600010, 0x88600000, 0x48100018, 0x8e100000,
+    0x8e000000, 0x48100010, 0x88a00000, 0x88900000, 0x88800000, 0x88700000, 0x48200090, 0x48200080,
+    0x48200070, 0x48200060, 0x48200050, 0x48200040, 0x48200030, 0x48200020, 0x48200010, 0x88200000,
+    0x48100008, 0x89500000, 0x89400000, 0x89300000, 0x89200000, 0x48b00090, 0x48b00080, 0x48b00070,
+    0x48b00060, 0x48b00050, 0x48b00040, 0x48b00030, 0x48b00020, 0x48b00010, 0x88b00000, 0x88100000,
+    0x88000000, 0x47f00030, 0x47f00020, 0x47f00010, 0x87f00000, 0x47e00010, 0x8e200000, 0x4a000010,
+    0x8a000000, 0x49e00040, 0x8e300000, 0x49f00010, 0x89f00000, 0x49e00038, 0x8ab00000, 0x8ac00000,
+    0x8a600000, 0x8a800000, 0x8a700000, 0x8a400000, 0x8a500000, 0x4a300010, 0x8a300000, 0x8a200000,
+    0x8aa00000, 0x8a900000, 0x4a100090, 0x4a100080, 0x4a100070, 0x4a100060, 0x4a100050, 0x4a100040,
+    0x4a100030, 0x4a100020, 0x4a100010, 0x8a100000, 0x49e00030, 0x8e400000, 0x4ad00010, 0x8ad00000,
+    0x49e00028, 0x8b900000, 0x8ba00000, 0x8b300000, 0x8b500000, 0x8b400000, 0x8b100000, 0x8b200000,
+    0x4b000010, 0x8b000000, 0x8af00000, 0x8b700000, 0x8b800000, 0x8b600000, 0x4ae00090, 0x4ae00080,
+    0x4ae00070, 0x4ae00060, 0x4ae00050, 0x4ae00040, 0x4ae00030, 0x4ae00020, 0x4ae00010, 0x8ae00000,
+    0x49e00020, 0x8e700000, 0x4bb00010, 0x8bb00000, 0x49e00018, 0x8bf00000, 0x8be00000, 0x4bd00080,
+    0x4bd00070, 0x4bd00060, 0x4bd00050, 0x4bd00040, 0x4bd00030, 0x4bd00020, 0x4bd00010, 0x8bd00000,
+    0x44a00010, 0x8e600000, 0x4bc00090, 0x4bc00080, 0x4bc00070, 0x4bc00060, 0x4bc00050, 0x4bc00040,
+    0x4bc00030, 0x4bc00020, 0x4bc00010, 0x8bc00000, 0x49e00010, 0x8e500000, 0x4c000010, 0x8c000000,
+    0x49e00008, 0x8ca00000, 0x8cb00000, 0x8c600000, 0x8c800000, 0x8c700000, 0x8c400000, 0x8c500000,
+    0x4c300010, 0x8c300000, 0x8c200000, 0x8c900000, 0x4c100090, 0x4c100080, 0x4c100070, 0x4c100060,
+    0x4c100050, 0x4c100040, 0x4c100030, 0x4c100020, 0x4c100010, 0x8c100000, 0x89e00000, 0x89d00000,
+    0x49c00030, 0x49c00020, 0x49c00010, 0x89c00000, 0x47e00008, 0x8e900000, 0x4cf00010, 0x8cf00000,
+    0x4cd00030, 0x8ea00000, 0x4ce00010, 0x8ce00000, 0x4cd00028, 0x8d200000, 0x8d300000, 0x8d100000,
+    0x4d0000a0, 0x4d000090, 0x4d000080, 0x4d000070, 0x4d000060, 0x4d000050, 0x4d000040, 0x4d000030,
+    0x4d000020, 0x4d000010, 0x8d000000, 0x4cd00020, 0x8ee00000, 0x4d400010, 0x8d400000, 0x4cd00018,
+    0x8ed00000, 0x4d5000c0, 0x4d5000b0, 0x4d5000a0, 0x4d500090, 0x4d500080, 0x4d500070, 0x4d500060,
+    0x4d500050, 0x4d500040, 0x4d500030, 0x4d500020, 0x4d500010, 0x8d500000, 0x4cd00010, 0x8ec00000,
+    0x4d600010, 0x8d600000, 0x4cd00008, 0x8eb00000, 0x4d7000c0, 0x4d7000b0, 0x4d7000a0, 0x4d700090,
+    0x4d700080, 0x4d700070, 0x4d700060, 0x4d700050, 0x4d700040, 0x4d700030, 0x4d700020, 0x4d700010,
+    0x8d700000, 0x8cd00000, 0x8e800000, 0x4cc00030, 0x4cc00020, 0x4cc00010, 0x8cc00000, 0x87e00000,
+    0x85900000, 0x45800040, 0x45800030, 0x45800020, 0x45800010, 0x85800000, 0x45700010, 0x8f300000,
+    0x4f400010, 0x8f400000, 0x4f200010, 0x8f600000, 0x4f500030, 0x4f500020, 0x4f500010, 0x8f500000,
+    0x4f200008, 0x8fc00000, 0x8fd00000, 0x90100000, 0x90000000, 0x8fb00000, 0x4fa00080, 0x4fa00070,
+    0x4fa00060, 0x4fa00050, 0x4fa00040, 0x4fa00030, 0x4fa00020, 0x4fa00010, 0x8fa00000, 0x4f900008,
+    0x8ff00000, 0x4fe00030, 0x4fe00020, 0x4fe00010, 0x8fe00000, 0x8f900000, 0x8f800000, 0x4f700020,
+    0x4f700010, 0x8f700000, 0x8f200000, 0x8f100000, 0x4f000030, 0x4f000020, 0x4f000010, 0x8f000000,
+    0x4ef00020, 0x90500000, 0x50600010, 0x90600000, 0x50400010, 0x90800000, 0x50700030, 0x50700020,
+    0x50700010, 0x90700000, 0x50400008, 0x90e00000, 0x90f00000, 0x91300000, 0x91200000, 0x91500000,
+    0x91400000, 0x90d00000, 0x50c00080, 0x50c00070, 0x50c00060, 0x50c00050, 0x50c00040, 0x50c00030,
+    0x50c00020, 0x50c00010, 0x90c00000, 0x50b00008, 0x91100000, 0x51000030, 0x51000020, 0x51000010,
+    0x91000000, 0x90b00000, 0x90a00000, 0x50900020, 0x50900010, 0x90900000, 0x90400000, 0x90300000,
+    0x50200030, 0x50200020, 0x50200010, 0x90200000, 0x4ef00018, 0x92e00000, 0x52800010, 0x92800000,
+    0x51800038, 0x95c00000, 0x55f00030, 0x95e00000, 0x55f00020, 0x55f00010, 0x95f00000, 0x95b00000,
+    0x55d00010, 0x96200000, 0x56000040, 0x96300000, 0x56000030, 0x56000020, 0x56000010, 0x96000000,
+    0x96400000, 0x55d00008, 0x96600000, 0x56100040, 0x96700000, 0x56100030, 0x56100020, 0x56100010,
+    0x96100000, 0x96800000, 0x95d00000, 0x92300000, 0x51900030, 0x51900020, 0x51900010, 0x91900000,
+    0x51800030, 0x92900000, 0x51e00030, 0x51e00020, 0x51e00010, 0x91e00000, 0x51800028, 0x88e00000,
+    0x93000000, 0x92f00000, 0x51800020, 0x92b00000, 0x52a00030, 0x52a00020, 0x52a00010, 0x92a00000,
+    0x51800018, 0x93200000, 0x93100000, 0x51800010, 0x92d00000, 0x52c00030, 0x52c00020, 0x52c00010,
+    0x92c00000, 0x51800008, 0x93400000, 0x93300000, 0x91800000, 0x91700000, 0x51600030, 0x51600020,
+    0x51600010, 0x91600000, 0x4ef00010, 0x94100000, 0x53900010, 0x93900000, 0x53700038, 0x97700000,
+    0x97800000, 0x97900000, 0x96c00000, 0x56b00060, 0x96d00000, 0x56b00050, 0x96e00000, 0x56b00040,
+    0x56b00030, 0x56b00020, 0x56b00010, 0x96b00000, 0x56a00010, 0x97000000, 0x56f00060, 0x97100000,
+    0x56f00050, 0x97200000, 0x56f00040, 0x56f00030, 0x56f00020, 0x56f00010, 0x96f00000, 0x56a00008,
+    0x97400000, 0x57300060, 0x97500000, 0x57300050, 0x97600000, 0x57300040, 0x57300030, 0x57300020,
+    0x57300010, 0x97300000, 0x96a00000, 0x93a00000, 0x53800040, 0x96500000, 0x53800030, 0x53800020,
+    0x53800010, 0x93800000, 0x53700030, 0x93c00000, 0x53b00030, 0x53b00020, 0x53b00010, 0x93b00000,
+    0x53700028, 0x91b00000, 0x94300000, 0x94200000, 0x53700020, 0x93e00000, 0x53d00030, 0x53d00020,
+    0x53d00010, 0x93d00000, 0x53700018, 0x88c00000, 0x94500000, 0x94400000, 0x53700010, 0x94000000,
+    0x53f00030, 0x53f00020, 0x53f00010, 0x93f00000, 0x53700008, 0x91a00000, 0x94700000, 0x94600000,
+    0x93700000, 0x93600000, 0x53500030, 0x53500020, 0x53500010, 0x93500000, 0x4ef00008, 0x95400000,
+    0x54c00010, 0x94c00000, 0x54a00038, 0x97c00000, 0x97d00000, 0x97e00000, 0x97f00000, 0x98000000,
+    0x98100000, 0x98200000, 0x98300000, 0x98400000, 0x98500000, 0x99300000, 0x98600000, 0x98c00000,
+    0x98d00000, 0x58900010, 0x89000000, 0x98f00000, 0x58a00010, 0x98a00000, 0x58900008, 0x98b00000,
+    0x99200000, 0x99100000, 0x98900000, 0x98800000, 0x98700000, 0x94d00000, 0x54b00050, 0x97a00000,
+    0x54b00040, 0x97b00000, 0x54b00030, 0x54b00020, 0x54b00010, 0x94b00000, 0x98e00000, 0x54a00030,
+    0x94f00000, 0x54e00030, 0x54e00020, 0x54e00010, 0x94e00000, 0x54a00028, 0x95600000, 0x95500000,
+    0x54a00020, 0x95100000, 0x55000030, 0x55000020, 0x55000010, 0x95000000, 0x54a00018, 0x95800000,
+    0x95700000, 0x54a00010, 0x95300000, 0x55200030, 0x55200020, 0x55200010, 0x95200000, 0x54a00008,
+    0x95a00000, 0x95900000, 0x94a00000, 0x94900000, 0x54800030, 0x54800020, 0x54800010, 0x94800000,
+    0x8ef00000, 0x86400000, 0x46300040, 0x46300030, 0x46300020, 0x46300010, 0x86300000, 0x45700008,
+    0x9a800000, 0x59900010, 0x99900000, 0x59700020, 0x9a900000, 0x59a00020, 0x59a00010, 0x99a00000,
+    0x59700018, 0x9aa00000, 0x59b00010, 0x99b00000, 0x59700010, 0x99800000, 0x99d00000, 0x99c00000,
+    0x59700008, 0x99f00000, 0x9a000000, 0x9a200000, 0x9a100000, 0x9a400000, 0x9a300000, 0x9a600000,
+    0x9a500000, 0x9a700000, 0x59e00080, 0x59e00070, 0x59e00060, 0x59e00050, 0x59e00040, 0x59e00030,
+    0x59e00020, 0x59e00010, 0x99e00000, 0x99700000, 0x99600000, 0x59500030, 0x59500020, 0x59500010,
+    0x99500000, 0x59400010, 0x9af00000, 0x5ad00028, 0x9b300000, 0x9b200000, 0x5b100018, 0x9b500000,
+    0x9b400000, 0x5b100010, 0x9b700000, 0x5b600010, 0x9b600000, 0x5b100008, 0x9b900000, 0x9b800000,
+    0x9b100000, 0x9b000000, 0x9ae00000, 0x5ad00020, 0x9be00000, 0x9bd00000, 0x5bc00018, 0x9c000000,
+    0x9bf00000, 0x5bc00010, 0x9c200000, 0x5c100010, 0x9c100000, 0x5bc00008, 0x9c400000, 0x9c300000,
+    0x9bc00000, 0x9bb00000, 0x9ba00000, 0x5ad00018, 0x9c900000, 0x9c800000, 0x5c700018, 0x9cb00000,
+    0x9ca00000, 0x5c700010, 0x9cd00000, 0x5cc00010, 0x9cc00000, 0x5c700008, 0x9cf00000, 0x9ce00000,
+    0x9c700000, 0x9c600000, 0x9c500000, 0x5ad00010, 0x9d400000, 0x9d300000, 0x5d200018, 0x9d600000,
+    0x9d500000, 0x5d200010, 0x9d800000, 0x5d700010, 0x9d700000, 0x5d200008, 0x9da00000, 0x9d900000,
+    0x9d200000, 0x9d100000, 0x9d000000, 0x5ad00008, 0x9df00000, 0x9de00000, 0x5dd00018, 0x9e100000,
+    0x9e000000, 0x5dd00010, 0x9e300000, 0x5e200010, 0x9e200000, 0x5dd00008, 0x9e500000, 0x9e400000,
+    0x9dd00000, 0x9dc00000, 0x9db00000, 0x9ad00000, 0x9ac00000, 0x5ab00030, 0x5ab00020, 0x5ab00010,
+    0x9ab00000, 0x59400008, 0x9ea00000, 0x5e800030, 0x5e900090, 0x5e900080, 0x5e900070, 0x5e900060,
+    0x5e900050, 0x5e900040, 0x5e900030, 0x5e900020, 0x5e900010, 0x9e900000, 0x5e800028, 0x5eb00090,
+    0x5eb00080, 0x5eb00070, 0x5eb00060, 0x5eb00050, 0x5eb00040, 0x5eb00030, 0x5eb00020, 0x5eb00010,
+    0x9eb00000, 0x5e800020, 0x5ec00090, 0x5ec00080, 0x5ec00070, 0x5ec00060, 0x5ec00050, 0x5ec00040,
+    0x5ec00030, 0x5ec00020, 0x5ec00010, 0x9ec00000, 0x5e800018, 0x5f100090, 0x5f100080, 0x5f100070,
+    0x5f100060, 0x5f100050, 0x5f100040, 0x5f100030, 0x5f100020, 0x5f100010, 0x9f100000, 0x5e800010,
+    0x5f800090, 0x5f800080, 0x5f800070, 0x5f800060, 0x5f800050, 0x5f800040, 0x5f800030, 0x5f800020,
+    0x5f800010, 0x9f800000, 0x5e800008, 0x60100090, 0x60100080, 0x60100070, 0x60100060, 0x60100050,
+    0x60100040, 0x60100030, 0x60100020, 0x60100010, 0xa0100000, 0x9e800000, 0x9e700000, 0x5e600030,
+    0x5e600020, 0x5e600010, 0x9e600000, 0x99400000, 0x86e00000, 0x46d00040, 0x46d00030, 0x46d00020,
+    0x46d00010, 0x86d00000, 0x85700000, 0x85000000, 0x84f00000, 0x44d00010, 0xa0700000, 0xa0800000,
+    0xa0600000, 0x60500090, 0x60500080, 0x60500070, 0x60500060, 0x60500050, 0x60500040, 0x60500030,
+    0x60500020, 0x60500010, 0xa0500000, 0x60400030, 0xa0b00000, 0xa0c00000, 0xa0a00000, 0x60900090,
+    0x60900080, 0x60900070, 0x60900060, 0x60900050, 0x60900040, 0x60900030, 0x60900020, 0x60900010,
+    0xa0900000, 0x60400028, 0xa0f00000, 0xa1000000, 0xa0e00000, 0x60d00090, 0x60d00080, 0x60d00070,
+    0x60d00060, 0x60d00050, 0x60d00040, 0x60d00030, 0x60d00020, 0x60d00010, 0xa0d00000, 0x60400020,
+    0xa1300000, 0xa1400000, 0xa1200000, 0x61100090, 0x61100080, 0x61100070, 0x61100060, 0x61100050,
+    0x61100040, 0x61100030, 0x61100020, 0x61100010, 0xa1100000, 0x60400018, 0xa1700000, 0xa1800000,
+    0xa1600000, 0x61500090, 0x61500080, 0x61500070, 0x61500060, 0x61500050, 0x61500040, 0x61500030,
+    0x61500020, 0x61500010, 0xa1500000, 0x60400010, 0xa1b00000, 0xa1c00000, 0xa1a00000, 0x61900090,
+    0x61900080, 0x61900070, 0x61900060, 0x61900050, 0x61900040, 0x61900030, 0x61900020, 0x61900010,
+    0xa1900000, 0x60400008, 0xa1f00000, 0xa2000000, 0xa1e00000, 0x61d00090, 0x61d00080, 0x61d00070,
+    0x61d00060, 0x61d00050, 0x61d00040, 0x61d00030, 0x61d00020, 0x61d00010, 0xa1d00000, 0xa0400000,
+    0xa0300000, 0xa0200000, 0x44d00008, 0xa2400000, 0xa2500000, 0xa2200000, 0x621000a0, 0xa2300000,
+    0x62100090, 0x62100080, 0x62100070, 0x62100060, 0x62100050, 0x62100040, 0x62100030, 0x62100020,
+    0x62100010, 0xa2100000, 0x84d00000, 0x84c00000, 0x44b00020, 0x44b00010, 0x84b00000, 0x44a00008,
+    0x89a00000, 0x89b00000, 0x89800000, 0x89700000, 0x89900000, 0x496000c0, 0x496000b0, 0x496000a0,
+    0x49600090, 0x49600080, 0x49600070, 0x49600060, 0x49600050, 0x49600040, 0x49600030, 0x49600020,
+    0x49600010, 0x89600000, 0x84a00000, 0x80100000, 0x40000030, 0x40000020, 0x40000010, 0x80000000,
+    0x48f0001b, 0x00000009, 0x40000012, 0x4000001b, 0x40000024, 0x4000002d, 0x00100009, 0x40100012,
+    0x4010001b, 0x40100024, 0x4010002d, 0x40100036, 0x04a00009, 0x44a00012, 0x09600009, 0x49600012,
+    0x09900009, 0x49900012, 0x09700009, 0x49700012, 0x09800009, 0x49800012, 0x09b00009, 0x49b00012,
+    0x09a00008, 0x04b00010, 0x44b00020, 0x44b00030, 0x04c00018, 0x04d00008, 0x44b00020, 0x44b00010,
+    0x84b00000, 0x04b00010, 0x22100009, 0x62100012, 0x6210001b, 0x44b00020, 0x62100024, 0x6210002d,
+    0x22300008, 0x22200010, 0x62200020, 0x62200030, 0x62200020, 0x62200010, 0xa2200000, 0x22200010,
+    0x22500009, 0x62500012, 0x62200020, 0x62200030, 0x62200040, 0x62200050, 0x22400018, 0x20200008,
+    0x20300008, 0x20400010, 0x21d00009, 0x61d00012, 0x61d0001b, 0x61d00024, 0x61d0002d, 0x61d00036,
+    0x60300010, 0x21e00005, 0x22000014, 0x21f00014, 0xa1f00000, 0xa2000000, 0xa1e00000, 0x21e00016,
+    0x22000058, 0x21f00058, 0xa1f00000, 0xa2000000, 0x22000010, 0x21f00009, 0x61f00012, 0x61f0001b,
+    0x61f00024, 0x61f0002d, 0x61f00036, 0x62000020, 0x60300018, 0x21900005, 0x21a00014, 0x21c00014,
+    0xa1c00000, 0xa1a00000, 0xa1900000, 0x21900014, 0x21a00050, 0x21c00050, 0xa1c00000, 0xa1a00000,
+    0x21a00010, 0x61a00020, 0x21c00009, 0x61c00012, 0x61c0001b, 0x61c00024, 0x61c0002d, 0x61c00036,
+    0x60300020, 0x21b00005, 0x21500014, 0x21600014, 0xa1600000, 0xa1500000, 0xa1b00000, 0x21b00005,
+    0x21500014, 0x21600014, 0xa1600000, 0xa1500000, 0x21500010, 0x61500020, 0x21600009, 0x61600012,
+    0x6160001b, 0x61600024, 0x6160002d, 0x61600036, 0x60300028, 0x21800008, 0x21700008, 0x2110000c,
+    0x2120000c, 0xa1100000, 0xa1800000, 0xa1200000, 0xa1700000, 0x21700008, 0x21200008, 0x2180000c,
+    0x2110000c, 0xa1800000, 0xa1700000, 0xa1100000, 0xa1200000, 0x21200008, 0x21100008, 0x2170000c,
+    0x2180000c, 0xa1700000, 0xa1200000, 0xa1800000, 0xa1100000, 0x21100010, 0x21800009, 0x61800012,
+    0x6180001b, 0x61800024, 0x62300010, 0x21200010, 0x61200020, 0x61200030, 0x61200020, 0x61200010,
+    0xa1200000, 0x21200010, 0x21700009, 0x61700012, 0x61200020, 0x61200030, 0x61200040, 0x61200050,
+    0x21400018, 0x21300008, 0x20d00008, 0x20e00010, 0x21000009, 0x61000012, 0x6100001b, 0x61000024,
+    0x6100002d, 0x61000036, 0x60d00010, 0x20f00005, 0x20900014, 0x20a00014, 0xa0a00000, 0xa0900000,
+    0xa0f00000, 0x20f00015, 0x20900054, 0x20a00054, 0xa0a00000, 0xa0900000, 0x20900010, 0x20a00009,
+    0x60a00012, 0x60a0001b, 0x60a00024, 0x60a0002d, 0x60a00036, 0x60900020, 0x60d00018, 0x20c00005,
+    0x20b00014, 0x20500014, 0xa0500000, 0xa0b00000, 0xa0c00000, 0x20c0000d, 0x20b00034, 0x20500034,
+    0xa0500000, 0xa0b00000, 0x20b00010, 0x60b00020, 0x20500009, 0x60500012, 0x6050001b, 0x60500024,
+    0x6050002d, 0x60500036, 0x60d00020, 0x20600005, 0x20800014, 0x20700014, 0xa0700000, 0xa0800000,
+    0xa0600000, 0x20600005, 0x20800014, 0x20700014, 0xa0700000, 0xa0800000, 0x20800010, 0x60800020,
+    0x20700009, 0x60700012, 0x6070001b, 0x60700024, 0x6070002d, 0x60700036, 0x60d00028, 0x04f00008,
+    0x05000008, 0x0570000c, 0x06d0000c, 0x85700000, 0x84f00000, 0x86d00000, 0x85000000, 0x05000008,
+    0x06d00008, 0x04f0000c, 0x0570000c, 0x84f00000, 0x85000000, 0x85700000, 0x86d00000, 0x06d00008,
+    0x05700008, 0x0500000c, 0x04f0000c, 0x85000000, 0x86d00000, 0x84f00000, 0x85700000, 0x05700010,
+    0x04f00009, 0x44f00012, 0x44f0001b, 0x44f00024, 0x62300018, 0x06d00010, 0x46d00020, 0x46d00030,
+    0x46d00020, 0x46d00010, 0x86d00000, 0x06d00010, 0x05000009, 0x45000012, 0x46d00020, 0x46d00030,
+    0x46d00040, 0x46d00050, 0x06e00018, 0x19400008, 0x1e600008, 0x1e700010, 0x1e800009, 0x5e800012,
+    0x5e80001b, 0x5e800024, 0x5e80002d, 0x5e800036, 0x5e600010, 0x20100005, 0x1f800014, 0x1f100014,
+    0x9f100000, 0x9f800000, 0xa0100000, 0x2010000b, 0x1f80002c, 0x1f10002c, 0x9f100000, 0x9f800000,
+    0x1f800010, 0x1f100009, 0x5f100012, 0x5f10001b, 0x5f100024, 0x5f10002d, 0x5f100036, 0x5f800020,
+    0x5e600018, 0x1ec00005, 0x1eb00014, 0x1e900014, 0x9e900000, 0x9eb00000, 0x9ec00000, 0x1ec00009,
+    0x1eb00024, 0x1e900024, 0x9e900000, 0x9eb00000, 0x1eb00010, 0x5eb00020, 0x1e900009, 0x5e900012,
+    0x5e90001b, 0x5e900024, 0x5e90002d, 0x5e900036, 0x5e600020, 0x1ea00005, 0x1ab00014, 0x1ac00014,
+    0x9ac00000, 0x9ab00000, 0x9ea00000, 0x1ea00005, 0x1ab00014, 0x1ac00014, 0x9ac00000, 0x9ab00000,
+    0x1ab00010, 0x5ab00020, 0x1ac00009, 0x5ac00012, 0x5ac0001b, 0x5ac00024, 0x5ac0002d, 0x5ac00036,
+    0x5e600028, 0x1ad00008, 0x1db00008, 0x1dc0000c, 0x1dd0000c, 0x9dc00000, 0x9ad00000, 0x9dd00000,
+    0x9db00000, 0x1db00008, 0x1dd00008, 0x1ad0000c, 0x1dc0000c, 0x9ad00000, 0x9db00000, 0x9dc00000,
+    0x9dd00000, 0x1dd00008, 0x1dc00008, 0x1db0000c, 0x1ad0000c, 0x9db00000, 0x9dd00000, 0x9ad00000,
+    0x9dc00000, 0x1dc00010, 0x1ad00009, 0x5ad00012, 0x5ad0001b, 0x5ad00024, 0x62300020, 0x1dd00010,
+    0x5dd00020, 0x5dd00030, 0x5dd00020, 0x5dd00010, 0x9dd00000, 0x1dd00010, 0x1db00009, 0x5db00012,
+    0x5dd00020, 0x5dd00030, 0x5dd00040, 0x5dd00050, 0x1e400018, 0x1e500008, 0x1e200008, 0x1e300010,
+    0x1e000009, 0x5e000012, 0x5e00001b, 0x5e000024, 0x5e00002d, 0x5e000036, 0x5e200010, 0x1e100005,
+    0x1de00014, 0x1df00014, 0x9df00000, 0x9de00000, 0x9e100000, 0x1e100009, 0x1de00024, 0x1df00024,
+    0x9df00000, 0x9de00000, 0x1de00010, 0x1df00009, 0x5df00012, 0x5df0001b, 0x5df00024, 0x5df0002d,
+    0x5df00036, 0x5de00020, 0x5e200018, 0x1d000005, 0x1d100014, 0x1d200014, 0x9d200000, 0x9d100000,
+    0x9d000000, 0x1d00000b, 0x1d10002c, 0x1d20002c, 0x9d200000, 0x9d100000, 0x1d100010, 0x5d100020,
+    0x1d200009, 0x5d200012, 0x5d20001b, 0x5d200024, 0x5d20002d, 0x5d200036, 0x5e200020, 0x1d900005,
+    0x1da00014, 0x1d700014, 0x9d700000, 0x9da00000, 0x9d900000, 0x1d900005, 0x1da00014, 0x1d700014,
+    0x9d700000, 0x9da00000, 0x1da00010, 0x5da00020, 0x1d700009, 0x5d700012, 0x5d70001b, 0x5d700024,
+    0x5d70002d, 0x5d700036, 0x5e200028, 0x1d800008, 0x1d500008, 0x1d60000c, 0x1d30000c, 0x9d600000,
+    0x9d800000, 0x9d300000, 0x9d500000, 0x1d500008, 0x1d300008, 0x1d80000c, 0x1d60000c, 0x9d800000,
+    0x9d500000, 0x9d600000, 0x9d300000, 0x1d300008, 0x1d600008, 0x1d50000c, 0x1d80000c, 0x9d500000,
+    0x9d300000, 0x9d800000, 0x9d600000, 0x1d600010, 0x1d800009, 0x5d800012, 0x5d80001b, 0x5d800024,
+    0x62300028, 0x1d300010, 0x5d300020, 0x5d300030, 0x5d300020, 0x5d300010, 0x9d300000, 0x1d300010,
+    0x1d500009, 0x5d500012, 0x5d300020, 0x5d300030, 0x5d300040, 0x5d300050, 0x1d400018, 0x1c500008,
+    0x1c600008, 0x1c700010, 0x1ce00009, 0x5ce00012, 0x5ce0001b, 0x5ce00024, 0x5ce0002d, 0x5ce00036,
+    0x5c600010, 0x1cf00005, 0x1cc00014, 0x1cd00014, 0x9cd00000, 0x9cc00000, 0x9cf00000, 0x1cf00010,
+    0x1cc00040, 0x1cd00040, 0x9cd00000, 0x9cc00000, 0x1cc00010, 0x1cd00009, 0x5cd00012, 0x5cd0001b,
+    0x5cd00024, 0x5cd0002d, 0x5cd00036, 0x5cc00020, 0x5c600018, 0x1ca00005, 0x1cb00014, 0x1c800014,
+    0x9c800000, 0x9cb00000, 0x9ca00000, 0x1ca0000d, 0x1cb00034, 0x1c800034, 0x9c800000, 0x9cb00000,
+    0x1cb00010, 0x5cb00020, 0x1c800009, 0x5c800012, 0x5c80001b, 0x5c800024, 0x5c80002d, 0x5c800036,
+    0x5c600020, 0x1c900005, 0x1ba00014, 0x1bb00014, 0x9bb00000, 0x9ba00000, 0x9c900000, 0x1c900005,
+    0x1ba00014, 0x1bb00014, 0x9bb00000, 0x9ba00000, 0x1ba00010, 0x5ba00020, 0x1bb00009, 0x5bb00012,
+    0x5bb0001b, 0x5bb00024, 0x5bb0002d, 0x5bb00036, 0x5c600028, 0x1bc00008, 0x1c300008, 0x1c40000c,
+    0x1c10000c, 0x9c400000, 0x9bc00000, 0x9c100000, 0x9c300000, 0x1c300008, 0x1c100008, 0x1bc0000c,
+    0x1c40000c, 0x9bc00000, 0x9c300000, 0x9c400000, 0x9c100000, 0x1c100008, 0x1c400008, 0x1c30000c,
+    0x1bc0000c, 0x9c300000, 0x9c100000, 0x9bc00000, 0x9c400000, 0x1c400010, 0x1bc00009, 0x5bc00012,
+    0x5bc0001b, 0x5bc00024, 0x62300030, 0x1c100010, 0x5c100020, 0x5c100030, 0x5c100020, 0x5c100010,
+    0x9c100000, 0x1c100010, 0x1c300009, 0x5c300012, 0x5c100020, 0x5c100030, 0x5c100040, 0x5c100050,
+    0x1c200018, 0x1bf00008, 0x1c000008, 0x1bd00010, 0x1be00009, 0x5be00012, 0x5be0001b, 0x5be00024,
+    0x5be0002d, 0x5be00036, 0x5c000010, 0x1ae00005, 0x1b000014, 0x1b100014, 0x9b100000, 0x9b000000,
+    0x9ae00000, 0x1ae00016, 0x1b000058, 0x1b100058, 0x9b100000, 0x9b000000, 0x1b000010, 0x1b100009,
+    0x5b100012, 0x5b10001b, 0x5b100024, 0x5b10002d, 0x5b100036, 0x5b000020, 0x5c000018, 0x1b800005,
+    0x1b900014, 0x1b600014, 0x9b600000, 0x9b900000, 0x9b800000, 0x1b800009, 0x1b900024, 0x1b600024,
+    0x9b600000, 0x9b900000, 0x1b900010, 0x5b900020, 0x1b600009, 0x5b600012, 0x5b60001b, 0x5b600024,
+    0x5b60002d, 0x5b600036, 0x5c000020, 0x1b700005, 0x1b400014, 0x1b500014, 0x9b500000, 0x9b400000,
+    0x9b700000, 0x1b700005, 0x1b400014, 0x1b500014, 0x9b500000, 0x9b400000, 0x1b400010, 0x5b400020,
+    0x1b500009, 0x5b500012, 0x5b50001b, 0x5b500024, 0x5b50002d, 0x5b500036, 0x5c000028, 0x1b200008,
+    0x1b300008, 0x1af0000c, 0x1950000c, 0x9af00000, 0x9b200000, 0x99500000, 0x9b300000, 0x1b300008,
+    0x19500008, 0x1b20000c, 0x1af0000c, 0x9b200000, 0x9b300000, 0x9af00000, 0x99500000, 0x19500008,
+    0x1af00008, 0x1b30000c, 0x1b20000c, 0x9b300000, 0x99500000, 0x9b200000, 0x9af00000, 0x1af00010,
+    0x1b200009, 0x5b200012, 0x5b20001b, 0x5b200024, 0x62300038, 0x19500010, 0x59500020, 0x59500030,
+    0x59500020, 0x59500010, 0x99500000, 0x19500010, 0x1b300009, 0x5b300012, 0x59500020, 0x59500030,
+    0x59500040, 0x59500050, 0x19600018, 0x19700008, 0x19e00008, 0x1a700010, 0x1a500009, 0x5a500012,
+    0x5a50001b, 0x5a500024, 0x5a50002d, 0x5a500036, 0x59e00010, 0x1a600005, 0x1a300014, 0x1a400014,
+    0x9a400000, 0x9a300000, 0x9a600000, 0x1a600010, 0x1a300040, 0x1a400040, 0x9a400000, 0x9a300000,
+    0x1a300010, 0x1a400009, 0x5a400012, 0x5a40001b, 0x5a400024, 0x5a40002d, 0x5a400036, 0x5a300020,
+    0x59e00018, 0x1a100005, 0x1a200014, 0x1a000014, 0x9a000000, 0x9a200000, 0x9a100000, 0x1a100009,
+    0x1a200024, 0x1a000024, 0x9a000000, 0x9a200000, 0x1a200010, 0x5a200020, 0x1a000009, 0x5a000012,
+    0x5a00001b, 0x5a000024, 0x5a00002d, 0x5a000036, 0x59e00020, 0x19f00005, 0x19c00014, 0x19d00014,
+    0x99d00000, 0x99c00000, 0x99f00000, 0x19f00005, 0x19c00014, 0x19d00014, 0x99d00000, 0x99c00000,
+    0x19c00010, 0x59c00020, 0x19d00009, 0x59d00012, 0x59d0001b, 0x59d00024, 0x59d0002d, 0x59d00036,
+    0x59e00028, 0x19800008, 0x19b00008, 0x1aa0000c, 0x19a0000c, 0x9aa00000, 0x99800000, 0x99a00000,
+    0x99b00000, 0x19b00008, 0x19a00008, 0x1980000c, 0x1aa0000c, 0x99800000, 0x99b00000, 0x9aa00000,
+    0x99a00000, 0x19a00008, 0x1aa00008, 0x19b0000c, 0x1980000c, 0x99b00000, 0x99a00000, 0x99800000,
+    0x9aa00000, 0x1aa00010, 0x19800009, 0x59800012, 0x5980001b, 0x59800024, 0x62300040, 0x19a00010,
+    0x59a00020, 0x59a00030, 0x59a00020, 0x59a00010, 0x99a00000, 0x19a00010, 0x19b00009, 0x59b00012,
+    0x59a00020, 0x59a00030, 0x59a00040, 0x59a00050, 0x1a900018, 0x19900008, 0x1a800008, 0x06300010,
+    0x06400009, 0x46400012, 0x4640001b, 0x46400024, 0x4640002d, 0x46400036, 0x5a800010, 0x0ef00005,
+    0x14800014, 0x14900014, 0x94900000, 0x94800000, 0x8ef00000, 0x0ef0000a, 0x14800028, 0x14900028,
+    0x94900000, 0x94800000, 0x14800010, 0x14900009, 0x54900012, 0x5490001b, 0x54900024, 0x5490002d,
+    0x54900036, 0x54800020, 0x5a800018, 0x14a00005, 0x15900014, 0x15a00014, 0x95a00000, 0x95900000,
+    0x94a00000, 0x14a0000f, 0x1590003c, 0x15a0003c, 0x95a00000, 0x95900000, 0x15900010, 0x55900020,
+    0x15a00009, 0x55a00012, 0x55a0001b, 0x55a00024, 0x55a0002d, 0x55a00036, 0x5a800020, 0x15200005,
+    0x15300014, 0x15700014, 0x95700000, 0x95300000, 0x95200000, 0x15200005, 0x15300014, 0x15700014,
+    0x95700000, 0x95300000, 0x15300010, 0x55300020, 0x15700009, 0x55700012, 0x5570001b, 0x55700024,
+    0x5570002d, 0x55700036, 0x5a800028, 0x15800008, 0x15000008, 0x1510000c, 0x1550000c, 0x95100000,
+    0x95800000, 0x95500000, 0x95000000, 0x15000008, 0x15500008, 0x1580000c, 0x1510000c, 0x95800000,
+    0x95000000, 0x95100000, 0x95500000, 0x15500008, 0x15100008, 0x1500000c, 0x1580000c, 0x95000000,
+    0x95500000, 0x95800000, 0x95100000, 0x15100010, 0x15800009, 0x55800012, 0x5580001b, 0x55800024,
+    0x62300048, 0x15500010, 0x55500020, 0x55500030, 0x55500020, 0x55500010, 0x95500000, 0x15500010,
+    0x15000009, 0x55000012, 0x55500020, 0x55500030, 0x55500040, 0x55500050, 0x15600018, 0x14e00008,
+    0x14f00008, 0x18e00010, 0x14b00009, 0x54b00012, 0x54b0001b, 0x54b00024, 0x54b0002d, 0x54b00036,
+    0x54f00010, 0x17b00005, 0x17a00014, 0x14d00014, 0x94d00000, 0x97a00000, 0x97b00000, 0x17b0000f,
+    0x17a0003c, 0x14d0003c, 0x94d00000, 0x97a00000, 0x17a00010, 0x14d00009, 0x54d00012, 0x54d0001b,
+    0x54d00024, 0x54d0002d, 0x54d00036, 0x57a00020, 0x54f00018, 0x18700005, 0x18800014, 0x18900014,
+    0x98900000, 0x98800000, 0x98700000, 0x1870000f, 0x1880003c, 0x1890003c, 0x98900000, 0x98800000,
+    0x18800010, 0x58800020, 0x18900009, 0x58900012, 0x5890001b, 0x58900024, 0x5890002d, 0x58900036,
+    0x54f00020, 0x19100005, 0x19200014, 0x18b00014, 0x98b00000, 0x99200000, 0x99100000, 0x19100005,
+    0x19200014, 0x18b00014, 0x98b00000, 0x99200000, 0x19200010, 0x59200020, 0x18b00009, 0x58b00012,
+    0x58b0001b, 0x58b00024, 0x58b0002d, 0x58b00036, 0x54f00028, 0x18a00008, 0x18f00008, 0x0900000c,
+    0x18d0000c, 0x89000000, 0x98a00000, 0x98d00000, 0x98f00000, 0x18f00008, 0x18d00008, 0x18a0000c,
+    0x0900000c, 0x98a00000, 0x98f00000, 0x89000000, 0x98d00000, 0x18d00008, 0x09000008, 0x18f0000c,
+    0x18a0000c, 0x98f00000, 0x98d00000, 0x98a00000, 0x89000000, 0x09000010, 0x18a00009, 0x58a00012,
+    0x58a0001b, 0x58a00024, 0x62300050, 0x18d00010, 0x58d00020, 0x58d00030, 0x58d00020, 0x58d00010,
+    0x98d00000, 0x18d00010, 0x18f00009, 0x58f00012, 0x58d00020, 0x58d00030, 0x58d00040, 0x58d00050,
+    0x18c00018, 0x18600008, 0x19300008, 0x18500010, 0x18400009, 0x58400012, 0x5840001b, 0x58400024,
+    0x5840002d, 0x58400036, 0x59300010, 0x18300005, 0x18200014, 0x18100014, 0x98100000, 0x98200000,
+    0x98300000, 0x1830000e, 0x18200038, 0x18100038, 0x98100000, 0x98200000, 0x18200010, 0x18100009,
+    0x58100012, 0x5810001b, 0x58100024, 0x5810002d, 0x58100036, 0x58200020, 0x59300018, 0x18000005,
+    0x17f00014, 0x17e00014, 0x97e00000, 0x97f00000, 0x98000000, 0x1800000f, 0x17f0003c, 0x17e0003c,
+    0x97e00000, 0x97f00000, 0x17f00010, 0x57f00020, 0x17e00009, 0x57e00012, 0x57e0001b, 0x57e00024,
+    0x57e0002d, 0x57e00036, 0x59300020, 0x17d00005, 0x17c00014, 0x14c00014, 0x94c00000, 0x97c00000,
+    0x97d00000, 0x17d00005, 0x17c00014, 0x14c00014, 0x94c00000, 0x97c00000, 0x17c00010, 0x57c00020,
+    0x14c00009, 0x54c00012, 0x54c0001b, 0x54c00024, 0x54c0002d, 0x54c00036, 0x59300028, 0x15400008,
+    0x13500008, 0x1360000c, 0x1370000c, 0x93600000, 0x95400000, 0x93700000, 0x93500000, 0x13500008,
+    0x13700008, 0x1540000c, 0x1360000c, 0x95400000, 0x93500000, 0x93600000, 0x93700000, 0x13700008,
+    0x13600008, 0x1350000c, 0x1540000c, 0x93500000, 0x93700000, 0x95400000, 0x93600000, 0x13600010,
+    0x15400009, 0x55400012, 0x5540001b, 0x55400024, 0x62300058, 0x13700010, 0x53700020, 0x53700030,
+    0x53700020, 0x53700010, 0x93700000, 0x13700010, 0x13500009, 0x53500012, 0x53700020, 0x53700030,
+    0x53700040, 0x53700050, 0x14600018, 0x14700008, 0x11a00008, 0x13f00010, 0x14000009, 0x54000012,
+    0x5400001b, 0x54000024, 0x5400002d, 0x54000036, 0x51a00010, 0x14400005, 0x14500014, 0x08c00014,
+    0x88c00000, 0x94500000, 0x94400000, 0x14400008, 0x14500020, 0x08c00020, 0x88c00000, 0x94500000,
+    0x14500010, 0x08c00009, 0x48c00012, 0x48c0001b, 0x48c00024, 0x48c0002d, 0x48c00036, 0x54500020,
+    0x51a00018, 0x13d00005, 0x13e00014, 0x14200014, 0x94200000, 0x93e00000, 0x93d00000, 0x13d0000f,
+    0x13e0003c, 0x1420003c, 0x94200000, 0x93e00000, 0x13e00010, 0x53e00020, 0x14200009, 0x54200012,
+    0x5420001b, 0x54200024, 0x5420002d, 0x54200036, 0x51a00020, 0x14300005, 0x11b00014, 0x13b00014,
+    0x93b00000, 0x91b00000, 0x94300000, 0x14300005, 0x11b00014, 0x13b00014, 0x93b00000, 0x91b00000,
+    0x11b00010, 0x51b00020, 0x13b00009, 0x53b00012, 0x53b0001b, 0x53b00024, 0x53b0002d, 0x53b00036,
+    0x51a00028, 0x13c00008, 0x13800008, 0x1650000c, 0x13a0000c, 0x96500000, 0x93c00000, 0x93a00000,
+    0x93800000, 0x13800008, 0x13a00008, 0x13c0000c, 0x1650000c, 0x93c00000, 0x93800000, 0x96500000,
+    0x93a00000, 0x13a00008, 0x16500008, 0x1380000c, 0x13c0000c, 0x93800000, 0x93a00000, 0x93c00000,
+    0x96500000, 0x16500010, 0x13c00009, 0x53c00012, 0x53c0001b, 0x53c00024, 0x62300060, 0x13a00010,
+    0x53a00020, 0x53a00030, 0x53a00020, 0x53a00010, 0x93a00000, 0x13a00010, 0x13800009, 0x53800012,
+    0x53a00020, 0x53a00030, 0x53a00040, 0x53a00050, 0x16a00018, 0x17300008, 0x17600008, 0x17500010,
+    0x17400009, 0x57400012, 0x5740001b, 0x57400024, 0x5740002d, 0x57400036, 0x57600010, 0x16f00005,
+    0x17200014, 0x17100014, 0x97100000, 0x97200000, 0x96f00000, 0x16f00008, 0x17200020, 0x17100020,
+    0x97100000, 0x97200000, 0x17200010, 0x17100009, 0x57100012, 0x5710001b, 0x57100024, 0x5710002d,
+    0x57100036, 0x57200020, 0x57600018, 0x17000005, 0x16b00014, 0x16e00014, 0x96e00000, 0x96b00000,
+    0x97000000, 0x1700000f, 0x16b0003c, 0x16e0003c, 0x96e00000, 0x96b00000, 0x16b00010, 0x56b00020,
+    0x16e00009, 0x56e00012, 0x56e0001b, 0x56e00024, 0x56e0002d, 0x56e00036, 0x57600020, 0x16d00005,
+    0x16c00014, 0x17900014, 0x97900000, 0x96c00000, 0x96d00000, 0x16d00005, 0x16c00014, 0x17900014,
+    0x97900000, 0x96c00000, 0x16c00010, 0x56c00020, 0x17900009, 0x57900012, 0x5790001b, 0x57900024,
+    0x5790002d, 0x57900036, 0x57600028, 0x17800008, 0x17700008, 0x1390000c, 0x1410000c, 0x93900000,
+    0x97800000, 0x94100000, 0x97700000, 0x17700008, 0x14100008, 0x1780000c, 0x1390000c, 0x97800000,
+    0x97700000, 0x93900000, 0x94100000, 0x14100008, 0x13900008, 0x1770000c, 0x1780000c, 0x97700000,
+    0x94100000, 0x97800000, 0x93900000, 0x13900010, 0x17800009, 0x57800012, 0x5780001b, 0x57800024,
+    0x62300068, 0x14100010, 0x54100020, 0x54100030, 0x54100020, 0x54100010, 0x94100000, 0x14100010,
+    0x17700009, 0x57700012, 0x54100020, 0x54100030, 0x54100040, 0x54100050, 0x11600018, 0x11700008,
+    0x11800008, 0x13300010, 0x13400009, 0x53400012, 0x5340001b, 0x53400024, 0x5340002d, 0x53400036,
+    0x51800010, 0x12c00005, 0x12d00014, 0x13100014, 0x93100000, 0x92d00000, 0x92c00000, 0x12c00008,
+    0x12d00020, 0x13100020, 0x93100000, 0x92d00000, 0x12d00010, 0x13100009, 0x53100012, 0x5310001b,
+    0x53100024, 0x5310002d, 0x53100036, 0x52d00020, 0x51800018, 0x13200005, 0x12a00014, 0x12b00014,
+    0x92b00000, 0x92a00000, 0x93200000, 0x1320000f, 0x12a0003c, 0x12b0003c, 0x92b00000, 0x92a00000,
+    0x12a00010, 0x52a00020, 0x12b00009, 0x52b00012, 0x52b0001b, 0x52b00024, 0x52b0002d, 0x52b00036,
+    0x51800020, 0x12f00005, 0x13000014, 0x08e00014, 0x88e00000, 0x93000000, 0x92f00000, 0x12f00005,
+    0x13000014, 0x08e00014, 0x88e00000, 0x93000000, 0x13000010, 0x53000020, 0x08e00009, 0x48e00012,
+    0x48e0001b, 0x48e00024, 0x48e0002d, 0x48e00036, 0x51800028, 0x11e00008, 0x12900008, 0x1190000c,
+    0x1230000c, 0x91900000, 0x91e00000, 0x92300000, 0x92900000, 0x12900008, 0x12300008, 0x11e0000c,
+    0x1190000c, 0x91e00000, 0x92900000, 0x91900000, 0x92300000, 0x12300008, 0x11900008, 0x1290000c,
+    0x11e0000c, 0x92900000, 0x92300000, 0x91e00000, 0x91900000, 0x11900010, 0x11e00009, 0x51e00012,
+    0x51e0001b, 0x51e00024, 0x62300070, 0x12300010, 0x52300020, 0x52300030, 0x52300020, 0x52300010,
+    0x92300000, 0x12300010, 0x12900009, 0x52900012, 0x52300020, 0x52300030, 0x52300040, 0x52300050,
+    0x15d00018, 0x16800008, 0x16100008, 0x16700010, 0x16600009, 0x56600012, 0x5660001b, 0x56600024,
+    0x5660002d, 0x56600036, 0x56100010, 0x16400005, 0x16000014, 0x16300014, 0x96300000, 0x96000000,
+    0x96400000, 0x16400008, 0x16000020, 0x16300020, 0x96300000, 0x96000000, 0x16000010, 0x16300009,
+    0x56300012, 0x5630001b, 0x56300024, 0x5630002d, 0x56300036, 0x56000020, 0x56100018, 0x16200005,
+    0x15b00014, 0x15f00014, 0x95f00000, 0x95b00000, 0x96200000, 0x1620000f, 0x15b0003c, 0x15f0003c,
+    0x95f00000, 0x95b00000, 0x15b00010, 0x55b00020, 0x15f00009, 0x55f00012, 0x55f0001b, 0x55f00024,
+    0x55f0002d, 0x55f00036, 0x56100020, 0x15e00005, 0x15c00014, 0x12800014, 0x92800000, 0x95c00000,
+    0x95e00000, 0x15e00005, 0x15c00014, 0x12800014, 0x92800000, 0x95c00000, 0x15c00010, 0x55c00020,
+    0x12800009, 0x52800012, 0x5280001b, 0x52800024, 0x5280002d, 0x52800036, 0x56100028, 0x12e00008,
+    0x10200008, 0x1030000c, 0x1040000c, 0x90300000, 0x92e00000, 0x90400000, 0x90200000, 0x10200008,
+    0x10400008, 0x12e0000c, 0x1030000c, 0x92e00000, 0x90200000, 0x90300000, 0x90400000, 0x10400008,
+    0x10300008, 0x1020000c, 0x12e0000c, 0x90200000, 0x90400000, 0x92e00000, 0x90300000, 0x10300010,
+    0x12e00009, 0x52e00012, 0x52e0001b, 0x52e00024, 0x10400008, 0x10200008, 0x1090000c, 0x10a0000c,
+    0x90900000, 0x90400000, 0x90a00000, 0x90200000, 0x10200008, 0x10a00008, 0x1040000c, 0x1090000c,
+    0x90400000, 0x90200000, 0x90900000, 0x90a00000, 0x49a00010, 0x10a00010, 0x50a00020, 0x50a00030,
+    0x50a00020, 0x50a00010, 0x90a00000, 0x10a00010, 0x10900009, 0x50900012, 0x10200008, 0x10400010,
+    0x50400020, 0x50400030, 0x50400040, 0x10b00009, 0x50b00012, 0x50b0001b, 0x50b00024, 0x50b0002d,
+    0x50b00036, 0x50b0003f, 0x50b00048, 0x50b00051, 0x50200010, 0x11000010, 0x51000020, 0x51000030,
+    0x51000020, 0x51000010, 0x91000000, 0x50200018, 0x11000010, 0x51000020, 0x51000030, 0x51000020,
+    0x51000010, 0x91000000, 0x11000010, 0x11100009, 0x51100012, 0x5110001b, 0x10c00010, 0x10d00009,
+    0x50d00012, 0x50d0001b, 0x11400008, 0x11500010, 0x11200009, 0x51200012, 0x5120001b, 0x51200024,
+    0x51400010, 0x11300010, 0x10f00009, 0x50f00012, 0x50f0001b, 0x50f00024, 0x51400018, 0x10e00010,
+    0x10700009, 0x50700012, 0x5070001b, 0x51400020, 0x10800010, 0x10600009, 0x50600012, 0x5060001b,
+    0x51400028, 0x10500010, 0x50500020, 0x50500030, 0x50500020, 0x50500010, 0x90500000, 0x10500010,
+    0x0f000009, 0x4f000012, 0x4f00001b, 0x4f000024, 0x4f00002d, 0x4f000036, 0x0f100008, 0x0f200005,
+    0x0f700014, 0x0f800014, 0x8f800000, 0x8f700000, 0x0f700010, 0x0f800009, 0x4f800012, 0x8f200000,
+    0x0f200016, 0x0f900058, 0x0fe00058, 0x8fe00000, 0x8f900000, 0x4f80001b, 0x4f100010, 0x0f900005,
+    0x0fe00014, 0x0ff00014, 0x8ff00000, 0x8fe00000, 0x0fe00010, 0x0ff00009, 0x4ff00012, 0x8f900000,
+    0x0f900014, 0x0fa00050, 0x0fb00050, 0x8fb00000, 0x8fa00000, 0x4f100018, 0x0fa00005, 0x0fb00014,
+    0x10000014, 0x90000000, 0x8fb00000, 0x0fb00010, 0x10000009, 0x50000012, 0x8fa00000, 0x0fa0000c,
+    0x10100030, 0x0fd00030, 0x8fd00000, 0x90100000, 0x51400030, 0x10100010, 0x50100020, 0x50100030,
+    0x50100020, 0x50100010, 0x90100000, 0x10100010, 0x0fd00009, 0x4fd00012, 0x4fd0001b, 0x4fd00024,
+    0x4fd0002d, 0x4fd00036, 0x0fc00008, 0x4fc00010, 0x4fc00018, 0x4fc00020, 0x51400038, 0x0f500010,
+    0x4f500020, 0x4f500030, 0x4f500020, 0x4f500010, 0x8f500000, 0x0f500010, 0x0f600009, 0x4f600012,
+    0x4f60001b, 0x4f600024, 0x4f60002d, 0x0f400008, 0x0f300010, 0x05800009, 0x45800012, 0x4580001b,
+    0x45800024, 0x4580002d, 0x45800036, 0x4f400010, 0x05900010, 0x07e00009, 0x47e00012, 0x47e0001b,
+    0x47e00024, 0x47e0002d, 0x47e00036, 0x4f400018, 0x0cc00010, 0x0e800009, 0x4e800012, 0x4e80001b,
+    0x4e800024, 0x4e80002d, 0x4e800036, 0x0cd00018, 0x0d700008, 0x4f400020, 0x0eb00010, 0x0d600009,
+    0x4d600012, 0x4d60001b, 0x4d600024, 0x4d60002d, 0x4d600036, 0x4d60003f, 0x0ec00018, 0x0d500008,
+    0x4d600048, 0x4f400028, 0x0ed00010, 0x0d400009, 0x4d400012, 0x4d40001b, 0x4d400024, 0x4d40002d,
+    0x4d400036, 0x0ee00018, 0x0d000008, 0x4f400030, 0x0d100010, 0x4d100020, 0x4d100030, 0x4d100040,
+    0x4d100050, 0x4d100060, 0x4d100070, 0x4d100080, 0x4d100090, 0x4d1000a0, 0x4d1000b0, 0x0d300009,
+    0x4d300012, 0x4d30001b, 0x4d300024, 0x4d30002d, 0x4d300036, 0x4d30003f, 0x4d300048, 0x4d1000c0,
+    0x0d200009, 0x4d200012, 0x4d20001b, 0x4d200024, 0x4d20002d, 0x4d200036, 0x4d1000d0, 0x0ce00009,
+    0x4ce00012, 0x4ce0001b, 0x4d300051, 0x0ea00018, 0x0cf00008, 0x4f400038, 0x0e900005, 0x09c00014,
+    0x09d00014, 0x89d00000, 0x89c00000, 0x09c00010, 0x09d00009, 0x49d00012, 0x8e900000, 0x0e900005,
+    0x09e00014, 0x0c100014, 0x8c100000, 0x89e00000, 0x49d0001b, 0x49d00024, 0x49d0002d, 0x49d00036,
+    0x49d0003f, 0x49d00048, 0x09e00018, 0x0c100008, 0x51400040, 0x0c900010, 0x4c900020, 0x4c900030,
+    0x4c900020, 0x4c900010, 0x8c900000, 0x0c900010, 0x0c200009, 0x0c300018, 0x0c500008, 0x0c400008,
+    0x0c700010, 0x0c800009, 0x4c800012, 0x4c80001b, 0x0c600018, 0x0cb00008, 0x51400048, 0x0ca00010,
+    0x4ca00020, 0x4ca00030, 0x4ca00020, 0x4ca00010, 0x8ca00000, 0x0ca00010, 0x0c000009, 0x4c000012,
+    0x4c00001b, 0x4c000024, 0x4c00002d, 0x4c000036, 0x4c00003f, 0x4c000048, 0x0e500008, 0x0bc00005,
+    0x0e600014, 0x0bd00014, 0x8bd00000, 0x8e600000, 0x8bc00000, 0x0bc0000b, 0x0e60002c, 0x0bd0002c,
+    0x8bd00000, 0x8e600000, 0x0e600010, 0x0bd00009, 0x4bd00012, 0x4e500010, 0x0be00010, 0x4be00020,
+    0x4be00030, 0x4be00040, 0x0bf00009, 0x4bf00012, 0x4bf0001b, 0x4bf00024, 0x50b0005a, 0x50b00063,
+    0x50b0006c, 0x50b00075, 0x4f00003f, 0x4f000048, 0x4f000051, 0x4f00005a, 0x4f000063, 0x4f00006c,
+    0x4fd0003f, 0x4fd00048, 0x4fd00051, 0x4fd0005a, 0x4fd00063, 0x4fd0006c, 0x4c200012, 0x4c20001b,
+    0x4c200024, 0x4c20002d, 0x4c200036, 0x4c20003f, 0x4f600036, 0x4f60003f, 0x4f600048, 0x4f600051,
+    0x4f60005a, 0x4f600063, 0x4c000051, 0x4c00005a, 0x4c000063, 0x4c00006c, 0x4c000075, 0x4c00007e,
+    0x0bb00048, 0x0e700048, 0x0ae00098, 0x0b600098, 0x0b800098, 0x0b700098, 0x0af00098, 0x0b000098,
+    0x0b200098, 0x0b100098, 0x0b400098, 0x0b500098, 0x0b300098, 0x0ba00098, 0x0b900098, 0x0ad00098,
+    0x0e400098, 0x0a100098, 0x0a900098, 0x0aa00098, 0x0a200098, 0x0a300098, 0x0a500098, 0x4f000075,
+    0x0a400098, 0x4fd00075, 0x0a700098, 0x4f60006c, 0x0a800098, 0x4c000087, 0x0a600098, 0x4c800024,
+    0x0ac00098, 0x4c200048, 0x0ab00098, 0x09f00008, 0x0e300008, 0x0a00001c, 0x0e20001c, 0x8a000000,
+    0x89f00000, 0x8e200000, 0x8e300000, 0x0e300034, 0x0e200034, 0x09f00004, 0x0a000004, 0x89f00000,
+    0x8e300000, 0x8a000000, 0x8e200000, 0x0e200008, 0x0a000008, 0x0e30001c, 0x09f0001c, 0x8e300000,
+    0x8e200000, 0x89f00000, 0x8a000000, 0x0a000034, 0x09f00034, 0x0e200004, 0x0e300004, 0x8e200000,
+    0x8a000000, 0x8e300000, 0x89f00000, 0x09f00008, 0x0e300008, 0x0a00001c, 0x0e20001c, 0x8a000000,
+    0x89f00000, 0x8e200000, 0x8e300000, 0x0e300034, 0x0e200034, 0x09f00004, 0x0a000004, 0x89f00000,
+    0x8e300000, 0x8a000000, 0x8e200000, 0x0e200034, 0x0a000034, 0x0e300004, 0x09f00004, 0x8e300000,
+    0x8e200000, 0x89f00000, 0x8a000000, 0x49a00018, 0x0a000010, 0x09f00009, 0x49f00012, 0x49f0001b,
+    0x49a00020, 0x0e200005, 0x0e300014, 0x07f00014, 0x87f00000, 0x8e300000, 0x8e200000, 0x0e200017,
+    0x0e30005c, 0x07f0005c, 0x87f00000, 0x8e300000, 0x0e300010, 0x07f00009, 0x47f00012, 0x47f0001b,
+    0x08000098, 0x47f00024, 0x47f0002d, 0x47f00036, 0x47f0003f, 0x08100098, 0x08b00320, 0x09200042,
+    0x88b00000, 0x08b0ad13, 0x09300018, 0x0940000b, 0x09500b53, 0x89400000, 0x0940000d, 0x89400000,
+    0x89500000, 0x89200000, 0x91c00000, 0x11c0001e, 0x0920001f, 0x09500078, 0x09400078, 0x89400000,
+    0x89500000, 0x91c00000, 0x96900000, 0x16900021, 0x11c00022, 0x09500084, 0x09400084, 0x89400000,
+    0x89500000, 0x96900000, 0x89200000, 0x0920001e, 0x1690001f, 0x09500078, 0x09400078, 0x89400000,
+    0x89500000, 0x89200000, 0x91c00000, 0x11c00021, 0x09200022, 0x09500084, 0x09400084, 0x89400000,
+    0x89500000, 0x91c00000, 0x96900000, 0x1690001e, 0x11c0001f, 0x09500078, 0x09400078, 0x89400000,
+    0x89500000, 0x96900000, 0x89200000, 0x09200021, 0x16900022, 0x09500084, 0x09400084, 0x89400000,
+    0x89500000, 0x89200000, 0x09200010, 0x49200020, 0x49200030, 0x49200040, 0x09500009, 0x49500012,
+    0x80000000, 0x80100000, 0x84a00000, 0x89600000, 0x89900000, 0x89700000, 0x89800000, 0x89b00000,
+    0x84c00000, 0x84d00000, 0xa2400000, 0xa0200000, 0xa1d00000, 0xa0400000, 0x60300020, 0xa1e00000,
+    0xa1f00000, 0x62000010, 0xa2000000, 0x60300018, 0xa1900000, 0xa1c00000, 0x61a00010, 0xa1a00000,
+    0x60300010, 0xa1b00000, 0xa1600000, 0x61500010, 0xa1500000, 0x60300008, 0xa1800000, 0xa1100000,
+    0xa0300000, 0xa2500000, 0x62200040, 0x62200030, 0x62200020, 0x62200010, 0xa2200000, 0x62300068,
+    0xa1400000, 0xa1300000, 0xa1000000, 0xa0e00000, 0x60d00020, 0xa0f00000, 0xa0a00000, 0x60900010,
+    0xa0900000, 0x60d00018, 0xa0c00000, 0xa0500000, 0x60b00010, 0xa0b00000, 0x60d00010, 0xa0600000,
+    0xa0700000, 0x60800010, 0xa0800000, 0x60d00008, 0x84f00000, 0x85700000, 0xa0d00000, 0xa1700000,
+    0x61200040, 0x61200030, 0x61200020, 0x61200010, 0xa1200000, 0x62300060, 0x86e00000, 0x99400000,
+    0x9e800000, 0x9e700000, 0x5e600020, 0xa0100000, 0x9f100000, 0x5f800010, 0x9f800000, 0x5e600018,
+    0x9ec00000, 0x9e900000, 0x5eb00010, 0x9eb00000, 0x5e600010, 0x9ea00000, 0x9ac00000, 0x5ab00010,
+    0x9ab00000, 0x5e600008, 0x9ad00000, 0x9dc00000, 0x9e600000, 0x85000000, 0x46d00040, 0x46d00030,
+    0x46d00020, 0x46d00010, 0x86d00000, 0x62300058, 0x9e400000, 0x9e500000, 0x9e000000, 0x9e300000,
+    0x5e200020, 0x9e100000, 0x9df00000, 0x5de00010, 0x9de00000, 0x5e200018, 0x9d000000, 0x9d200000,
+    0x5d100010, 0x9d100000, 0x5e200010, 0x9d900000, 0x9d700000, 0x5da00010, 0x9da00000, 0x5e200008,
+    0x9d800000, 0x9d600000, 0x9e200000, 0x9db00000, 0x5dd00040, 0x5dd00030, 0x5dd00020, 0x5dd00010,
+    0x9dd00000, 0x62300050, 0x9d400000, 0x9c500000, 0x9ce00000, 0x9c700000, 0x5c600020, 0x9cf00000,
+    0x9cd00000, 0x5cc00010, 0x9cc00000, 0x5c600018, 0x9ca00000, 0x9c800000, 0x5cb00010, 0x9cb00000,
+    0x5c600010, 0x9c900000, 0x9bb00000, 0x5ba00010, 0x9ba00000, 0x5c600008, 0x9bc00000, 0x9c400000,
+    0x9c600000, 0x9d500000, 0x5d300040, 0x5d300030, 0x5d300020, 0x5d300010, 0x9d300000, 0x62300048,
+    0x9c200000, 0x9bf00000, 0x9be00000, 0x9bd00000, 0x5c000020, 0x9ae00000, 0x9b100000, 0x5b000010,
+    0x9b000000, 0x5c000018, 0x9b800000, 0x9b600000, 0x5b900010, 0x9b900000, 0x5c000010, 0x9b700000,
+    0x9b500000, 0x5b400010, 0x9b400000, 0x5c000008, 0x9b200000, 0x9af00000, 0x9c000000, 0x9c300000,
+    0x5c100040, 0x5c100030, 0x5c100020, 0x5c100010, 0x9c100000, 0x62300040, 0x99600000, 0x99700000,
+    0x9a500000, 0x9a700000, 0x59e00020, 0x9a600000, 0x9a400000, 0x5a300010, 0x9a300000, 0x59e00018,
+    0x9a100000, 0x9a000000, 0x5a200010, 0x9a200000, 0x59e00010, 0x99f00000, 0x99d00000, 0x59c00010,
+    0x99c00000, 0x59e00008, 0x99800000, 0x9aa00000, 0x99e00000, 0x9b300000, 0x59500040, 0x59500030,
+    0x59500020, 0x59500010, 0x99500000, 0x62300038, 0x9a900000, 0x99900000, 0x86400000, 0x86300000,
+    0x5a800020, 0x8ef00000, 0x94900000, 0x54800010, 0x94800000, 0x5a800018, 0x94a00000, 0x95a00000,
+    0x55900010, 0x95900000, 0x5a800010, 0x95200000, 0x95700000, 0x55300010, 0x95300000, 0x5a800008,
+    0x95800000, 0x95100000, 0x9a800000, 0x99b00000, 0x59a00040, 0x59a00030, 0x59a00020, 0x59a00010,
+    0x99a00000, 0x62300030, 0x95600000, 0x94e00000, 0x94b00000, 0x98e00000, 0x54f00020, 0x97b00000,
+    0x94d00000, 0x57a00010, 0x97a00000, 0x54f00018, 0x98700000, 0x98900000, 0x58800010, 0x98800000,
+    0x54f00010, 0x99100000, 0x98b00000, 0x59200010, 0x99200000, 0x54f00008, 0x98a00000, 0x89000000,
+    0x94f00000, 0x95000000, 0x55500040, 0x55500030, 0x55500020, 0x55500010, 0x95500000, 0x62300028,
+    0x98c00000, 0x98600000, 0x98400000, 0x98500000, 0x59300020, 0x98300000, 0x98100000, 0x58200010,
+    0x98200000, 0x59300018, 0x98000000, 0x97e00000, 0x57f00010, 0x97f00000, 0x59300010, 0x97d00000,
+    0x94c00000, 0x57c00010, 0x97c00000, 0x59300008, 0x95400000, 0x93600000, 0x99300000, 0x98f00000,
+    0x58d00040, 0x58d00030, 0x58d00020, 0x58d00010, 0x98d00000, 0x62300020, 0x94600000, 0x94700000,
+    0x94000000, 0x93f00000, 0x51a00020, 0x94400000, 0x88c00000, 0x54500010, 0x94500000, 0x51a00018,
+    0x93d00000, 0x94200000, 0x53e00010, 0x93e00000, 0x51a00010, 0x94300000, 0x93b00000, 0x51b00010,
+    0x91b00000, 0x51a00008, 0x93c00000, 0x96500000, 0x91a00000, 0x93500000, 0x53700040, 0x53700030,
+    0x53700020, 0x53700010, 0x93700000, 0x62300018, 0x96a00000, 0x97300000, 0x97400000, 0x97500000,
+    0x57600020, 0x96f00000, 0x97100000, 0x57200010, 0x97200000, 0x57600018, 0x97000000, 0x96e00000,
+    0x56b00010, 0x96b00000, 0x57600010, 0x96d00000, 0x97900000, 0x56c00010, 0x96c00000, 0x57600008,
+    0x97800000, 0x93900000, 0x97600000, 0x93800000, 0x53a00040, 0x53a00030, 0x53a00020, 0x53a00010,
+    0x93a00000, 0x62300010, 0x91600000, 0x91700000, 0x93400000, 0x93300000, 0x51800020, 0x92c00000,
+    0x93100000, 0x52d00010, 0x92d00000, 0x51800018, 0x93200000, 0x92b00000, 0x52a00010, 0x92a00000,
+    0x51800010, 0x92f00000, 0x88e00000, 0x53000010, 0x93000000, 0x51800008, 0x91e00000, 0x91900000,
+    0x91800000, 0x97700000, 0x54100040, 0x54100030, 0x54100020, 0x54100010, 0x94100000, 0x62300008,
+    0x95d00000, 0x96800000, 0x96600000, 0x96700000, 0x56100020, 0x96400000, 0x96300000, 0x56000010,
+    0x96000000, 0x56100018, 0x96200000, 0x95f00000, 0x55b00010, 0x95b00000, 0x56100010, 0x95e00000,
+    0x92800000, 0x55c00010, 0x95c00000, 0x56100008, 0x92e00000, 0x90300000, 0x96100000, 0x92900000,
+    0x52300040, 0x52300030, 0x52300020, 0x52300010, 0x92300000, 0xa2300000, 0xa2100000, 0x44b00010,
+    0x84b00000, 0x49a00018, 0x91200000, 0x91500000, 0x51400040, 0x90f00000, 0x91300000, 0x51400038,
+    0x90700000, 0x90e00000, 0x51400030, 0x90600000, 0x90800000, 0x51400028, 0x8f200000, 0x8f800000,
+    0x8f700000, 0x4f100010, 0x8f900000, 0x8ff00000, 0x8fe00000, 0x4f100008, 0x8fa00000, 0x90000000,
+    0x8fb00000, 0x8f100000, 0x8f000000, 0x90500000, 0x8a500000, 0x51400020, 0x4fc00018, 0x4fc00010,
+    0x4fc00008, 0x8fc00000, 0x8fd00000, 0x90100000, 0x8a400000, 0x51400018, 0x85800000, 0x8f300000,
+    0x4f400030, 0x87e00000, 0x85900000, 0x4f400028, 0x8cd00000, 0x8d700000, 0x8e800000, 0x8cc00000,
+    0x4f400020, 0x8ec00000, 0x8d500000, 0x8d600000, 0x8eb00000, 0x4f400018, 0x8ee00000, 0x8d000000,
+    0x8d400000, 0x8ed00000, 0x4f400010, 0x8bb00000, 0x8ea00000, 0x8cf00000, 0x8d300000, 0x4d1000c0,
+    0x8d200000, 0x4d1000b0, 0x8ce00000, 0x4d1000a0, 0x4d100090, 0x4d100080, 0x4d100070, 0x4d100060,
+    0x4d100050, 0x4d100040, 0x4d100030, 0x4d100020, 0x4d100010, 0x8d100000, 0x4f400008, 0x89e00000,
+    0x8c100000, 0x8e900000, 0x89d00000, 0x89c00000, 0x8f400000, 0x8f600000, 0x8f500000, 0x8a700000,
+    0x51400010, 0x8a300000, 0x8a200000, 0x8aa00000, 0x8a900000, 0x8a100000, 0x8e400000, 0x8ad00000,
+    0x8b900000, 0x8ba00000, 0x8b300000, 0x8b500000, 0x8b400000, 0x8b100000, 0x8b200000, 0x8b000000,
+    0x8af00000, 0x8b700000, 0x8b800000, 0x8b600000, 0x8ae00000, 0x8e700000, 0x8c300000, 0x8c500000,
+    0x8c600000, 0x8cb00000, 0x8c800000, 0x8c700000, 0x8ab00000, 0x8a600000, 0x8c400000, 0x8c200000,
+    0x8c900000, 0x8ac00000, 0x51400008, 0x8bc00000, 0x8bd00000, 0x8e600000, 0x4e500008, 0x8bf00000,
+    0x4be00030, 0x4be00020, 0x4be00010, 0x8be00000, 0x8e500000, 0x8c000000, 0x8ca00000, 0x8a800000,
+    0x91400000, 0x90b00000, 0x50400030, 0x50400020, 0x50400010, 0x90400000, 0x50200010, 0x91100000,
+    0x91000000, 0x50200008, 0x90d00000, 0x90c00000, 0x90200000, 0x90900000, 0x90a00000, 0x49a00010,
+    0x89f00000, 0x8a000000, 0x88100000, 0x49a00008, 0x8e200000, 0x87f00000, 0x8e300000, 0x88000000,
+    0x89a00000, 0x88f00000, 0x5f000030, 0x5f000020, 0x5f000010, 0x9f000000, 0x4950001b, 0x1f000009,
+    0x08f00009, 0x09a00009, 0x49a00012, 0x08000009, 0x48000012, 0x0e300008, 0x07f00010, 0x47f00020,
+    0x47f00030, 0x0e200009, 0x4e200012, 0x08100008, 0x0a000010, 0x4a000020, 0x4a000030, 0x48100010,
+    0x09f00010, 0x10a00009, 0x50a00012, 0x10900018, 0x10200008, 0x10c00018, 0x50200028, 0x4e20001b,
+    0x4e200024, 0x50a0001b, 0x50a00024, 0x4a000040, 0x10d00009, 0x50d00012, 0x50d0001b, 0x50d00024,
+    0x11000018, 0x11100008, 0x10400008, 0x10b00010, 0x50b00020, 0x50b00030, 0x50b00040, 0x50b00050,
+    0x11400009, 0x51400012, 0x0a800008, 0x0ca00010, 0x4ca00020, 0x4ca00030, 0x4ca00040, 0x4ca00050,
+    0x4ca00060, 0x4ca00070, 0x0c000009, 0x4c000012, 0x4c00001b, 0x0e500018, 0x0be00008, 0x0bf00008,
+    0x0e600005, 0x0bd00014, 0x0bc00014, 0x8bc00000, 0x8bd00000, 0x8e600000, 0x0e600008, 0x0bd00020,
+    0x0bc00020, 0x8bc00000, 0x8bd00000, 0x0bd00010, 0x0bc00009, 0x4bc00012, 0x4bc0001b, 0x0ac00020,
+    0x8ac00000, 0x0ac00020, 0x8ac00000, 0x0ac00020, 0x8ac00000, 0x0ac00020, 0x8ac00000, 0x0ac00020,
+    0x8ac00000, 0x50400010, 0x0ac00010, 0x4ac00020, 0x4ac00030, 0x4ac00040, 0x4ac00050, 0x0c900009,
+    0x4c900012, 0x4a800010, 0x0c200010, 0x4c200020, 0x4c200030, 0x4c200040, 0x4c200050, 0x4c200060,
+    0x4c200070, 0x0c400009, 0x4c400012, 0x4c40001b, 0x0a600018, 0x0ab00008, 0x0c700008, 0x0c800005,
+    0x0cb00014, 0x0c600014, 0x8c600000, 0x8cb00000, 0x8c800000, 0x0c80000a, 0x0cb00028, 0x0c600028,
+    0x8c600000, 0x8cb00000, 0x0cb00010, 0x0c600009, 0x4c600012, 0x4c60001b, 0x50400018, 0x0c500010,
+    0x4c500020, 0x4c500030, 0x4c500040, 0x4c500050, 0x0c300009, 0x4c300012, 0x4a800018, 0x0e700010,
+    0x4e700020, 0x4e700030, 0x4e700040, 0x4e700050, 0x4e700060, 0x4e700070, 0x0ae00009, 0x4ae00012,
+    0x4ae0001b, 0x0b600018, 0x0b800008, 0x0b700008, 0x0af00005, 0x0b000014, 0x0b200014, 0x8b200000,
+    0x8b000000, 0x8af00000, 0x0af00005, 0x0b000014, 0x0b200014, 0x8b200000, 0x8b000000, 0x0b000010,
+    0x0b200009, 0x4b200012, 0x4b20001b, 0x50d0002d, 0x4a800020, 0x0b100010, 0x0b400009, 0x4b400012,
+    0x4b40001b, 0x4a800028, 0x0b500005, 0x0b300014, 0x0ba00014, 0x8ba00000, 0x8b300000, 0x0b300010,
+    0x8b500000, 0x0b50000c, 0x0ba0000d, 0x0b900030, 0x0ad00030, 0x8ad00000, 0x8b900000, 0x8b500000,
+    0x0b500020, 0x4b500040, 0x4b500060, 0x8b500000, 0x0b500020, 0x8b500000, 0x0b500020, 0x4b500040,
+    0x4b500060, 0x8b500000, 0x4b300020, 0x0b500009, 0x4b500012, 0x4b50001b, 0x4a800030, 0x0b900005,
+    0x0ad00014, 0x0e400014, 0x8e400000, 0x8ad00000, 0x8b900000, 0x0b900010, 0x0ad00020, 0x4ad00040,
+    0x4ad00060, 0x8ad00000, 0x4b900020, 0x0ad00009, 0x4ad00012, 0x4ad0001b, 0x0e400008, 0x0a100010,
+    0x4a100020, 0x4a100030, 0x4a100040, 0x0a900009, 0x0aa00008, 0x4aa00010, 0x0a200005, 0x0a300014,
+    0x0a700014, 0x8a700000, 0x8a300000, 0x0a300010, 0x8a200000, 0x4aa00018, 0x0a200005, 0x0a700014,
+    0x0f500014, 0x8f500000, 0x8a700000, 0x0a700010, 0x8a200000, 0x4aa00020, 0x0a200005, 0x0f500014,
+    0x0f600014, 0x8f600000, 0x8f500000, 0x0f500010, 0x8a200000, 0x4aa00028, 0x0a200005, 0x0f600014,
+    0x0f400014, 0x8f400000, 0x8f600000, 0x8a200000, 0x4aa00030, 0x0a200005, 0x0f600014, 0x0f400014,
+    0x8f400000, 0x8f600000, 0x0f600010, 0x8a200000, 0x4aa00038, 0x0a200005, 0x0f400014, 0x09c00014,
+    0x89c00000, 0x8f400000, 0x8a200000, 0x4aa00040, 0x0a200010, 0x4a200020, 0x4a200030, 0x4a200040,
+    0x4a200050, 0x4a200060, 0x4a200070, 0x4a200080, 0x4a200090, 0x4a2000a0, 0x0f400009, 0x09c00008,
+    0x09d00005, 0x0e900014, 0x0c100014, 0x8c100000, 0x8e900000, 0x89d00000, 0x09d00010, 0x0e900009,
+    0x4e900012, 0x4e90001b, 0x4aa00048, 0x0c100010, 0x4c100020, 0x4c100030, 0x4c100040, 0x4c100050,
+    0x4c100060, 0x4c100070, 0x4c100080, 0x4c100090, 0x4c1000a0, 0x09e00018, 0x0d100009, 0x0ce00030,
+    0x0d200098, 0x4d100012, 0x0d300030, 0x0cf00098, 0x4c1000b0, 0x0ea00009, 0x0bb00008, 0x0ed00005,
+    0x0d400014, 0x0d000014, 0x8d000000, 0x8d400000, 0x8ed00000, 0x0ed00010, 0x0d400009, 0x4d400012,
+    0x4d40001b, 0x4e300010, 0x0d000010, 0x4d000020, 0x4d000030, 0x4d000040, 0x4d000050, 0x4d000060,
+    0x4d000070, 0x4d000080, 0x4d000090, 0x4d0000a0, 0x4d0000b0, 0x4d0000c0, 0x0ee00050, 0x0eb00014,
+    0x4d0000d0, 0x0d600009, 0x4d600012, 0x4d60001b, 0x0d500018, 0x0ec00008, 0x4d600024, 0x8ee00000,
+    0x8eb00000, 0x0eb00290, 0x0ee000a4, 0x0cc000a4, 0x8cc00000, 0x4e400010, 0x0cc00010, 0x4cc00020,
+    0x4cc00030, 0x4cc00040, 0x0e800009, 0x0d700008, 0x0cd00005, 0x05900014, 0x07e00014, 0x87e00000,
+    0x85900000, 0x05900010, 0x8cd00000, 0x4d700010, 0x0cd00005, 0x07e00014, 0x0f300014, 0x8f300000,
+    0x87e00000, 0x8cd00000, 0x0cd00010, 0x4d700018, 0x07e00010, 0x47e00020, 0x47e00030, 0x47e00040,
+    0x47e00050, 0x47e00060, 0x47e00070, 0x47e00080, 0x47e00090, 0x0f300008, 0x05800010, 0x0a400005,
+    0x10100014, 0x0fd00014, 0x8fd00000, 0x90100000, 0x45800020, 0x10100009, 0x8a400000, 0x0a400001,
+    0x0fd00004, 0x0fc00004, 0x8fc00000, 0x8fd00000, 0x0fd00018, 0x0fc00008, 0x0a500018, 0x4fc00028,
+    0x10500020, 0x50500040, 0x50500060, 0x90500000, 0x4a400001, 0x10500004, 0x0f000004, 0x8f000000,
+    0x90500000, 0x4a400001, 0x10500004, 0x0f000004, 0x8f000000, 0x90500000, 0x4a400001, 0x10500004,
+    0x0f000004, 0x8f000000, 0x90500000, 0x4a400001, 0x10500004, 0x0f000004, 0x8f000000, 0x90500000,
+    0x50100012, 0x4a400001, 0x10500004, 0x0f000004, 0x8f000000, 0x90500000, 0x47e000a0, 0x10500009,
+    0x0f00000a, 0x0f100018, 0x0fb00008, 0x4d700020, 0x10000005, 0x0fa00014, 0x0fe00014, 0x8fe00000,
+    0x8fa00000, 0x90000000, 0x10000010, 0x4d700028, 0x0fa00010, 0x4fa00020, 0x4fa00030, 0x4fa00040,
+    0x4fa00050, 0x4fa00060, 0x4fa00070, 0x4fa00080, 0x4fa00090, 0x0fe00008, 0x0ff00010, 0x0f900005,
+    0x0f700014, 0x0f800014, 0x8f800000, 0x8f700000, 0x4ff00020, 0x0f700009, 0x8f900000, 0x0f900001,
+    0x0f800004, 0x0f200004, 0x8f200000, 0x8f800000, 0x0f800018, 0x0f200008, 0x10800018, 0x4f200028,
+    0x4f900001, 0x10600004, 0x10e00004, 0x90e00000, 0x90600000, 0x4f900001, 0x10600004, 0x10e00004,
+    0x90e00000, 0x90600000, 0x4f900001, 0x10600004, 0x10e00004, 0x90e00000, 0x90600000, 0x4f900001,
+    0x10600004, 0x10e00004, 0x90e00000, 0x90600000, 0x4f700012, 0x4f900001, 0x10600004, 0x10e00004,
+    0x90e00000, 0x90600000, 0x4fa000a0, 0x10600009, 0x10e00001, 0x1070000e, 0x11300018, 0x10f00008,
+    0x4d700030, 0x11500005, 0x11200014, 0x04b00014, 0x84b00000, 0x91200000, 0x91500000, 0x11500010,
+    0x4d700038, 0x11200010, 0x51200020, 0x51200030, 0x51200040, 0x51200050, 0x51200060, 0x51200070,
+    0x51200080, 0x51200090, 0x4e300018, 0x04b00010, 0x44b00020, 0x44b00030, 0x44b00040, 0x44b00050,
+    0x44b00060, 0x44b00070, 0x44b00080, 0x44b00090, 0x22100008, 0x22300005, 0x12300014, 0x12900014,
+    0x92900000, 0x92300000, 0x4d700040, 0x12300005, 0x12900014, 0x16100014, 0x96100000, 0x92900000,
+    0x92300000, 0x12300010, 0x4d700048, 0x12900010, 0x52900020, 0x52900030, 0x52900040, 0x52900050,
+    0x52900060, 0x52900070, 0x52900080, 0x52900090, 0x16100008, 0x10300010, 0x12e00005, 0x15c00014,
+    0x12800014, 0x92800000, 0x95c00000, 0x50300020, 0x15c00009, 0x92e00000, 0x12e00001, 0x12800004,
+    0x15e00004, 0x95e00000, 0x92800000, 0x12800018, 0x15e00008, 0x15b00018, 0x55e00028, 0x52e00001,
+    0x15f00004, 0x16200004, 0x96200000, 0x95f00000, 0x52e00001, 0x15f00004, 0x16200004, 0x96200000,
+    0x95f00000, 0x52e00001, 0x15f00004, 0x16200004, 0x96200000, 0x95f00000, 0x52e00001, 0x15f00004,
+    0x16200004, 0x96200000, 0x95f00000, 0x55c00012, 0x52e00001, 0x15f00004, 0x16200004, 0x96200000,
+    0x95f00000, 0x529000a0, 0x15f00009, 0x16200018, 0x16000008, 0x4e400018, 0x16300010, 0x56300020,
+    0x56300030, 0x16400008, 0x16700005, 0x16600014, 0x16800014, 0x96800000, 0x96600000, 0x16600010,
+    0x96700000, 0x56400010, 0x16700005, 0x16800014, 0x15d00014, 0x95d00000, 0x96800000, 0x96700000,
+    0x16700010, 0x56400018, 0x16800010, 0x56800020, 0x56800030, 0x56800040, 0x56800050, 0x56800060,
+    0x56800070, 0x56800080, 0x56800090, 0x568000a0, 0x568000b0, 0x15d00009, 0x14100018, 0x17700008,
+    0x56400020, 0x11800005, 0x11900014, 0x11e00014, 0x91e00000, 0x91900000, 0x91800000, 0x11800010,
+    0x56400028, 0x11900010, 0x51900020, 0x51900030, 0x51900040, 0x51900050, 0x51900060, 0x51900070,
+    0x51900080, 0x51900090, 0x519000a0, 0x519000b0, 0x519000c0, 0x56400030, 0x11e00005, 0x13000014,
+    0x08e00014, 0x88e00000, 0x93000000, 0x91e00000, 0x11e00010, 0x56400038, 0x13000010, 0x53000020,
+    0x53000030, 0x53000040, 0x53000050, 0x53000060, 0x53000070, 0x53000080, 0x53000090, 0x530000a0,
+    0x530000b0, 0x530000c0, 0x5140001b, 0x51400024, 0x5140002d, 0x4a900012, 0x4a90001b, 0x4a900024,
+    0x4a90002d, 0x4a900036, 0x4a90003f, 0x4a900048, 0x4a900051, 0x4a90005a, 0x08e00010, 0x12f00009,
+    0x52f00012, 0x52f0001b, 0x52f00024, 0x52f0002d, 0x52f00036, 0x4a300020, 0x12a00009, 0x52a00012,
+    0x52a0001b, 0x52a00024, 0x52a0002d, 0x52a00036, 0x4a700020, 0x12b00009, 0x52b00012, 0x52b0001b,
+    0x52b00024, 0x52b0002d, 0x52b00036, 0x4f500020, 0x13200009, 0x53200012, 0x5320001b, 0x53200024,
+    0x5320002d, 0x53200036, 0x12d00010, 0x13100009, 0x53100012, 0x5310001b, 0x53100024, 0x5310002d,
+    0x53100036, 0x4f600020, 0x12c00009, 0x52c00012, 0x52c0001b, 0x52c00024, 0x52c0002d, 0x52c00036,
+    0x13300010, 0x13400009, 0x53400012, 0x5340001b, 0x53400024, 0x5340002d, 0x53400036, 0x4f400012,
+    0x4f40001b, 0x4f400024, 0x4f40002d, 0x4f400036, 0x4f40003f, 0x4ea00012, 0x4ea0001b, 0x4ea00024,
+    0x4ea0002d, 0x4ea00036, 0x4ea0003f, 0x4e800012, 0x4e80001b, 0x4e800024, 0x4e80002d, 0x4e800036,
+    0x4e80003f, 0x4e800048, 0x4e800051, 0x4e80005a, 0x45900020, 0x11700009, 0x51700012, 0x5170001b,
+    0x51700024, 0x5170002d, 0x51700036, 0x50500012, 0x5050001b, 0x50500024, 0x5050002d, 0x50500036,
+    0x5050003f, 0x4cd00020, 0x11600009, 0x51600012, 0x5160001b, 0x51600024, 0x5160002d, 0x51600036,
+    0x50600012, 0x5060001b, 0x50600024, 0x5060002d, 0x50600036, 0x5060003f, 0x50000020, 0x13a00009,
+    0x53a00012, 0x53a0001b, 0x53a00024, 0x53a0002d, 0x53a00036, 0x55f00012, 0x55f0001b, 0x55f00024,
+    0x55f0002d, 0x55f00036, 0x55f0003f, 0x52300020, 0x13800009, 0x53800012, 0x5380001b, 0x53800024,
+    0x5380002d, 0x53800036, 0x512000a0, 0x17600009, 0x57600012, 0x5760001b, 0x57600024, 0x5760002d,
+    0x57600036, 0x51500020, 0x13900009, 0x53900012, 0x5390001b, 0x53900024, 0x5390002d, 0x53900036,
+    0x56300040, 0x17800009, 0x57800012, 0x5780001b, 0x57800024, 0x5780002d, 0x57800036, 0x5780003f,
+    0x57800048, 0x57800051, 0x56600020, 0x16c00009, 0x56c00012, 0x56c0001b, 0x56c00024, 0x56c0002d,
+    0x56c00036, 0x55d00012, 0x55d0001b, 0x55d00024, 0x55d0002d, 0x55d00036, 0x55d0003f, 0x56700020,
+    0x17900009, 0x57900012, 0x5790001b, 0x57900024, 0x5790002d, 0x57900036, 0x530000d0, 0x16d00009,
+    0x56d00012, 0x56d0001b, 0x56d00024, 0x56d0002d, 0x56d00036, 0x51e00020, 0x16b00009, 0x56b00012,
+    0x56b0001b, 0x56b00024, 0x56b0002d, 0x56b00036, 0x519000d0, 0x16e00009, 0x56e00012, 0x56e0001b,
+    0x56e00024, 0x56e0002d, 0x56e00036, 0x51800020, 0x17000009, 0x57000012, 0x5700001b, 0x57000024,
+    0x5700002d, 0x57000036, 0x4c90001b, 0x4c900024, 0x17200008, 0x17100010, 0x57100020, 0x57100030,
+    0x57100040, 0x16f00009, 0x56f00012, 0x56f0001b, 0x56f00024, 0x56f0002d, 0x56f00036, 0x56f0003f,
+    0x56f00048, 0x17500008, 0x17400005, 0x17300014, 0x16a00014, 0x96a00000, 0x97300000, 0x17300010,
+    0x97400000, 0x57300020, 0x17400009, 0x57400012, 0x5740001b, 0x57400024, 0x5740002d, 0x57400036,
+    0x57500010, 0x16a00010, 0x56a00020, 0x56a00030, 0x56a00040, 0x13700009, 0x53700012, 0x5370001b,
+    0x53700024, 0x5370002d, 0x53700036, 0x57500018, 0x13500010, 0x53500020, 0x53500030, 0x53500020,
+    0x53500030, 0x11a00009, 0x51a00012, 0x51a0001b, 0x51a00024, 0x51a0002d, 0x51a00036, 0x51a0003f,
+    0x51a00048, 0x51a00051, 0x16500008, 0x13c00010, 0x53c00020, 0x53c00030, 0x53c00040, 0x53c00050,
+    0x53c00060, 0x53c00070, 0x53c00080, 0x53c00090, 0x11b00009, 0x51b00012, 0x51b0001b, 0x51b00024,
+    0x51b0002d, 0x51b00036, 0x51b0003f, 0x13b00018, 0x14300008, 0x51b00048, 0x51b00051, 0x56500010,
+    0x13e00010, 0x53e00020, 0x53e00030, 0x53e00040, 0x14200009, 0x54200012, 0x5420001b, 0x54200024,
+    0x5420002d, 0x54200036, 0x5420003f, 0x54200048, 0x54200051, 0x5420005a, 0x5370003f, 0x53700048,
+    0x13d00030, 0x14500030, 0x57200010, 0x08c00010, 0x48c00020, 0x48c00030, 0x48c00040, 0x14400009,
+    0x54400012, 0x5440001b, 0x54400024, 0x5440002d, 0x54400036, 0x5440003f, 0x54400048, 0x13f00008,
+    0x14000005, 0x14700014, 0x14600014, 0x94600000, 0x94700000, 0x14700010, 0x94000000, 0x54700020,
+    0x14000009, 0x54000012, 0x5400001b, 0x54000024, 0x5400002d, 0x54000036, 0x53f00010, 0x14600010,
+    0x54600020, 0x54600030, 0x54600040, 0x18d00009, 0x58d00012, 0x58d0001b, 0x58d00024, 0x58d0002d,
+    0x58d00036, 0x53f00018, 0x18f00010, 0x58f00020, 0x58f00030, 0x58f00020, 0x58f00030, 0x19300009,
+    0x59300012, 0x5930001b, 0x59300024, 0x5930002d, 0x59300036, 0x5930003f, 0x59300048, 0x59300051,
+    0x13600008, 0x15400010, 0x55400020, 0x55400030, 0x55400040, 0x55400050, 0x55400060, 0x55400070,
+    0x55400080, 0x55400090, 0x17c00009, 0x57c00012, 0x57c0001b, 0x57c00024, 0x57c0002d, 0x57c00036,
+    0x57c0003f, 0x14c00018, 0x17d00008, 0x57c00048, 0x57c00051, 0x53600010, 0x17f00010, 0x57f00020,
+    0x57f00030, 0x57f00040, 0x17e00009, 0x57e00012, 0x57e0001b, 0x57e00024, 0x57e0002d, 0x57e00036,
+    0x57e0003f, 0x57e00048, 0x57e00051, 0x57e0005a, 0x58d0003f, 0x58d00048, 0x18000030, 0x18200030,
+    0x18100030, 0x18300030, 0x18500014, 0x18400014, 0x18600018, 0x18c00018, 0x98600000, 0x98500000,
+    0x98c00000, 0x98400000, 0x1840001c, 0x18c0001c, 0x18500008, 0x18600008, 0x47e000b0, 0x15500018,
+    0x15000009, 0x14f00030, 0x09000098, 0x4a400001, 0x18a00004, 0x19200004, 0x99200000, 0x98a00000,
+    0x18a00098, 0x4fa000b0, 0x19200018, 0x18b00009, 0x19100030, 0x18800098, 0x4f900001, 0x18900004,
+    0x18700004, 0x98700000, 0x98900000, 0x18900098, 0x529000b0, 0x18700018, 0x17a00009, 0x14d00030,
+    0x17b00098, 0x52e00001, 0x18e00004, 0x14b00004, 0x94b00000, 0x98e00000, 0x18e00098, 0x98500000,
+    0x98400000, 0x98600000, 0x98c00000, 0x18c0001c, 0x1860001c, 0x18400008, 0x18500008, 0x98400000,
+    0x98c00000, 0x98500000, 0x98600000, 0x18600008, 0x18500008, 0x18c00008, 0x18400008, 0x98c00000,
+    0x98600000, 0x98400000, 0x98500000, 0x1850000c, 0x18400008, 0x18600008, 0x98500000, 0x18500008,
+    0x18c00004, 0x14b00004, 0x98500000, 0x98c00000, 0x98400000, 0x94b00000, 0x98600000, 0x1860000c,
+    0x14b0000c, 0x18400008, 0x18c00008, 0x98400000, 0x98600000, 0x98c00000, 0x94b00000, 0x14b0000c,
+    0x18c00008, 0x18600008, 0x94b00000, 0x14b00008, 0x18400004, 0x18500004, 0x94b00000, 0x98400000,
+    0x98c00000, 0x98500000, 0x98600000, 0x1860000c, 0x1850000c, 0x18c00008, 0x18400008, 0x98c00000,
+    0x98600000, 0x98400000, 0x98500000, 0x18500020, 0x98500000, 0x18500020, 0x98500000, 0x18500014,
+    0x18400014, 0x18600018, 0x18c00018, 0x98600000, 0x98500000, 0x98c00000, 0x98400000, 0x4a400001,
+    0x18400004, 0x18c00004, 0x98c00000, 0x98400000, 0x4f900001, 0x18400004, 0x18c00004, 0x98c00000,
+    0x98400000, 0x52e00001, 0x18400004, 0x18c00004, 0x98c00000, 0x98400000, 0x1840001c, 0x18c0001c,
+    0x18500008, 0x18600008, 0x98a00000, 0x98900000, 0x98e00000, 0x98500000, 0x98400000, 0x98600000,
+    0x98c00000, 0x18c0001c, 0x1860001c, 0x18400008, 0x18500008, 0x98400000, 0x98c00000, 0x98500000,
+    0x98600000, 0x18600008, 0x18500008, 0x18c00008, 0x18400008, 0x98c00000, 0x98600000, 0x98400000,
+    0x98500000, 0x1850000c, 0x18400008, 0x18600008, 0x98500000, 0x18500008, 0x18c00004, 0x18e00004,
+    0x98500000, 0x98c00000, 0x98400000, 0x98e00000, 0x98600000, 0x1860000c, 0x18e0000c, 0x18400008,
+    0x18c00008, 0x98400000, 0x98600000, 0x98c00000, 0x98e00000, 0x18e0000c, 0x18c00008, 0x18600008,
+    0x98e00000, 0x18e00008, 0x18400004, 0x18500004, 0x98e00000, 0x98400000, 0x98c00000, 0x98500000,
+    0x98600000, 0x1860000c, 0x1850000c, 0x18c00008, 0x18400008, 0x98c00000, 0x98600000, 0x98400000,
+    0x98500000, 0x18500020, 0x98500000, 0x18500020, 0x98500000, 0x18500014, 0x18400014, 0x18600018,
+    0x18c00018, 0x98600000, 0x98500000, 0x98c00000, 0x98400000, 0x4a400001, 0x18400004, 0x18c00004,
+    0x98c00000, 0x98400000, 0x4f900001, 0x18400004, 0x18c00004, 0x98c00000, 0x98400000, 0x52e00001,
+    0x18400004, 0x18c00004, 0x98c00000, 0x98400000, 0x1840001c, 0x18c0001c, 0x18500008, 0x18600008,
+    0x98500000, 0x98400000, 0x98600000, 0x98c00000, 0x18c00008, 0x18600008, 0x18400008, 0x18500008,
+    0x98400000, 0x98c00000, 0x98500000, 0x98600000, 0x1860000c, 0x18500008, 0x18c00008, 0x98600000,
+    0x18600008, 0x18400004, 0x18e00004, 0x98600000, 0x98400000, 0x98500000, 0x98e00000, 0x98c00000,
+    0x18c0000c, 0x18e0000c, 0x18500008, 0x18400008, 0x98500000, 0x98c00000, 0x98400000, 0x98e00000,
+    0x18e0000c, 0x18400008, 0x18c00008, 0x98e00000, 0x18e00008, 0x18500004, 0x18600004, 0x98e00000,
+    0x98500000, 0x98400000, 0x98600000, 0x98c00000, 0x18c0000c, 0x1860000c, 0x18400008, 0x18500008,
+    0x98400000, 0x98c00000, 0x98500000, 0x98600000, 0x18600014, 0x18500014, 0x18c00018, 0x18400018,
+    0x98c00000, 0x98600000, 0x98400000, 0x98500000, 0x57200018, 0x18500010, 0x58500020, 0x58500030,
+    0x58500040, 0x18400009, 0x58400012, 0x18600008, 0x18c00005, 0x18e00014, 0x18900014, 0x98900000,
+    0x98e00000, 0x18e00010, 0x98c00000, 0x58600010, 0x18c00010, 0x58c00020, 0x58c00030, 0x58c00040,
+    0x18900009, 0x58600018, 0x18a00010, 0x58a00020, 0x58a00030, 0x58a00040, 0x14b00009, 0x54b00012,
+    0x58a00030, 0x58a00040, 0x54b0001b, 0x58600020, 0x14e00005, 0x15600014, 0x19a00014, 0x99a00000,
+    0x95600000, 0x94e00000, 0x58600028, 0x14e00010, 0x54e00020, 0x54e00030, 0x54e00040, 0x15600009,
+    0x55600012, 0x54e00030, 0x54e00040, 0x5560001b, 0x58600030, 0x19a00005, 0x19b00014, 0x1a800014,
+    0x9a800000, 0x99b00000, 0x99a00000, 0x58600038, 0x19a00010, 0x59a00020, 0x59a00030, 0x59a00040,
+    0x19b00009, 0x59b00012, 0x59a00030, 0x59a00040, 0x59b0001b, 0x58600040, 0x1a800005, 0x15100014,
+    0x15800014, 0x95800000, 0x95100000, 0x9a800000, 0x5840001b, 0x58400024, 0x5840002d, 0x58e00020,
+    0x1a800009, 0x5a800012, 0x5a80001b, 0x5a800024, 0x5a80002d, 0x5a800036, 0x58900012, 0x5890001b,
+    0x58900024, 0x5890002d, 0x58900036, 0x5890003f, 0x54b00024, 0x54b0002d, 0x54b00036, 0x54b0003f,
+    0x54b00048, 0x54b00051, 0x55600024, 0x5560002d, 0x55600036, 0x5560003f, 0x55600048, 0x55600051,
+    0x59b00024, 0x59b0002d, 0x59b00036, 0x59b0003f, 0x59b00048, 0x59b00051, 0x15100010, 0x15800009,
+    0x55800012, 0x5580001b, 0x55800024, 0x5580002d, 0x55800036, 0x15300010, 0x15700009, 0x55700012,
+    0x5570001b, 0x55700024, 0x5570002d, 0x55700036, 0x15200010, 0x15900009, 0x55900012, 0x5590001b,
+    0x55900024, 0x5590002d, 0x55900036, 0x57200020, 0x15a00010, 0x55a00020, 0x55a00030, 0x55a00040,
+    0x14a00009, 0x54a00012, 0x14800008, 0x14900005, 0x0ef00014, 0x06300014, 0x86300000, 0x8ef00000,
+    0x0ef00010, 0x94900000, 0x54800010, 0x14900010, 0x54900020, 0x54900030, 0x54900040, 0x06300009,
+    0x54800018, 0x06400010, 0x46400020, 0x46400030, 0x46400040, 0x19900009, 0x59900012, 0x46400030,
+    0x46400040, 0x5990001b, 0x54800020, 0x1a900005, 0x19500014, 0x1b300014, 0x9b300000, 0x99500000,
+    0x9a900000, 0x54800028, 0x1a900010, 0x5a900020, 0x5a900030, 0x5a900040, 0x19500009, 0x59500012,
+    0x5a900030, 0x5a900040, 0x5950001b, 0x54800030, 0x1b300005, 0x19e00014, 0x1aa00014, 0x9aa00000,
+    0x99e00000, 0x9b300000, 0x54800038, 0x1b300010, 0x5b300020, 0x5b300030, 0x5b300040, 0x19e00009,
+    0x59e00012, 0x5b300030, 0x5b300040, 0x59e0001b, 0x54800040, 0x1aa00005, 0x19800014, 0x19c00014,
+    0x99c00000, 0x99800000, 0x9aa00000, 0x54a0001b, 0x54a00024, 0x54a0002d, 0x4ef00020, 0x1aa00009,
+    0x5aa00012, 0x5aa0001b, 0x5aa00024, 0x5aa0002d, 0x5aa00036, 0x46300012, 0x4630001b, 0x46300024,
+    0x4630002d, 0x46300036, 0x4630003f, 0x59900024, 0x5990002d, 0x59900036, 0x5990003f, 0x59900048,
+    0x59900051, 0x59500024, 0x5950002d, 0x59500036, 0x5950003f, 0x59500048, 0x59500051, 0x59e00024,
+    0x59e0002d, 0x59e00036, 0x59e0003f, 0x59e00048, 0x59e00051, 0x19800010, 0x19c00009, 0x59c00012,
+    0x59c0001b, 0x59c00024, 0x59c0002d, 0x59c00036, 0x19d00010, 0x19f00009, 0x59f00012, 0x59f0001b,
+    0x59f00024, 0x59f0002d, 0x59f00036, 0x1a200010, 0x1a000009, 0x5a000012, 0x5a00001b, 0x5a000024,
+    0x5a00002d, 0x5a000036, 0x57200028, 0x1a100010, 0x5a100020, 0x5a100030, 0x5a100040, 0x1a300009,
+    0x5a300012, 0x1a400008, 0x1a600005, 0x1a700014, 0x1a500014, 0x9a500000, 0x9a700000, 0x1a700010,
+    0x9a600000, 0x5a400010, 0x1a600010, 0x5a600020, 0x5a600030, 0x5a600040, 0x1a500009, 0x5a400018,
+    0x19700010, 0x59700020, 0x59700030, 0x59700040, 0x19600009, 0x59600012, 0x59700030, 0x59700040,
+    0x5960001b, 0x5a400020, 0x1c100005, 0x1c300014, 0x1c000014, 0x9c000000, 0x9c300000, 0x9c100000,
+    0x5a400028, 0x1c100010, 0x5c100020, 0x5c100030, 0x5c100040, 0x1c300009, 0x5c300012, 0x5c100030,
+    0x5c100040, 0x5c30001b, 0x5a400030, 0x1c000005, 0x1af00014, 0x1b200014, 0x9b200000, 0x9af00000,
+    0x9c000000, 0x5a400038, 0x1c000010, 0x5c000020, 0x5c000030, 0x5c000040, 0x1af00009, 0x5af00012,
+    0x5c000030, 0x5c000040, 0x5af0001b, 0x5a400040, 0x1b200005, 0x1b400014, 0x1b500014, 0x9b500000,
+    0x9b400000, 0x9b200000, 0x5a30001b, 0x5a300024, 0x5a30002d, 0x5a700020, 0x1b200009, 0x5b200012,
+    0x5b20001b, 0x5b200024, 0x5b20002d, 0x5b200036, 0x5a500012, 0x5a50001b, 0x5a500024, 0x5a50002d,
+    0x5a500036, 0x5a50003f, 0x59600024, 0x5960002d, 0x59600036, 0x5960003f, 0x59600048, 0x59600051,
+    0x5c300024, 0x5c30002d, 0x5c300036, 0x5c30003f, 0x5c300048, 0x5c300051, 0x5af00024, 0x5af0002d,
+    0x5af00036, 0x5af0003f, 0x5af00048, 0x5af00051, 0x1b400010, 0x1b500009, 0x5b500012, 0x5b50001b,
+    0x5b500024, 0x5b50002d, 0x5b500036, 0x1b700010, 0x1b900009, 0x5b900012, 0x5b90001b, 0x5b900024,
+    0x5b90002d, 0x5b900036, 0x1b600010, 0x1b800009, 0x5b800012, 0x5b80001b, 0x5b800024, 0x5b80002d,
+    0x5b800036, 0x1b00000c, 0x1b100008, 0x1ae00008, 0x9b000000, 0x1b000008, 0x1bd00004, 0x1be00004,
+    0x9b000000, 0x9bd00000, 0x9b100000, 0x9be00000, 0x9ae00000, 0x1ae00014, 0x1be00014, 0x1b100008,
+    0x1bd00008, 0x9b100000, 0x9ae00000, 0x9bd00000, 0x9be00000, 0x1be00014, 0x1bd00014, 0x1ae00008,
+    0x1b100008, 0x9ae00000, 0x9be00000, 0x9b100000, 0x9bd00000, 0x1bd00014, 0x1b100014, 0x1be00008,
+    0x1ae00008, 0x9be00000, 0x9bd00000, 0x9ae00000, 0x9b100000, 0x1b100020, 0x9b100000, 0x1b100020,
+    0x9b100000, 0x1b100020, 0x5b100040, 0x5b100060, 0x9b100000, 0x1b100014, 0x1ae00014, 0x1bd00008,
+    0x1be00008, 0x9bd00000, 0x9b100000, 0x9be00000, 0x9ae00000, 0x1ae00014, 0x1be00014, 0x1b100008,
+    0x1bd00008, 0x9b100000, 0x9ae00000, 0x9bd00000, 0x9be00000, 0x1be00014, 0x1bd00014, 0x1ae00008,
+    0x1b100008, 0x9ae00000, 0x9be00000, 0x9b100000, 0x9bd00000, 0x1bd00020, 0x9bd00000, 0x1bd00020,
+    0x9bd00000, 0x1bd00020, 0x5bd00040, 0x5bd00060, 0x9bd00000, 0x1bd00014, 0x1b100014, 0x1be00008,
+    0x1ae00008, 0x9be00000, 0x9bd00000, 0x9ae00000, 0x9b100000, 0x1b100014, 0x1ae00014, 0x1bd00008,
+    0x1be00008, 0x9bd00000, 0x9b100000, 0x9be00000, 0x9ae00000, 0x1ae00014, 0x1be00014, 0x1b100008,
+    0x1bd00008, 0x9b100000, 0x9ae00000, 0x9bd00000, 0x9be00000, 0x1be00020, 0x9be00000, 0x1be00020,
+    0x9be00000, 0x1be00020, 0x5be00040, 0x5be00060, 0x9be00000, 0x1be00014, 0x1bd00014, 0x1ae00008,
+    0x1b100008, 0x9ae00000, 0x9be00000, 0x9b100000, 0x9bd00000, 0x1bd00014, 0x1b100014, 0x1be00008,
+    0x1ae00008, 0x9be00000, 0x9bd00000, 0x9ae00000, 0x9b100000, 0x1b100014, 0x1ae00014, 0x1bd00008,
+    0x1be00008, 0x9bd00000, 0x9b100000, 0x9be00000, 0x9ae00000, 0x58900048, 0x46300048, 0x5a500048,
+    0x58900051, 0x5890005a, 0x58900063, 0x5890006c, 0x1ae00008, 0x1be00010, 0x5be00020, 0x5be00030,
+    0x5be00040, 0x5be00030, 0x5be00020, 0x5be00030, 0x1b100009, 0x5b100012, 0x5b10001b, 0x5be00040,
+    0x1bd00009, 0x5bd00012, 0x1b000098, 0x1bf0000e, 0x1c20000f, 0x1d300038, 0x1d500038, 0x9d500000,
+    0x9d300000, 0x9bf00000, 0x5ae00010, 0x1bf00010, 0x5bf00020, 0x5bf00030, 0x5bf00040, 0x5bf00030,
+    0x5bf00040, 0x1d300009, 0x5d300012, 0x5d30001b, 0x5d300024, 0x5d30002d, 0x5d300036, 0x5d30003f,
+    0x5bf00050, 0x1d500009, 0x5d500012, 0x5d300048, 0x5d300051, 0x5d30005a, 0x1c600098, 0x9c200000,
+    0x1c20000e, 0x1c40000f, 0x1bc00038, 0x1ba00038, 0x9ba00000, 0x9bc00000, 0x9c200000, 0x5ae00018,
+    0x1c200010, 0x5c200020, 0x5c200030, 0x5c200040, 0x5c200030, 0x5c200040, 0x1bc00009, 0x5bc00012,
+    0x5bc0001b, 0x5bc00024, 0x5bc0002d, 0x5bc00036, 0x5bc0003f, 0x5c200050, 0x1ba00009, 0x5ba00012,
+    0x5bc00048, 0x5bc00051, 0x5bc0005a, 0x1bb00098, 0x9c400000, 0x1c40000e, 0x1c90000f, 0x1cb00038,
+    0x1c800038, 0x9c800000, 0x9cb00000, 0x9c400000, 0x54900050, 0x1c400009, 0x1cb00008, 0x1c800010,
+    0x5c800020, 0x5c800030, 0x5c800040, 0x5c800050, 0x1ca00009, 0x5ca00012, 0x5ca0001b, 0x5ca00024,
+    0x5ca0002d, 0x5ca00036, 0x5c800060, 0x1cc00009, 0x5ca0003f, 0x5c800070, 0x1cd00009, 0x5cd00012,
+    0x5cd0001b, 0x5ca00048, 0x5ca00051, 0x5ca0005a, 0x5cb00010, 0x1cf00010, 0x5cf00020, 0x5cf00030,
+    0x5cf00040, 0x5cf00050, 0x1c700009, 0x5c700012, 0x5c70001b, 0x5c700024, 0x5c70002d, 0x5c700036,
+    0x5c70003f, 0x5cf00060, 0x1ce00009, 0x5cf00070, 0x1c500009, 0x5c500012, 0x5c50001b, 0x5c700048,
+    0x5c700051, 0x5c70005a, 0x5cb00018, 0x1d400010, 0x5d400020, 0x5d400030, 0x5d400040, 0x5d400050,
+    0x1dd00009, 0x5dd00012, 0x5dd0001b, 0x5d400060, 0x1db00009, 0x5d400070, 0x1e200009, 0x5e200012,
+    0x5e20001b, 0x5dd00024, 0x5dd0002d, 0x5dd00036, 0x1d600048, 0x1d800018, 0x1da00008, 0x5a600050,
+    0x1d700009, 0x5a600060, 0x1d900009, 0x1d100009, 0x5d100012, 0x1d200009, 0x5d200012, 0x1d000009,
+    0x5d000012, 0x1de00009, 0x5de00012, 0x1df00009, 0x5df00012, 0x1e100009, 0x5e100012, 0x1e300009,
+    0x5e300012, 0x1e000009, 0x5e000012, 0x1e500009, 0x5e500012, 0x1e400018, 0x06d00008, 0x05000058,
+    0x1e600058, 0x1dc00008, 0x1ad00014, 0x1ab00014, 0x1ac00008, 0x1ea00008, 0x9ac00000, 0x9ad00000,
+    0x9ea00000, 0x9ab00000, 0x1ab00014, 0x1ea00014, 0x1ad00008, 0x1ac00008, 0x9ad00000, 0x9ab00000,
+    0x9ac00000, 0x9ea00000, 0x1ea00014, 0x1ac00014, 0x1ab00008, 0x1ad00008, 0x9ab00000, 0x9ea00000,
+    0x9ad00000, 0x9ac00000, 0x1ac00020, 0x9ac00000, 0x1ac00020, 0x9ac00000, 0x1ac00020, 0x5ac00040,
+    0x5ac00060, 0x9ac00000, 0x1ac00014, 0x1ad00014, 0x1ea00008, 0x1ab00008, 0x9ea00000, 0x9ac00000,
+    0x9ab00000, 0x9ad00000, 0x1ad00014, 0x1ab00014, 0x1ac00008, 0x1ea00008, 0x9ac00000, 0x9ad00000,
+    0x9ea00000, 0x9ab00000, 0x1ab00014, 0x1ea00014, 0x1ad00008, 0x1ac00008, 0x9ad00000, 0x9ab00000,
+    0x9ac00000, 0x9ea00000, 0x1ea00010, 0x1ac00009, 0x5ac00012, 0x5ac0001b, 0x5dc00010, 0x1ab00005,
+    0x1ad00014, 0x1eb00014, 0x9eb00000, 0x9ad00000, 0x1ad00010, 0x9ab00000, 0x5dc00018, 0x1ab00005,
+    0x1eb00014, 0x1e900014, 0x9e900000, 0x9eb00000, 0x9ab00000, 0x1ab00005, 0x1eb00014, 0x1e900014,
+    0x9e900000, 0x9eb00000, 0x1eb00098, 0x1e900003, 0x1ec00004, 0x1f80000c, 0x1f10000c, 0x9f100000,
+    0x9f800000, 0x9e900000, 0x5ad00020, 0x1e900009, 0x5e900012, 0x5e90001b, 0x1f800010, 0x1f100009,
+    0x5f100012, 0x5f10001b, 0x20100018, 0x46d00028, 0x4c30001b, 0x4c300024, 0x1e700008, 0x1e800010,
+    0x5e800020, 0x5e800030, 0x5e800040, 0x19400009, 0x59400012, 0x5940001b, 0x06e00008, 0x21200005,
+    0x21700014, 0x20d00014, 0xa0d00000, 0xa1700000, 0x21700010, 0xa1200000, 0x46e00010, 0x21200005,
+    0x20d00014, 0x05700014, 0x85700000, 0xa0d00000, 0x20d00010, 0xa1200000, 0x60d00020, 0x46e00018,
+    0x21200005, 0x05700014, 0x04f00014, 0x84f00000, 0x85700000, 0x05700010, 0xa1200000, 0x46e00020,
+    0x21200005, 0x04f00014, 0x20800014, 0xa0800000, 0x84f00000, 0xa1200000, 0x21200019, 0x04f0005c,
+    0x2080005c, 0xa0800000, 0x84f00000, 0x04f00010, 0x20800009, 0x46e00028, 0x20700010, 0x60700020,
+    0x60700030, 0x60700040, 0x60700050, 0x60700060, 0x60700070, 0x60700080, 0x20600018, 0x20b00008,
+    0x20500030, 0x20c0001c, 0x20900030, 0x20a0001c, 0x20f00030, 0x20e0001c, 0x60700090, 0x21000009,
+    0x61000012, 0x6100001b, 0x59400024, 0x5940002d, 0x59400036, 0x61700020, 0x21300009, 0x61300012,
+    0x6130001b, 0x61300024, 0x6130002d, 0x61300036, 0x60d00030, 0x21400009, 0x61400012, 0x6140001b,
+    0x61400024, 0x6140002d, 0x61400036, 0x45700020, 0x22200009, 0x62200012, 0x6220001b, 0x62200024,
+    0x6220002d, 0x62200036, 0x60800012, 0x6080001b, 0x60800024, 0x6080002d, 0x60800036, 0x6080003f,
+    0x61000024, 0x6100002d, 0x61000036, 0x6100003f, 0x61000048, 0x61000051, 0x5e700010, 0x22500010,
+    0x62500020, 0x62500030, 0x62500040, 0x20300009, 0x60300012, 0x6030001b, 0x60300024, 0x6030002d,
+    0x21100008, 0x21800005, 0x21500014, 0x21600014, 0xa1600000, 0xa1500000, 0x21500010, 0xa1800000,
+    0x61100010, 0x21800010, 0x61800020, 0x61800030, 0x61800020, 0x61800010, 0xa1800000, 0x21800010,
+    0x21600009, 0x61600012, 0x6160001b, 0x61600024, 0x6160002d, 0x21b00008, 0x21a00010, 0x21c00009,
+    0x61c00012, 0x61c0001b, 0x61c00024, 0x61c0002d, 0x61c00036, 0x61b00010, 0x21900005, 0x22000014,
+    0x21f00014, 0xa1f00000, 0xa2000000, 0xa1900000, 0x21900010, 0x22000009, 0x62000012, 0x6200001b,
+    0x62000024, 0x6200002d, 0x62000036, 0x61b00018, 0x21f00005, 0x21e00014, 0x20400014, 0xa0400000,
+    0xa1e00000, 0xa1f00000, 0x21f00010, 0x61f00020, 0x21e00009, 0x61e00012, 0x61e0001b, 0x61e00024,
+    0x61e0002d, 0x61e00036, 0x61b00020, 0x20400005, 0x21d00014, 0x20200014, 0xa0200000, 0xa1d00000,
+    0xa0400000, 0x20400010, 0x21d00009, 0x61d00012, 0x61d0001b, 0x61d00024, 0x61d0002d, 0x61d00036,
+    0x61100018, 0x20200010, 0x60200020, 0x60200030, 0x60200020, 0x60200010, 0xa0200000, 0x20200010,
+    0x22400009, 0x62400012, 0x6240001b, 0x62400024, 0x6240002d, 0x04d00008, 0x04c00010, 0x09b00009,
+    0x49b00012, 0x49b0001b, 0x49b00024, 0x49b0002d, 0x49b00036, 0x44d00010, 0x09800005, 0x09700014,
+    0x09900014, 0x89900000, 0x89700000, 0x89800000, 0x09800010, 0x09700009, 0x49700012, 0x4970001b,
+    0x49700024, 0x4970002d, 0x49700036, 0x44d00018, 0x09900005, 0x09600014, 0x04a00014, 0x84a00000,
+    0x89600000, 0x89900000, 0x09900010, 0x49900020, 0x09600009, 0x49600012, 0x4960001b, 0x49600024,
+    0x4960002d, 0x49600036, 0x44d00020, 0x04a00005, 0x00100014, 0x00000014, 0x80000000, 0x80100000,
+    0x84a00000, 0x04a00010, 0x00100009, 0x40100012, 0x4010001b, 0x40100024, 0x4010002d, 0x40100036,
+    0x61100020, 0x00000010, 0x40000020, 0x40000030, 0x40000020, 0x40000010, 0x80000000, 0x00000010,
+    0x09400009, 0x49400012, 0x4940001b, 0x49400024, 0x4940002d, 0x08200008, 0x08700010, 0x08800009,
+    0x48800012, 0x4880001b, 0x48800024, 0x4880002d, 0x48800036, 0x48200010, 0x08900005, 0x08a00014,
+    0x0e000014, 0x8e000000, 0x88a00000, 0x88900000, 0x08900010, 0x08a00009, 0x48a00012, 0x48a0001b,
+    0x48a00024, 0x48a0002d, 0x48a00036, 0x48200018, 0x0e000005, 0x0e100014, 0x08600014, 0x88600000,
+    0x8e100000, 0x8e000000, 0x0e000010, 0x4e000020, 0x0e100009, 0x4e100012, 0x4e10001b, 0x4e100024,
+    0x4e10002d, 0x4e100036, 0x48200020, 0x08600005, 0x0df00014, 0x0dd00014, 0x8dd00000, 0x8df00000,
+    0x88600000, 0x08600010, 0x0df00009, 0x4df00012, 0x4df0001b, 0x4df00024, 0x4df0002d, 0x4df00036,
+    0x61100028, 0x0dd00010, 0x4dd00020, 0x4dd00030, 0x4dd00020, 0x4dd00010, 0x8dd00000, 0x0dd00010,
+    0x0de00009, 0x4de00012, 0x4de0001b, 0x4de00024, 0x4de0002d, 0x08500008, 0x0dc00010, 0x08400009,
+    0x48400012, 0x4840001b, 0x48400024, 0x4840002d, 0x48400036, 0x48500010, 0x0db00005, 0x08300014,
+    0x0da00014, 0x8da00000, 0x88300000, 0x8db00000, 0x0db00010, 0x08300009, 0x48300012, 0x4830001b,
+    0x48300024, 0x4830002d, 0x48300036, 0x48500018, 0x0da00005, 0x0d800014, 0x0d900014, 0x8d900000,
+    0x8d800000, 0x8da00000, 0x0da00010, 0x4da00020, 0x0d800009, 0x4d800012, 0x4d80001b, 0x4d800024,
+    0x4d80002d, 0x4d800036, 0x48500020, 0x0d900005, 0x05200014, 0x05300014, 0x85300000, 0x85200000,
+    0x8d900000, 0x0d900010, 0x05200009, 0x45200012, 0x4520001b, 0x45200024, 0x4520002d, 0x45200036,
+    0x61100030, 0x05300010, 0x45300020, 0x45300030, 0x45300020, 0x45300010, 0x85300000, 0x05300010,
+    0x05100009, 0x45100012, 0x4510001b, 0x45100024, 0x4510002d, 0x04e00008, 0x05400010, 0x05a00009,
+    0x45a00012, 0x45a0001b, 0x45a00024, 0x45a0002d, 0x45a00036, 0x44e00010, 0x07c00005, 0x07d00014,
+    0x07a00014, 0x87a00000, 0x87d00000, 0x87c00000, 0x07c00010, 0x07d00009, 0x47d00012, 0x47d0001b,
+    0x47d00024, 0x47d0002d, 0x47d00036, 0x44e00018, 0x07a00005, 0x07900014, 0x07b00014, 0x87b00000,
+    0x87900000, 0x87a00000, 0x07a00010, 0x47a00020, 0x07900009, 0x47900012, 0x4790001b, 0x47900024,
+    0x4790002d, 0x47900036, 0x44e00020, 0x07b00005, 0x07700014, 0x07800014, 0x87800000, 0x87700000,
+    0x87b00000, 0x07b00010, 0x07700009, 0x47700012, 0x4770001b, 0x47700024, 0x4770002d, 0x47700036,
+    0x5e700018, 0x07800010, 0x47800020, 0x47800030, 0x47800040, 0x06f00009, 0x46f00012, 0x46f0001b,
+    0x46f00024, 0x46f0002d, 0x07000008, 0x07300005, 0x07500014, 0x07600014, 0x87600000, 0x87500000,
+    0x07500010, 0x87300000, 0x47000010, 0x07300010, 0x47300020, 0x47300030, 0x47300040, 0x47300050,
+    0x47300060, 0x47300070, 0x47300080, 0x47300090, 0x473000a0, 0x47000018, 0x07600010, 0x47600020,
+    0x47600030, 0x47600040, 0x47600050, 0x47600060, 0x47600070, 0x47600080, 0x47600090, 0x476000a0,
+    0x47000020, 0x07400010, 0x47400020, 0x47400030, 0x47400040, 0x47400050, 0x47400060, 0x47400070,
+    0x47400080, 0x47400090, 0x474000a0, 0x474000b0, 0x07200018, 0x07100009, 0x06500030, 0x06600098,
+    0x47000028, 0x06900010, 0x46900020, 0x46900030, 0x46900040, 0x46900050, 0x46900060, 0x46900070,
+    0x46900080, 0x46900090, 0x469000a0, 0x469000b0, 0x06b00018, 0x06c00009, 0x06a00030, 0x06800098,
+    0x46c00012, 0x06700030, 0x05b00098, 0x47000030, 0x05c00010, 0x45c00020, 0x45c00030, 0x45c00040,
+    0x45c00050, 0x45c00060, 0x45c00070, 0x45c00080, 0x45c00090, 0x45c000a0, 0x45c000b0, 0x05f00018,
+    0x06100009, 0x06200030, 0x06000098, 0x46100012, 0x05e00030, 0x05d00098, 0x4610001b, 0x05600030,
+    0x05500098, 0x47000038, 0x04900010, 0x44900020, 0x44900030, 0x44900040, 0x44900050, 0x44900060,
+    0x44900070, 0x44900080, 0x44900090, 0x449000a0, 0x48100018, 0x04800010, 0x44800020, 0x44800030,
+    0x44800020, 0x44800010, 0x84800000, 0x04800010, 0x04600009, 0x44600012, 0x4460001b, 0x44600024,
+    0x4460002d, 0x44600036, 0x4460003f, 0x44600048, 0x44600051, 0x4460005a, 0x44600063, 0x4460006c,
+    0x44600075, 0x4460007e, 0x04700008, 0x09100010, 0x49100020, 0x49100030, 0x49100040, 0x49100050,
+    0x49100060, 0x49100070, 0x49100080, 0x49100090, 0x491000a0, 0x08d00009, 0x48d00012, 0x48d0001b,
+    0x48d00024, 0x48d0002d, 0x11f00018, 0x1ed00008, 0x44700010, 0x1ee00010, 0x5ee00020, 0x5ee00030,
+    0x5ee00040, 0x5ee00050, 0x5ee00060, 0x5ee00070, 0x5ee00080, 0x5ee00090, 0x5ee000a0, 0x1ef00009,
+    0x5ef00012, 0x5ef0001b, 0x5ef00024, 0x5ef0002d, 0x1f500018, 0x1f200008, 0x44700018, 0x1f600010,
+    0x5f600020, 0x5f600030, 0x5f600040, 0x5f600050, 0x5f600060, 0x5f600070, 0x5f600080, 0x5f600090,
+    0x5f6000a0, 0x1f400009, 0x5f400012, 0x5f40001b, 0x5f400024, 0x5f40002d, 0x1f700018, 0x1f300008,
+    0x44700020, 0x1fc00010, 0x5fc00020, 0x5fc00030, 0x5fc00040, 0x5fc00050, 0x5fc00060, 0x5fc00070,
+    0x5fc00080, 0x5fc00090, 0x5fc000a0, 0x1f900009, 0x5f900012, 0x5f90001b, 0x5f900024, 0x5f90002d,
+    0x1fd00018, 0x1fb00008, 0x44700028, 0x1fe00010, 0x5fe00020, 0x5fe00030, 0x5fe00040, 0x5fe00050,
+    0x5fe00060, 0x5fe00070, 0x5fe00080, 0x5fe00090, 0x5fe000a0, 0x1ff00009, 0x5ff00012, 0x5ff0001b,
+    0x5ff00024, 0x5ff0002d, 0x20000018, 0x1fa00008, 0x44700030, 0x12000010, 0x52000020, 0x52000030,
+    0x52000040, 0x52000050, 0x52000060, 0x52000070, 0x52000080, 0x52000090, 0x520000a0, 0x12200009,
+    0x52200012, 0x5220001b, 0x52200024, 0x5220002d, 0x11d00018, 0x22a00008, 0x44700038, 0x12100010,
+    0x52100020, 0x52100030, 0x52100040, 0x52100050, 0x52100060, 0x52100070, 0x52100080, 0x52100090,
+    0x521000a0, 0x12700009, 0x52700012, 0x5270001b, 0x52700024, 0x5270002d, 0x12400018, 0x12500008,
+    0x48100020, 0x12600010, 0x52600020, 0x52600030, 0x52600040, 0x52600050, 0x52600060, 0x52600070,
+    0x52600080, 0x52600090, 0x526000a0, 0x19000009, 0x526000b0, 0x22800009, 0x62800012, 0x6280001b,
+    0x62800024, 0x6280002d, 0x22600018, 0x22700008, 0x62800036, 0x6280003f, 0x62800048, 0x62800051,
+    0x6280005a, 0x62800063, 0x6280006c, 0x22900014, 0x22b00014, 0x22c00008, 0x22d00008, 0xa2c00000,
+    0xa2900000, 0xa2d00000, 0xa2b00000, 0x22b00008, 0x22d00008, 0x22900010, 0x22c00010, 0xa2900000,
+    0xa2b00000, 0xa2c00000, 0xa2d00000, 0x22d00008, 0x22c00008, 0x22b00010, 0x22900010, 0xa2b00000,
+    0xa2d00000, 0xa2900000, 0xa2c00000, 0x22c00008, 0x22900008, 0x22d00010, 0x22b00010, 0xa2d00000,
+    0xa2c00000, 0xa2b00000, 0xa2900000, 0x22900008, 0x22b00008, 0x22c00010, 0x22d00010, 0xa2c00000,
+    0xa2900000, 0xa2d00000, 0xa2b00000, 0x22b00008, 0x22d00008, 0x22900010, 0x22c00010, 0xa2900000,
+    0xa2b00000, 0xa2c00000, 0xa2d00000, 0x22d00020, 0x62d00040, 0xa2d00000, 0x22d00020, 0xa2d00000,
+    0x22d00014, 0x22c00014, 0x22b00008, 0x22900008, 0xa2b00000, 0xa2d00000, 0xa2900000, 0xa2c00000,
+    0x22c00008, 0x22900008, 0x22d00010, 0x22b00010, 0xa2d00000, 0xa2c00000, 0xa2b00000, 0xa2900000,
+    0x22900008, 0x22b00008, 0x22c00010, 0x22d00010, 0xa2c00000, 0xa2900000, 0xa2d00000, 0xa2b00000,
+    0x22b00008, 0x22d00008, 0x22900010, 0x22c00010, 0xa2900000, 0xa2b00000, 0xa2c00000, 0xa2d00000,
+    0x22d00008, 0x22c00008, 0x22b00010, 0x22900010, 0xa2b00000, 0xa2d00000, 0xa2900000, 0xa2c00000,
+    0x22c00008, 0x22900008, 0x22d00010, 0x22b00010, 0xa2d00000, 0xa2c00000, 0xa2b00000, 0xa2900000,
+    0x22900020, 0x62900040, 0xa2900000, 0x22900008, 0x22b00008, 0x22c00010, 0x22d00010, 0xa2c00000,
+    0xa2900000, 0xa2d00000, 0xa2b00000, 0x22b00008, 0x22d00008, 0x22900010, 0x22c00010, 0xa2900000,
+    0xa2b00000, 0xa2c00000, 0xa2d00000, 0x22d00008, 0x22c00008, 0x22b00010, 0x22900010, 0xa2b00000,
+    0xa2d00000, 0xa2900000, 0xa2c00000, 0x22c00008, 0x22900008, 0x22d00010, 0x22b00010, 0xa2d00000,
+    0xa2c00000, 0xa2b00000, 0xa2900000, 0x22900008, 0x22b00008, 0x22c00010, 0x22d00010, 0xa2c00000,
+    0xa2900000, 0xa2d00000, 0xa2b00000, 0x22b00008, 0x22d00b53, 0xa2b00000, 0xa2d00000, 0x22d0000a,
+    0x22b00b53, 0xa2d00000, 0xa2b00000, 0x22b00005, 0x22d00b53, 0xa2b00000, 0xa2d00000, 0x22d0000c,
+    0x22b00b53, 0xa2d00000, 0xa2b00000, 0x22b0000d, 0x22d00b53, 0xa2b00000, 0xa2d00000, 0x22d00004,
+    0x22b00012, 0xa2d00000, 0x22d002f6, 0x22900042, 0xa2d00000, 0x22d0000c, 0x22c00b53, 0xa2d00000,
+    0xa2c00000, 0x22c0003e, 0x22d00b53, 0xa2c00000, 0xa2d00000, 0x22d00004, 0x22c00b53, 0xa2d00000,
+    0xa2c00000, 0x22c00010, 0x22d00b53, 0xa2c00000, 0xa2d00000, 0x22d001c2, 0x22c00054, 0x22e0000f,
+    0xa2e00000, 0x22e0007a, 0xa2d00000, 0xa2e00000, 0x22e00004, 0x22d00b53, 0xa2e00000, 0xa2d00000,
+    0x22d00011, 0x22e00b53, 0xa2d00000, 0xa2e00000, 0x22e00076, 0xa2e00000, 0x22e00008, 0x22d00b53,
+    0xa2e00000, 0xa2d00000, 0x22d001c2, 0x22e0000f, 0xa2e00000, 0x22e0007a, 0xa2d00000, 0xa2e00000,
+    0x22e00076, 0xa2e00000, 0x22e00007, 0x22d00b53, 0xa2e00000, 0xa2d00000, 0x22d002f8, 0x22e00036,
+    0xa2d00000, 0x22d00170, 0xa2d00000, 0x22d0000d, 0x22f00b53, 0xa2d00000, 0xa2f00000, 0x22f0000a,
+    0x22d00b53, 0xa2f00000, 0xa2d00000, 0x22d00009, 0x22f00b53, 0xa2d00000, 0xa2f00000, 0x22f0009c,
+    0xa2f00000, 0x22f0000a, 0x22d00b53, 0xa2f00000, 0xa2d00000, 0x22d0009e, 0xa2d00000, 0x22d0009b,
+    0xa2d00000, 0x22d0000e, 0x22f00b53, 0xa2d00000, 0xa2f00000, 0x22f0009d, 0xa2f00000, 0x22f00170,
+    0xa2f00000, 0x22f00007, 0x22d00b53, 0xa2f00000, 0xa2d00000, 0x22d00009, 0x22f00b53, 0xa2d00000,
+    0xa2f00000, 0x22f00172, 0xa2f00000, 0x22f0000c, 0x22d00b53, 0xa2f00000, 0xa2d00000, 0x22d0000b,
+    0x22f00b53, 0xa2d00000, 0xa2f00000, 0x22f00135, 0xa2b00000, 0x22b0002a, 0xa2f00000, 0x22f00017,
+    0xa2b00000, 0x22b00048, 0xa2f00000, 0x22f0000c, 0x22d00b53, 0xa2f00000, 0xa2d00000, 0x22d0000d,
+    0x22f00b53, 0xa2d00000, 0xa2f00000, 0x22f00172, 0xa2f00000, 0x22f00031, 0xa2b00000, 0x22b00096,
+    0xa2f00000, 0x22f00029, 0xa2b00000, 0x22b0007e, 0xa2f00000, 0x22f00004, 0x22d00b53, 0xa2f00000,
+    0xa2d00000, 0xa2b00000, 0xa2900000, 0xa2c00000, 0xa2e00000, 0x22e0009d, 0x22c00042, 0xa2e00000,
+    0x22e0009b, 0xa2e00000, 0x22e0000e, 0x22900b53, 0xa2e00000, 0xa2900000, 0x2290009d, 0x22e00036,
+    0xa2900000, 0x2290009d, 0xa2900000, 0x2290009e, 0xa2900000, 0x2290009c, 0xa2900000, 0x2290000a,
+    0x22b00b53, 0xa2900000, 0xa2b00000, 0x22b0009e, 0xa2b00000, 0x22b0009e, 0xa2b00000, 0xa2c00000,
+    0xa2e00000, 0x9c900000, 0x1c90000e, 0x22e0000f, 0x22c00038, 0x22b00038, 0xa2b00000, 0xa2c00000,
+    0x9c900000, 0xa2e00000, 0x22e0000e, 0x1c90000f, 0x22c00038, 0x22b00038, 0xa2b00000, 0xa2c00000,
+    0xa2e00000, 0x9c900000, 0x1c90000e, 0x22e0000f, 0x22c00038, 0x22b00038, 0xa2b00000, 0xa2c00000,
+    0x9c900000, 0x1c90009d, 0x22c00042, 0x9c900000, 0x1c90009b, 0x9c900000, 0x1c90000e, 0x22b00b53,
+    0x9c900000, 0xa2b00000, 0x22b0009d, 0x1c900036, 0xa2b00000, 0x22b0009d, 0xa2b00000, 0x22b0009e,
+    0xa2b00000, 0x22b0009c, 0xa2b00000, 0x22b0000a, 0x22900b53, 0xa2b00000, 0xa2900000, 0x2290009e,
+    0xa2900000, 0x2290009e, 0xa2900000, 0xa2c00000, 0x9c900000, 0x9ec00000, 0x1ec00003, 0x1c900004,
+    0x22c0000c, 0x2290000c, 0xa2900000, 0xa2c00000, 0x9ec00000, 0xa2e00000, 0x22e0000e, 0x1ec0000f,
+    0x22c00038, 0x22900038, 0xa2900000, 0xa2c00000, 0xa2e00000, 0x9ec00000, 0x1ec0000e, 0x22e0000f,
+    0x22c00038, 0x22900038, 0xa2900000, 0xa2c00000, 0x9ec00000, 0x94d00000, 0x97a00000, 0x98700000,
+    0x529000a0, 0x97b00000, 0x99100000, 0x98b00000, 0x99200000, 0x4fa000a0, 0x98800000, 0x94f00000,
+    0x95000000, 0x95500000, 0x47e000a0, 0x89000000, 0x0900000e, 0x1550000f, 0x15000038, 0x14f00038,
+    0x94f00000, 0x95000000, 0x89000000, 0x0900000d, 0x1500000e, 0x14f00034, 0x18800034, 0x98800000,
+    0x94f00000, 0x89000000, 0x0900000d, 0x14f0000e, 0x18800034, 0x19200034, 0x99200000, 0x98800000,
+    0x89000000, 0x0900009d, 0x18800042, 0x89000000, 0x0900009b, 0x89000000, 0x0900000e, 0x19200b53,
+    0x89000000, 0x99200000, 0x1920009d, 0x09000036, 0x99200000, 0x1920009d, 0x99200000, 0x1920009e,
+    0x99200000, 0x1920009c, 0x99200000, 0x1920000a, 0x18b00b53, 0x99200000, 0x98b00000, 0x18b0009e,
+    0x98b00000, 0x18b0009e, 0x98b00000, 0x18b0007e, 0x98b00000, 0x18b001c2, 0x19200054, 0x1910000f,
+    0x99100000, 0x1910007a, 0x98b00000, 0x99100000, 0x19100076, 0x99100000, 0x19100007, 0x18b00b53,
+    0x99100000, 0x98b00000, 0x18b0007e, 0x98b00000, 0x98800000, 0x89000000, 0x99200000, 0xa2e00000,
+    0x22e0000e, 0x1920000f, 0x09000038, 0x18800038, 0x98800000, 0x89000000, 0xa2e00000, 0x99200000,
+    0x1920000e, 0x22e0000f, 0x09000038, 0x18800038, 0x98800000, 0x89000000, 0x99200000, 0xa2e00000,
+    0x22e0000e, 0x1920000f, 0x09000038, 0x18800038, 0x98800000, 0x89000000, 0xa2e00000, 0x22e0007e,
+    0x09000042, 0xa2e00000, 0x22e001c2, 0x18800054, 0x18b0000f, 0x98b00000, 0x18b0007a, 0xa2e00000,
+    0x98b00000, 0x18b00076, 0x98b00000, 0x18b00007, 0x22e00b53, 0x98b00000, 0xa2e00000, 0x22e0007e,
+    0x18b00036, 0xa2e00000, 0x89000000, 0x98800000, 0x98b00000, 0x85600000, 0x05600012, 0x86100000,
+    0x85500000, 0x85e00000, 0x05e00009, 0x85600000, 0x85d00000, 0x86200000, 0x85e00000, 0x85f00000,
+    0x45c000a0, 0x86000000, 0x86700000, 0x06700009, 0x86c00000, 0x85b00000, 0x86a00000, 0x86700000,
+    0x86b00000, 0x469000a0, 0x86800000, 0x86500000, 0x87100000, 0x87200000, 0x474000a0, 0x86600000,
+    0x9c900000, 0x1c900003, 0x06600004, 0x0720000c, 0x0710000c, 0x87100000, 0x87200000, 0x9c900000,
+    0x99200000, 0x1920000e, 0x1c90000f, 0x07200038, 0x07100038, 0x87100000, 0x87200000, 0x99200000,
+    0x9c900000, 0x1c90000e, 0x1920000f, 0x07200038, 0x07100038, 0x87100000, 0x87200000, 0x9c900000,
+    0x99200000, 0x1920000e, 0x1c90000f, 0x07200038, 0x07100038, 0x87100000, 0x87200000, 0x99200000,
+    0x8d300000, 0x0d300009, 0x8d100000, 0x8cf00000, 0x8ce00000, 0x8d300000, 0x89e00000, 0x4c1000a0,
+    0x8d200000, 0x0d20007e, 0x09e00042, 0x8d200000, 0x0d2001c2, 0x0d300054, 0x0ce0000f, 0x8ce00000,
+    0x0ce0007a, 0x8d200000, 0x8ce00000, 0x0ce00076, 0x8ce00000, 0x0ce00007, 0x0d200b53, 0x8ce00000,
+    0x8d200000, 0x0d20007e, 0x0ce00036, 0x8d200000, 0x89e00000, 0x8d300000, 0x8ce00000, 0x9c900000,
+    0x1c90000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x9c900000, 0x8ce00000,
+    0x0ce0000e, 0x1c90000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x9c900000,
+    0x1c90000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x9c900000, 0x8ce00000,
+    0x0ce0000e, 0x1c90000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x9c900000,
+    0x1c90000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x9c900000, 0x95500000,
+    0x1550000e, 0x1c90000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x95000000,
+    0x1500000d, 0x1550000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x95000000, 0x94f00000,
+    0x14f0000d, 0x1500000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x94f00000, 0x91c00000,
+    0x11c0001e, 0x14f0001f, 0x0d300078, 0x09e00078, 0x89e00000, 0x8d300000, 0x91c00000, 0x96900000,
+    0x16900021, 0x11c00022, 0x0d300084, 0x09e00084, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x06600003, 0x16900004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x86600000, 0x8ce00000,
+    0x0ce0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x86600000,
+    0x0660000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x8ce00000,
+    0x0ce0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x86600000,
+    0x0660000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x8ce00000,
+    0x0ce0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x96900000,
+    0x16900003, 0x0ce00004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x9c900000,
+    0x1c90000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x9c900000, 0x95500000,
+    0x1550000d, 0x1c90000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x95500000, 0x95000000,
+    0x1500000d, 0x1550000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x95000000, 0x86600000,
+    0x0660000e, 0x1500000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x95000000,
+    0x1500000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95000000, 0x8ce00000,
+    0x0ce00003, 0x15000004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x8ce00000, 0x86600000,
+    0x0660000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x8ce00000,
+    0x0ce0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x86600000,
+    0x0660000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x8ce00000,
+    0x0ce0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x86600000,
+    0x0660000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x95000000,
+    0x15000003, 0x06600004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x95000000, 0x8ce00000,
+    0x0ce0000e, 0x1500000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x95000000,
+    0x1500000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95000000, 0x8ce00000,
+    0x0ce0000e, 0x1500000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x96900000,
+    0x1690000e, 0x0ce0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x9c900000,
+    0x1c90000d, 0x1690000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x9c900000, 0x95500000,
+    0x1550000d, 0x1c90000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x95500000, 0x95000000,
+    0x1500000e, 0x1550000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95000000, 0x95500000,
+    0x1550000e, 0x1500000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x95000000,
+    0x1500000e, 0x1550000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95000000, 0x95500000,
+    0x1550000e, 0x1500000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x95000000,
+    0x1500000e, 0x1550000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95000000, 0x94f00000,
+    0x14f0001e, 0x1500001f, 0x0d300078, 0x09e00078, 0x89e00000, 0x8d300000, 0x94f00000, 0x91c00000,
+    0x11c00021, 0x14f00022, 0x0d300084, 0x09e00084, 0x89e00000, 0x8d300000, 0x91c00000, 0x86600000,
+    0x06600003, 0x11c00004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x86600000, 0x95500000,
+    0x1550000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x86600000,
+    0x0660000e, 0x1550000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x95500000,
+    0x1550000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x86600000,
+    0x0660000e, 0x1550000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x95500000,
+    0x1550000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x8ce00000,
+    0x0ce0000e, 0x1550000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x8ce00000, 0x96900000,
+    0x1690000d, 0x0ce0000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x96900000, 0x9c900000,
+    0x1c90000d, 0x1690000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x9c900000, 0x91c00000,
+    0x11c00003, 0x1c900004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x91c00000, 0x86600000,
+    0x0660000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x91c00000,
+    0x11c0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x86600000,
+    0x0660000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x91c00000,
+    0x11c0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x86600000,
+    0x0660000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x91c00000,
+    0x11c0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x86600000,
+    0x0660000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x91c00000,
+    0x11c0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x9c900000,
+    0x1c900003, 0x11c00004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x9c900000, 0x86600000,
+    0x0660000e, 0x1c90000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x9c900000,
+    0x1c90000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x9c900000, 0x95500000,
+    0x1550000e, 0x1c90000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x95500000, 0x8ce00000,
+    0x0ce0000d, 0x1550000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x8ce00000, 0x96900000,
+    0x1690000d, 0x0ce0000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x91c00000,
+    0x11c00003, 0x06600004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x91c00000, 0x96900000,
+    0x1690000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x91c00000,
+    0x11c0000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x96900000,
+    0x1690000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x91c00000,
+    0x11c0000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x96900000,
+    0x1690000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x91c00000,
+    0x11c0000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x96900000,
+    0x1690000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x91c00000,
+    0x11c0000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x91c00000, 0x9c900000,
+    0x1c90000e, 0x11c0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x9c900000, 0x95500000,
+    0x1550000d, 0x1c90000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x95500000, 0x8ce00000,
+    0x0ce0000d, 0x1550000e, 0x0d300034, 0x09e00034, 0x89e00000, 0x8d300000, 0x8ce00000, 0x95000000,
+    0x1500001e, 0x0ce0001f, 0x0d300078, 0x09e00078, 0x89e00000, 0x8d300000, 0x95000000, 0x94f00000,
+    0x14f00021, 0x15000022, 0x0d300084, 0x09e00084, 0x89e00000, 0x8d300000, 0x94f00000, 0x86600000,
+    0x06600003, 0x14f00004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x86600000,
+    0x0660000e, 0x1690000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x96900000,
+    0x1690000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x96900000, 0x94f00000,
+    0x14f00003, 0x16900004, 0x0d30000c, 0x09e0000c, 0x89e00000, 0x8d300000, 0x94f00000, 0x86600000,
+    0x0660000e, 0x14f0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x94f00000,
+    0x14f0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x94f00000, 0x86600000,
+    0x0660000e, 0x14f0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x94f00000,
+    0x14f0000e, 0x0660000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x94f00000, 0x86600000,
+    0x0660000e, 0x14f0000f, 0x0d300038, 0x09e00038, 0x89e00000, 0x8d300000, 0x86600000, 0x06600010,
+    0x46600020, 0x46600030, 0x46600040, 0x0d300009, 0x4d300012, 0x88f00000, 0x9f000000, 0x89a00000,
+    0x88000000, 0x91000000, 0x91100000, 0x8e500000, 0x8be00000, 0x8e600000, 0x8bc00000, 0x8bd00000,
+    0x8bf00000, 0x8c000000, 0x4ca00060, 0x4ca00050, 0x4ca00040, 0x4ca00030, 0x4ca00020, 0x4ca00010,
+    0x8ca00000, 0x4a800028, 0x8a600000, 0x8ab00000, 0x8c800000, 0x8c600000, 0x8cb00000, 0x8c700000,
+    0x8c400000, 0x4c200060, 0x4c200050, 0x4c200040, 0x4c200030, 0x4c200020, 0x4c200010, 0x8c200000,
+    0x4a800020, 0x8b600000, 0x8b800000, 0x8af00000, 0x8b200000, 0x8b000000, 0x8b700000, 0x8ae00000,
+    0x4e700060, 0x4e700050, 0x4e700040, 0x4e700030, 0x4e700020, 0x4e700010, 0x8e700000, 0x4a800018,
+    0x8b400000, 0x8b100000, 0x4a800010, 0x8ba00000, 0x8b500000, 0x4b300010, 0x8b300000, 0x4a800008,
+    0x8ad00000, 0x4b900010, 0x8b900000, 0x8a800000, 0x90d00000, 0x4a000030, 0x4a000020, 0x4a000010,
+    0x8a000000, 0x48100018, 0x90900000, 0x90c00000, 0x90200000, 0x92f00000, 0x88e00000, 0x4aa00040,
+    0x92a00000, 0x4a300010, 0x8a300000, 0x4aa00038, 0x92b00000, 0x4a700010, 0x8a700000, 0x4aa00030,
+    0x93200000, 0x4f500010, 0x8f500000, 0x4aa00028, 0x93100000, 0x92d00000, 0x4aa00020, 0x92c00000,
+    0x4f600010, 0x8f600000, 0x4aa00018, 0x93400000, 0x93300000, 0x4aa00010, 0x8e900000, 0x89d00000,
+    0x89c00000, 0x8f400000, 0x4a200090, 0x4a200080, 0x4a200070, 0x4a200060, 0x4a200050, 0x4a200040,
+    0x4a200030, 0x4a200020, 0x4a200010, 0x8a200000, 0x4aa00008, 0x8d400000, 0x8ed00000, 0x8bb00000,
+    0x8ea00000, 0x4c100090, 0x4c100080, 0x4c100070, 0x4c100060, 0x4c100050, 0x4c100040, 0x4c100030,
+    0x4c100020, 0x4c100010, 0x8c100000, 0x8aa00000, 0x8a900000, 0x4a100030, 0x4a100020, 0x4a100010,
+    0x8a100000, 0x4e400010, 0x91700000, 0x45900010, 0x85900000, 0x4d700040, 0x91600000, 0x4cd00010,
+    0x8cd00000, 0x4d700038, 0x8f100000, 0x8fb00000, 0x8fd00000, 0x8a500000, 0x8fc00000, 0x8a400000,
+    0x90100000, 0x45800010, 0x85800000, 0x8f300000, 0x8f000000, 0x90500000, 0x47e00090, 0x47e00080,
+    0x47e00070, 0x47e00060, 0x47e00050, 0x47e00040, 0x47e00030, 0x47e00020, 0x47e00010, 0x87e00000,
+    0x4d700030, 0x93a00000, 0x50000010, 0x90000000, 0x4d700028, 0x91300000, 0x90f00000, 0x8f800000,
+    0x90800000, 0x8f200000, 0x8f900000, 0x8f700000, 0x4ff00010, 0x8ff00000, 0x8fe00000, 0x90e00000,
+    0x90700000, 0x90600000, 0x4fa00090, 0x4fa00080, 0x4fa00070, 0x4fa00060, 0x4fa00050, 0x4fa00040,
+    0x4fa00030, 0x4fa00020, 0x4fa00010, 0x8fa00000, 0x4d700020, 0x93900000, 0x51500010, 0x91500000,
+    0x4d700018, 0xa2300000, 0xa2100000, 0x44b00080, 0x44b00070, 0x44b00060, 0x44b00050, 0x44b00040,
+    0x44b00030, 0x44b00020, 0x44b00010, 0x84b00000, 0x4e300010, 0x97600000, 0x51200090, 0x51200080,
+    0x51200070, 0x51200060, 0x51200050, 0x51200040, 0x51200030, 0x51200020, 0x51200010, 0x91200000,
+    0x4d700010, 0x93800000, 0x52300010, 0x92300000, 0x4d700008, 0x96200000, 0x96000000, 0x92800000,
+    0x95b00000, 0x95e00000, 0x92e00000, 0x95c00000, 0x50300010, 0x90300000, 0x96100000, 0x95f00000,
+    0x52900090, 0x52900080, 0x52900070, 0x52900060, 0x52900050, 0x52900040, 0x52900030, 0x52900020,
+    0x52900010, 0x92900000, 0x8d700000, 0x8e800000, 0x4cc00030, 0x4cc00020, 0x4cc00010, 0x8cc00000,
+    0x4e400008, 0x96c00000, 0x56600010, 0x96600000, 0x56400030, 0x97900000, 0x56700010, 0x96700000,
+    0x56400028, 0x94100000, 0x97700000, 0x95d00000, 0x568000a0, 0x56800090, 0x56800080, 0x56800070,
+    0x56800060, 0x56800050, 0x56800040, 0x56800030, 0x56800020, 0x56800010, 0x96800000, 0x56400020,
+    0x97000000, 0x51800010, 0x91800000, 0x56400018, 0x96e00000, 0x519000c0, 0x519000b0, 0x519000a0,
+    0x51900090, 0x51900080, 0x51900070, 0x51900060, 0x51900050, 0x51900040, 0x51900030, 0x51900020,
+    0x51900010, 0x91900000, 0x56400010, 0x96b00000, 0x51e00010, 0x91e00000, 0x56400008, 0x96d00000,
+    0x530000c0, 0x530000b0, 0x530000a0, 0x53000090, 0x53000080, 0x53000070, 0x53000060, 0x53000050,
+    0x53000040, 0x53000030, 0x53000020, 0x53000010, 0x93000000, 0x96400000, 0x97800000, 0x56300030,
+    0x56300020, 0x56300010, 0x96300000, 0x8e400000, 0x91400000, 0x50b00040, 0x50b00030, 0x50b00020,
+    0x50b00010, 0x90b00000, 0x50400010, 0x97400000, 0x57300010, 0x97300000, 0x57500010, 0x93700000,
+    0x56a00030, 0x56a00020, 0x56a00010, 0x96a00000, 0x57500008, 0x93b00000, 0x94300000, 0x94500000,
+    0x93d00000, 0x91b00000, 0x53c00080, 0x53c00070, 0x53c00060, 0x53c00050, 0x53c00040, 0x53c00030,
+    0x53c00020, 0x53c00010, 0x93c00000, 0x56500008, 0x94200000, 0x53e00030, 0x53e00020, 0x53e00010,
+    0x93e00000, 0x96500000, 0x91a00000, 0x53500020, 0x53500010, 0x93500000, 0x97500000, 0x96f00000,
+    0x57100030, 0x57100020, 0x57100010, 0x97100000, 0x57200020, 0x94000000, 0x54700010, 0x94700000,
+    0x53f00010, 0x98d00000, 0x54600030, 0x54600020, 0x54600010, 0x94600000, 0x53f00008, 0x94c00000,
+    0x97d00000, 0x98200000, 0x98000000, 0x98300000, 0x98100000, 0x97c00000, 0x55400080, 0x55400070,
+    0x55400060, 0x55400050, 0x55400040, 0x55400030, 0x55400020, 0x55400010, 0x95400000, 0x53600008,
+    0x97e00000, 0x57f00030, 0x57f00020, 0x57f00010, 0x97f00000, 0x93600000, 0x99300000, 0x58f00020,
+    0x58f00010, 0x98f00000, 0x93f00000, 0x94400000, 0x48c00030, 0x48c00020, 0x48c00010, 0x88c00000,
+    0x57200018, 0x9a800000, 0x58e00010, 0x98e00000, 0x58600038, 0x9b100000, 0x5be00030, 0x9bd00000,
+    0x5be00020, 0x5be00010, 0x9be00000, 0x9b000000, 0x5ae00010, 0x9d300000, 0x5bf00040, 0x9d500000,
+    0x5bf00030, 0x5bf00020, 0x5bf00010, 0x9bf00000, 0x9c600000, 0x5ae00008, 0x9bc00000, 0x5c200040,
+    0x9ba00000, 0x5c200030, 0x5c200020, 0x5c200010, 0x9c200000, 0x9bb00000, 0x9ae00000, 0x98900000,
+    0x58c00030, 0x58c00020, 0x58c00010, 0x98c00000, 0x58600030, 0x94b00000, 0x58a00030, 0x58a00020,
+    0x58a00010, 0x98a00000, 0x58600028, 0x94f00000, 0x95800000, 0x95100000, 0x58600020, 0x95600000,
+    0x54e00030, 0x54e00020, 0x54e00010, 0x94e00000, 0x58600018, 0x95700000, 0x95300000, 0x58600010,
+    0x99b00000, 0x59a00030, 0x59a00020, 0x59a00010, 0x99a00000, 0x58600008, 0x95900000, 0x95200000,
+    0x98600000, 0x98400000, 0x58500030, 0x58500020, 0x58500010, 0x98500000, 0x57200010, 0x9aa00000,
+    0x4ef00010, 0x8ef00000, 0x54800038, 0x9d600000, 0x9d800000, 0x9da00000, 0x9ca00000, 0x5c800060,
+    0x9cc00000, 0x5c800050, 0x9cd00000, 0x5c800040, 0x5c800030, 0x5c800020, 0x5c800010, 0x9c800000,
+    0x5cb00010, 0x9c700000, 0x5cf00060, 0x9ce00000, 0x5cf00050, 0x9c500000, 0x5cf00040, 0x5cf00030,
+    0x5cf00020, 0x5cf00010, 0x9cf00000, 0x5cb00008, 0x9dd00000, 0x5d400060, 0x9db00000, 0x5d400050,
+    0x9e200000, 0x5d400040, 0x5d400030, 0x5d400020, 0x5d400010, 0x9d400000, 0x9cb00000, 0x86300000,
+    0x54900040, 0x9c400000, 0x54900030, 0x54900020, 0x54900010, 0x94900000, 0x54800030, 0x99900000,
+    0x46400030, 0x46400020, 0x46400010, 0x86400000, 0x54800028, 0x91c00000, 0x99c00000, 0x99800000,
+    0x54800020, 0x99500000, 0x5a900030, 0x5a900020, 0x5a900010, 0x9a900000, 0x54800018, 0x9c900000,
+    0x99f00000, 0x99d00000, 0x54800010, 0x99e00000, 0x5b300030, 0x5b300020, 0x5b300010, 0x9b300000,
+    0x54800008, 0x95500000, 0x9a000000, 0x9a200000, 0x94800000, 0x94a00000, 0x55a00030, 0x55a00020,
+    0x55a00010, 0x95a00000, 0x57200008, 0x9b200000, 0x5a700010, 0x9a700000, 0x5a400038, 0x9d100000,
+    0x9d200000, 0x9d000000, 0x9de00000, 0x9df00000, 0x9e100000, 0x9e300000, 0x9e000000, 0x9e500000,
+    0x9e400000, 0xa0100000, 0x86d00000, 0x9ac00000, 0x9ea00000, 0x5dc00010, 0x96900000, 0x9e900000,
+    0x5ad00010, 0x9ad00000, 0x5dc00008, 0x9ab00000, 0x9f100000, 0x9f800000, 0x9dc00000, 0x9e600000,
+    0x85000000, 0x9a500000, 0x5a600050, 0x9d700000, 0x5a600040, 0x9d900000, 0x5a600030, 0x5a600020,
+    0x5a600010, 0x9a600000, 0x9eb00000, 0x5a400030, 0x99600000, 0x59700030, 0x59700020, 0x59700010,
+    0x99700000, 0x5a400028, 0x9b500000, 0x9b400000, 0x5a400020, 0x9c300000, 0x5c100030, 0x5c100020,
+    0x5c100010, 0x9c100000, 0x5a400018, 0x9b900000, 0x9b700000, 0x5a400010, 0x9af00000, 0x5c000030,
+    0x5c000020, 0x5c000010, 0x9c000000, 0x5a400008, 0x9b800000, 0x9b600000, 0x9a400000, 0x9a300000,
+    0x5a100030, 0x5a100020, 0x5a100010, 0x9a100000, 0x97200000, 0x8c900000, 0x4ac00040, 0x4ac00030,
+    0x4ac00020, 0x4ac00010, 0x8ac00000, 0x50400008, 0xa1300000, 0x61700010, 0xa1700000, 0x46e00020,
+    0xa1400000, 0x60d00020, 0x60d00010, 0xa0d00000, 0x46e00018, 0xa2200000, 0x45700010, 0x85700000,
+    0x46e00010, 0xa1200000, 0xa0800000, 0x84f00000, 0x46e00008, 0xa0600000, 0xa0b00000, 0xa0c00000,
+    0xa0500000, 0xa0a00000, 0xa0900000, 0xa0e00000, 0xa0f00000, 0xa1000000, 0x60700080, 0x60700070,
+    0x60700060, 0x60700050, 0x60700040, 0x60700030, 0x60700020, 0x60700010, 0xa0700000, 0x86e00000,
+    0x99400000, 0x5e800030, 0x5e800020, 0x5e800010, 0x9e800000, 0x5e700010, 0xa1500000, 0x61100028,
+    0xa1c00000, 0xa1a00000, 0x61b00018, 0xa2000000, 0xa1900000, 0x61b00010, 0xa1e00000, 0x61f00010,
+    0xa1f00000, 0x61b00008, 0xa1d00000, 0xa0400000, 0xa1b00000, 0xa1600000, 0xa1800000, 0x61100020,
+    0x89b00000, 0x84c00000, 0x44d00018, 0x89700000, 0x89800000, 0x44d00010, 0x89600000, 0x49900010,
+    0x89900000, 0x44d00008, 0x80100000, 0x84a00000, 0x84d00000, 0xa2400000, 0xa0200000, 0x61100018,
+    0x88800000, 0x88700000, 0x48200018, 0x88a00000, 0x88900000, 0x48200010, 0x8e100000, 0x4e000010,
+    0x8e000000, 0x48200008, 0x8df00000, 0x88600000, 0x88200000, 0x89400000, 0x80000000, 0x61100010,
+    0x88400000, 0x8dc00000, 0x48500018, 0x88300000, 0x8db00000, 0x48500010, 0x8d800000, 0x4da00010,
+    0x8da00000, 0x48500008, 0x85200000, 0x8d900000, 0x88500000, 0x8de00000, 0x8dd00000, 0x61100008,
+    0x85a00000, 0x85400000, 0x44e00018, 0x87d00000, 0x87c00000, 0x44e00010, 0x87900000, 0x47a00010,
+    0x87a00000, 0x44e00008, 0x87700000, 0x87b00000, 0x84e00000, 0x85100000, 0x85300000, 0xa1100000,
+    0xa0300000, 0x62500030, 0x62500020, 0x62500010, 0xa2500000, 0x5e700008, 0x87500000, 0x47000030,
+    0x47300090, 0x47300080, 0x47300070, 0x47300060, 0x47300050, 0x47300040, 0x47300030, 0x47300020,
+    0x47300010, 0x87300000, 0x47000028, 0x47600090, 0x47600080, 0x47600070, 0x47600060, 0x47600050,
+    0x47600040, 0x47600030, 0x47600020, 0x47600010, 0x87600000, 0x47000020, 0x47400090, 0x47400080,
+    0x47400070, 0x47400060, 0x47400050, 0x47400040, 0x47400030, 0x47400020, 0x47400010, 0x87400000,
+    0x47000018, 0x46900090, 0x46900080, 0x46900070, 0x46900060, 0x46900050, 0x46900040, 0x46900030,
+    0x46900020, 0x46900010, 0x86900000, 0x47000010, 0x45c00090, 0x45c00080, 0x45c00070, 0x45c00060,
+    0x45c00050, 0x45c00040, 0x45c00030, 0x45c00020, 0x45c00010, 0x85c00000, 0x47000008, 0x44900090,
+    0x44900080, 0x44900070, 0x44900060, 0x44900050, 0x44900040, 0x44900030, 0x44900020, 0x44900010,
+    0x84900000, 0x87000000, 0x86f00000, 0x47800030, 0x47800020, 0x47800010, 0x87800000, 0x9e700000,
+    0x8c300000, 0x4c500040, 0x4c500030, 0x4c500020, 0x4c500010, 0x8c500000, 0x90400000, 0x90a00000,
+    0x89f00000, 0x48100010, 0x91f00000, 0x9ed00000, 0x88d00000, 0x49100090, 0x49100080, 0x49100070,
+    0x49100060, 0x49100050, 0x49100040, 0x49100030, 0x49100020, 0x49100010, 0x89100000, 0x44700030,
+    0x9f500000, 0x9f200000, 0x9ef00000, 0x5ee00090, 0x5ee00080, 0x5ee00070, 0x5ee00060, 0x5ee00050,
+    0x5ee00040, 0x5ee00030, 0x5ee00020, 0x5ee00010, 0x9ee00000, 0x44700028, 0x9f700000, 0x9f300000,
+    0x9f400000, 0x5f600090, 0x5f600080, 0x5f600070, 0x5f600060, 0x5f600050, 0x5f600040, 0x5f600030,
+    0x5f600020, 0x5f600010, 0x9f600000, 0x44700020, 0x9fd00000, 0x9fb00000, 0x9f900000, 0x5fc00090,
+    0x5fc00080, 0x5fc00070, 0x5fc00060, 0x5fc00050, 0x5fc00040, 0x5fc00030, 0x5fc00020, 0x5fc00010,
+    0x9fc00000, 0x44700018, 0xa0000000, 0x9fa00000, 0x9ff00000, 0x5fe00090, 0x5fe00080, 0x5fe00070,
+    0x5fe00060, 0x5fe00050, 0x5fe00040, 0x5fe00030, 0x5fe00020, 0x5fe00010, 0x9fe00000, 0x44700010,
+    0x91d00000, 0xa2a00000, 0x92200000, 0x52000090, 0x52000080, 0x52000070, 0x52000060, 0x52000050,
+    0x52000040, 0x52000030, 0x52000020, 0x52000010, 0x92000000, 0x44700008, 0x92400000, 0x92500000,
+    0x92700000, 0x52100090, 0x52100080, 0x52100070, 0x52100060, 0x52100050, 0x52100040, 0x52100030,
+    0x52100020, 0x52100010, 0x92100000, 0x84700000, 0x84600000, 0x84800000, 0x48100008, 0xa2600000,
+    0xa2700000, 0x99000000, 0x526000a0, 0xa2800000, 0x52600090, 0x52600080, 0x52600070, 0x52600060,
+    0x52600050, 0x52600040, 0x52600030, 0x52600020, 0x52600010, 0x92600000, 0x88100000, 0x8e200000,
+    0x47f00020, 0x47f00010, 0x87f00000, 0x4e300008, 0x8d500000, 0x8ec00000, 0x8eb00000, 0x8ee00000,
+    0x8d600000, 0x4d0000c0, 0x4d0000b0, 0x4d0000a0, 0x4d000090, 0x4d000080, 0x4d000070, 0x4d000060,
+    0x4d000050, 0x4d000040, 0x4d000030, 0x4d000020, 0x4d000010, 0x8d000000, 0x8e300000, 0x89500000,
+    0x49200030, 0x49200020, 0x49200010, 0x89200000, 0x09200050, 0x09500008, 0x0e300010, 0x4e300020,
+    0x4e300030, 0x0d000009, 0x4d000012, 0x0d600008, 0x0ee00010, 0x4ee00020, 0x4ee00030, 0x4d600010,
+    0x0eb00010, 0x0ec00009, 0x4ec00012, 0x0d500018, 0x07f00008, 0x0e200018, 0x47f00028, 0x4d00001b,
+    0x4d000024, 0x4ec0001b, 0x4ec00024, 0x4ee00040, 0x08100009, 0x48100012, 0x4810001b, 0x48100024,
+    0x12600008, 0x22800010, 0x62800020, 0x62800030, 0x62800040, 0x62800050, 0x19000009, 0x59000012,
+    0x22700008, 0x22600010, 0x62600020, 0x62600030, 0x62600040, 0x62600050, 0x62600060, 0x04800018,
+    0x04600020, 0x84600000, 0x04600020, 0x84600000, 0x62600070, 0x04600009, 0x44600012, 0x4460001b,
+    0x04700018, 0x12100008, 0x84800000, 0x04800018, 0x12700020, 0x92700000, 0x12700008, 0x12500005,
+    0x12400014, 0x12000014, 0x92000000, 0x92400000, 0x92500000, 0x1250000a, 0x12400028, 0x12000028,
+    0x92000000, 0x92400000, 0x12400010, 0x12000009, 0x52000012, 0x5200001b, 0x52600010, 0x12200010,
+    0x52200020, 0x52200030, 0x52200040, 0x52200050, 0x22a00009, 0x62a00012, 0x62700010, 0x11d00010,
+    0x51d00020, 0x51d00030, 0x51d00040, 0x51d00050, 0x51d00060, 0x1fe00018, 0x51d00070, 0x1ff00009,
+    0x5ff00012, 0x5ff0001b, 0x1fa00018, 0x20000008, 0x9fe00000, 0x1fe00018, 0x1fc00008, 0x1f900005,
+    0x1fb00014, 0x1fd00014, 0x9fd00000, 0x9fb00000, 0x9f900000, 0x1f90000b, 0x1fb0002c, 0x1fd0002c,
+    0x9fd00000, 0x9fb00000, 0x1fb00010, 0x1fd00009, 0x5fd00012, 0x5fd0001b, 0x5900001b, 0x59000024,
+    0x5900002d, 0x59000036, 0x5900003f, 0x1f600008, 0x1f400010, 0x5f400020, 0x5f400030, 0x5f400040,
+    0x5f400050, 0x5f400060, 0x5f400070, 0x5f400080, 0x5f400090, 0x5f4000a0, 0x5f4000b0, 0x5f4000c0,
+    0x5f4000d0, 0x1f300004, 0x1f700004, 0x1ee00008, 0x1ef00018, 0x1f20001c, 0x1f50000c, 0x0910000c,
+    0x89100000, 0x9f500000, 0x1f500010, 0x9ee00000, 0x5f300008, 0x1ee0001c, 0x0910000c, 0x08d0000c,
+    0x88d00000, 0x89100000, 0x5f700008, 0x5f500020, 0x0910001c, 0x08d0000c, 0x1ed0000c, 0x9ed00000,
+    0x88d00000, 0x08d0001c, 0x1ed0000c, 0x11f0000c, 0x91f00000, 0x9ed00000, 0x5f70000c, 0x5f500030,
+    0x1ed0001c, 0x11f0000c, 0x09f0000c, 0x89f00000, 0x91f00000, 0x11f0001c, 0x09f0000c, 0x10a0000c,
+    0x90a00000, 0x89f00000, 0x5f700010, 0x5f500040, 0x09f0001c, 0x10a0000c, 0x1040000c, 0x90400000,
+    0x90a00000, 0x10a0001c, 0x1040000c, 0x0c50000c, 0x8c500000, 0x90400000, 0x5f600010, 0x10400010,
+    0x50400020, 0x0c500008, 0x0c300010, 0x4c300020, 0x4c300030, 0x4c300040, 0x4c300050, 0x4c300060,
+    0x4c300070, 0x4c300080, 0x1e700050, 0x07800014, 0x06f00018, 0x9e700000, 0x87800000, 0x07800310,
+    0x1e7000c4, 0x07000018, 0x04900008, 0x4c300090, 0x05c00009, 0x50400030, 0x06900009, 0x46900012,
+    0x45c00012, 0x45c0001b, 0x07400018, 0x5f600018, 0x07600010, 0x47600020, 0x47600030, 0x47600040,
+    0x47600050, 0x47600060, 0x47600070, 0x47600080, 0x47600090, 0x07300050, 0x07500014, 0x22500018,
+    0x5f600020, 0x20300010, 0x60300020, 0x60300030, 0x60300040, 0x60300050, 0x60300060, 0x60300070,
+    0x60300080, 0x60300090, 0x603000a0, 0x21100018, 0x5f600028, 0x05300010, 0x45300020, 0x45300030,
+    0x45300040, 0x45300050, 0x45300060, 0x45300070, 0x45300080, 0x45300090, 0x453000a0, 0x05100018,
+    0x5f600030, 0x04e00010, 0x44e00020, 0x44e00030, 0x44e00040, 0x44e00050, 0x44e00060, 0x44e00070,
+    0x44e00080, 0x44e00090, 0x44e000a0, 0x44e000b0, 0x44e000c0, 0x07b00018, 0x5f600038, 0x07700010,
+    0x47700020, 0x47700030, 0x47700040, 0x47700050, 0x07a00008, 0x07900010, 0x07c00005, 0x07d00014,
+    0x05400014, 0x85400000, 0x87d00000, 0x47900020, 0x07d00009, 0x87c00000, 0x07c00001, 0x05400004,
+    0x05a00004, 0x85a00000, 0x85400000, 0x05400018, 0x05a00008, 0x0dd00018, 0x45a00028, 0x0de00020,
+    0x4de00040, 0x8de00000, 0x0de00020, 0x8de00000, 0x47c00001, 0x0de00004, 0x08500004, 0x88500000,
+    0x8de00000, 0x0de00020, 0x4de00040, 0x8de00000, 0x0de00020, 0x8de00000, 0x47c00001, 0x0de00004,
+    0x08500004, 0x88500000, 0x8de00000, 0x47c00001, 0x0de00004, 0x08500004, 0x88500000, 0x8de00000,
+    0x47d00012, 0x47c00001, 0x0de00004, 0x08500004, 0x88500000, 0x8de00000, 0x47700060, 0x0de00009,
+    0x87c00000, 0x07c00007, 0x0850001c, 0x0d90001c, 0x8d900000, 0x88500000, 0x47c00007, 0x0850001c,
+    0x0d90001c, 0x8d900000, 0x88500000, 0x08500007, 0x0d90000c, 0x8d900000, 0x88500000, 0x08500007,
+    0x0d90000c, 0x8d900000, 0x88500000, 0x47c00007, 0x0850001c, 0x0d90001c, 0x8d900000, 0x88500000,
+    0x08500007, 0x0d90000c, 0x8d900000, 0x88500000, 0x08500018, 0x5f600040, 0x0d900010, 0x4d900020,
+    0x4d900030, 0x4d900040, 0x4d900050, 0x4d900060, 0x4d900070, 0x4d900080, 0x4d900090, 0x49500010,
+    0x05200010, 0x45200020, 0x45200030, 0x45200040, 0x45200050, 0x45200060, 0x45200070, 0x45200080,
+    0x45200090, 0x0da00008, 0x0d800005, 0x0db00014, 0x08300014, 0x88300000, 0x8db00000, 0x0db00018,
+    0x5f600048, 0x08300010, 0x48300020, 0x48300030, 0x48300040, 0x48300050, 0x48300060, 0x48300070,
+    0x0dc00008, 0x08400005, 0x00000014, 0x09400014, 0x89400000, 0x80000000, 0x88400000, 0x0840002d,
+    0x000000b4, 0x094000b4, 0x89400000, 0x80000000, 0x00000010, 0x09400009, 0x49400012, 0x08200018,
+    0x5f600050, 0x08600010, 0x48600020, 0x48600030, 0x48600040, 0x48600050, 0x0df00009, 0x4df00012,
+    0x0e000008, 0x0e100010, 0x4e100020, 0x4e100030, 0x4e100040, 0x4e100050, 0x4e100060, 0x08900018,
+    0x4e100070, 0x08a00009, 0x48a00012, 0x08700008, 0x08800004, 0x48700010, 0x20200005, 0x22400014,
+    0x04d00014, 0x84d00000, 0xa2400000, 0xa0200000, 0x20200006, 0x22400018, 0x04d00018, 0x84d00000,
+    0xa2400000, 0x22400098, 0x04d00010, 0x04a00009, 0xa2400000, 0x22400098, 0x4e000010, 0x00100010,
+    0x40100020, 0x40100030, 0x40100040, 0x40100050, 0x40100060, 0x09900018, 0x40100070, 0x09600009,
+    0x49600012, 0x09800008, 0x09700004, 0x49800010, 0x04c00005, 0x09b00014, 0x21800014, 0xa1800000,
+    0x89b00000, 0x84c00000, 0x04c00006, 0x09b00018, 0x21800018, 0xa1800000, 0x89b00000, 0x09b00098,
+    0x21800010, 0x21600009, 0x89b00000, 0x09b00098, 0x4e000018, 0x21b00010, 0x61b00020, 0x61b00030,
+    0x61b00040, 0x61b00050, 0x61b00060, 0x20400018, 0x61b00070, 0x21d00009, 0x61d00012, 0x21f00008,
+    0x21e00004, 0x61f00010, 0x21900005, 0x22000014, 0x21a00014, 0xa1a00000, 0xa2000000, 0xa1900000,
+    0x21900005, 0x22000014, 0x21a00014, 0xa1a00000, 0xa2000000, 0x22000098, 0x21a00010, 0x21c00009,
+    0xa2000000, 0x22000098, 0x4e000020, 0x21500010, 0x61500020, 0x61500030, 0x61500040, 0x61500050,
+    0x61500060, 0x1e800018, 0x61500070, 0x19400009, 0x59400012, 0x06e00008, 0x20700004, 0x46e00010,
+    0x21000005, 0x20f00014, 0x20e00014, 0xa0e00000, 0xa0f00000, 0xa1000000, 0x21000005, 0x20f00014,
+    0x20e00014, 0xa0e00000, 0xa0f00000, 0x20f00098, 0x20e00010, 0x20900009, 0xa0f00000, 0x20f00098,
+    0x4e000028, 0x20a00010, 0x60a00020, 0x60a00030, 0x60a00040, 0x60a00050, 0x60a00060, 0x20500018,
+    0x60a00070, 0x20c00009, 0x60c00012, 0x20b00008, 0x20600004, 0x60b00010, 0x04f00005, 0x20800014,
+    0x21200014, 0xa1200000, 0xa0800000, 0x84f00000, 0x04f00007, 0x2080001c, 0x2120001c, 0xa1200000,
+    0xa0800000, 0x20800098, 0x21200010, 0x05700009, 0xa0800000, 0x20800098, 0x4e000030, 0x22200010,
+    0x62200020, 0x62200030, 0x62200040, 0x62200050, 0x62200060, 0x20d00018, 0x62200070, 0x21400009,
+    0x61400012, 0x21700008, 0x21300004, 0x61700010, 0x0ac00005, 0x0c900014, 0x17200014, 0x97200000,
+    0x8c900000, 0x8ac00000, 0x0ac00005, 0x0c900014, 0x17200014, 0x97200000, 0x8c900000, 0x0c900098,
+    0x17200010, 0x1a100009, 0x8c900000, 0x0c900098, 0x4e000038, 0x1a300010, 0x5a300020, 0x5a300030,
+    0x5a300040, 0x5a300050, 0x5a300060, 0x1a400018, 0x5a300070, 0x1b600009, 0x5b600012, 0x1b800008,
+    0x1c000004, 0x5b800010, 0x1af00005, 0x1b700014, 0x1b900014, 0x9b900000, 0x9b700000, 0x9af00000,
+    0x1af00006, 0x1b700018, 0x1b900018, 0x9b900000, 0x9b700000, 0x1b700098, 0x1b900010, 0x1c100009,
+    0x9b700000, 0x1b700098, 0x62a0001b, 0x62a00024, 0x1c300008, 0x1b400010, 0x5b400020, 0x5b400030,
+    0x5b400040, 0x5b400050, 0x5b400060, 0x5b400070, 0x5b400080, 0x5b400090, 0x1b500008, 0x19700010,
+    0x19600005, 0x1eb00014, 0x1a600014, 0x9a600000, 0x9eb00000, 0x59700020, 0x1eb00009, 0x99600000,
+    0x19600001, 0x1a600004, 0x1d900004, 0x9d900000, 0x9a600000, 0x1a600018, 0x1d900008, 0x1d700018,
+    0x5d900028, 0xa2400000, 0x22400020, 0xa2400000, 0x89b00000, 0x09b00020, 0x89b00000, 0xa2000000,
+    0x22000020, 0xa2000000, 0xa0f00000, 0x20f00020, 0xa0f00000, 0xa0800000, 0x20800020, 0xa0800000,
+    0x8c900000, 0x0c900020, 0x8c900000, 0x9b700000, 0x1b700020, 0x9b700000, 0x59600001, 0x1b700004,
+    0x0c900004, 0x8c900000, 0x9b700000, 0x1b700020, 0x9b700000, 0x1b700020, 0x9b700000, 0x1b700020,
+    0x9b700000, 0x1b700020, 0x9b700000, 0x1b700020, 0x9b700000, 0x1b700020, 0x9b700000, 0x1b700020,
+    0x9b700000, 0x59600001, 0x1b700004, 0x0c900004, 0x8c900000, 0x9b700000, 0x59600001, 0x1b700004,
+    0x0c900004, 0x8c900000, 0x9b700000, 0x1b700018, 0x5b4000a0, 0x0c900009, 0x59600001, 0x20800004,
+    0x20f00004, 0xa0f00000, 0xa0800000, 0x5eb00012, 0x59600001, 0x20800004, 0x20f00004, 0xa0f00000,
+    0xa0800000, 0x4c900012, 0x20800029, 0x5c300010, 0x20f00010, 0x60f00020, 0x60f00030, 0x60f00040,
+    0x60f00050, 0x60f00060, 0x60f00070, 0x60f00080, 0x60f00090, 0x22000008, 0x09b00010, 0x22400005,
+    0x1a500014, 0x05000014, 0x85000000, 0x9a500000, 0x49b00020, 0x1a500009, 0xa2400000, 0x22400001,
+    0x05000004, 0x1e600004, 0x9e600000, 0x85000000, 0x05000018, 0x1e600008, 0x1dc00018, 0x5e600028,
+    0x62400001, 0x1f800004, 0x1f100004, 0x9f100000, 0x9f800000, 0x59600001, 0x1f800004, 0x1f100004,
+    0x9f100000, 0x9f800000, 0x62400001, 0x1f800004, 0x1f100004, 0x9f100000, 0x9f800000, 0x62400001,
+    0x1f800004, 0x1f100004, 0x9f100000, 0x9f800000, 0x1f800018, 0x60f000a0, 0x1f100009, 0x62400001,
+    0x1ab00004, 0x1ad00004, 0x9ad00000, 0x9ab00000, 0x5a500012, 0x62400001, 0x1ab00004, 0x1ad00004,
+    0x9ad00000, 0x9ab00000, 0x5f100012, 0x1ab0000f, 0x49500018, 0x1ad00010, 0x5ad00020, 0x5ad00030,
+    0x5ad00040, 0x5ad00050, 0x5ad00060, 0x5ad00070, 0x5ad00080, 0x5ad00090, 0x5ad000a0, 0x5ad000b0,
+    0x5ad000c0, 0x1e900050, 0x16900014, 0x5ad000d0, 0x1ea00009, 0x5ea00012, 0x5ea0001b, 0x1ac00018,
+    0x06d00008, 0x5ea00024, 0x9e900000, 0x96900000, 0x16900290, 0x1e9000a4, 0x201000a4, 0xa0100000,
+    0x20100018, 0x1e400018, 0x1e500008, 0x1e000018, 0x1e300008, 0x1e100008, 0x1df00010, 0x5df00020,
+    0x1de00009, 0x5de00012, 0x1d000008, 0x1d200010, 0x5d200020, 0x5d200030, 0x5d200040, 0x1d100009,
+    0x5d100012, 0x1a700008, 0x1b200010, 0x5b200020, 0x5b200030, 0x5b200040, 0x15a00009, 0x55a00012,
+    0x14a00018, 0x14800008, 0x5d10001b, 0x5d100024, 0x5d10002d, 0x5a700010, 0x1a200010, 0x5a200020,
+    0x5a200030, 0x1a000009, 0x5a000012, 0x5a00001b, 0x5a000024, 0x5a00002d, 0x5a000036, 0x5a00003f,
+    0x15500008, 0x1b300005, 0x19e00014, 0x19d00014, 0x99d00000, 0x99e00000, 0x19e00010, 0x19d00009,
+    0x9b300000, 0x1b300003, 0x19f0000c, 0x1c90000c, 0x9c900000, 0x99f00000, 0x19f00008, 0x1c900005,
+    0x1a900014, 0x19500014, 0x99500000, 0x9a900000, 0x9c900000, 0x1c900029, 0x1a9000a4, 0x195000a4,
+    0x99500000, 0x9a900000, 0x1a900010, 0x19500009, 0x5a700018, 0x19800010, 0x59800020, 0x19c00009,
+    0x59c00012, 0x59c0001b, 0x59c00024, 0x59c0002d, 0x11c00008, 0x06400010, 0x46400020, 0x46400030,
+    0x46400040, 0x46400050, 0x46400060, 0x46400070, 0x46400080, 0x19900018, 0x14900008, 0x1c400005,
+    0x06300014, 0x1cb00014, 0x9cb00000, 0x86300000, 0x9c400000, 0x1c400003, 0x0630000c, 0x1cb0000c,
+    0x9cb00000, 0x86300000, 0x06300010, 0x1cb00009, 0x5cb00012, 0x5cb0001b, 0x1d400018, 0x1e200008,
+    0x5de0001b, 0x5de00024, 0x62400001, 0x1db00004, 0x1dd00004, 0x9dd00000, 0x9db00000, 0x1db00020,
+    0x9db00000, 0x55a0001b, 0x1db00020, 0x9db00000, 0x1db00020, 0x9db00000, 0x1db00020, 0x9db00000,
+    0x1db0000c, 0x1dd0000c, 0x9dd00000, 0x9db00000, 0x1db00003, 0x1dd0000c, 0x1cf0000c, 0x9cf00000,
+    0x9dd00000, 0x1dd00003, 0x1cf0000c, 0x1c50000c, 0x9c500000, 0x9cf00000, 0x1cf00003, 0x1c50000c,
+    0x1ce0000c, 0x9ce00000, 0x9c500000, 0x1c500003, 0x1ce0000c, 0x1c70000c, 0x9c700000, 0x9ce00000,
+    0x1ce00003, 0x1c70000c, 0x1c80000c, 0x9c800000, 0x9c700000, 0x1c700003, 0x1c80000c, 0x1cd0000c,
+    0x9cd00000, 0x9c800000, 0x1c800003, 0x1cd0000c, 0x1cc0000c, 0x9cc00000, 0x9cd00000, 0x1cd00003,
+    0x1cc00008, 0x1ca00008, 0x9ca00000, 0x9cc00000, 0x1cc00002, 0x1ca00008, 0x1da00008, 0x9da00000,
+    0x9ca00000, 0x1ca00002, 0x1da00008, 0x1d800008, 0x9d800000, 0x9da00000, 0x1da00002, 0x1d800008,
+    0x1d600008, 0x9d600000, 0x9d800000, 0x1d800002, 0x1d600008, 0x0ef00008, 0x8ef00000, 0x9d600000,
+    0x1d600002, 0x0ef00008, 0x1aa00008, 0x9aa00000, 0x8ef00000, 0x0ef00002, 0x1aa00008, 0x18500008,
+    0x98500000, 0x9aa00000, 0x1aa00002, 0x18500008, 0x18400008, 0x98400000, 0x98500000, 0x18500002,
+    0x18400008, 0x18600008, 0x98600000, 0x98400000, 0x18400002, 0x1860000c, 0x1520000c, 0x95200000,
+    0x98600000, 0x18600003, 0x1520000c, 0x1590000c, 0x95900000, 0x95200000, 0x15200003, 0x1590000c,
+    0x19a0000c, 0x99a00000, 0x95900000, 0x15900003, 0x19a0000c, 0x19b0000c, 0x99b00000, 0x99a00000,
+    0x19a00003, 0x19b0000c, 0x1530000c, 0x95300000, 0x99b00000, 0x19b00003, 0x1530000a, 0x15700b53,
+    0x95300000, 0x95700000, 0x1570000b, 0x15300b53, 0x95700000, 0x95300000, 0x1530000c, 0x1570000c,
+    0x95700000, 0x95300000, 0x15300003, 0x1570000c, 0x14e0000c, 0x94e00000, 0x95700000, 0x15700003,
+    0x14e00003, 0x15600b53, 0x94e00000, 0x95600000, 0x1560000c, 0x14e0000c, 0x94e00000, 0x95600000,
+    0x15600003, 0x14e0000c, 0x1510000c, 0x95100000, 0x94e00000, 0x14e00003, 0x1510000c, 0x1580000c,
+    0x95800000, 0x95100000, 0x15100003, 0x1580000c, 0x14f0000c, 0x94f00000, 0x95800000, 0x15800003,
+    0x14f0000c, 0x18a0000c, 0x98a00000, 0x94f00000, 0x14f00003, 0x18a0000c, 0x14b0000c, 0x94b00000,
+    0x98a00000, 0x18a00003, 0x14b0000c, 0x18c0000c, 0x98c00000, 0x94b00000, 0x14b00003, 0x18c0000c,
+    0x1890000c, 0x98900000, 0x98c00000, 0x18c00003, 0x1890000c, 0x1ae0000c, 0x9ae00000, 0x98900000,
+    0x18900003, 0x1ae0000c, 0x1bb0000c, 0x9bb00000, 0x9ae00000, 0x1ae00003, 0x1bb0000c, 0x1c20000c,
+    0x9c200000, 0x9bb00000, 0x1bb00003, 0x1c20000c, 0x1ba0000c, 0x9ba00000, 0x9c200000, 0x1c200003,
+    0x1ba0000c, 0x1bc0000c, 0x9bc00000, 0x9ba00000, 0x1ba00003, 0x1bc0000c, 0x1c60000c, 0x9c600000,
+    0x9bc00000, 0x1bc00003, 0x1c60000c, 0x1bf0000c, 0x9bf00000, 0x9c600000, 0x1c600003, 0x1bf00008,
+    0x1d500008, 0x9d500000, 0x9bf00000, 0x1bf00002, 0x1d500008, 0x1d300008, 0x9d300000, 0x9d500000,
+    0x1d500002, 0x1d300008, 0x1b000008, 0x9b000000, 0x9d300000, 0x1d300002, 0x1b000008, 0x1be00008,
+    0x9be00000, 0x9b000000, 0x1b000002, 0x1be00008, 0x1bd00008, 0x9bd00000, 0x9be00000, 0x1be00002,
+    0x1bd00008, 0x1b100008, 0x9b100000, 0x9bd00000, 0x1bd00002, 0x1b100008, 0x18e00008, 0x98e00000,
+    0x9b100000, 0x1b100002, 0x18e00008, 0x1a800008, 0x9a800000, 0x98e00000, 0x18e00002, 0x1a800008,
+    0x08c00008, 0x88c00000, 0x9a800000, 0x1a800002, 0x08c0000c, 0x1440000c, 0x94400000, 0x88c00000,
+    0x08c00003, 0x14402dd3, 0x13f001c2, 0x18f00054, 0x1930000f, 0x99300000, 0x19300041, 0x93f00000,
+    0x99300000, 0x19302dd3, 0x13f0003d, 0x93f00000, 0x13f00104, 0x13600036, 0x17f00042, 0x93f00000,
+    0x13f00045, 0x17e00060, 0x93600000, 0x1360006c, 0x93f00000, 0x13f00104, 0x93f00000, 0x13f00003,
+    0x15400b53, 0x93f00000, 0x95400000, 0x15400104, 0x93600000, 0x13600036, 0x95400000, 0x15400104,
+    0x95400000, 0x154000c1, 0x95400000, 0x15400003, 0x13f00b53, 0x95400000, 0x93f00000, 0x9db00000,
+    0x1db00003, 0x13f00b53, 0x9db00000, 0x93f00000, 0x9dd00000, 0x1dd00003, 0x13f00b53, 0x9dd00000,
+    0x93f00000, 0x9cf00000, 0x1cf00003, 0x13f00b53, 0x9cf00000, 0x93f00000, 0x9c500000, 0x1c500003,
+    0x13f00b53, 0x9c500000, 0x93f00000, 0x9ce00000, 0x1ce00003, 0x13f00b53, 0x9ce00000, 0x93f00000,
+    0x9c700000, 0x1c700003, 0x13f00b53, 0x9c700000, 0x93f00000, 0x9c800000, 0x1c800003, 0x13f00b53,
+    0x9c800000, 0x93f00000, 0x9cd00000, 0x1cd00002, 0x13f00b53, 0x9cd00000, 0x93f00000, 0x9cc00000,
+    0x1cc00002, 0x13f00b53, 0x9cc00000, 0x93f00000, 0x9ca00000, 0x1ca00002, 0x13f00b53, 0x9ca00000,
+    0x93f00000, 0x9da00000, 0x1da00002, 0x13f00b53, 0x9da00000, 0x93f00000, 0x9d800000, 0x1d800002,
+    0x13f00b53, 0x9d800000, 0x93f00000, 0x9d600000, 0x1d600002, 0x13f00b53, 0x9d600000, 0x93f00000,
+    0x8ef00000, 0x0ef00002, 0x13f00b53, 0x8ef00000, 0x93f00000, 0x9aa00000, 0x1aa00002, 0x13f00b53,
+    0x9aa00000, 0x93f00000, 0x98500000, 0x18500002, 0x13f00b53, 0x98500000, 0x93f00000, 0x98400000,
+    0x18400003, 0x13f00b53, 0x98400000, 0x93f00000, 0x98600000, 0x18600003, 0x13f00b53, 0x98600000,
+    0x93f00000, 0x95200000, 0x15200003, 0x13f00b53, 0x95200000, 0x93f00000, 0x95900000, 0x15900003,
+    0x13f00b53, 0x95900000, 0x93f00000, 0x99a00000, 0x19a00003, 0x13f00b53, 0x99a00000, 0x93f00000,
+    0x99b00000, 0x19b00003, 0x13f00b53, 0x99b00000, 0x93f00000, 0x95300000, 0x15300003, 0x13f00b53,
+    0x95300000, 0x93f00000, 0x95700000, 0x15700003, 0x13f00b53, 0x95700000, 0x93f00000, 0x95600000,
+    0x15600003, 0x13f00b53, 0x95600000, 0x93f00000, 0x94e00000, 0x14e00003, 0x13f00b53, 0x94e00000,
+    0x93f00000, 0x95100000, 0x15100003, 0x13f00b53, 0x95100000, 0x93f00000, 0x95800000, 0x15800003,
+    0x13f00b53, 0x95800000, 0x93f00000, 0x94f00000, 0x14f00003, 0x13f00b53, 0x94f00000, 0x93f00000,
+    0x98a00000, 0x18a00003, 0x13f00b53, 0x98a00000, 0x93f00000, 0x94b00000, 0x14b00003, 0x13f00b53,
+    0x94b00000, 0x93f00000, 0x98c00000, 0x18c00003, 0x13f00b53, 0x98c00000, 0x93f00000, 0x98900000,
+    0x18900003, 0x13f00b53, 0x98900000, 0x93f00000, 0x9ae00000, 0x1ae00003, 0x13f00b53, 0x9ae00000,
+    0x93f00000, 0x9bb00000, 0x1bb00003, 0x13f00b53, 0x9bb00000, 0x93f00000, 0x9c200000, 0x1c200003,
+    0x13f00b53, 0x9c200000, 0x93f00000, 0x9ba00000, 0x1ba00003, 0x13f00b53, 0x9ba00000, 0x93f00000,
+    0x9bc00000, 0x1bc00003, 0x13f00b53, 0x9bc00000, 0x93f00000, 0x9c600000, 0x1c600002, 0x13f00b53,
+    0x9c600000, 0x93f00000, 0x9bf00000, 0x1bf00002, 0x13f00b53, 0x9bf00000, 0x93f00000, 0x9d500000,
+    0x1d500002, 0x13f00b53, 0x9d500000, 0x93f00000, 0x9d300000, 0x9b000000, 0x9be00000, 0x9bd00000,
+    0x9b100000, 0x98e00000, 0x9a800000, 0x88c00000, 0x08c000c3, 0x88c00000, 0x08c00003, 0x1a800b53,
+    0x88c00000, 0x9a800000, 0x1a800004, 0x97e00000, 0x17e00012, 0x9a800000, 0x1a800003, 0x08c00b53,
+    0x9a800000, 0x88c00000, 0x08c00003, 0x1a800b53, 0x88c00000, 0x9a800000, 0x1a800003, 0x08c00b53,
+    0x9a800000, 0x88c00000, 0x08c00003, 0x1a800b53, 0x88c00000, 0x9a800000, 0x1a800003, 0x08c00b53,
+    0x9a800000, 0x88c00000, 0x08c00102, 0x88c00000, 0x94400000, 0x144001c2, 0x08c0000f, 0x88c00000,
+    0x08c00041, 0x94400000, 0x88c00000, 0x08c0003d, 0x88c00000, 0x08c00045, 0x97e00000, 0x17e00060,
+    0x93600000, 0x1360006c, 0x88c00000, 0x08c00003, 0x14400b53, 0x88c00000, 0x94400000, 0x1440001d,
+    0x08c00b53, 0x94400000, 0x1440000d, 0x94400000, 0x88c00000, 0x99300000, 0x19300003, 0x08c00b53,
+    0x99300000, 0x88c00000, 0x08c00104, 0x93600000, 0x13600036, 0x88c00000, 0x98f00000, 0x93600000,
+    0x97f00000, 0x97e00000, 0x8ce00000, 0x0ce0001e, 0x17e0001f, 0x17f00078, 0x13600078, 0x93600000,
+    0x97f00000, 0x8ce00000, 0x95000000, 0x15000021, 0x0ce00022, 0x17f00084, 0x13600084, 0x93600000,
+    0x97f00000, 0x95000000, 0x97e00000, 0x17e0001e, 0x1500001f, 0x17f00078, 0x13600078, 0x93600000,
+    0x97f00000, 0x97e00000, 0x8ce00000, 0x0ce00021, 0x17e00022, 0x17f00084, 0x13600084, 0x93600000,
+    0x97f00000, 0x8ce00000, 0x95000000, 0x1500001e, 0x0ce0001f, 0x17f00078, 0x13600078, 0x93600000,
+    0x97f00000, 0x95000000, 0x97e00000, 0x17e00021, 0x15000022, 0x17f00084, 0x13600084, 0x93600000,
+    0x97f00000, 0x97e00000, 0x17e00010, 0x57e00020, 0x57e00030, 0x57e00040, 0x17f00009, 0x57f00012,
+    0x84700000, 0x92100000, 0x92500000, 0x92000000, 0x92400000, 0x92700000, 0x84600000, 0x62600060,
+    0x62600050, 0x62600040, 0x62600030, 0x62600020, 0x62600010, 0xa2600000, 0x84800000, 0x62700008,
+    0x9fa00000, 0xa0000000, 0x9f900000, 0x9fd00000, 0x9fb00000, 0x9fc00000, 0x9ff00000, 0x51d00060,
+    0x51d00050, 0x51d00040, 0x51d00030, 0x51d00020, 0x51d00010, 0x91d00000, 0x9fe00000, 0xa2700000,
+    0x88100000, 0x4ee00030, 0x4ee00020, 0x4ee00010, 0x8ee00000, 0x4d600008, 0x8d500000, 0x8e200000,
+    0x87f00000, 0x9f200000, 0x9ee00000, 0x89100000, 0x88d00000, 0x9ed00000, 0x91f00000, 0x89f00000,
+    0x90a00000, 0x9f500000, 0x9f700000, 0x9f300000, 0x5f4000c0, 0x5f4000b0, 0x5f4000a0, 0x5f400090,
+    0x5f400080, 0x5f400070, 0x5f400060, 0x5f400050, 0x5f400040, 0x5f400030, 0x5f400020, 0x5f400010,
+    0x9f400000, 0x9ef00000, 0x5f600048, 0x87000000, 0x84900000, 0x87800000, 0x9e700000, 0x85c00000,
+    0x4c300080, 0x4c300070, 0x4c300060, 0x4c300050, 0x4c300040, 0x4c300030, 0x4c300020, 0x4c300010,
+    0x8c300000, 0x86f00000, 0x8c500000, 0x86900000, 0x50400020, 0x50400010, 0x90400000, 0x87400000,
+    0x5f600040, 0x87300000, 0x87500000, 0x47600080, 0x47600070, 0x47600060, 0x47600050, 0x47600040,
+    0x47600030, 0x47600020, 0x47600010, 0x87600000, 0xa2500000, 0x5f600038, 0x60300090, 0x60300080,
+    0x60300070, 0x60300060, 0x60300050, 0x60300040, 0x60300030, 0x60300020, 0x60300010, 0xa0300000,
+    0xa1100000, 0x5f600030, 0x45300090, 0x45300080, 0x45300070, 0x45300060, 0x45300050, 0x45300040,
+    0x45300030, 0x45300020, 0x45300010, 0x85300000, 0x85100000, 0x5f600028, 0x44e000b0, 0x44e000a0,
+    0x44e00090, 0x44e00080, 0x44e00070, 0x44e00060, 0x44e00050, 0x44e00040, 0x44e00030, 0x44e00020,
+    0x44e00010, 0x84e00000, 0x87b00000, 0x5f600020, 0x85400000, 0x8dd00000, 0x85a00000, 0x87c00000,
+    0x87d00000, 0x47900010, 0x87900000, 0x87a00000, 0x8de00000, 0x47700050, 0x47700040, 0x47700030,
+    0x47700020, 0x47700010, 0x87700000, 0x88500000, 0x5f600018, 0x8d800000, 0x8da00000, 0x45200080,
+    0x45200070, 0x45200060, 0x45200050, 0x45200040, 0x45200030, 0x45200020, 0x45200010, 0x85200000,
+    0x49500010, 0x4d900080, 0x4d900070, 0x4d900060, 0x4d900050, 0x4d900040, 0x4d900030, 0x4d900020,
+    0x4d900010, 0x8d900000, 0x8db00000, 0x5f600010, 0x88400000, 0x89400000, 0x80000000, 0x8dc00000,
+    0x48300060, 0x48300050, 0x48300040, 0x48300030, 0x48300020, 0x48300010, 0x88300000, 0x88200000,
+    0x5f600008, 0x88800000, 0x48700008, 0xa0200000, 0x84a00000, 0x84d00000, 0x88700000, 0x88a00000,
+    0x4e100060, 0x4e100050, 0x4e100040, 0x4e100030, 0x4e100020, 0x4e100010, 0x8e100000, 0x88900000,
+    0x4e000030, 0x89700000, 0x49800008, 0x84c00000, 0xa1600000, 0xa1800000, 0x89800000, 0x89600000,
+    0x40100060, 0x40100050, 0x40100040, 0x40100030, 0x40100020, 0x40100010, 0x80100000, 0x89900000,
+    0x4e000028, 0xa1e00000, 0x61f00008, 0xa1900000, 0xa1c00000, 0xa1a00000, 0xa1f00000, 0xa1d00000,
+    0x61b00060, 0x61b00050, 0x61b00040, 0x61b00030, 0x61b00020, 0x61b00010, 0xa1b00000, 0xa0400000,
+    0x4e000020, 0xa0700000, 0x46e00008, 0xa1000000, 0xa0900000, 0xa0e00000, 0x86e00000, 0x99400000,
+    0x61500060, 0x61500050, 0x61500040, 0x61500030, 0x61500020, 0x61500010, 0xa1500000, 0x9e800000,
+    0x4e000018, 0xa0600000, 0x60b00008, 0x84f00000, 0x85700000, 0xa1200000, 0xa0b00000, 0xa0c00000,
+    0x60a00060, 0x60a00050, 0x60a00040, 0x60a00030, 0x60a00020, 0x60a00010, 0xa0a00000, 0xa0500000,
+    0x4e000010, 0xa1300000, 0x61700008, 0x8ac00000, 0x9a100000, 0x97200000, 0xa1700000, 0xa1400000,
+    0x62200060, 0x62200050, 0x62200040, 0x62200030, 0x62200020, 0x62200010, 0xa2200000, 0xa0d00000,
+    0x4e000008, 0x9c000000, 0x5b800008, 0x9af00000, 0x9c100000, 0x9b900000, 0x9b800000, 0x9b600000,
+    0x5a300060, 0x5a300050, 0x5a300040, 0x5a300030, 0x5a300020, 0x5a300010, 0x9a300000, 0x9a400000,
+    0x8e000000, 0x8df00000, 0x48600040, 0x48600030, 0x48600020, 0x48600010, 0x88600000, 0x9f600000,
+    0x99000000, 0x62800040, 0x62800030, 0x62800020, 0x62800010, 0xa2800000, 0x52600008, 0x9e400000,
+    0x9e500000, 0x9a600000, 0x9d700000, 0x9d900000, 0x99600000, 0x9eb00000, 0x59700010, 0x99700000,
+    0x9b500000, 0xa0800000, 0x8c900000, 0x5b400090, 0x5b400080, 0x5b400070, 0x5b400060, 0x5b400050,
+    0x5b400040, 0x5b400030, 0x5b400020, 0x5b400010, 0x9b400000, 0x9b700000, 0x5c300008, 0x9e000000,
+    0x9e300000, 0x85000000, 0x9dc00000, 0x9e600000, 0xa2400000, 0x9a500000, 0x49b00010, 0x89b00000,
+    0xa2000000, 0x9ab00000, 0x9f100000, 0x60f00090, 0x60f00080, 0x60f00070, 0x60f00060, 0x60f00050,
+    0x60f00040, 0x60f00030, 0x60f00020, 0x60f00010, 0xa0f00000, 0x9f800000, 0x9c300000, 0xa2a00000,
+    0x52200040, 0x52200030, 0x52200020, 0x52200010, 0x92200000, 0x92600000, 0x8ec00000, 0x8eb00000,
+    0x8d600000, 0x8d000000, 0x4e300020, 0x4e300010, 0x8e300000, 0x49500008, 0x9ac00000, 0x86d00000,
+    0x96900000, 0x9e900000, 0x9ea00000, 0x5ad000c0, 0x5ad000b0, 0x5ad000a0, 0x5ad00090, 0x5ad00080,
+    0x5ad00070, 0x5ad00060, 0x5ad00050, 0x5ad00040, 0x5ad00030, 0x5ad00020, 0x5ad00010, 0x9ad00000,
+    0xa0100000, 0x89500000, 0x8d300000, 0x46600030, 0x46600020, 0x46600010, 0x86600000, 0x57f0001b,
+    0x06600009, 0x46600012, 0x4660001b, 0x46600024, 0x4660002d, 0x0d300009, 0x4d300012, 0x4d30001b,
+    0x4d300024, 0x4d30002d, 0x4d300036, 0x09500009, 0x49500012, 0x20100009, 0x60100012, 0x1ad00009,
+    0x5ad00012, 0x1ea00009, 0x5ea00012, 0x1e900009, 0x5e900012, 0x16900009, 0x56900012, 0x06d00008,
+    0x1ac00010, 0x5ac00020, 0x5ac00030, 0x0e300018, 0x0d000008, 0x5ac00020, 0x5ac00010, 0x9ac00000,
+    0x1ac00010, 0x0d600009, 0x4d600012, 0x4d60001b, 0x5ac00020, 0x4d600024, 0x4d60002d, 0x0eb00008,
+    0x0ec00010, 0x4ec00020, 0x4ec00030, 0x4ec00020, 0x4ec00010, 0x8ec00000, 0x0ec00010, 0x12600009,
+    0x52600012, 0x4ec00020, 0x4ec00030, 0x4ec00040, 0x4ec00050, 0x12200018, 0x22a00008, 0x1c300008,
+    0x1f800010, 0x20f00009, 0x60f00012, 0x60f0001b, 0x60f00024, 0x60f0002d, 0x60f00036, 0x5c300010,
+    0x1f100005, 0x1ab00014, 0x22000014, 0xa2000000, 0x9ab00000, 0x9f100000, 0x1f100016, 0x1ab00058,
+    0x22000058, 0xa2000000, 0x9ab00000, 0x1ab00010, 0x22000009, 0x62000012, 0x6200001b, 0x62000024,
+    0x6200002d, 0x62000036, 0x5ab00020, 0x5c300018, 0x09b00005, 0x1a500014, 0x22400014, 0xa2400000,
+    0x9a500000, 0x89b00000, 0x09b00014, 0x1a500050, 0x22400050, 0xa2400000, 0x9a500000, 0x1a500010,
+    0x5a500020, 0x22400009, 0x62400012, 0x6240001b, 0x62400024, 0x6240002d, 0x62400036, 0x5c300020,
+    0x1e600005, 0x1dc00014, 0x05000014, 0x85000000, 0x9dc00000, 0x9e600000, 0x1e600005, 0x1dc00014,
+    0x05000014, 0x85000000, 0x9dc00000, 0x1dc00010, 0x5dc00020, 0x05000009, 0x45000012, 0x4500001b,
+    0x45000024, 0x4500002d, 0x45000036, 0x5c300028, 0x1e300008, 0x1e000008, 0x1b70000c, 0x1b40000c,
+    0x9b700000, 0x9e300000, 0x9b400000, 0x9e000000, 0x1e000008, 0x1b400008, 0x1e30000c, 0x1b70000c,
+    0x9e300000, 0x9e000000, 0x9b700000, 0x9b400000, 0x1b400008, 0x1b700008, 0x1e00000c, 0x1e30000c,
+    0x9e000000, 0x9b400000, 0x9e300000, 0x9b700000, 0x1b700010, 0x1e300009, 0x5e300012, 0x5e30001b,
+    0x5e300024, 0x4eb00010, 0x1b400010, 0x5b400020, 0x5b400030, 0x5b400020, 0x5b400010, 0x9b400000,
+    0x1b400010, 0x1e000009, 0x5e000012, 0x5b400020, 0x5b400030, 0x5b400040, 0x5b400050, 0x0c900018,
+    0x20800008, 0x1b500008, 0x19700010, 0x1eb00009, 0x5eb00012, 0x5eb0001b, 0x5eb00024, 0x5eb0002d,
+    0x5eb00036, 0x5b500010, 0x19600005, 0x1d900014, 0x1d700014, 0x9d700000, 0x9d900000, 0x99600000,
+    0x19600015, 0x1d900054, 0x1d700054, 0x9d700000, 0x9d900000, 0x1d900010, 0x1d700009, 0x5d700012,
+    0x5d70001b, 0x5d700024, 0x5d70002d, 0x5d700036, 0x5d900020, 0x5b500018, 0x1a600005, 0x1e500014,
+    0x1e400014, 0x9e400000, 0x9e500000, 0x9a600000, 0x1a60000d, 0x1e500034, 0x1e400034, 0x9e400000,
+    0x9e500000, 0x1e500010, 0x5e500020, 0x1e400009, 0x5e400012, 0x5e40001b, 0x5e400024, 0x5e40002d,
+    0x5e400036, 0x5b500020, 0x22800005, 0x19000014, 0x1f600014, 0x9f600000, 0x99000000, 0xa2800000,
+    0x22800005, 0x19000014, 0x1f600014, 0x9f600000, 0x99000000, 0x19000010, 0x59000020, 0x1f600009,
+    0x5f600012, 0x5f60001b, 0x5f600024, 0x5f60002d, 0x5f600036, 0x5b500028, 0x08600008, 0x0df00008,
+    0x0e00000c, 0x1a40000c, 0x8e000000, 0x88600000, 0x9a400000, 0x8df00000, 0x0df00008, 0x1a400008,
+    0x0860000c, 0x0e00000c, 0x88600000, 0x8df00000, 0x8e000000, 0x9a400000, 0x1a400008, 0x0e000008,
+    0x0df0000c, 0x0860000c, 0x8df00000, 0x9a400000, 0x88600000, 0x8e000000, 0x0e000010, 0x08600009,
+    0x48600012, 0x4860001b, 0x48600024, 0x4eb00018, 0x1a400010, 0x5a400020, 0x5a400030, 0x5a400020,
+    0x5a400010, 0x9a400000, 0x1a400010, 0x0df00009, 0x4df00012, 0x5a400020, 0x5a400030, 0x5a400040,
+    0x5a400050, 0x1a300018, 0x1b600008, 0x1b800008, 0x1b900010, 0x1c100009, 0x5c100012, 0x5c10001b,
+    0x5c100024, 0x5c10002d, 0x5c100036, 0x5b800010, 0x1af00005, 0x1c000014, 0x20d00014, 0xa0d00000,
+    0x9c000000, 0x9af00000, 0x1af0000b, 0x1c00002c, 0x20d0002c, 0xa0d00000, 0x9c000000, 0x1c000010,
+    0x20d00009, 0x60d00012, 0x60d0001b, 0x60d00024, 0x60d0002d, 0x60d00036, 0x5c000020, 0x5b800018,
+    0x22200005, 0x21400014, 0x21700014, 0xa1700000, 0xa1400000, 0xa2200000, 0x22200009, 0x21400024,
+    0x21700024, 0xa1700000, 0xa1400000, 0x21400010, 0x61400020, 0x21700009, 0x61700012, 0x6170001b,
+    0x61700024, 0x6170002d, 0x61700036, 0x5b800020, 0x17200005, 0x1a100014, 0x0ac00014, 0x8ac00000,
+    0x9a100000, 0x97200000, 0x17200005, 0x1a100014, 0x0ac00014, 0x8ac00000, 0x9a100000, 0x1a100010,
+    0x5a100020, 0x0ac00009, 0x4ac00012, 0x4ac0001b, 0x4ac00024, 0x4ac0002d, 0x4ac00036, 0x5b800028,
+    0x21300008, 0x20500008, 0x20a0000c, 0x20c0000c, 0xa0a00000, 0xa1300000, 0xa0c00000, 0xa0500000,
+    0x20500008, 0x20c00008, 0x2130000c, 0x20a0000c, 0xa1300000, 0xa0500000, 0xa0a00000, 0xa0c00000,
+    0x20c00008, 0x20a00008, 0x2050000c, 0x2130000c, 0xa0500000, 0xa0c00000, 0xa1300000, 0xa0a00000,
+    0x20a00010, 0x21300009, 0x61300012, 0x6130001b, 0x61300024, 0x4eb00020, 0x20c00010, 0x60c00020,
+    0x60c00030, 0x60c00020, 0x60c00010, 0xa0c00000, 0x20c00010, 0x20500009, 0x60500012, 0x60c00020,
+    0x60c00030, 0x60c00040, 0x60c00050, 0x20b00018, 0x21200008, 0x05700008, 0x04f00010, 0x20600009,
+    0x60600012, 0x6060001b, 0x60600024, 0x6060002d, 0x60600036, 0x45700010, 0x1e800005, 0x21500014,
+    0x19400014, 0x99400000, 0xa1500000, 0x9e800000, 0x1e800009, 0x21500024, 0x19400024, 0x99400000,
+    0xa1500000, 0x21500010, 0x19400009, 0x59400012, 0x5940001b, 0x59400024, 0x5940002d, 0x59400036,
+    0x61500020, 0x45700018, 0x06e00005, 0x20e00014, 0x20900014, 0xa0900000, 0xa0e00000, 0x86e00000,
+    0x06e0000b, 0x20e0002c, 0x2090002c, 0xa0900000, 0xa0e00000, 0x20e00010, 0x60e00020, 0x20900009,
+    0x60900012, 0x6090001b, 0x60900024, 0x6090002d, 0x60900036, 0x45700020, 0x21000005, 0x20700014,
+    0x20400014, 0xa0400000, 0xa0700000, 0xa1000000, 0x21000005, 0x20700014, 0x20400014, 0xa0400000,
+    0xa0700000, 0x20700010, 0x60700020, 0x20400009, 0x60400012, 0x6040001b, 0x60400024, 0x6040002d,
+    0x60400036, 0x45700028, 0x21b00008, 0x21d00008, 0x21f0000c, 0x21a0000c, 0xa1f00000, 0xa1b00000,
+    0xa1a00000, 0xa1d00000, 0x21d00008, 0x21a00008, 0x21b0000c, 0x21f0000c, 0xa1b00000, 0xa1d00000,
+    0xa1f00000, 0xa1a00000, 0x21a00008, 0x21f00008, 0x21d0000c, 0x21b0000c, 0xa1d00000, 0xa1a00000,
+    0xa1b00000, 0xa1f00000, 0x21f00010, 0x21b00009, 0x61b00012, 0x61b0001b, 0x61b00024, 0x4eb00028,
+    0x21a00010, 0x61a00020, 0x61a00030, 0x61a00020, 0x61a00010, 0xa1a00000, 0x21a00010, 0x21d00009,
+    0x61d00012, 0x61a00020, 0x61a00030, 0x61a00040, 0x61a00050, 0x21c00018, 0x21900008, 0x21e00008,
+    0x09900010, 0x00100009, 0x40100012, 0x4010001b, 0x40100024, 0x4010002d, 0x40100036, 0x61e00010,
+    0x09600005, 0x09800014, 0x21800014, 0xa1800000, 0x89800000, 0x89600000, 0x09600010, 0x09800040,
+    0x21800040, 0xa1800000, 0x89800000, 0x09800010, 0x21800009, 0x61800012, 0x6180001b, 0x61800024,
+    0x6180002d, 0x61800036, 0x49800020, 0x61e00018, 0x21600005, 0x04c00014, 0x09700014, 0x89700000,
+    0x84c00000, 0xa1600000, 0x2160000d, 0x04c00034, 0x09700034, 0x89700000, 0x84c00000, 0x04c00010,
+    0x44c00020, 0x09700009, 0x49700012, 0x4970001b, 0x49700024, 0x4970002d, 0x49700036, 0x61e00020,
+    0x08900005, 0x0e100014, 0x08a00014, 0x88a00000, 0x8e100000, 0x88900000, 0x08900005, 0x0e100014,
+    0x08a00014, 0x88a00000, 0x8e100000, 0x0e100010, 0x4e100020, 0x08a00009, 0x48a00012, 0x48a0001b,
+    0x48a00024, 0x48a0002d, 0x48a00036, 0x61e00028, 0x08700008, 0x04d00008, 0x04a0000c, 0x2020000c,
+    0x84a00000, 0x88700000, 0xa0200000, 0x84d00000, 0x04d00008, 0x20200008, 0x0870000c, 0x04a0000c,
+    0x88700000, 0x84d00000, 0x84a00000, 0xa0200000, 0x20200008, 0x04a00008, 0x04d0000c, 0x0870000c,
+    0x84d00000, 0xa0200000, 0x88700000, 0x84a00000, 0x04a00010, 0x08700009, 0x48700012, 0x4870001b,
+    0x48700024, 0x4eb00030, 0x20200010, 0x60200020, 0x60200030, 0x60200020, 0x60200010, 0xa0200000,
+    0x20200010, 0x04d00009, 0x44d00012, 0x60200020, 0x60200030, 0x60200040, 0x60200050, 0x08800018,
+    0x08200008, 0x08300008, 0x0dc00010, 0x00000009, 0x40000012, 0x4000001b, 0x40000024, 0x4000002d,
+    0x40000036, 0x48300010, 0x09400005, 0x08400014, 0x0db00014, 0x8db00000, 0x88400000, 0x89400000,
+    0x09400016, 0x08400058, 0x0db00058, 0x8db00000, 0x88400000, 0x08400010, 0x0db00009, 0x4db00012,
+    0x4db0001b, 0x4db00024, 0x4db0002d, 0x4db00036, 0x48400020, 0x48300018, 0x0d900005, 0x05200014,
+    0x0da00014, 0x8da00000, 0x85200000, 0x8d900000, 0x0d900009, 0x05200024, 0x0da00024, 0x8da00000,
+    0x85200000, 0x05200010, 0x45200020, 0x0da00009, 0x4da00012, 0x4da0001b, 0x4da00024, 0x4da0002d,
+    0x4da00036, 0x48300020, 0x0d800005, 0x08500014, 0x07700014, 0x87700000, 0x88500000, 0x8d800000,
+    0x0d800005, 0x08500014, 0x07700014, 0x87700000, 0x88500000, 0x08500010, 0x48500020, 0x07700009,
+    0x47700012, 0x4770001b, 0x47700024, 0x4770002d, 0x47700036, 0x48300028, 0x0de00008, 0x07a00008,
+    0x0790000c, 0x07d0000c, 0x87900000, 0x8de00000, 0x87d00000, 0x87a00000, 0x07a00008, 0x07d00008,
+    0x0de0000c, 0x0790000c, 0x8de00000, 0x87a00000, 0x87900000, 0x87d00000, 0x07d00008, 0x07900008,
+    0x07a0000c, 0x0de0000c, 0x87a00000, 0x87d00000, 0x8de00000, 0x87900000, 0x07900010, 0x0de00009,
+    0x4de00012, 0x4de0001b, 0x4de00024, 0x4eb00038, 0x07d00010, 0x47d00020, 0x47d00030, 0x47d00020,
+    0x47d00010, 0x87d00000, 0x07d00010, 0x07a00009, 0x47a00012, 0x47d00020, 0x47d00030, 0x47d00040,
+    0x47d00050, 0x07c00018, 0x05a00008, 0x0dd00008, 0x05400010, 0x07b00009, 0x47b00012, 0x47b0001b,
+    0x47b00024, 0x47b0002d, 0x47b00036, 0x4dd00010, 0x04e00005, 0x05100014, 0x05300014, 0x85300000,
+    0x85100000, 0x84e00000, 0x04e00010, 0x05100040, 0x05300040, 0x85300000, 0x85100000, 0x05100010,
+    0x05300009, 0x45300012, 0x4530001b, 0x45300024, 0x4530002d, 0x45300036, 0x45100020, 0x4dd00018,
+    0x21100005, 0x20300014, 0x22500014, 0xa2500000, 0xa0300000, 0xa1100000, 0x21100009, 0x20300024,
+    0x22500024, 0xa2500000, 0xa0300000, 0x20300010, 0x60300020, 0x22500009, 0x62500012, 0x6250001b,
+    0x62500024, 0x6250002d, 0x62500036, 0x4dd00020, 0x07600005, 0x07500014, 0x07300014, 0x87300000,
+    0x87500000, 0x87600000, 0x07600005, 0x07500014, 0x07300014, 0x87300000, 0x87500000, 0x07500010,
+    0x47500020, 0x07300009, 0x47300012, 0x4730001b, 0x47300024, 0x4730002d, 0x47300036, 0x4dd00028,
+    0x07400008, 0x10400008, 0x0690000c, 0x0c50000c, 0x86900000, 0x87400000, 0x8c500000, 0x90400000,
+    0x10400008, 0x0c500008, 0x0740000c, 0x0690000c, 0x87400000, 0x90400000, 0x86900000, 0x8c500000,
+    0x0c500008, 0x06900008, 0x1040000c, 0x0740000c, 0x90400000, 0x8c500000, 0x87400000, 0x86900000,
+    0x06900010, 0x07400009, 0x47400012, 0x4740001b, 0x47400024, 0x4eb00040, 0x0c500010, 0x4c500020,
+    0x4c500030, 0x4c500020, 0x4c500010, 0x8c500000, 0x0c500010, 0x10400009, 0x50400012, 0x4c500020,
+    0x4c500030, 0x4c500040, 0x4c500050, 0x06f00018, 0x0c300008, 0x05c00008, 0x1e700010, 0x07800009,
+    0x47800012, 0x4780001b, 0x47800024, 0x4780002d, 0x47800036, 0x45c00010, 0x04900005, 0x07000014,
+    0x1ef00014, 0x9ef00000, 0x87000000, 0x84900000, 0x0490000a, 0x07000028, 0x1ef00028, 0x9ef00000,
+    0x87000000, 0x07000010, 0x1ef00009, 0x5ef00012, 0x5ef0001b, 0x5ef00024, 0x5ef0002d, 0x5ef00036,
+    0x47000020, 0x45c00018, 0x1f400005, 0x1f300014, 0x1f700014, 0x9f700000, 0x9f300000, 0x9f400000,
+    0x1f40000f, 0x1f30003c, 0x1f70003c, 0x9f700000, 0x9f300000, 0x1f300010, 0x5f300020, 0x1f700009,
+    0x5f700012, 0x5f70001b, 0x5f700024, 0x5f70002d, 0x5f700036, 0x45c00020, 0x1f500005, 0x10a00014,
+    0x09f00014, 0x89f00000, 0x90a00000, 0x9f500000, 0x1f500005, 0x10a00014, 0x09f00014, 0x89f00000,
+    0x90a00000, 0x10a00010, 0x50a00020, 0x09f00009, 0x49f00012, 0x49f0001b, 0x49f00024, 0x49f0002d,
+    0x49f00036, 0x45c00028, 0x11f00008, 0x1ed00008, 0x08d0000c, 0x0910000c, 0x88d00000, 0x91f00000,
+    0x89100000, 0x9ed00000, 0x1ed00008, 0x09100008, 0x11f0000c, 0x08d0000c, 0x91f00000, 0x9ed00000,
+    0x88d00000, 0x89100000, 0x09100008, 0x08d00008, 0x1ed0000c, 0x11f0000c, 0x9ed00000, 0x89100000,
+    0x91f00000, 0x88d00000, 0x08d00010, 0x11f00009, 0x51f00012, 0x51f0001b, 0x51f00024, 0x4eb00048,
+    0x09100010, 0x49100020, 0x49100030, 0x49100020, 0x49100010, 0x89100000, 0x09100010, 0x1ed00009,
+    0x5ed00012, 0x49100020, 0x49100030, 0x49100040, 0x49100050, 0x1ee00018, 0x1f200008, 0x07f00008,
+    0x0e200010, 0x0d500009, 0x4d500012, 0x4d50001b, 0x4d500024, 0x4d50002d, 0x4d500036, 0x47f00010,
+    0x0ee00005, 0x08100014, 0x22700014, 0xa2700000, 0x88100000, 0x8ee00000, 0x0ee0000f, 0x0810003c,
+    0x2270003c, 0xa2700000, 0x88100000, 0x08100010, 0x22700009, 0x62700012, 0x6270001b, 0x62700024,
+    0x6270002d, 0x62700036, 0x48100020, 0x47f00018, 0x1fe00005, 0x11d00014, 0x1ff00014, 0x9ff00000,
+    0x91d00000, 0x9fe00000, 0x1fe0000f, 0x11d0003c, 0x1ff0003c, 0x9ff00000, 0x91d00000, 0x11d00010,
+    0x51d00020, 0x1ff00009, 0x5ff00012, 0x5ff0001b, 0x5ff00024, 0x5ff0002d, 0x5ff00036, 0x47f00020,
+    0x1fc00005, 0x1fb00014, 0x1fd00014, 0x9fd00000, 0x9fb00000, 0x9fc00000, 0x1fc00005, 0x1fb00014,
+    0x1fd00014, 0x9fd00000, 0x9fb00000, 0x1fb00010, 0x5fb00020, 0x1fd00009, 0x5fd00012, 0x5fd0001b,
+    0x5fd00024, 0x5fd0002d, 0x5fd00036, 0x47f00028, 0x1f900008, 0x20000008, 0x1fa0000c, 0x0480000c,
+    0x9fa00000, 0x9f900000, 0x84800000, 0xa0000000, 0x20000008, 0x04800008, 0x1f90000c, 0x1fa0000c,
+    0x9f900000, 0xa0000000, 0x9fa00000, 0x84800000, 0x04800008, 0x1fa00008, 0x2000000c, 0x1f90000c,
+    0xa0000000, 0x84800000, 0x9f900000, 0x9fa00000, 0x1fa00010, 0x1f900009, 0x5f900012, 0x5f90001b,
+    0x5f900024, 0x4eb00050, 0x04800010, 0x44800020, 0x44800030, 0x44800020, 0x44800010, 0x84800000,
+    0x04800010, 0x20000009, 0x60000012, 0x44800020, 0x44800030, 0x44800040, 0x44800050, 0x22600018,
+    0x04600008, 0x12700008, 0x12400010, 0x12000009, 0x52000012, 0x5200001b, 0x52000024, 0x5200002d,
+    0x52000036, 0x52700010, 0x12500005, 0x12100014, 0x04700014, 0x84700000, 0x92100000, 0x92500000,
+    0x1250000e, 0x12100038, 0x04700038, 0x84700000, 0x92100000, 0x12100010, 0x04700009, 0x44700012,
+    0x4470001b, 0x44700024, 0x4470002d, 0x44700036, 0x52100020, 0x52700018, 0x13600005, 0x18f00014,
+    0x08c00014, 0x88c00000, 0x98f00000, 0x93600000, 0x1360000f, 0x18f0003c, 0x08c0003c, 0x88c00000,
+    0x98f00000, 0x18f00010, 0x58f00020, 0x08c00009, 0x48c00012, 0x48c0001b, 0x48c00024, 0x48c0002d,
+    0x48c00036, 0x52700020, 0x19300005, 0x14400014, 0x1a800014, 0x9a800000, 0x94400000, 0x99300000,
+    0x19300005, 0x14400014, 0x1a800014, 0x9a800000, 0x94400000, 0x14400010, 0x54400020, 0x1a800009,
+    0x5a800012, 0x5a80001b, 0x5a800024, 0x5a80002d, 0x5a800036, 0x52700028, 0x18e00008, 0x1b100008,
+    0x1bd0000c, 0x1be0000c, 0x9bd00000, 0x98e00000, 0x9be00000, 0x9b100000, 0x1b100008, 0x1be00008,
+    0x18e0000c, 0x1bd0000c, 0x98e00000, 0x9b100000, 0x9bd00000, 0x9be00000, 0x1be00008, 0x1bd00008,
+    0x1b10000c, 0x18e0000c, 0x9b100000, 0x9be00000, 0x98e00000, 0x9bd00000, 0x1bd00010, 0x18e00009,
+    0x58e00012, 0x58e0001b, 0x58e00024, 0x4eb00058, 0x1be00010, 0x5be00020, 0x5be00030, 0x5be00020,
+    0x5be00010, 0x9be00000, 0x1be00010, 0x1b100009, 0x5b100012, 0x5be00020, 0x5be00030, 0x5be00040,
+    0x5be00050, 0x1b000018, 0x1d300008, 0x13f00008, 0x1d500010, 0x1bf00009, 0x5bf00012, 0x5bf0001b,
+    0x5bf00024, 0x5bf0002d, 0x5bf00036, 0x53f00010, 0x1c600005, 0x1bc00014, 0x1ba00014, 0x9ba00000,
+    0x9bc00000, 0x9c600000, 0x1c600008, 0x1bc00020, 0x1ba00020, 0x9ba00000, 0x9bc00000, 0x1bc00010,
+    0x1ba00009, 0x5ba00012, 0x5ba0001b, 0x5ba00024, 0x5ba0002d, 0x5ba00036, 0x5bc00020, 0x53f00018,
+    0x1c200005, 0x1bb00014, 0x1ae00014, 0x9ae00000, 0x9bb00000, 0x9c200000, 0x1c20000f, 0x1bb0003c,
+    0x1ae0003c, 0x9ae00000, 0x9bb00000, 0x1bb00010, 0x5bb00020, 0x1ae00009, 0x5ae00012, 0x5ae0001b,
+    0x5ae00024, 0x5ae0002d, 0x5ae00036, 0x53f00020, 0x18900005, 0x18c00014, 0x14b00014, 0x94b00000,
+    0x98c00000, 0x98900000, 0x18900005, 0x18c00014, 0x14b00014, 0x94b00000, 0x98c00000, 0x18c00010,
+    0x58c00020, 0x14b00009, 0x54b00012, 0x54b0001b, 0x54b00024, 0x54b0002d, 0x54b00036, 0x53f00028,
+    0x18a00008, 0x14f00008, 0x1580000c, 0x1510000c, 0x95800000, 0x98a00000, 0x95100000, 0x94f00000,
+    0x14f00008, 0x15100008, 0x18a0000c, 0x1580000c, 0x98a00000, 0x94f00000, 0x95800000, 0x95100000,
+    0x15100008, 0x15800008, 0x14f0000c, 0x18a0000c, 0x94f00000, 0x95100000, 0x98a00000, 0x95800000,
+    0x15800010, 0x18a00009, 0x58a00012, 0x58a0001b, 0x58a00024, 0x4eb00060, 0x15100010, 0x55100020,
+    0x55100030, 0x55100020, 0x55100010, 0x95100000, 0x15100010, 0x14f00009, 0x54f00012, 0x55100020,
+    0x55100030, 0x55100040, 0x55100050, 0x14e00018, 0x15600008, 0x15700008, 0x15300010, 0x19b00009,
+    0x59b00012, 0x59b0001b, 0x59b00024, 0x59b0002d, 0x59b00036, 0x55700010, 0x19a00005, 0x15900014,
+    0x15200014, 0x95200000, 0x95900000, 0x99a00000, 0x19a00008, 0x15900020, 0x15200020, 0x95200000,
+    0x95900000, 0x15900010, 0x15200009, 0x55200012, 0x5520001b, 0x55200024, 0x5520002d, 0x55200036,
+    0x55900020, 0x55700018, 0x18600005, 0x18400014, 0x18500014, 0x98500000, 0x98400000, 0x98600000,
+    0x1860000f, 0x1840003c, 0x1850003c, 0x98500000, 0x98400000, 0x18400010, 0x58400020, 0x18500009,
+    0x58500012, 0x5850001b, 0x58500024, 0x5850002d, 0x58500036, 0x55700020, 0x1aa00005, 0x0ef00014,
+    0x1d600014, 0x9d600000, 0x8ef00000, 0x9aa00000, 0x1aa00005, 0x0ef00014, 0x1d600014, 0x9d600000,
+    0x8ef00000, 0x0ef00010, 0x4ef00020, 0x1d600009, 0x5d600012, 0x5d60001b, 0x5d600024, 0x5d60002d,
+    0x5d600036, 0x55700028, 0x1d800008, 0x1da00008, 0x1ca0000c, 0x1cc0000c, 0x9ca00000, 0x9d800000,
+    0x9cc00000, 0x9da00000, 0x1da00008, 0x1cc00008, 0x1d80000c, 0x1ca0000c, 0x9d800000, 0x9da00000,
+    0x9ca00000, 0x9cc00000, 0x1cc00008, 0x1ca00008, 0x1da0000c, 0x1d80000c, 0x9da00000, 0x9cc00000,
+    0x9d800000, 0x9ca00000, 0x1ca00010, 0x1d800009, 0x5d800012, 0x5d80001b, 0x5d800024, 0x4eb00068,
+    0x1cc00010, 0x5cc00020, 0x5cc00030, 0x5cc00020, 0x5cc00010, 0x9cc00000, 0x1cc00010, 0x1da00009,
+    0x5da00012, 0x5cc00020, 0x5cc00030, 0x5cc00040, 0x5cc00050, 0x1cd00018, 0x1c800008, 0x1c700008,
+    0x1ce00010, 0x1c500009, 0x5c500012, 0x5c50001b, 0x5c500024, 0x5c50002d, 0x5c500036, 0x5c700010,
+    0x1cf00005, 0x1dd00014, 0x1db00014, 0x9db00000, 0x9dd00000, 0x9cf00000, 0x1cf00008, 0x1dd00020,
+    0x1db00020, 0x9db00000, 0x9dd00000, 0x1dd00010, 0x1db00009, 0x5db00012, 0x5db0001b, 0x5db00024,
+    0x5db0002d, 0x5db00036, 0x5dd00020, 0x5c700018, 0x15400005, 0x17c00014, 0x18100014, 0x98100000,
+    0x97c00000, 0x95400000, 0x1540000f, 0x17c0003c, 0x1810003c, 0x98100000, 0x97c00000, 0x17c00010,
+    0x57c00020, 0x18100009, 0x58100012, 0x5810001b, 0x58100024, 0x5810002d, 0x58100036, 0x5c700020,
+    0x18300005, 0x18000014, 0x18200014, 0x98200000, 0x98000000, 0x98300000, 0x18300005, 0x18000014,
+    0x18200014, 0x98200000, 0x98000000, 0x18000010, 0x58000020, 0x18200009, 0x58200012, 0x5820001b,
+    0x58200024, 0x5820002d, 0x58200036, 0x5c700028, 0x17d00008, 0x14c00008, 0x1460000c, 0x18d0000c,
+    0x94600000, 0x97d00000, 0x98d00000, 0x94c00000, 0x14c00008, 0x18d00008, 0x17d0000c, 0x1460000c,
+    0x97d00000, 0x94c00000, 0x94600000, 0x98d00000, 0x18d00008, 0x14600008, 0x14c0000c, 0x17d0000c,
+    0x94c00000, 0x98d00000, 0x97d00000, 0x94600000, 0x14600010, 0x17d00009, 0x57d00012, 0x57d0001b,
+    0x57d00024, 0x4eb00070, 0x18d00010, 0x58d00020, 0x58d00030, 0x58d00020, 0x58d00010, 0x98d00000,
+    0x18d00010, 0x14c00009, 0x54c00012, 0x58d00020, 0x58d00030, 0x58d00040, 0x58d00050, 0x14700018,
+    0x14000008, 0x17100008, 0x16f00010, 0x17500009, 0x57500012, 0x5750001b, 0x57500024, 0x5750002d,
+    0x57500036, 0x57100010, 0x13500005, 0x11a00014, 0x16500014, 0x96500000, 0x91a00000, 0x93500000,
+    0x13500008, 0x11a00020, 0x16500020, 0x96500000, 0x91a00000, 0x11a00010, 0x16500009, 0x56500012,
+    0x5650001b, 0x56500024, 0x5650002d, 0x56500036, 0x51a00020, 0x57100018, 0x13e00005, 0x14200014,
+    0x13c00014, 0x93c00000, 0x94200000, 0x93e00000, 0x13e0000f, 0x1420003c, 0x13c0003c, 0x93c00000,
+    0x94200000, 0x14200010, 0x54200020, 0x13c00009, 0x53c00012, 0x53c0001b, 0x53c00024, 0x53c0002d,
+    0x53c00036, 0x57100020, 0x11b00005, 0x13d00014, 0x14500014, 0x94500000, 0x93d00000, 0x91b00000,
+    0x11b00005, 0x13d00014, 0x14500014, 0x94500000, 0x93d00000, 0x13d00010, 0x53d00020, 0x14500009,
+    0x54500012, 0x5450001b, 0x54500024, 0x5450002d, 0x54500036, 0x57100028, 0x14300008, 0x13b00008,
+    0x16a0000c, 0x1370000c, 0x96a00000, 0x94300000, 0x93700000, 0x93b00000, 0x13b00008, 0x13700008,
+    0x1430000c, 0x16a0000c, 0x94300000, 0x93b00000, 0x96a00000, 0x93700000, 0x13700008, 0x16a00008,
+    0x13b0000c, 0x1430000c, 0x93b00000, 0x93700000, 0x94300000, 0x96a00000, 0x16a00010, 0x14300009,
+    0x54300012, 0x5430001b, 0x54300024, 0x13700008, 0x13b00008, 0x1730000c, 0x1740000c, 0x97300000,
+    0x93700000, 0x97400000, 0x93b00000, 0x13b00008, 0x17400008, 0x1370000c, 0x1730000c, 0x93700000,
+    0x93b00000, 0x97300000, 0x97400000, 0x46d00010, 0x17400010, 0x57400020, 0x57400030, 0x57400020,
+    0x57400010, 0x97400000, 0x17400010, 0x17300009, 0x57300012, 0x13b00008, 0x13700010, 0x53700020,
+    0x53700030, 0x53700040, 0x10b00009, 0x50b00012, 0x50b0001b, 0x50b00024, 0x50b0002d, 0x50b00036,
+    0x50b0003f, 0x50b00048, 0x50b00051, 0x53b00010, 0x11400010, 0x51400020, 0x51400030, 0x51400020,
+    0x51400010, 0x91400000, 0x53b00018, 0x11400010, 0x51400020, 0x51400030, 0x51400020, 0x51400010,
+    0x91400000, 0x11400010, 0x0e400009, 0x4e400012, 0x4e40001b, 0x16300010, 0x17800009, 0x57800012,
+    0x5780001b, 0x16400008, 0x13000010, 0x16d00009, 0x56d00012, 0x56d0001b, 0x56d00024, 0x56400010,
+    0x11e00010, 0x16b00009, 0x56b00012, 0x56b0001b, 0x56b00024, 0x56400018, 0x11900010, 0x16e00009,
+    0x56e00012, 0x56e0001b, 0x56400020, 0x11800010, 0x17000009, 0x57000012, 0x5700001b, 0x56400028,
+    0x16800010, 0x56800020, 0x56800030, 0x56800020, 0x56800010, 0x96800000, 0x16800010, 0x15d00009,
+    0x55d00012, 0x55d0001b, 0x55d00024, 0x55d0002d, 0x55d00036, 0x17700008, 0x14100005, 0x16700014,
+    0x17900014, 0x97900000, 0x96700000, 0x16700010, 0x17900009, 0x57900012, 0x94100000, 0x14100016,
+    0x16600058, 0x16c00058, 0x96c00000, 0x96600000, 0x5790001b, 0x57700010, 0x16600005, 0x16c00014,
+    0x0cc00014, 0x8cc00000, 0x96c00000, 0x16c00010, 0x0cc00009, 0x4cc00012, 0x96600000, 0x16600014,
+    0x0e800050, 0x0d700050, 0x8d700000, 0x8e800000, 0x57700018, 0x0e800005, 0x0d700014, 0x12900014,
+    0x92900000, 0x8d700000, 0x0d700010, 0x12900009, 0x52900012, 0x8e800000, 0x0e80000c, 0x15f00030,
+    0x16100030, 0x96100000, 0x95f00000, 0x56400030, 0x15f00010, 0x55f00020, 0x55f00030, 0x55f00020,
+    0x55f00010, 0x95f00000, 0x15f00010, 0x16100009, 0x56100012, 0x5610001b, 0x56100024, 0x5610002d,
+    0x56100036, 0x10300008, 0x50300010, 0x50300018, 0x50300020, 0x56400038, 0x15c00010, 0x55c00020,
+    0x55c00030, 0x55c00020, 0x55c00010, 0x95c00000, 0x15c00010, 0x12e00009, 0x52e00012, 0x52e0001b,
+    0x52e00024, 0x52e0002d, 0x15e00008, 0x15b00010, 0x12800009, 0x52800012, 0x5280001b, 0x52800024,
+    0x5280002d, 0x52800036, 0x55e00010, 0x16000010, 0x16200009, 0x56200012, 0x5620001b, 0x56200024,
+    0x5620002d, 0x56200036, 0x55e00018, 0x12300010, 0x13800009, 0x53800012, 0x5380001b, 0x53800024,
+    0x5380002d, 0x53800036, 0x11200018, 0x17600008, 0x55e00020, 0x04b00010, 0x22100009, 0x62100012,
+    0x6210001b, 0x62100024, 0x6210002d, 0x62100036, 0x6210003f, 0x22300018, 0x11500008, 0x62100048,
+    0x55e00028, 0x13900010, 0x0fa00009, 0x4fa00012, 0x4fa0001b, 0x4fa00024, 0x4fa0002d, 0x4fa00036,
+    0x10600018, 0x10700008, 0x55e00030, 0x10e00010, 0x50e00020, 0x50e00030, 0x50e00040, 0x50e00050,
+    0x50e00060, 0x50e00070, 0x50e00080, 0x50e00090, 0x50e000a0, 0x0fe00018, 0x50e000b0, 0x0ff00009,
+    0x4ff00012, 0x4ff0001b, 0x4ff00024, 0x4ff0002d, 0x4ff00036, 0x4ff0003f, 0x4ff00048, 0x50e000c0,
+    0x0f700009, 0x4f700012, 0x4f70001b, 0x4f700024, 0x4f70002d, 0x4f700036, 0x50e000d0, 0x0f900009,
+    0x4f900012, 0x4f90001b, 0x4ff00051, 0x0f200018, 0x10800008, 0x55e00038, 0x0f800005, 0x10f00014,
+    0x11300014, 0x91300000, 0x90f00000, 0x10f00010, 0x11300009, 0x51300012, 0x8f800000, 0x0f800005,
+    0x10000014, 0x13a00014, 0x93a00000, 0x90000000, 0x5130001b, 0x51300024, 0x5130002d, 0x51300036,
+    0x5130003f, 0x51300048, 0x10000018, 0x13a00008, 0x56400040, 0x07e00010, 0x47e00020, 0x47e00030,
+    0x47e00020, 0x47e00010, 0x87e00000, 0x07e00010, 0x10500009, 0x0f000018, 0x0f300008, 0x05800008,
+    0x10100010, 0x0a400009, 0x4a400012, 0x4a40001b, 0x0fc00018, 0x0a500008, 0x56400048, 0x0fd00010,
+    0x4fd00020, 0x4fd00030, 0x4fd00020, 0x4fd00010, 0x8fd00000, 0x0fd00010, 0x0fb00009, 0x4fb00012,
+    0x4fb0001b, 0x4fb00024, 0x4fb0002d, 0x4fb00036, 0x4fb0003f, 0x4fb00048, 0x0f100008, 0x0cd00005,
+    0x11600014, 0x05900014, 0x85900000, 0x91600000, 0x8cd00000, 0x0cd0000b, 0x1160002c, 0x0590002c,
+    0x85900000, 0x91600000, 0x11600010, 0x05900009, 0x45900012, 0x4f100010, 0x11700010, 0x51700020,
+    0x51700030, 0x51700040, 0x0a100009, 0x4a100012, 0x4a10001b, 0x4a100024, 0x50b0005a, 0x50b00063,
+    0x50b0006c, 0x50b00075, 0x55d0003f, 0x55d00048, 0x55d00051, 0x55d0005a, 0x55d00063, 0x55d0006c,
+    0x5610003f, 0x56100048, 0x56100051, 0x5610005a, 0x56100063, 0x5610006c, 0x50500012, 0x5050001b,
+    0x50500024, 0x5050002d, 0x50500036, 0x5050003f, 0x52e00036, 0x52e0003f, 0x52e00048, 0x52e00051,
+    0x52e0005a, 0x52e00063, 0x4fb00051, 0x4fb0005a, 0x4fb00063, 0x4fb0006c, 0x4fb00075, 0x4fb0007e,
+    0x0a900048, 0x0aa00048, 0x0c100098, 0x0ea00098, 0x0bb00098, 0x0ed00098, 0x0d400098, 0x0a200098,
+    0x0f400098, 0x09c00098, 0x09d00098, 0x0e900098, 0x13300098, 0x13400098, 0x0f600098, 0x12c00098,
+    0x12d00098, 0x13100098, 0x0f500098, 0x13200098, 0x0a700098, 0x12b00098, 0x0a300098, 0x55d00075,
+    0x12a00098, 0x56100075, 0x08e00098, 0x52e0006c, 0x12f00098, 0x4fb00087, 0x10200098, 0x4a400024,
+    0x10c00098, 0x50500048, 0x10900098, 0x0a000008, 0x10d00008, 0x0a80001c, 0x0b90001c, 0x8a800000,
+    0x8a000000, 0x8b900000, 0x90d00000, 0x10d00034, 0x0b900034, 0x0a000004, 0x0a800004, 0x8a000000,
+    0x90d00000, 0x8a800000, 0x8b900000, 0x0b900008, 0x0a800008, 0x10d0001c, 0x0a00001c, 0x90d00000,
+    0x8b900000, 0x8a000000, 0x8a800000, 0x0a800034, 0x0a000034, 0x0b900004, 0x10d00004, 0x8b900000,
+    0x8a800000, 0x90d00000, 0x8a000000, 0x0a000008, 0x10d00008, 0x0a80001c, 0x0b90001c, 0x8a800000,
+    0x8a000000, 0x8b900000, 0x90d00000, 0x10d00034, 0x0b900034, 0x0a000004, 0x0a800004, 0x8a000000,
+    0x90d00000, 0x8a800000, 0x8b900000, 0x0b900034, 0x0a800034, 0x10d00004, 0x0a000004, 0x90d00000,
+    0x8b900000, 0x8a000000, 0x8a800000, 0x46d00018, 0x0a800010, 0x0a000009, 0x4a000012, 0x4a00001b,
+    0x46d00020, 0x0b900005, 0x10d00014, 0x0ad00014, 0x8ad00000, 0x90d00000, 0x8b900000, 0x0b900017,
+    0x10d0005c, 0x0ad0005c, 0x8ad00000, 0x90d00000, 0x10d00010, 0x0ad00009, 0x4ad00012, 0x4ad0001b,
+    0x0b300098, 0x4ad00024, 0x4ad0002d, 0x4ad00036, 0x4ad0003f, 0x0b500098, 0x0ba00320, 0x0b100042,
+    0x8ba00000, 0x0ba0000b, 0x0b400b53, 0x8ba00000, 0x0ba0000d, 0x8ba00000, 0x8b400000, 0x0b400102,
+    0x8b400000, 0x0b40001d, 0x0ba00b53, 0x8b400000, 0x0b40000d, 0x8b400000, 0x8ba00000, 0x0ba02dd3,
+    0x0b4001c2, 0x0e700054, 0x0ae0000f, 0x8ae00000, 0x0ae00041, 0x8b400000, 0x8ae00000, 0x0ae0003d,
+    0x8ae00000, 0x0ae00045, 0x0b400060, 0x0b70006c, 0x8ae00000, 0x0ae00104, 0x8b400000, 0x0b400036,
+    0x8ae00000, 0x0ae00104, 0x8ae00000, 0x0ae02dd3, 0x8ba00000, 0x0ba001c2, 0x0b00000f, 0x8b000000,
+    0x0b000041, 0x8ba00000, 0x8b000000, 0x0b00003d, 0x8b000000, 0x0b000045, 0x8b400000, 0x0b400060,
+    0x8b000000, 0x0b000003, 0x0ba00b53, 0x8b000000, 0x8ba00000, 0x0ba00104, 0x8b400000, 0x0b400036,
+    0x8ba00000, 0x0ba00104, 0x8ba00000, 0x8ae00000, 0x0ae00003, 0x0ba00b53, 0x8ae00000, 0x8ba00000,
+    0x0ba00104, 0x8ba00000, 0x8b100000, 0x8e700000, 0x8b400000, 0x8b700000, 0x8ce00000, 0x0ce0001e,
+    0x0b70001f, 0x0b400078, 0x0e700078, 0x8e700000, 0x8b400000, 0x8ce00000, 0x95000000, 0x15000021,
+    0x0ce00022, 0x0b400084, 0x0e700084, 0x8e700000, 0x8b400000, 0x95000000, 0x8b700000, 0x0b70001e,
+    0x1500001f, 0x0b400078, 0x0e700078, 0x8e700000, 0x8b400000, 0x8b700000, 0x8ce00000, 0x0ce00021,
+    0x0b700022, 0x0b400084, 0x0e700084, 0x8e700000, 0x8b400000, 0x8ce00000, 0x95000000, 0x1500001e,
+    0x0ce0001f, 0x0b400078, 0x0e700078, 0x8e700000, 0x8b400000, 0x95000000, 0x8b700000, 0x0b700021,
+    0x15000022, 0x0b400084, 0x0e700084, 0x8e700000, 0x8b400000, 0x8b700000, 0x0b700010, 0x4b700020,
+    0x4b700030, 0x4b700040, 0x0b400009, 0x4b400012, 0x86600000, 0x8d300000, 0x89500000, 0xa0100000,
+    0x9ad00000, 0x9ea00000, 0x9e900000, 0x96900000, 0x8e300000, 0x8d000000, 0x92200000, 0xa2a00000,
+    0xa0f00000, 0x9f800000, 0x5c300020, 0x9f100000, 0xa2000000, 0x5ab00010, 0x9ab00000, 0x5c300018,
+    0x89b00000, 0xa2400000, 0x5a500010, 0x9a500000, 0x5c300010, 0x9e600000, 0x85000000, 0x5dc00010,
+    0x9dc00000, 0x5c300008, 0x9e300000, 0x9b700000, 0x9c300000, 0x92600000, 0x4ec00040, 0x4ec00030,
+    0x4ec00020, 0x4ec00010, 0x8ec00000, 0x4eb00068, 0x8c900000, 0xa0800000, 0x9eb00000, 0x99700000,
+    0x5b500020, 0x99600000, 0x9d700000, 0x5d900010, 0x9d900000, 0x5b500018, 0x9a600000, 0x9e400000,
+    0x5e500010, 0x9e500000, 0x5b500010, 0xa2800000, 0x9f600000, 0x59000010, 0x99000000, 0x5b500008,
+    0x88600000, 0x8e000000, 0x9b500000, 0x9e000000, 0x5b400040, 0x5b400030, 0x5b400020, 0x5b400010,
+    0x9b400000, 0x4eb00060, 0x9a300000, 0x9b600000, 0x9c100000, 0x9b900000, 0x5b800020, 0x9af00000,
+    0xa0d00000, 0x5c000010, 0x9c000000, 0x5b800018, 0xa2200000, 0xa1700000, 0x61400010, 0xa1400000,
+    0x5b800010, 0x97200000, 0x8ac00000, 0x5a100010, 0x9a100000, 0x5b800008, 0xa1300000, 0xa0a00000,
+    0x9b800000, 0x8df00000, 0x5a400040, 0x5a400030, 0x5a400020, 0x5a400010, 0x9a400000, 0x4eb00058,
+    0xa0b00000, 0xa1200000, 0xa0600000, 0x84f00000, 0x45700020, 0x9e800000, 0x99400000, 0x61500010,
+    0xa1500000, 0x45700018, 0x86e00000, 0xa0900000, 0x60e00010, 0xa0e00000, 0x45700010, 0xa1000000,
+    0xa0400000, 0x60700010, 0xa0700000, 0x45700008, 0xa1b00000, 0xa1f00000, 0x85700000, 0xa0500000,
+    0x60c00040, 0x60c00030, 0x60c00020, 0x60c00010, 0xa0c00000, 0x4eb00050, 0xa1c00000, 0xa1900000,
+    0x80100000, 0x89900000, 0x61e00020, 0x89600000, 0xa1800000, 0x49800010, 0x89800000, 0x61e00018,
+    0xa1600000, 0x89700000, 0x44c00010, 0x84c00000, 0x61e00010, 0x88900000, 0x88a00000, 0x4e100010,
+    0x8e100000, 0x61e00008, 0x88700000, 0x84a00000, 0xa1e00000, 0xa1d00000, 0x61a00040, 0x61a00030,
+    0x61a00020, 0x61a00010, 0xa1a00000, 0x4eb00048, 0x88800000, 0x88200000, 0x80000000, 0x8dc00000,
+    0x48300020, 0x89400000, 0x8db00000, 0x48400010, 0x88400000, 0x48300018, 0x8d900000, 0x8da00000,
+    0x45200010, 0x85200000, 0x48300010, 0x8d800000, 0x87700000, 0x48500010, 0x88500000, 0x48300008,
+    0x8de00000, 0x87900000, 0x88300000, 0x84d00000, 0x60200040, 0x60200030, 0x60200020, 0x60200010,
+    0xa0200000, 0x4eb00040, 0x87c00000, 0x85a00000, 0x87b00000, 0x85400000, 0x4dd00020, 0x84e00000,
+    0x85300000, 0x45100010, 0x85100000, 0x4dd00018, 0xa1100000, 0xa2500000, 0x60300010, 0xa0300000,
+    0x4dd00010, 0x87600000, 0x87300000, 0x47500010, 0x87500000, 0x4dd00008, 0x87400000, 0x86900000,
+    0x8dd00000, 0x87a00000, 0x47d00040, 0x47d00030, 0x47d00020, 0x47d00010, 0x87d00000, 0x4eb00038,
+    0x86f00000, 0x8c300000, 0x87800000, 0x9e700000, 0x45c00020, 0x84900000, 0x9ef00000, 0x47000010,
+    0x87000000, 0x45c00018, 0x9f400000, 0x9f700000, 0x5f300010, 0x9f300000, 0x45c00010, 0x9f500000,
+    0x89f00000, 0x50a00010, 0x90a00000, 0x45c00008, 0x91f00000, 0x88d00000, 0x85c00000, 0x90400000,
+    0x4c500040, 0x4c500030, 0x4c500020, 0x4c500010, 0x8c500000, 0x4eb00030, 0x9ee00000, 0x9f200000,
+    0x8d500000, 0x8e200000, 0x47f00020, 0x8ee00000, 0xa2700000, 0x48100010, 0x88100000, 0x47f00018,
+    0x9fe00000, 0x9ff00000, 0x51d00010, 0x91d00000, 0x47f00010, 0x9fc00000, 0x9fd00000, 0x5fb00010,
+    0x9fb00000, 0x47f00008, 0x9f900000, 0x9fa00000, 0x87f00000, 0x9ed00000, 0x49100040, 0x49100030,
+    0x49100020, 0x49100010, 0x89100000, 0x4eb00028, 0xa2600000, 0x84600000, 0x92000000, 0x92400000,
+    0x52700020, 0x92500000, 0x84700000, 0x52100010, 0x92100000, 0x52700018, 0x93600000, 0x88c00000,
+    0x58f00010, 0x98f00000, 0x52700010, 0x99300000, 0x9a800000, 0x54400010, 0x94400000, 0x52700008,
+    0x98e00000, 0x9bd00000, 0x92700000, 0xa0000000, 0x44800040, 0x44800030, 0x44800020, 0x44800010,
+    0x84800000, 0x4eb00020, 0x9b000000, 0x9d300000, 0x9bf00000, 0x9d500000, 0x53f00020, 0x9c600000,
+    0x9ba00000, 0x5bc00010, 0x9bc00000, 0x53f00018, 0x9c200000, 0x9ae00000, 0x5bb00010, 0x9bb00000,
+    0x53f00010, 0x98900000, 0x94b00000, 0x58c00010, 0x98c00000, 0x53f00008, 0x98a00000, 0x95800000,
+    0x93f00000, 0x9b100000, 0x5be00040, 0x5be00030, 0x5be00020, 0x5be00010, 0x9be00000, 0x4eb00018,
+    0x94e00000, 0x95600000, 0x99b00000, 0x95300000, 0x55700020, 0x99a00000, 0x95200000, 0x55900010,
+    0x95900000, 0x55700018, 0x98600000, 0x98500000, 0x58400010, 0x98400000, 0x55700010, 0x9aa00000,
+    0x9d600000, 0x4ef00010, 0x8ef00000, 0x55700008, 0x9d800000, 0x9ca00000, 0x95700000, 0x94f00000,
+    0x55100040, 0x55100030, 0x55100020, 0x55100010, 0x95100000, 0x4eb00010, 0x9cd00000, 0x9c800000,
+    0x9c500000, 0x9ce00000, 0x5c700020, 0x9cf00000, 0x9db00000, 0x5dd00010, 0x9dd00000, 0x5c700018,
+    0x95400000, 0x98100000, 0x57c00010, 0x97c00000, 0x5c700010, 0x98300000, 0x98200000, 0x58000010,
+    0x98000000, 0x5c700008, 0x97d00000, 0x94600000, 0x9c700000, 0x9da00000, 0x5cc00040, 0x5cc00030,
+    0x5cc00020, 0x5cc00010, 0x9cc00000, 0x4eb00008, 0x94700000, 0x94000000, 0x97500000, 0x96f00000,
+    0x57100020, 0x93500000, 0x96500000, 0x51a00010, 0x91a00000, 0x57100018, 0x93e00000, 0x93c00000,
+    0x54200010, 0x94200000, 0x57100010, 0x91b00000, 0x94500000, 0x53d00010, 0x93d00000, 0x57100008,
+    0x94300000, 0x96a00000, 0x97100000, 0x94c00000, 0x58d00040, 0x58d00030, 0x58d00020, 0x58d00010,
+    0x98d00000, 0x8eb00000, 0x8d600000, 0x5ac00010, 0x9ac00000, 0x46d00018, 0x96d00000, 0x93000000,
+    0x56400040, 0x96b00000, 0x91e00000, 0x56400038, 0x96e00000, 0x91900000, 0x56400030, 0x97000000,
+    0x91800000, 0x56400028, 0x94100000, 0x97900000, 0x96700000, 0x57700010, 0x96600000, 0x8cc00000,
+    0x96c00000, 0x57700008, 0x8e800000, 0x92900000, 0x8d700000, 0x97700000, 0x95d00000, 0x96800000,
+    0x8a300000, 0x56400020, 0x50300018, 0x50300010, 0x50300008, 0x90300000, 0x96100000, 0x95f00000,
+    0x92a00000, 0x56400018, 0x92800000, 0x95b00000, 0x55e00030, 0x96200000, 0x96000000, 0x55e00028,
+    0x91200000, 0x97600000, 0x93800000, 0x92300000, 0x55e00020, 0xa2300000, 0x91500000, 0xa2100000,
+    0x84b00000, 0x55e00018, 0x90600000, 0x90700000, 0x8fa00000, 0x93900000, 0x55e00010, 0x8a900000,
+    0x8f200000, 0x90800000, 0x8ff00000, 0x50e000c0, 0x8f700000, 0x50e000b0, 0x8f900000, 0x50e000a0,
+    0x50e00090, 0x50e00080, 0x50e00070, 0x50e00060, 0x50e00050, 0x50e00040, 0x50e00030, 0x50e00020,
+    0x50e00010, 0x90e00000, 0x8fe00000, 0x55e00008, 0x90000000, 0x93a00000, 0x8f800000, 0x91300000,
+    0x90f00000, 0x95e00000, 0x92e00000, 0x95c00000, 0x88e00000, 0x56400010, 0x92b00000, 0x8a700000,
+    0x93200000, 0x8f500000, 0x93100000, 0x92d00000, 0x92c00000, 0x8f600000, 0x93400000, 0x93300000,
+    0x8e900000, 0x89d00000, 0x89c00000, 0x8f400000, 0x8a200000, 0x8d400000, 0x8ed00000, 0x8bb00000,
+    0x8ea00000, 0x8c100000, 0x8aa00000, 0x8f000000, 0x8f300000, 0x8fc00000, 0x8a500000, 0x8a400000,
+    0x90100000, 0x90900000, 0x90200000, 0x85800000, 0x90500000, 0x87e00000, 0x90c00000, 0x56400008,
+    0x8cd00000, 0x85900000, 0x91600000, 0x4f100008, 0x8a100000, 0x51700030, 0x51700020, 0x51700010,
+    0x91700000, 0x8f100000, 0x8fb00000, 0x8fd00000, 0x92f00000, 0x96400000, 0x90b00000, 0x53700030,
+    0x53700020, 0x53700010, 0x93700000, 0x53b00010, 0x8e400000, 0x91400000, 0x53b00008, 0x97800000,
+    0x96300000, 0x93b00000, 0x97300000, 0x97400000, 0x46d00010, 0x8a000000, 0x8a800000, 0x8b500000,
+    0x46d00008, 0x8b900000, 0x8ad00000, 0x90d00000, 0x8b300000, 0x86d00000, 0x97f00000, 0x57e00030,
+    0x57e00020, 0x57e00010, 0x97e00000, 0x17e00102, 0x17f00042, 0x97e00000, 0x17e0001d, 0x06d00b53,
+    0x97e00000, 0x17e0000d, 0x97e00000, 0x86d00000, 0x06d02dd3, 0x17e001c2, 0x0b300054, 0x10d0000f,
+    0x90d00000, 0x10d00041, 0x97e00000, 0x90d00000, 0x10d0003d, 0x90d00000, 0x10d00045, 0x17e00060,
+    0x0ad0006c, 0x90d00000, 0x10d00104, 0x97f00000, 0x17f00036, 0x97e00000, 0x17e00042, 0x90d00000,
+    0x10d00104, 0x90d00000, 0x10d02dd3, 0x86d00000, 0x06d001c2, 0x0b90000f, 0x8b900000, 0x0b900041,
+    0x86d00000, 0x8b900000, 0x0b90003d, 0x8b900000, 0x0b900045, 0x97f00000, 0x17f00060, 0x8b900000,
+    0x0b900003, 0x06d00b53, 0x8b900000, 0x86d00000, 0x06d00104, 0x97f00000, 0x17f00036, 0x86d00000,
+    0x06d00104, 0x86d00000, 0x90d00000, 0x10d00003, 0x06d00b53, 0x90d00000, 0x86d00000, 0x06d00104,
+    0x86d00000, 0x97f00000, 0x8b300000, 0x97e00000, 0x8ad00000, 0x8ce00000, 0x0ce0001e, 0x0ad0001f,
+    0x17e00078, 0x0b300078, 0x8b300000, 0x97e00000, 0x8ce00000, 0x95000000, 0x15000021, 0x0ce00022,
+    0x17e00084, 0x0b300084, 0x8b300000, 0x97e00000, 0x95000000, 0x8ad00000, 0x0ad0001e, 0x1500001f,
+    0x17e00078, 0x0b300078, 0x8b300000, 0x97e00000, 0x8ad00000, 0x8ce00000, 0x0ce00021, 0x0ad00022,
+    0x17e00084, 0x0b300084, 0x8b300000, 0x97e00000, 0x8ce00000, 0x95000000, 0x1500001e, 0x0ce0001f,
+    0x17e00078, 0x0b300078, 0x8b300000, 0x97e00000, 0x95000000, 0x8ad00000, 0x0ad00021, 0x15000022,
+    0x17e00084, 0x0b300084, 0x8b300000, 0x97e00000, 0x8ad00000,
+};
+
+const uint32_t test_mem_trace_demos_len = sizeof(test_mem_trace_demos) / sizeof(test_mem_trace_demos[0]);
+
+#endif /*LV_BUILD_TEST*/
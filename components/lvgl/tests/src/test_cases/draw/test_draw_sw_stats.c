@@ -0,0 +1,67 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static uint32_t get_total_task_cnt(uint64_t * pixel_cnt)
+{
+    uint32_t task_cnt = 0;
+    *pixel_cnt = 0;
+    lv_draw_sw_thread_stats_t stats;
+    uint32_t i;
+    for(i = 0; lv_draw_sw_get_thread_stats(i, &stats) == LV_RESULT_OK; i++) {
+        task_cnt += stats.task_cnt;
+        *pixel_cnt += stats.pixel_cnt;
+    }
+    return task_cnt;
+}
+
+void test_draw_sw_stats_count_rendered_tasks(void)
+{
+    lv_draw_sw_reset_thread_stats();
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_center(obj);
+    lv_refr_now(NULL);
+
+    uint64_t pixel_cnt;
+    uint32_t task_cnt = get_total_task_cnt(&pixel_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, task_cnt);
+    /*At least the whole screen is filled by the background*/
+    TEST_ASSERT_TRUE(pixel_cnt >= (uint64_t)lv_display_get_horizontal_resolution(NULL) *
+                     lv_display_get_vertical_resolution(NULL));
+}
+
+void test_draw_sw_stats_reset(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_draw_sw_reset_thread_stats();
+
+    uint64_t pixel_cnt;
+    TEST_ASSERT_EQUAL_UINT32(0, get_total_task_cnt(&pixel_cnt));
+    TEST_ASSERT_TRUE(pixel_cnt == 0);
+}
+
+void test_draw_sw_stats_invalid_index(void)
+{
+    lv_draw_sw_thread_stats_t stats;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_sw_get_thread_stats(0, &stats));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_sw_get_thread_stats(LV_DRAW_SW_DRAW_UNIT_CNT, &stats));
+}
+
+#endif
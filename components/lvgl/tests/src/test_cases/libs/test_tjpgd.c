@@ -4,6 +4,10 @@
 
 #include "unity/unity.h"
 
+#define BAND_HOR_RES    240
+#define BAND_VER_RES    160
+
+static uint16_t band_fb[BAND_VER_RES][BAND_HOR_RES];
 
 void setUp(void)
 {
@@ -100,4 +104,163 @@ void test_jdpgd_align_tile(void)
     lv_libjpeg_turbo_init();
 }
 
+static void band_flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&band_fb[y][area->x1], px_map, w * sizeof(uint16_t));
+        px_map += stride;
+    }
+
+    lv_display_flush_ready(d);
+}
+
+static lv_display_t * band_display_create(uint32_t rows)
+{
+    uint32_t buf_size = lv_draw_buf_width_to_stride(BAND_HOR_RES, LV_COLOR_FORMAT_RGB565) * rows;
+    uint8_t * buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    lv_display_t * disp = lv_display_create(BAND_HOR_RES, BAND_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, band_flush_cb);
+    lv_display_set_user_data(disp, buf);
+    return disp;
+}
+
+static void band_display_delete(lv_display_t * disp)
+{
+    uint8_t * buf = lv_display_get_user_data(disp);
+    lv_display_delete(disp);
+    lv_free(buf);
+}
+
+/*Render tiled JPEGs on a partial mode display with `rows` high bands*/
+static void render_in_bands(uint32_t rows, uint16_t (*result_fb)[BAND_HOR_RES], uint32_t redraw_cnt)
+{
+    lv_display_t * disp_prev = lv_display_get_default();
+    lv_display_t * disp = band_display_create(rows);
+    lv_display_set_default(disp);
+
+    /*Tiles starting in different rows of the image and one from an array*/
+    LV_IMAGE_DECLARE(test_img_lvgl_logo_jpg);
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, "A:src/test_assets/test_img_lvgl_logo.jpg");
+    lv_obj_set_pos(img, -7, -13);
+    lv_obj_set_size(img, BAND_HOR_RES, 110);
+    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_TILE);
+
+    img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &test_img_lvgl_logo_jpg);
+    lv_obj_set_pos(img, 30, 100);
+    lv_obj_set_size(img, 180, 60);
+    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_TILE);
+
+    uint32_t i;
+    for(i = 0; i < redraw_cnt; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(disp);
+    }
+    lv_memcpy(result_fb, band_fb, sizeof(band_fb));
+
+    band_display_delete(disp);
+    lv_display_set_default(disp_prev);
+}
+
+/*Render one tiled JPEG file with `rows` high bands*/
+static void render_file_in_bands(const char * path, uint32_t rows, uint16_t (*result_fb)[BAND_HOR_RES])
+{
+    lv_display_t * disp_prev = lv_display_get_default();
+    lv_display_t * disp = band_display_create(rows);
+    lv_display_set_default(disp);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, path);
+    lv_obj_set_pos(img, -7, -13);
+    lv_obj_set_size(img, BAND_HOR_RES + 7, BAND_VER_RES + 13);
+    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_TILE);
+
+    lv_refr_now(disp);
+    lv_memcpy(result_fb, band_fb, sizeof(band_fb));
+
+    band_display_delete(disp);
+    lv_display_set_default(disp_prev);
+}
+
+static void copy_file(const char * src_path, const char * dst_path)
+{
+    lv_fs_file_t src;
+    lv_fs_file_t dst;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&src, src_path, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&dst, dst_path, LV_FS_MODE_WR));
+
+    uint8_t buf[256];
+    uint32_t br;
+    do {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&src, buf, sizeof(buf), &br));
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&dst, buf, br, NULL));
+    } while(br == sizeof(buf));
+
+    lv_fs_close(&src);
+    lv_fs_close(&dst);
+}
+
+void test_tjpgd_render_in_bands(void)
+{
+    /* Temporarily remove libjpeg_turbo decoder */
+    lv_libjpeg_turbo_deinit();
+
+    static uint16_t ref_fb[BAND_VER_RES][BAND_HOR_RES];
+    static uint16_t res_fb[BAND_VER_RES][BAND_HOR_RES];
+
+    /*One band: every image is decoded from its first MCU row*/
+    render_in_bands(BAND_VER_RES, ref_fb, 1);
+
+    /*Bands cutting the MCU rows: the first redraw collects the row checkpoints, the next ones use them*/
+    render_in_bands(7, res_fb, 1);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, res_fb, sizeof(ref_fb));
+
+    size_t mem_before = lv_test_get_free_mem();
+    render_in_bands(7, res_fb, 3);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, res_fb, sizeof(ref_fb));
+    render_in_bands(32, res_fb, 2);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, res_fb, sizeof(ref_fb));
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+
+    /* Re-add libjpeg_turbo decoder */
+    lv_libjpeg_turbo_init();
+}
+
+void test_tjpgd_render_in_bands_content_changed(void)
+{
+    /* Temporarily remove libjpeg_turbo decoder */
+    lv_libjpeg_turbo_deinit();
+
+    static uint16_t ref_fb[BAND_VER_RES][BAND_HOR_RES];
+    static uint16_t ref_inverted_fb[BAND_VER_RES][BAND_HOR_RES];
+    static uint16_t res_fb[BAND_VER_RES][BAND_HOR_RES];
+    const char * path = "A:tjpgd_content_changed.jpg";
+
+    render_file_in_bands("A:src/test_assets/test_img_lvgl_logo.jpg", BAND_VER_RES, ref_fb);
+    render_file_in_bands("A:src/test_assets/test_img_lvgl_logo_inverted.jpg", BAND_VER_RES, ref_inverted_fb);
+
+    /*Collect the row checkpoints of the original image*/
+    copy_file("A:src/test_assets/test_img_lvgl_logo.jpg", path);
+    render_file_in_bands(path, 7, res_fb);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, res_fb, sizeof(ref_fb));
+
+    /*Same path and dimensions, different content: the checkpoints must be dropped with the image*/
+    copy_file("A:src/test_assets/test_img_lvgl_logo_inverted.jpg", path);
+    lv_image_cache_drop(path);
+    render_file_in_bands(path, 7, res_fb);
+    TEST_ASSERT_EQUAL_MEMORY(ref_inverted_fb, res_fb, sizeof(ref_inverted_fb));
+
+    lv_image_cache_drop(path);
+
+    /* Re-add libjpeg_turbo decoder */
+    lv_libjpeg_turbo_init();
+}
+
 #endif
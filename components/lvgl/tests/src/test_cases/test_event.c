@@ -37,6 +37,10 @@ void test_event_should_not_memory_lean(void)
     }
 
     lv_obj_delete(obj);
+#if LV_USE_SLAB
+    /*The slabs keep their chunks for reuse*/
+    lv_slab_trim_all();
+#endif
 
     lv_mem_monitor_t m2;
     lv_mem_monitor(&m2);
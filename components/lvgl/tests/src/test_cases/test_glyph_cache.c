@@ -0,0 +1,236 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CACHE_SIZE  (512 * 1024)  /*All the glyphs of the labels*/
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_2bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_3bpp_compressed)
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp)
+LV_FONT_DECLARE(test_font_montserrat_ascii_8bpp)
+
+static const lv_font_t * fonts[] = {
+    &test_font_montserrat_ascii_1bpp,
+    &test_font_montserrat_ascii_2bpp,
+    &test_font_montserrat_ascii_3bpp_compressed,
+    &test_font_montserrat_ascii_4bpp,
+    &test_font_montserrat_ascii_8bpp,
+    &lv_font_montserrat_14,
+};
+
+static const char * text = "The quick brown fox jumps over the lazy dog. 0123456789 !?#%&";
+
+void setUp(void)
+{
+    lv_glyph_cache_resize(0, true);
+    lv_glyph_cache_drop(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_glyph_cache_resize(0, true);
+    lv_glyph_cache_drop(NULL);
+}
+
+static lv_obj_t * labels_create(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        lv_label_set_text(label, text);
+    }
+
+    /*Rotated glyphs are drawn as images*/
+    lv_obj_t * label = lv_label_create(cont);
+    lv_obj_set_style_text_font(label, &test_font_montserrat_ascii_4bpp, 0);
+    lv_obj_set_style_transform_rotation(label, 150, 0);
+    lv_label_set_text(label, text);
+
+    lv_obj_update_layout(cont);
+    return cont;
+}
+
+static void assert_same_image(lv_draw_buf_t * expected, lv_draw_buf_t * actual)
+{
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+    TEST_ASSERT_EQUAL_UINT32(expected->header.w, actual->header.w);
+    TEST_ASSERT_EQUAL_UINT32(expected->header.h, actual->header.h);
+    TEST_ASSERT_EQUAL_UINT32(expected->data_size, actual->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(expected->data, actual->data, expected->data_size);
+}
+
+void test_glyph_cache_disabled_by_default(void)
+{
+    TEST_ASSERT_EQUAL(0, LV_GLYPH_CACHE_DEF_SIZE);
+    TEST_ASSERT_FALSE(lv_glyph_cache_is_enabled());
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats, true);
+    lv_obj_t * cont = labels_create();
+    lv_draw_buf_t * snapshot = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    lv_glyph_cache_get_stats(&stats, true);
+
+    TEST_ASSERT_EQUAL_UINT32(0, stats.lookup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+    lv_draw_buf_destroy(snapshot);
+}
+
+void test_glyph_cache_same_rendering(void)
+{
+    lv_obj_t * cont = labels_create();
+    lv_draw_buf_t * uncached = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+
+    lv_glyph_cache_resize(CACHE_SIZE, true);
+    TEST_ASSERT_TRUE(lv_glyph_cache_is_enabled());
+
+    /*All misses, then all hits*/
+    lv_draw_buf_t * first = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    lv_draw_buf_t * second = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+
+    assert_same_image(uncached, first);
+    assert_same_image(uncached, second);
+
+    lv_draw_buf_destroy(uncached);
+    lv_draw_buf_destroy(first);
+    lv_draw_buf_destroy(second);
+}
+
+void test_glyph_cache_hits_on_redraw(void)
+{
+    lv_glyph_cache_resize(CACHE_SIZE, true);
+    lv_obj_t * cont = labels_create();
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats, true);
+    lv_draw_buf_t * snapshot = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    lv_draw_buf_destroy(snapshot);
+    lv_glyph_cache_get_stats(&stats, true);
+
+    /*The same letters repeat in the text*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.lookup_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(stats.lookup_cnt, stats.hit_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(CACHE_SIZE, stats.size);
+    TEST_ASSERT_EQUAL_UINT32(CACHE_SIZE, stats.max_size);
+    uint32_t first_lookup_cnt = stats.lookup_cnt;
+
+    snapshot = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    lv_draw_buf_destroy(snapshot);
+    lv_glyph_cache_get_stats(&stats, false);
+
+    TEST_ASSERT_EQUAL_UINT32(first_lookup_cnt, stats.lookup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats.lookup_cnt, stats.hit_cnt);
+}
+
+void test_glyph_cache_static_a8_font_not_cached(void)
+{
+    lv_glyph_cache_resize(CACHE_SIZE, true);
+
+    /*Fonts with A8 bitmaps in a non-volatile memory are drawn directly*/
+    lv_font_t font = test_font_montserrat_ascii_8bpp;
+    font.static_bitmap = 1;
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &font, 0);
+    lv_label_set_text(label, text);
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats, true);
+    lv_refr_now(NULL);
+    lv_glyph_cache_get_stats(&stats, true);
+
+    TEST_ASSERT_EQUAL_UINT32(0, stats.lookup_cnt);
+    lv_obj_delete(label);
+
+    /*Rotated glyphs and other draw units get the bitmap by copy, still not from the cache*/
+    lv_font_glyph_dsc_t g_dsc;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&font, &g_dsc, 'A', 0));
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(g_dsc.box_w, g_dsc.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    TEST_ASSERT_EQUAL_PTR(draw_buf, lv_font_get_glyph_bitmap(&g_dsc, draw_buf));
+    TEST_ASSERT_NULL(g_dsc.entry);
+    lv_font_glyph_release_draw_data(&g_dsc);
+    lv_draw_buf_destroy(draw_buf);
+
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.lookup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+}
+
+void test_glyph_cache_size_is_bounded(void)
+{
+    lv_obj_t * cont = labels_create();
+    lv_draw_buf_t * uncached = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+
+    /*Much smaller than the glyphs on the screen: evicts while drawing*/
+    lv_glyph_cache_resize(2048, true);
+    lv_draw_buf_t * cached = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    assert_same_image(uncached, cached);
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2048, stats.size);
+
+    /*Shrinking evicts right away*/
+    lv_glyph_cache_resize(256, true);
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(256, stats.size);
+
+    lv_glyph_cache_resize(0, true);
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+    TEST_ASSERT_FALSE(lv_glyph_cache_is_enabled());
+
+    lv_draw_buf_destroy(uncached);
+    lv_draw_buf_destroy(cached);
+}
+
+void test_glyph_cache_drop_font(void)
+{
+    lv_glyph_cache_resize(CACHE_SIZE, true);
+
+    lv_font_t * font_bin = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    TEST_ASSERT_NOT_NULL(font_bin);
+
+    lv_obj_t * label_bin = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label_bin, font_bin, 0);
+    lv_label_set_text(label_bin, text);
+    lv_refr_now(NULL);
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats, true);
+    uint32_t size_bin = stats.size;
+    TEST_ASSERT_GREATER_THAN_UINT32(0, size_bin);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_y(label, 100);
+    lv_label_set_text(label, text);
+    lv_refr_now(NULL);
+    lv_glyph_cache_get_stats(&stats, true);
+    uint32_t size_all = stats.size;
+    TEST_ASSERT_GREATER_THAN_UINT32(size_bin, size_all);
+
+    /*Only the glyphs of the destroyed font are dropped*/
+    lv_obj_delete(label_bin);
+    lv_binfont_destroy(font_bin);
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_ASSERT_EQUAL_UINT32(size_all - size_bin, stats.size);
+
+    lv_glyph_cache_drop(NULL);
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.size);
+}
+
+#endif
@@ -0,0 +1,210 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define ITEM_CNT    40
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 400);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_items(void)
+{
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_obj_t * item = lv_obj_create(cont);
+        lv_obj_set_size(item, 30 + (i % 7) * 10, 20 + (i % 3) * 5);
+    }
+    lv_obj_update_layout(cont);
+}
+
+/*The result of the cached update should be the same as updating every child*/
+static void check_same_as_full_update(void)
+{
+    lv_obj_update_layout(cont);
+
+    lv_area_t coords[ITEM_CNT];
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        coords[i] = lv_obj_get_child(cont, i)->coords;
+    }
+
+    lv_obj_mark_layout_as_dirty(cont);
+    lv_obj_update_layout(cont);
+
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_obj_t * item = lv_obj_get_child(cont, i);
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(item->coords.x1, coords[i].x1, "x1");
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(item->coords.y1, coords[i].y1, "y1");
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(item->coords.x2, coords[i].x2, "x2");
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(item->coords.y2, coords[i].y2, "y2");
+    }
+}
+
+void test_layout_cache_flex_column(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    create_items();
+
+    lv_obj_set_height(lv_obj_get_child(cont, 10), 70);
+    check_same_as_full_update();
+
+    lv_obj_set_width(lv_obj_get_child(cont, 39), 250);
+    check_same_as_full_update();
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 5), LV_OBJ_FLAG_HIDDEN);
+    check_same_as_full_update();
+
+    lv_obj_remove_flag(lv_obj_get_child(cont, 5), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_style_margin_top(lv_obj_get_child(cont, 6), 12, 0);
+    check_same_as_full_update();
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 20), LV_OBJ_FLAG_FLEX_IN_NEW_TRACK);
+    check_same_as_full_update();
+
+    lv_obj_set_height(lv_obj_get_child(cont, 22), 10);
+    check_same_as_full_update();
+
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 3), 1);
+    check_same_as_full_update();
+
+    lv_obj_swap(lv_obj_get_child(cont, 1), lv_obj_get_child(cont, 30));
+    check_same_as_full_update();
+}
+
+void test_layout_cache_flex_row_wrap(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    create_items();
+
+    /*Moves the next items to the next track*/
+    lv_obj_set_width(lv_obj_get_child(cont, 2), 200);
+    check_same_as_full_update();
+
+    /*Changes the height of a track*/
+    lv_obj_set_height(lv_obj_get_child(cont, 15), 60);
+    check_same_as_full_update();
+
+    lv_obj_set_height(lv_obj_get_child(cont, 15), 20);
+    lv_obj_set_width(lv_obj_get_child(cont, 2), 30);
+    check_same_as_full_update();
+
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_START);
+    lv_obj_update_layout(cont);
+    lv_obj_set_height(lv_obj_get_child(cont, 33), 45);
+    check_same_as_full_update();
+}
+
+void test_layout_cache_flex_only_moves_following_items(void)
+{
+#if LV_LAYOUT_CACHE_MIN_CHILDREN
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    create_items();
+
+    /*Move an earlier item by hand to see that it's not placed again*/
+    lv_obj_t * item_before = lv_obj_get_child(cont, 2);
+    lv_area_t coords_before = item_before->coords;
+    item_before->coords.x1 += 5;
+    item_before->coords.x2 += 5;
+
+    lv_obj_t * item_after = lv_obj_get_child(cont, 20);
+    int32_t y_after = item_after->coords.y1;
+
+    lv_obj_set_height(lv_obj_get_child(cont, 10), lv_obj_get_height(lv_obj_get_child(cont, 10)) + 30);
+    lv_obj_update_layout(cont);
+
+    TEST_ASSERT_EQUAL_INT32(coords_before.x1 + 5, item_before->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(y_after + 30, item_after->coords.y1);
+#endif
+}
+
+/*Random changes with a full update after every few*/
+static void random_changes(uint32_t seed)
+{
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        seed = seed * 1103515245 + 12345;
+        lv_obj_t * item = lv_obj_get_child(cont, (seed >> 8) % ITEM_CNT);
+        int32_t value = (seed >> 20) % 150;
+        switch((seed >> 16) % 6) {
+            case 0:
+                lv_obj_set_width(item, 10 + value);
+                break;
+            case 1:
+                lv_obj_set_height(item, 10 + value / 3);
+                break;
+            case 2:
+                lv_obj_set_flag(item, LV_OBJ_FLAG_HIDDEN, !lv_obj_has_flag(item, LV_OBJ_FLAG_HIDDEN));
+                break;
+            case 3:
+                lv_obj_set_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK, !lv_obj_has_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK));
+                break;
+            case 4:
+                lv_obj_set_style_margin_left(item, value % 10, 0);
+                break;
+            default:
+                lv_obj_set_flex_grow(item, value % 3 == 0 ? 1 : 0);
+                break;
+        }
+        if(i % 3 == 0) check_same_as_full_update();
+    }
+}
+
+void test_layout_cache_flex_random(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    create_items();
+    random_changes(1);
+
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_START);
+    random_changes(2);
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN_WRAP);
+    random_changes(3);
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_height(cont, LV_SIZE_CONTENT);
+    random_changes(4);
+}
+
+void test_layout_cache_grid(void)
+{
+    static const int32_t col_dsc[] = {60, LV_GRID_CONTENT, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static int32_t row_dsc[ITEM_CNT / 3 + 2];
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT / 3 + 1; i++) row_dsc[i] = i % 2 ? 30 : LV_GRID_CONTENT;
+    row_dsc[i] = LV_GRID_TEMPLATE_LAST;
+
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    create_items();
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_obj_set_grid_cell(lv_obj_get_child(cont, i), i % 2 ? LV_GRID_ALIGN_STRETCH : LV_GRID_ALIGN_CENTER, i % 3, 1,
+                             LV_GRID_ALIGN_START, i / 3, 1);
+    }
+    check_same_as_full_update();
+
+    /*Doesn't change the tracks*/
+    lv_obj_set_height(lv_obj_get_child(cont, 4), 25);
+    check_same_as_full_update();
+
+    /*Changes the size of a content sized column and row*/
+    lv_obj_set_width(lv_obj_get_child(cont, 7), 120);
+    lv_obj_set_height(lv_obj_get_child(cont, 7), 50);
+    check_same_as_full_update();
+
+    lv_obj_set_grid_cell(lv_obj_get_child(cont, 9), LV_GRID_ALIGN_END, 2, 1, LV_GRID_ALIGN_END, 0, 2);
+    check_same_as_full_update();
+}
+
+#endif
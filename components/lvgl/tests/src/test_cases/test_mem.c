@@ -24,6 +24,160 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+#ifdef LVGL_CI_USING_DEF_HEAP
+
+#define TRACE_SLOT_CNT  1024
+
+extern const uint32_t test_mem_trace_demos[];
+extern const uint32_t test_mem_trace_demos_len;
+
+static void * trace_slots[TRACE_SLOT_CNT];
+
+/*Replay the allocations of screen transitions between the demos, return the number of failed allocations*/
+static uint32_t replay_demo_trace(void)
+{
+    uint32_t fail_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < test_mem_trace_demos_len; i++) {
+        uint32_t op = test_mem_trace_demos[i];
+        uint32_t slot = (op >> 20) & 0x3FF;
+        size_t size = op & 0xFFFFF;
+        switch(op >> 30) {
+            case 0:
+                trace_slots[slot] = lv_malloc(size);
+                if(trace_slots[slot] == NULL) fail_cnt++;
+                else lv_memset(trace_slots[slot], (int)slot, size);
+                break;
+            case 1: {
+                    void * p = lv_realloc(trace_slots[slot], size);
+                    if(p == NULL) fail_cnt++;
+                    else trace_slots[slot] = p;
+                    break;
+                }
+            default:
+                lv_free(trace_slots[slot]);
+                trace_slots[slot] = NULL;
+                break;
+        }
+    }
+
+    /*The blocks of the last screen*/
+    for(i = 0; i < TRACE_SLOT_CNT; i++) {
+        lv_free(trace_slots[i]);
+        trace_slots[i] = NULL;
+    }
+
+    return fail_cnt;
+}
+
+#endif /*LVGL_CI_USING_DEF_HEAP*/
+
+void test_mem_class_stats(void)
+{
+#ifdef LVGL_CI_USING_DEF_HEAP
+    lv_mem_class_stats_t stats_before[LV_MEM_CLASS_CNT];
+    lv_mem_class_stats_t stats[LV_MEM_CLASS_CNT];
+    lv_mem_get_class_stats(stats_before, true);
+
+    void * small = lv_malloc(10);
+    void * medium = lv_malloc(200);
+    void * large = lv_malloc(100 * 1024);
+    lv_mem_get_class_stats(stats, false);
+
+    /*<= 32, <= 256 and the last class*/
+    TEST_ASSERT_EQUAL_UINT32(1, stats[0].alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[3].alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[LV_MEM_CLASS_CNT - 1].alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before[3].cur_cnt + 1, stats[3].cur_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(stats_before[LV_MEM_CLASS_CNT - 1].cur_size + 100 * 1024,
+                                 stats[LV_MEM_CLASS_CNT - 1].cur_size);
+
+    /*A realloc moves the block to its new class, but it's not a new allocation*/
+    medium = lv_realloc(medium, 1000);
+    lv_mem_get_class_stats(stats, false);
+    TEST_ASSERT_EQUAL_UINT32(stats_before[3].cur_cnt, stats[3].cur_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats_before[5].cur_cnt + 1, stats[5].cur_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats[5].alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[5].realloc_cnt);
+
+    lv_free(small);
+    lv_free(medium);
+    lv_free(large);
+    lv_mem_get_class_stats(stats, true);
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_CLASS_CNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(stats_before[i].cur_cnt, stats[i].cur_cnt);
+        TEST_ASSERT_EQUAL_UINT32(stats_before[i].cur_size, stats[i].cur_size);
+        TEST_ASSERT_EQUAL_UINT32(0, stats[i].fail_cnt);
+    }
+
+    /*Failed allocations are counted too*/
+    TEST_ASSERT_NULL(lv_malloc(LV_MEM_SIZE + LV_MEM_LARGE_SIZE));
+    lv_mem_get_class_stats(stats, true);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[LV_MEM_CLASS_CNT - 1].fail_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats[LV_MEM_CLASS_CNT - 1].alloc_cnt);
+#endif
+}
+
+void test_mem_large_pool(void)
+{
+#if defined(LVGL_CI_USING_DEF_HEAP) && LV_MEM_LARGE_SIZE
+    lv_mem_monitor_t mon_before;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_large(&mon_before);
+    /*The pool minus the TLSF block headers*/
+    TEST_ASSERT_LESS_OR_EQUAL(LV_MEM_LARGE_SIZE, mon_before.total_size);
+    TEST_ASSERT_GREATER_THAN(LV_MEM_LARGE_SIZE / 2, mon_before.total_size);
+
+    /*Small blocks stay in the main pool*/
+    void * small = lv_malloc(LV_MEM_LARGE_THRESHOLD - 1);
+    lv_mem_monitor_large(&mon);
+    TEST_ASSERT_EQUAL(mon_before.free_size, mon.free_size);
+
+    void * large = lv_malloc(LV_MEM_LARGE_THRESHOLD);
+    lv_mem_monitor_large(&mon);
+    TEST_ASSERT_GREATER_OR_EQUAL(LV_MEM_LARGE_THRESHOLD, mon_before.free_size - mon.free_size);
+
+    /*Larger than the large pool: the main pool is the reserve*/
+    void * huge = lv_malloc(LV_MEM_LARGE_SIZE + 1024);
+    TEST_ASSERT_NOT_NULL(huge);
+    lv_free(huge);
+
+    /*Growing with realloc keeps the content*/
+    lv_memset(large, 0x5a, LV_MEM_LARGE_THRESHOLD);
+    large = lv_realloc(large, LV_MEM_LARGE_SIZE + 1024);
+    TEST_ASSERT_NOT_NULL(large);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0x5a, large, LV_MEM_LARGE_THRESHOLD);
+
+    lv_free(small);
+    lv_free(large);
+    lv_mem_monitor_large(&mon);
+    TEST_ASSERT_EQUAL(mon_before.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_demo_trace_churn(void)
+{
+#ifdef LVGL_CI_USING_DEF_HEAP
+    lv_mem_monitor_t mon_before;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon_before);
+
+    /*Hours of screen transitions in the long run: no failures, no leaks, the pool is not consumed*/
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, replay_demo_trace());
+    }
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_before.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL(mon_before.free_biggest_size, mon.free_biggest_size);
+#endif
+}
+
 /* #7573: Test memcpy with unaligned addresses */
 void test_memcpy_unaligned(void)
 {
@@ -0,0 +1,284 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES     320
+#define VER_RES     240
+#define BUF_ROWS    40
+#define FLUSH_COST  500
+
+static lv_display_t * disp;
+static lv_display_t * disp_prev;
+static uint8_t * buf;
+static uint16_t shadow[VER_RES][HOR_RES];
+static uint32_t flush_cnt;
+static uint32_t flush_px;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&shadow[y][area->x1], px_map, w * sizeof(uint16_t));
+        px_map += stride;
+    }
+
+    flush_cnt++;
+    flush_px += lv_area_get_size(area);
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    /*A partial mode display with a 1/6 screen buffer, like an SPI panel*/
+    uint32_t buf_size = lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS;
+    buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    disp_prev = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+    lv_display_set_default(disp_prev);
+    lv_free(buf);
+}
+
+typedef struct {
+    const char * name;
+    void (*create)(lv_obj_t * scr);
+    void (*update)(lv_obj_t * scr);
+} trace_t;
+
+typedef struct {
+    uint32_t flush_cnt;
+    uint32_t flush_px;
+} trace_result_t;
+
+/*Clock, battery, signal... in a status bar*/
+static void status_bar_create(lv_obj_t * scr)
+{
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * label = lv_label_create(scr);
+        lv_label_set_text(label, "00");
+        lv_obj_set_pos(label, 10 + i * 40, 4);
+    }
+}
+
+static void status_bar_update(lv_obj_t * scr)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(scr); i++) {
+        lv_label_set_text_fmt(lv_obj_get_child(scr, i), "%" LV_PRIu32 "%%", i * 7 + 13);
+    }
+}
+
+static void corners_create(lv_obj_t * scr)
+{
+    lv_obj_t * label = lv_label_create(scr);
+    lv_label_set_text(label, "A");
+    lv_obj_align(label, LV_ALIGN_TOP_LEFT, 2, 2);
+    label = lv_label_create(scr);
+    lv_label_set_text(label, "B");
+    lv_obj_align(label, LV_ALIGN_BOTTOM_RIGHT, -2, -2);
+}
+
+static void corners_update(lv_obj_t * scr)
+{
+    lv_label_set_text(lv_obj_get_child(scr, 0), "AA");
+    lv_label_set_text(lv_obj_get_child(scr, 1), "BB");
+}
+
+/*Every other row of a list changes its color*/
+static void list_create(lv_obj_t * scr)
+{
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_color_hex(0x404040), 0);
+        lv_obj_set_size(obj, 200, 24);
+        lv_obj_set_pos(obj, 60, 10 + i * 28);
+    }
+}
+
+static void list_update(lv_obj_t * scr)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(scr); i += 2) {
+        lv_obj_set_style_bg_color(lv_obj_get_child(scr, i), lv_color_hex(0x2060c0), 0);
+    }
+}
+
+/*Small indicators in a grid, like LEDs on a dashboard*/
+static void grid_create(lv_obj_t * scr)
+{
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_color_hex(0x800000), 0);
+        lv_obj_set_size(obj, 16, 16);
+        lv_obj_set_pos(obj, 100 + (i % 4) * 24, 80 + (i / 4) * 24);
+    }
+}
+
+static void grid_update(lv_obj_t * scr)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(scr); i++) {
+        lv_obj_set_style_bg_color(lv_obj_get_child(scr, i), lv_color_hex(0x00ff00), 0);
+    }
+}
+
+static const trace_t traces[] = {
+    {"status bar", status_bar_create, status_bar_update},
+    {"corners", corners_create, corners_update},
+    {"list", list_create, list_update},
+    {"grid", grid_create, grid_update},
+};
+
+static trace_result_t run_trace(const trace_t * trace, uint32_t flush_cost, uint16_t (*result_fb)[HOR_RES])
+{
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_clean(scr);
+    lv_display_set_flush_cost(disp, 0);
+    trace->create(scr);
+    lv_refr_now(disp);
+
+    lv_display_set_flush_cost(disp, flush_cost);
+    flush_cnt = 0;
+    flush_px = 0;
+    trace->update(scr);
+    lv_refr_now(disp);
+
+    lv_memcpy(result_fb, shadow, sizeof(shadow));
+    trace_result_t res = {flush_cnt, flush_px};
+    return res;
+}
+
+void test_refr_join_flush_cost_get_set(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_flush_cost(disp));
+    lv_display_set_flush_cost(NULL, 123);
+    TEST_ASSERT_EQUAL_UINT32(123, lv_display_get_flush_cost(disp));
+}
+
+void test_refr_join_without_cost_keeps_distant_areas(void)
+{
+    lv_refr_now(disp);
+
+    lv_area_t a1 = {0, 0, 9, 9};
+    lv_area_t a2 = {300, 200, 309, 209};
+    flush_cnt = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+
+    /*Overlapping areas are joined as before*/
+    lv_area_t a3 = {2, 2, 11, 11};
+    flush_cnt = 0;
+    flush_px = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a3);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(12 * 12, flush_px);
+}
+
+void test_refr_join_without_cost_single_pass(void)
+{
+    lv_refr_now(disp);
+
+    /*'b' and 'c' overlap and are joined. 'a' is in the corner of their join but on neither of them,
+     *and it was checked before the join, so a single pass keeps it as a separate area*/
+    lv_area_t a = {52, 0, 59, 7};
+    lv_area_t b = {0, 0, 49, 49};
+    lv_area_t c = {10, 10, 59, 59};
+    flush_cnt = 0;
+    flush_px = 0;
+    lv_inv_area(disp, &a);
+    lv_inv_area(disp, &b);
+    lv_inv_area(disp, &c);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(8 * 8 + 60 * 60, flush_px);
+
+    /*With a flush cost the joined area is checked again and takes 'a'*/
+    lv_display_set_flush_cost(disp, 1);
+    flush_cnt = 0;
+    flush_px = 0;
+    lv_inv_area(disp, &a);
+    lv_inv_area(disp, &b);
+    lv_inv_area(disp, &c);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(60 * 60, flush_px);
+}
+
+void test_refr_join_with_cost_joins_close_areas(void)
+{
+    lv_refr_now(disp);
+    lv_display_set_flush_cost(disp, FLUSH_COST);
+
+    /*The gap (100 px) is cheaper to redraw than a flush*/
+    lv_area_t a1 = {0, 0, 9, 9};
+    lv_area_t a2 = {20, 0, 29, 9};
+    flush_cnt = 0;
+    flush_px = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(30 * 10, flush_px);
+
+    /*The gap is too large*/
+    lv_area_t a3 = {300, 200, 309, 209};
+    flush_cnt = 0;
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a3);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+}
+
+void test_refr_join_traces(void)
+{
+    static uint16_t fb_ref[VER_RES][HOR_RES];
+    static uint16_t fb_cost[VER_RES][HOR_RES];
+    uint32_t total_ref = 0;
+    uint32_t total_cost = 0;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(traces) / sizeof(traces[0]); i++) {
+        trace_result_t ref = run_trace(&traces[i], 0, fb_ref);
+        trace_result_t res = run_trace(&traces[i], FLUSH_COST, fb_cost);
+
+        uint32_t cost_ref = ref.flush_px + ref.flush_cnt * FLUSH_COST;
+        uint32_t cost_res = res.flush_px + res.flush_cnt * FLUSH_COST;
+        TEST_PRINTF("%s: %d flushes %d px -> %d flushes %d px (cost %d -> %d)", traces[i].name,
+                    (int)ref.flush_cnt, (int)ref.flush_px, (int)res.flush_cnt, (int)res.flush_px,
+                    (int)cost_ref, (int)cost_res);
+
+        /*Same image, never more expensive according to the cost model*/
+        TEST_ASSERT_EQUAL_MEMORY(fb_ref, fb_cost, sizeof(fb_ref));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(cost_ref, cost_res);
+        total_ref += cost_ref;
+        total_cost += cost_res;
+    }
+
+    TEST_ASSERT_LESS_THAN_UINT32(total_ref, total_cost);
+}
+
+#endif
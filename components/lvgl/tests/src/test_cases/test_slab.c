@@ -0,0 +1,207 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_SLAB
+
+static void event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+static void timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+}
+
+static void create_screen(lv_obj_t * parent, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * btn = lv_button_create(parent);
+        lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_RED), 0);
+        lv_obj_add_event_cb(btn, event_cb, LV_EVENT_CLICKED, NULL);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text(label, "Button");
+    }
+}
+
+void test_slab_alloc_free(void)
+{
+    lv_slab_t slab;
+    lv_slab_init(&slab, 5);
+
+    lv_slab_stats_t stats;
+    lv_slab_get_stats(&slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(void *), stats.block_size);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.chunk_cnt);
+
+    void * blocks[LV_SLAB_BLOCK_CNT + 1];
+    uint32_t i;
+    for(i = 0; i < LV_SLAB_BLOCK_CNT + 1; i++) {
+        blocks[i] = lv_slab_alloc_zeroed(&slab);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)blocks[i] % sizeof(void *));
+        TEST_ASSERT_NULL(*(void **)blocks[i]);
+        *(void **)blocks[i] = blocks[i];
+    }
+
+    /*The blocks don't overlap*/
+    for(i = 0; i < LV_SLAB_BLOCK_CNT + 1; i++) {
+        TEST_ASSERT_EQUAL_PTR(blocks[i], *(void **)blocks[i]);
+    }
+
+    lv_slab_get_stats(&slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.chunk_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_SLAB_BLOCK_CNT + 1, stats.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_SLAB_BLOCK_CNT - 1, stats.free_cnt);
+
+    /*The last freed block is reused first*/
+    lv_slab_free(&slab, blocks[3]);
+    TEST_ASSERT_EQUAL_PTR(blocks[3], lv_slab_alloc(&slab));
+
+    lv_slab_free(&slab, NULL);
+    lv_slab_get_stats(&slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_SLAB_BLOCK_CNT + 1, stats.used_cnt);
+
+    lv_slab_deinit(&slab);
+    lv_slab_get_stats(&slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.chunk_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(void *), stats.block_size);
+}
+
+void test_slab_trim(void)
+{
+    lv_slab_t slab;
+    lv_slab_init(&slab, 24);
+
+    void * blocks[3 * LV_SLAB_BLOCK_CNT];
+    uint32_t i;
+    for(i = 0; i < 3 * LV_SLAB_BLOCK_CNT; i++) blocks[i] = lv_slab_alloc(&slab);
+
+    /*Free the whole 1st and 3rd chunk and half of the 2nd*/
+    for(i = 0; i < 3 * LV_SLAB_BLOCK_CNT; i++) {
+        if(i < LV_SLAB_BLOCK_CNT || i >= 2 * LV_SLAB_BLOCK_CNT || i % 2) lv_slab_free(&slab, blocks[i]);
+    }
+
+    lv_slab_trim(&slab);
+
+    lv_slab_stats_t stats;
+    lv_slab_get_stats(&slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.chunk_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_SLAB_BLOCK_CNT / 2, stats.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_SLAB_BLOCK_CNT - LV_SLAB_BLOCK_CNT / 2, stats.free_cnt);
+    TEST_ASSERT_EQUAL_size_t(stats.chunk_cnt * (sizeof(void *) + 24 * LV_SLAB_BLOCK_CNT), stats.size);
+
+    /*The remaining free blocks are all from the kept chunk*/
+    for(i = 0; i < LV_SLAB_BLOCK_CNT - LV_SLAB_BLOCK_CNT / 2; i++) {
+        uint8_t * p = lv_slab_alloc(&slab);
+        TEST_ASSERT_TRUE(p >= (uint8_t *)blocks[LV_SLAB_BLOCK_CNT]);
+        TEST_ASSERT_TRUE(p < (uint8_t *)blocks[2 * LV_SLAB_BLOCK_CNT - 1] + 24);
+    }
+
+    lv_slab_get_stats(&slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.chunk_cnt);
+
+    lv_slab_deinit(&slab);
+}
+
+void test_slab_screen_reuses_blocks(void)
+{
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_allocate_spec_attr(scr);     /*Kept by the screen after deleting the children too*/
+    lv_slab_stats_t stats_base;
+    lv_slab_get_stats_all(&stats_base);
+
+    create_screen(scr, 50);
+
+    lv_slab_stats_t stats;
+    lv_slab_get_stats_all(&stats);
+    /*The buttons, labels, their local styles, event descriptors and spec. attributes*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats_base.used_cnt + 5 * 50, stats.used_cnt);
+    uint32_t chunk_cnt = stats.chunk_cnt;
+
+    lv_obj_clean(scr);
+    lv_slab_get_stats_all(&stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_base.used_cnt, stats.used_cnt);
+
+    /*The freed blocks are reused, no new chunks are needed*/
+    create_screen(scr, 50);
+    lv_slab_get_stats_all(&stats);
+    TEST_ASSERT_EQUAL_UINT32(chunk_cnt, stats.chunk_cnt);
+
+    lv_obj_delete(scr);
+    lv_slab_get_stats_all(&stats);
+    TEST_ASSERT_LESS_THAN_UINT32(stats_base.used_cnt, stats.used_cnt);
+
+    /*Trimming gives back the memory of the deleted screen*/
+    size_t mem_used_before;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    mem_used_before = mon.total_size - mon.free_size;
+
+    lv_slab_trim_all();
+    lv_slab_get_stats_all(&stats);
+    TEST_ASSERT_LESS_THAN_UINT32(chunk_cnt, stats.chunk_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(LV_SLAB_OBJ_SIZE_CNT * LV_SLAB_BLOCK_CNT + 4 * LV_SLAB_BLOCK_CNT, stats.free_cnt);
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_THAN(mem_used_before, mon.total_size - mon.free_size);
+}
+
+void test_slab_timers_and_anims(void)
+{
+    lv_slab_stats_t stats_base;
+    lv_slab_get_stats(&LV_GLOBAL_DEFAULT()->timer_state.slab, &stats_base);
+
+    lv_timer_t * timers[20];
+    uint32_t i;
+    for(i = 0; i < 20; i++) timers[i] = lv_timer_create(timer_cb, 1000, NULL);
+
+    lv_slab_stats_t stats;
+    lv_slab_get_stats(&LV_GLOBAL_DEFAULT()->timer_state.slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_base.used_cnt + 20, stats.used_cnt);
+
+    for(i = 0; i < 20; i++) lv_timer_delete(timers[i]);
+    lv_slab_get_stats(&LV_GLOBAL_DEFAULT()->timer_state.slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_base.used_cnt, stats.used_cnt);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_slab_get_stats(&LV_GLOBAL_DEFAULT()->anim_state.slab, &stats_base);
+    for(i = 0; i < 20; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, obj);
+        lv_anim_set_values(&a, 0, 100);
+        lv_anim_set_duration(&a, 1000);
+        lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)(i % 2 ? lv_obj_set_x : lv_obj_set_y));
+        lv_anim_set_delay(&a, i);
+        lv_anim_start(&a);
+    }
+
+    lv_slab_get_stats(&LV_GLOBAL_DEFAULT()->anim_state.slab, &stats);
+    /*The animations of the same variable and exec_cb replace each other*/
+    TEST_ASSERT_EQUAL_UINT32(stats_base.used_cnt + 2, stats.used_cnt);
+
+    lv_anim_delete(obj, NULL);
+    lv_slab_get_stats(&LV_GLOBAL_DEFAULT()->anim_state.slab, &stats);
+    TEST_ASSERT_EQUAL_UINT32(stats_base.used_cnt, stats.used_cnt);
+}
+
+#endif /*LV_USE_SLAB*/
+
+#endif
@@ -0,0 +1,315 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_style_t style_base;
+static lv_style_t style_pr;
+static lv_style_t style_extra;
+
+void setUp(void)
+{
+    lv_style_init(&style_base);
+    lv_style_set_bg_color(&style_base, lv_color_hex(0xff0000));
+    lv_style_set_text_color(&style_base, lv_color_hex(0x00ff00));
+    lv_style_set_width(&style_base, 100);
+
+    lv_style_init(&style_pr);
+    lv_style_set_bg_color(&style_pr, lv_color_hex(0x0000ff));
+    lv_style_set_text_color(&style_pr, lv_color_hex(0x123456));
+
+    lv_style_init(&style_extra);
+    lv_style_set_width(&style_extra, 50);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_style_reset(&style_base);
+    lv_style_reset(&style_pr);
+    lv_style_reset(&style_extra);
+}
+
+static lv_obj_t * create_styled(lv_obj_t * parent)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_style(obj, &style_base, 0);
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    return obj;
+}
+
+/*Read twice to be sure the second read comes from the cache (if enabled)*/
+static uint32_t bg_color(lv_obj_t * obj)
+{
+    lv_obj_get_style_bg_color(obj, 0);
+    return lv_color_to_u32(lv_obj_get_style_bg_color(obj, 0)) & 0xffffff;
+}
+
+static uint32_t text_color(lv_obj_t * obj)
+{
+    lv_obj_get_style_text_color(obj, 0);
+    return lv_color_to_u32(lv_obj_get_style_text_color(obj, 0)) & 0xffffff;
+}
+
+void test_style_cache_state_change(void)
+{
+    lv_obj_t * obj = create_styled(lv_screen_active());
+
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj));
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_HEX32(0x0000ff, bg_color(obj));
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj));
+}
+
+void test_style_cache_inherited_from_parent_state(void)
+{
+    lv_obj_t * parent = create_styled(lv_screen_active());
+    lv_obj_t * label = lv_label_create(parent);
+    lv_obj_remove_style_all(label);
+
+    TEST_ASSERT_EQUAL_HEX32(0x00ff00, text_color(label));
+    lv_obj_add_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_HEX32(0x123456, text_color(label));
+    lv_obj_remove_state(parent, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_HEX32(0x00ff00, text_color(label));
+}
+
+void test_style_cache_parent_change(void)
+{
+    lv_obj_t * parent1 = create_styled(lv_screen_active());
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(parent2);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0xabcdef), 0);
+
+    lv_obj_t * label = lv_label_create(parent1);
+    lv_obj_remove_style_all(label);
+    TEST_ASSERT_EQUAL_HEX32(0x00ff00, text_color(label));
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_HEX32(0xabcdef, text_color(label));
+}
+
+void test_style_cache_shared_style_modified(void)
+{
+    lv_obj_t * obj1 = create_styled(lv_screen_active());
+    lv_obj_t * obj2 = create_styled(lv_screen_active());
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj1));
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj2));
+
+    lv_style_set_bg_color(&style_base, lv_color_hex(0x808080));
+    lv_obj_report_style_change(&style_base);
+    TEST_ASSERT_EQUAL_HEX32(0x808080, bg_color(obj1));
+    TEST_ASSERT_EQUAL_HEX32(0x808080, bg_color(obj2));
+
+    /*Also without reporting the change*/
+    lv_style_set_bg_color(&style_base, lv_color_hex(0x404040));
+    TEST_ASSERT_EQUAL_HEX32(0x404040, bg_color(obj1));
+
+    lv_style_remove_prop(&style_base, LV_STYLE_BG_COLOR);
+    lv_obj_report_style_change(&style_base);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to_u32(lv_style_prop_get_default(LV_STYLE_BG_COLOR).color) & 0xffffff,
+                            bg_color(obj1));
+}
+
+void test_style_cache_add_remove_disable_style(void)
+{
+    lv_obj_t * obj = create_styled(lv_screen_active());
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_style_width(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_style_width(obj, 0));
+
+    lv_obj_add_style(obj, &style_extra, 0);
+    TEST_ASSERT_EQUAL_INT32(50, lv_obj_get_style_width(obj, 0));
+
+    lv_obj_style_set_disabled(obj, &style_extra, 0, true);
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_style_width(obj, 0));
+    lv_obj_style_set_disabled(obj, &style_extra, 0, false);
+    TEST_ASSERT_EQUAL_INT32(50, lv_obj_get_style_width(obj, 0));
+
+    lv_obj_replace_style(obj, &style_extra, &style_base, 0);
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_style_width(obj, 0));
+
+    lv_obj_remove_style(obj, &style_base, 0);
+    TEST_ASSERT_EQUAL_INT32(obj->class_p->width_def, lv_obj_get_style_width(obj, 0));
+}
+
+void test_style_cache_local_style(void)
+{
+    lv_obj_t * obj = create_styled(lv_screen_active());
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj));
+
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x111111), 0);
+    TEST_ASSERT_EQUAL_HEX32(0x111111, bg_color(obj));
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x222222), 0);
+    TEST_ASSERT_EQUAL_HEX32(0x222222, bg_color(obj));
+
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_COLOR, 0);
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj));
+}
+
+void test_style_cache_transition(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_COLOR, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+    lv_style_set_transition(&style_base, &tr);
+
+    lv_obj_t * obj = create_styled(lv_screen_active());
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    /*The transition starts from the old value*/
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, bg_color(obj));
+
+    lv_tick_inc(50);
+    lv_timer_handler();
+    uint32_t mid = bg_color(obj);
+    TEST_ASSERT_NOT_EQUAL(0xff0000, mid);
+    TEST_ASSERT_NOT_EQUAL(0x0000ff, mid);
+
+    lv_tick_inc(60);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_HEX32(0x0000ff, bg_color(obj));
+}
+
+void test_style_cache_deleted_object(void)
+{
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        /*A new object might get the address of the deleted one*/
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_remove_style_all(obj);
+        if(i % 2) lv_obj_set_style_bg_color(obj, lv_color_hex(0x333333), 0);
+        TEST_ASSERT_EQUAL_HEX32(i % 2 ? 0x333333 : lv_color_to_u32(lv_style_prop_get_default(LV_STYLE_BG_COLOR).color) & 0xffffff,
+                                bg_color(obj));
+        lv_obj_delete(obj);
+    }
+}
+
+void test_style_cache_stats(void)
+{
+    lv_obj_t * obj = create_styled(lv_screen_active());
+    uint32_t lookup_cnt;
+    uint32_t hit_cnt;
+
+    lv_obj_style_value_cache_get_stats(NULL, NULL, true);
+    lv_obj_get_style_bg_color(obj, 0);
+    lv_obj_get_style_bg_color(obj, 0);
+    lv_obj_get_style_bg_color(obj, 0);
+    lv_obj_style_value_cache_get_stats(&lookup_cnt, &hit_cnt, true);
+#if LV_OBJ_STYLE_VALUE_CACHE
+    TEST_ASSERT_EQUAL_UINT32(3, lookup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, hit_cnt);
+#else
+    TEST_ASSERT_EQUAL_UINT32(0, lookup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, hit_cnt);
+#endif
+
+    lv_obj_style_value_cache_get_stats(&lookup_cnt, &hit_cnt, false);
+    TEST_ASSERT_EQUAL_UINT32(0, lookup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, hit_cnt);
+}
+
+#define RND_OBJ_CNT 12
+
+static uint32_t rnd_state = 4321;
+static uint32_t rnd(uint32_t n)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 8) % n;
+}
+
+static const lv_style_prop_t rnd_props[] = {
+    LV_STYLE_BG_COLOR, LV_STYLE_TEXT_COLOR, LV_STYLE_WIDTH, LV_STYLE_TEXT_OPA, LV_STYLE_BORDER_WIDTH,
+};
+
+#define RND_PROP_CNT (sizeof(rnd_props) / sizeof(rnd_props[0]))
+
+static void read_all(lv_obj_t ** objs, lv_style_value_t (*values)[RND_PROP_CNT])
+{
+    uint32_t i, p;
+    for(i = 0; i < RND_OBJ_CNT; i++) {
+        for(p = 0; p < RND_PROP_CNT; p++) {
+            values[i][p] = lv_obj_get_style_prop(objs[i], LV_PART_MAIN, rnd_props[p]);
+        }
+    }
+}
+
+/*Any sequence of changes gives the same values as an empty cache*/
+void test_style_cache_random_changes(void)
+{
+    static lv_style_value_t cached[RND_OBJ_CNT][RND_PROP_CNT];
+    static lv_style_value_t fresh[RND_OBJ_CNT][RND_PROP_CNT];
+    lv_obj_t * objs[RND_OBJ_CNT];
+    lv_style_t * styles[] = {&style_base, &style_pr, &style_extra};
+    lv_style_set_text_opa(&style_extra, LV_OPA_50);
+
+    uint32_t i;
+    for(i = 0; i < RND_OBJ_CNT; i++) {
+        objs[i] = create_styled(i < 3 ? lv_screen_active() : objs[rnd(i)]);
+    }
+
+    uint32_t step;
+    for(step = 0; step < 2000; step++) {
+        lv_obj_t * obj = objs[rnd(RND_OBJ_CNT)];
+        lv_style_t * style = styles[rnd(3)];
+        uint32_t v = rnd(0x1000000);
+        switch(rnd(9)) {
+            case 0:
+                if(lv_obj_has_state(obj, LV_STATE_PRESSED)) lv_obj_remove_state(obj, LV_STATE_PRESSED);
+                else lv_obj_add_state(obj, LV_STATE_PRESSED);
+                break;
+            case 1:
+                lv_obj_add_style(obj, style, rnd(2) ? 0 : LV_STATE_PRESSED);
+                break;
+            case 2:
+                lv_obj_remove_style(obj, style, LV_STATE_ANY);
+                break;
+            case 3:
+                lv_style_set_bg_color(style, lv_color_hex(v));
+                if(rnd(2)) lv_obj_report_style_change(style);
+                break;
+            case 4:
+                lv_style_set_width(style, v % 200);
+                break;
+            case 5:
+                lv_obj_set_style_text_color(obj, lv_color_hex(v), rnd(2) ? 0 : LV_STATE_PRESSED);
+                break;
+            case 6:
+                lv_obj_remove_local_style_prop(obj, LV_STYLE_TEXT_COLOR, 0);
+                break;
+            case 7: {
+                    /*Keep the tree: never move an object under its own descendant*/
+                    lv_obj_t * parent = objs[rnd(RND_OBJ_CNT)];
+                    lv_obj_t * p = parent;
+                    while(p && p != obj) p = lv_obj_get_parent(p);
+                    if(p == NULL) lv_obj_set_parent(obj, parent);
+                    break;
+                }
+            case 8:
+                lv_style_set_border_width(style, v % 10);
+                for(i = 0; i < obj->style_cnt; i++) {
+                    if(obj->styles[i].style == style && obj->styles[i].selector == 0) {
+                        lv_obj_style_set_disabled(obj, style, 0, rnd(2));
+                        break;
+                    }
+                }
+                break;
+        }
+
+        read_all(objs, cached);
+        lv_obj_style_value_cache_invalidate();
+        read_all(objs, fresh);
+        for(i = 0; i < RND_OBJ_CNT; i++) {
+            uint32_t p;
+            for(p = 0; p < RND_PROP_CNT; p++) {
+                /*The first 2 props are colors*/
+                if(p < 2) TEST_ASSERT_TRUE(lv_color_eq(fresh[i][p].color, cached[i][p].color));
+                else TEST_ASSERT_EQUAL_INT32(fresh[i][p].num, cached[i][p].num);
+            }
+        }
+    }
+}
+
+#endif
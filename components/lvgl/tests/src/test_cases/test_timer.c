@@ -0,0 +1,337 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define MAX_FIRED   256
+#define MODEL_MAX   64
+
+static uint32_t fired[MAX_FIRED];
+static uint32_t fired_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    fired_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void record_cb(lv_timer_t * t)
+{
+    if(fired_cnt < MAX_FIRED) fired[fired_cnt++] = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(t);
+}
+
+/*Same computation as the original list scan of lv_timer_handler()*/
+static uint32_t brute_force_time_until_next(void)
+{
+    uint32_t min = LV_NO_TIMER_READY;
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(!t->paused) {
+            uint32_t elp = lv_tick_elaps(t->last_run);
+            uint32_t rem = elp >= t->period ? 0 : t->period - elp;
+            if(rem < min) min = rem;
+        }
+        t = lv_timer_get_next(t);
+    }
+    return min;
+}
+
+void test_timer_ready_timers_run_newest_first(void)
+{
+    lv_timer_t * a = lv_timer_create(record_cb, 10, (void *)1);
+    lv_timer_t * b = lv_timer_create(record_cb, 20, (void *)2);
+    lv_timer_t * c = lv_timer_create(record_cb, 10, (void *)3);
+
+    lv_tick_inc(25);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, fired_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, fired[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, fired[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, fired[2]);
+
+    lv_timer_delete(a);
+    lv_timer_delete(b);
+    lv_timer_delete(c);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t = lv_timer_create(record_cb, 5, (void *)1);
+    lv_timer_set_repeat_count(t, 3);
+    lv_timer_t * p = lv_timer_create(record_cb, 5, (void *)2);
+    lv_timer_set_repeat_count(p, 2);
+    lv_timer_set_auto_delete(p, false);
+
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_tick_inc(5);
+        lv_timer_handler();
+    }
+
+    uint32_t ones = 0, twos = 0;
+    for(i = 0; i < fired_cnt; i++) {
+        if(fired[i] == 1) ones++;
+        if(fired[i] == 2) twos++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, ones);
+    TEST_ASSERT_EQUAL_UINT32(2, twos);
+
+    /*`t` is deleted, `p` is only paused*/
+    bool t_found = false;
+    lv_timer_t * it = lv_timer_get_next(NULL);
+    while(it) {
+        if(it == t) t_found = true;
+        it = lv_timer_get_next(it);
+    }
+    TEST_ASSERT_FALSE(t_found);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(p));
+
+    /*Resumed with a new repeat count it runs again*/
+    lv_timer_set_repeat_count(p, 1);
+    lv_timer_resume(p);
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, fired[fired_cnt - 1]);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(p));
+    lv_timer_delete(p);
+}
+
+void test_timer_repeat_count_zero_deletes_without_running(void)
+{
+    lv_timer_t * t = lv_timer_create(record_cb, 1000, (void *)1);
+    lv_timer_set_repeat_count(t, 0);
+
+    /*The list scan deleted such a timer at the next handler call, even if it wasn't ready*/
+    lv_tick_inc(1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, fired_cnt);
+
+    lv_timer_t * it = lv_timer_get_next(NULL);
+    while(it) {
+        TEST_ASSERT_NOT_EQUAL(t, it);
+        it = lv_timer_get_next(it);
+    }
+}
+
+void test_timer_ready_reset_period_pause(void)
+{
+    lv_timer_t * t = lv_timer_create(record_cb, 100, (void *)1);
+
+    lv_tick_inc(10);
+    lv_timer_ready(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, fired_cnt);
+
+    /*Shorter period: ready earlier*/
+    lv_timer_set_period(t, 20);
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, fired_cnt);
+
+    /*Longer period: not ready at the old deadline*/
+    lv_timer_set_period(t, 50);
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, fired_cnt);
+
+    /*Reset moves the deadline*/
+    lv_tick_inc(20);
+    lv_timer_reset(t);
+    lv_tick_inc(40);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, fired_cnt);
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, fired_cnt);
+
+    /*Paused timers never run and don't count for the next deadline*/
+    lv_timer_pause(t);
+    lv_tick_inc(200);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, fired_cnt);
+    TEST_ASSERT_EQUAL_UINT32(brute_force_time_until_next(), lv_timer_get_time_until_next());
+
+    lv_timer_resume(t);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(4, fired_cnt);
+    lv_timer_delete(t);
+}
+
+static lv_timer_t * victim;
+
+static void delete_victim_cb(lv_timer_t * t)
+{
+    record_cb(t);
+    if(victim) {
+        lv_timer_delete(victim);
+        victim = NULL;
+    }
+}
+
+static void delete_self_cb(lv_timer_t * t)
+{
+    record_cb(t);
+    lv_timer_delete(t);
+}
+
+static void create_cb(lv_timer_t * t)
+{
+    record_cb(t);
+    lv_timer_t * n = lv_timer_create(record_cb, 0, (void *)9);
+    lv_timer_set_repeat_count(n, 1);
+    lv_timer_delete(t);
+}
+
+void test_timer_delete_and_create_from_callback(void)
+{
+    /*Older timer deleted by the newer one before its turn*/
+    victim = lv_timer_create(record_cb, 10, (void *)1);
+    lv_timer_t * killer = lv_timer_create(delete_victim_cb, 10, (void *)2);
+    lv_timer_create(delete_self_cb, 10, (void *)3);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, fired_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, fired[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, fired[1]);
+    lv_timer_delete(killer);
+
+    /*A timer created by a callback with period 0 runs in the same handler call*/
+    fired_cnt = 0;
+    lv_timer_create(create_cb, 10, (void *)4);
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, fired_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, fired[0]);
+    TEST_ASSERT_EQUAL_UINT32(9, fired[1]);
+}
+
+void test_timer_tick_wrap_around(void)
+{
+    /*Move the tick close to the 32 bit wrap around*/
+    lv_tick_inc(UINT32_MAX - lv_tick_get() - 15);
+    lv_timer_handler();
+
+    lv_timer_t * t = lv_timer_create(record_cb, 10, (void *)1);
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        TEST_ASSERT_EQUAL_UINT32(i < 9 ? 0 : (i < 19 ? 1 : 2), fired_cnt);
+    }
+    TEST_ASSERT_EQUAL_UINT32(brute_force_time_until_next(), lv_timer_get_time_until_next());
+    lv_timer_delete(t);
+}
+
+/*Reference: the list scan of the original lv_timer_handler(), timers with period > 0*/
+typedef struct {
+    lv_timer_t * timer;
+    uint32_t period;
+    uint32_t last_run;
+    int32_t repeat_count;
+    bool paused;
+    bool alive;
+} model_timer_t;
+
+static uint32_t rnd_state = 12345;
+static uint32_t rnd(uint32_t n)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (rnd_state >> 8) % n;
+}
+
+static void model_run(model_timer_t * m, uint32_t m_cnt, uint32_t now, uint32_t * out, uint32_t * out_cnt)
+{
+    int32_t i;
+    for(i = (int32_t)m_cnt - 1; i >= 0; i--) {
+        model_timer_t * mt = &m[i];
+        if(!mt->alive || mt->paused) continue;
+        if(now - mt->last_run >= mt->period) {
+            int32_t orig = mt->repeat_count;
+            if(mt->repeat_count > 0) mt->repeat_count--;
+            mt->last_run = now;
+            if(orig != 0) out[(*out_cnt)++] = (uint32_t)i;
+        }
+        if(mt->repeat_count == 0) mt->alive = false;
+    }
+}
+
+void test_timer_matches_list_scan(void)
+{
+    static model_timer_t m[MODEL_MAX];
+    static uint32_t expected[MAX_FIRED];
+    uint32_t m_cnt = 0;
+    uint32_t step;
+
+    for(step = 0; step < 3000; step++) {
+        uint32_t action = rnd(20);
+        uint32_t now = lv_tick_get();
+        model_timer_t * mt = m_cnt ? &m[rnd(m_cnt)] : NULL;
+
+        if(action < 3 && m_cnt < MODEL_MAX) {
+            model_timer_t * n = &m[m_cnt];
+            n->period = 1 + rnd(50);
+            n->timer = lv_timer_create(record_cb, n->period, (void *)(lv_uintptr_t)m_cnt);
+            n->last_run = lv_tick_get();
+            n->repeat_count = rnd(3) ? -1 : (int32_t)(1 + rnd(5));
+            lv_timer_set_repeat_count(n->timer, n->repeat_count);
+            n->paused = false;
+            n->alive = true;
+            m_cnt++;
+        }
+        else if(mt && mt->alive) {
+            if(action == 3) {
+                lv_timer_delete(mt->timer);
+                mt->alive = false;
+            }
+            else if(action == 4) {
+                mt->period = 1 + rnd(50);
+                lv_timer_set_period(mt->timer, mt->period);
+            }
+            else if(action == 5) {
+                lv_timer_ready(mt->timer);
+                mt->last_run = now - mt->period - 1;
+            }
+            else if(action == 6) {
+                lv_timer_reset(mt->timer);
+                mt->last_run = now;
+            }
+            else if(action == 7) {
+                if(mt->paused) lv_timer_resume(mt->timer);
+                else lv_timer_pause(mt->timer);
+                mt->paused = !mt->paused;
+            }
+            else if(action == 8) {
+                mt->repeat_count = rnd(2) ? -1 : (int32_t)(1 + rnd(5));
+                lv_timer_set_repeat_count(mt->timer, mt->repeat_count);
+            }
+        }
+
+        /*Either a random step or jump right to the announced deadline*/
+        uint32_t until = lv_timer_get_time_until_next();
+        lv_tick_inc(rnd(2) && until != LV_NO_TIMER_READY && until < 100 ? until : rnd(30));
+
+        uint32_t expected_cnt = 0;
+        model_run(m, m_cnt, lv_tick_get(), expected, &expected_cnt);
+        fired_cnt = 0;
+        uint32_t next = lv_timer_handler();
+
+        TEST_ASSERT_EQUAL_UINT32(expected_cnt, fired_cnt);
+        if(expected_cnt) TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, fired, expected_cnt);
+        TEST_ASSERT_EQUAL_UINT32(brute_force_time_until_next(), next);
+    }
+
+    uint32_t i;
+    for(i = 0; i < m_cnt; i++) {
+        if(m[i].alive) lv_timer_delete(m[i].timer);
+    }
+}
+
+#endif
@@ -0,0 +1,72 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_3bpp_compressed)
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp)
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_glyph_cache_resize(0, true);
+    lv_glyph_cache_drop(NULL);
+}
+
+static void redraw_screen(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+/*A screen full of text, like a log view or a settings list*/
+static void text_screen_create(const lv_font_t * font)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_label_set_text_fmt(label, "%02" LV_PRIu32 " The quick brown fox jumps over the lazy dog 0123456789", i);
+    }
+
+    lv_refr_now(NULL);
+}
+
+static void measure(const lv_font_t * font, const char * name)
+{
+    text_screen_create(font);
+
+    lv_glyph_cache_resize(64 * 1024, true);
+    redraw_screen();
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats, true);
+    redraw_screen();
+    lv_glyph_cache_get_stats(&stats, true);
+    TEST_PRINTF("%s: %d glyph lookups per frame, %d hits, %d bytes cached", name, (int)stats.lookup_cnt,
+                (int)stats.hit_cnt, (int)stats.size);
+
+    TEST_ASSERT_MAX_TIME_ITER(redraw_screen, 30, 20);
+
+    lv_glyph_cache_resize(0, true);
+    TEST_ASSERT_MAX_TIME_ITER(redraw_screen, 30, 20);
+}
+
+void test_glyph_cache_text_screen_4bpp(void)
+{
+    measure(&test_font_montserrat_ascii_4bpp, "4bpp");
+}
+
+void test_glyph_cache_text_screen_compressed(void)
+{
+    measure(&test_font_montserrat_ascii_3bpp_compressed, "3bpp compressed");
+}
+#endif
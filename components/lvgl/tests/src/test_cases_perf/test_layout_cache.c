@@ -0,0 +1,63 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define ITEM_CNT    500
+
+static lv_obj_t * list;
+static uint32_t item_id;
+
+/*A long scrollable list of label and button rows*/
+static void create_list(void)
+{
+    list = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(list, 240, 320);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(list);
+        lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text_fmt(label, "Item %d", (int)i);
+        lv_obj_set_flex_grow(label, 1);
+
+        lv_button_create(row);
+    }
+
+    lv_obj_update_layout(list);
+}
+
+/*Change the height of one row per layout update*/
+static void update_one_item(void)
+{
+    lv_obj_t * row = lv_obj_get_child(list, item_id % ITEM_CNT);
+    lv_obj_t * label = lv_obj_get_child(row, 0);
+    lv_label_set_text(label, item_id % 2 ? "Item\nchanged" : "Item");
+    lv_obj_update_layout(list);
+    item_id += 37;
+}
+
+void test_layout_cache_update_one_item(void)
+{
+    create_list();
+
+    /*Warm up*/
+    update_one_item();
+
+    TEST_ASSERT_MAX_TIME_ITER(update_one_item, 100, 200);
+
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < 200; i++) update_one_item();
+    t = clock() - t;
+    TEST_PRINTF("%d item list: %d us per single item layout update", ITEM_CNT,
+                (int)((t * 1000000 / CLOCKS_PER_SEC) / 200));
+
+    lv_obj_delete(list);
+}
+
+#endif
@@ -0,0 +1,193 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+
+#define TRACE_SLOT_CNT  1024
+#define HEAP_SIZE       (256 * 1024)    /*Both pools of the largest configuration*/
+#define HEAP_THRESHOLD  2048
+
+extern const uint32_t test_mem_trace_demos[];
+extern const uint32_t test_mem_trace_demos_len;
+
+typedef struct {
+    void * (*malloc_cb)(size_t size);
+    void * (*realloc_cb)(void * p, size_t size);
+    void (*free_cb)(void * p);
+} allocator_t;
+
+/*A heap of one pool, or of a pool for the small and one for the large blocks like `LV_MEM_LARGE_SIZE`*/
+typedef struct {
+    lv_tlsf_t small;
+    lv_tlsf_t large;
+    uint8_t * large_mem;
+    size_t large_size;
+} heap_t;
+
+static void * slots[TRACE_SLOT_CNT];
+static uint64_t heap_mem[HEAP_SIZE / sizeof(uint64_t)];
+static heap_t heap;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/*Replay the allocations of screen transitions between the demos, return the number of failed allocations*/
+static uint32_t replay(const allocator_t * allocator, uint32_t op_start, uint32_t op_end)
+{
+    uint32_t fail_cnt = 0;
+    uint32_t i;
+    for(i = op_start; i < op_end; i++) {
+        uint32_t op = test_mem_trace_demos[i];
+        uint32_t slot = (op >> 20) & 0x3FF;
+        size_t size = op & 0xFFFFF;
+        switch(op >> 30) {
+            case 0:
+                slots[slot] = allocator->malloc_cb(size);
+                if(slots[slot] == NULL) fail_cnt++;
+                break;
+            case 1: {
+                    void * p = allocator->realloc_cb(slots[slot], size);
+                    if(p == NULL) fail_cnt++;
+                    else slots[slot] = p;
+                    break;
+                }
+            default:
+                allocator->free_cb(slots[slot]);
+                slots[slot] = NULL;
+                break;
+        }
+    }
+
+    return fail_cnt;
+}
+
+static void replay_lv_malloc(void)
+{
+    static const allocator_t allocator = {lv_malloc, lv_realloc, lv_free};
+    replay(&allocator, 0, test_mem_trace_demos_len);
+
+    uint32_t i;
+    for(i = 0; i < TRACE_SLOT_CNT; i++) {
+        lv_free(slots[i]);
+        slots[i] = NULL;
+    }
+}
+
+void test_mem_demo_trace_latency(void)
+{
+    /*~18700 lv_malloc, lv_realloc and lv_free: 1 us each at most*/
+    TEST_ASSERT_MAX_TIME_ITER(replay_lv_malloc, 200, 10);
+}
+
+static bool heap_is_large(const void * p)
+{
+    return heap.large && (const uint8_t *)p >= heap.large_mem && (const uint8_t *)p < heap.large_mem + heap.large_size;
+}
+
+static void * heap_malloc(size_t size)
+{
+    if(size == 0) return NULL;
+    void * p = NULL;
+    if(heap.large && size >= HEAP_THRESHOLD) p = lv_tlsf_malloc(heap.large, size);
+    if(p == NULL) p = lv_tlsf_malloc(heap.small, size);
+    if(p == NULL && heap.large && size < HEAP_THRESHOLD) p = lv_tlsf_malloc(heap.large, size);
+    return p;
+}
+
+static void heap_free(void * p)
+{
+    if(p == NULL) return;
+    lv_tlsf_free(heap_is_large(p) ? heap.large : heap.small, p);
+}
+
+static void * heap_realloc(void * p, size_t size)
+{
+    if(p == NULL) return heap_malloc(size);
+
+    size_t old_size = lv_tlsf_block_size(p);
+    void * p_new = lv_tlsf_realloc(heap_is_large(p) ? heap.large : heap.small, p, size);
+    if(p_new == NULL) {
+        p_new = heap_malloc(size);
+        if(p_new == NULL) return NULL;
+        lv_memcpy(p_new, p, LV_MIN(old_size, size));
+        heap_free(p);
+    }
+    return p_new;
+}
+
+static void free_walker(void * ptr, size_t size, int used, void * user)
+{
+    LV_UNUSED(ptr);
+    lv_mem_monitor_t * mon = user;
+    if(used) return;
+    mon->free_size += size;
+    if(size > mon->free_biggest_size) mon->free_biggest_size = size;
+}
+
+/**
+ * Replay the trace many times and check the main pool every few hundred operations, i.e.
+ * how large buffer could be allocated there in the middle of the screen transitions
+ */
+static void measure_fragmentation(size_t small_size, size_t large_size, const char * name)
+{
+    heap.small = lv_tlsf_create_with_pool(heap_mem, small_size);
+    heap.large_size = large_size;
+    heap.large_mem = large_size ? (uint8_t *)heap_mem + small_size : NULL;
+    heap.large = large_size ? lv_tlsf_create_with_pool(heap.large_mem, large_size) : NULL;
+
+    static const allocator_t allocator = {heap_malloc, heap_realloc, heap_free};
+    uint32_t fail_cnt = 0;
+    uint32_t frag_pct_max = 0;
+    size_t biggest_min = SIZE_MAX;
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        uint32_t op;
+        for(op = 0; op < test_mem_trace_demos_len; op += 512) {
+            fail_cnt += replay(&allocator, op, LV_MIN(op + 512, test_mem_trace_demos_len));
+
+            lv_mem_monitor_t mon;
+            lv_memzero(&mon, sizeof(mon));
+            lv_tlsf_walk_pool(lv_tlsf_get_pool(heap.small), free_walker, &mon);
+            biggest_min = LV_MIN(biggest_min, mon.free_biggest_size);
+            if(mon.free_size) {
+                uint32_t frag_pct = 100 - (uint32_t)((uint64_t)mon.free_biggest_size * 100 / mon.free_size);
+                frag_pct_max = LV_MAX(frag_pct_max, frag_pct);
+            }
+        }
+
+        /*The next replay starts with the deletion of blocks which are not in the trace*/
+        for(op = 0; op < TRACE_SLOT_CNT; op++) {
+            heap_free(slots[op]);
+            slots[op] = NULL;
+        }
+    }
+
+    TEST_PRINTF("%s: %d failed allocations; main pool: min. biggest free block %d bytes, max. fragmentation %d%%",
+                name, (int)fail_cnt, (int)biggest_min, (int)frag_pct_max);
+
+    lv_tlsf_destroy(heap.small);
+    if(heap.large) lv_tlsf_destroy(heap.large);
+    lv_memzero(&heap, sizeof(heap));
+}
+
+void test_mem_demo_trace_fragmentation(void)
+{
+    /*The demos need ~90 KB at most*/
+    measure_fragmentation(96 * 1024, 0, "96 KB pool");
+    measure_fragmentation(128 * 1024, 0, "128 KB pool");
+
+    /*The large buffers in their own pool (e.g. in PSRAM) don't split the main pool*/
+    measure_fragmentation(96 * 1024, 64 * 1024, "96 KB + 64 KB large pool");
+    measure_fragmentation(128 * 1024, 128 * 1024, "128 KB + 128 KB large pool");
+}
+
+#endif /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
+
+#endif
@@ -0,0 +1,68 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define WIDGET_CNT  200
+
+static lv_obj_t * scr;
+
+static void event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+/*A settings-like screen: rows of label, switch/slider/button, each with a local style and an event*/
+static void create_delete_screen(void)
+{
+    scr = lv_obj_create(NULL);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < WIDGET_CNT / 4; i++) {
+        lv_obj_t * row = lv_obj_create(scr);
+        lv_obj_set_size(row, 200, LV_SIZE_CONTENT);
+        lv_obj_set_style_pad_all(row, 4, 0);
+
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text(label, "Setting");
+
+        lv_obj_t * obj;
+        switch(i % 3) {
+            case 0:
+                obj = lv_switch_create(row);
+                break;
+            case 1:
+                obj = lv_slider_create(row);
+                break;
+            default:
+                obj = lv_button_create(row);
+                break;
+        }
+        lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+        lv_obj_add_event_cb(obj, event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+        lv_obj_t * icon = lv_label_create(row);
+        lv_label_set_text(icon, LV_SYMBOL_RIGHT);
+    }
+
+    lv_obj_delete(scr);
+}
+
+void test_slab_create_delete_screen(void)
+{
+    /*Warm up the slabs and the heap*/
+    create_delete_screen();
+
+    TEST_ASSERT_MAX_TIME_ITER(create_delete_screen, 40, 20);
+
+#if LV_USE_SLAB
+    lv_slab_stats_t stats;
+    lv_slab_get_stats_all(&stats);
+    TEST_PRINTF("slabs: %d chunks, %d bytes after creating and deleting the screen",
+                (int)stats.chunk_cnt, (int)stats.size);
+    lv_slab_trim_all();
+#endif
+}
+
+#endif
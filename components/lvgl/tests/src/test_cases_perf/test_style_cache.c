@@ -0,0 +1,65 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+/*Properties read by the draw and refresh code for every object*/
+static const lv_style_prop_t draw_props[] = {
+    LV_STYLE_OPA, LV_STYLE_BLEND_MODE, LV_STYLE_TRANSFORM_ROTATION, LV_STYLE_BG_OPA, LV_STYLE_BG_COLOR,
+    LV_STYLE_RADIUS, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_OUTLINE_WIDTH, LV_STYLE_SHADOW_WIDTH,
+    LV_STYLE_PAD_TOP, LV_STYLE_PAD_LEFT, LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT, LV_STYLE_TEXT_OPA,
+};
+
+static void redraw_screen(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+static void get_draw_props(lv_obj_t * obj)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(draw_props) / sizeof(draw_props[0]); i++) {
+        lv_obj_get_style_prop(obj, LV_PART_MAIN, draw_props[i]);
+    }
+
+    for(i = 0; i < lv_obj_get_child_count(obj); i++) {
+        get_draw_props(lv_obj_get_child(obj, i));
+    }
+}
+
+static void get_draw_props_screen(void)
+{
+    get_draw_props(lv_screen_active());
+}
+
+void test_style_cache_demo_widgets(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_refr_now(NULL);
+
+    uint32_t lookup_cnt;
+    uint32_t hit_cnt;
+    lv_obj_style_value_cache_get_stats(NULL, NULL, true);
+    redraw_screen();
+    lv_obj_style_value_cache_get_stats(&lookup_cnt, &hit_cnt, true);
+    TEST_PRINTF("widgets demo: %d style lookups per frame, %d from the cache", (int)lookup_cnt, (int)hit_cnt);
+
+    TEST_ASSERT_MAX_TIME_ITER(redraw_screen, 30, 20);
+
+    get_draw_props_screen();
+    lv_obj_style_value_cache_get_stats(NULL, NULL, true);
+    get_draw_props_screen();
+    lv_obj_style_value_cache_get_stats(&lookup_cnt, &hit_cnt, true);
+    TEST_PRINTF("draw properties of the visible widgets: %d lookups, %d from the cache", (int)lookup_cnt, (int)hit_cnt);
+
+    TEST_ASSERT_MAX_TIME_ITER(get_draw_props_screen, 1, 100);
+
+    lv_obj_clean(lv_screen_active());
+#endif
+}
+#endif
@@ -0,0 +1,112 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TIMER_MAX   1000
+
+static lv_timer_t * timers[TIMER_MAX];
+static uint32_t run_cnt;
+
+static void timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+    run_cnt++;
+}
+
+static void create_timers(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*Mix of short animation like and long housekeeping like periods*/
+        uint32_t period = (i % 4) ? 100 + (i * 37) % 900 : 5 + i % 30;
+        timers[i] = lv_timer_create(timer_cb, period, NULL);
+    }
+}
+
+static void delete_timers(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) lv_timer_delete(timers[i]);
+}
+
+static void handler_step(void)
+{
+    lv_tick_inc(1);
+    lv_timer_handler();
+}
+
+/*Sleep as long as the handler says, the way an OS task calls it*/
+static void handler_sleep(void)
+{
+    lv_tick_inc(lv_timer_get_time_until_next());
+    lv_timer_handler();
+}
+
+static lv_timer_t * paused[16];
+static uint32_t paused_cnt;
+
+/*Only the timers of the test may wake up the handler*/
+static void pause_other_timers(void)
+{
+    paused_cnt = 0;
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t && paused_cnt < 16) {
+        if(t->timer_cb != timer_cb && !t->paused) {
+            lv_timer_pause(t);
+            paused[paused_cnt++] = t;
+        }
+        t = lv_timer_get_next(t);
+    }
+}
+
+static void resume_other_timers(void)
+{
+    while(paused_cnt) lv_timer_resume(paused[--paused_cnt]);
+}
+
+static void check_next_deadline(uint32_t cnt)
+{
+    uint32_t idle_wakeups = 0;
+    uint32_t start = lv_tick_get();
+    uint32_t i;
+
+    pause_other_timers();
+    lv_timer_handler();
+    for(i = 0; i < 2000; i++) {
+        uint32_t prev = run_cnt;
+        handler_sleep();
+        if(run_cnt == prev) idle_wakeups++;
+    }
+    resume_other_timers();
+
+    /*Sleeping exactly until the announced deadline never wakes up for nothing*/
+    TEST_PRINTF("%d timers: 2000 wake ups in %d ms, %d without a ready timer",
+                (int)cnt, (int)lv_tick_elaps(start), (int)idle_wakeups);
+    TEST_ASSERT_EQUAL_UINT32(0, idle_wakeups);
+}
+
+void test_timer_handler_10(void)
+{
+    create_timers(10);
+    TEST_ASSERT_MAX_TIME_ITER(handler_step, 5, 1000);
+    check_next_deadline(10);
+    delete_timers(10);
+}
+
+void test_timer_handler_100(void)
+{
+    create_timers(100);
+    TEST_ASSERT_MAX_TIME_ITER(handler_step, 10, 1000);
+    check_next_deadline(100);
+    delete_timers(100);
+}
+
+void test_timer_handler_1000(void)
+{
+    create_timers(1000);
+    TEST_ASSERT_MAX_TIME_ITER(handler_step, 40, 1000);
+    check_next_deadline(1000);
+    delete_timers(1000);
+}
+#endif
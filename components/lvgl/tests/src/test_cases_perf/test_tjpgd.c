@@ -0,0 +1,78 @@
+#if LV_BUILD_TEST_PERF
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_TJPGD
+
+#define HOR_RES     320
+#define VER_RES     240
+#define BUF_ROWS    24      /*1/10 screen, rendered in bands like an SPI panel*/
+
+static lv_display_t * disp;
+static lv_display_t * disp_prev;
+static uint8_t * buf;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    uint32_t buf_size = lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS;
+    buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    disp_prev = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+
+    /*Only TJPGD should decode the JPEG images*/
+    lv_libjpeg_turbo_deinit();
+}
+
+void tearDown(void)
+{
+    lv_libjpeg_turbo_init();
+    lv_display_delete(disp);
+    lv_display_set_default(disp_prev);
+    lv_free(buf);
+}
+
+static void redraw_screen(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+}
+
+void test_tjpgd_full_screen(void)
+{
+    /*The 105x40 logo tiled over the whole screen: every tile is split by the bands*/
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, "A:src/test_assets/test_img_lvgl_logo.jpg");
+    lv_obj_set_size(img, HOR_RES, VER_RES);
+    lv_image_set_inner_align(img, LV_IMAGE_ALIGN_TILE);
+    lv_refr_now(disp);
+
+    TEST_ASSERT_MAX_TIME_ITER(redraw_screen, 100, 10);
+}
+
+void test_tjpgd_partially_visible(void)
+{
+    /*Only the bottom right 25x10 corner of the image is on the screen*/
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, "A:src/test_assets/test_img_lvgl_logo.jpg");
+    lv_obj_set_pos(img, -80, -30);
+    lv_refr_now(disp);
+
+    TEST_ASSERT_MAX_TIME_ITER(redraw_screen, 10, 100);
+}
+
+#endif /*LV_USE_TJPGD*/
+
+#endif
@@ -0,0 +1,312 @@
+#!/usr/bin/env python3
+"""
+@file      binlog_decode.py
+@brief     Host decoder for binlog streams (mylibs/binlog-v001): formats the records
+           with the format strings of the application ELF.
+
+A FMT record carries the address of its format string and the raw arguments; the
+strings are read from the allocated sections of the ELF that runs on the board. A
+stream starts with "BLOG" and the first hex chars of the ELF SHA-256, checked against
+the ELF given here. Record layout: see src/binlog_record.h.
+
+usage: binlog_decode.py build/app.elf <input> [--time]
+  <input>: a file (rotated files: name.old first), '-' for stdin,
+           tcp:HOST:PORT (binlog tcp) or serial:PORT[:BAUD] (binlog uart, needs pyserial)
+"""
+
+import argparse
+import hashlib
+import re
+import socket
+import struct
+import sys
+
+MAGIC = b"BLOG"
+SYNC = 0xB7
+REC_HEADER = 8
+MAX_PAYLOAD = 4096  # larger lengths are garbage, resync
+STR_ADDR = 0xFF
+
+REC_FMT, REC_TEXT, REC_DROPPED = 0, 1, 2
+I32, I64, F64, PTR, STR = "i32", "i64", "f64", "ptr", "str"
+
+
+class Elf:
+    """Allocated sections of an ELF32/ELF64 file, readable by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        self.sha256 = hashlib.sha256(data).hexdigest()
+        if data[:4] != b"\x7fELF":
+            sys.exit(f"{path}: not an ELF file")
+        is64 = data[4] == 2
+        end = "<" if data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(end + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x3A)
+            sh_fmt = end + "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(end + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x2E)
+            sh_fmt = end + "IIIIIIIIII"
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(sh_fmt, data, shoff + i * shentsize)[:6]
+            if flags & 0x2 and sh_type == 1 and addr and size:  # SHF_ALLOC, SHT_PROGBITS
+                self.sections.append((addr, data[offset:offset + size]))
+        self.cache = {}
+
+    def string(self, addr):
+        if addr in self.cache:
+            return self.cache[addr]
+        for base, blob in self.sections:
+            if base <= addr < base + len(blob):
+                off = addr - base
+                end = blob.find(b"\0", off)
+                s = blob[off:end if end >= 0 else len(blob)].decode("utf-8", "replace")
+                self.cache[addr] = s
+                return s
+        return None
+
+
+SPEC = re.compile(r"%([-+ #0']*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([a-zA-Z%])")
+
+
+def parse_format(fmt, long_size, size_t_size):
+    """(type, unsigned) of every argument, the same rules as binlog_parse_format()."""
+    types = []
+    for m in SPEC.finditer(fmt):
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            continue
+        if width == "*":
+            types.append((I32, False))
+        if prec == "*":
+            types.append((I32, False))
+        if conv in "diouxX":
+            wide = length in ("ll", "j") or (length == "l" and long_size == 8) or (length in ("z", "t") and size_t_size == 8)
+            types.append((I64 if wide else I32, conv in "ouxX"))
+        elif conv == "c":
+            types.append((I32, False))
+        elif conv in "fFeEgGaA":
+            types.append((F64, False))
+        elif conv == "s":
+            types.append((STR, False))
+        elif conv == "p":
+            types.append((PTR, True))
+        else:
+            return None
+    return types
+
+
+def format_record(fmt, args):
+    """printf on the host; the arguments are consumed in the order of the specs."""
+    it = iter(args)
+    out = []
+    pos = 0
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        flags = flags.replace("'", "")
+        if width == "*":
+            w = next(it)
+            if w < 0:
+                flags += "-"
+                w = -w
+            width = str(w)
+        if prec == "*":
+            p = next(it)
+            prec = str(p) if p >= 0 else None
+        value = next(it)
+        spec = "%" + flags + (width or "") + ("." + prec if prec is not None else "")
+        if conv in "di":
+            out.append((spec + "d") % value)
+        elif conv in "uoxX":
+            out.append((spec + ("d" if conv == "u" else conv)) % value)
+        elif conv == "c":
+            out.append((spec + "c") % chr(value & 0xFF))
+        elif conv in "aA":
+            out.append(float.hex(value))
+        elif conv in "fFeEgG":
+            out.append((spec + conv) % value)
+        elif conv == "s":
+            out.append((spec + "s") % value)
+        elif conv == "p":
+            out.append((spec.replace(".", "") + "s") % hex(value))
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+class Decoder:
+    def __init__(self, elf, show_time):
+        self.elf = elf
+        self.show_time = show_time
+        self.long_size = 4
+        self.size_t_size = 4
+        self.sigs = {}
+        self.buf = bytearray()
+        self.last_ts = None
+        self.time_us = 0
+
+    def feed(self, data):
+        self.buf += data
+        out = []
+        while True:
+            used, text = self.next_item()
+            if used == 0:
+                break
+            del self.buf[:used]
+            if text:
+                out.append(text)
+        return "".join(out)
+
+    def next_item(self):
+        """(bytes consumed, text); (0, None) when more input is needed."""
+        buf = self.buf
+        if not buf:
+            return 0, None
+        if buf[0] == MAGIC[0] and len(buf) < 4:
+            return 0, None
+        if buf[:4] == MAGIC:
+            if len(buf) < 7 or len(buf) < 7 + buf[6]:
+                return 0, None
+            n = buf[6]
+            self.long_size, self.size_t_size = buf[5] >> 4, buf[5] & 0x0F
+            self.sigs.clear()
+            sha = bytes(buf[7:7 + n]).decode("ascii", "replace")
+            if not self.elf.sha256.startswith(sha):
+                sys.stderr.write(f"binlog: stream from ELF {sha}..., this ELF is {self.elf.sha256[:n]}...\n")
+            return 7 + n, None
+        if buf[0] != SYNC:
+            return self.skip()
+        if len(buf) < REC_HEADER:
+            return 0, None
+        kind, core = buf[1] >> 4, buf[1] & 0x0F
+        length, ts = struct.unpack_from("<HI", buf, 2)
+        if kind > REC_DROPPED or length > MAX_PAYLOAD or (kind == REC_DROPPED and length != 4):
+            return self.skip()
+        if len(buf) < REC_HEADER + length:
+            return 0, None
+        payload = bytes(buf[REC_HEADER:REC_HEADER + length])
+        if kind == REC_FMT:
+            text = self.decode_fmt(payload)
+            if text is None:
+                return self.skip()
+        elif kind == REC_TEXT:
+            text = payload.decode("utf-8", "replace")
+        else:
+            text = f"*** binlog: {struct.unpack_from('<I', payload)[0]} records dropped on core {core}\n"
+        return REC_HEADER + length, self.stamp(ts, core) + text
+
+    def skip(self):
+        for i in range(1, len(self.buf)):
+            if self.buf[i] == SYNC or self.buf[i] == MAGIC[0]:
+                return i, None
+        return len(self.buf), None
+
+    def stamp(self, ts, core):
+        if self.last_ts is not None:
+            delta = (ts - self.last_ts) & 0xFFFFFFFF
+            self.time_us += delta - (1 << 32) if delta >= 1 << 31 else delta
+        else:
+            self.time_us = ts
+        self.last_ts = ts
+        if not self.show_time:
+            return ""
+        return f"[{self.time_us / 1e6:12.6f} C{core}] "
+
+    def decode_fmt(self, payload):
+        if len(payload) < 4:
+            return None
+        addr, = struct.unpack_from("<I", payload)
+        fmt = self.elf.string(addr)
+        if fmt is None:
+            return None
+        if addr not in self.sigs:
+            self.sigs[addr] = parse_format(fmt, self.long_size, self.size_t_size)
+        types = self.sigs[addr]
+        if types is None:
+            return None
+        args = []
+        pos = 4
+        try:
+            for t, unsigned in types:
+                if t in (I32, PTR):
+                    args.append(struct.unpack_from("<I" if unsigned else "<i", payload, pos)[0])
+                    pos += 4
+                elif t == I64:
+                    args.append(struct.unpack_from("<Q" if unsigned else "<q", payload, pos)[0])
+                    pos += 8
+                elif t == F64:
+                    args.append(struct.unpack_from("<d", payload, pos)[0])
+                    pos += 8
+                elif payload[pos] == STR_ADDR:
+                    s = self.elf.string(struct.unpack_from("<I", payload, pos + 1)[0])
+                    args.append(s if s is not None else "(?)")
+                    pos += 5
+                else:
+                    n = payload[pos]
+                    args.append(payload[pos + 1:pos + 1 + n].decode("utf-8", "replace"))
+                    pos += 1 + n
+        except (struct.error, IndexError):
+            return None
+        if pos != len(payload):
+            return None
+        return format_record(fmt, args)
+
+
+def chunks(source):
+    if source == "-":
+        while True:
+            data = sys.stdin.buffer.read1(4096)
+            if not data:
+                return
+            yield data
+    if source.startswith("tcp:"):
+        host, port = source[4:].rsplit(":", 1)
+        with socket.create_connection((host, int(port))) as sock:
+            while True:
+                data = sock.recv(4096)
+                if not data:
+                    return
+                yield data
+    if source.startswith("serial:"):
+        import serial  # pyserial
+
+        parts = source[7:].split(":")
+        with serial.Serial(parts[0], int(parts[1]) if len(parts) > 1 else 921600, timeout=0.1) as port:
+            while True:
+                data = port.read(4096)
+                if data:
+                    yield data
+    with open(source, "rb") as f:
+        while True:
+            data = f.read(65536)
+            if not data:
+                return
+            yield data
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("elf")
+    ap.add_argument("input")
+    ap.add_argument("--time", action="store_true", help="prefix every line with the record time and core")
+    args = ap.parse_args()
+
+    dec = Decoder(Elf(args.elf), args.time)
+    try:
+        for data in chunks(args.input):
+            sys.stdout.write(dec.feed(data))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+@file      image_rle.py
+@brief     Build-time converter: raw RGB565 C array (image2lcd style) -> RLE C header.
+
+The output uses the same token format as LVGL's lv_rle (src/libs/rle):
+  ctrl & 0x80 -> (ctrl & 0x7F) literal pixels follow
+  otherwise   -> next pixel is repeated ctrl times
+with a block size of 2 bytes (one RGB565 pixel). Pixel bytes are copied
+verbatim, so the panel byte order of the source array is preserved.
+
+usage: image_rle.py <input.h> <output.h> --width 128 --height 128 [--name image_logo_rle]
+"""
+
+import argparse
+import re
+import sys
+
+BLK = 2
+MAX_RUN = 0x7F
+
+
+def parse_c_array(text):
+    body = text[text.index("{") + 1:text.rindex("}")]
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    body = re.sub(r"//[^\n]*", "", body)
+    return bytes(int(tok, 0) for tok in re.findall(r"0[xX][0-9a-fA-F]+|\d+", body))
+
+
+def rle_encode(data):
+    px = [data[i:i + BLK] for i in range(0, len(data), BLK)]
+    out = bytearray()
+    i = 0
+    n = len(px)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_RUN and px[i + run] == px[i]:
+            run += 1
+        if run >= 2:
+            out.append(run)
+            out += px[i]
+            i += run
+            continue
+        start = i
+        while i < n and i - start < MAX_RUN:
+            if i + 1 < n and px[i + 1] == px[i]:
+                break
+            i += 1
+        if i == start:
+            i += 1
+        out.append(0x80 | (i - start))
+        for p in px[start:i]:
+            out += p
+    return bytes(out)
+
+
+def rle_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        ctrl = data[i]
+        i += 1
+        if ctrl & 0x80:
+            cnt = (ctrl & 0x7F) * BLK
+            out += data[i:i + cnt]
+            i += cnt
+        else:
+            out += data[i:i + BLK] * ctrl
+            i += BLK
+    return bytes(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("input")
+    ap.add_argument("output")
+    ap.add_argument("--width", type=int, required=True)
+    ap.add_argument("--height", type=int, required=True)
+    ap.add_argument("--name", default="image_logo_rle")
+    args = ap.parse_args()
+
+    with open(args.input, "r", encoding="utf-8") as f:
+        raw = parse_c_array(f.read())
+
+    expected = args.width * args.height * BLK
+    if len(raw) != expected:
+        sys.exit("image_rle: %s has %d bytes, expected %d (%dx%d RGB565)"
+                 % (args.input, len(raw), expected, args.width, args.height))
+
+    rle = rle_encode(raw)
+    if rle_decode(rle) != raw:
+        sys.exit("image_rle: round-trip check failed")
+
+    lines = [
+        "/* Generated by extras/tools/image_rle.py from %s - do not edit. */" % args.input.replace("\\", "/").split("/")[-1],
+        "/* %d bytes raw -> %d bytes RLE (%.1f%%) */" % (len(raw), len(rle), 100.0 * len(rle) / len(raw)),
+        "",
+        "#pragma once",
+        "",
+        "#include \"rle_image.h\"",
+        "",
+        "static const uint8_t %s_data[%d] = {" % (args.name, len(rle)),
+    ]
+    for i in range(0, len(rle), 16):
+        lines.append("    " + " ".join("0x%02X," % b for b in rle[i:i + 16]))
+    lines += [
+        "};",
+        "",
+        "static const rle_image_t %s = {" % args.name,
+        "    .width     = %d," % args.width,
+        "    .height    = %d," % args.height,
+        "    .data_size = sizeof(%s_data)," % args.name,
+        "    .data      = %s_data," % args.name,
+        "};",
+        "",
+    ]
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -37,10 +37,12 @@ extern "C" {
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_vendor.h"
 
-#include "image_logo.h"
+#include "image_logo_rle.h"  // generated from image_logo.h
 
+#include "cfgstore.h"
 #include "filesystem-os.h"
 #include "one-cli.h"
+#include "wifimgr.h"
 }
 
 #define PIN_MOSI (gpio_num_t)(2)
@@ -53,6 +55,9 @@ extern "C" {
 
 #define LCD_WIDTH  128
 #define LCD_HEIGHT 128
+#define LCD_PCLK_HZ (10 * 1000 * 1000)
+
+// #define RLE_IMAGE_BENCHMARK  // log decode vs SPI throughput at boot
 
 // Include that are cpp
 
@@ -107,6 +112,19 @@ extern "C" void app_main(void) {
     esp_log_level_set("*", ESP_LOG_INFO);
     vTaskDelay(pdMS_TO_TICKS(100));
 
+    if (cfgstore_init() != ESP_OK) {  // NVS + setarile salvate, inainte de WiFi si CLI
+        ESP_LOGW("cfg", "Saved settings unavailable, using the defaults");
+    }
+    // WiFi porneste devreme: asocierea merge in paralel cu initializarea ecranului
+    char ssid[33];
+    char pass[65];
+    cfgstore_get_str(CFG_WIFI_SSID, ssid, sizeof(ssid));
+    cfgstore_get_str(CFG_WIFI_PASS, pass, sizeof(pass));
+    if (ssid[0] != '\0' && wifimgr_init(NULL) == ESP_OK) {
+        wifimgr_add_ap(ssid, pass, 0);
+        wifimgr_start();
+    }
+
     ESP_LOGI("tft", "Initialize SPI bus");
     spi_bus_config_t bus_config = {
         .mosi_io_num           = PIN_MOSI,
@@ -131,7 +149,7 @@ extern "C" void app_main(void) {
         .cs_gpio_num         = PIN_CS,
         .dc_gpio_num         = PIN_DC,
         .spi_mode            = 0,                 // SPI mode 0
-        .pclk_hz             = 10 * 1000 * 1000,  // 10 MHz
+        .pclk_hz             = LCD_PCLK_HZ,       // 10 MHz
         .trans_queue_depth   = 10,                // câte tranzacții în coadă
         .on_color_trans_done = NULL,              // poți pune callback dacă vrei
         .user_ctx            = NULL,
@@ -214,7 +232,13 @@ extern "C" void app_main(void) {
         color_buf[i] = selected_color;
     }
     esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, 128, 128, color_buf);
-    // esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, 128, 128, &gImage_image_logo);
+    // logo-ul se decomprima direct in panou, cate RLE_IMAGE_BAND_ROWS linii
+    if (rle_image_draw(panel_handle, io_handle, &image_logo_rle, 0, 0) != ESP_OK) {
+        ESP_LOGW("tft", "Boot logo not drawn");  // doar cosmetic, boot-ul continua
+    }
+#ifdef RLE_IMAGE_BENCHMARK
+    rle_image_benchmark(panel_handle, io_handle, &image_logo_rle, LCD_PCLK_HZ);
+#endif
 
     initialize_internal_fat_filesystem();
     initialize_filesystem_littlefs();
@@ -80,8 +80,23 @@
     #define LV_MEM_POOL_INCLUDE     "esp_heap_caps.h"
     #define LV_MEM_POOL_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_SPIRAM)      // for SpiRam
     ////#define LV_MEM_POOL_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_INTERNAL)  // for Internal RAM
+
+    /*Size of a second pool only for the allocations of at least `LV_MEM_LARGE_THRESHOLD` bytes.
+     *Freed large buffers are not split by small objects this way. 0: one pool for all allocations*/
+    #define LV_MEM_LARGE_SIZE (256 * 1024U)
+    #define LV_MEM_LARGE_THRESHOLD 2048
+    #define LV_MEM_LARGE_POOL_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_SPIRAM)
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/*Allocate the widgets, their local styles and attributes, the event descriptors, timers and
+ *animations from slabs of same-size blocks. The unused chunks are freed by `lv_slab_trim_all()`.
+ *Off: no faster than TLSF, and the app never deletes a screen, so nothing would trim the chunks*/
+#define LV_USE_SLAB 0
+#if LV_USE_SLAB
+    #define LV_SLAB_BLOCK_CNT 16
+    #define LV_SLAB_OBJ_SIZE_CNT 16
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -201,6 +216,19 @@
      * > 1 means multiple threads will render the screen in parallel */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    /*1*/ 2
 
+    /* Pin draw thread `i` to core `(LV_DRAW_SW_THREAD_FIRST_CORE + i) % 2` so both S3 cores render */
+    #define LV_DRAW_SW_THREAD_PIN           1
+    #define LV_DRAW_SW_THREAD_FIRST_CORE    0
+
+    /* Priority of the SW draw threads */
+    #define LV_DRAW_SW_THREAD_PRIO      LV_DRAW_THREAD_PRIO
+
+    /* A free draw thread looks at this many available tasks and takes the one nearest to its previous one */
+    #define LV_DRAW_SW_LOCALITY_LOOKAHEAD   4
+
+    /* Per draw thread task/pixel/busy/idle counters, see lv_draw_sw_get_thread_stats() */
+    #define LV_DRAW_SW_STATS            1
+
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -224,10 +252,11 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 16 // 4
     #endif
 
-    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
+    /* esp_lvgl_port blend kernels (assembly + C), see components/esp_lvgl_port/test_apps/simd */
+    #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_CUSTOM
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
-        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
+        #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE "esp_lvgl_port_lv_blend.h"
     #endif /* #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM */
 
     /* Enable drawing complex gradients in software: linear at an angle, radial or conical */
@@ -454,6 +483,10 @@
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/*Default glyph cache size in bytes. The decoded A8 bitmaps of the recently drawn glyphs of the
+ *built-in and BIN fonts are kept here. 0: disable the glyph cache.*/
+#define LV_GLYPH_CACHE_DEF_SIZE (16 * 1024)
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -463,7 +496,10 @@
 #define LV_COLOR_MIX_ROUND_OFS  0
 
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
-#define LV_OBJ_STYLE_CACHE      0
+#define LV_OBJ_STYLE_CACHE      1
+
+/* Number of entries (power of 2) in the global cache of resolved style values. 0: disable */
+#define LV_OBJ_STYLE_VALUE_CACHE 0
 
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
@@ -818,6 +854,9 @@
 /*A layout similar to Grid in CSS.*/
 #define LV_USE_GRID 1
 
+/*Cache the flex and grid layout of containers with at least this many children, 0: disable*/
+#define LV_LAYOUT_CACHE_MIN_CHILDREN 16
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
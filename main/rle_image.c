@@ -0,0 +1,195 @@
+/**
+ * @file      rle_image.c
+ * @author    Baciu Aurel Florin
+ * @brief     Streaming RLE decoder feeding the LCD panel band by band.
+ * @license   MIT
+ * @copyright Copyright (c) 2025 Baciu Aurel Florin
+ * @date      2025-07-01
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "rle_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define RLE_BLK       (2)
+#define RLE_BENCH_RUN (16)
+
+static const char* TAG = "rle_image";
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static bool rle_image_trans_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t* edata, void* user_ctx) {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR((SemaphoreHandle_t) user_ctx, &woken);
+    return woken == pdTRUE;
+}
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void rle_image_stream_init(rle_image_stream_t* s, const rle_image_t* img) {
+    s->src     = img->data;
+    s->end     = img->data + img->data_size;
+    s->pending = 0;
+    s->literal = 0;
+}
+//---------
+uint32_t rle_image_stream_read(rle_image_stream_t* s, uint8_t* dst, uint32_t pixels) {
+    uint32_t done = 0;
+    while (done < pixels) {
+        if (s->pending == 0) {
+            if (s->src >= s->end) {
+                break;  // stream exhausted
+            }
+            uint8_t ctrl = *s->src++;
+            s->literal   = (ctrl & 0x80) ? 1 : 0;
+            s->pending   = ctrl & 0x7F;
+            if (s->src + (s->literal ? s->pending * RLE_BLK : RLE_BLK) > s->end) {
+                s->src     = s->end;  // truncated token, drop it
+                s->pending = 0;
+                break;
+            }
+            continue;
+        }
+        uint32_t n = s->pending;
+        if (n > pixels - done) {
+            n = pixels - done;
+        }
+        if (s->literal) {
+            memcpy(dst, s->src, n * RLE_BLK);
+            s->src += n * RLE_BLK;
+        } else {
+            uint16_t px;
+            memcpy(&px, s->src, RLE_BLK);
+            uint16_t* out = (uint16_t*) dst;  // band buffers are DMA aligned
+            for (uint32_t i = 0; i < n; i++) {
+                out[i] = px;
+            }
+        }
+        dst += n * RLE_BLK;
+        done += n;
+        s->pending -= n;
+        if (!s->literal && s->pending == 0) {
+            s->src += RLE_BLK;  // repeat token consumed
+        }
+    }
+    return done;
+}
+//---------
+esp_err_t rle_image_draw(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io, const rle_image_t* img, int x, int y) {
+    const uint32_t    band_px  = (uint32_t) img->width * RLE_IMAGE_BAND_ROWS;
+    esp_err_t         ret      = ESP_OK;
+    uint8_t*          band[2]  = {NULL, NULL};
+    SemaphoreHandle_t free_sem = xSemaphoreCreateCounting(2, 2);  // one count per idle band
+
+    band[0] = heap_caps_malloc(band_px * RLE_BLK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    band[1] = heap_caps_malloc(band_px * RLE_BLK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!band[0] || !band[1] || !free_sem) {
+        ESP_LOGE(TAG, "no memory for %u byte band buffers", (unsigned) (band_px * RLE_BLK));
+        ret = ESP_ERR_NO_MEM;
+        goto out;
+    }
+
+    // tx_param waits for the color transfers already queued on `io` (e.g. a background fill),
+    // so their completions can't give free_sem and let the bands be freed while still in flight
+    ret = esp_lcd_panel_io_tx_param(io, LCD_CMD_NOP, NULL, 0);
+    if (ret != ESP_OK) {
+        goto out;
+    }
+    esp_lcd_panel_io_callbacks_t cbs = {.on_color_trans_done = rle_image_trans_done};
+    ret                              = esp_lcd_panel_io_register_event_callbacks(io, &cbs, free_sem);
+    if (ret != ESP_OK) {
+        goto out;
+    }
+
+    rle_image_stream_t s;
+    rle_image_stream_init(&s, img);
+    for (int row = 0, i = 0; row < img->height; row += RLE_IMAGE_BAND_ROWS, i ^= 1) {
+        int rows = img->height - row;
+        if (rows > RLE_IMAGE_BAND_ROWS) {
+            rows = RLE_IMAGE_BAND_ROWS;
+        }
+        xSemaphoreTake(free_sem, portMAX_DELAY);  // band[i] is no longer owned by the DMA
+        uint32_t want = (uint32_t) img->width * rows;
+        if (rle_image_stream_read(&s, band[i], want) != want) {
+            ESP_LOGE(TAG, "stream ended at row %d", row);
+            xSemaphoreGive(free_sem);
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        ret = esp_lcd_panel_draw_bitmap(panel, x, y + row, x + img->width, y + row + rows, band[i]);
+        if (ret != ESP_OK) {
+            xSemaphoreGive(free_sem);
+            break;
+        }
+    }
+    // wait for the last transfers before the bands are freed
+    xSemaphoreTake(free_sem, portMAX_DELAY);
+    xSemaphoreTake(free_sem, portMAX_DELAY);
+
+    // leave the IO without callbacks, see rle_image.h; whoever needs them registers them afterwards
+    esp_lcd_panel_io_callbacks_t none = {.on_color_trans_done = NULL};
+    esp_lcd_panel_io_register_event_callbacks(io, &none, NULL);
+
+out:
+    if (free_sem) {
+        vSemaphoreDelete(free_sem);
+    }
+    heap_caps_free(band[0]);
+    heap_caps_free(band[1]);
+    return ret;
+}
+//---------
+void rle_image_benchmark(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io, const rle_image_t* img, uint32_t pclk_hz) {
+    const uint32_t frame_bytes = (uint32_t) img->width * img->height * RLE_BLK;
+    const uint32_t band_px     = (uint32_t) img->width * RLE_IMAGE_BAND_ROWS;
+    uint8_t*       band        = heap_caps_malloc(band_px * RLE_BLK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (!band) {
+        return;
+    }
+
+    // decode only, the band is overwritten every time
+    int64_t t0 = esp_timer_get_time();
+    for (int run = 0; run < RLE_BENCH_RUN; run++) {
+        rle_image_stream_t s;
+        rle_image_stream_init(&s, img);
+        while (rle_image_stream_read(&s, band, band_px) == band_px) {
+        }
+    }
+    int64_t decode_us = (esp_timer_get_time() - t0) / RLE_BENCH_RUN;
+    heap_caps_free(band);
+
+    // decode + SPI, the real boot path
+    t0 = esp_timer_get_time();
+    rle_image_draw(panel, io, img, 0, 0);
+    int64_t draw_us = esp_timer_get_time() - t0;
+
+    uint32_t spi_us     = (uint32_t) ((uint64_t) frame_bytes * 8 * 1000000 / pclk_hz);
+    uint32_t decode_kbs = decode_us ? (uint32_t) ((uint64_t) frame_bytes * 1000000 / 1024 / decode_us) : 0;
+    uint32_t spi_kbs    = pclk_hz / 8 / 1024;
+
+    ESP_LOGI(TAG, "+-------------------+------------+------------+");
+    ESP_LOGI(TAG, "| %ux%u RLE %6u B  | time [us]  | rate [KB/s]|", img->width, img->height, (unsigned) img->data_size);
+    ESP_LOGI(TAG, "+-------------------+------------+------------+");
+    ESP_LOGI(TAG, "| decode only       | %10lld | %10u |", decode_us, (unsigned) decode_kbs);
+    ESP_LOGI(TAG, "| raw SPI (theory)  | %10u | %10u |", (unsigned) spi_us, (unsigned) spi_kbs);
+    ESP_LOGI(TAG, "| decode + draw     | %10lld | %10s |", draw_us, "-");
+    ESP_LOGI(TAG, "+-------------------+------------+------------+");
+    ESP_LOGI(TAG, "flash %u B vs raw %u B, RAM %u B", (unsigned) img->data_size, (unsigned) frame_bytes,
+        (unsigned) (2 * band_px * RLE_BLK));
+}
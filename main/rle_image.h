@@ -0,0 +1,67 @@
+/**
+ * @file      rle_image.h
+ * @author    Baciu Aurel Florin
+ * @brief     RLE compressed RGB565 images streamed to the LCD through a small band buffer.
+ * @license   MIT
+ * @copyright Copyright (c) 2025 Baciu Aurel Florin
+ * @date      2025-07-01
+ *
+ * The data is produced at build time by extras/tools/image_rle.py and uses
+ * the lv_rle token format with a 2 byte block (one pixel).
+ */
+
+// (ESP32-S3 , ESP-IDF , C++17 , FreeRTOS)
+
+#pragma once
+#ifndef __RLE_IMAGE_H__
+#define __RLE_IMAGE_H__
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+
+/* Rows decoded per SPI transaction; two bands are kept in flight. */
+#ifndef RLE_IMAGE_BAND_ROWS
+#define RLE_IMAGE_BAND_ROWS (8)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* #ifdef __cplusplus */
+
+typedef struct {
+    uint16_t       width;
+    uint16_t       height;
+    uint32_t       data_size;
+    const uint8_t* data;
+} rle_image_t;
+
+/* Resumable decoder state, a run or literal may span several bands. */
+typedef struct {
+    const uint8_t* src;
+    const uint8_t* end;
+    uint8_t        pending;  // pixels left in the current token
+    uint8_t        literal;  // 1 = literal token, 0 = repeat token
+} rle_image_stream_t;
+
+void rle_image_stream_init(rle_image_stream_t* s, const rle_image_t* img);
+
+/* Decode up to `pixels` pixels into `dst`, returns the number actually written. */
+uint32_t rle_image_stream_read(rle_image_stream_t* s, uint8_t* dst, uint32_t pixels);
+
+/* Decode `img` band by band and push it to the panel at (x, y).
+ * The function owns the event callbacks of `io` while it runs: it registers its own
+ * `on_color_trans_done` and leaves none registered on return (esp_lcd can't read back
+ * the previous one). Call it before anything that needs them, e.g. lvgl_port_add_disp().
+ * Transfers queued on `io` before the call are waited for first (a NOP command). */
+esp_err_t rle_image_draw(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io, const rle_image_t* img, int x, int y);
+
+/* Log decode throughput against the raw SPI rate given by `pclk_hz`. Draws with rle_image_draw(), same callback rule. */
+void rle_image_benchmark(esp_lcd_panel_handle_t panel, esp_lcd_panel_io_handle_t io, const rle_image_t* img, uint32_t pclk_hz);
+
+#ifdef __cplusplus
+}
+#endif /* #ifdef __cplusplus */
+
+#endif /* #ifndef __RLE_IMAGE_H__ */
@@ -0,0 +1,112 @@
+#pragma once
+#ifndef BINLOG_H_
+#define BINLOG_H_
+
+/**
+ * Binary log transport with deferred formatting.
+ *
+ * binlog_start() installs binlog_vprintf() as the esp_log output, so every
+ * ESP_LOGx keeps working unchanged. The calling task no longer formats: it stores
+ * the address of the format string (a constant in flash) and the raw arguments
+ * into the ring buffer of its core. Only interrupts of that core are masked
+ * during the copy; no lock is taken and nothing blocks. A low priority task
+ * drains the rings to a sink (UART, file, TCP). extras/tools/binlog_decode.py
+ * formats the records on the host with the strings of the application ELF.
+ *
+ * A record that can't be deferred (format not in flash, %n, too many arguments,
+ * too long) is formatted in the caller and sent as text. A full ring drops the
+ * new records and reports how many.
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+/**********************
+ *   SETTINGS
+ **********************/
+#ifndef BINLOG_RING_SIZE
+#define BINLOG_RING_SIZE (8 * 1024)  // per core, power of two
+#endif
+
+#ifndef BINLOG_MAX_RECORD
+#define BINLOG_MAX_RECORD (192)  // bytes of one record, header included
+#endif
+
+#ifndef BINLOG_MAX_STR
+#define BINLOG_MAX_STR (64)  // a %s copied from RAM is cut after this many bytes
+#endif
+
+#ifndef BINLOG_FMT_CACHE
+#define BINLOG_FMT_CACHE (128)  // parsed format strings kept (slots)
+#endif
+
+#ifndef BINLOG_DRAIN_PERIOD_MS
+#define BINLOG_DRAIN_PERIOD_MS (20)
+#endif
+
+#ifndef BINLOG_BATCH_SIZE
+#define BINLOG_BATCH_SIZE (1024)  // bytes handed to the sink at once
+#endif
+
+#ifndef BINLOG_TASK_STACK
+#define BINLOG_TASK_STACK (3072)
+#endif
+
+#ifndef BINLOG_TASK_PRIORITY
+#define BINLOG_TASK_PRIORITY (1)
+#endif
+
+#ifndef BINLOG_FILE_MAX_SIZE
+#define BINLOG_FILE_MAX_SIZE (256 * 1024)  // then renamed to <path>.old and started over
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Where the drained bytes go; binlog_sink_uart/file/tcp() fill one in. */
+typedef struct {
+    void* ctx;
+    /* Optional. 0: not ready, keep the data (e.g. no TCP client yet); 1: ready;
+     * 2: ready on a new stream (new file, new client), the header is sent first. */
+    int (*ready)(void* ctx);
+    esp_err_t (*write)(void* ctx, const void* data, size_t len);
+    void (*close)(void* ctx);  // optional
+} binlog_sink_t;
+
+typedef struct {
+    uint32_t records;      // deferred records
+    uint32_t text;         // records formatted in the caller
+    uint32_t truncated;    // text records cut at BINLOG_MAX_RECORD
+    uint32_t dropped;      // ring full
+    uint32_t bytes;        // sent to the sink
+    uint32_t sink_errors;  // failed writes, their bytes are lost
+    uint32_t ring_used;    // bytes waiting, all cores
+    uint32_t ring_peak;    // most bytes waiting in one ring
+} binlog_stats_t;
+
+/* Starts the drain task and redirects esp_log to binlog. The sink is owned by
+ * binlog until binlog_stop(). */
+esp_err_t binlog_start(const binlog_sink_t* sink);
+/* Puts the previous esp_log output back, drains what's left and closes the sink. */
+esp_err_t binlog_stop(void);
+bool      binlog_running(void);
+
+/* esp_log output function (vprintf_like_t), also usable directly. */
+int  binlog_vprintf(const char* fmt, va_list args);
+void binlog_get_stats(binlog_stats_t* out);
+
+/* Sinks. uart: the driver is installed (TX only use) if it's not already. */
+esp_err_t binlog_sink_uart(binlog_sink_t* out, int uart_num, int baud);
+esp_err_t binlog_sink_file(binlog_sink_t* out, const char* path);
+esp_err_t binlog_sink_tcp(binlog_sink_t* out, uint16_t port);  // one client at a time
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BINLOG_H_ */
@@ -0,0 +1,348 @@
+/**
+ * @file binlog.c
+ * @brief esp_log backend: per-core rings filled by the callers, drained by a task.
+ */
+
+#include "binlog.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "binlog_record.h"
+#include "esp_app_desc.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_memory_utils.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static const char* TAG = "binlog";
+
+_Static_assert((BINLOG_FMT_CACHE & (BINLOG_FMT_CACHE - 1)) == 0, "BINLOG_FMT_CACHE must be a power of two");
+_Static_assert(BINLOG_MAX_RECORD <= BINLOG_BATCH_SIZE, "a record must fit in a batch");
+_Static_assert(BINLOG_MAX_RECORD <= BINLOG_RING_SIZE, "a record must fit in a ring");
+
+// --------------------------------------- //
+
+/* One per core. The producers of a core are serialized by masking its
+ * interrupts, so only they move head; only the drain task moves tail. */
+typedef struct {
+    uint8_t* buf;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t dropped;       // producers
+    uint32_t dropped_sent;  // drain task
+    uint32_t records;
+    uint32_t text;
+    uint32_t truncated;
+    uint32_t peak;
+} binlog_ring_t;
+
+enum { SLOT_FREE, SLOT_BUSY, SLOT_READY };
+
+/* Parsed formats. A slot is claimed once and never reused, so a reader that saw
+ * SLOT_READY reads a stable fmt/sig pair. */
+typedef struct {
+    uint32_t    state;
+    const char* fmt;
+    uint64_t    sig;
+    bool        ok;
+} binlog_fmt_slot_t;
+
+static binlog_ring_t     s_rings[portNUM_PROCESSORS];
+static binlog_fmt_slot_t s_fmt_cache[BINLOG_FMT_CACHE];
+
+static struct {
+    TaskHandle_t      task;
+    SemaphoreHandle_t done;
+    volatile bool     stopping;
+    bool              new_stream;  // header before the next bytes
+    binlog_sink_t     sink;
+    vprintf_like_t    prev_vprintf;
+    uint32_t          bytes;
+    uint32_t          sink_errors;
+    size_t            batch_used;
+    uint8_t           batch[BINLOG_BATCH_SIZE];
+} s_log;
+
+// --------------------------------------- //
+// Producer side, in the task (or ISR) that logs
+
+static bool in_flash(const void* p) {
+    return esp_ptr_in_drom(p);
+}
+
+static bool fmt_lookup(const char* fmt, uint64_t* sig) {
+    uint32_t hash = (uint32_t) ((uintptr_t) fmt >> 2) * 2654435761u;
+    for (unsigned i = 0; i < 8; i++) {
+        binlog_fmt_slot_t* slot  = &s_fmt_cache[(hash + i) & (BINLOG_FMT_CACHE - 1)];
+        uint32_t           state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+        if (state == SLOT_READY) {
+            if (slot->fmt == fmt) {
+                *sig = slot->sig;
+                return slot->ok;
+            }
+            continue;
+        }
+        if (state == SLOT_BUSY) {
+            continue;
+        }
+        bool     ok       = binlog_parse_format(fmt, sig);
+        uint32_t expected = SLOT_FREE;
+        if (__atomic_compare_exchange_n(&slot->state, &expected, SLOT_BUSY, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            slot->fmt = fmt;
+            slot->sig = *sig;
+            slot->ok  = ok;
+            __atomic_store_n(&slot->state, SLOT_READY, __ATOMIC_RELEASE);
+        }
+        return ok;
+    }
+    return binlog_parse_format(fmt, sig);  // neighbourhood full, parse every time
+}
+
+static void ring_put(binlog_ring_t* r, uint32_t at, const uint8_t* src, size_t len) {
+    uint32_t pos   = at & (BINLOG_RING_SIZE - 1);
+    size_t   first = BINLOG_RING_SIZE - pos;
+    if (first >= len) {
+        memcpy(r->buf + pos, src, len);
+    } else {
+        memcpy(r->buf + pos, src, first);
+        memcpy(r->buf, src + first, len - first);
+    }
+}
+
+static void push(uint8_t* rec, binlog_rec_type_t type, size_t payload, bool truncated) {
+    size_t len = BINLOG_REC_HEADER_SIZE + payload;
+
+    // no task switch and no other producer on this core until the record is in
+    UBaseType_t    irq  = portSET_INTERRUPT_MASK_FROM_ISR();
+    unsigned       core = esp_cpu_get_core_id();
+    binlog_ring_t* r    = &s_rings[core];
+    binlog_put_header(rec, type, core, payload, (uint32_t) esp_timer_get_time());
+
+    uint32_t head = r->head;
+    uint32_t used = head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    if (r->buf == NULL || BINLOG_RING_SIZE - used < len) {
+        r->dropped++;
+    } else {
+        ring_put(r, head, rec, len);
+        __atomic_store_n(&r->head, head + len, __ATOMIC_RELEASE);
+        if (type == BINLOG_REC_FMT) {
+            r->records++;
+        } else {
+            r->text++;
+            r->truncated += truncated;
+        }
+        if (used + len > r->peak) {
+            r->peak = used + len;
+        }
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+}
+
+int binlog_vprintf(const char* fmt, va_list args) {
+    uint8_t  rec[BINLOG_MAX_RECORD];
+    uint8_t* payload = rec + BINLOG_REC_HEADER_SIZE;
+    size_t   cap     = sizeof(rec) - BINLOG_REC_HEADER_SIZE;
+    size_t   n       = 0;
+    uint64_t sig;
+
+    // the ESP_LOGx formats are literals, so their address identifies them in the ELF
+    if (esp_ptr_in_drom(fmt) && fmt_lookup(fmt, &sig)) {
+        va_list copy;
+        va_copy(copy, args);
+        n = binlog_encode_fmt(payload, cap, fmt, sig, copy, in_flash);
+        va_end(copy);
+    }
+    if (n > 0) {
+        push(rec, BINLOG_REC_FMT, n, false);
+    } else {
+        int len = vsnprintf((char*) payload, cap, fmt, args);
+        n       = len < 0 ? 0 : ((size_t) len < cap ? (size_t) len : cap - 1);
+        push(rec, BINLOG_REC_TEXT, n, len >= 0 && (size_t) len >= cap);
+    }
+    return (int) n;
+}
+
+// --------------------------------------- //
+// Drain task
+
+static void ring_get(const binlog_ring_t* r, uint32_t at, uint8_t* dst, size_t len) {
+    uint32_t pos   = at & (BINLOG_RING_SIZE - 1);
+    size_t   first = BINLOG_RING_SIZE - pos;
+    if (first >= len) {
+        memcpy(dst, r->buf + pos, len);
+    } else {
+        memcpy(dst, r->buf + pos, first);
+        memcpy(dst + first, r->buf, len - first);
+    }
+}
+
+static void batch_flush(void) {
+    if (s_log.batch_used == 0) {
+        return;
+    }
+    if (s_log.sink.write(s_log.sink.ctx, s_log.batch, s_log.batch_used) == ESP_OK) {
+        s_log.bytes += s_log.batch_used;
+    } else {
+        s_log.sink_errors++;
+    }
+    s_log.batch_used = 0;
+}
+
+static uint8_t* batch_reserve(size_t len) {
+    if (s_log.batch_used + len > sizeof(s_log.batch)) {
+        batch_flush();
+    }
+    uint8_t* p = s_log.batch + s_log.batch_used;
+    s_log.batch_used += len;
+    return p;
+}
+
+static void put_stream_header(void) {
+    char sha[17] = {0};
+    esp_app_get_elf_sha256(sha, sizeof(sha));
+    size_t   n = strlen(sha);
+    uint8_t* p = batch_reserve(7 + n);
+    memcpy(p, BINLOG_MAGIC, 4);
+    p[4] = BINLOG_VERSION;
+    p[5] = (uint8_t) ((sizeof(long) << 4) | sizeof(size_t));
+    p[6] = (uint8_t) n;
+    memcpy(p + 7, sha, n);
+}
+
+static void drain(void) {
+    int state = s_log.sink.ready ? s_log.sink.ready(s_log.sink.ctx) : 1;
+    if (state == 0) {
+        return;  // kept in the rings, the producers drop once they're full
+    }
+    if (state == 2 || s_log.new_stream) {
+        s_log.new_stream = false;
+        put_stream_header();
+    }
+
+    for (unsigned c = 0; c < portNUM_PROCESSORS; c++) {
+        binlog_ring_t* r       = &s_rings[c];
+        uint32_t       dropped = __atomic_load_n(&r->dropped, __ATOMIC_RELAXED);
+        if (dropped != r->dropped_sent) {
+            uint8_t* p = batch_reserve(BINLOG_REC_HEADER_SIZE + 4);
+            binlog_put_header(p, BINLOG_REC_DROPPED, c, 4, (uint32_t) esp_timer_get_time());
+            uint32_t lost = dropped - r->dropped_sent;
+            memcpy(p + BINLOG_REC_HEADER_SIZE, &lost, 4);
+            r->dropped_sent = dropped;
+        }
+    }
+
+    // cores merged by timestamp, oldest record first
+    for (;;) {
+        binlog_ring_t* best    = NULL;
+        uint32_t       best_ts = 0;
+        for (unsigned c = 0; c < portNUM_PROCESSORS; c++) {
+            binlog_ring_t* r = &s_rings[c];
+            if (r->buf == NULL || r->tail == __atomic_load_n(&r->head, __ATOMIC_ACQUIRE)) {
+                continue;
+            }
+            uint8_t hdr[BINLOG_REC_HEADER_SIZE];
+            ring_get(r, r->tail, hdr, sizeof(hdr));
+            uint32_t ts = hdr[4] | hdr[5] << 8 | hdr[6] << 16 | (uint32_t) hdr[7] << 24;
+            if (best == NULL || (int32_t) (ts - best_ts) < 0) {
+                best    = r;
+                best_ts = ts;
+            }
+        }
+        if (best == NULL) {
+            break;
+        }
+        uint8_t hdr[BINLOG_REC_HEADER_SIZE];
+        ring_get(best, best->tail, hdr, sizeof(hdr));
+        size_t len = BINLOG_REC_HEADER_SIZE + (hdr[2] | hdr[3] << 8);
+        ring_get(best, best->tail, batch_reserve(len), len);
+        __atomic_store_n(&best->tail, best->tail + len, __ATOMIC_RELEASE);
+    }
+    batch_flush();
+}
+
+static void binlog_task(void* arg) {
+    while (!s_log.stopping) {
+        vTaskDelay(pdMS_TO_TICKS(BINLOG_DRAIN_PERIOD_MS));
+        drain();
+    }
+    drain();
+    if (s_log.sink.close) {
+        s_log.sink.close(s_log.sink.ctx);
+    }
+    s_log.task = NULL;
+    xSemaphoreGive(s_log.done);
+    vTaskDelete(NULL);
+}
+
+// --------------------------------------- //
+
+esp_err_t binlog_start(const binlog_sink_t* sink) {
+    if (sink == NULL || sink->write == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_log.task) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    for (unsigned c = 0; c < portNUM_PROCESSORS; c++) {
+        if (s_rings[c].buf == NULL) {  // kept once allocated, a late producer may still write
+            s_rings[c].buf = heap_caps_malloc(BINLOG_RING_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+            if (s_rings[c].buf == NULL) {
+                return ESP_ERR_NO_MEM;
+            }
+        }
+    }
+    if (s_log.done == NULL) {
+        s_log.done = xSemaphoreCreateBinary();
+        if (s_log.done == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    s_log.sink       = *sink;
+    s_log.new_stream = true;
+    s_log.stopping   = false;
+    s_log.batch_used = 0;
+    if (xTaskCreate(binlog_task, "binlog", BINLOG_TASK_STACK, NULL, BINLOG_TASK_PRIORITY, &s_log.task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "esp_log output moves to binlog");
+    s_log.prev_vprintf = esp_log_set_vprintf(binlog_vprintf);
+    return ESP_OK;
+}
+
+esp_err_t binlog_stop(void) {
+    if (s_log.task == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_log_set_vprintf(s_log.prev_vprintf);
+    s_log.stopping = true;
+    xSemaphoreTake(s_log.done, portMAX_DELAY);
+    ESP_LOGI(TAG, "esp_log output back to text");
+    return ESP_OK;
+}
+
+bool binlog_running(void) {
+    return s_log.task != NULL;
+}
+
+void binlog_get_stats(binlog_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+    for (unsigned c = 0; c < portNUM_PROCESSORS; c++) {
+        const binlog_ring_t* r = &s_rings[c];
+        out->records += r->records;
+        out->text += r->text;
+        out->truncated += r->truncated;
+        out->dropped += r->dropped;
+        out->ring_used += __atomic_load_n(&r->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+        if (r->peak > out->ring_peak) {
+            out->ring_peak = r->peak;
+        }
+    }
+    out->bytes       = s_log.bytes;
+    out->sink_errors = s_log.sink_errors;
+}
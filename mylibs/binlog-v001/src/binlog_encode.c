@@ -0,0 +1,257 @@
+/**
+ * @file binlog_encode.c
+ * @brief printf format signatures and FMT record payloads (no RTOS, no driver).
+ */
+
+#include <string.h>
+
+#include "binlog.h"
+#include "binlog_record.h"
+
+// --------------------------------------- //
+
+static bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static bool is_flag(char c) {
+    return c == '-' || c == '+' || c == ' ' || c == '#' || c == '0' || c == '\'';
+}
+
+enum { LEN_NONE, LEN_SHORT, LEN_LONG, LEN_LLONG, LEN_SIZE, LEN_LDOUBLE };
+
+bool binlog_parse_format(const char* fmt, uint64_t* sig) {
+    uint64_t s = 0;
+    unsigned n = 0;
+#define PUSH(type)                                 \
+    do {                                           \
+        if (n == BINLOG_MAX_ARGS) {                \
+            return false;                          \
+        }                                          \
+        s |= (uint64_t) (type) << (4 * n++);       \
+    } while (0)
+
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '%') {
+            continue;
+        }
+        p++;
+        if (*p == '%') {
+            continue;
+        }
+        while (is_flag(*p)) {
+            p++;
+        }
+        if (*p == '*') {
+            PUSH(BINLOG_ARG_I32);
+            p++;
+        }
+        while (is_digit(*p)) {
+            p++;
+        }
+        bool     prec_var   = false;
+        bool     prec_fixed = false;
+        unsigned prec       = 0;
+        if (*p == '.') {
+            p++;
+            if (*p == '*') {
+                PUSH(BINLOG_ARG_I32);
+                prec_var = true;
+                p++;
+            } else {
+                prec_fixed = true;
+            }
+            while (is_digit(*p)) {
+                if (prec < BINLOG_MAX_STR) {
+                    prec = prec * 10 + (unsigned) (*p - '0');
+                }
+                p++;
+            }
+        }
+
+        int len = LEN_NONE;
+        switch (*p) {
+            case 'h':
+                len = LEN_SHORT;
+                p += p[1] == 'h' ? 2 : 1;
+                break;
+            case 'l':
+                len = p[1] == 'l' ? LEN_LLONG : LEN_LONG;
+                p += p[1] == 'l' ? 2 : 1;
+                break;
+            case 'j':
+                len = LEN_LLONG;
+                p++;
+                break;
+            case 'z':
+            case 't':
+                len = LEN_SIZE;
+                p++;
+                break;
+            case 'L':
+                len = LEN_LDOUBLE;
+                p++;
+                break;
+            default:
+                break;
+        }
+
+        switch (*p) {
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                if (len == LEN_LLONG || (len == LEN_LONG && sizeof(long) == 8) ||
+                    (len == LEN_SIZE && sizeof(size_t) == 8)) {
+                    PUSH(BINLOG_ARG_I64);
+                } else {
+                    PUSH(BINLOG_ARG_I32);
+                }
+                break;
+            case 'c':
+                if (len == LEN_LONG) {
+                    return false;  // wint_t
+                }
+                PUSH(BINLOG_ARG_I32);
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                if (len == LEN_LDOUBLE) {
+                    return false;
+                }
+                PUSH(BINLOG_ARG_F64);
+                break;
+            case 's':
+                if (len == LEN_LONG) {
+                    return false;  // wchar_t*
+                }
+                if (prec_var) {
+                    PUSH(BINLOG_ARG_STR_VAR);
+                } else if (prec_fixed) {
+                    // the precision bounds the read: the buffer may have no NUL
+                    prec = prec < BINLOG_MAX_STR ? prec : BINLOG_MAX_STR;
+                    PUSH(BINLOG_ARG_STR_FIXED);
+                    PUSH(prec & 0x0f);
+                    PUSH(prec >> 4);
+                } else {
+                    PUSH(BINLOG_ARG_STR);
+                }
+                break;
+            case 'p':
+                PUSH(BINLOG_ARG_PTR);
+                break;
+            default:
+                return false;  // %n, unknown, or a lone '%' at the end
+        }
+    }
+#undef PUSH
+    *sig = s;
+    return true;
+}
+
+// --------------------------------------- //
+
+static void put_u32(uint8_t* out, uint32_t v) {
+    out[0] = (uint8_t) v;
+    out[1] = (uint8_t) (v >> 8);
+    out[2] = (uint8_t) (v >> 16);
+    out[3] = (uint8_t) (v >> 24);
+}
+
+static void put_u64(uint8_t* out, uint64_t v) {
+    put_u32(out, (uint32_t) v);
+    put_u32(out + 4, (uint32_t) (v >> 32));
+}
+
+size_t binlog_encode_fmt(uint8_t* out, size_t size, const char* fmt, uint64_t sig, va_list args,
+    bool (*in_flash)(const void* p)) {
+    if (size < 4) {
+        return 0;
+    }
+    put_u32(out, (uint32_t) (uintptr_t) fmt);
+    size_t pos      = 4;
+    int    last_i32 = -1;  // precision of a following %.*s
+
+    for (; sig != 0; sig >>= 4) {
+        binlog_arg_t type = (binlog_arg_t) (sig & 0x0f);
+        switch (type) {
+            case BINLOG_ARG_I32:
+                if (size - pos < 4) {
+                    return 0;
+                }
+                last_i32 = va_arg(args, int);
+                put_u32(out + pos, (uint32_t) last_i32);
+                pos += 4;
+                break;
+            case BINLOG_ARG_I64:
+                if (size - pos < 8) {
+                    return 0;
+                }
+                put_u64(out + pos, (uint64_t) va_arg(args, long long));
+                pos += 8;
+                break;
+            case BINLOG_ARG_F64: {
+                if (size - pos < 8) {
+                    return 0;
+                }
+                double   d = va_arg(args, double);
+                uint64_t bits;
+                memcpy(&bits, &d, sizeof(bits));
+                put_u64(out + pos, bits);
+                pos += 8;
+                break;
+            }
+            case BINLOG_ARG_PTR:
+                if (size - pos < 4) {
+                    return 0;
+                }
+                put_u32(out + pos, (uint32_t) (uintptr_t) va_arg(args, void*));
+                pos += 4;
+                break;
+            case BINLOG_ARG_STR:
+            case BINLOG_ARG_STR_VAR:
+            case BINLOG_ARG_STR_FIXED: {
+                size_t max = BINLOG_MAX_STR;
+                if (type == BINLOG_ARG_STR_VAR && last_i32 >= 0 && (unsigned) last_i32 < max) {
+                    max = (size_t) last_i32;  // negative: no precision
+                } else if (type == BINLOG_ARG_STR_FIXED) {
+                    max = (size_t) ((sig >> 4) & 0xff);
+                    sig >>= 8;
+                }
+                const char* str = va_arg(args, const char*);
+                if (str && in_flash && in_flash(str)) {
+                    // constant string (tags mostly): the decoder reads it from the ELF
+                    if (size - pos < 5) {
+                        return 0;
+                    }
+                    out[pos] = BINLOG_STR_ADDR;
+                    put_u32(out + pos + 1, (uint32_t) (uintptr_t) str);
+                    pos += 5;
+                } else {
+                    if (str == NULL) {
+                        str = "(null)";
+                    }
+                    size_t n = strnlen(str, max);
+                    if (size - pos < 1 + n) {
+                        return 0;
+                    }
+                    out[pos] = (uint8_t) n;
+                    memcpy(out + pos + 1, str, n);
+                    pos += 1 + n;
+                }
+                break;
+            }
+            default:
+                return 0;
+        }
+    }
+    return pos;
+}
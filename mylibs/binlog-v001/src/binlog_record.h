@@ -0,0 +1,79 @@
+#pragma once
+#ifndef BINLOG_RECORD_H_
+#define BINLOG_RECORD_H_
+
+/**
+ * Stream format, little endian (decoded by extras/tools/binlog_decode.py).
+ *
+ * Header, at the start of every stream (file, TCP client, UART start):
+ *   "BLOG" | u8 version | u8 sizeof(long) << 4 | sizeof(size_t) | u8 n | n chars: start of the ELF SHA-256, hex
+ *
+ * Record:
+ *   u8 0xB7 | u8 type << 4 | core | u16 payload length | u32 timestamp, us | payload
+ *
+ *   FMT     u32 address of the format string, then the arguments in order:
+ *             I32 / PTR: 4 bytes, I64 / F64: 8 bytes,
+ *             STR: u8 0xFF + u32 address (string in flash) or u8 n + n bytes
+ *   TEXT    the text, formatted by the caller
+ *   DROPPED u32 records lost since the previous DROPPED of that core
+ *
+ * The decoder skips bytes until "BLOG" or 0xB7, so it resyncs after garbage.
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "binlog.h"
+
+#define BINLOG_MAGIC           "BLOG"
+#define BINLOG_VERSION         (1)
+#define BINLOG_SYNC            (0xB7)
+#define BINLOG_REC_HEADER_SIZE (8)
+
+#define BINLOG_MAX_ARGS (15)  // 4 bits each in a signature
+#define BINLOG_STR_ADDR (0xFF)  // %s sent as an address
+
+_Static_assert(BINLOG_MAX_STR < BINLOG_STR_ADDR, "an inline %s length must not look like BINLOG_STR_ADDR");
+_Static_assert((BINLOG_RING_SIZE & (BINLOG_RING_SIZE - 1)) == 0, "BINLOG_RING_SIZE must be a power of two");
+
+typedef enum {
+    BINLOG_REC_FMT     = 0,
+    BINLOG_REC_TEXT    = 1,
+    BINLOG_REC_DROPPED = 2,
+} binlog_rec_type_t;
+
+typedef enum {
+    BINLOG_ARG_END = 0,
+    BINLOG_ARG_I32,
+    BINLOG_ARG_I64,
+    BINLOG_ARG_F64,
+    BINLOG_ARG_PTR,
+    BINLOG_ARG_STR,
+    BINLOG_ARG_STR_VAR,    // %.*s: the I32 before it is the precision
+    BINLOG_ARG_STR_FIXED,  // %.Ns: min(N, BINLOG_MAX_STR) in the next two nibbles, low first
+} binlog_arg_t;
+
+/* Argument types of a printf format, 4 bits each, first argument in the low bits.
+ * false for what can't be deferred (%n, long double, wide strings, too many). */
+bool binlog_parse_format(const char* fmt, uint64_t* sig);
+
+/* Payload of a FMT record; 0 if it doesn't fit in `size`. `in_flash` tells
+ * whether a %s can be sent as an address. */
+size_t binlog_encode_fmt(uint8_t* out, size_t size, const char* fmt, uint64_t sig, va_list args,
+    bool (*in_flash)(const void* p));
+
+/* Record header; `payload` bytes follow it. */
+static inline void binlog_put_header(uint8_t* out, binlog_rec_type_t type, unsigned core, size_t payload, uint32_t ts) {
+    out[0] = BINLOG_SYNC;
+    out[1] = (uint8_t) ((type << 4) | (core & 0x0f));
+    out[2] = (uint8_t) payload;
+    out[3] = (uint8_t) (payload >> 8);
+    out[4] = (uint8_t) ts;
+    out[5] = (uint8_t) (ts >> 8);
+    out[6] = (uint8_t) (ts >> 16);
+    out[7] = (uint8_t) (ts >> 24);
+}
+
+#endif /* BINLOG_RECORD_H_ */
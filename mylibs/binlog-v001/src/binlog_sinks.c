@@ -0,0 +1,206 @@
+/**
+ * @file binlog_sinks.c
+ * @brief UART, file and TCP sinks for binlog. All the calls come from the drain task.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "binlog.h"
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "lwip/sockets.h"
+#include "soc/soc_caps.h"
+
+static const char* TAG = "binlog";
+
+// --------------------------------------- //
+// UART
+
+static esp_err_t uart_sink_write(void* ctx, const void* data, size_t len) {
+    int n = uart_write_bytes((uart_port_t) (intptr_t) ctx, data, len);
+    return n == (int) len ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t binlog_sink_uart(binlog_sink_t* out, int uart_num, int baud) {
+    if (out == NULL || uart_num < 0 || uart_num >= SOC_UART_NUM) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!uart_is_driver_installed(uart_num)) {
+        uart_config_t cfg = {
+            .baud_rate  = baud,
+            .data_bits  = UART_DATA_8_BITS,
+            .parity     = UART_PARITY_DISABLE,
+            .stop_bits  = UART_STOP_BITS_1,
+            .flow_ctrl  = UART_HW_FLOWCTRL_DISABLE,
+            .source_clk = UART_SCLK_DEFAULT,
+        };
+        // the TX buffer takes two batches, so the drain task rarely waits
+        esp_err_t err = uart_driver_install(uart_num, SOC_UART_FIFO_LEN * 2, BINLOG_BATCH_SIZE * 2, 0, NULL, 0);
+        if (err == ESP_OK) {
+            err = uart_param_config(uart_num, &cfg);
+        }
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "UART%d: %s", uart_num, esp_err_to_name(err));
+            return err;
+        }
+    }
+    *out = (binlog_sink_t) {
+        .ctx   = (void*) (intptr_t) uart_num,
+        .write = uart_sink_write,
+    };
+    return ESP_OK;
+}
+
+// --------------------------------------- //
+// File, rotated to <path>.old once it reaches BINLOG_FILE_MAX_SIZE
+
+static struct {
+    FILE* f;
+    long  size;
+    char  path[48];
+    bool  in_use;
+} s_file;
+
+static int file_ready(void* ctx) {
+    if (s_file.f) {
+        return 1;
+    }
+    s_file.f = fopen(s_file.path, "ab");
+    if (s_file.f == NULL) {
+        return 0;
+    }
+    fseek(s_file.f, 0, SEEK_END);
+    s_file.size = ftell(s_file.f);
+    return 2;  // a reader may start at any file, each one gets a header
+}
+
+static esp_err_t file_write(void* ctx, const void* data, size_t len) {
+    size_t n = fwrite(data, 1, len, s_file.f);
+    fflush(s_file.f);
+    s_file.size += (long) n;
+    if (n == len && s_file.size < BINLOG_FILE_MAX_SIZE) {
+        return ESP_OK;
+    }
+
+    fclose(s_file.f);
+    s_file.f = NULL;
+    if (n == len) {
+        char old[sizeof(s_file.path) + 4];
+        snprintf(old, sizeof(old), "%s.old", s_file.path);
+        remove(old);
+        rename(s_file.path, old);
+        return ESP_OK;
+    }
+    return ESP_FAIL;  // reopened on the next drain
+}
+
+static void file_close(void* ctx) {
+    if (s_file.f) {
+        fclose(s_file.f);
+        s_file.f = NULL;
+    }
+    s_file.in_use = false;
+}
+
+esp_err_t binlog_sink_file(binlog_sink_t* out, const char* path) {
+    if (out == NULL || path == NULL || strlen(path) >= sizeof(s_file.path)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_file.in_use) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    strcpy(s_file.path, path);
+    s_file.in_use = true;
+    *out = (binlog_sink_t) {
+        .ready = file_ready,
+        .write = file_write,
+        .close = file_close,
+    };
+    return ESP_OK;
+}
+
+// --------------------------------------- //
+// TCP, one client; nothing is drained while no one is connected
+
+static struct {
+    int listen_fd;
+    int client_fd;
+} s_tcp = {-1, -1};
+
+static int tcp_ready(void* ctx) {
+    if (s_tcp.client_fd >= 0) {
+        return 1;
+    }
+    int fd = accept(s_tcp.listen_fd, NULL, NULL);  // non-blocking
+    if (fd < 0) {
+        return 0;
+    }
+    struct timeval tv = {.tv_sec = 1};
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+    s_tcp.client_fd = fd;
+    return 2;
+}
+
+static esp_err_t tcp_write(void* ctx, const void* data, size_t len) {
+    const uint8_t* p = data;
+    while (len > 0) {
+        int n = send(s_tcp.client_fd, p, len, 0);
+        if (n <= 0) {
+            close(s_tcp.client_fd);  // gone or stuck; wait for the next one
+            s_tcp.client_fd = -1;
+            return ESP_FAIL;
+        }
+        p += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+static void tcp_close(void* ctx) {
+    if (s_tcp.client_fd >= 0) {
+        close(s_tcp.client_fd);
+        s_tcp.client_fd = -1;
+    }
+    if (s_tcp.listen_fd >= 0) {
+        close(s_tcp.listen_fd);
+        s_tcp.listen_fd = -1;
+    }
+}
+
+esp_err_t binlog_sink_tcp(binlog_sink_t* out, uint16_t port) {
+    if (out == NULL || port == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_tcp.listen_fd >= 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+    if (fd < 0) {
+        return ESP_FAIL;
+    }
+    int                on   = 1;
+    struct sockaddr_in addr = {
+        .sin_family      = AF_INET,
+        .sin_port        = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (bind(fd, (struct sockaddr*) &addr, sizeof(addr)) != 0 || listen(fd, 1) != 0) {
+        ESP_LOGE(TAG, "port %u: errno %d", port, errno);
+        close(fd);
+        return ESP_FAIL;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    s_tcp.listen_fd = fd;
+    *out = (binlog_sink_t) {
+        .ready = tcp_ready,
+        .write = tcp_write,
+        .close = tcp_close,
+    };
+    return ESP_OK;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file bench_main.c
+ * @brief cfgstore against plain NVS on the Linux target (NVS on an emulated flash partition).
+ *
+ * - reads:  cfgstore_get_u32() from the cache vs nvs_get_u32() on an open handle;
+ * - writes: a setter called BENCH_SETS times in a row, through cfgstore (coalesced,
+ *           one commit after CFGSTORE_FLUSH_DELAY_MS) vs nvs_set_u32() + nvs_commit().
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "cfgstore.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs.h"
+
+#define BENCH_READS (100000)
+#define BENCH_SETS  (1000)
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void print_row(const char* what, int64_t ns, uint32_t ops, uint32_t commits) {
+    printf("%-28s %10" PRId64 " us %10.1f ns/op %8" PRIu32 " commits\n", what, ns / 1000, (double) ns / ops, commits);
+}
+
+void app_main(void) {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    ESP_ERROR_CHECK(cfgstore_init());
+
+    // valoarea de referinta ajunge in NVS inainte de citiri
+    ESP_ERROR_CHECK(cfgstore_set_u32(CFG_WIFI_TIMEOUT_MS, 12345));
+    ESP_ERROR_CHECK(cfgstore_flush());
+
+    nvs_handle_t nvs;
+    ESP_ERROR_CHECK(nvs_open(CFGSTORE_NAMESPACE, NVS_READWRITE, &nvs));
+    const char* key = cfgstore_key_name(CFG_WIFI_TIMEOUT_MS);
+
+    printf("%d reads, %d sets\n", BENCH_READS, BENCH_SETS);
+
+    volatile uint32_t sink = 0;
+    int64_t           t0   = now_ns();
+    for (int i = 0; i < BENCH_READS; i++) {
+        sink += cfgstore_get_u32(CFG_WIFI_TIMEOUT_MS);
+    }
+    print_row("read  cfgstore_get_u32", now_ns() - t0, BENCH_READS, 0);
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_READS; i++) {
+        uint32_t v = 0;
+        nvs_get_u32(nvs, key, &v);
+        sink += v;
+    }
+    print_row("read  nvs_get_u32", now_ns() - t0, BENCH_READS, 0);
+
+    cfgstore_stats_t before, after;
+    cfgstore_get_stats(&before);
+    t0 = now_ns();
+    for (uint32_t i = 0; i < BENCH_SETS; i++) {
+        cfgstore_set_u32(CFG_WIFI_TIMEOUT_MS, 1000 + i);
+    }
+    const int64_t set_ns = now_ns() - t0;
+    vTaskDelay(pdMS_TO_TICKS(CFGSTORE_FLUSH_DELAY_MS + 200));  // the debounced flush
+    cfgstore_get_stats(&after);
+    print_row("write cfgstore_set_u32", set_ns, BENCH_SETS, after.flushes - before.flushes);
+
+    t0 = now_ns();
+    for (uint32_t i = 0; i < BENCH_SETS; i++) {
+        nvs_set_u32(nvs, "bench.direct", 1000 + i);
+        nvs_commit(nvs);
+    }
+    print_row("write nvs_set_u32 + commit", now_ns() - t0, BENCH_SETS, BENCH_SETS);
+
+    nvs_close(nvs);
+    printf("stored %" PRIu32 " (expected %d), %" PRIu32 " NVS writes for %" PRIu32 " changes\n",
+        cfgstore_get_u32(CFG_WIFI_TIMEOUT_MS), 1000 + BENCH_SETS - 1, after.nvs_sets - before.nvs_sets,
+        after.writes - before.writes);
+    fflush(stdout);
+    exit(0);
+}
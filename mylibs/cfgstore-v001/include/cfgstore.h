@@ -0,0 +1,95 @@
+#pragma once
+#ifndef CFGSTORE_H_
+#define CFGSTORE_H_
+
+/**
+ * Typed configuration store.
+ *
+ * Every key of cfgstore_schema.h lives in a RAM cache loaded from NVS once, by
+ * cfgstore_init(). Reads never touch NVS. Writes update the cache right away and
+ * mark the key dirty; a one-shot timer, restarted by every write, stores the dirty
+ * keys and does a single nvs_commit() once the setters have been quiet for
+ * CFGSTORE_FLUSH_DELAY_MS. A setter called in a loop costs one flash commit.
+ *
+ * Listeners are called after a value changed (not when the same value is set again).
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "cfgstore_schema.h"
+
+/**********************
+ *   SETTINGS
+ **********************/
+#ifndef CFGSTORE_NAMESPACE
+#define CFGSTORE_NAMESPACE "cfg"
+#endif
+
+#ifndef CFGSTORE_FLUSH_DELAY_MS
+#define CFGSTORE_FLUSH_DELAY_MS (1000)  // quiet time before the dirty keys are committed
+#endif
+
+#ifndef CFGSTORE_MAX_LISTENERS
+#define CFGSTORE_MAX_LISTENERS (8)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define CFGSTORE_ENUM(id, key, type, size, def) CFG_##id,
+typedef enum {
+    CFGSTORE_SCHEMA(CFGSTORE_ENUM)
+    CFG_KEY_COUNT
+} cfgstore_key_t;
+#undef CFGSTORE_ENUM
+
+/* Mask of a key, for cfgstore_add_listener(). */
+#define CFG_BIT(id)   (1UL << (id))
+#define CFG_ALL_KEYS  ((uint32_t) ((1ULL << CFG_KEY_COUNT) - 1))
+
+/* Called from the task of the setter, must not block; a reader living on another
+ * task usually just notifies it (xTaskNotify, a queue, an event group...). */
+typedef void (*cfgstore_listener_t)(cfgstore_key_t key, void* arg);
+
+typedef struct {
+    uint32_t writes;     // cfgstore_set_* that changed a value
+    uint32_t unchanged;  // cfgstore_set_* with the value already cached
+    uint32_t flushes;    // nvs_commit() calls
+    uint32_t nvs_sets;   // keys written to NVS
+    uint32_t errors;     // failed flushes, the keys are retried on the next one
+} cfgstore_stats_t;
+
+/* Initializes NVS (erased if it's full or from a newer version), loads every key,
+ * creates the flush timer. Safe to call more than once. */
+esp_err_t cfgstore_init(void);
+
+uint32_t  cfgstore_get_u32(cfgstore_key_t key);  // U8 and U32 keys
+int32_t   cfgstore_get_i32(cfgstore_key_t key);
+/* ESP_ERR_INVALID_SIZE if `size` can't hold the value (it's truncated). */
+esp_err_t cfgstore_get_str(cfgstore_key_t key, char* out, size_t size);
+
+/* ESP_ERR_INVALID_ARG for a value out of the range of the key, a string too long
+ * or a key of another type. */
+esp_err_t cfgstore_set_u32(cfgstore_key_t key, uint32_t value);
+esp_err_t cfgstore_set_i32(cfgstore_key_t key, int32_t value);
+esp_err_t cfgstore_set_str(cfgstore_key_t key, const char* value);
+/* Back to the default of the schema. */
+esp_err_t cfgstore_reset(cfgstore_key_t key);
+
+/* Commits the dirty keys now, e.g. before a restart. */
+esp_err_t cfgstore_flush(void);
+
+esp_err_t cfgstore_add_listener(uint32_t key_mask, cfgstore_listener_t cb, void* arg);
+esp_err_t cfgstore_remove_listener(cfgstore_listener_t cb, void* arg);
+
+const char* cfgstore_key_name(cfgstore_key_t key);  // NVS key, NULL if out of range
+void        cfgstore_get_stats(cfgstore_stats_t* out);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CFGSTORE_H_ */
@@ -0,0 +1,25 @@
+#pragma once
+#ifndef CFGSTORE_SCHEMA_H_
+#define CFGSTORE_SCHEMA_H_
+
+/**
+ * Keys of the configuration store, known at compile time.
+ *
+ * X(id, key, type, size, default)
+ *   id      - CFG_<id> in cfgstore_key_t
+ *   key     - NVS key, at most 15 characters
+ *   type    - U8, U32, I32 or STR
+ *   size    - buffer of a STR value, terminator included (0 for the integers)
+ *   default - value used until one is stored
+ *
+ * Adding a key only takes a line here; removing or retyping one leaves the old
+ * value in NVS, which is then ignored (a value of the wrong type is never loaded).
+ */
+#define CFGSTORE_SCHEMA(X)                                                      \
+    X(LOG_LEVEL, "log.level", U8, 0, 3 /* ESP_LOG_INFO */)                      \
+    X(LOG_TAGS, "log.tags", STR, 128, "") /* "tag=level;tag=level" */          \
+    X(WIFI_SSID, "wifi.ssid", STR, 33, "")                                      \
+    X(WIFI_PASS, "wifi.pass", STR, 65, "")                                      \
+    X(WIFI_TIMEOUT_MS, "wifi.timeout", U32, 0, 10000)
+
+#endif /* CFGSTORE_SCHEMA_H_ */
@@ -0,0 +1,414 @@
+/**
+ * @file cfgstore.c
+ * @brief Typed configuration cache on top of NVS, with coalesced commits.
+ */
+
+#include "cfgstore.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+
+static const char* TAG = "cfgstore";
+
+// --------------------------------------- //
+
+/* One member per key, named after its id. */
+#define CFGSTORE_MEMBER_U8(id, size)  uint32_t id;
+#define CFGSTORE_MEMBER_U32(id, size) uint32_t id;
+#define CFGSTORE_MEMBER_I32(id, size) int32_t id;
+#define CFGSTORE_MEMBER_STR(id, size) char id[size];
+#define CFGSTORE_MEMBER(id, key, type, size, def) CFGSTORE_MEMBER_##type(id, size)
+
+typedef struct {
+    CFGSTORE_SCHEMA(CFGSTORE_MEMBER)
+} cfgstore_values_t;
+
+typedef enum {
+    CFGSTORE_U8,
+    CFGSTORE_U32,
+    CFGSTORE_I32,
+    CFGSTORE_STR,
+} cfgstore_type_t;
+
+typedef struct {
+    const char*     key;
+    cfgstore_type_t type;
+    uint16_t        offset;  // in cfgstore_values_t
+    uint16_t        size;
+} cfgstore_desc_t;
+
+#define CFGSTORE_DESC(id, key, type, size, def) \
+    [CFG_##id] = {key, CFGSTORE_##type, offsetof(cfgstore_values_t, id), sizeof(((cfgstore_values_t*) 0)->id)},
+static const cfgstore_desc_t s_desc[CFG_KEY_COUNT] = {CFGSTORE_SCHEMA(CFGSTORE_DESC)};
+
+#define CFGSTORE_DEFAULT(id, key, type, size, def) .id = def,
+static const cfgstore_values_t s_defaults = {CFGSTORE_SCHEMA(CFGSTORE_DEFAULT)};
+
+#define CFGSTORE_CHECK_KEY(id, key, type, size, def) \
+    _Static_assert(sizeof(key) <= NVS_KEY_NAME_MAX_SIZE, "NVS key too long: " key);
+CFGSTORE_SCHEMA(CFGSTORE_CHECK_KEY)
+_Static_assert(CFG_KEY_COUNT <= 32, "the dirty and listener masks hold 32 keys");
+
+typedef struct {
+    uint32_t            mask;
+    cfgstore_listener_t cb;
+    void*               arg;
+} cfgstore_listener_slot_t;
+
+static struct {
+    SemaphoreHandle_t        lock;        // values, dirty, stats, listeners
+    SemaphoreHandle_t        flush_lock;  // one flush at a time, so an old snapshot never overwrites a newer one
+    TimerHandle_t            timer;
+    nvs_handle_t             nvs;
+    cfgstore_values_t        values;
+    uint32_t                 dirty;
+    cfgstore_stats_t         stats;
+    cfgstore_listener_slot_t listeners[CFGSTORE_MAX_LISTENERS];
+} s_store = {
+    // readers get the defaults until cfgstore_init() loaded the stored values
+    .values = {CFGSTORE_SCHEMA(CFGSTORE_DEFAULT)},
+};
+
+// --------------------------------------- //
+
+static inline void* value_ptr(cfgstore_values_t* values, cfgstore_key_t key) {
+    return (uint8_t*) values + s_desc[key].offset;
+}
+
+static void load_key(cfgstore_key_t key) {
+    const cfgstore_desc_t* d   = &s_desc[key];
+    void*                  dst = value_ptr(&s_store.values, key);
+    esp_err_t              err = ESP_OK;
+
+    switch (d->type) {
+        case CFGSTORE_U8: {
+            uint8_t v;
+            if ((err = nvs_get_u8(s_store.nvs, d->key, &v)) == ESP_OK) {
+                *(uint32_t*) dst = v;
+            }
+            break;
+        }
+        case CFGSTORE_U32:
+            err = nvs_get_u32(s_store.nvs, d->key, (uint32_t*) dst);
+            break;
+        case CFGSTORE_I32:
+            err = nvs_get_i32(s_store.nvs, d->key, (int32_t*) dst);
+            break;
+        case CFGSTORE_STR: {
+            size_t len = d->size;
+            err        = nvs_get_str(s_store.nvs, d->key, (char*) dst, &len);
+            if (err != ESP_OK) {
+                memcpy(dst, (const uint8_t*) &s_defaults + d->offset, d->size);
+            }
+            break;
+        }
+    }
+
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGW(TAG, "'%s' not loaded (%s), using the default", d->key, esp_err_to_name(err));
+    }
+}
+
+static esp_err_t write_key(cfgstore_key_t key, cfgstore_values_t* values) {
+    const cfgstore_desc_t* d   = &s_desc[key];
+    const void*            src = value_ptr(values, key);
+
+    switch (d->type) {
+        case CFGSTORE_U8:
+            return nvs_set_u8(s_store.nvs, d->key, (uint8_t) *(const uint32_t*) src);
+        case CFGSTORE_U32:
+            return nvs_set_u32(s_store.nvs, d->key, *(const uint32_t*) src);
+        case CFGSTORE_I32:
+            return nvs_set_i32(s_store.nvs, d->key, *(const int32_t*) src);
+        case CFGSTORE_STR:
+            return nvs_set_str(s_store.nvs, d->key, (const char*) src);
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+static void flush_timer_cb(TimerHandle_t timer) {
+    (void) timer;
+    cfgstore_flush();
+}
+
+/* Stores `len` bytes in the cache; the flush and the listeners only run for a change. */
+static esp_err_t store_set(cfgstore_key_t key, const void* value, size_t len) {
+    if (s_store.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    cfgstore_listener_slot_t notify[CFGSTORE_MAX_LISTENERS];
+    int                      n_notify = 0;
+    void*                    dst      = value_ptr(&s_store.values, key);
+
+    xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    if (memcmp(dst, value, len) == 0) {
+        s_store.stats.unchanged++;
+        xSemaphoreGive(s_store.lock);
+        return ESP_OK;
+    }
+    if (s_desc[key].type == CFGSTORE_STR) {
+        memcpy(dst, value, len);
+    } else {
+        *(volatile uint32_t*) dst = *(const uint32_t*) value;  // one store, see cfgstore_get_u32()
+    }
+    s_store.dirty |= CFG_BIT(key);
+    s_store.stats.writes++;
+    for (int i = 0; i < CFGSTORE_MAX_LISTENERS; i++) {
+        if (s_store.listeners[i].cb && (s_store.listeners[i].mask & CFG_BIT(key))) {
+            notify[n_notify++] = s_store.listeners[i];
+        }
+    }
+    xSemaphoreGive(s_store.lock);
+
+    // debounce: fiecare scriere amana commit-ul
+    if (xTimerReset(s_store.timer, pdMS_TO_TICKS(10)) != pdPASS) {
+        ESP_LOGW(TAG, "flush timer not restarted, '%s' is written by the next flush", s_desc[key].key);
+    }
+
+    for (int i = 0; i < n_notify; i++) {
+        notify[i].cb(key, notify[i].arg);
+    }
+    return ESP_OK;
+}
+
+static bool key_is(cfgstore_key_t key, cfgstore_type_t a, cfgstore_type_t b) {
+    return (unsigned) key < CFG_KEY_COUNT && (s_desc[key].type == a || s_desc[key].type == b);
+}
+
+// --------------------------------------- //
+
+esp_err_t cfgstore_init(void) {
+    if (s_store.lock != NULL) {
+        return ESP_OK;
+    }
+
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_LOGW(TAG, "NVS partition erased (%s)", esp_err_to_name(err));
+        err = nvs_flash_erase();
+        if (err == ESP_OK) {
+            err = nvs_flash_init();
+        }
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "nvs_flash_init: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    err = nvs_open(CFGSTORE_NAMESPACE, NVS_READWRITE, &s_store.nvs);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "nvs_open('%s'): %s", CFGSTORE_NAMESPACE, esp_err_to_name(err));
+        return err;
+    }
+
+    s_store.flush_lock = xSemaphoreCreateMutex();
+    s_store.timer      = xTimerCreate("cfgstore", pdMS_TO_TICKS(CFGSTORE_FLUSH_DELAY_MS), pdFALSE, NULL, flush_timer_cb);
+    SemaphoreHandle_t lock = xSemaphoreCreateMutex();
+    if (s_store.flush_lock == NULL || s_store.timer == NULL || lock == NULL) {
+        if (s_store.flush_lock) {
+            vSemaphoreDelete(s_store.flush_lock);
+        }
+        if (s_store.timer) {
+            xTimerDelete(s_store.timer, 0);
+        }
+        if (lock) {
+            vSemaphoreDelete(lock);
+        }
+        nvs_close(s_store.nvs);
+        return ESP_ERR_NO_MEM;
+    }
+
+    for (int key = 0; key < CFG_KEY_COUNT; key++) {
+        load_key((cfgstore_key_t) key);
+    }
+    s_store.lock = lock;  // from here the setters are enabled
+
+    ESP_LOGI(TAG, "%d keys loaded from namespace '%s'", CFG_KEY_COUNT, CFGSTORE_NAMESPACE);
+    return ESP_OK;
+}
+
+/* 32-bit aligned loads are atomic, the integers are read without the lock. */
+uint32_t cfgstore_get_u32(cfgstore_key_t key) {
+    if (!key_is(key, CFGSTORE_U8, CFGSTORE_U32)) {
+        ESP_LOGE(TAG, "key %d is not an unsigned integer", key);
+        return 0;
+    }
+    return *(volatile const uint32_t*) value_ptr(&s_store.values, key);
+}
+
+int32_t cfgstore_get_i32(cfgstore_key_t key) {
+    if (!key_is(key, CFGSTORE_I32, CFGSTORE_I32)) {
+        ESP_LOGE(TAG, "key %d is not a signed integer", key);
+        return 0;
+    }
+    return *(volatile const int32_t*) value_ptr(&s_store.values, key);
+}
+
+esp_err_t cfgstore_get_str(cfgstore_key_t key, char* out, size_t size) {
+    if (!key_is(key, CFGSTORE_STR, CFGSTORE_STR) || out == NULL || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const char* src = value_ptr(&s_store.values, key);
+    if (s_store.lock) {
+        xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    }
+    size_t len = strlcpy(out, src, size);
+    if (s_store.lock) {
+        xSemaphoreGive(s_store.lock);
+    }
+    return len < size ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+esp_err_t cfgstore_set_u32(cfgstore_key_t key, uint32_t value) {
+    if (!key_is(key, CFGSTORE_U8, CFGSTORE_U32) || (s_desc[key].type == CFGSTORE_U8 && value > UINT8_MAX)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return store_set(key, &value, sizeof(value));
+}
+
+esp_err_t cfgstore_set_i32(cfgstore_key_t key, int32_t value) {
+    if (!key_is(key, CFGSTORE_I32, CFGSTORE_I32)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return store_set(key, &value, sizeof(value));
+}
+
+esp_err_t cfgstore_set_str(cfgstore_key_t key, const char* value) {
+    if (!key_is(key, CFGSTORE_STR, CFGSTORE_STR) || value == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t len = strlen(value) + 1;
+    if (len > s_desc[key].size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return store_set(key, value, len);
+}
+
+esp_err_t cfgstore_reset(cfgstore_key_t key) {
+    if ((unsigned) key >= CFG_KEY_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const void* def = (const uint8_t*) &s_defaults + s_desc[key].offset;
+    if (s_desc[key].type == CFGSTORE_STR) {
+        return store_set(key, def, strlen(def) + 1);
+    }
+    return store_set(key, def, s_desc[key].size);
+}
+
+esp_err_t cfgstore_flush(void) {
+    if (s_store.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_store.flush_lock, portMAX_DELAY);
+
+    xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    const uint32_t    dirty    = s_store.dirty;
+    cfgstore_values_t snapshot = s_store.values;
+    s_store.dirty              = 0;
+    xSemaphoreGive(s_store.lock);
+
+    esp_err_t err     = ESP_OK;
+    uint32_t  failed  = 0;
+    uint32_t  written = 0;
+    for (int key = 0; key < CFG_KEY_COUNT; key++) {
+        if (!(dirty & CFG_BIT(key))) {
+            continue;
+        }
+        esp_err_t key_err = write_key((cfgstore_key_t) key, &snapshot);
+        if (key_err == ESP_OK) {
+            written++;
+        } else {
+            ESP_LOGE(TAG, "'%s' not written: %s", s_desc[key].key, esp_err_to_name(key_err));
+            failed |= CFG_BIT(key);
+            err = key_err;
+        }
+    }
+    if (dirty != 0) {
+        esp_err_t commit_err = nvs_commit(s_store.nvs);
+        if (commit_err != ESP_OK) {
+            ESP_LOGE(TAG, "nvs_commit: %s", esp_err_to_name(commit_err));
+            failed = dirty;
+            err    = commit_err;
+        }
+    }
+
+    xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    s_store.dirty |= failed;  // retried by the next flush
+    s_store.stats.nvs_sets += written;
+    if (dirty != 0) {
+        s_store.stats.flushes++;
+    }
+    if (err != ESP_OK) {
+        s_store.stats.errors++;
+    }
+    xSemaphoreGive(s_store.lock);
+
+    xSemaphoreGive(s_store.flush_lock);
+    return err;
+}
+
+esp_err_t cfgstore_add_listener(uint32_t key_mask, cfgstore_listener_t cb, void* arg) {
+    if (cb == NULL || key_mask == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_store.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t err = ESP_ERR_NO_MEM;
+    xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    for (int i = 0; i < CFGSTORE_MAX_LISTENERS; i++) {
+        if (s_store.listeners[i].cb == NULL) {
+            s_store.listeners[i] = (cfgstore_listener_slot_t) {.mask = key_mask, .cb = cb, .arg = arg};
+            err                  = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(s_store.lock);
+    return err;
+}
+
+esp_err_t cfgstore_remove_listener(cfgstore_listener_t cb, void* arg) {
+    if (s_store.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t err = ESP_ERR_NOT_FOUND;
+    xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    for (int i = 0; i < CFGSTORE_MAX_LISTENERS; i++) {
+        if (s_store.listeners[i].cb == cb && s_store.listeners[i].arg == arg) {
+            s_store.listeners[i].cb = NULL;
+            err                     = ESP_OK;
+        }
+    }
+    xSemaphoreGive(s_store.lock);
+    return err;
+}
+
+const char* cfgstore_key_name(cfgstore_key_t key) {
+    return (unsigned) key < CFG_KEY_COUNT ? s_desc[key].key : NULL;
+}
+
+void cfgstore_get_stats(cfgstore_stats_t* out) {
+    if (out == NULL) {
+        return;
+    }
+    if (s_store.lock == NULL) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    xSemaphoreTake(s_store.lock, portMAX_DELAY);
+    *out = s_store.stats;
+    xSemaphoreGive(s_store.lock);
+}
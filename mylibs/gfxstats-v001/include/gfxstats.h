@@ -0,0 +1,164 @@
+#pragma once
+#ifndef GFXSTATS_H_
+#define GFXSTATS_H_
+
+/**
+ * LVGL render statistics.
+ *
+ * Hooks the refresh cycle of a display through its events (REFR_START/READY from
+ * lv_display_refr_timer(), RENDER_START/READY from refr_invalid_areas(), FLUSH_* around
+ * the flush callback and the flush wait) and keeps per-frame histograms for render,
+ * flush and wait time, frame time, flushed area and FPS. The SW draw unit counters
+ * (lv_draw_sw_get_thread_stats(), LV_DRAW_SW_STATS), the glyph cache hit rate and the
+ * LVGL heap by block size (lv_mem_get_class_stats()) are reported next to them.
+ *
+ * The results are exposed as a cJSON object (sysmon endpoint) and as a text table
+ * (`gfx stats` in one-cli).
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "lvgl.h"
+
+/**********************
+ *   SETTINGS
+ **********************/
+#ifndef GFXSTATS_MAX_DISPLAYS
+#define GFXSTATS_MAX_DISPLAYS (2)
+#endif
+
+#ifndef GFXSTATS_HIST_BUCKETS
+#define GFXSTATS_HIST_BUCKETS (24)  // log2: up to 2^23 us / px
+#endif
+
+#ifndef GFXSTATS_FPS_BUCKET_WIDTH
+#define GFXSTATS_FPS_BUCKET_WIDTH (5)  // FPS histogram is linear: [0,5), [5,10), ...
+#endif
+
+#ifndef GFXSTATS_FPS_WINDOW_US
+#define GFXSTATS_FPS_WINDOW_US (1000000)  // one FPS sample per window
+#endif
+
+#define GFXSTATS_MAX_DRAW_UNITS (4)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef enum {
+    GFXSTATS_HIST_RENDER = 0,  // render time of a frame without flush and wait [us]
+    GFXSTATS_HIST_FLUSH,       // time spent in the flush callback per frame [us]
+    GFXSTATS_HIST_WAIT,        // time spent waiting for the flush to finish per frame [us]
+    GFXSTATS_HIST_FRAME,       // whole refresh cycle that redrew something [us]
+    GFXSTATS_HIST_AREA,        // flushed pixels per frame [px]
+    GFXSTATS_HIST_FPS,         // rendered frames per GFXSTATS_FPS_WINDOW_US
+    GFXSTATS_HIST_COUNT,
+} gfxstats_hist_id_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t bucket_width;  // 0: bucket i holds [2^(i-1), 2^i), bucket 0 holds 0; else linear
+    uint32_t bucket[GFXSTATS_HIST_BUCKETS];
+} gfxstats_hist_t;
+
+typedef struct {
+    uint32_t task_cnt;
+    uint64_t pixel_cnt;
+    uint32_t busy_ms;
+    uint32_t idle_ms;
+    uint32_t starved_cnt;
+} gfxstats_draw_unit_t;
+
+typedef struct {
+    int32_t         hor_res;
+    int32_t         ver_res;
+    uint32_t        frames;       // refresh cycles that rendered something
+    uint32_t        idle_cycles;  // refresh cycles with nothing to redraw
+    uint32_t        flushes;
+    uint32_t        last_fps;
+    gfxstats_hist_t hist[GFXSTATS_HIST_COUNT];
+    int64_t         since_us;     // esp_timer time of the last reset
+} gfxstats_snapshot_t;
+
+/**
+ * Start collecting for `disp`. Call it with the LVGL lock held (lvgl_port_lock()).
+ */
+esp_err_t gfxstats_attach(lv_display_t* disp);
+
+/**
+ * Stop collecting for `disp`. Call it with the LVGL lock held.
+ */
+void gfxstats_detach(lv_display_t* disp);
+
+/**
+ * Number of attached displays, valid indexes for gfxstats_get() are 0 .. n-1.
+ */
+int gfxstats_display_count(void);
+
+/**
+ * Copy the statistics of the attached display `idx`.
+ */
+esp_err_t gfxstats_get(int idx, gfxstats_snapshot_t* out);
+
+/**
+ * Copy the SW draw unit counters. Returns the number of units written to `out`
+ * (0 if LV_DRAW_SW_STATS is disabled).
+ */
+int gfxstats_get_draw_units(gfxstats_draw_unit_t* out, int max);
+
+/**
+ * Copy the glyph cache counters (lookups and hits since the last reset, used and max size).
+ * `max_size` is 0 if the cache is disabled (LV_GLYPH_CACHE_DEF_SIZE).
+ */
+void gfxstats_get_glyph_cache(lv_glyph_cache_stats_t* out);
+
+/**
+ * Copy the LVGL heap counters by block size, `out` has `LV_MEM_CLASS_CNT` elements.
+ * Returns false if LVGL doesn't use its built-in allocator (LV_STDLIB_BUILTIN).
+ */
+bool gfxstats_get_mem_classes(lv_mem_class_stats_t* out);
+
+/**
+ * Copy the usage of LVGL's slabs (widgets, styles, event descriptors, timers, animations).
+ * Returns false if LV_USE_SLAB is disabled.
+ */
+bool gfxstats_get_slabs(lv_slab_stats_t* out);
+
+/**
+ * Clear the histograms of every display, the draw unit, glyph cache and LVGL heap counters.
+ */
+void gfxstats_reset(void);
+
+/**
+ * Upper bound of the bucket holding the `pct` percentile (0..100), 0 for an empty histogram.
+ */
+uint32_t gfxstats_hist_percentile(const gfxstats_hist_t* h, uint8_t pct);
+
+/**
+ * Lower bound of bucket `i`.
+ */
+uint32_t gfxstats_hist_bucket_low(const gfxstats_hist_t* h, int i);
+
+const char* gfxstats_hist_name(gfxstats_hist_id_t id);
+
+/**
+ * Print the summary table (and the bucket counts if `verbose`) to stdout.
+ */
+void gfxstats_print(bool verbose);
+
+/**
+ * Build the JSON served by the sysmon `/gfx` endpoint, NULL on allocation failure.
+ * The return type is `cJSON *`, kept opaque so this header doesn't need cJSON.h.
+ */
+struct cJSON* gfxstats_create_json(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GFXSTATS_H_ */
@@ -0,0 +1,453 @@
+/**
+ * @file gfxstats.c
+ * @brief LVGL render statistics collected from the display refresh events.
+ */
+
+#include "gfxstats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+#if LV_USE_DRAW_SW && LV_DRAW_SW_STATS
+#include "src/draw/sw/lv_draw_sw.h"  // lv_draw_sw_get_thread_stats(), nu e inclus de lvgl.h
+#endif
+
+static const char* TAG = "gfxstats";
+
+// --------------------------------------- //
+
+typedef struct {
+    lv_display_t*       disp;
+    gfxstats_snapshot_t stats;
+
+    // cadrul curent, scris doar din task-ul LVGL
+    int64_t  t_refr;
+    int64_t  t_render;
+    int64_t  t_flush;
+    int64_t  t_wait;
+    uint32_t render_us;
+    uint32_t flush_us;
+    uint32_t wait_us;
+    uint32_t area_px;
+    uint32_t flushes;
+    bool     rendered;
+
+    int64_t  fps_window_start;
+    uint32_t fps_window_frames;
+} gfxstats_disp_t;
+
+static gfxstats_disp_t s_disp[GFXSTATS_MAX_DISPLAYS];
+static portMUX_TYPE    s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const s_hist_names[GFXSTATS_HIST_COUNT] = {
+    [GFXSTATS_HIST_RENDER] = "render_us",
+    [GFXSTATS_HIST_FLUSH]  = "flush_us",
+    [GFXSTATS_HIST_WAIT]   = "wait_us",
+    [GFXSTATS_HIST_FRAME]  = "frame_us",
+    [GFXSTATS_HIST_AREA]   = "area_px",
+    [GFXSTATS_HIST_FPS]    = "fps",
+};
+
+// --------------------------------------- //
+
+static void hist_clear(gfxstats_hist_t* h, uint16_t bucket_width) {
+    memset(h, 0, sizeof(*h));
+    h->min          = UINT32_MAX;
+    h->bucket_width = bucket_width;
+}
+
+static void hist_add(gfxstats_hist_t* h, uint32_t v) {
+    int i;
+    if (h->bucket_width) {
+        i = (int) (v / h->bucket_width);
+    } else {
+        i = v ? 32 - __builtin_clz(v) : 0;
+    }
+    if (i >= GFXSTATS_HIST_BUCKETS) {
+        i = GFXSTATS_HIST_BUCKETS - 1;
+    }
+    h->bucket[i]++;
+    h->count++;
+    h->sum += v;
+    if (v < h->min) {
+        h->min = v;
+    }
+    if (v > h->max) {
+        h->max = v;
+    }
+}
+
+static void stats_clear(gfxstats_snapshot_t* s, int64_t now) {
+    s->frames      = 0;
+    s->idle_cycles = 0;
+    s->flushes     = 0;
+    s->last_fps    = 0;
+    s->since_us    = now;
+    for (int i = 0; i < GFXSTATS_HIST_COUNT; i++) {
+        hist_clear(&s->hist[i], i == GFXSTATS_HIST_FPS ? GFXSTATS_FPS_BUCKET_WIDTH : 0);
+    }
+}
+
+static uint32_t elapsed_us(int64_t since, int64_t now) {
+    return now > since ? (uint32_t) (now - since) : 0;
+}
+
+/* Called at the end of every refresh cycle, in the LVGL task */
+static void frame_done(gfxstats_disp_t* d, int64_t now) {
+    taskENTER_CRITICAL(&s_lock);
+    gfxstats_snapshot_t* s = &d->stats;
+    if (d->rendered) {
+        // RENDER_START..READY include the flush calls and the waits, keep only the drawing
+        uint32_t io     = d->flush_us + d->wait_us;
+        uint32_t render = d->render_us > io ? d->render_us - io : 0;
+        hist_add(&s->hist[GFXSTATS_HIST_RENDER], render);
+        hist_add(&s->hist[GFXSTATS_HIST_FLUSH], d->flush_us);
+        hist_add(&s->hist[GFXSTATS_HIST_WAIT], d->wait_us);
+        hist_add(&s->hist[GFXSTATS_HIST_FRAME], elapsed_us(d->t_refr, now));
+        hist_add(&s->hist[GFXSTATS_HIST_AREA], d->area_px);
+        s->frames++;
+        s->flushes += d->flushes;
+        d->fps_window_frames++;
+    } else {
+        s->idle_cycles++;
+    }
+
+    uint32_t window = elapsed_us(d->fps_window_start, now);
+    if (window >= GFXSTATS_FPS_WINDOW_US) {
+        // in render-to-idle mode the timer may sleep for a while, the window still gives frames/s
+        s->last_fps = (uint32_t) (((uint64_t) d->fps_window_frames * 1000000 + window / 2) / window);
+        hist_add(&s->hist[GFXSTATS_HIST_FPS], s->last_fps);
+        d->fps_window_start  = now;
+        d->fps_window_frames = 0;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+static void disp_event_cb(lv_event_t* e) {
+    gfxstats_disp_t* d   = lv_event_get_user_data(e);
+    int64_t          now = esp_timer_get_time();
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            d->t_refr    = now;
+            d->render_us = 0;
+            d->flush_us  = 0;
+            d->wait_us   = 0;
+            d->area_px   = 0;
+            d->flushes   = 0;
+            d->rendered  = false;
+            break;
+        case LV_EVENT_RENDER_START:
+            d->t_render = now;
+            d->rendered = true;
+            break;
+        case LV_EVENT_RENDER_READY:
+            d->render_us += elapsed_us(d->t_render, now);
+            break;
+        case LV_EVENT_FLUSH_START: {
+            const lv_area_t* area = lv_event_get_param(e);
+            if (area) {
+                d->area_px += (uint32_t) lv_area_get_size(area);
+            }
+            d->flushes++;
+            d->t_flush = now;
+            break;
+        }
+        case LV_EVENT_FLUSH_FINISH:
+            d->flush_us += elapsed_us(d->t_flush, now);
+            break;
+        case LV_EVENT_FLUSH_WAIT_START:
+            d->t_wait = now;
+            break;
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            d->wait_us += elapsed_us(d->t_wait, now);
+            break;
+        case LV_EVENT_REFR_READY:
+            frame_done(d, now);
+            break;
+        default:
+            break;
+    }
+}
+
+// --------------------------------------- //
+
+esp_err_t gfxstats_attach(lv_display_t* disp) {
+    if (disp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    gfxstats_disp_t* free_slot = NULL;
+    for (int i = 0; i < GFXSTATS_MAX_DISPLAYS; i++) {
+        if (s_disp[i].disp == disp) {
+            return ESP_OK;
+        }
+        if (s_disp[i].disp == NULL && free_slot == NULL) {
+            free_slot = &s_disp[i];
+        }
+    }
+    if (free_slot == NULL) {
+        ESP_LOGE(TAG, "no free slot, raise GFXSTATS_MAX_DISPLAYS");
+        return ESP_ERR_NO_MEM;
+    }
+
+    int64_t now = esp_timer_get_time();
+    taskENTER_CRITICAL(&s_lock);
+    memset(free_slot, 0, sizeof(*free_slot));
+    stats_clear(&free_slot->stats, now);
+    free_slot->stats.hor_res    = lv_display_get_horizontal_resolution(disp);
+    free_slot->stats.ver_res    = lv_display_get_vertical_resolution(disp);
+    free_slot->fps_window_start = now;
+    free_slot->disp             = disp;
+    taskEXIT_CRITICAL(&s_lock);
+
+    lv_display_add_event_cb(disp, disp_event_cb, LV_EVENT_ALL, free_slot);
+    ESP_LOGI(TAG, "attached to display %dx%d", (int) free_slot->stats.hor_res, (int) free_slot->stats.ver_res);
+    return ESP_OK;
+}
+
+void gfxstats_detach(lv_display_t* disp) {
+    for (int i = 0; i < GFXSTATS_MAX_DISPLAYS; i++) {
+        if (disp != NULL && s_disp[i].disp == disp) {
+            lv_display_remove_event_cb_with_user_data(disp, disp_event_cb, &s_disp[i]);
+            taskENTER_CRITICAL(&s_lock);
+            s_disp[i].disp = NULL;
+            taskEXIT_CRITICAL(&s_lock);
+        }
+    }
+}
+
+int gfxstats_display_count(void) {
+    int n = 0;
+    for (int i = 0; i < GFXSTATS_MAX_DISPLAYS; i++) {
+        if (s_disp[i].disp) {
+            n++;
+        }
+    }
+    return n;
+}
+
+/* idx counts only the attached slots */
+static gfxstats_disp_t* disp_at(int idx) {
+    for (int i = 0; i < GFXSTATS_MAX_DISPLAYS; i++) {
+        if (s_disp[i].disp && idx-- == 0) {
+            return &s_disp[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t gfxstats_get(int idx, gfxstats_snapshot_t* out) {
+    if (out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    taskENTER_CRITICAL(&s_lock);
+    gfxstats_disp_t* d = disp_at(idx);
+    if (d) {
+        *out = d->stats;
+        ret  = ESP_OK;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    return ret;
+}
+
+int gfxstats_get_draw_units(gfxstats_draw_unit_t* out, int max) {
+#if LV_USE_DRAW_SW && LV_DRAW_SW_STATS
+    int n = 0;
+    // Each thread's counters are copied under its own stats mutex; the LVGL lock
+    // keeps the reset tick and the draw unit list stable across the loop.
+    lv_lock();
+    for (uint32_t i = 0; (int) i < max && i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+        lv_draw_sw_thread_stats_t ts;
+        if (lv_draw_sw_get_thread_stats(i, &ts) != LV_RESULT_OK) {
+            break;
+        }
+        out[n].task_cnt    = ts.task_cnt;
+        out[n].pixel_cnt   = ts.pixel_cnt;
+        out[n].busy_ms     = ts.busy_time;
+        out[n].idle_ms     = ts.idle_time;
+        out[n].starved_cnt = ts.starved_cnt;
+        n++;
+    }
+    lv_unlock();
+    return n;
+#else
+    (void) out;
+    (void) max;
+    return 0;
+#endif
+}
+
+void gfxstats_get_glyph_cache(lv_glyph_cache_stats_t* out) {
+    lv_lock();  // the counters are updated while drawing
+    lv_glyph_cache_get_stats(out, false);
+    lv_unlock();
+}
+
+bool gfxstats_get_mem_classes(lv_mem_class_stats_t* out) {
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_lock();
+    lv_mem_get_class_stats(out, false);
+    lv_unlock();
+    return true;
+#else
+    (void) out;
+    return false;
+#endif
+}
+
+bool gfxstats_get_slabs(lv_slab_stats_t* out) {
+#if LV_USE_SLAB
+    lv_lock();
+    lv_slab_get_stats_all(out);
+    lv_unlock();
+    return true;
+#else
+    (void) out;
+    return false;
+#endif
+}
+
+void gfxstats_reset(void) {
+    int64_t now = esp_timer_get_time();
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < GFXSTATS_MAX_DISPLAYS; i++) {
+        if (s_disp[i].disp) {
+            stats_clear(&s_disp[i].stats, now);
+            s_disp[i].fps_window_start  = now;
+            s_disp[i].fps_window_frames = 0;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+#if LV_USE_DRAW_SW && LV_DRAW_SW_STATS
+    lv_lock();
+    lv_draw_sw_reset_thread_stats();
+    lv_unlock();
+#endif
+    lv_glyph_cache_stats_t glyphs;
+    lv_lock();
+    lv_glyph_cache_get_stats(&glyphs, true);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_class_stats_t classes[LV_MEM_CLASS_CNT];
+    lv_mem_get_class_stats(classes, true);
+#endif
+    lv_unlock();
+}
+
+// --------------------------------------- //
+
+uint32_t gfxstats_hist_bucket_low(const gfxstats_hist_t* h, int i) {
+    if (h->bucket_width) {
+        return (uint32_t) i * h->bucket_width;
+    }
+    return i ? 1u << (i - 1) : 0;
+}
+
+uint32_t gfxstats_hist_percentile(const gfxstats_hist_t* h, uint8_t pct) {
+    if (h->count == 0) {
+        return 0;
+    }
+    uint32_t rank = (uint32_t) (((uint64_t) h->count * pct + 99) / 100);
+    uint32_t seen = 0;
+    for (int i = 0; i < GFXSTATS_HIST_BUCKETS; i++) {
+        seen += h->bucket[i];
+        if (seen >= rank && h->bucket[i]) {
+            // upper bound of the bucket, but never above the real maximum
+            uint32_t high = (i + 1 < GFXSTATS_HIST_BUCKETS) ? gfxstats_hist_bucket_low(h, i + 1) - 1 : h->max;
+            return high < h->max ? high : h->max;
+        }
+    }
+    return h->max;
+}
+
+const char* gfxstats_hist_name(gfxstats_hist_id_t id) {
+    return (id < GFXSTATS_HIST_COUNT) ? s_hist_names[id] : "?";
+}
+
+void gfxstats_print(bool verbose) {
+    int n = gfxstats_display_count();
+    if (n == 0) {
+        printf("No display attached (gfxstats_attach() not called)\n");
+    }
+
+    static gfxstats_snapshot_t s;  // prea mare pentru stiva consolei
+    for (int d = 0; d < n; d++) {
+        if (gfxstats_get(d, &s) != ESP_OK) {
+            continue;
+        }
+        uint32_t secs = (uint32_t) ((esp_timer_get_time() - s.since_us) / 1000000);
+        printf("Display %d: %dx%d, %lu frames, %lu idle cycles, %lu flushes in %lu s, fps %lu\n", d, (int) s.hor_res,
+               (int) s.ver_res, (unsigned long) s.frames, (unsigned long) s.idle_cycles, (unsigned long) s.flushes,
+               (unsigned long) secs, (unsigned long) s.last_fps);
+        printf("%-10s %8s %8s %8s %8s %8s %8s %8s\n", "", "count", "min", "avg", "p50", "p95", "p99", "max");
+        for (int i = 0; i < GFXSTATS_HIST_COUNT; i++) {
+            const gfxstats_hist_t* h = &s.hist[i];
+            printf("%-10s %8lu %8lu %8lu %8lu %8lu %8lu %8lu\n", gfxstats_hist_name(i), (unsigned long) h->count,
+                   (unsigned long) (h->count ? h->min : 0), (unsigned long) (h->count ? h->sum / h->count : 0),
+                   (unsigned long) gfxstats_hist_percentile(h, 50), (unsigned long) gfxstats_hist_percentile(h, 95),
+                   (unsigned long) gfxstats_hist_percentile(h, 99), (unsigned long) h->max);
+        }
+        if (verbose) {
+            for (int i = 0; i < GFXSTATS_HIST_COUNT; i++) {
+                const gfxstats_hist_t* h = &s.hist[i];
+                printf("%s:\n", gfxstats_hist_name(i));
+                for (int b = 0; b < GFXSTATS_HIST_BUCKETS; b++) {
+                    if (h->bucket[b]) {
+                        printf("  >= %-8lu %lu\n", (unsigned long) gfxstats_hist_bucket_low(h, b),
+                               (unsigned long) h->bucket[b]);
+                    }
+                }
+            }
+        }
+    }
+
+    gfxstats_draw_unit_t units[GFXSTATS_MAX_DRAW_UNITS];
+    int                  n_units = gfxstats_get_draw_units(units, GFXSTATS_MAX_DRAW_UNITS);
+    if (n_units) {
+        printf("%-6s %10s %12s %6s %8s\n", "unit", "tasks", "pixels", "busy%", "starved");
+        for (int i = 0; i < n_units; i++) {
+            uint32_t total = units[i].busy_ms + units[i].idle_ms;
+            printf("%-6d %10lu %12llu %6lu %8lu\n", i, (unsigned long) units[i].task_cnt,
+                   (unsigned long long) units[i].pixel_cnt,
+                   (unsigned long) (total ? (uint64_t) units[i].busy_ms * 100 / total : 0),
+                   (unsigned long) units[i].starved_cnt);
+        }
+    }
+
+    lv_glyph_cache_stats_t glyphs;
+    gfxstats_get_glyph_cache(&glyphs);
+    if (glyphs.max_size) {
+        printf("glyph cache: %lu lookups, %lu%% hits, %lu / %lu bytes\n", (unsigned long) glyphs.lookup_cnt,
+               (unsigned long) (glyphs.lookup_cnt ? (uint64_t) glyphs.hit_cnt * 100 / glyphs.lookup_cnt : 0),
+               (unsigned long) glyphs.size, (unsigned long) glyphs.max_size);
+    }
+
+    lv_mem_class_stats_t classes[LV_MEM_CLASS_CNT];
+    if (verbose && gfxstats_get_mem_classes(classes)) {
+        printf("%-8s %10s %8s %8s %8s %8s %10s\n", "lv heap", "allocs", "reallocs", "fails", "blocks", "max",
+               "bytes");
+        for (int i = 0; i < LV_MEM_CLASS_CNT; i++) {
+            char name[12];
+            if (i + 1 < LV_MEM_CLASS_CNT) {
+                snprintf(name, sizeof(name), "<=%d", 32 << i);
+            } else {
+                snprintf(name, sizeof(name), ">%d", 32 << (i - 1));
+            }
+            printf("%-8s %10lu %8lu %8lu %8lu %8lu %10lu\n", name, (unsigned long) classes[i].alloc_cnt,
+                   (unsigned long) classes[i].realloc_cnt, (unsigned long) classes[i].fail_cnt,
+                   (unsigned long) classes[i].cur_cnt, (unsigned long) classes[i].max_cnt,
+                   (unsigned long) classes[i].cur_size);
+        }
+    }
+
+    lv_slab_stats_t slabs;
+    if (verbose && gfxstats_get_slabs(&slabs)) {
+        printf("lv slabs: %lu used, %lu free blocks in %lu chunks, %lu bytes\n", (unsigned long) slabs.used_cnt,
+               (unsigned long) slabs.free_cnt, (unsigned long) slabs.chunk_cnt, (unsigned long) slabs.size);
+    }
+}
@@ -0,0 +1,150 @@
+/**
+ * @file gfxstats_json.c
+ * @brief JSON view of the render statistics, served by the sysmon `/gfx` endpoint.
+ */
+
+#include "gfxstats.h"
+
+#include <stdlib.h>
+
+#include "cJSON.h"
+#include "esp_timer.h"
+
+static const char* const s_json_names[GFXSTATS_HIST_COUNT] = {
+    [GFXSTATS_HIST_RENDER] = "renderUs",
+    [GFXSTATS_HIST_FLUSH]  = "flushUs",
+    [GFXSTATS_HIST_WAIT]   = "waitUs",
+    [GFXSTATS_HIST_FRAME]  = "frameUs",
+    [GFXSTATS_HIST_AREA]   = "areaPx",
+    [GFXSTATS_HIST_FPS]    = "fps",
+};
+
+// --------------------------------------- //
+
+static cJSON* hist_json(const gfxstats_hist_t* h) {
+    cJSON* obj = cJSON_CreateObject();
+    if (obj == NULL) {
+        return NULL;
+    }
+    cJSON_AddNumberToObject(obj, "count", h->count);
+    cJSON_AddNumberToObject(obj, "min", h->count ? h->min : 0);
+    cJSON_AddNumberToObject(obj, "avg", h->count ? (double) h->sum / h->count : 0);
+    cJSON_AddNumberToObject(obj, "max", h->max);
+    cJSON_AddNumberToObject(obj, "p50", gfxstats_hist_percentile(h, 50));
+    cJSON_AddNumberToObject(obj, "p95", gfxstats_hist_percentile(h, 95));
+    cJSON_AddNumberToObject(obj, "p99", gfxstats_hist_percentile(h, 99));
+    cJSON_AddNumberToObject(obj, "bucketWidth", h->bucket_width);  // 0 = log2 buckets
+
+    // doar pana la ultimul bucket nenul, restul ar fi zerouri
+    int last = GFXSTATS_HIST_BUCKETS - 1;
+    while (last >= 0 && h->bucket[last] == 0) {
+        last--;
+    }
+    cJSON* buckets = cJSON_AddArrayToObject(obj, "buckets");
+    for (int i = 0; buckets && i <= last; i++) {
+        cJSON_AddItemToArray(buckets, cJSON_CreateNumber(h->bucket[i]));
+    }
+    return obj;
+}
+
+static cJSON* display_json(int idx, const gfxstats_snapshot_t* s) {
+    cJSON* obj = cJSON_CreateObject();
+    if (obj == NULL) {
+        return NULL;
+    }
+    cJSON_AddNumberToObject(obj, "index", idx);
+    cJSON_AddNumberToObject(obj, "width", s->hor_res);
+    cJSON_AddNumberToObject(obj, "height", s->ver_res);
+    cJSON_AddNumberToObject(obj, "frames", s->frames);
+    cJSON_AddNumberToObject(obj, "idleCycles", s->idle_cycles);
+    cJSON_AddNumberToObject(obj, "flushes", s->flushes);
+    cJSON_AddNumberToObject(obj, "fps", s->last_fps);
+    cJSON_AddNumberToObject(obj, "sinceMs", (double) ((esp_timer_get_time() - s->since_us) / 1000));
+
+    cJSON* hist = cJSON_AddObjectToObject(obj, "hist");
+    for (int i = 0; hist && i < GFXSTATS_HIST_COUNT; i++) {
+        cJSON_AddItemToObject(hist, s_json_names[i], hist_json(&s->hist[i]));
+    }
+    return obj;
+}
+
+// --------------------------------------- //
+
+cJSON* gfxstats_create_json(void) {
+    cJSON* root = cJSON_CreateObject();
+    if (root == NULL) {
+        return NULL;
+    }
+
+    gfxstats_snapshot_t* s = malloc(sizeof(*s));  // ~0.7 KB, ruleaza pe task-ul httpd
+    cJSON*               displays = cJSON_AddArrayToObject(root, "displays");
+    if (s == NULL || displays == NULL) {
+        free(s);
+        cJSON_Delete(root);
+        return NULL;
+    }
+    int n = gfxstats_display_count();
+    for (int i = 0; i < n; i++) {
+        if (gfxstats_get(i, s) == ESP_OK) {
+            cJSON_AddItemToArray(displays, display_json(i, s));
+        }
+    }
+    free(s);
+
+    gfxstats_draw_unit_t units[GFXSTATS_MAX_DRAW_UNITS];
+    int                  n_units = gfxstats_get_draw_units(units, GFXSTATS_MAX_DRAW_UNITS);
+    cJSON*               draw    = cJSON_AddArrayToObject(root, "drawUnits");
+    for (int i = 0; draw && i < n_units; i++) {
+        cJSON* u = cJSON_CreateObject();
+        if (u == NULL) {
+            break;
+        }
+        cJSON_AddNumberToObject(u, "tasks", units[i].task_cnt);
+        cJSON_AddNumberToObject(u, "pixels", (double) units[i].pixel_cnt);
+        cJSON_AddNumberToObject(u, "busyMs", units[i].busy_ms);
+        cJSON_AddNumberToObject(u, "idleMs", units[i].idle_ms);
+        cJSON_AddNumberToObject(u, "starved", units[i].starved_cnt);
+        cJSON_AddItemToArray(draw, u);
+    }
+
+    lv_glyph_cache_stats_t glyphs;
+    gfxstats_get_glyph_cache(&glyphs);
+    cJSON* glyph_cache = cJSON_AddObjectToObject(root, "glyphCache");
+    if (glyph_cache) {
+        cJSON_AddNumberToObject(glyph_cache, "lookups", glyphs.lookup_cnt);
+        cJSON_AddNumberToObject(glyph_cache, "hits", glyphs.hit_cnt);
+        cJSON_AddNumberToObject(glyph_cache, "size", glyphs.size);
+        cJSON_AddNumberToObject(glyph_cache, "maxSize", glyphs.max_size);  // 0 = disabled
+    }
+
+    lv_mem_class_stats_t classes[LV_MEM_CLASS_CNT];
+    if (gfxstats_get_mem_classes(classes)) {
+        // [i] counts the blocks up to 32 << i bytes, the last one the larger blocks
+        cJSON* heap = cJSON_AddArrayToObject(root, "lvHeapClasses");
+        for (int i = 0; heap && i < LV_MEM_CLASS_CNT; i++) {
+            cJSON* c = cJSON_CreateObject();
+            if (c == NULL) {
+                break;
+            }
+            cJSON_AddNumberToObject(c, "allocs", classes[i].alloc_cnt);
+            cJSON_AddNumberToObject(c, "reallocs", classes[i].realloc_cnt);
+            cJSON_AddNumberToObject(c, "fails", classes[i].fail_cnt);
+            cJSON_AddNumberToObject(c, "blocks", classes[i].cur_cnt);
+            cJSON_AddNumberToObject(c, "maxBlocks", classes[i].max_cnt);
+            cJSON_AddNumberToObject(c, "bytes", classes[i].cur_size);
+            cJSON_AddItemToArray(heap, c);
+        }
+    }
+
+    lv_slab_stats_t slabs;
+    if (gfxstats_get_slabs(&slabs)) {
+        cJSON* slab = cJSON_AddObjectToObject(root, "lvSlabs");
+        if (slab) {
+            cJSON_AddNumberToObject(slab, "used", slabs.used_cnt);
+            cJSON_AddNumberToObject(slab, "free", slabs.free_cnt);
+            cJSON_AddNumberToObject(slab, "chunks", slabs.chunk_cnt);
+            cJSON_AddNumberToObject(slab, "bytes", slabs.size);
+        }
+    }
+    return root;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file bench_main.c
+ * @brief Cost of a log call on the Linux target: ESP_LOGx against LOGCTL_LOGx.
+ *
+ * The output function is replaced by one that prints nothing, so only the call
+ * is measured: level check, tag lookup, esp_log_write() for the enabled ones.
+ * - disabled: a DEBUG call on a tag at INFO;
+ * - enabled:  an INFO call on a tag at INFO;
+ * - limited:  an INFO call on a tag limited to 1 message per second (cut);
+ * - stripped: a VERBOSE call above LOGCTL_MAX_LEVEL (compiled out).
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "logctl.h"
+
+#define BENCH_CALLS (200000)
+#define BENCH_TAGS  (24)  // other tags with a level of their own, as in the application
+
+static const char* TAG = "wifimgr";  // the same tag for both, LOGCTL_TAG_WIFIMGR
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void print_row(const char* what, int64_t ns) {
+    printf("%-28s %10" PRId64 " us %10.1f ns/call\n", what, ns / 1000, (double) ns / BENCH_CALLS);
+}
+
+static uint32_t s_printed;
+
+static int null_vprintf(const char* fmt, va_list args) {
+    s_printed++;
+    return 0;
+}
+
+static void bench_stripped(void) {
+#undef LOGCTL_MAX_LEVEL
+#define LOGCTL_MAX_LEVEL ESP_LOG_INFO
+    int64_t t0 = now_ns();
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        LOGCTL_LOGV(WIFIMGR, "call %d", i);
+    }
+    print_row("stripped LOGCTL_LOGV", now_ns() - t0);
+#undef LOGCTL_MAX_LEVEL
+#define LOGCTL_MAX_LEVEL CONFIG_LOG_MAXIMUM_LEVEL
+}
+
+void app_main(void) {
+    char name[16];
+    for (int i = 0; i < BENCH_TAGS; i++) {
+        snprintf(name, sizeof(name), "tag%02d", i);
+        esp_log_level_set(name, ESP_LOG_WARN);
+    }
+    logctl_set_level(LOGCTL_TAG_WIFIMGR, ESP_LOG_INFO);
+    vprintf_like_t prev = esp_log_set_vprintf(null_vprintf);
+
+    int64_t t0 = now_ns();
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        ESP_LOGD(TAG, "call %d", i);
+    }
+    const int64_t esp_off = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        LOGCTL_LOGD(WIFIMGR, "call %d", i);
+    }
+    const int64_t ctl_off = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        ESP_LOGI(TAG, "call %d", i);
+    }
+    const int64_t esp_on = now_ns() - t0;
+
+    t0 = now_ns();
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        LOGCTL_LOGI(WIFIMGR, "call %d", i);
+    }
+    const int64_t ctl_on = now_ns() - t0;
+
+    logctl_set_rate(LOGCTL_TAG_WIFIMGR, 1, 1);
+    const uint32_t printed = s_printed;
+    t0                     = now_ns();
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        LOGCTL_LOGI(WIFIMGR, "call %d", i);
+    }
+    const int64_t ctl_cut = now_ns() - t0;
+    logctl_set_rate(LOGCTL_TAG_WIFIMGR, 0, 0);
+
+    esp_log_set_vprintf(prev);
+    printf("%d calls, output discarded\n", BENCH_CALLS);
+    print_row("disabled ESP_LOGD", esp_off);
+    print_row("disabled LOGCTL_LOGD", ctl_off);
+    print_row("enabled  ESP_LOGI", esp_on);
+    print_row("enabled  LOGCTL_LOGI", ctl_on);
+    print_row("limited  LOGCTL_LOGI", ctl_cut);
+    bench_stripped();
+
+    logctl_info_t info;
+    logctl_get_info(LOGCTL_TAG_WIFIMGR, &info);
+    printf("limited: %" PRIu32 " printed, %" PRIu32 " suppressed\n", s_printed - printed, info.suppressed);
+    fflush(stdout);
+    exit(0);
+}
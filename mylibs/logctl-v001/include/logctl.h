@@ -0,0 +1,102 @@
+#pragma once
+#ifndef LOGCTL_H_
+#define LOGCTL_H_
+
+/**
+ * Log level control per tag, with the tags interned at compile time (logctl_tags.h).
+ *
+ *   LOGCTL_LOGW(SYSMON, "Task capacity exceeded: '%s'", name);
+ *
+ * - a level above LOGCTL_MAX_LEVEL compiles to nothing;
+ * - otherwise the level of the tag is one byte read from an array indexed by the
+ *   enum: a disabled call costs a load and a compare, no string and no esp_log
+ *   tag cache lookup;
+ * - a tag with a rate goes through a token bucket; what's cut is counted and
+ *   reported ("N messages suppressed") ahead of the next message that passes.
+ *
+ * An enabled message is printed with ESP_LOG_LEVEL(), so it looks like any other
+ * and goes to the same output (binlog included). logctl_set_level() sets the
+ * esp_log level of the tag too, so plain ESP_LOGx calls of the same tag agree.
+ * Not for ISRs (the limiter takes a spinlock with portENTER_CRITICAL).
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+#include "logctl_tags.h"
+#include "sdkconfig.h"
+
+/**********************
+ *   SETTINGS
+ **********************/
+#ifndef LOGCTL_MAX_LEVEL
+#define LOGCTL_MAX_LEVEL CONFIG_LOG_MAXIMUM_LEVEL  // define lower before the include to strip a file's debug logs
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define LOGCTL_TAG_ENUM(id, name, rate, burst) LOGCTL_TAG_##id,
+typedef enum {
+    LOGCTL_TAGS(LOGCTL_TAG_ENUM)
+    LOGCTL_TAG_COUNT
+} logctl_tag_t;
+#undef LOGCTL_TAG_ENUM
+
+/* Read on every call; written only by logctl_set_*. */
+typedef struct {
+    uint8_t level;    // esp_log_level_t
+    bool    limited;  // a rate is set
+} logctl_gate_t;
+
+typedef struct {
+    esp_log_level_t level;
+    uint16_t        rate;  // messages per second, 0: no limit
+    uint16_t        burst;
+    uint32_t        passed;      // through the limiter
+    uint32_t        suppressed;  // cut by the limiter, total
+    uint32_t        pending;     // cut since the last report
+} logctl_info_t;
+
+extern logctl_gate_t     logctl_gates[LOGCTL_TAG_COUNT];
+extern const char* const logctl_tag_names[LOGCTL_TAG_COUNT];
+
+/* Token bucket of a limited tag; reports the suppressed count at `level` first. */
+bool logctl_take(logctl_tag_t tag, esp_log_level_t level);
+
+static inline bool logctl_enabled(logctl_tag_t tag, esp_log_level_t level) {
+    const logctl_gate_t gate = logctl_gates[tag];
+    return level <= gate.level && (!gate.limited || logctl_take(tag, level));
+}
+
+#define LOGCTL_LOG(level, id, format, ...)                                                    \
+    do {                                                                                      \
+        if ((level) <= LOGCTL_MAX_LEVEL && logctl_enabled(LOGCTL_TAG_##id, (level))) {        \
+            ESP_LOG_LEVEL((level), logctl_tag_names[LOGCTL_TAG_##id], format, ##__VA_ARGS__); \
+        }                                                                                     \
+    } while (0)
+
+#define LOGCTL_LOGE(id, format, ...) LOGCTL_LOG(ESP_LOG_ERROR, id, format, ##__VA_ARGS__)
+#define LOGCTL_LOGW(id, format, ...) LOGCTL_LOG(ESP_LOG_WARN, id, format, ##__VA_ARGS__)
+#define LOGCTL_LOGI(id, format, ...) LOGCTL_LOG(ESP_LOG_INFO, id, format, ##__VA_ARGS__)
+#define LOGCTL_LOGD(id, format, ...) LOGCTL_LOG(ESP_LOG_DEBUG, id, format, ##__VA_ARGS__)
+#define LOGCTL_LOGV(id, format, ...) LOGCTL_LOG(ESP_LOG_VERBOSE, id, format, ##__VA_ARGS__)
+
+/* Tag by name, -1 if it isn't in logctl_tags.h. */
+int logctl_find(const char* name);
+
+esp_err_t logctl_set_level(logctl_tag_t tag, esp_log_level_t level);
+/* esp_log_level_set("*") and every interned tag, with the rates of logctl_tags.h. */
+void      logctl_set_all(esp_log_level_t level);
+/* rate 0 removes the limit; burst 0 takes `rate`. */
+esp_err_t logctl_set_rate(logctl_tag_t tag, uint16_t rate, uint16_t burst);
+void      logctl_get_info(logctl_tag_t tag, logctl_info_t* out);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* LOGCTL_H_ */
@@ -0,0 +1,22 @@
+#pragma once
+#ifndef LOGCTL_TAGS_H_
+#define LOGCTL_TAGS_H_
+
+/**
+ * Log tags known at compile time.
+ *
+ * X(id, name, rate, burst)
+ *   id    - LOGCTL_TAG_<id> in logctl_tag_t, used as LOGCTL_LOGx(<id>, ...)
+ *   name  - the tag printed and used by "set log <name> ..."
+ *   rate  - messages per second let through, 0 for no limit
+ *   burst - messages let through at once after a quiet period
+ *
+ * Every tag starts at CONFIG_LOG_DEFAULT_LEVEL, like esp_log. Adding a tag only
+ * takes a line here; the ESP_LOGx calls of a module keep working, only its
+ * LOGCTL_LOGx calls get the O(1) check and the limiter.
+ */
+#define LOGCTL_TAGS(X)             \
+    X(SYSMON, "sysmon", 2, 10)     \
+    X(WIFIMGR, "wifimgr", 0, 0)
+
+#endif /* LOGCTL_TAGS_H_ */
@@ -0,0 +1,136 @@
+/**
+ * @file logctl.c
+ * @brief Per-tag levels and token bucket rate limiting for LOGCTL_LOGx.
+ */
+
+#include "logctl.h"
+
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define LOGCTL_TOKEN (1000)  // the bucket counts thousandths of a message
+
+typedef struct {
+    uint16_t rate;
+    uint16_t burst;
+    uint32_t tokens;
+    uint32_t last_tick;
+    uint32_t passed;
+    uint32_t suppressed;
+    uint32_t pending;
+} logctl_bucket_t;
+
+#define LOGCTL_TAG_NAME(id, name, rate, burst) name,
+const char* const logctl_tag_names[LOGCTL_TAG_COUNT] = {LOGCTL_TAGS(LOGCTL_TAG_NAME)};
+#undef LOGCTL_TAG_NAME
+
+#define LOGCTL_TAG_GATE(id, name, rate, burst) {CONFIG_LOG_DEFAULT_LEVEL, (rate) > 0},
+logctl_gate_t logctl_gates[LOGCTL_TAG_COUNT] = {LOGCTL_TAGS(LOGCTL_TAG_GATE)};
+#undef LOGCTL_TAG_GATE
+
+// full at the start
+#define LOGCTL_TAG_BUCKET(id, name, per_s, max) \
+    {.rate = (per_s), .burst = (max) > 0 ? (max) : (per_s), .tokens = ((max) > 0 ? (max) : (per_s)) * LOGCTL_TOKEN},
+static logctl_bucket_t       s_buckets[LOGCTL_TAG_COUNT] = {LOGCTL_TAGS(LOGCTL_TAG_BUCKET)};
+static const logctl_bucket_t s_defaults[LOGCTL_TAG_COUNT] = {LOGCTL_TAGS(LOGCTL_TAG_BUCKET)};
+#undef LOGCTL_TAG_BUCKET
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// --------------------------------------- //
+
+bool logctl_take(logctl_tag_t tag, esp_log_level_t level) {
+    logctl_bucket_t* b      = &s_buckets[tag];
+    const TickType_t now    = xTaskGetTickCount();
+    uint32_t         report = 0;
+    bool             pass   = true;
+
+    portENTER_CRITICAL(&s_lock);
+    if (b->rate > 0) {
+        const uint32_t elapsed = (uint32_t) (now - b->last_tick);
+        const uint64_t cap     = (uint64_t) b->burst * LOGCTL_TOKEN;
+        uint64_t       tokens  = b->tokens + (uint64_t) elapsed * b->rate * LOGCTL_TOKEN / configTICK_RATE_HZ;
+        b->last_tick           = now;
+        if (tokens > cap) {
+            tokens = cap;
+        }
+        pass = tokens >= LOGCTL_TOKEN;
+        if (pass) {
+            tokens -= LOGCTL_TOKEN;
+            b->passed++;
+            report     = b->pending;
+            b->pending = 0;
+        } else {
+            b->suppressed++;
+            b->pending++;
+        }
+        b->tokens = (uint32_t) tokens;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    if (report > 0) {
+        ESP_LOG_LEVEL(level, logctl_tag_names[tag], "%lu messages suppressed", (unsigned long) report);
+    }
+    return pass;
+}
+
+// --------------------------------------- //
+
+int logctl_find(const char* name) {
+    for (int i = 0; i < LOGCTL_TAG_COUNT; i++) {
+        if (strcmp(logctl_tag_names[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+esp_err_t logctl_set_level(logctl_tag_t tag, esp_log_level_t level) {
+    if ((unsigned) tag >= LOGCTL_TAG_COUNT || level > ESP_LOG_VERBOSE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    logctl_gates[tag].level = (uint8_t) level;
+    esp_log_level_set(logctl_tag_names[tag], level);  // the ESP_LOGx of the same tag
+    return ESP_OK;
+}
+
+void logctl_set_all(esp_log_level_t level) {
+    esp_log_level_set("*", level);  // drops the esp_log levels of single tags
+    for (int i = 0; i < LOGCTL_TAG_COUNT; i++) {
+        logctl_set_level((logctl_tag_t) i, level);
+        logctl_set_rate((logctl_tag_t) i, s_defaults[i].rate, s_defaults[i].burst);
+    }
+}
+
+esp_err_t logctl_set_rate(logctl_tag_t tag, uint16_t rate, uint16_t burst) {
+    if ((unsigned) tag >= LOGCTL_TAG_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    logctl_bucket_t* b = &s_buckets[tag];
+    portENTER_CRITICAL(&s_lock);
+    b->rate    = rate;
+    b->burst   = burst > 0 ? burst : (rate > 0 ? rate : 1);
+    b->tokens    = (uint32_t) b->burst * LOGCTL_TOKEN;
+    b->last_tick = xTaskGetTickCount();
+    portEXIT_CRITICAL(&s_lock);
+    logctl_gates[tag].limited = rate > 0;
+    return ESP_OK;
+}
+
+void logctl_get_info(logctl_tag_t tag, logctl_info_t* out) {
+    memset(out, 0, sizeof(*out));
+    if ((unsigned) tag >= LOGCTL_TAG_COUNT) {
+        return;
+    }
+    const logctl_bucket_t* b = &s_buckets[tag];
+    portENTER_CRITICAL(&s_lock);
+    out->level      = (esp_log_level_t) logctl_gates[tag].level;
+    out->rate       = b->rate;
+    out->burst      = b->burst;
+    out->passed     = b->passed;
+    out->suppressed = b->suppressed;
+    out->pending    = b->pending;
+    portEXIT_CRITICAL(&s_lock);
+}
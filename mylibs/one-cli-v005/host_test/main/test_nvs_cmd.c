@@ -0,0 +1,153 @@
+/**
+ * @file test_nvs_cmd.c
+ * @brief nvs_export / nvs_import round trips and a 1000 key import, on the NVS
+ * emulation of the Linux target.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_console.h"
+#include "nvs.h"
+#include "nvs_cmd.h"
+#include "nvs_flash.h"
+#include "unity.h"
+
+#define CSV_PATH  "/tmp/one_cli_nvs.csv"
+#define BIN_PATH  "/tmp/one_cli_nvs.bin"
+#define BULK_PATH "/tmp/one_cli_nvs_1k.csv"
+#define BULK_KEYS (1000)
+
+static const char    s_str[]  = "a,\"quoted\"\nsecond line";
+static const uint8_t s_blob[] = {0x00, 0xff, 0x10, 0xab, 0x5c};
+
+static void cli_setup(void) {
+    static bool done;
+    if (done) {
+        return;
+    }
+    esp_err_t err = nvs_flash_init();
+    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        TEST_ASSERT_EQUAL(ESP_OK, nvs_flash_erase());
+        err = nvs_flash_init();
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, err);
+    esp_console_config_t cfg = ESP_CONSOLE_CONFIG_DEFAULT();
+    TEST_ASSERT_EQUAL(ESP_OK, esp_console_init(&cfg));
+    cli_register_nsv_command();
+    done = true;
+}
+
+static int run(const char* line) {
+    int ret = -1;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_console_run(line, &ret));
+    return ret;
+}
+
+static void erase_namespace(const char* name) {
+    nvs_handle_t h;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open(name, NVS_READWRITE, &h));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_erase_all(h));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_commit(h));
+    nvs_close(h);
+}
+
+static void write_keys(void) {
+    nvs_handle_t h;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open("rt", NVS_READWRITE, &h));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_i8(h, "i8", -5));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_u16(h, "u16", 65535));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_i64(h, "i64", INT64_MIN));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_u64(h, "u64", UINT64_MAX));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_str(h, "str", s_str));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_blob(h, "blob", s_blob, sizeof(s_blob)));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_commit(h));
+    nvs_close(h);
+}
+
+static void check_keys(void) {
+    nvs_handle_t h;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open("rt", NVS_READONLY, &h));
+    int8_t   i8;
+    uint16_t u16;
+    int64_t  i64;
+    uint64_t u64;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_i8(h, "i8", &i8));
+    TEST_ASSERT_EQUAL(-5, i8);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_u16(h, "u16", &u16));
+    TEST_ASSERT_EQUAL(65535, u16);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_i64(h, "i64", &i64));
+    TEST_ASSERT_TRUE(i64 == INT64_MIN);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_u64(h, "u64", &u64));
+    TEST_ASSERT_TRUE(u64 == UINT64_MAX);
+
+    char   str[64];
+    size_t len = sizeof(str);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_str(h, "str", str, &len));
+    TEST_ASSERT_EQUAL_STRING(s_str, str);
+
+    uint8_t blob[16];
+    len = sizeof(blob);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_blob(h, "blob", blob, &len));
+    TEST_ASSERT_EQUAL(sizeof(s_blob), len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_blob, blob, sizeof(s_blob));
+    nvs_close(h);
+}
+
+TEST_CASE("a CSV export imports back to the same keys", "[nvs_cmd]")
+{
+    cli_setup();
+    write_keys();
+    TEST_ASSERT_EQUAL(0, run("nvs_export " CSV_PATH " -n rt"));
+    erase_namespace("rt");
+    TEST_ASSERT_EQUAL(0, run("nvs_import " CSV_PATH));
+    check_keys();
+}
+
+TEST_CASE("a binary export imports back to the same keys", "[nvs_cmd]")
+{
+    cli_setup();
+    write_keys();
+    TEST_ASSERT_EQUAL(0, run("nvs_export " BIN_PATH " -n rt -b"));
+    erase_namespace("rt");
+    TEST_ASSERT_EQUAL(0, run("nvs_import " BIN_PATH));
+    check_keys();
+}
+
+TEST_CASE("1000 keys are imported, bad records are skipped", "[nvs_cmd]")
+{
+    cli_setup();
+    erase_namespace("bulk");
+    FILE* f = fopen(BULK_PATH, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "key,type,encoding,value\nbulk,namespace,,\n");
+    for (int i = 0; i < BULK_KEYS; i++) {
+        fprintf(f, "k%d,data,%s,%d\n", i, i % 2 ? "u32" : "string", i);
+    }
+    fprintf(f, "bad,data,base64,AAA=\n");
+    fclose(f);
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    TEST_ASSERT_EQUAL(1, run("nvs_import " BULK_PATH));  // 1: the base64 record
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    int64_t us = (int64_t) (t1.tv_sec - t0.tv_sec) * 1000000 + (t1.tv_nsec - t0.tv_nsec) / 1000;
+    printf("%d keys in %" PRId64 " us, %" PRId64 " keys/s\n", BULK_KEYS, us, us > 0 ? BULK_KEYS * 1000000LL / us : 0);
+
+    nvs_handle_t h;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open("bulk", NVS_READONLY, &h));
+    uint32_t u32;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_u32(h, "k999", &u32));
+    TEST_ASSERT_EQUAL(999, u32);
+    char   str[8];
+    size_t len = sizeof(str);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_str(h, "k998", str, &len));
+    TEST_ASSERT_EQUAL_STRING("998", str);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, nvs_get_str(h, "bad", str, &len));
+    size_t used = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_get_used_entry_count(h, &used));
+    TEST_ASSERT_GREATER_OR_EQUAL(BULK_KEYS, used);
+    nvs_close(h);
+}
@@ -0,0 +1,111 @@
+
+#include "binlog_cmd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "argtable3/argtable3.h"
+#include "binlog.h"
+#include "esp_console.h"
+#include "esp_log.h"
+
+static const char *TAG = "CLI";
+
+#define BINLOG_CMD_UART      (0)  // consola e pe USB-Serial-JTAG, UART0 e liber
+#define BINLOG_CMD_BAUD      (921600)
+#define BINLOG_CMD_FILE      "/littlefs/log.blg"
+#define BINLOG_CMD_TCP_PORT  (3333)
+
+static struct {
+    struct arg_str* subcommand;  // uart | file | tcp | off | stats
+    struct arg_str* target;      // uart: port, file: path, tcp: port
+    struct arg_int* baud;
+    struct arg_end* end;
+} binlog_args;
+
+static void print_stats(void) {
+    binlog_stats_t st;
+    binlog_get_stats(&st);
+    printf("binlog: %s\n", binlog_running() ? "on" : "off");
+    printf("  records   %lu deferred, %lu as text (%lu cut), %lu dropped\n", (unsigned long) st.records,
+        (unsigned long) st.text, (unsigned long) st.truncated, (unsigned long) st.dropped);
+    printf("  sink      %lu bytes, %lu failed writes\n", (unsigned long) st.bytes, (unsigned long) st.sink_errors);
+    printf("  rings     %lu bytes waiting, peak %lu of %u\n", (unsigned long) st.ring_used, (unsigned long) st.ring_peak,
+        BINLOG_RING_SIZE);
+}
+
+static int binlog_command(int argc, char** argv) {
+    int nerrors = arg_parse(argc, argv, (void**) &binlog_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, binlog_args.end, argv[0]);
+        return 1;
+    }
+
+    const char*   sub    = binlog_args.subcommand->count ? binlog_args.subcommand->sval[0] : "stats";
+    const char*   target = binlog_args.target->count ? binlog_args.target->sval[0] : NULL;
+    binlog_sink_t sink;
+    esp_err_t     err;
+
+    if (strcmp(sub, "stats") == 0) {
+        print_stats();
+        return 0;
+    }
+    if (strcmp(sub, "off") == 0) {
+        err = binlog_stop();
+        if (err != ESP_OK) {
+            printf("binlog is not running\n");
+            return 1;
+        }
+        print_stats();
+        return 0;
+    }
+    if (binlog_running()) {
+        printf("binlog is already running, 'binlog off' first\n");
+        return 1;
+    }
+
+    if (strcmp(sub, "uart") == 0) {
+        int baud = binlog_args.baud->count ? binlog_args.baud->ival[0] : BINLOG_CMD_BAUD;
+        err      = binlog_sink_uart(&sink, target ? atoi(target) : BINLOG_CMD_UART, baud);
+    } else if (strcmp(sub, "file") == 0) {
+        err = binlog_sink_file(&sink, target ? target : BINLOG_CMD_FILE);
+    } else if (strcmp(sub, "tcp") == 0) {
+        err = binlog_sink_tcp(&sink, target ? (uint16_t) atoi(target) : BINLOG_CMD_TCP_PORT);
+    } else {
+        printf("Usage: binlog [stats | off | uart [port] [-b baud] | file [path] | tcp [port]]\n");
+        return 1;
+    }
+    if (err == ESP_OK) {
+        err = binlog_start(&sink);
+        if (err != ESP_OK && sink.close) {
+            sink.close(sink.ctx);
+        }
+    }
+    if (err != ESP_OK) {
+        printf("binlog %s: %s\n", sub, esp_err_to_name(err));
+        return 1;
+    }
+    printf("esp_log -> binlog %s; decode with extras/tools/binlog_decode.py build/<app>.elf <input>\n", sub);
+    return 0;
+}
+
+static void register_binlog(void) {
+    binlog_args.subcommand = arg_str0(NULL, NULL, "<stats|off|uart|file|tcp>", "stats (default), off, or the sink to start");
+    binlog_args.target     = arg_str0(NULL, NULL, "<port|path>", "uart: UART number, file: path, tcp: port");
+    binlog_args.baud       = arg_int0("b", "baud", "<baud>", "uart baud rate (921600)");
+    binlog_args.end        = arg_end(3);
+
+    const esp_console_cmd_t cmd = {
+        .command  = "binlog",
+        .help     = "Binary esp_log output (formatted on the host) to UART, a file or TCP",
+        .hint     = NULL,
+        .func     = &binlog_command,
+        .argtable = &binlog_args,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+    ESP_LOGI(TAG, "'%s' command registered.", cmd.command);
+}
+
+void cli_register_binlog_command(void) {
+    register_binlog();
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#ifndef BINLOG_CMD_H_
+#define BINLOG_CMD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void cli_register_binlog_command(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BINLOG_CMD_H_
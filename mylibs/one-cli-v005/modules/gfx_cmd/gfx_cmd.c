@@ -0,0 +1,57 @@
+
+#include "gfx_cmd.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "argtable3/argtable3.h"
+#include "esp_console.h"
+#include "esp_log.h"
+#include "gfxstats.h"
+
+static const char *TAG = "CLI";
+
+static struct {
+    struct arg_str* subcommand;  // stats | reset
+    struct arg_lit* verbose;     // histograma completa
+    struct arg_end* end;
+} gfx_args;
+
+static int gfx_command(int argc, char** argv) {
+    int nerrors = arg_parse(argc, argv, (void**) &gfx_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, gfx_args.end, argv[0]);
+        return 1;
+    }
+
+    const char* sub = gfx_args.subcommand->count ? gfx_args.subcommand->sval[0] : "stats";
+    if (strcmp(sub, "stats") == 0) {
+        gfxstats_print(gfx_args.verbose->count > 0);
+    } else if (strcmp(sub, "reset") == 0) {
+        gfxstats_reset();
+        printf("Render statistics cleared\n");
+    } else {
+        printf("Usage: gfx [stats [-v] | reset]\n");
+        return 1;
+    }
+    return 0;
+}
+
+static void register_gfx(void) {
+    gfx_args.subcommand = arg_str0(NULL, NULL, "<stats|reset>", "stats (default) or reset");
+    gfx_args.verbose    = arg_lit0("v", "verbose", "print the histogram buckets too");
+    gfx_args.end        = arg_end(2);
+
+    const esp_console_cmd_t cmd = {
+        .command  = "gfx",
+        .help     = "LVGL render statistics: render/flush/wait time, area, FPS, draw units",
+        .hint     = NULL,
+        .func     = &gfx_command,
+        .argtable = &gfx_args,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+    ESP_LOGI(TAG, "'%s' command registered.", cmd.command);
+}
+
+void cli_register_gfx_command(void) {
+    register_gfx();
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#ifndef GFX_CMD_H_
+#define GFX_CMD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void cli_register_gfx_command(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // GFX_CMD_H_
@@ -15,5 +15,7 @@
 #include "modules/uptime_cmd/uptime_cmd.h"
 #include "modules/wifi_cmd/wifi_cmd.h"
 #include "modules/perfmon_cmd/perfmon_cmd.h"
+#include "modules/gfx_cmd/gfx_cmd.h"
+#include "modules/binlog_cmd/binlog_cmd.h"
 
 #endif /* MODULES_H_ */
\ No newline at end of file
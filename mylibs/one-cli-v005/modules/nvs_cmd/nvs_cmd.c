@@ -16,36 +16,68 @@
 #include "freertos/event_groups.h"
 #include <errno.h>
 #include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
+#include <time.h>
+#include "config.h"
 #include "nvs_cmd.h"
 
 static const char *TAG = "CLI";
 
+/* Bytes buffered before nvs_list / nvs_stats write to the console. */
+#define NVS_OUT_BUF_SIZE (512)
+/* stdio buffer of the files used by nvs_export / nvs_import. */
+#define NVS_FILE_BUF_SIZE (4096)
+/* Keys written by nvs_import between two commits of the same namespace. */
+#define NVS_IMPORT_BATCH_SIZE (128)
+
+/* Binary image: magic + version, then one record per namespace or key.
+ *   namespace: 0x00, u8 length, name
+ *   integer:   nvs_type_t, u8 length, key, value (little endian, type & 0x0f bytes)
+ *   str/blob:  nvs_type_t, u8 length, key, u32 length (little endian), data
+ */
+#define NVS_BIN_MAGIC "NVSB"
+#define NVS_BIN_VERSION (1)
+#define NVS_BIN_NAMESPACE (0x00)
+
 typedef struct {
     nvs_type_t type;
     const char* str;
+    const char* csv; // encoding in the nvs_partition_gen.py CSV format
 } type_str_pair_t;
 
 static const type_str_pair_t type_str_pair[] = {
-    {NVS_TYPE_I8, "i8"},
-    {NVS_TYPE_U8, "u8"},
-    {NVS_TYPE_U16, "u16"},
-    {NVS_TYPE_I16, "i16"},
-    {NVS_TYPE_U32, "u32"},
-    {NVS_TYPE_I32, "i32"},
-    {NVS_TYPE_U64, "u64"},
-    {NVS_TYPE_I64, "i64"},
-    {NVS_TYPE_STR, "str"},
-    {NVS_TYPE_BLOB, "blob"},
-    {NVS_TYPE_ANY, "any"},
+    {NVS_TYPE_I8, "i8", "i8"},
+    {NVS_TYPE_U8, "u8", "u8"},
+    {NVS_TYPE_U16, "u16", "u16"},
+    {NVS_TYPE_I16, "i16", "i16"},
+    {NVS_TYPE_U32, "u32", "u32"},
+    {NVS_TYPE_I32, "i32", "i32"},
+    {NVS_TYPE_U64, "u64", "u64"},
+    {NVS_TYPE_I64, "i64", "i64"},
+    {NVS_TYPE_STR, "str", "string"},
+    {NVS_TYPE_BLOB, "blob", "hex2bin"},
+    {NVS_TYPE_ANY, "any", NULL},
 };
 
 static const size_t TYPE_STR_PAIR_SIZE = sizeof(type_str_pair) / sizeof(type_str_pair[0]);
 static const char* ARG_TYPE_STR = "type can be: i8, u8, i16, u16 i32, u32 i64, u64, str, blob";
 static char current_namespace[16] = "storage";
 
+/* Value of each hex digit plus one, 0 for the other characters. */
+static const uint8_t hex_lut[256] = {
+    ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5,
+    ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
+
+static const char hex_digits[] = "0123456789abcdef";
+
 static struct {
     struct arg_str* key;
     struct arg_str* type;
@@ -81,6 +113,56 @@ static struct {
     struct arg_end* end;
 } list_args;
 
+static struct {
+    struct arg_str* file;
+    struct arg_str* partition;
+    struct arg_str* namespace;
+    struct arg_lit* binary;
+    struct arg_end* end;
+} export_args;
+
+static struct {
+    struct arg_str* file;
+    struct arg_str* partition;
+    struct arg_end* end;
+} import_args;
+
+static struct {
+    struct arg_str* partition;
+    struct arg_end* end;
+} stats_args;
+
+/* Console output collected in blocks instead of one write per line. */
+typedef struct {
+    char data[NVS_OUT_BUF_SIZE];
+    size_t len;
+} out_buf_t;
+
+static void out_flush(out_buf_t* out) {
+    fwrite(out->data, 1, out->len, stdout);
+    out->len = 0;
+}
+
+static void out_printf(out_buf_t* out, const char* fmt, ...) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        va_list args;
+        va_start(args, fmt);
+        int n = vsnprintf(out->data + out->len, sizeof(out->data) - out->len, fmt, args);
+        va_end(args);
+        if (n < 0) {
+            return;
+        }
+        if ((size_t)n < sizeof(out->data) - out->len) {
+            out->len += n;
+            return;
+        }
+        // nu incape: golim bufferul si mai incercam o data
+        out_flush(out);
+    }
+    // mai lung decat bufferul intreg, se trunchiaza
+    out->len = sizeof(out->data) - 1;
+}
+
 static nvs_type_t str_to_type(const char* type) {
     for (int i = 0; i < TYPE_STR_PAIR_SIZE; i++) {
         const type_str_pair_t* p = &type_str_pair[i];
@@ -103,8 +185,84 @@ static const char* type_to_str(nvs_type_t type) {
     return "Unknown";
 }
 
+static nvs_type_t csv_to_type(const char* encoding) {
+    for (int i = 0; i < TYPE_STR_PAIR_SIZE; i++) {
+        const type_str_pair_t* p = &type_str_pair[i];
+        if (p->csv != NULL && strcmp(encoding, p->csv) == 0) {
+            return p->type;
+        }
+    }
+
+    return NVS_TYPE_ANY;
+}
+
+static const char* type_to_csv(nvs_type_t type) {
+    for (int i = 0; i < TYPE_STR_PAIR_SIZE; i++) {
+        const type_str_pair_t* p = &type_str_pair[i];
+        if (p->type == type) {
+            return p->csv;
+        }
+    }
+
+    return NULL;
+}
+
+/* The integer types are encoded as 0x0N (unsigned) / 0x1N (signed), N being the size in bytes. */
+static inline bool type_is_int(nvs_type_t type) {
+    return type != NVS_TYPE_STR && type != NVS_TYPE_BLOB && type != NVS_TYPE_ANY;
+}
+
+static inline bool type_is_signed(nvs_type_t type) {
+    return (type & 0x10) != 0;
+}
+
+static inline size_t type_int_size(nvs_type_t type) {
+    return type & 0x0f;
+}
+
+static int64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Grows *buf to at least size bytes. */
+static esp_err_t scratch_reserve(char** buf, size_t* buf_size, size_t size) {
+    if (size <= *buf_size) {
+        return ESP_OK;
+    }
+    char* grown = realloc(*buf, size);
+    if (grown == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    *buf = grown;
+    *buf_size = size;
+    return ESP_OK;
+}
+
+/* Two characters per byte, looked up in hex_lut. */
+static bool hex_decode(const char* str, size_t str_len, uint8_t* out) {
+    const unsigned char* in = (const unsigned char*)str;
+    for (size_t i = 0; i < str_len / 2; i++) {
+        const uint8_t hi = hex_lut[in[2 * i]];
+        const uint8_t lo = hex_lut[in[2 * i + 1]];
+        if (hi == 0 || lo == 0) {
+            return false;
+        }
+        out[i] = ((hi - 1) << 4) | (lo - 1);
+    }
+    return true;
+}
+
+/* Writes 2 * len characters, without terminator. */
+static void hex_encode(const uint8_t* data, size_t len, char* out) {
+    for (size_t i = 0; i < len; i++) {
+        out[2 * i] = hex_digits[data[i] >> 4];
+        out[2 * i + 1] = hex_digits[data[i] & 0x0f];
+    }
+}
+
 static esp_err_t store_blob(nvs_handle_t nvs, const char* key, const char* str_values) {
-    uint8_t value;
     size_t str_len = strlen(str_values);
     size_t blob_len = str_len / 2;
 
@@ -113,53 +271,178 @@ static esp_err_t store_blob(nvs_handle_t nvs, const char* key, const char* str_v
         return ESP_ERR_NVS_TYPE_MISMATCH;
     }
 
-    char* blob = (char*)malloc(blob_len);
+    uint8_t* blob = (uint8_t*)malloc(blob_len ? blob_len : 1);
     if (blob == NULL) {
         return ESP_ERR_NO_MEM;
     }
 
-    for (int i = 0, j = 0; i < str_len; i++) {
-        char ch = str_values[i];
-        if (ch >= '0' && ch <= '9') {
-            value = ch - '0';
-        } else if (ch >= 'A' && ch <= 'F') {
-            value = ch - 'A' + 10;
-        } else if (ch >= 'a' && ch <= 'f') {
-            value = ch - 'a' + 10;
-        } else {
-            ESP_LOGE(TAG, "Blob data contain invalid character");
-            free(blob);
-            return ESP_ERR_NVS_TYPE_MISMATCH;
-        }
-
-        if (i & 1) {
-            blob[j++] += value;
-        } else {
-            blob[j] = value << 4;
-        }
+    if (!hex_decode(str_values, str_len, blob)) {
+        ESP_LOGE(TAG, "Blob data contain invalid character");
+        free(blob);
+        return ESP_ERR_NVS_TYPE_MISMATCH;
     }
 
     esp_err_t err = nvs_set_blob(nvs, key, blob, blob_len);
     free(blob);
+    return err;
+}
 
-    if (err == ESP_OK) {
-        err = nvs_commit(nvs);
+static void print_blob(const uint8_t* blob, size_t len) {
+    char* hex = (char*)malloc(2 * len + 1);
+    if (hex == NULL) {
+        ESP_LOGE(TAG, "%s", esp_err_to_name(ESP_ERR_NO_MEM));
+        return;
+    }
+    hex_encode(blob, len, hex);
+    hex[2 * len] = '\n';
+    fwrite(hex, 1, 2 * len + 1, stdout);
+    free(hex);
+}
+
+/* Parses an integer of the given type, the value is returned as its 64-bit pattern. */
+static esp_err_t parse_int(const char* str, nvs_type_t type, uint64_t* out_bits) {
+    const unsigned bits = 8 * type_int_size(type);
+    char* end = NULL;
+
+    errno = 0;
+    if (type_is_signed(type)) {
+        long long value = strtoll(str, &end, 0);
+        if (end == str || *end != '\0') {
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (errno == ERANGE ||
+            (bits < 64 && (value < -(1LL << (bits - 1)) || value > (1LL << (bits - 1)) - 1))) {
+            return ESP_ERR_NVS_VALUE_TOO_LONG;
+        }
+        *out_bits = (uint64_t)value;
+    } else {
+        // strtoull accepta si "-1", ceea ce nu vrem pentru un tip unsigned
+        while (*str == ' ' || *str == '\t') {
+            str++;
+        }
+        if (*str == '-') {
+            return ESP_ERR_NVS_VALUE_TOO_LONG;
+        }
+        unsigned long long value = strtoull(str, &end, 0);
+        if (end == str || *end != '\0') {
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (errno == ERANGE || (bits < 64 && value > (1ULL << bits) - 1)) {
+            return ESP_ERR_NVS_VALUE_TOO_LONG;
+        }
+        *out_bits = value;
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t set_int(nvs_handle_t nvs, const char* key, nvs_type_t type, uint64_t bits) {
+    switch (type) {
+    case NVS_TYPE_I8:
+        return nvs_set_i8(nvs, key, (int8_t)bits);
+    case NVS_TYPE_U8:
+        return nvs_set_u8(nvs, key, (uint8_t)bits);
+    case NVS_TYPE_I16:
+        return nvs_set_i16(nvs, key, (int16_t)bits);
+    case NVS_TYPE_U16:
+        return nvs_set_u16(nvs, key, (uint16_t)bits);
+    case NVS_TYPE_I32:
+        return nvs_set_i32(nvs, key, (int32_t)bits);
+    case NVS_TYPE_U32:
+        return nvs_set_u32(nvs, key, (uint32_t)bits);
+    case NVS_TYPE_I64:
+        return nvs_set_i64(nvs, key, (int64_t)bits);
+    case NVS_TYPE_U64:
+        return nvs_set_u64(nvs, key, bits);
+    default:
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+}
+
+/* Reads an integer of the given type, the signed values are sign-extended. */
+static esp_err_t get_int(nvs_handle_t nvs, const char* key, nvs_type_t type, uint64_t* out_bits) {
+    esp_err_t err = ESP_ERR_NVS_TYPE_MISMATCH;
+
+    switch (type) {
+    case NVS_TYPE_I8: {
+        int8_t value;
+        if ((err = nvs_get_i8(nvs, key, &value)) == ESP_OK) {
+            *out_bits = (uint64_t)(int64_t)value;
+        }
+        break;
+    }
+    case NVS_TYPE_U8: {
+        uint8_t value;
+        if ((err = nvs_get_u8(nvs, key, &value)) == ESP_OK) {
+            *out_bits = value;
+        }
+        break;
+    }
+    case NVS_TYPE_I16: {
+        int16_t value;
+        if ((err = nvs_get_i16(nvs, key, &value)) == ESP_OK) {
+            *out_bits = (uint64_t)(int64_t)value;
+        }
+        break;
+    }
+    case NVS_TYPE_U16: {
+        uint16_t value;
+        if ((err = nvs_get_u16(nvs, key, &value)) == ESP_OK) {
+            *out_bits = value;
+        }
+        break;
+    }
+    case NVS_TYPE_I32: {
+        int32_t value;
+        if ((err = nvs_get_i32(nvs, key, &value)) == ESP_OK) {
+            *out_bits = (uint64_t)(int64_t)value;
+        }
+        break;
+    }
+    case NVS_TYPE_U32: {
+        uint32_t value;
+        if ((err = nvs_get_u32(nvs, key, &value)) == ESP_OK) {
+            *out_bits = value;
+        }
+        break;
+    }
+    case NVS_TYPE_I64: {
+        int64_t value;
+        if ((err = nvs_get_i64(nvs, key, &value)) == ESP_OK) {
+            *out_bits = (uint64_t)value;
+        }
+        break;
+    }
+    case NVS_TYPE_U64:
+        err = nvs_get_u64(nvs, key, out_bits);
+        break;
+    default:
+        break;
     }
 
     return err;
 }
 
-static void print_blob(const char* blob, size_t len) {
-    for (int i = 0; i < len; i++) {
-        printf("%02x", blob[i]);
+/* Sets a value given as text: a number, a string or the hex digits of a blob. */
+static esp_err_t set_from_str(nvs_handle_t nvs, const char* key, nvs_type_t type, const char* str_value) {
+    if (type == NVS_TYPE_STR) {
+        return nvs_set_str(nvs, key, str_value);
     }
-    printf("\n");
+    if (type == NVS_TYPE_BLOB) {
+        return store_blob(nvs, key, str_value);
+    }
+
+    uint64_t bits = 0;
+    esp_err_t err = parse_int(str_value, type, &bits);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return set_int(nvs, key, type, bits);
 }
 
 static esp_err_t set_value_in_nvs(const char* key, const char* str_type, const char* str_value) {
     esp_err_t err;
     nvs_handle_t nvs;
-    bool range_error = false;
 
     nvs_type_t type = str_to_type(str_type);
 
@@ -173,64 +456,7 @@ static esp_err_t set_value_in_nvs(const char* key, const char* str_type, const c
         return err;
     }
 
-    if (type == NVS_TYPE_I8) {
-        int32_t value = strtol(str_value, NULL, 0);
-        if (value < INT8_MIN || value > INT8_MAX || errno == ERANGE) {
-            range_error = true;
-        } else {
-            err = nvs_set_i8(nvs, key, (int8_t)value);
-        }
-    } else if (type == NVS_TYPE_U8) {
-        uint32_t value = strtoul(str_value, NULL, 0);
-        if (value > UINT8_MAX || errno == ERANGE) {
-            range_error = true;
-        } else {
-            err = nvs_set_u8(nvs, key, (uint8_t)value);
-        }
-    } else if (type == NVS_TYPE_I16) {
-        int32_t value = strtol(str_value, NULL, 0);
-        if (value < INT16_MIN || value > INT16_MAX || errno == ERANGE) {
-            range_error = true;
-        } else {
-            err = nvs_set_i16(nvs, key, (int16_t)value);
-        }
-    } else if (type == NVS_TYPE_U16) {
-        uint32_t value = strtoul(str_value, NULL, 0);
-        if (value > UINT16_MAX || errno == ERANGE) {
-            range_error = true;
-        } else {
-            err = nvs_set_u16(nvs, key, (uint16_t)value);
-        }
-    } else if (type == NVS_TYPE_I32) {
-        int32_t value = strtol(str_value, NULL, 0);
-        if (errno != ERANGE) {
-            err = nvs_set_i32(nvs, key, value);
-        }
-    } else if (type == NVS_TYPE_U32) {
-        uint32_t value = strtoul(str_value, NULL, 0);
-        if (errno != ERANGE) {
-            err = nvs_set_u32(nvs, key, value);
-        }
-    } else if (type == NVS_TYPE_I64) {
-        int64_t value = strtoll(str_value, NULL, 0);
-        if (errno != ERANGE) {
-            err = nvs_set_i64(nvs, key, value);
-        }
-    } else if (type == NVS_TYPE_U64) {
-        uint64_t value = strtoull(str_value, NULL, 0);
-        if (errno != ERANGE) {
-            err = nvs_set_u64(nvs, key, value);
-        }
-    } else if (type == NVS_TYPE_STR) {
-        err = nvs_set_str(nvs, key, str_value);
-    } else if (type == NVS_TYPE_BLOB) {
-        err = store_blob(nvs, key, str_value);
-    }
-
-    if (range_error || errno == ERANGE) {
-        nvs_close(nvs);
-        return ESP_ERR_NVS_VALUE_TOO_LONG;
-    }
+    err = set_from_str(nvs, key, type, str_value);
 
     if (err == ESP_OK) {
         err = nvs_commit(nvs);
@@ -259,54 +485,13 @@ static esp_err_t get_value_from_nvs(const char* key, const char* str_type) {
         return err;
     }
 
-    if (type == NVS_TYPE_I8) {
-        int8_t value;
-        err = nvs_get_i8(nvs, key, &value);
-        if (err == ESP_OK) {
-            printf("%d\n", value);
-        }
-    } else if (type == NVS_TYPE_U8) {
-        uint8_t value;
-        err = nvs_get_u8(nvs, key, &value);
-        if (err == ESP_OK) {
-            printf("%u\n", value);
-        }
-    } else if (type == NVS_TYPE_I16) {
-        int16_t value;
-        err = nvs_get_i16(nvs, key, &value);
-        if (err == ESP_OK) {
-            printf("%u\n", value);
-        }
-    } else if (type == NVS_TYPE_U16) {
-        uint16_t value;
-        if ((err = nvs_get_u16(nvs, key, &value)) == ESP_OK) {
-            printf("%u\n", value);
-        }
-    } else if (type == NVS_TYPE_I32) {
-        int32_t value;
-        if ((err = nvs_get_i32(nvs, key, &value)) == ESP_OK) {
-            printf("%" PRIi32 "\n", value);
-        }
-    } else if (type == NVS_TYPE_U32) {
-        uint32_t value;
-        if ((err = nvs_get_u32(nvs, key, &value)) == ESP_OK) {
-            printf("%" PRIu32 "\n", value);
-        }
-    } else if (type == NVS_TYPE_I64) {
-        int64_t value;
-        if ((err = nvs_get_i64(nvs, key, &value)) == ESP_OK) {
-            printf("%lld\n", value);
-        }
-    } else if (type == NVS_TYPE_U64) {
-        uint64_t value;
-        if ((err = nvs_get_u64(nvs, key, &value)) == ESP_OK) {
-            printf("%llu\n", value);
-        }
-    } else if (type == NVS_TYPE_STR) {
+    if (type == NVS_TYPE_STR) {
         size_t len;
         if ((err = nvs_get_str(nvs, key, NULL, &len)) == ESP_OK) {
             char* str = (char*)malloc(len);
-            if ((err = nvs_get_str(nvs, key, str, &len)) == ESP_OK) {
+            if (str == NULL) {
+                err = ESP_ERR_NO_MEM;
+            } else if ((err = nvs_get_str(nvs, key, str, &len)) == ESP_OK) {
                 printf("%s\n", str);
             }
             free(str);
@@ -314,12 +499,23 @@ static esp_err_t get_value_from_nvs(const char* key, const char* str_type) {
     } else if (type == NVS_TYPE_BLOB) {
         size_t len;
         if ((err = nvs_get_blob(nvs, key, NULL, &len)) == ESP_OK) {
-            char* blob = (char*)malloc(len);
-            if ((err = nvs_get_blob(nvs, key, blob, &len)) == ESP_OK) {
+            uint8_t* blob = (uint8_t*)malloc(len ? len : 1);
+            if (blob == NULL) {
+                err = ESP_ERR_NO_MEM;
+            } else if ((err = nvs_get_blob(nvs, key, blob, &len)) == ESP_OK) {
                 print_blob(blob, len);
             }
             free(blob);
         }
+    } else {
+        uint64_t bits;
+        if ((err = get_int(nvs, key, type, &bits)) == ESP_OK) {
+            if (type_is_signed(type)) {
+                printf("%" PRId64 "\n", (int64_t)bits);
+            } else {
+                printf("%" PRIu64 "\n", bits);
+            }
+        }
     }
 
     nvs_close(nvs);
@@ -348,24 +544,31 @@ static esp_err_t erase_all(const char* name) {
     nvs_handle_t nvs;
 
     esp_err_t err = nvs_open(name, NVS_READWRITE, &nvs);
-    if (err == ESP_OK) {
-        err = nvs_erase_all(nvs);
-        if (err == ESP_OK) {
-            err = nvs_commit(nvs);
-        }
+    if (err != ESP_OK) {
+        return err;
     }
 
-    ESP_LOGI(TAG, "Namespace '%s' was %s erased", name, (err == ESP_OK) ? "" : "not");
-
+    err = nvs_erase_all(nvs);
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs);
+    }
     nvs_close(nvs);
-    return ESP_OK;
+
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "Namespace '%s' was erased", name);
+    }
+    return err;
 }
 
 static int list(const char* part, const char* name, const char* str_type) {
     nvs_type_t type = str_to_type(str_type);
+    if (type == NVS_TYPE_ANY && str_type[0] != '\0' && strcmp(str_type, "any") != 0) {
+        ESP_LOGE(TAG, "Type '%s' is undefined", str_type);
+        return 1;
+    }
 
     nvs_iterator_t it = NULL;
-    esp_err_t result = nvs_entry_find(part, NULL, type, &it);
+    esp_err_t result = nvs_entry_find(part, name[0] != '\0' ? name : NULL, type, &it);
     if (result == ESP_ERR_NVS_NOT_FOUND) {
         ESP_LOGE(TAG, "No such entry was found");
         return 1;
@@ -376,14 +579,22 @@ static int list(const char* part, const char* name, const char* str_type) {
         return 1;
     }
 
+    out_buf_t out = {.len = 0};
+    size_t count = 0;
+
+    out_printf(&out, "%-16s %-16s %s\n", "namespace", "key", "type");
     do {
         nvs_entry_info_t info;
         nvs_entry_info(it, &info);
         result = nvs_entry_next(&it);
 
-        printf("namespace '%s', key '%s', type '%s' \n", info.namespace_name, info.key,
-            type_to_str(info.type));
+        out_printf(&out, "%-16s %-16s %s\n", info.namespace_name, info.key, type_to_str(info.type));
+        count++;
     } while (result == ESP_OK);
+    nvs_release_iterator(it);
+
+    out_printf(&out, "%u entries\n", (unsigned)count);
+    out_flush(&out);
 
     if (result != ESP_ERR_NVS_NOT_FOUND) { // the last iteration ran into an internal error
         ESP_LOGE(TAG, "NVS error %s at current iteration, stopping.", esp_err_to_name(result));
@@ -393,6 +604,476 @@ static int list(const char* part, const char* name, const char* str_type) {
     return 0;
 }
 
+/* Names of the namespaces holding at least one key, or only 'name' when given. */
+static esp_err_t collect_namespaces(
+    const char* part, const char* name, char (**out_names)[NVS_NS_NAME_MAX_SIZE], size_t* out_count) {
+    char(*names)[NVS_NS_NAME_MAX_SIZE] = NULL;
+    size_t count = 0;
+    size_t capacity = 0;
+
+    nvs_iterator_t it = NULL;
+    esp_err_t err = nvs_entry_find(part, name, NVS_TYPE_ANY, &it);
+    while (err == ESP_OK) {
+        nvs_entry_info_t info;
+        nvs_entry_info(it, &info);
+
+        size_t i = 0;
+        while (i < count && strcmp(names[i], info.namespace_name) != 0) {
+            i++;
+        }
+        if (i == count) {
+            if (count == capacity) {
+                capacity = capacity ? 2 * capacity : 8;
+                void* grown = realloc(names, capacity * sizeof(names[0]));
+                if (grown == NULL) {
+                    err = ESP_ERR_NO_MEM;
+                    break;
+                }
+                names = grown;
+            }
+            strlcpy(names[count++], info.namespace_name, NVS_NS_NAME_MAX_SIZE);
+        }
+
+        err = nvs_entry_next(&it);
+    }
+    nvs_release_iterator(it);
+
+    if (err != ESP_ERR_NVS_NOT_FOUND) {
+        free(names);
+        return err;
+    }
+
+    *out_names = names;
+    *out_count = count;
+    return ESP_OK;
+}
+
+/* ------------------------------- export ------------------------------- */
+
+typedef struct {
+    FILE* file;
+    bool binary;
+    nvs_handle_t nvs;
+    char* scratch; // valoarea curenta (str/blob), apoi codificarea ei hex
+    size_t scratch_size;
+    size_t keys;
+    size_t bytes;
+} nvs_export_t;
+
+static bool write_u8_str(FILE* f, uint8_t prefix, const char* str) {
+    const size_t len = strlen(str);
+    const uint8_t header[2] = {prefix, (uint8_t)len};
+    return fwrite(header, 1, 2, f) == 2 && fwrite(str, 1, len, f) == len;
+}
+
+/* Writes a CSV field, quoted if needed. */
+static bool write_csv_field(FILE* f, const char* str, size_t len) {
+    if (strcspn(str, ",\"\r\n") >= len) {
+        return fwrite(str, 1, len, f) == len;
+    }
+
+    if (fputc('"', f) == EOF) {
+        return false;
+    }
+    const char* end = str + len;
+    while (str < end) {
+        const char* quote = memchr(str, '"', end - str);
+        const size_t run = (quote ? quote + 1 : end) - str;
+        if (fwrite(str, 1, run, f) != run || (quote && fputc('"', f) == EOF)) {
+            return false;
+        }
+        str += run;
+    }
+    return fputc('"', f) != EOF;
+}
+
+static esp_err_t export_namespace_begin(nvs_export_t* exp, const char* name) {
+    bool ok;
+    if (exp->binary) {
+        ok = write_u8_str(exp->file, NVS_BIN_NAMESPACE, name);
+    } else {
+        ok = write_csv_field(exp->file, name, strlen(name)) && fputs(",namespace,,\n", exp->file) >= 0;
+    }
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t export_entry(nvs_export_t* exp, const nvs_entry_info_t* info) {
+    FILE* f = exp->file;
+    const nvs_type_t type = info->type;
+    esp_err_t err;
+    bool ok;
+
+    if (type_is_int(type)) {
+        uint64_t bits = 0;
+        if ((err = get_int(exp->nvs, info->key, type, &bits)) != ESP_OK) {
+            return err;
+        }
+        const size_t size = type_int_size(type);
+        if (exp->binary) {
+            uint8_t value[8];
+            for (size_t i = 0; i < size; i++) {
+                value[i] = (uint8_t)(bits >> (8 * i));
+            }
+            ok = write_u8_str(f, type, info->key) && fwrite(value, 1, size, f) == size;
+        } else if (type_is_signed(type)) {
+            ok = fprintf(f, "%s,data,%s,%" PRId64 "\n", info->key, type_to_csv(type), (int64_t)bits) > 0;
+        } else {
+            ok = fprintf(f, "%s,data,%s,%" PRIu64 "\n", info->key, type_to_csv(type), bits) > 0;
+        }
+        exp->bytes += size;
+        exp->keys++;
+        return ok ? ESP_OK : ESP_FAIL;
+    }
+
+    size_t len = 0;
+    err = type == NVS_TYPE_STR ? nvs_get_str(exp->nvs, info->key, NULL, &len)
+                               : nvs_get_blob(exp->nvs, info->key, NULL, &len);
+    if (err != ESP_OK) {
+        return err;
+    }
+    // hex2bin are nevoie de 2 caractere pe octet, dupa valoare
+    const size_t needed = (!exp->binary && type == NVS_TYPE_BLOB) ? 3 * len : len;
+    if ((err = scratch_reserve(&exp->scratch, &exp->scratch_size, needed ? needed : 1)) != ESP_OK) {
+        return err;
+    }
+    err = type == NVS_TYPE_STR ? nvs_get_str(exp->nvs, info->key, exp->scratch, &len)
+                               : nvs_get_blob(exp->nvs, info->key, exp->scratch, &len);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (type == NVS_TYPE_STR && len > 0) {
+        len--; // fara terminator
+    }
+
+    if (exp->binary) {
+        const uint8_t size[4] = {
+            (uint8_t)len, (uint8_t)(len >> 8), (uint8_t)(len >> 16), (uint8_t)(len >> 24)};
+        ok = write_u8_str(f, type, info->key) && fwrite(size, 1, 4, f) == 4 &&
+             fwrite(exp->scratch, 1, len, f) == len;
+    } else {
+        ok = fprintf(f, "%s,data,%s,", info->key, type_to_csv(type)) > 0;
+        if (type == NVS_TYPE_STR) {
+            ok = ok && write_csv_field(f, exp->scratch, len);
+        } else {
+            char* hex = exp->scratch + len;
+            hex_encode((const uint8_t*)exp->scratch, len, hex);
+            ok = ok && fwrite(hex, 1, 2 * len, f) == 2 * len;
+        }
+        ok = ok && fputc('\n', f) != EOF;
+    }
+    exp->bytes += len;
+    exp->keys++;
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+/* One handle per namespace, the keys of a namespace are written together. */
+static esp_err_t export_namespace(nvs_export_t* exp, const char* part, const char* name) {
+    esp_err_t err = nvs_open_from_partition(part, name, NVS_READONLY, &exp->nvs);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    err = export_namespace_begin(exp, name);
+
+    nvs_iterator_t it = NULL;
+    if (err == ESP_OK) {
+        err = nvs_entry_find(part, name, NVS_TYPE_ANY, &it);
+    }
+    while (err == ESP_OK) {
+        nvs_entry_info_t info;
+        nvs_entry_info(it, &info);
+        err = export_entry(exp, &info);
+        if (err == ESP_OK) {
+            err = nvs_entry_next(&it);
+        } else {
+            ESP_LOGE(TAG, "Key '%s' of namespace '%s' not exported", info.key, name);
+        }
+    }
+    nvs_release_iterator(it);
+    nvs_close(exp->nvs);
+
+    return err == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : err;
+}
+
+/* ------------------------------- import ------------------------------- */
+
+typedef struct {
+    const char* part;
+    nvs_handle_t nvs;
+    bool open;
+    size_t pending; // chei scrise de la ultimul commit
+    size_t keys;
+    size_t bytes;
+    size_t errors;
+    size_t record;
+} nvs_import_t;
+
+static esp_err_t import_commit(nvs_import_t* imp) {
+    esp_err_t err = ESP_OK;
+    if (imp->open && imp->pending > 0) {
+        err = nvs_commit(imp->nvs);
+        imp->pending = 0;
+    }
+    return err;
+}
+
+static esp_err_t import_close(nvs_import_t* imp) {
+    esp_err_t err = import_commit(imp);
+    if (imp->open) {
+        nvs_close(imp->nvs);
+        imp->open = false;
+    }
+    return err;
+}
+
+static esp_err_t import_namespace(nvs_import_t* imp, const char* name) {
+    esp_err_t err = import_close(imp);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_open_from_partition(imp->part, name, NVS_READWRITE, &imp->nvs);
+    imp->open = err == ESP_OK;
+    return err;
+}
+
+/* Counts the key just written, committed every NVS_IMPORT_BATCH_SIZE keys. */
+static esp_err_t import_written(nvs_import_t* imp, size_t bytes) {
+    imp->keys++;
+    imp->bytes += bytes;
+    if (++imp->pending >= NVS_IMPORT_BATCH_SIZE) {
+        return import_commit(imp);
+    }
+    return ESP_OK;
+}
+
+/* Errors of a single record are reported and skipped, the others stop the import. */
+static bool import_record_failed(nvs_import_t* imp, const char* key, esp_err_t err) {
+    ESP_LOGE(TAG, "Record %u ('%s'): %s", (unsigned)imp->record, key, esp_err_to_name(err));
+    imp->errors++;
+    return err == ESP_ERR_NVS_NOT_ENOUGH_SPACE || err == ESP_ERR_NO_MEM || err == ESP_FAIL;
+}
+
+/* Splits a CSV record in place, the quoted fields are unquoted. Returns the number of fields. */
+static size_t split_csv(char* record, char** fields, size_t max_fields) {
+    size_t count = 0;
+    char* in = record;
+
+    while (count < max_fields) {
+        char* out = in;
+        fields[count++] = out;
+        if (*in == '"') {
+            in++;
+            while (*in != '\0') {
+                if (*in == '"' && in[1] == '"') {
+                    *out++ = '"';
+                    in += 2;
+                } else if (*in == '"') {
+                    in++;
+                    break;
+                } else {
+                    *out++ = *in++;
+                }
+            }
+        }
+        while (*in != '\0' && *in != ',') {
+            *out++ = *in++;
+        }
+        const bool more = *in == ',';
+        *out = '\0';
+        if (!more) {
+            break;
+        }
+        in++;
+    }
+    return count;
+}
+
+/* Reads one CSV record, which continues on the next lines while a quote is open. */
+static ssize_t read_csv_record(FILE* f, char** record, size_t* record_size, char** line, size_t* line_size) {
+    size_t len = 0;
+    bool quoted = false;
+
+    do {
+        ssize_t n = getline(line, line_size, f);
+        if (n < 0) {
+            return len > 0 ? (ssize_t)len : -1;
+        }
+        if (scratch_reserve(record, record_size, len + n + 1) != ESP_OK) {
+            return -1;
+        }
+        memcpy(*record + len, *line, n + 1);
+        for (const char* p = *line; (p = memchr(p, '"', *line + n - p)) != NULL; p++) {
+            quoted = !quoted;
+        }
+        len += n;
+    } while (quoted);
+
+    while (len > 0 && ((*record)[len - 1] == '\n' || (*record)[len - 1] == '\r')) {
+        (*record)[--len] = '\0';
+    }
+    return len;
+}
+
+static esp_err_t import_csv(nvs_import_t* imp, FILE* f) {
+    char* record = NULL;
+    size_t record_size = 0;
+    char* line = NULL;
+    size_t line_size = 0;
+    esp_err_t err = ESP_OK;
+    ssize_t len;
+
+    while ((len = read_csv_record(f, &record, &record_size, &line, &line_size)) >= 0) {
+        imp->record++;
+        if (len == 0) {
+            continue;
+        }
+
+        char* fields[4] = {NULL};
+        const size_t count = split_csv(record, fields, 4);
+        if (imp->record == 1 && strcmp(fields[0], "key") == 0) {
+            continue; // header
+        }
+
+        if (count >= 2 && strcmp(fields[1], "namespace") == 0) {
+            err = import_namespace(imp, fields[0]);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Namespace '%s': %s", fields[0], esp_err_to_name(err));
+                break;
+            }
+            continue;
+        }
+
+        const nvs_type_t type = count == 4 && strcmp(fields[1], "data") == 0 ? csv_to_type(fields[2]) : NVS_TYPE_ANY;
+        esp_err_t rec_err = ESP_ERR_NVS_TYPE_MISMATCH;
+        if (type != NVS_TYPE_ANY) {
+            if (!imp->open) {
+                err = import_namespace(imp, current_namespace);
+                if (err != ESP_OK) {
+                    break;
+                }
+            }
+            rec_err = set_from_str(imp->nvs, fields[0], type, fields[3]);
+        }
+        if (rec_err == ESP_OK) {
+            const size_t value_len = strlen(fields[3]);
+            err = import_written(imp, type == NVS_TYPE_STR    ? value_len
+                                      : type == NVS_TYPE_BLOB ? value_len / 2
+                                                              : type_int_size(type));
+        } else if (import_record_failed(imp, fields[0], rec_err)) {
+            err = rec_err;
+        }
+        if (err != ESP_OK) {
+            break;
+        }
+    }
+
+    free(record);
+    free(line);
+    return err;
+}
+
+static esp_err_t import_bin(nvs_import_t* imp, FILE* f) {
+    char* value = NULL;
+    size_t value_size = 0;
+    esp_err_t err = ESP_OK;
+    uint8_t header[2];
+
+    while (err == ESP_OK && fread(header, 1, 2, f) == 2) {
+        imp->record++;
+        const nvs_type_t type = (nvs_type_t)header[0];
+        char key[256];
+        if (fread(key, 1, header[1], f) != header[1]) {
+            err = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        key[header[1]] = '\0';
+
+        if (header[0] == NVS_BIN_NAMESPACE) {
+            err = import_namespace(imp, key);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Namespace '%s': %s", key, esp_err_to_name(err));
+            }
+            continue;
+        }
+        if (!imp->open && (err = import_namespace(imp, current_namespace)) != ESP_OK) {
+            break;
+        }
+
+        esp_err_t rec_err;
+        size_t len;
+        if (type == NVS_TYPE_STR || type == NVS_TYPE_BLOB) {
+            uint8_t size[4];
+            if (fread(size, 1, 4, f) != 4) {
+                err = ESP_ERR_INVALID_SIZE;
+                break;
+            }
+            len = size[0] | (size[1] << 8) | (size[2] << 16) | ((size_t)size[3] << 24);
+            if ((err = scratch_reserve(&value, &value_size, len + 1)) != ESP_OK) {
+                break;
+            }
+            if (fread(value, 1, len, f) != len) {
+                err = ESP_ERR_INVALID_SIZE;
+                break;
+            }
+            if (type == NVS_TYPE_STR) {
+                value[len] = '\0';
+                rec_err = nvs_set_str(imp->nvs, key, value);
+            } else {
+                rec_err = nvs_set_blob(imp->nvs, key, value, len);
+            }
+        } else if (type_is_int(type) && type_int_size(type) <= 8) {
+            uint8_t bytes[8];
+            len = type_int_size(type);
+            if (fread(bytes, 1, len, f) != len) {
+                err = ESP_ERR_INVALID_SIZE;
+                break;
+            }
+            uint64_t bits = 0;
+            for (size_t i = 0; i < len; i++) {
+                bits |= (uint64_t)bytes[i] << (8 * i);
+            }
+            rec_err = set_int(imp->nvs, key, type, bits);
+        } else {
+            // lungimea valorii nu se cunoaste, restul fisierului nu mai poate fi citit
+            err = ESP_ERR_NVS_TYPE_MISMATCH;
+            break;
+        }
+
+        if (rec_err == ESP_OK) {
+            err = import_written(imp, len);
+        } else if (import_record_failed(imp, key, rec_err)) {
+            err = rec_err;
+        }
+    }
+
+    if (err == ESP_OK && ferror(f)) {
+        err = ESP_FAIL;
+    }
+    if (err == ESP_ERR_INVALID_SIZE) {
+        ESP_LOGE(TAG, "Record %u is truncated", (unsigned)imp->record);
+    }
+    free(value);
+    return err;
+}
+
+/* Relative paths are taken from the root of the filesystem. */
+static void resolve_path(const char* file, char* path, size_t size) {
+    if (file[0] == '/') {
+        strlcpy(path, file, size);
+    } else {
+        snprintf(path, size, "%s/%s", MOUNT_PATH, file);
+    }
+}
+
+static void print_throughput(const char* what, size_t keys, size_t bytes, int64_t elapsed_us) {
+    if (elapsed_us <= 0) {
+        elapsed_us = 1;
+    }
+    printf("%s %u keys (%u bytes) in %" PRId64 ".%03" PRId64 " ms: %" PRIu64 " keys/s, %" PRIu64 " KiB/s\n",
+        what, (unsigned)keys, (unsigned)bytes, elapsed_us / 1000, elapsed_us % 1000,
+        (uint64_t)keys * 1000000 / elapsed_us, (uint64_t)bytes * 1000000 / 1024 / elapsed_us);
+}
+
 static int set_value(int argc, char** argv) {
     int nerrors = arg_parse(argc, argv, (void**)&set_args);
     if (nerrors != 0) {
@@ -502,6 +1183,193 @@ static int list_entries(int argc, char** argv) {
     return list(part, name, type);
 }
 
+static int export_entries(int argc, char** argv) {
+    export_args.partition->sval[0] = NVS_DEFAULT_PART_NAME;
+    export_args.namespace->sval[0] = "";
+
+    int nerrors = arg_parse(argc, argv, (void**)&export_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, export_args.end, argv[0]);
+        return 1;
+    }
+
+    const char* part = export_args.partition->sval[0];
+    const char* name = export_args.namespace->sval[0];
+    char path[128];
+    resolve_path(export_args.file->sval[0], path, sizeof(path));
+
+    char(*names)[NVS_NS_NAME_MAX_SIZE] = NULL;
+    size_t count = 0;
+    esp_err_t err = collect_namespaces(part, name[0] != '\0' ? name : NULL, &names, &count);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS error: %s", esp_err_to_name(err));
+        return 1;
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Cannot create '%s'", path);
+        free(names);
+        return 1;
+    }
+    setvbuf(f, NULL, _IOFBF, NVS_FILE_BUF_SIZE);
+
+    nvs_export_t exp = {.file = f, .binary = export_args.binary->count > 0};
+    const int64_t start = now_us();
+
+    if (exp.binary) {
+        const uint8_t version = NVS_BIN_VERSION;
+        if (fwrite(NVS_BIN_MAGIC, 1, 4, f) != 4 || fwrite(&version, 1, 1, f) != 1) {
+            err = ESP_FAIL;
+        }
+    } else if (fputs("key,type,encoding,value\n", f) < 0) {
+        err = ESP_FAIL;
+    }
+    for (size_t i = 0; i < count && err == ESP_OK; i++) {
+        err = export_namespace(&exp, part, names[i]);
+    }
+
+    if (fclose(f) != 0 && err == ESP_OK) {
+        err = ESP_FAIL;
+    }
+    free(exp.scratch);
+    free(names);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Export to '%s' failed: %s", path, esp_err_to_name(err));
+        return 1;
+    }
+
+    printf("'%s': %u namespaces, ", path, (unsigned)count);
+    print_throughput("exported", exp.keys, exp.bytes, now_us() - start);
+    return 0;
+}
+
+static int import_entries(int argc, char** argv) {
+    import_args.partition->sval[0] = NVS_DEFAULT_PART_NAME;
+
+    int nerrors = arg_parse(argc, argv, (void**)&import_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, import_args.end, argv[0]);
+        return 1;
+    }
+
+    char path[128];
+    resolve_path(import_args.file->sval[0], path, sizeof(path));
+
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Cannot open '%s'", path);
+        return 1;
+    }
+    setvbuf(f, NULL, _IOFBF, NVS_FILE_BUF_SIZE);
+
+    nvs_import_t imp = {.part = import_args.partition->sval[0]};
+    const int64_t start = now_us();
+    esp_err_t err;
+
+    // formatul se recunoaste dupa primii octeti
+    char magic[5] = {0};
+    if (fread(magic, 1, 5, f) == 5 && memcmp(magic, NVS_BIN_MAGIC, 4) == 0) {
+        err = magic[4] == NVS_BIN_VERSION ? import_bin(&imp, f) : ESP_ERR_NOT_SUPPORTED;
+    } else {
+        rewind(f);
+        err = import_csv(&imp, f);
+    }
+
+    esp_err_t close_err = import_close(&imp);
+    if (err == ESP_OK) {
+        err = close_err;
+    }
+    fclose(f);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Import from '%s' stopped: %s", path, esp_err_to_name(err));
+    }
+    print_throughput("imported", imp.keys, imp.bytes, now_us() - start);
+    if (imp.errors > 0) {
+        printf("%u records skipped\n", (unsigned)imp.errors);
+    }
+
+    return (err != ESP_OK || imp.errors > 0) ? 1 : 0;
+}
+
+static int stats_entries(int argc, char** argv) {
+    stats_args.partition->sval[0] = NVS_DEFAULT_PART_NAME;
+
+    int nerrors = arg_parse(argc, argv, (void**)&stats_args);
+    if (nerrors != 0) {
+        arg_print_errors(stderr, stats_args.end, argv[0]);
+        return 1;
+    }
+
+    const char* part = stats_args.partition->sval[0];
+
+    nvs_stats_t stats;
+    esp_err_t err = nvs_get_stats(part, &stats);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS error: %s", esp_err_to_name(err));
+        return 1;
+    }
+
+    char(*names)[NVS_NS_NAME_MAX_SIZE] = NULL;
+    size_t count = 0;
+    err = collect_namespaces(part, NULL, &names, &count);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS error: %s", esp_err_to_name(err));
+        return 1;
+    }
+
+    out_buf_t out = {.len = 0};
+    out_printf(&out, "Partition '%s': %u/%u entries used (%u%%), %u free, %u available, %u namespaces\n", part,
+        (unsigned)stats.used_entries, (unsigned)stats.total_entries,
+        (unsigned)(stats.total_entries ? 100 * stats.used_entries / stats.total_entries : 0),
+        (unsigned)stats.free_entries, (unsigned)stats.available_entries, (unsigned)stats.namespace_count);
+    out_printf(&out, "%-16s %6s %8s %10s %10s\n", "namespace", "keys", "entries", "flash", "data");
+
+    for (size_t i = 0; i < count; i++) {
+        nvs_handle_t nvs;
+        size_t used = 0;
+        size_t keys = 0;
+        size_t bytes = 0;
+
+        if (nvs_open_from_partition(part, names[i], NVS_READONLY, &nvs) != ESP_OK) {
+            continue;
+        }
+        nvs_get_used_entry_count(nvs, &used);
+
+        nvs_iterator_t it = NULL;
+        esp_err_t result = nvs_entry_find(part, names[i], NVS_TYPE_ANY, &it);
+        while (result == ESP_OK) {
+            nvs_entry_info_t info;
+            nvs_entry_info(it, &info);
+
+            size_t len = 0;
+            if (info.type == NVS_TYPE_STR) {
+                nvs_get_str(nvs, info.key, NULL, &len);
+            } else if (info.type == NVS_TYPE_BLOB) {
+                nvs_get_blob(nvs, info.key, NULL, &len);
+            } else {
+                len = type_int_size(info.type);
+            }
+            bytes += len;
+            keys++;
+
+            result = nvs_entry_next(&it);
+        }
+        nvs_release_iterator(it);
+        nvs_close(nvs);
+
+        // o intrare NVS ocupa 32 de octeti in flash
+        out_printf(&out, "%-16s %6u %8u %10u %10u\n", names[i], (unsigned)keys, (unsigned)used,
+            (unsigned)(used * 32), (unsigned)bytes);
+    }
+    out_flush(&out);
+    free(names);
+
+    return 0;
+}
+
 void register_nvs(void) {
     set_args.key = arg_str1(NULL, NULL, "<key>", "key of the value to be set");
     set_args.type = arg_str1(NULL, NULL, "<type>", ARG_TYPE_STR);
@@ -528,6 +1396,19 @@ void register_nvs(void) {
     list_args.type = arg_str0("t", "type", "<type>", ARG_TYPE_STR);
     list_args.end = arg_end(2);
 
+    export_args.file = arg_str1(NULL, NULL, "<file>", "file to write, relative to " MOUNT_PATH);
+    export_args.partition = arg_str0("p", "partition", "<partition>", "partition name, default " NVS_DEFAULT_PART_NAME);
+    export_args.namespace = arg_str0("n", "namespace", "<namespace>", "export only this namespace");
+    export_args.binary = arg_lit0("b", "binary", "compact binary image instead of CSV");
+    export_args.end = arg_end(2);
+
+    import_args.file = arg_str1(NULL, NULL, "<file>", "CSV or binary image, relative to " MOUNT_PATH);
+    import_args.partition = arg_str0("p", "partition", "<partition>", "partition name, default " NVS_DEFAULT_PART_NAME);
+    import_args.end = arg_end(2);
+
+    stats_args.partition = arg_str0(NULL, NULL, "<partition>", "partition name, default " NVS_DEFAULT_PART_NAME);
+    stats_args.end = arg_end(2);
+
     const esp_console_cmd_t set_cmd = {.command = "nvs_set",
         .help = "Set key-value pair in selected namespace.\n"
                 "Examples:\n"
@@ -564,24 +1445,52 @@ void register_nvs(void) {
         .argtable = &namespace_args};
 
     const esp_console_cmd_t list_entries_cmd = {.command = "nvs_list",
-        .help = "List stored key-value pairs stored in NVS."
+        .help = "List key-value pairs stored in NVS. "
                 "Namespace and type can be specified to print only those key-value pairs.\n"
                 "Following command list variables stored inside 'nvs' partition, under namespace "
-                "'storage' with type uint32_t"
+                "'storage' with type uint32_t\n"
                 "Example: nvs_list nvs -n storage -t u32 \n",
         .hint = NULL,
         .func = &list_entries,
         .argtable = &list_args};
 
+    const esp_console_cmd_t export_cmd = {.command = "nvs_export",
+        .help = "Export the keys of a partition to a file, as a CSV readable by nvs_partition_gen.py "
+                "or as a compact binary image.\n"
+                "Examples:\n"
+                " nvs_export backup.csv \n"
+                " nvs_export storage.bin -n storage -b \n",
+        .hint = NULL,
+        .func = &export_entries,
+        .argtable = &export_args};
+
+    const esp_console_cmd_t import_cmd = {.command = "nvs_import",
+        .help = "Import the keys of a file written by nvs_export (CSV or binary). "
+                "Keys are committed in batches, one handle open per namespace.\n"
+                "Example: nvs_import backup.csv \n",
+        .hint = NULL,
+        .func = &import_entries,
+        .argtable = &import_args};
+
+    const esp_console_cmd_t stats_cmd = {.command = "nvs_stats",
+        .help = "Show entry usage of a partition and keys/entries/bytes of each namespace.\n"
+                "Example: nvs_stats nvs \n",
+        .hint = NULL,
+        .func = &stats_entries,
+        .argtable = &stats_args};
+
     ESP_ERROR_CHECK(esp_console_cmd_register(&set_cmd));
     ESP_ERROR_CHECK(esp_console_cmd_register(&get_cmd));
     ESP_ERROR_CHECK(esp_console_cmd_register(&erase_cmd));
     ESP_ERROR_CHECK(esp_console_cmd_register(&namespace_cmd));
     ESP_ERROR_CHECK(esp_console_cmd_register(&list_entries_cmd));
     ESP_ERROR_CHECK(esp_console_cmd_register(&erase_namespace_cmd));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&export_cmd));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&import_cmd));
+    ESP_ERROR_CHECK(esp_console_cmd_register(&stats_cmd));
     ESP_LOGI(TAG, "nvs commands registered!");
 }
 
 void cli_register_nsv_command(void) {
     register_nvs();
-}
\ No newline at end of file
+}
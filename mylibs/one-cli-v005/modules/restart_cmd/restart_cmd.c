@@ -9,6 +9,7 @@
 #include "esp_chip_info.h"
 #include "esp_flash.h"
 #include "argtable3/argtable3.h"
+#include "cfgstore.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "sdkconfig.h"
@@ -18,6 +19,7 @@ static const char *TAG = "CLI";
 static int restart(int argc, char **argv)
 {
     ESP_LOGI(TAG, "Restarting");
+    cfgstore_flush(); // setarile inca in asteptare
     esp_restart();
 }
 
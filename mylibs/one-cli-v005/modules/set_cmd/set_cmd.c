@@ -31,19 +31,12 @@ typedef struct {
 } info_command_entry_t;
 
 void set_log_cmd(int argc, char** argv) {
-    if (argc <= 2 || argc < 4) {
-        printf("Usage: set log <tag> <level>\n");
-        return;
-    }
-    // argv[0] = "set"
-    // argv[1] = "log"
-    // argv[2] = <tag>
-    // argv[3] = <level>
-    log_level(argc - 2, &argv[2]);
+    // argv[0] = "set", argv[1] = "log": "log" devine argv[0] pentru argtable
+    log_level(argc - 1, &argv[1]);
 }
 
 static const info_command_entry_t set_cmds[] = {
-    {"log", set_log_cmd, "💥 Set log level for all tags or a specific tag."},
+    {"log", set_log_cmd, "💥 Set log level (and rate) for all tags or a specific tag."},
 };
 
 void printSetCommandList() {
@@ -71,6 +64,13 @@ static void generate_set_cmds_help_text(void) {
 }
 
 static int set_command(int argc, char** argv) {
+    // Subcomenzile isi parseaza singure argumentele (set_args nu le cunoaste)
+    for (size_t i = 0; argc > 1 && i < INFO_SET_COUNT; i++) {
+        if (strcmp(argv[1], set_cmds[i].name) == 0) {
+            set_cmds[i].function(argc, argv);
+            return 0;
+        }
+    }
     int nerrors = arg_parse(argc, argv, (void**)&set_args);
     // Dacă nu are niciun argument sau a cerut help global
     if (argc == 1 || set_args.help->count > 0) {
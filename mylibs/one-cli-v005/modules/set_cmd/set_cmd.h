@@ -10,6 +10,8 @@ extern "C" {
 #endif /* #ifdef __cplusplus */
 
 void cli_register_set_command(void);
+/* Applies the log levels saved by "set log" (cfgstore). */
+void cli_restore_log_levels(void);
 
 
 #ifdef __cplusplus
@@ -1,20 +1,28 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stdbool.h>
 #include <inttypes.h>
 #include "esp_log.h"
 #include "esp_console.h"
 #include "argtable3/argtable3.h"
+#include "cfgstore.h"
+#include "logctl.h"
+#include "set_cmd.h"
 #include "set_log.h"
 
 static const char *TAG = "Set Log Command";
 
-/** log_level command changes log level via esp_log_level_set */
+/** log_level command changes log level via esp_log_level_set (logctl for its tags) */
 static struct {
     struct arg_str *tag;
     struct arg_str *level;
+    struct arg_int *rate;
+    struct arg_int *burst;
+    struct arg_lit *help;
     struct arg_end *end;
 } log_level_args;
 
@@ -27,21 +35,134 @@ static const char* s_log_level_names[] = {
     "verbose"
 };
 
+static void log_level_args_init(void)
+{
+    log_level_args.tag   = arg_str0(NULL, NULL, "<tag>", "tag, or * for all");
+    log_level_args.level = arg_str0(NULL, NULL, "<level>", "none|error|warn|info|debug|verbose");
+    log_level_args.rate  = arg_int0("r", "rate", "<n>", "at most n messages/s for the tag, 0 = no limit (tags of logctl_tags.h)");
+    log_level_args.burst = arg_int0("b", "burst", "<n>", "messages let through at once (default: rate)");
+    log_level_args.help  = arg_lit0("h", "help", "show this help");
+    log_level_args.end   = arg_end(3);
+}
+
+/* The level of "*" has its own key, the other tags are kept in CFG_LOG_TAGS as
+ * "tag=level;tag=level:rate/burst" (rate and burst only for the logctl tags). */
+static void log_level_save(const char *tag, esp_log_level_t level, int rate, int burst)
+{
+    esp_err_t err;
+    if (strcmp(tag, "*") == 0) {
+        // "*" resets the single tags too, like esp_log_level_set("*")
+        err = cfgstore_set_u32(CFG_LOG_LEVEL, level);
+        if (err == ESP_OK) {
+            err = cfgstore_set_str(CFG_LOG_TAGS, "");
+        }
+    } else {
+        char tags[128];
+        char updated[128];
+        size_t len = 0;
+        cfgstore_get_str(CFG_LOG_TAGS, tags, sizeof(tags));
+        // se pastreaza celelalte tag-uri, tag-ul curent se muta la final
+        for (char *save = NULL, *entry = strtok_r(tags, ";", &save); entry; entry = strtok_r(NULL, ";", &save)) {
+            const char *eq = strchr(entry, '=');
+            const bool same_tag = eq != NULL && (size_t)(eq - entry) == strlen(tag) && memcmp(entry, tag, eq - entry) == 0;
+            if (!same_tag && len < sizeof(updated)) {
+                len += snprintf(updated + len, sizeof(updated) - len, "%s;", entry);
+            }
+        }
+        if (len < sizeof(updated) && rate >= 0) {
+            len += snprintf(updated + len, sizeof(updated) - len, "%s=%d:%d/%d", tag, (int)level, rate, burst);
+        } else if (len < sizeof(updated)) {
+            len += snprintf(updated + len, sizeof(updated) - len, "%s=%d", tag, (int)level);
+        }
+        err = len < sizeof(updated) ? cfgstore_set_str(CFG_LOG_TAGS, updated) : ESP_ERR_INVALID_SIZE;
+    }
+    if (err != ESP_OK) {
+        printf("Log level of '%s' not saved: %s\n", tag, esp_err_to_name(err));
+    }
+}
+
+/* One tag: logctl if it's one of its tags (the esp_log level follows), esp_log otherwise. */
+static void log_level_apply(const char *tag, esp_log_level_t level, int rate, int burst)
+{
+    const int id = logctl_find(tag);
+    if (strcmp(tag, "*") == 0) {
+        logctl_set_all(level);
+    } else if (id >= 0) {
+        logctl_set_level((logctl_tag_t)id, level);
+        if (rate >= 0) {
+            logctl_set_rate((logctl_tag_t)id, (uint16_t)rate, (uint16_t)burst);
+        }
+    } else {
+        esp_log_level_set(tag, level);
+    }
+}
+
+void cli_restore_log_levels(void)
+{
+    char tags[128];
+    logctl_set_all((esp_log_level_t)cfgstore_get_u32(CFG_LOG_LEVEL));
+    cfgstore_get_str(CFG_LOG_TAGS, tags, sizeof(tags));
+    for (char *save = NULL, *entry = strtok_r(tags, ";", &save); entry; entry = strtok_r(NULL, ";", &save)) {
+        char *eq = strchr(entry, '=');
+        if (eq != NULL) {
+            int rate = -1;  // not saved: the default of logctl_tags.h
+            int burst = 0;
+            *eq = '\0';
+            const char *limit = strchr(eq + 1, ':');
+            if (limit != NULL) {
+                sscanf(limit + 1, "%d/%d", &rate, &burst);
+            }
+            log_level_apply(entry, (esp_log_level_t)atoi(eq + 1), rate, burst);
+        }
+    }
+}
+
+static void log_level_list(void)
+{
+    printf("%-12s %-8s %6s %6s %10s %10s\n", "tag", "level", "rate/s", "burst", "passed", "suppressed");
+    for (int i = 0; i < LOGCTL_TAG_COUNT; i++) {
+        logctl_info_t info;
+        logctl_get_info((logctl_tag_t)i, &info);
+        printf("%-12s %-8s ", logctl_tag_names[i], s_log_level_names[info.level]);
+        if (info.rate > 0) {
+            printf("%6u %6u %10" PRIu32 " %10" PRIu32 "\n", info.rate, info.burst, info.passed, info.suppressed);
+        } else {
+            printf("%6s %6s %10s %10s\n", "-", "-", "-", "-");
+        }
+    }
+    printf("Other tags: esp_log levels, set with 'set log <tag> <level>'.\n");
+}
+
 int log_level(int argc, char **argv)
 {
+    if (log_level_args.end == NULL) {
+        log_level_args_init();
+    }
     int nerrors = arg_parse(argc, argv, (void **) &log_level_args);
+    if (log_level_args.help->count > 0) {
+        printf("Usage: set log");
+        arg_print_syntax(stdout, (void **) &log_level_args, "\n");
+        arg_print_glossary(stdout, (void **) &log_level_args, "  %-22s %s\n");
+        return 0;
+    }
     if (nerrors != 0) {
-        arg_print_errors(stderr, log_level_args.end, argv[0]);
+        arg_print_errors(stderr, log_level_args.end, "set log");
+        return 1;
+    }
+    if (log_level_args.tag->count == 0) {
+        log_level_list();
+        return 0;
+    }
+    if (log_level_args.level->count == 0) {
+        printf("Usage: set log <tag> <level> [-r <n>/s] [-b <n>]\n");
         return 1;
     }
-    assert(log_level_args.tag->count == 1);
-    assert(log_level_args.level->count == 1);
     const char* tag = log_level_args.tag->sval[0];
     const char* level_str = log_level_args.level->sval[0];
     esp_log_level_t level;
     size_t level_len = strlen(level_str);
     for (level = ESP_LOG_NONE; level <= ESP_LOG_VERBOSE; level++) {
-        if (memcmp(level_str, s_log_level_names[level], level_len) == 0) {
+        if (level_len > 0 && strncmp(level_str, s_log_level_names[level], level_len) == 0) {
             break;
         }
     }
@@ -55,6 +176,28 @@ int log_level(int argc, char **argv)
                s_log_level_names[level], s_log_level_names[CONFIG_LOG_MAXIMUM_LEVEL]);
         return 1;
     }
-    esp_log_level_set(tag, level);
+
+    int rate = -1;
+    int burst = 0;
+    if (log_level_args.rate->count > 0) {
+        rate = log_level_args.rate->ival[0];
+        burst = log_level_args.burst->count > 0 ? log_level_args.burst->ival[0] : 0;
+        if (logctl_find(tag) < 0) {
+            printf("Rate limiting only for the logctl tags (logctl_tags.h), see 'set log'.\n");
+            return 1;
+        }
+        if (rate < 0 || rate > UINT16_MAX || burst < 0 || burst > UINT16_MAX) {
+            printf("Rate and burst: 0..%u\n", UINT16_MAX);
+            return 1;
+        }
+    }
+    log_level_apply(tag, level, rate, burst);
+    if (rate < 0 && logctl_find(tag) >= 0) {
+        logctl_info_t info;  // the limit in force is saved along
+        logctl_get_info((logctl_tag_t)logctl_find(tag), &info);
+        rate = info.rate;
+        burst = info.burst;
+    }
+    log_level_save(tag, level, rate, burst);
     return 0;
-}
\ No newline at end of file
+}
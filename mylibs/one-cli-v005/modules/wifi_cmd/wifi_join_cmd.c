@@ -20,78 +20,17 @@
 #include "esp_log.h"
 #include "esp_console.h"
 #include "argtable3/argtable3.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/event_groups.h"
-#include "esp_wifi.h"
-#include "esp_netif.h"
-#include "esp_event.h"
+#include "cfgstore.h"
+#include "wifimgr.h"
 
 
 
 static const char *TAG = "CLI";
 
-#define JOIN_TIMEOUT_MS (10000)
-
-static EventGroupHandle_t wifi_event_group;
-const int CONNECTED_BIT = BIT0;
-
-
-static void event_handler(void* arg, esp_event_base_t event_base,
-                                int32_t event_id, void* event_data)
-{
-    if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
-        esp_wifi_connect();
-        xEventGroupClearBits(wifi_event_group, CONNECTED_BIT);
-    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
-        xEventGroupSetBits(wifi_event_group, CONNECTED_BIT);
-    }
-}
-
-static void initialise_wifi(void)
-{
-    esp_log_level_set("wifi", ESP_LOG_WARN);
-    static bool initialized = false;
-    if (initialized) {
-        return;
-    }
-    ESP_ERROR_CHECK(esp_netif_init());
-    wifi_event_group = xEventGroupCreate();
-    ESP_ERROR_CHECK(esp_event_loop_create_default());
-    esp_netif_t *ap_netif = esp_netif_create_default_wifi_ap();
-    assert(ap_netif);
-    esp_netif_t *sta_netif = esp_netif_create_default_wifi_sta();
-    assert(sta_netif);
-    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
-    ESP_ERROR_CHECK( esp_wifi_init(&cfg) );
-    ESP_ERROR_CHECK( esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, &event_handler, NULL) );
-    ESP_ERROR_CHECK( esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP, &event_handler, NULL) );
-    ESP_ERROR_CHECK( esp_wifi_set_storage(WIFI_STORAGE_RAM) );
-    ESP_ERROR_CHECK( esp_wifi_set_mode(WIFI_MODE_NULL) );
-    ESP_ERROR_CHECK( esp_wifi_start() );
-    initialized = true;
-}
-
-static bool wifi_join(const char *ssid, const char *pass, int timeout_ms)
-{
-    initialise_wifi();
-    wifi_config_t wifi_config = { 0 };
-    strlcpy((char *) wifi_config.sta.ssid, ssid, sizeof(wifi_config.sta.ssid));
-    if (pass) {
-        strlcpy((char *) wifi_config.sta.password, pass, sizeof(wifi_config.sta.password));
-    }
-
-    ESP_ERROR_CHECK( esp_wifi_set_mode(WIFI_MODE_STA) );
-    ESP_ERROR_CHECK( esp_wifi_set_config(WIFI_IF_STA, &wifi_config) );
-    esp_wifi_connect();
-
-    int bits = xEventGroupWaitBits(wifi_event_group, CONNECTED_BIT,
-                                   pdFALSE, pdTRUE, timeout_ms / portTICK_PERIOD_MS);
-    return (bits & CONNECTED_BIT) != 0;
-}
-
 /** Arguments used by 'join' function */
 static struct {
     struct arg_int *timeout;
+    struct arg_int *prio;
     struct arg_str *ssid;
     struct arg_str *password;
     struct arg_end *end;
@@ -104,41 +43,118 @@ static int connect(int argc, char **argv)
         arg_print_errors(stderr, join_args.end, argv[0]);
         return 1;
     }
-    ESP_LOGI(__func__, "Connecting to '%s'",
-             join_args.ssid->sval[0]);
+
+    /* without arguments, the last network joined (cfgstore) */
+    char ssid[33];
+    char pass[65];
+    if (join_args.ssid->count > 0) {
+        strlcpy(ssid, join_args.ssid->sval[0], sizeof(ssid));
+        strlcpy(pass, join_args.password->count > 0 ? join_args.password->sval[0] : "", sizeof(pass));
+    } else {
+        cfgstore_get_str(CFG_WIFI_SSID, ssid, sizeof(ssid));
+        cfgstore_get_str(CFG_WIFI_PASS, pass, sizeof(pass));
+        if (ssid[0] == '\0') {
+            printf("No saved network, usage: join <ssid> [<pass>]\n");
+            return 1;
+        }
+    }
+    ESP_LOGI(__func__, "Connecting to '%s'", ssid);
 
     /* set default value*/
     if (join_args.timeout->count == 0) {
-        join_args.timeout->ival[0] = JOIN_TIMEOUT_MS;
+        join_args.timeout->ival[0] = (int) cfgstore_get_u32(CFG_WIFI_TIMEOUT_MS);
     }
 
-    bool connected = wifi_join(join_args.ssid->sval[0],
-                               join_args.password->sval[0],
-                               join_args.timeout->ival[0]);
-    if (!connected) {
-        ESP_LOGW(__func__, "Connection timed out");
+    /* the manager owns the connection; a new network gets the top priority */
+    esp_err_t err = wifimgr_init(NULL);
+    if (err == ESP_OK) {
+        err = wifimgr_add_ap(ssid, pass, join_args.prio->count > 0 ? join_args.prio->ival[0] : WIFIMGR_PRIORITY_TOP);
+    }
+    if (err != ESP_OK) {
+        printf("Failed: %s\n", esp_err_to_name(err));
+        return 1;
+    }
+    wifimgr_status_t st;
+    wifimgr_get_status(&st);
+    if (st.connected && strcmp(st.link.ssid, ssid) != 0) {
+        wifimgr_reconnect();
+    } else {
+        wifimgr_start();
+    }
+
+    if (!wifimgr_wait_connected(join_args.timeout->ival[0])) {
+        ESP_LOGW(__func__, "Connection timed out, still trying in background");
         return 1;
     }
     ESP_LOGI(__func__, "Connected");
+
+    cfgstore_set_str(CFG_WIFI_SSID, ssid);
+    cfgstore_set_str(CFG_WIFI_PASS, pass);
+    return 0;
+}
+
+static void print_phase(const char *name, const wifimgr_phase_t *p)
+{
+    printf("  %-8s %6lu %8lu %8lu %8lu\n", name, (unsigned long) p->count, (unsigned long) p->last_ms,
+           (unsigned long) (p->count ? p->total_ms / p->count : 0), (unsigned long) p->max_ms);
+}
+
+static int wifi_status(int argc, char **argv)
+{
+    wifimgr_status_t st;
+    wifimgr_get_status(&st);
+    printf("State: %s\n", wifimgr_state_name(st.state));
+    if (st.link.ssid[0] != '\0') {
+        const uint8_t *b = st.link.bssid;
+        const uint8_t *ip = (const uint8_t *) &st.link.lease.ip;  // network order
+        printf("%s '%s' %02x:%02x:%02x:%02x:%02x:%02x ch %u ip %u.%u.%u.%u\n",
+               st.connected ? "Connected to" : "Last network", st.link.ssid,
+               b[0], b[1], b[2], b[3], b[4], b[5], st.link.channel, ip[0], ip[1], ip[2], ip[3]);
+    }
+
+    wifimgr_ap_t aps[WIFIMGR_MAX_APS];
+    size_t n = wifimgr_get_aps(aps, WIFIMGR_MAX_APS);
+    for (size_t i = 0; i < n; i++) {
+        printf("  [%3u] %s\n", aps[i].priority, aps[i].ssid);
+    }
+
+    const wifimgr_metrics_t *m = &st.metrics;
+    printf("Timings (ms)  count     last      avg      max\n");
+    print_phase("scan", &m->scan);
+    print_phase("assoc", &m->assoc);
+    print_phase("ip", &m->dhcp);
+    print_phase("connect", &m->connect);
+    printf("First connection %lu ms, fast path %lu/%lu, lease reused %lu, failures %lu, link lost %lu\n",
+           (unsigned long) m->first_connect_ms, (unsigned long) m->fast_ok, (unsigned long) m->fast_attempts,
+           (unsigned long) m->lease_reused, (unsigned long) m->failures, (unsigned long) m->disconnects);
     return 0;
 }
 
 void register_wifi_join(void)
 {
     join_args.timeout = arg_int0(NULL, "timeout", "<t>", "Connection timeout, ms");
-    join_args.ssid = arg_str1(NULL, NULL, "<ssid>", "SSID of AP");
+    join_args.prio = arg_int0(NULL, "prio", "<0-255>", "Priority among the known networks, highest if omitted");
+    join_args.ssid = arg_str0(NULL, NULL, "<ssid>", "SSID of AP, the saved one if omitted");
     join_args.password = arg_str0(NULL, NULL, "<pass>", "PSK of AP");
     join_args.end = arg_end(2);
 
     const esp_console_cmd_t join_cmd = {
         .command = "join",
-        .help = "Join WiFi AP as a station",
+        .help = "Join WiFi AP as a station, the network is saved once connected",
         .hint = NULL,
         .func = &connect,
         .argtable = &join_args
     };
 
     ESP_ERROR_CHECK( esp_console_cmd_register(&join_cmd) );
+
+    const esp_console_cmd_t status_cmd = {
+        .command = "wifi_status",
+        .help = "WiFi connection state, known networks and connection timings",
+        .hint = NULL,
+        .func = &wifi_status,
+    };
+    ESP_ERROR_CHECK( esp_console_cmd_register(&status_cmd) );
     ESP_LOGI(TAG, "wifi commands registered (f) !");
 
 }
@@ -19,10 +19,12 @@ void cli_register_all_commands(void) {
     //// cli_register_tasks_info_command();
     cli_register_uptime_command();
     cli_register_info_command();
-    //// cli_register_nsv_command(); // TODO de implementat cum trebuie
+    cli_register_nsv_command();
     cli_register_WiFi_join_command();
     cli_register_set_command();
     cli_register_perfmon_command();
+    cli_register_gfx_command();
+    cli_register_binlog_command();
     return;
 }
 
@@ -103,6 +105,7 @@ void rtos_init_cli() {
     // esp_console_register_help_command();
     // register_system_common();
     // cli_register_custom_help_command(); // aici am modificat ultima pt tine alua sa vezi
+    cli_restore_log_levels();    // nivelurile salvate cu "set log"
     cli_register_all_commands(); // my command
     return;
 }
@@ -47,6 +47,7 @@ extern "C" {
 #define SYSMON_MONITOR_CORE        0
 
 #define SYSMON_MAX_TRACKED_TASKS        256
+#define SYSMON_MAX_EXTRA_JSON_ENDPOINTS 4      // slots for sysmon_register_json_endpoint()
 #define SYSMON_ZERO_THRESHOLD           0.0001f
 
 // Strong reference to the actual embedded symbols present in your build
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esp_err.h"
+#include "cJSON.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,6 +19,19 @@ esp_err_t sysmon_http_start(void);
  */
 void sysmon_http_stop(void);
 
+/**
+ * @brief Serve a JSON endpoint built by another component (e.g. render statistics).
+ *
+ * Can be called before or after sysmon_init(); the endpoint is added to the running
+ * server right away, or when the server starts. At most SYSMON_MAX_EXTRA_JSON_ENDPOINTS.
+ *
+ * @param uri         URI path, must stay valid (string literal).
+ * @param create_json Builder called for every request; the result is freed by sysmon.
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM if all slots are used,
+ *         or the error of httpd_register_uri_handler().
+ */
+esp_err_t sysmon_register_json_endpoint(const char *uri, cJSON *(*create_json)(void));
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,6 +45,16 @@
 // Logger tag for this module
 static const char *LOG_TAG = "sysmon";
 
+// Sampling loop messages: rate-limited per tag when logctl is part of the build
+#if SYSMON_USE_LOGCTL
+#include "logctl.h"
+#define SYSMON_LOOP_LOGI(format, ...) LOGCTL_LOGI(SYSMON, format, ##__VA_ARGS__)
+#define SYSMON_LOOP_LOGW(format, ...) LOGCTL_LOGW(SYSMON, format, ##__VA_ARGS__)
+#else
+#define SYSMON_LOOP_LOGI(format, ...) ESP_LOGI(LOG_TAG, format, ##__VA_ARGS__)
+#define SYSMON_LOOP_LOGW(format, ...) ESP_LOGW(LOG_TAG, format, ##__VA_ARGS__)
+#endif
+
 // Persistent module state (shared with sysmon_http.c)
 // Stores current task info, stats buffers, task handle, and ringbuffer pointers.
 SysMonState self = { 0 };
@@ -205,7 +215,7 @@ static int _find_or_create_task_index(const char *task_name)
             strncpy(self.tasks[j].task_name, task_name, sizeof(self.tasks[j].task_name) - 1);
             self.tasks[j].is_active = true;
             self.tasks[j].consecutive_zero_samples = 0;
-            ESP_LOGI(LOG_TAG, "Discovered new task: '%s'", task_name);
+            SYSMON_LOOP_LOGI("Discovered new task: '%s'", task_name);
             return j;
         }
     }
@@ -293,12 +303,12 @@ static void _process_deleted_tasks(const bool *tasks_seen)
             {
                 self.tasks[j].is_active = false;
                 self.tasks[j].consecutive_zero_samples = 0;
-                ESP_LOGI(LOG_TAG, "Task removed after %d consecutive zero samples: '%s'", 
+                SYSMON_LOOP_LOGI("Task removed after %d consecutive zero samples: '%s'", 
                          CONFIG_SYSMON_SAMPLE_COUNT, self.tasks[j].task_name);
             }
             else if (self.tasks[j].consecutive_zero_samples % 10 == 0)
             {
-                ESP_LOGI(LOG_TAG, "Task not detected; logging zero for inactivity (sample %d of %d): '%s'", 
+                SYSMON_LOOP_LOGI("Task not detected; logging zero for inactivity (sample %d of %d): '%s'", 
                          self.tasks[j].consecutive_zero_samples, CONFIG_SYSMON_SAMPLE_COUNT, 
                          self.tasks[j].task_name);
             }
@@ -476,7 +486,7 @@ static void sysmon_monitor(void *param)
         // Debug logging
         if (log_counter++ % 10 == 0)
         {
-            ESP_LOGI(LOG_TAG, "Sampling %u tasks", num_returned);
+            SYSMON_LOOP_LOGI("Sampling %u tasks", num_returned);
         }
         
         // Track which tasks were seen
@@ -499,7 +509,7 @@ static void sysmon_monitor(void *param)
             int idx = _find_or_create_task_index(t->pcTaskName);
             if (idx == -1)
             {
-                ESP_LOGW(LOG_TAG, "Task capacity exceeded, cannot track task '%s' (capacity: %d, num_tasks: %d). Will retry next sample.", 
+                SYSMON_LOOP_LOGW("Task capacity exceeded, cannot track task '%s' (capacity: %d, num_tasks: %d). Will retry next sample.", 
                          t->pcTaskName, self.task_capacity, uxTaskGetNumberOfTasks());
                 continue;
             }
@@ -21,6 +21,7 @@
  * Usage:
  *   - Call sysmon_http_start() to activate endpoints; sysmon_http_stop() to disable.
  *   - Endpoints: '/', '/tasks', '/history', '/telemetry', '/hardware'
+ *   - Other components add their own JSON endpoints with sysmon_register_json_endpoint().
  *  */
 
 // Project-specific includes
@@ -67,6 +68,10 @@ static const json_handler_config_t json_handler_configs[] =
     JSON_ENDPOINT_ENTRY("/hardware", _create_hardware_json)
 };
 
+// JSON endpoints registered at runtime by other components (sysmon_register_json_endpoint)
+static json_handler_config_t extra_json_handler_configs[SYSMON_MAX_EXTRA_JSON_ENDPOINTS];
+static size_t extra_json_handler_count = 0;
+
 /**
  * @brief Helper function to register a URI handler with error handling.
  *
@@ -134,9 +139,10 @@ esp_err_t sysmon_http_start(void)
     config.max_open_sockets = 12;
 
     // Set max URI handlers based on how many static files & APIs we'll serve
+    // (extra endpoints may be registered after start, so reserve all their slots)
     size_t static_file_count  = sizeof(static_file_configs) / sizeof(static_file_configs[0]);
     size_t json_handler_count = sizeof(json_handler_configs) / sizeof(json_handler_configs[0]);
-    config.max_uri_handlers   = static_file_count + json_handler_count;
+    config.max_uri_handlers   = static_file_count + json_handler_count + SYSMON_MAX_EXTRA_JSON_ENDPOINTS;
 
     // Warn if LWIP socket pool is too small for this server config
 #if CONFIG_LWIP_MAX_SOCKETS < 15
@@ -176,6 +182,62 @@ esp_err_t sysmon_http_start(void)
         }
     }
 
+    // Register the JSON endpoints added before the server was started
+    for (size_t i = 0; i < extra_json_handler_count; i++)
+    {
+        err = _register_handler(self.httpd, extra_json_handler_configs[i].uri, HTTP_GET,
+                                 http_handle_json_endpoint, (void *)&extra_json_handler_configs[i],
+                                 extra_json_handler_configs[i].uri);
+        if (err != ESP_OK)
+        {
+            return err;
+        }
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Add a JSON endpoint served by http_handle_json_endpoint().
+ *
+ * @note Not thread-safe against sysmon_http_start(); call it from the init code.
+ */
+esp_err_t sysmon_register_json_endpoint(const char *uri, cJSON *(*create_json)(void))
+{
+    if (uri == NULL || create_json == NULL)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (extra_json_handler_count >= SYSMON_MAX_EXTRA_JSON_ENDPOINTS)
+    {
+        ESP_LOGE(LOG_TAG, "No free slot for %s (SYSMON_MAX_EXTRA_JSON_ENDPOINTS = %d)",
+                 uri, SYSMON_MAX_EXTRA_JSON_ENDPOINTS);
+        return ESP_ERR_NO_MEM;
+    }
+
+    json_handler_config_t *config = &extra_json_handler_configs[extra_json_handler_count];
+    config->uri         = uri;
+    config->create_json = create_json;
+
+    if (self.httpd != NULL)
+    {
+        // Server already running: register now, a failure here leaves the server up
+        httpd_uri_t uri_config =
+        {
+            .uri      = uri,
+            .method   = HTTP_GET,
+            .handler  = http_handle_json_endpoint,
+            .user_ctx = (void *)config
+        };
+        esp_err_t err = httpd_register_uri_handler(self.httpd, &uri_config);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(LOG_TAG, "Failed to register %s handler: %s", uri, esp_err_to_name(err));
+            return err;
+        }
+    }
+
+    extra_json_handler_count++;
     return ESP_OK;
 }
 
@@ -314,6 +314,10 @@ async function initializeDashboard()
   // Keep updating charts, summary, and table
   setInterval(updateDashboard, CHART_TELEMETRY_UPDATE_INTERVAL_MS);
   setInterval(updateTable, CHART_TASK_TABLE_UPDATE_INTERVAL_MS);
+
+  // Render statistics, only if the firmware registered /gfx
+  updateGfxInfo();
+  setInterval(updateGfxInfo, CHART_TELEMETRY_UPDATE_INTERVAL_MS);
 }
 
 /**
@@ -3,7 +3,8 @@ const API_ROUTES = {
   HISTORY   : '/history',
   TELEMETRY : '/telemetry',
   TASKS     : '/tasks',
-  HARDWARE  : '/hardware'
+  HARDWARE  : '/hardware',
+  GFX       : '/gfx'
 };
 
 const TELEMETRY_TIMEOUT_MS = 4000;
@@ -988,3 +988,85 @@ function updateWifiInfo(wifiData)
     }
   }
 }
+
+/**
+ * Render statistics row labels, in the order of the /gfx histograms.
+ */
+const GFX_HIST_ROWS = [
+  { key: 'renderUs', label: 'Render', unit: 'ms', scale: 0.001 },
+  { key: 'flushUs',  label: 'Flush',  unit: 'ms', scale: 0.001 },
+  { key: 'waitUs',   label: 'Wait',   unit: 'ms', scale: 0.001 },
+  { key: 'frameUs',  label: 'Frame',  unit: 'ms', scale: 0.001 },
+  { key: 'areaPx',   label: 'Area',   unit: 'px', scale: 1 },
+  { key: 'fps',      label: 'FPS',    unit: '',   scale: 1 }
+];
+
+// Set to false after the first 404, firmware without gfxstats doesn't serve /gfx
+let gfxEndpointAvailable = true;
+
+/**
+ * Fetch the render statistics and update the Rendering panel.
+ *
+ * The panel stays hidden when the endpoint is not registered. Only the first display is shown.
+ *
+ * @function updateGfxInfo
+ * @returns {Promise<void>}
+ */
+async function updateGfxInfo()
+{
+  if (!gfxEndpointAvailable || AppState.ui.isPaused)
+  {
+    return;
+  }
+  try
+  {
+    const response = await fetch(API_ROUTES.GFX);
+    if (!response.ok)
+    {
+      if (response.status === 404)
+      {
+        gfxEndpointAvailable = false;
+      }
+      return;
+    }
+    const gfxData = await response.json();
+    const box     = document.getElementById('gfxInfoBox');
+    const table   = document.getElementById('gfxHistTable');
+    const summary = document.getElementById('gfxSummary');
+    if (!box || !table || !gfxData.displays || gfxData.displays.length === 0)
+    {
+      return;
+    }
+    box.classList.remove('hidden');
+
+    const disp = gfxData.displays[0];
+    if (summary)
+    {
+      summary.textContent = `${disp.width}x${disp.height}, ${disp.fps} fps, ${disp.frames} frames`;
+    }
+
+    table.innerHTML = '';
+    GFX_HIST_ROWS.forEach((row) =>
+    {
+      const hist = disp.hist ? disp.hist[row.key] : null;
+      if (!hist)
+      {
+        return;
+      }
+      const format = (v) => (row.scale === 1 ? Math.round(v) : (v * row.scale).toFixed(2)) + (row.unit ? ` ${row.unit}` : '');
+      const tr = document.createElement('tr');
+      [row.label, format(hist.avg), format(hist.p95), format(hist.max)].forEach((text, index) =>
+      {
+        const td = document.createElement('td');
+        td.className = index === 0 ? 'hardware-table-label-cell' : 'hardware-table-value-cell';
+        td.textContent = text;
+        tr.appendChild(td);
+      });
+      table.appendChild(tr);
+    });
+  }
+  catch (error)
+  {
+    console.warn("Failed to fetch render statistics:", error);
+  }
+}
@@ -0,0 +1,14 @@
+#include <stdio.h>
+
+#include "unity.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void app_main(void) {
+    printf("Running wifimgr host tests\n");
+    unity_run_menu();
+}
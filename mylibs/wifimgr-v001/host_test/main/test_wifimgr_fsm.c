@@ -0,0 +1,484 @@
+/**
+ * @file test_wifimgr_fsm.c
+ * @brief wifimgr state machine against a fake Wi-Fi driver.
+ *
+ * The fake driver only records what the machine asked for; the tests play the
+ * radio by feeding the events, with a virtual clock.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unity.h"
+#include "wifimgr_fsm.h"
+
+#define MS(ms) ((int64_t) (ms) * 1000)
+
+typedef struct {
+    int              scans;
+    int              connects;
+    int              disconnects;
+    int              ip_starts;
+    int              renews;
+    int              saves;
+    wifimgr_ap_t     ap;  // last connect()
+    bool             has_bssid;
+    uint8_t          bssid[6];
+    uint8_t          channel;
+    bool             has_lease;
+    wifimgr_ip_t     lease;  // last start_ip()
+    bool             refuse_lease;  // like an expired one
+    wifimgr_record_t saved;
+    uint32_t         rnd;
+} fake_drv_t;
+
+static void fake_scan(void* ctx) {
+    ((fake_drv_t*) ctx)->scans++;
+}
+
+static void fake_connect(void* ctx, const wifimgr_ap_t* ap, const uint8_t* bssid, uint8_t channel) {
+    fake_drv_t* f = ctx;
+    f->connects++;
+    f->ap        = *ap;
+    f->has_bssid = bssid != NULL;
+    if (bssid) {
+        memcpy(f->bssid, bssid, 6);
+    }
+    f->channel = channel;
+}
+
+static void fake_disconnect(void* ctx) {
+    ((fake_drv_t*) ctx)->disconnects++;
+}
+
+static bool fake_start_ip(void* ctx, const wifimgr_ip_t* lease) {
+    fake_drv_t* f = ctx;
+    f->ip_starts++;
+    f->has_lease = lease != NULL;
+    if (lease) {
+        f->lease = *lease;
+    }
+    return !f->refuse_lease;
+}
+
+static void fake_renew(void* ctx) {
+    ((fake_drv_t*) ctx)->renews++;
+}
+
+static void fake_save(void* ctx, const wifimgr_record_t* record) {
+    fake_drv_t* f = ctx;
+    f->saves++;
+    f->saved = *record;
+}
+
+static uint32_t fake_random(void* ctx) {
+    return ((fake_drv_t*) ctx)->rnd;
+}
+
+static fake_drv_t    s_drv;
+static wifimgr_fsm_t s_fsm;
+static int64_t       s_now;
+
+static const wifimgr_ip_t s_ip = {.ip = 0x0a01a8c0, .netmask = 0x00ffffff, .gw = 0x0101a8c0};
+
+static void setup_fsm(void) {
+    memset(&s_drv, 0, sizeof(s_drv));
+    wifimgr_driver_t drv = {
+        .ctx         = &s_drv,
+        .scan        = fake_scan,
+        .connect     = fake_connect,
+        .disconnect  = fake_disconnect,
+        .start_ip    = fake_start_ip,
+        .renew_ip    = fake_renew,
+        .save_record = fake_save,
+        .random      = fake_random,
+    };
+    wifimgr_fsm_init(&s_fsm, &drv, NULL);
+    s_now = MS(1000);
+}
+
+static void send(wifimgr_event_id_t id) {
+    wifimgr_event_t ev = {.id = id};
+    wifimgr_fsm_handle(&s_fsm, &ev, s_now);
+}
+
+static void send_scan(const wifimgr_scan_result_t* results, size_t count) {
+    wifimgr_event_t ev = {.id = WIFIMGR_EV_SCAN_DONE, .scan = {.results = results, .count = count}};
+    wifimgr_fsm_handle(&s_fsm, &ev, s_now);
+}
+
+static void send_assoc(const uint8_t* bssid, uint8_t channel) {
+    wifimgr_event_t ev = {.id = WIFIMGR_EV_ASSOCIATED};
+    memcpy(ev.assoc.bssid, bssid, 6);
+    ev.assoc.channel = channel;
+    wifimgr_fsm_handle(&s_fsm, &ev, s_now);
+}
+
+static void send_ip(void) {
+    wifimgr_event_t ev = {.id = WIFIMGR_EV_GOT_IP, .ip = s_ip};
+    wifimgr_fsm_handle(&s_fsm, &ev, s_now);
+}
+
+/* Moves the clock to the deadline and delivers the timeout. */
+static void expire(void) {
+    TEST_ASSERT_NOT_EQUAL(-1, wifimgr_fsm_deadline(&s_fsm));
+    s_now = wifimgr_fsm_deadline(&s_fsm);
+    send(WIFIMGR_EV_TIMEOUT);
+}
+
+static const uint8_t s_bssid_a[6] = {0xaa, 0, 0, 0, 0, 1};
+static const uint8_t s_bssid_b[6] = {0xbb, 0, 0, 0, 0, 2};
+static const uint8_t s_bssid_c[6] = {0xcc, 0, 0, 0, 0, 3};
+
+static const wifimgr_record_t s_record = {
+    .ssid = "home", .bssid = {0xaa, 0, 0, 0, 0, 1}, .channel = 6, .lease = {0x0a01a8c0, 0x00ffffff, 0x0101a8c0}};
+
+TEST_CASE("first connection scans, then DHCP, and saves the record", "[wifimgr]")
+{
+    setup_fsm();
+    TEST_ASSERT_EQUAL(ESP_OK, wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0));
+    send(WIFIMGR_EV_START);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_SCANNING, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_drv.scans);
+
+    const wifimgr_scan_result_t results[] = {
+        {.ssid = "other", .bssid = {1}, .channel = 1, .rssi = -30},
+        {.ssid = "home", .bssid = {0xaa, 0, 0, 0, 0, 1}, .channel = 6, .rssi = -60},
+    };
+    s_now += MS(1800);
+    send_scan(results, 2);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTING, s_fsm.state);
+    TEST_ASSERT_EQUAL_STRING("home", s_drv.ap.ssid);
+    TEST_ASSERT_EQUAL_STRING("secret", s_drv.ap.pass);
+    TEST_ASSERT_TRUE(s_drv.has_bssid);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_a, s_drv.bssid, 6);
+    TEST_ASSERT_EQUAL(6, s_drv.channel);
+
+    s_now += MS(300);
+    send_assoc(s_bssid_a, 6);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_DHCP, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_drv.ip_starts);
+    TEST_ASSERT_FALSE(s_drv.has_lease);
+
+    s_now += MS(900);
+    send_ip();
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTED, s_fsm.state);
+    TEST_ASSERT_EQUAL(-1, wifimgr_fsm_deadline(&s_fsm));
+    TEST_ASSERT_EQUAL(1, s_drv.saves);
+    TEST_ASSERT_EQUAL_MEMORY(&s_record, &s_drv.saved, sizeof(s_record));
+
+    TEST_ASSERT_EQUAL(1800, s_fsm.metrics.scan.last_ms);
+    TEST_ASSERT_EQUAL(300, s_fsm.metrics.assoc.last_ms);
+    TEST_ASSERT_EQUAL(900, s_fsm.metrics.dhcp.last_ms);
+    TEST_ASSERT_EQUAL(3000, s_fsm.metrics.connect.last_ms);
+    TEST_ASSERT_EQUAL(3000, s_fsm.metrics.first_connect_ms);
+    TEST_ASSERT_EQUAL(0, s_fsm.metrics.fast_attempts);
+}
+
+TEST_CASE("a saved record skips the scan and reuses the lease of the same BSSID", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    TEST_ASSERT_EQUAL(0, s_drv.scans);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTING, s_fsm.state);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_a, s_drv.bssid, 6);
+    TEST_ASSERT_EQUAL(6, s_drv.channel);
+    TEST_ASSERT_EQUAL(MS(1000 + 1500), wifimgr_fsm_deadline(&s_fsm));  // fast_assoc_timeout_ms
+
+    s_now += MS(150);
+    send_assoc(s_bssid_a, 6);
+    TEST_ASSERT_TRUE(s_drv.has_lease);
+    TEST_ASSERT_EQUAL_HEX32(s_record.lease.ip, s_drv.lease.ip);
+
+    s_now += MS(5);
+    send_ip();
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTED, s_fsm.state);
+    TEST_ASSERT_EQUAL(155, s_fsm.metrics.first_connect_ms);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.fast_attempts);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.fast_ok);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.lease_reused);
+    TEST_ASSERT_EQUAL(0, s_drv.saves);  // nothing changed, no flash write
+}
+
+TEST_CASE("a reused lease is handed to DHCP once connected and the renewal saved", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    send_assoc(s_bssid_a, 6);
+    TEST_ASSERT_EQUAL(0, s_drv.renews);  // not before the address is up
+    send_ip();
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTED, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_drv.renews);
+    TEST_ASSERT_EQUAL(0, s_drv.saves);
+
+    // DHCP bound a new address
+    wifimgr_event_t ev = {.id = WIFIMGR_EV_GOT_IP, .ip = {.ip = 0x0b01a8c0, .netmask = 0x00ffffff, .gw = 0x0101a8c0}};
+    wifimgr_fsm_handle(&s_fsm, &ev, s_now);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTED, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_drv.renews);
+    TEST_ASSERT_EQUAL(1, s_drv.saves);
+    TEST_ASSERT_EQUAL_HEX32(0x0b01a8c0, s_drv.saved.lease.ip);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_a, s_drv.saved.bssid, 6);
+
+    // a renewal of the same address restarts the age of the lease
+    send_ip();
+    TEST_ASSERT_EQUAL(2, s_drv.saves);
+    TEST_ASSERT_EQUAL_HEX32(s_ip.ip, s_drv.saved.lease.ip);
+}
+
+TEST_CASE("a lease refused by the driver goes through DHCP", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    s_drv.refuse_lease = true;
+    send(WIFIMGR_EV_START);
+    send_assoc(s_bssid_a, 6);
+    TEST_ASSERT_TRUE(s_drv.has_lease);
+    send_ip();
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTED, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.fast_ok);
+    TEST_ASSERT_EQUAL(0, s_fsm.metrics.lease_reused);
+    TEST_ASSERT_EQUAL(0, s_drv.renews);  // DHCP already runs
+}
+
+TEST_CASE("the fast path is skipped while a preferred network is configured", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0);
+    wifimgr_fsm_add_ap(&s_fsm, "office", "x", 1);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_SCANNING, s_fsm.state);
+    TEST_ASSERT_EQUAL(0, s_fsm.metrics.fast_attempts);
+}
+
+TEST_CASE("a roamed BSSID gets DHCP and an updated record", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    send_assoc(s_bssid_b, 11);
+    TEST_ASSERT_FALSE(s_drv.has_lease);
+    send_ip();
+    TEST_ASSERT_EQUAL(1, s_drv.saves);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_b, s_drv.saved.bssid, 6);
+    TEST_ASSERT_EQUAL(11, s_drv.saved.channel);
+    TEST_ASSERT_EQUAL(0, s_fsm.metrics.lease_reused);
+}
+
+TEST_CASE("a failed fast attempt falls back to a scan", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "secret", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    TEST_ASSERT_EQUAL(1, s_drv.connects);
+
+    send(WIFIMGR_EV_DISCONNECTED);  // AP not on the cached channel any more
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_SCANNING, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_drv.scans);
+
+    // no candidate: backoff, and the next round scans instead of trying fast again
+    send_scan(NULL, 0);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_BACKOFF, s_fsm.state);
+    expire();
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_SCANNING, s_fsm.state);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.fast_attempts);
+}
+
+TEST_CASE("candidates are tried by priority, then RSSI, then backoff", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "office", "x", 1);
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 5);
+    send(WIFIMGR_EV_START);
+
+    const wifimgr_scan_result_t results[] = {
+        {.ssid = "office", .bssid = {0xcc, 0, 0, 0, 0, 3}, .channel = 1, .rssi = -40},
+        {.ssid = "home", .bssid = {0xbb, 0, 0, 0, 0, 2}, .channel = 11, .rssi = -80},
+        {.ssid = "home", .bssid = {0xaa, 0, 0, 0, 0, 1}, .channel = 6, .rssi = -55},
+        {.ssid = "cafe", .bssid = {0xdd}, .channel = 3, .rssi = -20},
+    };
+    send_scan(results, 4);
+    TEST_ASSERT_EQUAL(3, s_fsm.n_candidates);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_a, s_drv.bssid, 6);
+
+    send(WIFIMGR_EV_DISCONNECTED);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_b, s_drv.bssid, 6);
+    send(WIFIMGR_EV_DISCONNECTED);
+    TEST_ASSERT_EQUAL_STRING("office", s_drv.ap.ssid);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_c, s_drv.bssid, 6);
+    send(WIFIMGR_EV_DISCONNECTED);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_BACKOFF, s_fsm.state);
+    TEST_ASSERT_EQUAL(3, s_drv.connects);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.failures);
+}
+
+TEST_CASE("an association timeout waits for the disconnect before the next candidate", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 0);
+    send(WIFIMGR_EV_START);
+    const wifimgr_scan_result_t results[] = {
+        {.ssid = "home", .bssid = {0xaa, 0, 0, 0, 0, 1}, .channel = 6, .rssi = -50},
+        {.ssid = "home", .bssid = {0xbb, 0, 0, 0, 0, 2}, .channel = 11, .rssi = -70},
+    };
+    send_scan(results, 2);
+
+    expire();
+    TEST_ASSERT_EQUAL(1, s_drv.disconnects);
+    TEST_ASSERT_EQUAL(1, s_drv.connects);  // still waiting for the DISCONNECTED
+
+    send(WIFIMGR_EV_DISCONNECTED);
+    TEST_ASSERT_EQUAL(2, s_drv.connects);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(s_bssid_b, s_drv.bssid, 6);
+    TEST_ASSERT_FALSE(s_fsm.aborting);
+
+    // an association for the aborted attempt would have been ignored
+    expire();
+    send_assoc(s_bssid_b, 11);
+    TEST_ASSERT_EQUAL(0, s_drv.ip_starts);
+}
+
+TEST_CASE("backoff doubles up to the cap, with half of it jittered", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 0);
+    send(WIFIMGR_EV_START);
+
+    // random() == 0: the delay is the fixed half of min << n
+    uint32_t expected[] = {250, 500, 1000, 2000, 4000, 8000, 16000, 30000, 30000};
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        send_scan(NULL, 0);
+        TEST_ASSERT_EQUAL(WIFIMGR_STATE_BACKOFF, s_fsm.state);
+        TEST_ASSERT_EQUAL(MS(expected[i]), wifimgr_fsm_deadline(&s_fsm) - s_now);
+        expire();
+    }
+
+    // the random half is bounded by the full delay
+    s_drv.rnd = 0xffffffff;
+    send_scan(NULL, 0);
+    int64_t delay = wifimgr_fsm_deadline(&s_fsm) - s_now;
+    TEST_ASSERT_TRUE(delay >= MS(30000) && delay <= MS(60000));
+
+    // a connection resets it
+    expire();
+    const wifimgr_scan_result_t results[] = {{.ssid = "home", .bssid = {0xaa, 0, 0, 0, 0, 1}, .channel = 6}};
+    send_scan(results, 1);
+    send_assoc(s_bssid_a, 6);
+    send_ip();
+    TEST_ASSERT_EQUAL(0, s_fsm.backoff_step);
+}
+
+TEST_CASE("a lost link reconnects at once to the same BSSID", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    send_assoc(s_bssid_a, 6);
+    send_ip();
+
+    s_now += MS(60000);
+    send(WIFIMGR_EV_DISCONNECTED);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTING, s_fsm.state);
+    TEST_ASSERT_EQUAL(2, s_drv.connects);
+    TEST_ASSERT_EQUAL(0, s_drv.scans);
+    TEST_ASSERT_EQUAL(1, s_fsm.metrics.disconnects);
+
+    s_now += MS(120);
+    send_assoc(s_bssid_a, 6);
+    s_now += MS(10);
+    send_ip();
+    TEST_ASSERT_EQUAL(130, s_fsm.metrics.connect.last_ms);
+    TEST_ASSERT_EQUAL(2, s_fsm.metrics.fast_ok);
+}
+
+TEST_CASE("removing the network in use disconnects and scans for the others", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 0);
+    wifimgr_fsm_add_ap(&s_fsm, "office", "x", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    send_assoc(s_bssid_a, 6);
+    send_ip();
+
+    TEST_ASSERT_EQUAL(ESP_OK, wifimgr_fsm_remove_ap(&s_fsm, "home"));
+    send(WIFIMGR_EV_APS_CHANGED);
+    TEST_ASSERT_EQUAL(1, s_drv.disconnects);
+    send(WIFIMGR_EV_DISCONNECTED);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_SCANNING, s_fsm.state);
+    TEST_ASSERT_EQUAL(0, s_fsm.metrics.disconnects);
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, wifimgr_fsm_remove_ap(&s_fsm, "home"));
+}
+
+TEST_CASE("no network configured: idle until one is added", "[wifimgr]")
+{
+    setup_fsm();
+    send(WIFIMGR_EV_START);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_IDLE, s_fsm.state);
+    TEST_ASSERT_EQUAL(-1, wifimgr_fsm_deadline(&s_fsm));
+
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 0);
+    send(WIFIMGR_EV_APS_CHANGED);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_SCANNING, s_fsm.state);
+
+    send(WIFIMGR_EV_STOP);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_IDLE, s_fsm.state);
+    send_scan(NULL, 0);  // late result after the stop
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_IDLE, s_fsm.state);
+    expire();  // no DISCONNECTED for a scan
+    TEST_ASSERT_EQUAL(-1, wifimgr_fsm_deadline(&s_fsm));
+}
+
+TEST_CASE("a restart waits for the disconnect of the stop", "[wifimgr]")
+{
+    setup_fsm();
+    wifimgr_fsm_add_ap(&s_fsm, "home", "y", 0);
+    wifimgr_fsm_set_record(&s_fsm, &s_record);
+    send(WIFIMGR_EV_START);
+    send_assoc(s_bssid_a, 6);
+    send_ip();
+
+    send(WIFIMGR_EV_STOP);
+    send(WIFIMGR_EV_START);
+    TEST_ASSERT_EQUAL(1, s_drv.disconnects);
+    TEST_ASSERT_EQUAL(1, s_drv.connects);
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_IDLE, s_fsm.state);
+
+    send(WIFIMGR_EV_DISCONNECTED);  // the one of the stop, not a failure of the next attempt
+    TEST_ASSERT_EQUAL(WIFIMGR_STATE_CONNECTING, s_fsm.state);
+    TEST_ASSERT_EQUAL(2, s_drv.connects);
+    TEST_ASSERT_EQUAL(2, s_fsm.metrics.fast_attempts);
+    TEST_ASSERT_EQUAL(0, s_fsm.metrics.disconnects);
+}
+
+TEST_CASE("add_ap validates and updates in place", "[wifimgr]")
+{
+    setup_fsm();
+    char long_ssid[WIFIMGR_SSID_SIZE + 1];
+    memset(long_ssid, 'a', sizeof(long_ssid) - 1);
+    long_ssid[sizeof(long_ssid) - 1] = '\0';
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, wifimgr_fsm_add_ap(&s_fsm, long_ssid, "", 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, wifimgr_fsm_add_ap(&s_fsm, "", "", 0));
+
+    TEST_ASSERT_EQUAL(ESP_OK, wifimgr_fsm_add_ap(&s_fsm, "home", "old", 0));
+    TEST_ASSERT_EQUAL(ESP_OK, wifimgr_fsm_add_ap(&s_fsm, "home", "new", 3));
+    TEST_ASSERT_EQUAL(1, s_fsm.n_aps);
+    TEST_ASSERT_EQUAL_STRING("new", s_fsm.aps[0].pass);
+    TEST_ASSERT_EQUAL(3, s_fsm.aps[0].priority);
+
+    for (int i = 1; i < WIFIMGR_MAX_APS; i++) {
+        char ssid[8];
+        snprintf(ssid, sizeof(ssid), "ap%d", i);
+        TEST_ASSERT_EQUAL(ESP_OK, wifimgr_fsm_add_ap(&s_fsm, ssid, NULL, 0));
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, wifimgr_fsm_add_ap(&s_fsm, "one-more", NULL, 0));
+}
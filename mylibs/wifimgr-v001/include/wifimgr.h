@@ -0,0 +1,94 @@
+#pragma once
+#ifndef WIFIMGR_H_
+#define WIFIMGR_H_
+
+/**
+ * Wi-Fi station connection manager.
+ *
+ * One task owns the connection: it runs the state machine of wifimgr_fsm.h on
+ * the esp_wifi / esp_netif events and on its own deadlines, so nothing else calls
+ * esp_wifi_connect(). A lost link is retried at once on the same BSSID/channel,
+ * then with a scan over the configured networks, then with jittered exponential
+ * backoff.
+ *
+ * The last connection (SSID, BSSID, channel, IP lease) is kept in RTC memory,
+ * which survives esp_restart() and deep sleep, and in NVS for a power cycle
+ * (BSSID and channel only). After a reset the manager associates to it without
+ * scanning and, if the lease is younger than WIFIMGR_LEASE_REUSE_S, sets it as a
+ * static address instead of waiting for DHCP.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "wifimgr_fsm.h"
+
+/**********************
+ *   SETTINGS
+ **********************/
+#ifndef WIFIMGR_TASK_STACK
+#define WIFIMGR_TASK_STACK (4096)
+#endif
+
+#ifndef WIFIMGR_TASK_PRIORITY
+#define WIFIMGR_TASK_PRIORITY (5)
+#endif
+
+#ifndef WIFIMGR_QUEUE_LEN
+#define WIFIMGR_QUEUE_LEN (16)
+#endif
+
+#ifndef WIFIMGR_SCAN_MAX
+#define WIFIMGR_SCAN_MAX (20)  // scan results looked at, strongest first
+#endif
+
+#ifndef WIFIMGR_NVS_NAMESPACE
+#define WIFIMGR_NVS_NAMESPACE "wifimgr"
+#endif
+
+/* A reused lease is not renewed until the next DHCP, keep this well under the
+ * lease time of the network. 0 always waits for DHCP. */
+#ifndef WIFIMGR_LEASE_REUSE_S
+#define WIFIMGR_LEASE_REUSE_S (300)
+#endif
+
+#define WIFIMGR_PRIORITY_TOP (-1)  // wifimgr_add_ap(): above every network of the list
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    wifimgr_state_t   state;
+    bool              connected;
+    wifimgr_record_t  link;  // current connection if connected, else the last one (ssid[0] == 0: none)
+    size_t            n_aps;
+    wifimgr_metrics_t metrics;
+} wifimgr_status_t;
+
+/* Brings up esp_netif, the default event loop (if not created yet) and esp_wifi in
+ * station mode, then the manager task. NVS must be initialized already. timing ==
+ * NULL: WIFIMGR_TIMING_DEFAULT(). Safe to call more than once. */
+esp_err_t wifimgr_init(const wifimgr_timing_t* timing);
+
+/* Adds or updates (same SSID) a network; priority 0..255 or WIFIMGR_PRIORITY_TOP. */
+esp_err_t wifimgr_add_ap(const char* ssid, const char* pass, int priority);
+esp_err_t wifimgr_remove_ap(const char* ssid);
+size_t    wifimgr_get_aps(wifimgr_ap_t* out, size_t max);
+
+esp_err_t wifimgr_start(void);
+esp_err_t wifimgr_stop(void);  // disconnects and stays idle
+/* Drops the current connection and starts over, e.g. after a new preferred network. */
+esp_err_t wifimgr_reconnect(void);
+
+/* true once an IP is up; timeout_ms == 0 only checks. */
+bool wifimgr_wait_connected(uint32_t timeout_ms);
+void wifimgr_get_status(wifimgr_status_t* out);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* WIFIMGR_H_ */
@@ -0,0 +1,216 @@
+#pragma once
+#ifndef WIFIMGR_FSM_H_
+#define WIFIMGR_FSM_H_
+
+/**
+ * Connection state machine of wifimgr, without any ESP-IDF Wi-Fi dependency.
+ *
+ * The machine gets events (driver results, timeouts) together with the current
+ * monotonic time and acts through a wifimgr_driver_t. The real driver wraps
+ * esp_wifi/esp_netif (wifimgr.c); tests plug a fake one and feed the events.
+ *
+ *   IDLE -> [fast] CONNECTING -> DHCP -> CONNECTED
+ *        -> SCANNING -> CONNECTING (best candidate first) -> DHCP -> CONNECTED
+ *   any failure -> next candidate, then BACKOFF (exponential, jittered) -> again
+ *
+ * "fast" reuses the BSSID and channel of the last connection (wifimgr_record_t),
+ * skipping the scan, and optionally its IP lease, skipping DHCP. It's only taken
+ * while that network has the highest priority of the list; otherwise a scan
+ * looks for the preferred ones first.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+/**********************
+ *   SETTINGS
+ **********************/
+#ifndef WIFIMGR_MAX_APS
+#define WIFIMGR_MAX_APS (4)
+#endif
+
+#ifndef WIFIMGR_MAX_CANDIDATES
+#define WIFIMGR_MAX_CANDIDATES (8)  // BSSIDs kept from a scan
+#endif
+
+#define WIFIMGR_SSID_SIZE (33)
+#define WIFIMGR_PASS_SIZE (65)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef enum {
+    WIFIMGR_STATE_IDLE,
+    WIFIMGR_STATE_SCANNING,
+    WIFIMGR_STATE_CONNECTING,
+    WIFIMGR_STATE_DHCP,
+    WIFIMGR_STATE_CONNECTED,
+    WIFIMGR_STATE_BACKOFF,
+} wifimgr_state_t;
+
+typedef struct {
+    char    ssid[WIFIMGR_SSID_SIZE];
+    char    pass[WIFIMGR_PASS_SIZE];
+    uint8_t priority;  // higher is tried first, RSSI breaks the ties
+} wifimgr_ap_t;
+
+typedef struct {
+    char    ssid[WIFIMGR_SSID_SIZE];
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t  rssi;
+} wifimgr_scan_result_t;
+
+typedef struct {
+    uint32_t ip;  // same byte order as esp_ip4_addr_t
+    uint32_t netmask;
+    uint32_t gw;
+    uint32_t dns;  // 0: none
+} wifimgr_ip_t;
+
+/* Last successful connection, kept across reboots by the driver. */
+typedef struct {
+    char         ssid[WIFIMGR_SSID_SIZE];
+    uint8_t      bssid[6];
+    uint8_t      channel;
+    wifimgr_ip_t lease;  // lease.ip == 0: no lease to reuse
+} wifimgr_record_t;
+
+typedef struct {
+    void* ctx;
+    void (*scan)(void* ctx);  // all channels, completes with WIFIMGR_EV_SCAN_DONE
+    /* bssid == NULL and channel == 0 let the driver pick; completes with
+     * WIFIMGR_EV_ASSOCIATED or WIFIMGR_EV_DISCONNECTED */
+    void (*connect)(void* ctx, const wifimgr_ap_t* ap, const uint8_t* bssid, uint8_t channel);
+    void (*disconnect)(void* ctx);  // completes with WIFIMGR_EV_DISCONNECTED
+    /* Applies the lease, or starts DHCP (lease == NULL, or refused by the driver,
+     * e.g. too old); returns true if the lease was applied. Completes with
+     * WIFIMGR_EV_GOT_IP. */
+    bool (*start_ip)(void* ctx, const wifimgr_ip_t* lease);
+    /* Optional. Called once connected on a reused lease: starts DHCP so the
+     * lease gets renewed. Completes with WIFIMGR_EV_GOT_IP. */
+    void (*renew_ip)(void* ctx);
+    /* Called when the record changed, and when DHCP (re)bound the address of a
+     * connection, to restart the age of the lease. */
+    void (*save_record)(void* ctx, const wifimgr_record_t* record);
+    uint32_t (*random)(void* ctx);
+} wifimgr_driver_t;
+
+typedef enum {
+    WIFIMGR_EV_START,
+    WIFIMGR_EV_STOP,
+    WIFIMGR_EV_APS_CHANGED,
+    WIFIMGR_EV_SCAN_DONE,
+    WIFIMGR_EV_ASSOCIATED,
+    WIFIMGR_EV_DISCONNECTED,
+    WIFIMGR_EV_GOT_IP,
+    WIFIMGR_EV_TIMEOUT,  // the deadline of wifimgr_fsm_deadline() passed
+} wifimgr_event_id_t;
+
+typedef struct {
+    wifimgr_event_id_t id;
+    union {
+        struct {
+            const wifimgr_scan_result_t* results;
+            size_t                       count;
+        } scan;
+        struct {
+            uint8_t bssid[6];
+            uint8_t channel;
+        } assoc;
+        uint8_t      reason;  // WIFIMGR_EV_DISCONNECTED
+        wifimgr_ip_t ip;      // WIFIMGR_EV_GOT_IP
+    };
+} wifimgr_event_t;
+
+typedef struct {
+    uint32_t assoc_timeout_ms;       // association after a scan
+    uint32_t fast_assoc_timeout_ms;  // association to the cached BSSID/channel
+    uint32_t scan_timeout_ms;
+    uint32_t dhcp_timeout_ms;
+    uint32_t abort_timeout_ms;  // wait for the DISCONNECTED of an aborted attempt
+    uint32_t backoff_min_ms;
+    uint32_t backoff_max_ms;
+} wifimgr_timing_t;
+
+#define WIFIMGR_TIMING_DEFAULT()                                                                       \
+    {.assoc_timeout_ms = 5000, .fast_assoc_timeout_ms = 1500, .scan_timeout_ms = 5000,                 \
+     .dhcp_timeout_ms = 10000, .abort_timeout_ms = 1000, .backoff_min_ms = 500, .backoff_max_ms = 60000}
+
+typedef struct {
+    uint32_t count;
+    uint32_t last_ms;
+    uint32_t max_ms;
+    uint64_t total_ms;
+} wifimgr_phase_t;
+
+typedef struct {
+    wifimgr_phase_t scan;     // scan start -> results
+    wifimgr_phase_t assoc;    // connect -> associated
+    wifimgr_phase_t dhcp;     // associated -> IP
+    wifimgr_phase_t connect;  // start or link loss -> IP, backoffs included
+    uint32_t        first_connect_ms;  // WIFIMGR_EV_START -> first IP, 0 until then
+    uint32_t        fast_attempts;
+    uint32_t        fast_ok;
+    uint32_t        lease_reused;
+    uint32_t        failures;  // attempts that ended in backoff
+    uint32_t        disconnects;  // link lost while connected
+} wifimgr_metrics_t;
+
+typedef struct {
+    uint8_t ap;  // index in aps
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t  rssi;
+} wifimgr_candidate_t;
+
+typedef struct {
+    wifimgr_driver_t  drv;
+    wifimgr_timing_t  timing;
+    wifimgr_state_t   state;
+    bool              started;
+    bool              aborting;  // disconnect requested, waiting for its DISCONNECTED
+    bool              fast;      // the current attempt uses the record
+    bool              fast_allowed;
+    bool              record_valid;
+    wifimgr_record_t  record;
+    wifimgr_ap_t      aps[WIFIMGR_MAX_APS];
+    size_t            n_aps;
+    wifimgr_candidate_t candidates[WIFIMGR_MAX_CANDIDATES];
+    size_t            n_candidates;
+    size_t            next_candidate;
+    int               current_ap;  // index in aps, -1 if none
+    uint8_t           current_bssid[6];
+    uint8_t           current_channel;
+    bool              lease_used;
+    uint32_t          backoff_step;
+    int64_t           deadline_us;     // -1: none
+    int64_t           phase_since_us;  // start of the scan / assoc / dhcp phase
+    int64_t           attempt_since_us;
+    int64_t           start_us;
+    wifimgr_metrics_t metrics;
+} wifimgr_fsm_t;
+
+/* timing == NULL: WIFIMGR_TIMING_DEFAULT(). */
+void wifimgr_fsm_init(wifimgr_fsm_t* fsm, const wifimgr_driver_t* drv, const wifimgr_timing_t* timing);
+/* Record loaded by the driver at boot (NULL forgets it). */
+void wifimgr_fsm_set_record(wifimgr_fsm_t* fsm, const wifimgr_record_t* record);
+
+/* Adds or updates (same SSID) a network; send WIFIMGR_EV_APS_CHANGED afterwards. */
+esp_err_t wifimgr_fsm_add_ap(wifimgr_fsm_t* fsm, const char* ssid, const char* pass, uint8_t priority);
+esp_err_t wifimgr_fsm_remove_ap(wifimgr_fsm_t* fsm, const char* ssid);
+
+void    wifimgr_fsm_handle(wifimgr_fsm_t* fsm, const wifimgr_event_t* ev, int64_t now_us);
+int64_t wifimgr_fsm_deadline(const wifimgr_fsm_t* fsm);  // -1: nothing to wait for
+
+const char* wifimgr_state_name(wifimgr_state_t state);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* WIFIMGR_FSM_H_ */
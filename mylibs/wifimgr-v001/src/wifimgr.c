@@ -0,0 +1,478 @@
+/**
+ * @file wifimgr.c
+ * @brief esp_wifi / esp_netif driver of the wifimgr state machine, and its task.
+ */
+
+#include "wifimgr.h"
+
+#include <string.h>
+
+#include "esp_attr.h"
+#include "esp_event.h"
+#include "esp_log.h"
+#include "esp_netif.h"
+#include "esp_random.h"
+#include "esp_rom_crc.h"
+#include "esp_rtc_time.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "logctl.h"
+#include "nvs.h"
+
+// log tag: LOGCTL_TAG_WIFIMGR ("wifimgr", logctl_tags.h)
+
+#define WIFIMGR_CONNECTED_BIT BIT0
+#define WIFIMGR_RTC_MAGIC     (0x57464d31)  // "WFM1"
+#define WIFIMGR_NVS_KEY       "last"
+
+// --------------------------------------- //
+
+/* Survives esp_restart() and deep sleep, not a power cycle. */
+typedef struct {
+    uint32_t         magic;
+    wifimgr_record_t record;
+    int64_t          lease_us;  // esp_rtc_get_time_us() when the lease was obtained
+    uint32_t         crc;
+} wifimgr_rtc_record_t;
+
+static RTC_NOINIT_ATTR wifimgr_rtc_record_t s_rtc;
+
+static struct {
+    SemaphoreHandle_t     lock;  // fsm
+    QueueHandle_t         queue;
+    EventGroupHandle_t    events;
+    TaskHandle_t          task;
+    esp_netif_t*          netif;
+    wifimgr_fsm_t         fsm;
+    wifimgr_record_t      nvs_record;  // what NVS holds, to skip identical writes
+    wifimgr_scan_result_t scan[WIFIMGR_SCAN_MAX];
+} s_mgr;
+
+static uint32_t rtc_crc(const wifimgr_rtc_record_t* r) {
+    return esp_rom_crc32_le(0, (const uint8_t*) r, offsetof(wifimgr_rtc_record_t, crc));
+}
+
+static bool rtc_valid(void) {
+    return s_rtc.magic == WIFIMGR_RTC_MAGIC && s_rtc.crc == rtc_crc(&s_rtc);
+}
+
+static bool lease_fresh(const wifimgr_ip_t* lease) {
+    if (WIFIMGR_LEASE_REUSE_S == 0 || !rtc_valid() || s_rtc.record.lease.ip != lease->ip) {
+        return false;
+    }
+    int64_t age_us = esp_rtc_get_time_us() - s_rtc.lease_us;
+    return age_us >= 0 && age_us < (int64_t) WIFIMGR_LEASE_REUSE_S * 1000000;
+}
+
+static void post(const wifimgr_event_t* ev) {
+    if (xQueueSend(s_mgr.queue, ev, 0) != pdTRUE) {
+        LOGCTL_LOGW(WIFIMGR, "Event queue full, event %d dropped", (int) ev->id);
+    }
+}
+
+// --------------------------------------- //
+// Driver, called by the state machine with s_mgr.lock held
+
+static void drv_scan(void* ctx) {
+    esp_err_t err = esp_wifi_scan_start(NULL, false);
+    if (err != ESP_OK) {
+        LOGCTL_LOGW(WIFIMGR, "Scan not started: %s", esp_err_to_name(err));  // the scan timeout takes it from here
+    }
+}
+
+static void drv_connect(void* ctx, const wifimgr_ap_t* ap, const uint8_t* bssid, uint8_t channel) {
+    wifi_config_t cfg = {0};
+    // ssid and password aren't terminated when they fill the field
+    memcpy(cfg.sta.ssid, ap->ssid, strnlen(ap->ssid, sizeof(cfg.sta.ssid)));
+    memcpy(cfg.sta.password, ap->pass, strnlen(ap->pass, sizeof(cfg.sta.password)));
+    if (bssid) {
+        cfg.sta.bssid_set = true;
+        memcpy(cfg.sta.bssid, bssid, sizeof(cfg.sta.bssid));
+    }
+    cfg.sta.channel     = channel;  // with the BSSID, the driver probes that channel only
+    cfg.sta.scan_method = WIFI_FAST_SCAN;
+
+    esp_err_t err = esp_wifi_set_config(WIFI_IF_STA, &cfg);
+    if (err == ESP_OK) {
+        err = esp_wifi_connect();
+    }
+    if (err != ESP_OK) {
+        LOGCTL_LOGW(WIFIMGR, "Connect to '%s' failed: %s", ap->ssid, esp_err_to_name(err));
+        wifimgr_event_t ev = {.id = WIFIMGR_EV_DISCONNECTED};
+        post(&ev);
+    }
+}
+
+static void drv_disconnect(void* ctx) {
+    esp_wifi_disconnect();
+}
+
+static bool drv_start_ip(void* ctx, const wifimgr_ip_t* lease) {
+    if (lease && lease_fresh(lease)) {
+        esp_netif_ip_info_t info = {
+            .ip.addr      = lease->ip,
+            .netmask.addr = lease->netmask,
+            .gw.addr      = lease->gw,
+        };
+        esp_err_t err = esp_netif_dhcpc_stop(s_mgr.netif);
+        if (err == ESP_OK || err == ESP_ERR_ESP_NETIF_DHCP_ALREADY_STOPPED) {
+            err = esp_netif_set_ip_info(s_mgr.netif, &info);  // posts IP_EVENT_STA_GOT_IP
+        }
+        if (err == ESP_OK) {
+            if (lease->dns) {
+                esp_netif_dns_info_t dns = {.ip.type = ESP_IPADDR_TYPE_V4, .ip.u_addr.ip4.addr = lease->dns};
+                esp_netif_set_dns_info(s_mgr.netif, ESP_NETIF_DNS_MAIN, &dns);
+            }
+            return true;
+        }
+        LOGCTL_LOGW(WIFIMGR, "Lease not applied (%s), DHCP", esp_err_to_name(err));
+    }
+    esp_err_t err = esp_netif_dhcpc_start(s_mgr.netif);
+    if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STARTED) {
+        LOGCTL_LOGW(WIFIMGR, "DHCP not started: %s", esp_err_to_name(err));
+    }
+    return false;
+}
+
+static void drv_renew_ip(void* ctx) {
+    // esp_netif clears the static address and posts IP_EVENT_STA_GOT_IP again once DHCP binds
+    esp_err_t err = esp_netif_dhcpc_start(s_mgr.netif);
+    if (err != ESP_OK && err != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STARTED) {
+        LOGCTL_LOGW(WIFIMGR, "DHCP not started, lease not renewed: %s", esp_err_to_name(err));
+    }
+}
+
+static void drv_save_record(void* ctx, const wifimgr_record_t* record) {
+    s_rtc.magic    = WIFIMGR_RTC_MAGIC;
+    s_rtc.record   = *record;
+    s_rtc.lease_us = esp_rtc_get_time_us();
+    s_rtc.crc      = rtc_crc(&s_rtc);
+
+    // NVS only gets the BSSID and channel, a lease can't be aged across a power cycle
+    wifimgr_record_t stored = *record;
+    memset(&stored.lease, 0, sizeof(stored.lease));
+    if (memcmp(&stored, &s_mgr.nvs_record, sizeof(stored)) == 0) {
+        return;
+    }
+    nvs_handle_t nvs;
+    esp_err_t    err = nvs_open(WIFIMGR_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, WIFIMGR_NVS_KEY, &stored, sizeof(stored));
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err == ESP_OK) {
+        s_mgr.nvs_record = stored;
+    } else {
+        LOGCTL_LOGW(WIFIMGR, "Connection record not saved: %s", esp_err_to_name(err));
+    }
+}
+
+static uint32_t drv_random(void* ctx) {
+    return esp_random();
+}
+
+// --------------------------------------- //
+
+static void load_record(void) {
+    nvs_handle_t nvs;
+    size_t       size = sizeof(s_mgr.nvs_record);
+    if (nvs_open(WIFIMGR_NVS_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        if (nvs_get_blob(nvs, WIFIMGR_NVS_KEY, &s_mgr.nvs_record, &size) != ESP_OK ||
+            size != sizeof(s_mgr.nvs_record)) {
+            memset(&s_mgr.nvs_record, 0, sizeof(s_mgr.nvs_record));
+        }
+        nvs_close(nvs);
+    }
+    s_mgr.nvs_record.ssid[WIFIMGR_SSID_SIZE - 1] = '\0';
+
+    if (rtc_valid()) {
+        wifimgr_fsm_set_record(&s_mgr.fsm, &s_rtc.record);
+        LOGCTL_LOGI(WIFIMGR, "Last connection (RTC): '%s' channel %u", s_rtc.record.ssid, s_rtc.record.channel);
+    } else if (s_mgr.nvs_record.ssid[0] != '\0') {
+        wifimgr_fsm_set_record(&s_mgr.fsm, &s_mgr.nvs_record);
+        LOGCTL_LOGI(WIFIMGR, "Last connection (NVS): '%s' channel %u", s_mgr.nvs_record.ssid, s_mgr.nvs_record.channel);
+    }
+}
+
+static size_t fetch_scan_results(void) {
+    uint16_t total = 0;
+    esp_wifi_scan_get_ap_num(&total);
+    size_t           count = 0;
+    wifi_ap_record_t ap;
+    while (count < total && count < WIFIMGR_SCAN_MAX && esp_wifi_scan_get_ap_record(&ap) == ESP_OK) {
+        wifimgr_scan_result_t* r = &s_mgr.scan[count++];
+        strlcpy(r->ssid, (const char*) ap.ssid, sizeof(r->ssid));
+        memcpy(r->bssid, ap.bssid, sizeof(r->bssid));
+        r->channel = ap.primary;
+        r->rssi    = ap.rssi;
+    }
+    esp_wifi_clear_ap_list();  // the records not read
+    return count;
+}
+
+/* Runs in the event loop task: only translate and queue. */
+static void on_event(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    wifimgr_event_t ev = {0};
+    if (base == WIFI_EVENT && id == WIFI_EVENT_SCAN_DONE) {
+        ev.id = WIFIMGR_EV_SCAN_DONE;  // the task reads the results
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_CONNECTED) {
+        const wifi_event_sta_connected_t* e = data;
+        ev.id                               = WIFIMGR_EV_ASSOCIATED;
+        memcpy(ev.assoc.bssid, e->bssid, sizeof(ev.assoc.bssid));
+        ev.assoc.channel = e->channel;
+    } else if (base == WIFI_EVENT && id == WIFI_EVENT_STA_DISCONNECTED) {
+        const wifi_event_sta_disconnected_t* e = data;
+        ev.id                                  = WIFIMGR_EV_DISCONNECTED;
+        ev.reason                              = e->reason;
+    } else if (base == IP_EVENT && id == IP_EVENT_STA_GOT_IP) {
+        const ip_event_got_ip_t* e = data;
+        ev.id                      = WIFIMGR_EV_GOT_IP;
+        ev.ip.ip                   = e->ip_info.ip.addr;
+        ev.ip.netmask              = e->ip_info.netmask.addr;
+        ev.ip.gw                   = e->ip_info.gw.addr;
+        esp_netif_dns_info_t dns;
+        if (esp_netif_get_dns_info(e->esp_netif, ESP_NETIF_DNS_MAIN, &dns) == ESP_OK &&
+            dns.ip.type == ESP_IPADDR_TYPE_V4) {
+            ev.ip.dns = dns.ip.u_addr.ip4.addr;
+        }
+    } else {
+        return;
+    }
+    post(&ev);
+}
+
+static void log_transition(wifimgr_state_t from, const wifimgr_event_t* ev) {
+    const wifimgr_fsm_t* fsm = &s_mgr.fsm;
+    if (fsm->state == from) {
+        return;
+    }
+    if (fsm->state == WIFIMGR_STATE_CONNECTED) {
+        const wifimgr_metrics_t* m = &fsm->metrics;
+        LOGCTL_LOGI(WIFIMGR, "Connected to '%s' ch %u in %lu ms (assoc %lu, ip %lu%s)", fsm->record.ssid,
+            fsm->record.channel, (unsigned long) m->connect.last_ms, (unsigned long) m->assoc.last_ms,
+            (unsigned long) m->dhcp.last_ms, fsm->lease_used ? ", lease reused" : "");
+    } else if (fsm->state == WIFIMGR_STATE_BACKOFF) {
+        LOGCTL_LOGI(WIFIMGR, "No network, retry in %lld ms", (long long) (fsm->deadline_us - esp_timer_get_time()) / 1000);
+    } else if (ev->id == WIFIMGR_EV_DISCONNECTED) {
+        LOGCTL_LOGI(WIFIMGR, "%s -> %s (reason %u)", wifimgr_state_name(from), wifimgr_state_name(fsm->state), ev->reason);
+    } else {
+        LOGCTL_LOGD(WIFIMGR, "%s -> %s", wifimgr_state_name(from), wifimgr_state_name(fsm->state));
+    }
+}
+
+static void wifimgr_task(void* arg) {
+    wifimgr_event_t ev;
+    for (;;) {
+        xSemaphoreTake(s_mgr.lock, portMAX_DELAY);
+        int64_t deadline = wifimgr_fsm_deadline(&s_mgr.fsm);
+        xSemaphoreGive(s_mgr.lock);
+
+        TickType_t wait = portMAX_DELAY;
+        if (deadline >= 0) {
+            int64_t left_us = deadline - esp_timer_get_time();
+            wait            = left_us > 0 ? pdMS_TO_TICKS((left_us + 999) / 1000) + 1 : 0;
+        }
+        bool received = xQueueReceive(s_mgr.queue, &ev, wait) == pdTRUE;
+        if (received && ev.id == WIFIMGR_EV_SCAN_DONE) {
+            ev.scan.count   = fetch_scan_results();
+            ev.scan.results = s_mgr.scan;
+        }
+
+        xSemaphoreTake(s_mgr.lock, portMAX_DELAY);
+        int64_t now = esp_timer_get_time();
+        if (!received) {
+            // the deadline may have moved meanwhile (a START, a new network)
+            deadline = wifimgr_fsm_deadline(&s_mgr.fsm);
+            ev.id    = WIFIMGR_EV_TIMEOUT;
+            received = deadline >= 0 && now >= deadline;
+        }
+        if (received) {
+            wifimgr_state_t from = s_mgr.fsm.state;
+            wifimgr_fsm_handle(&s_mgr.fsm, &ev, now);
+            log_transition(from, &ev);
+        }
+        if (s_mgr.fsm.state == WIFIMGR_STATE_CONNECTED) {
+            xEventGroupSetBits(s_mgr.events, WIFIMGR_CONNECTED_BIT);
+        } else {
+            xEventGroupClearBits(s_mgr.events, WIFIMGR_CONNECTED_BIT);
+        }
+        xSemaphoreGive(s_mgr.lock);
+    }
+}
+
+// --------------------------------------- //
+
+esp_err_t wifimgr_init(const wifimgr_timing_t* timing) {
+    if (s_mgr.task) {
+        return ESP_OK;
+    }
+    // every step below is skipped or repeatable, so a failed init can be retried
+
+    esp_err_t err = esp_netif_init();
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = esp_event_loop_create_default();
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {  // already created elsewhere
+        return err;
+    }
+    if (s_mgr.netif == NULL) {
+        s_mgr.netif = esp_netif_create_default_wifi_sta();
+        if (s_mgr.netif == NULL) {
+            return ESP_FAIL;
+        }
+    }
+    wifi_mode_t mode;
+    err = ESP_OK;
+    if (esp_wifi_get_mode(&mode) == ESP_ERR_WIFI_NOT_INIT) {
+        wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+        err                    = esp_wifi_init(&cfg);
+    }
+    if (err == ESP_OK) {
+        err = esp_wifi_set_storage(WIFI_STORAGE_RAM);  // the networks belong to wifimgr
+    }
+    if (err == ESP_OK) {
+        err = esp_wifi_set_mode(WIFI_MODE_STA);
+    }
+    if (err != ESP_OK) {
+        LOGCTL_LOGE(WIFIMGR, "esp_wifi init failed: %s", esp_err_to_name(err));
+        return err;
+    }
+
+    if (s_mgr.lock == NULL) {
+        const wifimgr_driver_t drv = {
+            .scan        = drv_scan,
+            .connect     = drv_connect,
+            .disconnect  = drv_disconnect,
+            .start_ip    = drv_start_ip,
+            .renew_ip    = drv_renew_ip,
+            .save_record = drv_save_record,
+            .random      = drv_random,
+        };
+        wifimgr_fsm_init(&s_mgr.fsm, &drv, timing);
+        load_record();
+        s_mgr.lock = xSemaphoreCreateMutex();  // the API uses the fsm from here
+    }
+    if (s_mgr.queue == NULL) {
+        s_mgr.queue = xQueueCreate(WIFIMGR_QUEUE_LEN, sizeof(wifimgr_event_t));
+    }
+    if (s_mgr.events == NULL) {
+        s_mgr.events = xEventGroupCreate();
+    }
+    if (!s_mgr.lock || !s_mgr.queue || !s_mgr.events) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // registering the same handler again only updates its argument
+    esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_SCAN_DONE, on_event, NULL);
+    esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_CONNECTED, on_event, NULL);
+    esp_event_handler_register(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, on_event, NULL);
+    esp_event_handler_register(IP_EVENT, IP_EVENT_STA_GOT_IP, on_event, NULL);
+
+    err = esp_wifi_start();
+    if (err != ESP_OK) {
+        LOGCTL_LOGE(WIFIMGR, "esp_wifi_start failed: %s", esp_err_to_name(err));
+        return err;
+    }
+    if (xTaskCreate(wifimgr_task, "wifimgr", WIFIMGR_TASK_STACK, NULL, WIFIMGR_TASK_PRIORITY, &s_mgr.task) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t send_event(wifimgr_event_id_t id) {
+    if (s_mgr.queue == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    wifimgr_event_t ev = {.id = id};
+    return xQueueSend(s_mgr.queue, &ev, pdMS_TO_TICKS(100)) == pdTRUE ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t wifimgr_add_ap(const char* ssid, const char* pass, int priority) {
+    if (s_mgr.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (ssid == NULL || priority < WIFIMGR_PRIORITY_TOP || priority > UINT8_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    xSemaphoreTake(s_mgr.lock, portMAX_DELAY);
+    if (priority == WIFIMGR_PRIORITY_TOP) {
+        int top = -1;
+        for (size_t i = 0; i < s_mgr.fsm.n_aps; i++) {
+            if (strcmp(s_mgr.fsm.aps[i].ssid, ssid) != 0 && s_mgr.fsm.aps[i].priority > top) {
+                top = s_mgr.fsm.aps[i].priority;
+            }
+        }
+        priority = top < UINT8_MAX ? top + 1 : UINT8_MAX;
+    }
+    esp_err_t err = wifimgr_fsm_add_ap(&s_mgr.fsm, ssid, pass, (uint8_t) priority);
+    xSemaphoreGive(s_mgr.lock);
+    return err == ESP_OK ? send_event(WIFIMGR_EV_APS_CHANGED) : err;
+}
+
+esp_err_t wifimgr_remove_ap(const char* ssid) {
+    if (s_mgr.lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(s_mgr.lock, portMAX_DELAY);
+    esp_err_t err = wifimgr_fsm_remove_ap(&s_mgr.fsm, ssid);
+    xSemaphoreGive(s_mgr.lock);
+    return err == ESP_OK ? send_event(WIFIMGR_EV_APS_CHANGED) : err;
+}
+
+size_t wifimgr_get_aps(wifimgr_ap_t* out, size_t max) {
+    if (s_mgr.lock == NULL) {
+        return 0;
+    }
+    xSemaphoreTake(s_mgr.lock, portMAX_DELAY);
+    size_t n = s_mgr.fsm.n_aps < max ? s_mgr.fsm.n_aps : max;
+    memcpy(out, s_mgr.fsm.aps, n * sizeof(*out));
+    xSemaphoreGive(s_mgr.lock);
+    return n;
+}
+
+esp_err_t wifimgr_start(void) {
+    return send_event(WIFIMGR_EV_START);
+}
+
+esp_err_t wifimgr_stop(void) {
+    return send_event(WIFIMGR_EV_STOP);
+}
+
+esp_err_t wifimgr_reconnect(void) {
+    esp_err_t err = send_event(WIFIMGR_EV_STOP);
+    return err == ESP_OK ? send_event(WIFIMGR_EV_START) : err;
+}
+
+bool wifimgr_wait_connected(uint32_t timeout_ms) {
+    if (s_mgr.events == NULL) {
+        return false;
+    }
+    EventBits_t bits =
+        xEventGroupWaitBits(s_mgr.events, WIFIMGR_CONNECTED_BIT, pdFALSE, pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    return (bits & WIFIMGR_CONNECTED_BIT) != 0;
+}
+
+void wifimgr_get_status(wifimgr_status_t* out) {
+    memset(out, 0, sizeof(*out));
+    if (s_mgr.lock == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_mgr.lock, portMAX_DELAY);
+    out->state     = s_mgr.fsm.state;
+    out->connected = s_mgr.fsm.state == WIFIMGR_STATE_CONNECTED;
+    if (s_mgr.fsm.record_valid) {
+        out->link = s_mgr.fsm.record;
+    }
+    out->n_aps   = s_mgr.fsm.n_aps;
+    out->metrics = s_mgr.fsm.metrics;
+    xSemaphoreGive(s_mgr.lock);
+}
@@ -0,0 +1,426 @@
+/**
+ * @file wifimgr_fsm.c
+ * @brief Connection state machine of wifimgr (no Wi-Fi driver, no RTOS).
+ */
+
+#include "wifimgr_fsm.h"
+
+#include <string.h>
+
+// --------------------------------------- //
+
+static const char* const s_state_names[] = {
+    [WIFIMGR_STATE_IDLE]       = "idle",
+    [WIFIMGR_STATE_SCANNING]   = "scanning",
+    [WIFIMGR_STATE_CONNECTING] = "connecting",
+    [WIFIMGR_STATE_DHCP]       = "dhcp",
+    [WIFIMGR_STATE_CONNECTED]  = "connected",
+    [WIFIMGR_STATE_BACKOFF]    = "backoff",
+};
+
+const char* wifimgr_state_name(wifimgr_state_t state) {
+    if ((unsigned) state >= sizeof(s_state_names) / sizeof(s_state_names[0])) {
+        return "?";
+    }
+    return s_state_names[state];
+}
+
+// --------------------------------------- //
+
+static void phase_add(wifimgr_phase_t* phase, int64_t since_us, int64_t now_us) {
+    uint32_t ms = (uint32_t) ((now_us - since_us) / 1000);
+    phase->count++;
+    phase->last_ms = ms;
+    phase->total_ms += ms;
+    if (ms > phase->max_ms) {
+        phase->max_ms = ms;
+    }
+}
+
+static void enter(wifimgr_fsm_t* fsm, wifimgr_state_t state, uint32_t timeout_ms, int64_t now_us) {
+    fsm->state          = state;
+    fsm->aborting       = false;
+    fsm->phase_since_us = now_us;
+    fsm->deadline_us    = timeout_ms ? now_us + (int64_t) timeout_ms * 1000 : -1;
+}
+
+static int find_ap(const wifimgr_fsm_t* fsm, const char* ssid) {
+    for (size_t i = 0; i < fsm->n_aps; i++) {
+        if (strcmp(fsm->aps[i].ssid, ssid) == 0) {
+            return (int) i;
+        }
+    }
+    return -1;
+}
+
+/* Full delay = min << step, capped; half of it is fixed and half random
+ * ("equal jitter"), so a crowd of devices losing the same AP spreads out
+ * while each one still backs off. */
+static uint32_t backoff_delay_ms(wifimgr_fsm_t* fsm) {
+    uint64_t full = (uint64_t) fsm->timing.backoff_min_ms << (fsm->backoff_step < 32 ? fsm->backoff_step : 32);
+    uint32_t delay = fsm->timing.backoff_max_ms;
+    if (full < delay) {
+        delay = (uint32_t) full;
+        fsm->backoff_step++;
+    }
+    uint32_t half = delay / 2;
+    return half + fsm->drv.random(fsm->drv.ctx) % (delay - half + 1);
+}
+
+static void scan(wifimgr_fsm_t* fsm, int64_t now_us);
+
+static void backoff(wifimgr_fsm_t* fsm, int64_t now_us) {
+    fsm->metrics.failures++;
+    fsm->current_ap = -1;
+    enter(fsm, WIFIMGR_STATE_BACKOFF, backoff_delay_ms(fsm), now_us);
+}
+
+static void connect(wifimgr_fsm_t* fsm, int ap, const uint8_t* bssid, uint8_t channel, bool fast, int64_t now_us) {
+    fsm->current_ap = ap;
+    fsm->fast       = fast;
+    fsm->lease_used = false;
+    fsm->drv.connect(fsm->drv.ctx, &fsm->aps[ap], bssid, channel);
+    enter(fsm, WIFIMGR_STATE_CONNECTING, fast ? fsm->timing.fast_assoc_timeout_ms : fsm->timing.assoc_timeout_ms,
+        now_us);
+}
+
+/* Straight to the last BSSID/channel if that network is still configured and
+ * none is preferred to it, otherwise a scan. Nothing configured: idle until
+ * WIFIMGR_EV_APS_CHANGED. */
+static void begin_attempt(wifimgr_fsm_t* fsm, int64_t now_us) {
+    if (fsm->n_aps == 0) {
+        fsm->current_ap = -1;
+        enter(fsm, WIFIMGR_STATE_IDLE, 0, now_us);
+        return;
+    }
+    if (fsm->record_valid && fsm->fast_allowed) {
+        int ap = find_ap(fsm, fsm->record.ssid);
+        for (size_t i = 0; ap >= 0 && i < fsm->n_aps; i++) {
+            if (fsm->aps[i].priority > fsm->aps[ap].priority) {
+                ap = -1;
+            }
+        }
+        if (ap >= 0) {
+            fsm->metrics.fast_attempts++;
+            connect(fsm, ap, fsm->record.bssid, fsm->record.channel, true, now_us);
+            return;
+        }
+    }
+    scan(fsm, now_us);
+}
+
+static void scan(wifimgr_fsm_t* fsm, int64_t now_us) {
+    fsm->current_ap = -1;
+    fsm->drv.scan(fsm->drv.ctx);
+    enter(fsm, WIFIMGR_STATE_SCANNING, fsm->timing.scan_timeout_ms, now_us);
+}
+
+static void next_candidate(wifimgr_fsm_t* fsm, int64_t now_us) {
+    if (fsm->next_candidate >= fsm->n_candidates) {
+        backoff(fsm, now_us);
+        return;
+    }
+    const wifimgr_candidate_t* c = &fsm->candidates[fsm->next_candidate++];
+    connect(fsm, c->ap, c->bssid, c->channel, false, now_us);
+}
+
+/* The attempt in progress failed (timeout or refused). A failed fast attempt
+ * falls back to a scan and isn't tried again until a connection succeeds. */
+static void attempt_failed(wifimgr_fsm_t* fsm, int64_t now_us) {
+    if (fsm->fast) {
+        fsm->fast         = false;
+        fsm->fast_allowed = false;
+        scan(fsm, now_us);
+    } else {
+        next_candidate(fsm, now_us);
+    }
+}
+
+/* The attempt ended after an abort_attempt() or a DISCONNECTED. If its network
+ * was removed meanwhile, the candidates are stale: scan again. */
+static void attempt_ended(wifimgr_fsm_t* fsm, int64_t now_us) {
+    if (fsm->current_ap < 0) {
+        fsm->fast = false;
+        scan(fsm, now_us);
+    } else {
+        attempt_failed(fsm, now_us);
+    }
+}
+
+/* Asks the driver to drop the attempt and waits (bounded) for the resulting
+ * DISCONNECTED, so it can't be mistaken for the failure of the next attempt. */
+static void abort_attempt(wifimgr_fsm_t* fsm, int64_t now_us) {
+    fsm->drv.disconnect(fsm->drv.ctx);
+    fsm->aborting    = true;
+    fsm->deadline_us = now_us + (int64_t) fsm->timing.abort_timeout_ms * 1000;
+}
+
+static bool candidate_before(const wifimgr_fsm_t* fsm, const wifimgr_candidate_t* a, const wifimgr_candidate_t* b) {
+    uint8_t pa = fsm->aps[a->ap].priority;
+    uint8_t pb = fsm->aps[b->ap].priority;
+    return pa != pb ? pa > pb : a->rssi > b->rssi;
+}
+
+static void build_candidates(wifimgr_fsm_t* fsm, const wifimgr_scan_result_t* results, size_t count) {
+    fsm->n_candidates   = 0;
+    fsm->next_candidate = 0;
+    for (size_t i = 0; i < count; i++) {
+        int ap = find_ap(fsm, results[i].ssid);
+        if (ap < 0) {
+            continue;
+        }
+        wifimgr_candidate_t c = {.ap = (uint8_t) ap, .channel = results[i].channel, .rssi = results[i].rssi};
+        memcpy(c.bssid, results[i].bssid, sizeof(c.bssid));
+
+        // insertion sort, the list is short; when full the worst one drops out
+        size_t n = fsm->n_candidates;
+        if (n == WIFIMGR_MAX_CANDIDATES) {
+            if (!candidate_before(fsm, &c, &fsm->candidates[n - 1])) {
+                continue;
+            }
+            n--;
+        }
+        size_t pos = n;
+        while (pos > 0 && candidate_before(fsm, &c, &fsm->candidates[pos - 1])) {
+            fsm->candidates[pos] = fsm->candidates[pos - 1];
+            pos--;
+        }
+        fsm->candidates[pos] = c;
+        fsm->n_candidates    = n + 1;
+    }
+}
+
+static void connected(wifimgr_fsm_t* fsm, const wifimgr_ip_t* ip, int64_t now_us) {
+    phase_add(&fsm->metrics.dhcp, fsm->phase_since_us, now_us);
+    phase_add(&fsm->metrics.connect, fsm->attempt_since_us, now_us);
+    if (fsm->metrics.first_connect_ms == 0) {
+        uint32_t ms                   = (uint32_t) ((now_us - fsm->start_us) / 1000);
+        fsm->metrics.first_connect_ms = ms ? ms : 1;
+    }
+    if (fsm->fast) {
+        fsm->metrics.fast_ok++;
+    }
+    if (fsm->lease_used) {
+        fsm->metrics.lease_reused++;
+    }
+    fsm->backoff_step = 0;
+    fsm->fast_allowed = true;
+    enter(fsm, WIFIMGR_STATE_CONNECTED, 0, now_us);
+
+    wifimgr_record_t record = {0};
+    strlcpy(record.ssid, fsm->aps[fsm->current_ap].ssid, sizeof(record.ssid));
+    memcpy(record.bssid, fsm->current_bssid, sizeof(record.bssid));
+    record.channel = fsm->current_channel;
+    record.lease   = *ip;
+    if (!fsm->record_valid || memcmp(&record, &fsm->record, sizeof(record)) != 0) {
+        fsm->record       = record;
+        fsm->record_valid = true;
+        if (fsm->drv.save_record) {
+            fsm->drv.save_record(fsm->drv.ctx, &fsm->record);
+        }
+    }
+
+    // a reused lease is static until DHCP takes it over again
+    if (fsm->lease_used && fsm->drv.renew_ip) {
+        fsm->drv.renew_ip(fsm->drv.ctx);
+    }
+}
+
+/* DHCP bound the address while connected: a renewal, or a reused lease taken over. */
+static void ip_renewed(wifimgr_fsm_t* fsm, const wifimgr_ip_t* ip) {
+    if (!fsm->record_valid) {
+        return;
+    }
+    fsm->record.lease = *ip;
+    if (fsm->drv.save_record) {
+        fsm->drv.save_record(fsm->drv.ctx, &fsm->record);
+    }
+}
+
+// --------------------------------------- //
+
+void wifimgr_fsm_init(wifimgr_fsm_t* fsm, const wifimgr_driver_t* drv, const wifimgr_timing_t* timing) {
+    memset(fsm, 0, sizeof(*fsm));
+    fsm->drv = *drv;
+    if (timing) {
+        fsm->timing = *timing;
+    } else {
+        fsm->timing = (wifimgr_timing_t) WIFIMGR_TIMING_DEFAULT();
+    }
+    fsm->state        = WIFIMGR_STATE_IDLE;
+    fsm->current_ap   = -1;
+    fsm->deadline_us  = -1;
+    fsm->fast_allowed = true;
+}
+
+void wifimgr_fsm_set_record(wifimgr_fsm_t* fsm, const wifimgr_record_t* record) {
+    if (record) {
+        fsm->record       = *record;
+        fsm->record_valid = record->ssid[0] != '\0';
+    } else {
+        memset(&fsm->record, 0, sizeof(fsm->record));
+        fsm->record_valid = false;
+    }
+}
+
+esp_err_t wifimgr_fsm_add_ap(wifimgr_fsm_t* fsm, const char* ssid, const char* pass, uint8_t priority) {
+    if (ssid == NULL || ssid[0] == '\0' || strlen(ssid) >= WIFIMGR_SSID_SIZE ||
+        (pass && strlen(pass) >= WIFIMGR_PASS_SIZE)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int i = find_ap(fsm, ssid);
+    if (i < 0) {
+        if (fsm->n_aps == WIFIMGR_MAX_APS) {
+            return ESP_ERR_NO_MEM;
+        }
+        i = (int) fsm->n_aps++;
+    }
+    wifimgr_ap_t* ap = &fsm->aps[i];
+    strlcpy(ap->ssid, ssid, sizeof(ap->ssid));
+    strlcpy(ap->pass, pass ? pass : "", sizeof(ap->pass));
+    ap->priority = priority;
+    return ESP_OK;
+}
+
+esp_err_t wifimgr_fsm_remove_ap(wifimgr_fsm_t* fsm, const char* ssid) {
+    int i = find_ap(fsm, ssid);
+    if (i < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    memmove(&fsm->aps[i], &fsm->aps[i + 1], (fsm->n_aps - i - 1) * sizeof(fsm->aps[0]));
+    fsm->n_aps--;
+    // candidate indexes are stale now; the current connection, if any, is kept
+    fsm->n_candidates = fsm->next_candidate = 0;
+    if (fsm->current_ap == i) {
+        fsm->current_ap = -1;
+    } else if (fsm->current_ap > i) {
+        fsm->current_ap--;
+    }
+    return ESP_OK;
+}
+
+void wifimgr_fsm_handle(wifimgr_fsm_t* fsm, const wifimgr_event_t* ev, int64_t now_us) {
+    switch (ev->id) {
+        case WIFIMGR_EV_START:
+            if (fsm->started) {
+                return;
+            }
+            fsm->started          = true;
+            fsm->start_us         = now_us;
+            fsm->attempt_since_us = now_us;
+            fsm->backoff_step     = 0;
+            if (!fsm->aborting) {  // else once the STOP before it completed
+                begin_attempt(fsm, now_us);
+            }
+            return;
+
+        case WIFIMGR_EV_STOP:
+            fsm->started    = false;
+            fsm->current_ap = -1;
+            if (fsm->state != WIFIMGR_STATE_IDLE) {
+                enter(fsm, WIFIMGR_STATE_IDLE, 0, now_us);
+                abort_attempt(fsm, now_us);
+            }
+            return;
+
+        case WIFIMGR_EV_APS_CHANGED:
+            if (!fsm->started) {
+                return;
+            }
+            if ((fsm->state == WIFIMGR_STATE_IDLE && !fsm->aborting) || fsm->state == WIFIMGR_STATE_BACKOFF) {
+                // a new network is worth trying right away
+                fsm->backoff_step = 0;
+                begin_attempt(fsm, now_us);
+            } else if (fsm->current_ap < 0 && fsm->state != WIFIMGR_STATE_SCANNING && fsm->state != WIFIMGR_STATE_IDLE) {
+                // the network in use was removed
+                abort_attempt(fsm, now_us);
+            }
+            return;
+
+        default:
+            break;
+    }
+
+    if (fsm->state == WIFIMGR_STATE_IDLE && fsm->aborting &&
+        (ev->id == WIFIMGR_EV_DISCONNECTED || ev->id == WIFIMGR_EV_TIMEOUT)) {
+        // the disconnect of a STOP completed
+        fsm->aborting    = false;
+        fsm->deadline_us = -1;
+        if (fsm->started) {
+            begin_attempt(fsm, now_us);
+        }
+        return;
+    }
+    if (!fsm->started) {
+        return;
+    }
+
+    switch (fsm->state) {
+        case WIFIMGR_STATE_SCANNING:
+            if (ev->id == WIFIMGR_EV_SCAN_DONE) {
+                phase_add(&fsm->metrics.scan, fsm->phase_since_us, now_us);
+                build_candidates(fsm, ev->scan.results, ev->scan.count);
+                next_candidate(fsm, now_us);
+            } else if (ev->id == WIFIMGR_EV_TIMEOUT) {
+                backoff(fsm, now_us);
+            }
+            break;
+
+        case WIFIMGR_STATE_CONNECTING:
+            if (ev->id == WIFIMGR_EV_ASSOCIATED && !fsm->aborting && fsm->current_ap >= 0) {
+                phase_add(&fsm->metrics.assoc, fsm->phase_since_us, now_us);
+                memcpy(fsm->current_bssid, ev->assoc.bssid, sizeof(fsm->current_bssid));
+                fsm->current_channel = ev->assoc.channel;
+                // a lease is only reused on the very AP that gave it
+                const wifimgr_ip_t* lease = NULL;
+                if (fsm->fast && fsm->record.lease.ip != 0 &&
+                    memcmp(fsm->record.bssid, ev->assoc.bssid, sizeof(fsm->record.bssid)) == 0) {
+                    lease = &fsm->record.lease;
+                }
+                enter(fsm, WIFIMGR_STATE_DHCP, fsm->timing.dhcp_timeout_ms, now_us);
+                fsm->lease_used = fsm->drv.start_ip(fsm->drv.ctx, lease) && lease != NULL;
+            } else if (ev->id == WIFIMGR_EV_DISCONNECTED || (ev->id == WIFIMGR_EV_TIMEOUT && fsm->aborting)) {
+                attempt_ended(fsm, now_us);
+            } else if (ev->id == WIFIMGR_EV_TIMEOUT) {
+                abort_attempt(fsm, now_us);
+            }
+            break;
+
+        case WIFIMGR_STATE_DHCP:
+            if (ev->id == WIFIMGR_EV_GOT_IP && !fsm->aborting && fsm->current_ap >= 0) {
+                connected(fsm, &ev->ip, now_us);
+            } else if (ev->id == WIFIMGR_EV_DISCONNECTED || (ev->id == WIFIMGR_EV_TIMEOUT && fsm->aborting)) {
+                attempt_ended(fsm, now_us);
+            } else if (ev->id == WIFIMGR_EV_TIMEOUT) {
+                abort_attempt(fsm, now_us);
+            }
+            break;
+
+        case WIFIMGR_STATE_CONNECTED:
+            if (ev->id == WIFIMGR_EV_GOT_IP && !fsm->aborting) {
+                ip_renewed(fsm, &ev->ip);
+            } else if (ev->id == WIFIMGR_EV_DISCONNECTED || (ev->id == WIFIMGR_EV_TIMEOUT && fsm->aborting)) {
+                // straight back to the same BSSID, no scan, no backoff
+                if (!fsm->aborting) {
+                    fsm->metrics.disconnects++;
+                }
+                fsm->attempt_since_us = now_us;
+                begin_attempt(fsm, now_us);
+            }
+            break;
+
+        case WIFIMGR_STATE_BACKOFF:
+            if (ev->id == WIFIMGR_EV_TIMEOUT) {
+                begin_attempt(fsm, now_us);
+            }
+            break;
+
+        case WIFIMGR_STATE_IDLE:
+        default:
+            break;
+    }
+}
+
+int64_t wifimgr_fsm_deadline(const wifimgr_fsm_t* fsm) {
+    return fsm->deadline_us;
+}